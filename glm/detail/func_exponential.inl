@@ -12,6 +12,42 @@ namespace detail
 {
 	using std::log2;
 
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_pow
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& base, vec<L, T, Q> const& exponent)
+		{
+			return detail::functor2<vec, L, T, Q>::call(std::pow, base, exponent);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_exp
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::exp, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_log
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::log, x);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_exp2
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::exp2, x);
+		}
+	};
+
 	template<length_t L, typename T, qualifier Q, bool isFloat, bool Aligned>
 	struct compute_log2
 	{
@@ -63,7 +99,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> pow(vec<L, T, Q> const& base, vec<L, T, Q> const& exponent)
 	{
-		return detail::functor2<vec, L, T, Q>::call(pow, base, exponent);
+		return detail::compute_pow<L, T, Q, detail::is_aligned<Q>::value>::call(base, exponent);
 	}
 
 	// exp
@@ -71,7 +107,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> exp(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(exp, x);
+		return detail::compute_exp<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// log
@@ -79,7 +115,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> log(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(log, x);
+		return detail::compute_log<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
     using std::exp2;
@@ -87,7 +123,7 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> exp2(vec<L, T, Q> const& x)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(exp2, x);
+		return detail::compute_exp2<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// log2, ln2 = 0.69314718055994530941723212145818f
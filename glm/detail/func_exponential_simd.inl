@@ -19,6 +19,63 @@ namespace detail
 		}
 	};
 
+	template<qualifier Q>
+	struct compute_exp<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(glm_vec4_outside_range(v.data, -87.0f, 88.0f))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::exp, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_exp2<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(glm_vec4_outside_range(v.data, -125.0f, 127.0f))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::exp2, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_exp2(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(glm_vec4_log_outside_range(v.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::log, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log2<4, float, Q, true, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(glm_vec4_log_outside_range(v.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::log2, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_log2(v.data);
+			return Result;
+		}
+	};
+
+
 #	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
 	template<>
 	struct compute_sqrt<4, float, aligned_lowp, true>
@@ -31,6 +88,84 @@ namespace detail
 		}
 	};
 #	endif
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_exp<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			if(glm_dvec4_outside_range(v.data, -708.0, 709.0))
+				return detail::functor1<vec, 4, double, double, Q>::call(std::exp, v);
+
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_exp(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_exp2<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			if(glm_dvec4_outside_range(v.data, -1022.0, 1023.0))
+				return detail::functor1<vec, 4, double, double, Q>::call(std::exp2, v);
+
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_exp2(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			if(glm_dvec4_log_outside_range(v.data))
+				return detail::functor1<vec, 4, double, double, Q>::call(std::log, v);
+
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_log(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_log2<4, double, Q, true, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			if(glm_dvec4_log_outside_range(v.data))
+				return detail::functor1<vec, 4, double, double, Q>::call(std::log2, v);
+
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_log2(v.data);
+			return Result;
+		}
+	};
+
+
+	// pow(x, y) = exp2(y * log2(x)) with double precision intermediates so that the error of y * log2(x) doesn't show in the result
+	template<qualifier Q>
+	struct compute_pow<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& base, vec<4, float, Q> const& exponent)
+		{
+			if(glm_vec4_log_outside_range(base.data))
+				return detail::functor2<vec, 4, float, Q>::call(std::pow, base, exponent);
+
+			glm_f64vec4 const Product = _mm256_mul_pd(_mm256_cvtps_pd(exponent.data), glm_vec4_log2_f64(base.data));
+			if(glm_dvec4_outside_range(Product, -126.0, 127.0))
+				return detail::functor2<vec, 4, float, Q>::call(std::pow, base, exponent);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_dvec4_exp2_f32(Product);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
 }//namespace detail
 }//namespace glm
 
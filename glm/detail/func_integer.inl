@@ -88,8 +88,35 @@ namespace detail
 			}
 		};
 #		endif
+#	elif GLM_HAS_BITSCAN_BUILTIN
+		template<typename genIUType>
+		struct compute_findLSB<genIUType, 32>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType Value)
+			{
+				return Value == 0 ? -1 : __builtin_ctz(static_cast<unsigned int>(Value));
+			}
+		};
+
+		template<typename genIUType>
+		struct compute_findLSB<genIUType, 64>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType Value)
+			{
+				return Value == 0 ? -1 : __builtin_ctzll(static_cast<unsigned long long>(Value));
+			}
+		};
 #	endif//GLM_HAS_BITSCAN_WINDOWS
 
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_findLSB_vec
+	{
+		GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& x)
+		{
+			return detail::functor1<vec, L, int, T, Q>::call(compute_findLSB<T, sizeof(T) * 8>::call, x);
+		}
+	};
+
 	template<length_t L, typename T, qualifier Q, bool EXEC = true>
 	struct compute_findMSB_step_vec
 	{
@@ -108,7 +135,7 @@ namespace detail
 		}
 	};
 
-	template<length_t L, typename T, qualifier Q, int>
+	template<length_t L, typename T, qualifier Q, int Bits, bool Aligned>
 	struct compute_findMSB_vec
 	{
 		GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& v)
@@ -133,8 +160,8 @@ namespace detail
 			return IsNotNull ? int(Result) : -1;
 		}
 
-		template<length_t L, typename T, qualifier Q>
-		struct compute_findMSB_vec<L, T, Q, 32>
+		template<length_t L, typename T, qualifier Q, bool Aligned>
+		struct compute_findMSB_vec<L, T, Q, 32, Aligned>
 		{
 			GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& x)
 			{
@@ -151,8 +178,8 @@ namespace detail
 			return IsNotNull ? int(Result) : -1;
 		}
 
-		template<length_t L, typename T, qualifier Q>
-		struct compute_findMSB_vec<L, T, Q, 64>
+		template<length_t L, typename T, qualifier Q, bool Aligned>
+		struct compute_findMSB_vec<L, T, Q, 64, Aligned>
 		{
 			GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& x)
 			{
@@ -160,7 +187,109 @@ namespace detail
 			}
 		};
 #		endif
+#	elif GLM_HAS_BITSCAN_BUILTIN
+		template<typename genIUType>
+		GLM_FUNC_QUALIFIER int compute_findMSB_32(genIUType Value)
+		{
+			return Value == 0 ? -1 : 31 - __builtin_clz(static_cast<unsigned int>(Value));
+		}
+
+		template<length_t L, typename T, qualifier Q, bool Aligned>
+		struct compute_findMSB_vec<L, T, Q, 32, Aligned>
+		{
+			GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& x)
+			{
+				return detail::functor1<vec, L, int, T, Q>::call(compute_findMSB_32, x);
+			}
+		};
+
+		template<typename genIUType>
+		GLM_FUNC_QUALIFIER int compute_findMSB_64(genIUType Value)
+		{
+			return Value == 0 ? -1 : 63 - __builtin_clzll(static_cast<unsigned long long>(Value));
+		}
+
+		template<length_t L, typename T, qualifier Q, bool Aligned>
+		struct compute_findMSB_vec<L, T, Q, 64, Aligned>
+		{
+			GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& x)
+			{
+				return detail::functor1<vec, L, int, T, Q>::call(compute_findMSB_64, x);
+			}
+		};
 #	endif//GLM_HAS_BITSCAN_WINDOWS
+
+	template<length_t L, typename T, qualifier Q, int Bits, bool Aligned>
+	struct compute_bitCount_vec
+	{
+		GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& v)
+		{
+#			if GLM_COMPILER & GLM_COMPILER_VC
+#				pragma warning(push)
+#				pragma warning(disable : 4310) //cast truncates constant value
+#			endif
+
+			vec<L, typename std::make_unsigned<T>::type, Q> x(v);
+			x = compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, Aligned, Bits>=  2>::call(x, typename std::make_unsigned<T>::type(0x5555555555555555ull), typename std::make_unsigned<T>::type( 1));
+			x = compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, Aligned, Bits>=  4>::call(x, typename std::make_unsigned<T>::type(0x3333333333333333ull), typename std::make_unsigned<T>::type( 2));
+			x = compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, Aligned, Bits>=  8>::call(x, typename std::make_unsigned<T>::type(0x0F0F0F0F0F0F0F0Full), typename std::make_unsigned<T>::type( 4));
+			x = compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, Aligned, Bits>= 16>::call(x, typename std::make_unsigned<T>::type(0x00FF00FF00FF00FFull), typename std::make_unsigned<T>::type( 8));
+			x = compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, Aligned, Bits>= 32>::call(x, typename std::make_unsigned<T>::type(0x0000FFFF0000FFFFull), typename std::make_unsigned<T>::type(16));
+			x = compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, Aligned, Bits>= 64>::call(x, typename std::make_unsigned<T>::type(0x00000000FFFFFFFFull), typename std::make_unsigned<T>::type(32));
+			return vec<L, int, Q>(x);
+
+#			if GLM_COMPILER & GLM_COMPILER_VC
+#				pragma warning(pop)
+#			endif
+		}
+	};
+
+	template<typename genIUType, size_t Bits>
+	struct compute_bitCount
+	{
+		GLM_FUNC_QUALIFIER static int call(genIUType x)
+		{
+			return compute_bitCount_vec<1, genIUType, defaultp, Bits, false>::call(vec<1, genIUType, defaultp>(x)).x;
+		}
+	};
+
+#	if GLM_HAS_POPCOUNT_BUILTIN
+		template<typename genIUType>
+		struct compute_bitCount<genIUType, 32>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType x)
+			{
+				return __builtin_popcount(static_cast<unsigned int>(x));
+			}
+		};
+
+		template<typename genIUType>
+		struct compute_bitCount<genIUType, 64>
+		{
+			GLM_FUNC_QUALIFIER static int call(genIUType x)
+			{
+				return __builtin_popcountll(static_cast<unsigned long long>(x));
+			}
+		};
+
+		template<length_t L, typename T, qualifier Q, bool Aligned>
+		struct compute_bitCount_vec<L, T, Q, 32, Aligned>
+		{
+			GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& x)
+			{
+				return detail::functor1<vec, L, int, T, Q>::call(compute_bitCount<T, 32>::call, x);
+			}
+		};
+
+		template<length_t L, typename T, qualifier Q, bool Aligned>
+		struct compute_bitCount_vec<L, T, Q, 64, Aligned>
+		{
+			GLM_FUNC_QUALIFIER static vec<L, int, Q> call(vec<L, T, Q> const& x)
+			{
+				return detail::functor1<vec, L, int, T, Q>::call(compute_bitCount<T, 64>::call, x);
+			}
+		};
+#	endif//GLM_HAS_POPCOUNT_BUILTIN
 }//namespace detail
 
 	// uaddCarry
@@ -304,7 +433,7 @@ namespace detail
 	{
 		static_assert(std::numeric_limits<genIUType>::is_integer, "'bitCount' only accept integer values");
 
-		return bitCount(glm::vec<1, genIUType, glm::defaultp>(x)).x;
+		return detail::compute_bitCount<genIUType, sizeof(genIUType) * 8>::call(x);
 	}
 
 	template<length_t L, typename T, qualifier Q>
@@ -312,23 +441,7 @@ namespace detail
 	{
 		static_assert(std::numeric_limits<T>::is_integer, "'bitCount' only accept integer values");
 
-#		if GLM_COMPILER & GLM_COMPILER_VC
-#			pragma warning(push)
-#			pragma warning(disable : 4310) //cast truncates constant value
-#		endif
-
-		vec<L, typename std::make_unsigned<T>::type, Q> x(v);
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>=  2>::call(x, typename std::make_unsigned<T>::type(0x5555555555555555ull), typename std::make_unsigned<T>::type( 1));
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>=  4>::call(x, typename std::make_unsigned<T>::type(0x3333333333333333ull), typename std::make_unsigned<T>::type( 2));
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>=  8>::call(x, typename std::make_unsigned<T>::type(0x0F0F0F0F0F0F0F0Full), typename std::make_unsigned<T>::type( 4));
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>= 16>::call(x, typename std::make_unsigned<T>::type(0x00FF00FF00FF00FFull), typename std::make_unsigned<T>::type( 8));
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>= 32>::call(x, typename std::make_unsigned<T>::type(0x0000FFFF0000FFFFull), typename std::make_unsigned<T>::type(16));
-		x = detail::compute_bitfieldBitCountStep<L, typename std::make_unsigned<T>::type, Q, detail::is_aligned<Q>::value, sizeof(T) * 8>= 64>::call(x, typename std::make_unsigned<T>::type(0x00000000FFFFFFFFull), typename std::make_unsigned<T>::type(32));
-		return vec<L, int, Q>(x);
-
-#		if GLM_COMPILER & GLM_COMPILER_VC
-#			pragma warning(pop)
-#		endif
+		return detail::compute_bitCount_vec<L, T, Q, static_cast<int>(sizeof(T) * 8), detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// findLSB
@@ -345,7 +458,7 @@ namespace detail
 	{
 		static_assert(std::numeric_limits<T>::is_integer, "'findLSB' only accept integer values");
 
-		return detail::functor1<vec, L, int, T, Q>::call(findLSB, x);
+		return detail::compute_findLSB_vec<L, T, Q, detail::is_aligned<Q>::value>::call(x);
 	}
 
 	// findMSB
@@ -362,7 +475,7 @@ namespace detail
 	{
 		static_assert(std::numeric_limits<T>::is_integer, "'findMSB' only accept integer values");
 
-		return detail::compute_findMSB_vec<L, T, Q, static_cast<int>(sizeof(T) * 8)>::call(v);
+		return detail::compute_findMSB_vec<L, T, Q, static_cast<int>(sizeof(T) * 8), detail::is_aligned<Q>::value>::call(v);
 	}
 }//namespace glm
 
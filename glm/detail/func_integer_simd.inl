@@ -27,19 +27,68 @@ namespace detail
 	};
 
 	template<qualifier Q>
-	struct compute_bitfieldBitCountStep<4, uint, Q, true, true>
+	struct compute_bitCount_vec<4, int, Q, 32, true>
 	{
-		GLM_FUNC_QUALIFIER static vec<4, uint, Q> call(vec<4, uint, Q> const& v, uint Mask, uint Shift)
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, int, Q> const& v)
 		{
-			__m128i const set0 = v.data;
+			vec<4, int, Q> Result;
+			Result.data = glm_i32vec4_bit_count(v.data);
+			return Result;
+		}
+	};
 
-			__m128i const set1 = _mm_set1_epi32(static_cast<int>(Mask));
-			__m128i const and0 = _mm_and_si128(set0, set1);
-			__m128i const sft0 = _mm_slli_epi32(set0, static_cast<int>(Shift));
-			__m128i const and1 = _mm_and_si128(sft0, set1);
-			__m128i const add0 = _mm_add_epi32(and0, and1);
+	template<qualifier Q>
+	struct compute_bitCount_vec<4, uint, Q, 32, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, uint, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_i32vec4_bit_count(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_findLSB_vec<4, int, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, int, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_i32vec4_find_lsb(v.data);
+			return Result;
+		}
+	};
 
-			return add0;
+	template<qualifier Q>
+	struct compute_findLSB_vec<4, uint, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, uint, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_i32vec4_find_lsb(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_findMSB_vec<4, int, Q, 32, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, int, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_i32vec4_find_msb(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_findMSB_vec<4, uint, Q, 32, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, int, Q> call(vec<4, uint, Q> const& v)
+		{
+			vec<4, int, Q> Result;
+			Result.data = glm_i32vec4_find_msb(v.data);
+			return Result;
 		}
 	};
 }//namespace detail
@@ -2,8 +2,64 @@
 #include <cmath>
 #include <limits>
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_sin
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::sin, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_cos
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::cos, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_tan
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::tan, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_asin
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::asin, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_acos
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::acos, v);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_atan
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& v)
+		{
+			return detail::functor1<vec, L, T, T, Q>::call(std::atan, v);
+		}
+	};
+}//namespace detail
+
 	// radians
 	template<typename genType>
 	GLM_FUNC_QUALIFIER GLM_CONSTEXPR genType radians(genType degrees)
@@ -40,7 +96,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> sin(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(sin, v);
+		return detail::compute_sin<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// cos
@@ -49,7 +105,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> cos(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(cos, v);
+		return detail::compute_cos<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// tan
@@ -58,7 +114,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> tan(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(tan, v);
+		return detail::compute_tan<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// asin
@@ -67,7 +123,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> asin(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(asin, v);
+		return detail::compute_asin<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// acos
@@ -76,7 +132,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> acos(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(acos, v);
+		return detail::compute_acos<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// atan
@@ -99,7 +155,7 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> atan(vec<L, T, Q> const& v)
 	{
-		return detail::functor1<vec, L, T, T, Q>::call(atan, v);
+		return detail::compute_atan<L, T, Q, detail::is_aligned<Q>::value>::call(v);
 	}
 
 	// sinh
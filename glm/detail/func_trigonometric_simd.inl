@@ -0,0 +1,142 @@
+/// @ref core
+/// @file glm/detail/func_trigonometric_simd.inl
+
+#include "../simd/trigonometric.h"
+
+#if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
+
+namespace glm{
+namespace detail
+{
+	// The polynomial kernels are only accurate for moderate arguments, other lanes fall back to std:: functions
+	template<qualifier Q>
+	struct compute_sin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(glm_vec4_trig_outside_range(v.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::sin, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(glm_vec4_trig_outside_range(v.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::cos, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_cos(v.data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_tan<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			if(glm_vec4_trig_outside_range(v.data))
+				return detail::functor1<vec, 4, float, float, Q>::call(std::tan, v);
+
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_tan(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_asin<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_asin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_acos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_acos(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_atan<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, float, Q> call(vec<4, float, Q> const& v)
+		{
+			vec<4, float, Q> Result;
+			Result.data = glm_vec4_atan(v.data);
+			return Result;
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_sin<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			if(glm_dvec4_trig_outside_range(v.data))
+				return detail::functor1<vec, 4, double, double, Q>::call(std::sin, v);
+
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_sin(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_cos<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			if(glm_dvec4_trig_outside_range(v.data))
+				return detail::functor1<vec, 4, double, double, Q>::call(std::cos, v);
+
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_cos(v.data);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_tan<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<4, double, Q> call(vec<4, double, Q> const& v)
+		{
+			if(glm_dvec4_trig_outside_range(v.data))
+				return detail::functor1<vec, 4, double, double, Q>::call(std::tan, v);
+
+			vec<4, double, Q> Result;
+			Result.data = glm_dvec4_tan(v.data);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
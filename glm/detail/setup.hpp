@@ -154,6 +154,20 @@
 #	define GLM_HAS_BITSCAN_WINDOWS 0
 #endif
 
+// GCC and Clang bit scan builtins, compiled to tzcnt and lzcnt when the target supports them, bsf and bsr otherwise
+#if defined(GLM_FORCE_INTRINSICS) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+#	define GLM_HAS_BITSCAN_BUILTIN 1
+#else
+#	define GLM_HAS_BITSCAN_BUILTIN 0
+#endif
+
+// The population count builtin is only used when it compiles to an instruction rather than to a library call
+#if GLM_HAS_BITSCAN_BUILTIN && (defined(__POPCNT__) || defined(__ARM_NEON))
+#	define GLM_HAS_POPCOUNT_BUILTIN 1
+#else
+#	define GLM_HAS_POPCOUNT_BUILTIN 0
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////
 // OpenMP
 #ifdef _OPENMP
@@ -462,6 +476,15 @@ namespace detail
 #	define GLM_CONFIG_SIMD GLM_DISABLE
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////
+// Select the SIMD kernels of bulk functions at runtime
+
+#if (GLM_CONFIG_SIMD == GLM_ENABLE) && (GLM_ARCH_DISPATCH != GLM_ARCH)
+#	define GLM_CONFIG_SIMD_DISPATCH GLM_ENABLE
+#else
+#	define GLM_CONFIG_SIMD_DISPATCH GLM_DISABLE
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Configure the use of defaulted initialized types
 
@@ -627,7 +650,12 @@ namespace detail
 #	endif
 
 	// Report build target
-#	if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#	if (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_64)
+#		pragma message("GLM: x86 64 bits with AVX-512 instruction set build target")
+#	elif (GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_MODEL == GLM_MODEL_32)
+#		pragma message("GLM: x86 32 bits with AVX-512 instruction set build target")
+
+#	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_64)
 #		pragma message("GLM: x86 64 bits with AVX2 instruction set build target")
 #	elif (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (GLM_MODEL == GLM_MODEL_32)
 #		pragma message("GLM: x86 32 bits with AVX2 instruction set build target")
@@ -690,6 +718,10 @@ namespace detail
 #		pragma message("GLM: Unknown build target")
 #	endif//GLM_ARCH
 
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+#		pragma message("GLM: GLM_FORCE_SIMD_DISPATCH is defined, bulk functions select AVX, AVX2 or AVX-512 kernels at runtime when available")
+#	endif
+
 	// Report platform name
 #	if(GLM_PLATFORM & GLM_PLATFORM_QNXNTO)
 #		pragma message("GLM: QNX platform detected")
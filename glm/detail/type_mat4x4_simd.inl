@@ -1,6 +1,43 @@
 /// @ref core
 
-namespace glm
+#include "../simd/matrix.h"
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+namespace glm{
+namespace detail
 {
+	template<qualifier Q>
+	struct mul4x4<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m1, mat<4, 4, double, Q> const& m2)
+		{
+			mat<4, 4, double, Q> Result;
+			glm_dmat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
 
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct mul4x4<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_mul_avx512(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+}//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
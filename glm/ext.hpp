@@ -13,6 +13,14 @@
 #	pragma message("GLM: All extensions included (not recommended)")
 #endif//GLM_MESSAGES
 
+#include "./ext/color_space_batch.hpp"
+
+#include "./ext/frustum_culling.hpp"
+
+#include "./ext/intersect_batch.hpp"
+
+#include "./ext/matrix_affine.hpp"
+#include "./ext/matrix_batch.hpp"
 #include "./ext/matrix_clip_space.hpp"
 #include "./ext/matrix_common.hpp"
 
@@ -96,6 +104,11 @@
 #include "./ext/matrix_relational.hpp"
 #include "./ext/matrix_transform.hpp"
 
+#include "./ext/noise_batch.hpp"
+
+#include "./ext/packing_batch.hpp"
+
+#include "./ext/quaternion_batch.hpp"
 #include "./ext/quaternion_common.hpp"
 #include "./ext/quaternion_double.hpp"
 #include "./ext/quaternion_double_precision.hpp"
@@ -113,7 +126,9 @@
 #include "./ext/scalar_packing.hpp"
 #include "./ext/scalar_reciprocal.hpp"
 #include "./ext/scalar_relational.hpp"
+#include "./ext/scalar_trigonometric.hpp"
 #include "./ext/scalar_ulp.hpp"
+#include "./ext/simd_dispatch.hpp"
 
 #include "./ext/scalar_int_sized.hpp"
 #include "./ext/scalar_uint_sized.hpp"
@@ -123,6 +138,8 @@
 #include "./ext/vector_packing.hpp"
 #include "./ext/vector_reciprocal.hpp"
 #include "./ext/vector_relational.hpp"
+#include "./ext/vector_soa.hpp"
+#include "./ext/vector_trigonometric.hpp"
 #include "./ext/vector_ulp.hpp"
 
 #include "./ext/vector_bool1.hpp"
@@ -196,6 +213,8 @@
 #ifdef GLM_ENABLE_EXPERIMENTAL
 #include "./gtx/associated_min_max.hpp"
 #include "./gtx/bit.hpp"
+#include "./gtx/bounding_volume.hpp"
+#include "./gtx/bvh.hpp"
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_encoding.hpp"
 #include "./gtx/color_space.hpp"
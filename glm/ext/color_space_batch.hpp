@@ -0,0 +1,151 @@
+/// @ref ext_color_space_batch
+/// @file glm/ext/color_space_batch.hpp
+///
+/// @defgroup ext_color_space_batch GLM_EXT_color_space_batch
+/// @ingroup ext
+///
+/// Defines functions that convert whole arrays of colors, eg the pixels of an image, between linear and sRGB
+/// encodings, and between RGB and the YCoCg, YCoCg-R and CIE XYZ color spaces.
+///
+/// Each element gives the same result as the function of the same name of gtc_color_space, gtx_color_space_YCoCg
+/// or gtx_color_encoding, up to the accuracy of the transfer functions. The arrays may be the same, in == out,
+/// but must not overlap otherwise.
+///
+/// Internally, float colors are processed using SSE2 when available. The transfer functions evaluate pow
+/// as exp2(log2(x) * y) with relative errors below 1e-6. The color space functions follow the operations
+/// of the single color functions in the same order, so the results are the same as long as the compiler
+/// doesn't contract multiply and add into FMA instructions. 8-bit sRGB colors are decoded through a table of 256 values.
+///
+/// Include <glm/ext/color_space_batch.hpp> to use the features of this extension.
+///
+/// @see gtc_color_space
+/// @see gtx_color_space_YCoCg
+/// @see gtx_color_encoding
+
+#pragma once
+
+// Dependencies
+#include "../gtc/color_space.hpp"
+#include "../common.hpp"
+#include "../detail/type_vec1.hpp"
+#include "scalar_uint_sized.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_color_space_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_color_space_batch
+	/// @{
+
+	/// Converts count linear colors to sRGB, out[i] = convertLinearToSRGB(in[i]).
+	/// The colors are clamped to [0, 1] and the alpha of 4 component colors is copied unchanged.
+	/// Unlike convertLinearToSRGB, lowp vec3 colors use the exact curve.
+	///
+	/// @tparam L Integer between 1 and 4 inclusive that qualify the number of components of the colors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertLinearToSRGB(vec<L, T, Q> const* in, vec<L, T, Q>* out, std::size_t count);
+
+	/// Converts count linear colors to sRGB using a custom gamma, out[i] = convertLinearToSRGB(in[i], gamma).
+	///
+	/// @see convertLinearToSRGB
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertLinearToSRGB(vec<L, T, Q> const* in, vec<L, T, Q>* out, std::size_t count, T gamma);
+
+	/// Converts count linear colors to 8-bit sRGB, out[i] = round(convertLinearToSRGB(in[i]) * 255).
+	/// The alpha of 4 component colors is clamped to [0, 1] and scaled the same way without conversion.
+	///
+	/// @tparam L Integer between 1 and 4 inclusive that qualify the number of components of the colors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertLinearToSRGB(vec<L, T, Q> const* in, vec<L, uint8, Q>* out, std::size_t count);
+
+	/// Converts count sRGB colors to linear, out[i] = convertSRGBToLinear(in[i]).
+	/// The alpha of 4 component colors is copied unchanged.
+	///
+	/// @tparam L Integer between 1 and 4 inclusive that qualify the number of components of the colors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertSRGBToLinear(vec<L, T, Q> const* in, vec<L, T, Q>* out, std::size_t count);
+
+	/// Converts count sRGB colors to linear using a custom gamma, out[i] = convertSRGBToLinear(in[i], gamma).
+	///
+	/// @see convertSRGBToLinear
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertSRGBToLinear(vec<L, T, Q> const* in, vec<L, T, Q>* out, std::size_t count, T gamma);
+
+	/// Converts count 8-bit sRGB colors to linear, out[i] = convertSRGBToLinear(vec<L, T, Q>(in[i]) / 255),
+	/// reading a table of the 256 possible values. The alpha of 4 component colors is only divided by 255.
+	///
+	/// @tparam L Integer between 1 and 4 inclusive that qualify the number of components of the colors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertSRGBToLinear(vec<L, uint8, Q> const* in, vec<L, T, Q>* out, std::size_t count);
+
+	/// Converts count RGB colors to YCoCg, out[i] = rgb2YCoCg(in[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void rgb2YCoCg(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Converts count YCoCg colors to RGB, out[i] = YCoCg2rgb(in[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void YCoCg2rgb(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Converts count RGB colors to YCoCg-R, out[i] = rgb2YCoCgR(in[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void rgb2YCoCgR(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Converts count YCoCg-R colors to RGB, out[i] = YCoCgR2rgb(in[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void YCoCgR2rgb(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Converts count linear sRGB colors to D65 XYZ, out[i] = convertLinearSRGBToD65XYZ(in[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertLinearSRGBToD65XYZ(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Converts count linear sRGB colors to D50 XYZ, out[i] = convertLinearSRGBToD50XYZ(in[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertLinearSRGBToD50XYZ(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Converts count D65 XYZ colors to linear sRGB, out[i] = convertD65XYZToLinearSRGB(in[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertD65XYZToLinearSRGB(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Converts count D65 XYZ colors to D50 XYZ, out[i] = convertD65XYZToD50XYZ(in[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void convertD65XYZToD50XYZ(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "color_space_batch.inl"
@@ -0,0 +1,280 @@
+/// @ref ext_color_space_batch
+
+namespace glm{
+namespace detail
+{
+	// Colors from first to count are converted one at a time,
+	// SIMD specializations process the leading colors and call this for the remaining ones.
+	template<length_t L, typename T, qualifier Q, bool UseSimd>
+	struct compute_srgb_batch
+	{
+		GLM_FUNC_QUALIFIER static void encode(vec<L, T, Q> const* in, vec<L, T, Q>* out, std::size_t count, T Exponent, std::size_t first)
+		{
+			for(std::size_t i = first; i < count; ++i)
+				out[i] = compute_rgbToSrgb<L, T, Q>::call(in[i], Exponent);
+		}
+
+		GLM_FUNC_QUALIFIER static void decode(vec<L, T, Q> const* in, vec<L, T, Q>* out, std::size_t count, T Gamma, std::size_t first)
+		{
+			for(std::size_t i = first; i < count; ++i)
+				out[i] = compute_srgbToRgb<L, T, Q>::call(in[i], Gamma);
+		}
+	};
+
+	// Linear values of the 256 8-bit sRGB values
+	template<typename T>
+	struct srgb_decode_table
+	{
+		srgb_decode_table()
+		{
+			for(int i = 0; i < 256; ++i)
+				Values[i] = convertSRGBToLinear(vec<1, T, defaultp>(static_cast<T>(i) / static_cast<T>(255))).x;
+		}
+
+		T Values[256];
+	};
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T const* srgb_decode_values()
+	{
+		static srgb_decode_table<T> const Table;
+		return Table.Values;
+	}
+
+	// Single color functions of the color spaces, with the operations of gtx_color_space_YCoCg and gtx_color_encoding
+	struct color_rgb2YCoCg
+	{
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static vec<3, T, Q> call(vec<3, T, Q> const& c)
+		{
+			return vec<3, T, Q>(
+				  c.x / T(4) + c.y / T(2) + c.z / T(4),
+				  c.x / T(2) + c.y * T(0) - c.z / T(2),
+				- c.x / T(4) + c.y / T(2) - c.z / T(4));
+		}
+	};
+
+	struct color_YCoCg2rgb
+	{
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static vec<3, T, Q> call(vec<3, T, Q> const& c)
+		{
+			return vec<3, T, Q>(c.x + c.y - c.z, c.x + c.z, c.x - c.y - c.z);
+		}
+	};
+
+	struct color_rgb2YCoCgR
+	{
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static vec<3, T, Q> call(vec<3, T, Q> const& c)
+		{
+			return vec<3, T, Q>(
+				c.y * static_cast<T>(0.5) + (c.x + c.z) * static_cast<T>(0.25),
+				c.x - c.z,
+				c.y - (c.x + c.z) * static_cast<T>(0.5));
+		}
+	};
+
+	struct color_YCoCgR2rgb
+	{
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static vec<3, T, Q> call(vec<3, T, Q> const& c)
+		{
+			T const tmp = c.x - (c.z * static_cast<T>(0.5));
+			T const b = tmp - (c.y * static_cast<T>(0.5));
+			return vec<3, T, Q>(b + c.y, c.z + tmp, b);
+		}
+	};
+
+	// Coefficients M, N and O of the functions of gtx_color_encoding, channel c becoming M[c] * c + N[c] * c + O[c] * c
+	struct color_linear_srgb_to_d65xyz
+	{
+		GLM_FUNC_QUALIFIER static float const* M() { static float const Values[] = {0.490f, 0.17697f, 0.2f}; return Values; }
+		GLM_FUNC_QUALIFIER static float const* N() { static float const Values[] = {0.31f, 0.8124f, 0.01063f}; return Values; }
+		GLM_FUNC_QUALIFIER static float const* O() { static float const Values[] = {0.490f, 0.01f, 0.99f}; return Values; }
+		GLM_FUNC_QUALIFIER static float Scale() { return 5.650675255693055f; }
+	};
+
+	struct color_linear_srgb_to_d50xyz
+	{
+		GLM_FUNC_QUALIFIER static float const* M() { static float const Values[] = {0.436030342570117f, 0.222438466210245f, 0.013897440074263f}; return Values; }
+		GLM_FUNC_QUALIFIER static float const* N() { static float const Values[] = {0.385101860087134f, 0.716942745571917f, 0.097076381494207f}; return Values; }
+		GLM_FUNC_QUALIFIER static float const* O() { static float const Values[] = {0.143067806654203f, 0.060618777416563f, 0.713926257896652f}; return Values; }
+		GLM_FUNC_QUALIFIER static float Scale() { return 1.0f; }
+	};
+
+	struct color_d65xyz_to_linear_srgb
+	{
+		GLM_FUNC_QUALIFIER static float const* M() { static float const Values[] = {0.41847f, -0.091169f, 0.0009209f}; return Values; }
+		GLM_FUNC_QUALIFIER static float const* N() { static float const Values[] = {-0.15866f, 0.25243f, 0.015708f}; return Values; }
+		GLM_FUNC_QUALIFIER static float const* O() { static float const Values[] = {0.0009209f, -0.0025498f, 0.1786f}; return Values; }
+		GLM_FUNC_QUALIFIER static float Scale() { return 1.0f; }
+	};
+
+	struct color_d65xyz_to_d50xyz
+	{
+		GLM_FUNC_QUALIFIER static float const* M() { static float const Values[] = {+1.047844353856414f, +0.029549007606644f, -0.009250984365223f}; return Values; }
+		GLM_FUNC_QUALIFIER static float const* N() { static float const Values[] = {+0.022898981050086f, +0.990508028941971f, +0.015072338237051f}; return Values; }
+		GLM_FUNC_QUALIFIER static float const* O() { static float const Values[] = {-0.050206647741605f, -0.017074711360960f, +0.751717835079977f}; return Values; }
+		GLM_FUNC_QUALIFIER static float Scale() { return 1.0f; }
+	};
+
+	template<typename coefficients>
+	struct color_scale
+	{
+		template<typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static vec<3, T, Q> call(vec<3, T, Q> const& c)
+		{
+			vec<3, T, Q> const M(coefficients::M()[0], coefficients::M()[1], coefficients::M()[2]);
+			vec<3, T, Q> const N(coefficients::N()[0], coefficients::N()[1], coefficients::N()[2]);
+			vec<3, T, Q> const O(coefficients::O()[0], coefficients::O()[1], coefficients::O()[2]);
+
+			vec<3, T, Q> const Result(M * c + N * c + O * c);
+			return coefficients::Scale() != 1.0f ? Result * static_cast<T>(coefficients::Scale()) : Result;
+		}
+	};
+
+	template<typename T, qualifier Q, typename transform, bool UseSimd>
+	struct compute_color_space_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count, std::size_t first)
+		{
+			for(std::size_t i = first; i < count; ++i)
+				out[i] = transform::call(in[i]);
+		}
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void convertLinearToSRGB(vec<L, T, Q> const* in, vec<L, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'convertLinearToSRGB' accepts only floating-point inputs");
+
+		detail::compute_srgb_batch<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::encode(in, out, count, static_cast<T>(0.41666), 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void convertLinearToSRGB(vec<L, T, Q> const* in, vec<L, T, Q>* out, std::size_t count, T gamma)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'convertLinearToSRGB' accepts only floating-point inputs");
+
+		detail::compute_srgb_batch<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::encode(in, out, count, static_cast<T>(1) / gamma, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void convertLinearToSRGB(vec<L, T, Q> const* in, vec<L, uint8, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'convertLinearToSRGB' accepts only floating-point inputs");
+
+		// Colors are encoded by chunks in a buffer on the stack, then quantized
+		vec<L, T, Q> Encoded[64];
+		for(std::size_t First = 0; First < count; First += 64)
+		{
+			std::size_t const Size = count - First < 64 ? count - First : 64;
+			detail::compute_srgb_batch<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::encode(in + First, Encoded, Size, static_cast<T>(0.41666), 0);
+			for(std::size_t i = 0; i < Size; ++i)
+				out[First + i] = vec<L, uint8, Q>(round(clamp(Encoded[i], static_cast<T>(0), static_cast<T>(1)) * static_cast<T>(255)));
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void convertSRGBToLinear(vec<L, T, Q> const* in, vec<L, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'convertSRGBToLinear' accepts only floating-point inputs");
+
+		detail::compute_srgb_batch<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::decode(in, out, count, static_cast<T>(2.4), 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void convertSRGBToLinear(vec<L, T, Q> const* in, vec<L, T, Q>* out, std::size_t count, T gamma)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'convertSRGBToLinear' accepts only floating-point inputs");
+
+		detail::compute_srgb_batch<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::decode(in, out, count, gamma, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void convertSRGBToLinear(vec<L, uint8, Q> const* in, vec<L, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'convertSRGBToLinear' accepts only floating-point inputs");
+
+		T const* Values = detail::srgb_decode_values<T>();
+		length_t const Colors = L == 4 ? 3 : L;
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			vec<L, uint8, Q> const Color(in[i]);
+			for(length_t c = 0; c < Colors; ++c)
+				out[i][c] = Values[Color[c]];
+			if(L == 4)
+				out[i][L - 1] = static_cast<T>(Color[L - 1]) / static_cast<T>(255);
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void rgb2YCoCg(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'rgb2YCoCg' accepts only floating-point inputs");
+
+		detail::compute_color_space_batch<T, Q, detail::color_rgb2YCoCg, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void YCoCg2rgb(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'YCoCg2rgb' accepts only floating-point inputs");
+
+		detail::compute_color_space_batch<T, Q, detail::color_YCoCg2rgb, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void rgb2YCoCgR(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'rgb2YCoCgR' accepts only floating-point inputs");
+
+		detail::compute_color_space_batch<T, Q, detail::color_rgb2YCoCgR, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void YCoCgR2rgb(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'YCoCgR2rgb' accepts only floating-point inputs");
+
+		detail::compute_color_space_batch<T, Q, detail::color_YCoCgR2rgb, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void convertLinearSRGBToD65XYZ(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'convertLinearSRGBToD65XYZ' accepts only floating-point inputs");
+
+		detail::compute_color_space_batch<T, Q, detail::color_scale<detail::color_linear_srgb_to_d65xyz>, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void convertLinearSRGBToD50XYZ(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'convertLinearSRGBToD50XYZ' accepts only floating-point inputs");
+
+		detail::compute_color_space_batch<T, Q, detail::color_scale<detail::color_linear_srgb_to_d50xyz>, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void convertD65XYZToLinearSRGB(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'convertD65XYZToLinearSRGB' accepts only floating-point inputs");
+
+		detail::compute_color_space_batch<T, Q, detail::color_scale<detail::color_d65xyz_to_linear_srgb>, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void convertD65XYZToD50XYZ(vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'convertD65XYZToD50XYZ' accepts only floating-point inputs");
+
+		detail::compute_color_space_batch<T, Q, detail::color_scale<detail::color_d65xyz_to_d50xyz>, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, out, count, 0);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "color_space_batch_simd.inl"
+#endif
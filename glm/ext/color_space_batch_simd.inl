@@ -0,0 +1,141 @@
+/// @ref ext_color_space_batch
+
+#include "../simd/color.h"
+#include "../simd/matrix.h"
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// The components of the colors are converted as one array of floats, 4 at a time. With 4 component colors,
+	// the alpha is the last lane of each register and is restored after the conversion.
+	template<length_t L, qualifier Q>
+	struct compute_srgb_batch<L, float, Q, true>
+	{
+		template<bool Encode>
+		GLM_FUNC_QUALIFIER static void transfer(vec<L, float, Q> const* in, vec<L, float, Q>* out, std::size_t count, float Exponent)
+		{
+			float const* Src = reinterpret_cast<float const*>(in);
+			float* Dst = reinterpret_cast<float*>(out);
+			std::size_t const Total = count * L;
+			std::size_t const simd = Total - Total % 4;
+
+			glm_f32vec4 const Power = _mm_set1_ps(Exponent);
+			glm_f32vec4 const Alpha = L == 4 ? _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0)) : _mm_setzero_ps();
+			for(std::size_t j = 0; j < simd; j += 4)
+			{
+				glm_f32vec4 const x = _mm_loadu_ps(Src + j);
+				glm_f32vec4 const y = Encode ? glm_vec4_linear_to_srgb(x, Power) : glm_vec4_srgb_to_linear(x, Power);
+				_mm_storeu_ps(Dst + j, glm_vec4_select(Alpha, x, y));
+			}
+
+			// The last components, only with fewer than 4 component colors
+			if(simd < Total)
+			{
+				float Tail[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+				std::memcpy(Tail, Src + simd, (Total - simd) * sizeof(float));
+				glm_f32vec4 const x = _mm_loadu_ps(Tail);
+				_mm_storeu_ps(Tail, Encode ? glm_vec4_linear_to_srgb(x, Power) : glm_vec4_srgb_to_linear(x, Power));
+				std::memcpy(Dst + simd, Tail, (Total - simd) * sizeof(float));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void encode(vec<L, float, Q> const* in, vec<L, float, Q>* out, std::size_t count, float Exponent, std::size_t first)
+		{
+			if(sizeof(vec<L, float, Q>) != sizeof(float) * L)
+				compute_srgb_batch<L, float, Q, false>::encode(in, out, count, Exponent, first);
+			else
+				transfer<true>(in + first, out + first, count - first, Exponent);
+		}
+
+		GLM_FUNC_QUALIFIER static void decode(vec<L, float, Q> const* in, vec<L, float, Q>* out, std::size_t count, float Gamma, std::size_t first)
+		{
+			if(sizeof(vec<L, float, Q>) != sizeof(float) * L)
+				compute_srgb_batch<L, float, Q, false>::decode(in, out, count, Gamma, first);
+			else
+				transfer<false>(in + first, out + first, count - first, Gamma);
+		}
+	};
+
+	// Kernel converting 4 colors stored as r, g and b lanes
+	template<typename transform>
+	struct color_soa_kernel
+	{};
+
+	template<>
+	struct color_soa_kernel<color_rgb2YCoCg>
+	{
+		GLM_FUNC_QUALIFIER static void call4(glm_f32vec4 const in[3], glm_f32vec4 out[3])
+		{
+			glm_color_soa4_rgb2YCoCg(in, out);
+		}
+	};
+
+	template<>
+	struct color_soa_kernel<color_YCoCg2rgb>
+	{
+		GLM_FUNC_QUALIFIER static void call4(glm_f32vec4 const in[3], glm_f32vec4 out[3])
+		{
+			glm_color_soa4_YCoCg2rgb(in, out);
+		}
+	};
+
+	template<>
+	struct color_soa_kernel<color_rgb2YCoCgR>
+	{
+		GLM_FUNC_QUALIFIER static void call4(glm_f32vec4 const in[3], glm_f32vec4 out[3])
+		{
+			glm_color_soa4_rgb2YCoCgR(in, out);
+		}
+	};
+
+	template<>
+	struct color_soa_kernel<color_YCoCgR2rgb>
+	{
+		GLM_FUNC_QUALIFIER static void call4(glm_f32vec4 const in[3], glm_f32vec4 out[3])
+		{
+			glm_color_soa4_YCoCgR2rgb(in, out);
+		}
+	};
+
+	template<typename coefficients>
+	struct color_soa_kernel<color_scale<coefficients> >
+	{
+		GLM_FUNC_QUALIFIER static void call4(glm_f32vec4 const in[3], glm_f32vec4 out[3])
+		{
+			glm_color_soa4_scale(in, coefficients::M(), coefficients::N(), coefficients::O(), out);
+			if(coefficients::Scale() != 1.0f)
+				for(int c = 0; c < 3; ++c)
+					out[c] = _mm_mul_ps(out[c], _mm_set1_ps(coefficients::Scale()));
+		}
+	};
+
+	// Packed vec3 colors are deinterleaved 4 at a time
+	template<qualifier Q, typename transform>
+	struct compute_color_space_batch<float, Q, transform, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<3, float, Q> const* in, vec<3, float, Q>* out, std::size_t count, std::size_t first)
+		{
+			if(sizeof(vec<3, float, Q>) != sizeof(float) * 3)
+			{
+				compute_color_space_batch<float, Q, transform, false>::call(in, out, count, first);
+				return;
+			}
+
+			std::size_t const size = count - first;
+			std::size_t const simd = first + size - size % 4;
+			for(std::size_t i = first; i < simd; i += 4)
+			{
+				glm_f32vec4 Src[3];
+				glm_f32vec4 Dst[3];
+				glm_vec3x4_load(reinterpret_cast<float const*>(in + i), Src);
+				color_soa_kernel<transform>::call4(Src, Dst);
+				glm_vec3x4_store(Dst, reinterpret_cast<float*>(out + i));
+			}
+			compute_color_space_batch<float, Q, transform, false>::call(in, out, count, simd);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
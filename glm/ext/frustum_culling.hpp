@@ -0,0 +1,114 @@
+/// @ref ext_frustum_culling
+/// @file glm/ext/frustum_culling.hpp
+///
+/// @defgroup ext_frustum_culling GLM_EXT_frustum_culling
+/// @ingroup ext
+///
+/// Defines functions extracting the planes of the view frustum of a projection or view-projection matrix,
+/// and testing spheres and axis aligned boxes against them, one at a time or as structure of arrays
+/// written to a visibility bitmask.
+///
+/// A plane is a vec4 (n, d) with n of unit length, a point p being on its inner side when dot(n, p) + d >= 0.
+/// Planes are stored in the order left, right, bottom, top, near, far.
+///
+/// The planes are extracted in clip space, so they don't depend on the handedness of the projection.
+/// The near plane depends on the depth range of the clip space: extractFrustumPlanes uses the depth range
+/// of the matrices of ext_matrix_clip_space, zero to one when GLM_FORCE_DEPTH_ZERO_TO_ONE is defined,
+/// and extractFrustumPlanesZO and extractFrustumPlanesNO select it explicitly.
+///
+/// The tests are conservative: a volume is reported visible unless it is entirely on the outer side of one of the planes.
+///
+/// Internally, float spheres or boxes are processed 4 or 8 at a time using SSE2 or AVX when available.
+/// The kernels follow the operations of the single tests in the same order, so the results are the same
+/// as long as the compiler doesn't contract multiply and add into FMA instructions.
+///
+/// Include <glm/ext/frustum_culling.hpp> to use the features of this extension.
+///
+/// @see ext_matrix_clip_space
+/// @see ext_vector_soa
+
+#pragma once
+
+// Dependencies
+#include "vector_soa.hpp"
+#include "../mat4x4.hpp"
+#include <cstddef>
+#include <cstdint>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_frustum_culling extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_frustum_culling
+	/// @{
+
+	/// Extracts the 6 normalized planes of the frustum of m, whose clip space depth ranges from 0 to 1 (Direct3D, Vulkan).
+	/// With a view-projection matrix the planes are in world space, with a projection matrix in view space.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void extractFrustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	/// Extracts the 6 normalized planes of the frustum of m, whose clip space depth ranges from -1 to 1 (OpenGL).
+	/// With a view-projection matrix the planes are in world space, with a projection matrix in view space.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void extractFrustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	/// Extracts the 6 normalized planes of the frustum of m with the default clip space depth range,
+	/// from 0 to 1 if GLM_FORCE_DEPTH_ZERO_TO_ONE is defined and from -1 to 1 otherwise.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void extractFrustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	/// Tests whether a sphere may be visible: it isn't on the outer side of any of the 6 planes by more than its radius.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectFrustumSphere(vec<4, T, Q> const planes[6], vec<3, T, Q> const& center, T radius);
+
+	/// Tests whether an axis aligned box may be visible: for each of the 6 planes, its corner the furthest along the normal is on the inner side.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectFrustumBox(vec<4, T, Q> const planes[6], vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax);
+
+	/// Tests the center.size() spheres of centers center[i] and radii radius[i] as intersectFrustumSphere.
+	/// Sphere i being visible sets the bit (i % 32) of mask[i / 32], the other bits of the (center.size() + 31) / 32 words of mask are cleared.
+	///
+	/// @return The number of visible spheres
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL std::size_t intersectFrustumSpheres(
+		vec<4, T, Q> const planes[6],
+		vec_soa_const_view<3, T, Q> const& center, T const* radius,
+		std::uint32_t* mask);
+
+	/// Tests the boxMin.size() boxes of corners boxMin[i] and boxMax[i] as intersectFrustumBox.
+	/// Box i being visible sets the bit (i % 32) of mask[i / 32], the other bits of the (boxMin.size() + 31) / 32 words of mask are cleared.
+	///
+	/// @return The number of visible boxes
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL std::size_t intersectFrustumBoxes(
+		vec<4, T, Q> const planes[6],
+		vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		std::uint32_t* mask);
+
+	/// @}
+}//namespace glm
+
+#include "frustum_culling.inl"
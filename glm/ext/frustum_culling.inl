@@ -0,0 +1,171 @@
+/// @ref ext_frustum_culling
+
+#include "../geometric.hpp"
+#include <cassert>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Rows of m combined as in Gribb and Hartmann, "Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix"
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void extract_frustum_planes(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6], bool zeroToOne)
+	{
+		vec<4, T, Q> const Row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+		vec<4, T, Q> const Row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+		vec<4, T, Q> const Row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+		vec<4, T, Q> const Row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+		planes[0] = Row3 + Row0;
+		planes[1] = Row3 - Row0;
+		planes[2] = Row3 + Row1;
+		planes[3] = Row3 - Row1;
+		planes[4] = zeroToOne ? Row2 : Row3 + Row2;
+		planes[5] = Row3 - Row2;
+
+		for(length_t i = 0; i < 6; ++i)
+		{
+			T const Length = length(vec<3, T, Q>(planes[i]));
+			if(Length > static_cast<T>(0))
+				planes[i] /= Length;
+		}
+	}
+
+	// Signed distance of p to the plane, evaluated in the order of the SIMD kernels
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T plane_distance(vec<4, T, Q> const& plane, T x, T y, T z)
+	{
+		return plane.x * x + plane.y * y + plane.z * z + plane.w;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool frustum_sphere(vec<4, T, Q> const planes[6], T x, T y, T z, T radius)
+	{
+		for(length_t i = 0; i < 6; ++i)
+			if(!(plane_distance(planes[i], x, y, z) >= -radius))
+				return false;
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool frustum_box(vec<4, T, Q> const planes[6], vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax)
+	{
+		for(length_t i = 0; i < 6; ++i)
+		{
+			T const x = planes[i].x > static_cast<T>(0) ? boxMax.x : boxMin.x;
+			T const y = planes[i].y > static_cast<T>(0) ? boxMax.y : boxMin.y;
+			T const z = planes[i].z > static_cast<T>(0) ? boxMax.z : boxMin.z;
+			if(!(plane_distance(planes[i], x, y, z) >= static_cast<T>(0)))
+				return false;
+		}
+		return true;
+	}
+
+	// Spheres and boxes from first to the end of the arrays are tested one at a time,
+	// SIMD specializations process the leading ones and call this for the remaining ones.
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_frustum_culling
+	{
+		GLM_FUNC_QUALIFIER static std::size_t spheres(
+			vec<4, T, Q> const planes[6],
+			vec_soa_const_view<3, T, Q> const& center, T const* radius,
+			std::uint32_t* mask, std::size_t first)
+		{
+			std::size_t Count = 0;
+			for(std::size_t i = first; i < center.size(); ++i)
+			{
+				if(!frustum_sphere(planes, center[0][i], center[1][i], center[2][i], radius[i]))
+					continue;
+				mask[i / 32] |= static_cast<std::uint32_t>(1) << (i % 32);
+				++Count;
+			}
+			return Count;
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t boxes(
+			vec<4, T, Q> const planes[6],
+			vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+			std::uint32_t* mask, std::size_t first)
+		{
+			std::size_t Count = 0;
+			for(std::size_t i = first; i < boxMin.size(); ++i)
+			{
+				if(!frustum_box(planes, boxMin.load(i), boxMax.load(i)))
+					continue;
+				mask[i / 32] |= static_cast<std::uint32_t>(1) << (i % 32);
+				++Count;
+			}
+			return Count;
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void extractFrustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'extractFrustumPlanesZO' accepts only floating-point inputs");
+		detail::extract_frustum_planes(m, planes, true);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void extractFrustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'extractFrustumPlanesNO' accepts only floating-point inputs");
+		detail::extract_frustum_planes(m, planes, false);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void extractFrustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+#		if GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT
+			extractFrustumPlanesZO(m, planes);
+#		else
+			extractFrustumPlanesNO(m, planes);
+#		endif
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectFrustumSphere(vec<4, T, Q> const planes[6], vec<3, T, Q> const& center, T radius)
+	{
+		return detail::frustum_sphere(planes, center.x, center.y, center.z, radius);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectFrustumBox(vec<4, T, Q> const planes[6], vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax)
+	{
+		return detail::frustum_box(planes, boxMin, boxMax);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t intersectFrustumSpheres(
+		vec<4, T, Q> const planes[6],
+		vec_soa_const_view<3, T, Q> const& center, T const* radius,
+		std::uint32_t* mask)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'intersectFrustumSpheres' accepts only floating-point inputs");
+
+		for(std::size_t i = 0, n = (center.size() + 31) / 32; i < n; ++i)
+			mask[i] = 0;
+
+		return detail::compute_frustum_culling<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::spheres(planes, center, radius, mask, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t intersectFrustumBoxes(
+		vec<4, T, Q> const planes[6],
+		vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		std::uint32_t* mask)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'intersectFrustumBoxes' accepts only floating-point inputs");
+		assert(boxMax.size() == boxMin.size());
+
+		for(std::size_t i = 0, n = (boxMin.size() + 31) / 32; i < n; ++i)
+			mask[i] = 0;
+
+		return detail::compute_frustum_culling<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::boxes(planes, boxMin, boxMax, mask, 0);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "frustum_culling_simd.inl"
+#endif
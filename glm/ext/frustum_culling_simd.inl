@@ -0,0 +1,125 @@
+/// @ref ext_frustum_culling
+
+#include "../simd/frustum.h"
+#include "../integer.hpp"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_frustum_culling<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void split(vec<4, float, Q> const planes[6], float Planes[24], bool Positive[18])
+		{
+			for(length_t i = 0; i < 6; ++i)
+			{
+				for(length_t c = 0; c < 4; ++c)
+					Planes[i * 4 + c] = planes[i][c];
+				for(length_t c = 0; c < 3; ++c)
+					Positive[i * 3 + c] = planes[i][c] > 0.0f;
+			}
+		}
+
+		// Blocks of 4 and 8 volumes start at multiples of 4 and 8 so that their bits never straddle two words of the mask
+		GLM_FUNC_QUALIFIER static std::size_t spheres(
+			vec<4, float, Q> const planes[6],
+			vec_soa_const_view<3, float, Q> const& center, float const* radius,
+			std::uint32_t* mask, std::size_t first)
+		{
+			assert(first % 8 == 0);
+
+			float Planes[24];
+			bool Positive[18];
+			split(planes, Planes, Positive);
+
+			std::size_t const count = center.size() - first;
+			std::size_t const simd = first + count - count % 4;
+			std::size_t Count = 0;
+
+			std::size_t i = first;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_f32vec8 p[24];
+				for(int k = 0; k < 24; ++k)
+					p[k] = _mm256_set1_ps(Planes[k]);
+				for(; i + 8 <= simd; i += 8)
+				{
+					glm_f32vec8 const Center[3] = {_mm256_loadu_ps(center[0] + i), _mm256_loadu_ps(center[1] + i), _mm256_loadu_ps(center[2] + i)};
+					int const Mask = _mm256_movemask_ps(glm_frustum_sphere_soa8(p, Center, _mm256_loadu_ps(radius + i)));
+					mask[i / 32] |= static_cast<std::uint32_t>(Mask) << (i % 32);
+					Count += static_cast<std::size_t>(bitCount(Mask));
+				}
+			}
+#			endif
+			glm_f32vec4 p[24];
+			for(int k = 0; k < 24; ++k)
+				p[k] = _mm_set1_ps(Planes[k]);
+			for(; i < simd; i += 4)
+			{
+				glm_f32vec4 const Center[3] = {_mm_loadu_ps(center[0] + i), _mm_loadu_ps(center[1] + i), _mm_loadu_ps(center[2] + i)};
+				int const Mask = _mm_movemask_ps(glm_frustum_sphere_soa4(p, Center, _mm_loadu_ps(radius + i)));
+				mask[i / 32] |= static_cast<std::uint32_t>(Mask) << (i % 32);
+				Count += static_cast<std::size_t>(bitCount(Mask));
+			}
+
+			return Count + compute_frustum_culling<float, Q, false>::spheres(planes, center, radius, mask, simd);
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t boxes(
+			vec<4, float, Q> const planes[6],
+			vec_soa_const_view<3, float, Q> const& boxMin, vec_soa_const_view<3, float, Q> const& boxMax,
+			std::uint32_t* mask, std::size_t first)
+		{
+			assert(first % 8 == 0);
+
+			float Planes[24];
+			bool Positive[18];
+			split(planes, Planes, Positive);
+
+			std::size_t const count = boxMin.size() - first;
+			std::size_t const simd = first + count - count % 4;
+			std::size_t Count = 0;
+
+			std::size_t i = first;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_f32vec8 p[24];
+				for(int k = 0; k < 24; ++k)
+					p[k] = _mm256_set1_ps(Planes[k]);
+				for(; i + 8 <= simd; i += 8)
+				{
+					glm_f32vec8 BoxMin[3], BoxMax[3];
+					for(length_t c = 0; c < 3; ++c)
+					{
+						BoxMin[c] = _mm256_loadu_ps(boxMin[c] + i);
+						BoxMax[c] = _mm256_loadu_ps(boxMax[c] + i);
+					}
+					int const Mask = _mm256_movemask_ps(glm_frustum_box_soa8(p, Positive, BoxMin, BoxMax));
+					mask[i / 32] |= static_cast<std::uint32_t>(Mask) << (i % 32);
+					Count += static_cast<std::size_t>(bitCount(Mask));
+				}
+			}
+#			endif
+			glm_f32vec4 p[24];
+			for(int k = 0; k < 24; ++k)
+				p[k] = _mm_set1_ps(Planes[k]);
+			for(; i < simd; i += 4)
+			{
+				glm_f32vec4 BoxMin[3], BoxMax[3];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					BoxMin[c] = _mm_loadu_ps(boxMin[c] + i);
+					BoxMax[c] = _mm_loadu_ps(boxMax[c] + i);
+				}
+				int const Mask = _mm_movemask_ps(glm_frustum_box_soa4(p, Positive, BoxMin, BoxMax));
+				mask[i / 32] |= static_cast<std::uint32_t>(Mask) << (i % 32);
+				Count += static_cast<std::size_t>(bitCount(Mask));
+			}
+
+			return Count + compute_frustum_culling<float, Q, false>::boxes(planes, boxMin, boxMax, mask, simd);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,84 @@
+/// @ref ext_intersect_batch
+/// @file glm/ext/intersect_batch.hpp
+///
+/// @defgroup ext_intersect_batch GLM_EXT_intersect_batch
+/// @ingroup ext
+///
+/// Defines functions testing the intersection of one ray with many triangles, eg for picking or baking,
+/// and of many rays with one triangle, eg to trace a packet of coherent rays. Rays and triangles are stored
+/// as structure of arrays.
+///
+/// The test of a ray and a triangle is the Möller-Trumbore algorithm of intersectRayTriangle of gtx_intersect,
+/// a triangle is hit when intersectRayTriangle returns true with the same barycentric coordinates and distance.
+/// Only the hits at a distance of at least zero, in front of the ray origin, are reported.
+///
+/// Internally, float rays or triangles are processed 4, 8 or 16 at a time using SSE2, AVX or AVX-512 when available,
+/// or 4 at a time using NEON on ARMv8, one test per lane.
+/// The kernels follow the operations of intersectRayTriangle in the same order, so the results are the same
+/// as long as the compiler doesn't contract multiply and add into FMA instructions.
+///
+/// Include <glm/ext/intersect_batch.hpp> to use the features of this extension.
+///
+/// @see gtx_intersect
+/// @see ext_vector_soa
+
+#pragma once
+
+// Dependencies
+#include "vector_soa.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_intersect_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_intersect_batch
+	/// @{
+
+	/// Finds the nearest triangle hit by a ray among vert0.size() triangles, triangle i having the vertices vert0[i], vert1[i] and vert2[i].
+	/// When several triangles are hit at the nearest distance, the one with the lowest index is returned.
+	///
+	/// @param orig Origin of the ray
+	/// @param dir Direction of the ray, distances are expressed in multiples of its length
+	/// @param baryPosition Barycentric coordinates of the hit in the nearest triangle, as computed by intersectRayTriangle
+	/// @param distance Distance of the nearest hit
+	/// @param index Index of the nearest triangle
+	/// @return true if a triangle is hit in front of the origin, false otherwise and the outputs are left unchanged
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayTriangles(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec_soa_const_view<3, T, Q> const& vert0, vec_soa_const_view<3, T, Q> const& vert1, vec_soa_const_view<3, T, Q> const& vert2,
+		vec<2, T, Q>& baryPosition, T& distance, std::size_t& index);
+
+	/// Tests orig.size() rays against one triangle, keeping the nearest hit of each ray.
+	/// Calling it for each triangle of a mesh, with distance initialized to the maximum distance of the rays,
+	/// eg std::numeric_limits<T>::infinity(), finds the nearest triangle hit by each ray.
+	///
+	/// Ray i is updated when it hits the triangle at a distance of at least zero and less than distance[i]:
+	/// distance[i], baryPosition[i] and index[i] then receive the distance of the hit, its barycentric coordinates and triangle.
+	///
+	/// @param orig Origins of the rays
+	/// @param dir Directions of the rays
+	/// @param triangle Index of the triangle written to index
+	/// @param baryPosition Barycentric coordinates of the nearest hit of each ray
+	/// @param distance Distance of the nearest hit of each ray, read then updated
+	/// @param index Triangle of the nearest hit of each ray
+	/// @return The number of rays updated
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL std::size_t intersectRaysTriangle(
+		vec_soa_const_view<3, T, Q> const& orig, vec_soa_const_view<3, T, Q> const& dir,
+		vec<3, T, Q> const& vert0, vec<3, T, Q> const& vert1, vec<3, T, Q> const& vert2, std::size_t triangle,
+		vec_soa_view<2, T, Q> baryPosition, T* distance, std::size_t* index);
+
+	/// @}
+}//namespace glm
+
+#include "intersect_batch.inl"
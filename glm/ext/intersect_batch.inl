@@ -0,0 +1,156 @@
+/// @ref ext_intersect_batch
+
+#include <cassert>
+
+namespace glm{
+namespace detail
+{
+	// Operations of intersectRayTriangle of gtx_intersect
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersect_ray_triangle(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec<3, T, Q> const& vert0, vec<3, T, Q> const& vert1, vec<3, T, Q> const& vert2,
+		vec<2, T, Q>& baryPosition, T& distance)
+	{
+		vec<3, T, Q> const edge1 = vert1 - vert0;
+		vec<3, T, Q> const edge2 = vert2 - vert0;
+		vec<3, T, Q> const p = glm::cross(dir, edge2);
+		T const det = glm::dot(edge1, p);
+
+		vec<3, T, Q> const dist = orig - vert0;
+		vec<2, T, Q> Bary(glm::dot(dist, p), static_cast<T>(0));
+		vec<3, T, Q> Perpendicular(0);
+
+		if(det > static_cast<T>(0))
+		{
+			if(Bary.x < static_cast<T>(0) || Bary.x > det)
+				return false;
+
+			Perpendicular = glm::cross(dist, edge1);
+			Bary.y = glm::dot(dir, Perpendicular);
+			if((Bary.y < static_cast<T>(0)) || ((Bary.x + Bary.y) > det))
+				return false;
+		}
+		else if(det < static_cast<T>(0))
+		{
+			if((Bary.x > static_cast<T>(0)) || (Bary.x < det))
+				return false;
+
+			Perpendicular = glm::cross(dist, edge1);
+			Bary.y = glm::dot(dir, Perpendicular);
+			if((Bary.y > static_cast<T>(0)) || (Bary.x + Bary.y < det))
+				return false;
+		}
+		else
+			return false;
+
+		T const inv_det = static_cast<T>(1) / det;
+
+		distance = glm::dot(edge2, Perpendicular) * inv_det;
+		baryPosition = Bary * inv_det;
+
+		return true;
+	}
+
+	// Nearest hit found so far by intersectRayTriangles
+	template<typename T, qualifier Q>
+	struct intersect_nearest
+	{
+		vec<2, T, Q> Bary;
+		T Distance;
+		std::size_t Index;
+		bool Hit;
+	};
+
+	// Triangles and rays from first to the end of the views are tested one at a time,
+	// SIMD specializations process the leading ones and call this for the remaining ones.
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_intersect_batch
+	{
+		GLM_FUNC_QUALIFIER static void triangles(
+			vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+			vec_soa_const_view<3, T, Q> const& vert0, vec_soa_const_view<3, T, Q> const& vert1, vec_soa_const_view<3, T, Q> const& vert2,
+			intersect_nearest<T, Q>& Nearest, std::size_t first)
+		{
+			for(std::size_t i = first; i < vert0.size(); ++i)
+			{
+				vec<2, T, Q> Bary;
+				T Distance;
+				if(!intersect_ray_triangle(orig, dir, vert0.load(i), vert1.load(i), vert2.load(i), Bary, Distance))
+					continue;
+				if(!(Distance >= static_cast<T>(0)) || (Nearest.Hit && !(Distance < Nearest.Distance)))
+					continue;
+
+				Nearest.Bary = Bary;
+				Nearest.Distance = Distance;
+				Nearest.Index = i;
+				Nearest.Hit = true;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t rays(
+			vec_soa_const_view<3, T, Q> const& orig, vec_soa_const_view<3, T, Q> const& dir,
+			vec<3, T, Q> const& vert0, vec<3, T, Q> const& vert1, vec<3, T, Q> const& vert2, std::size_t triangle,
+			vec_soa_view<2, T, Q>& baryPosition, T* distance, std::size_t* index, std::size_t first)
+		{
+			std::size_t Updated = 0;
+			for(std::size_t i = first; i < orig.size(); ++i)
+			{
+				vec<2, T, Q> Bary;
+				T Distance;
+				if(!intersect_ray_triangle(orig.load(i), dir.load(i), vert0, vert1, vert2, Bary, Distance))
+					continue;
+				if(!(Distance >= static_cast<T>(0) && Distance < distance[i]))
+					continue;
+
+				baryPosition.store(i, Bary);
+				distance[i] = Distance;
+				index[i] = triangle;
+				++Updated;
+			}
+			return Updated;
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayTriangles(
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec_soa_const_view<3, T, Q> const& vert0, vec_soa_const_view<3, T, Q> const& vert1, vec_soa_const_view<3, T, Q> const& vert2,
+		vec<2, T, Q>& baryPosition, T& distance, std::size_t& index)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'intersectRayTriangles' accepts only floating-point inputs");
+		assert(vert1.size() == vert0.size() && vert2.size() == vert0.size());
+
+		detail::intersect_nearest<T, Q> Nearest;
+		Nearest.Bary = vec<2, T, Q>(0);
+		Nearest.Distance = static_cast<T>(0);
+		Nearest.Index = 0;
+		Nearest.Hit = false;
+
+		detail::compute_intersect_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::triangles(orig, dir, vert0, vert1, vert2, Nearest, 0);
+		if(!Nearest.Hit)
+			return false;
+
+		baryPosition = Nearest.Bary;
+		distance = Nearest.Distance;
+		index = Nearest.Index;
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t intersectRaysTriangle(
+		vec_soa_const_view<3, T, Q> const& orig, vec_soa_const_view<3, T, Q> const& dir,
+		vec<3, T, Q> const& vert0, vec<3, T, Q> const& vert1, vec<3, T, Q> const& vert2, std::size_t triangle,
+		vec_soa_view<2, T, Q> baryPosition, T* distance, std::size_t* index)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'intersectRaysTriangle' accepts only floating-point inputs");
+		assert(dir.size() == orig.size() && baryPosition.size() == orig.size());
+
+		return detail::compute_intersect_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::rays(orig, dir, vert0, vert1, vert2, triangle, baryPosition, distance, index, 0);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "intersect_batch_simd.inl"
+#endif
@@ -0,0 +1,350 @@
+/// @ref ext_intersect_batch
+
+#include "../simd/intersect.h"
+#include "../simd/trigonometric.h"
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// The nearest distance is kept as a scalar, the lanes of a block that may improve it are rare
+	// and scanned in index order so that ties keep the lowest index.
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void intersect_nearest_lanes(int Mask, float const* u, float const* v, float const* t, std::size_t i, intersect_nearest<float, Q>& Nearest)
+	{
+		for(int k = 0; Mask != 0; ++k, Mask >>= 1)
+		{
+			if(!(Mask & 1) || (Nearest.Hit && !(t[k] < Nearest.Distance)))
+				continue;
+
+			Nearest.Bary = vec<2, float, Q>(u[k], v[k]);
+			Nearest.Distance = t[k];
+			Nearest.Index = i + static_cast<std::size_t>(k);
+			Nearest.Hit = true;
+		}
+	}
+
+	// Writes triangle to the elements of index selected by Mask and returns their number
+	GLM_FUNC_QUALIFIER std::size_t intersect_store_index(int Mask, std::size_t triangle, std::size_t* index)
+	{
+		std::size_t Count = 0;
+		for(std::size_t k = 0; Mask != 0; ++k, Mask >>= 1)
+		{
+			if(!(Mask & 1))
+				continue;
+			index[k] = triangle;
+			++Count;
+		}
+		return Count;
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_intersect_batch<float, Q, true>
+	{
+
+		GLM_FUNC_QUALIFIER static void triangles(
+			vec<3, float, Q> const& orig, vec<3, float, Q> const& dir,
+			vec_soa_const_view<3, float, Q> const& vert0, vec_soa_const_view<3, float, Q> const& vert1, vec_soa_const_view<3, float, Q> const& vert2,
+			intersect_nearest<float, Q>& Nearest, std::size_t first)
+		{
+			std::size_t const count = vert0.size() - first;
+			std::size_t const simd = first + count - count % 4;
+			float const Infinity = std::numeric_limits<float>::infinity();
+
+			std::size_t i = first;
+#			if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			{
+				glm_f32vec16 const Orig[3] = {_mm512_set1_ps(orig.x), _mm512_set1_ps(orig.y), _mm512_set1_ps(orig.z)};
+				glm_f32vec16 const Dir[3] = {_mm512_set1_ps(dir.x), _mm512_set1_ps(dir.y), _mm512_set1_ps(dir.z)};
+				for(; i + 16 <= simd; i += 16)
+				{
+					glm_f32vec16 V0[3], V1[3], V2[3];
+					for(length_t c = 0; c < 3; ++c)
+					{
+						V0[c] = _mm512_loadu_ps(vert0[c] + i);
+						V1[c] = _mm512_loadu_ps(vert1[c] + i);
+						V2[c] = _mm512_loadu_ps(vert2[c] + i);
+					}
+
+					glm_f32vec16 u, v, t;
+					__mmask16 const Hit = glm_ray_triangle_soa16(Orig, Dir, V0, V1, V2, &u, &v, &t);
+					__mmask16 const Nearer = static_cast<__mmask16>(
+						_mm512_cmp_ps_mask(t, _mm512_setzero_ps(), _CMP_GE_OQ) &
+						_mm512_cmp_ps_mask(t, _mm512_set1_ps(Nearest.Hit ? Nearest.Distance : Infinity), _CMP_LE_OQ));
+					int const Mask = Hit & Nearer;
+					if(Mask == 0)
+						continue;
+
+					float U[16], V[16], Dist[16];
+					_mm512_storeu_ps(U, u);
+					_mm512_storeu_ps(V, v);
+					_mm512_storeu_ps(Dist, t);
+					intersect_nearest_lanes(Mask, U, V, Dist, i, Nearest);
+				}
+			}
+#			endif
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_f32vec8 const Orig[3] = {_mm256_set1_ps(orig.x), _mm256_set1_ps(orig.y), _mm256_set1_ps(orig.z)};
+				glm_f32vec8 const Dir[3] = {_mm256_set1_ps(dir.x), _mm256_set1_ps(dir.y), _mm256_set1_ps(dir.z)};
+				for(; i + 8 <= simd; i += 8)
+				{
+					glm_f32vec8 V0[3], V1[3], V2[3];
+					for(length_t c = 0; c < 3; ++c)
+					{
+						V0[c] = _mm256_loadu_ps(vert0[c] + i);
+						V1[c] = _mm256_loadu_ps(vert1[c] + i);
+						V2[c] = _mm256_loadu_ps(vert2[c] + i);
+					}
+
+					glm_f32vec8 u, v, t;
+					glm_f32vec8 const Hit = glm_ray_triangle_soa8(Orig, Dir, V0, V1, V2, &u, &v, &t);
+					glm_f32vec8 const Nearer = _mm256_and_ps(
+						_mm256_cmp_ps(t, _mm256_setzero_ps(), _CMP_GE_OQ),
+						_mm256_cmp_ps(t, _mm256_set1_ps(Nearest.Hit ? Nearest.Distance : Infinity), _CMP_LE_OQ));
+					int const Mask = _mm256_movemask_ps(_mm256_and_ps(Hit, Nearer));
+					if(Mask == 0)
+						continue;
+
+					float U[8], V[8], Dist[8];
+					_mm256_storeu_ps(U, u);
+					_mm256_storeu_ps(V, v);
+					_mm256_storeu_ps(Dist, t);
+					intersect_nearest_lanes(Mask, U, V, Dist, i, Nearest);
+				}
+			}
+#			endif
+
+			glm_f32vec4 const Orig[3] = {_mm_set1_ps(orig.x), _mm_set1_ps(orig.y), _mm_set1_ps(orig.z)};
+			glm_f32vec4 const Dir[3] = {_mm_set1_ps(dir.x), _mm_set1_ps(dir.y), _mm_set1_ps(dir.z)};
+			for(; i < simd; i += 4)
+			{
+				glm_f32vec4 V0[3], V1[3], V2[3];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					V0[c] = _mm_loadu_ps(vert0[c] + i);
+					V1[c] = _mm_loadu_ps(vert1[c] + i);
+					V2[c] = _mm_loadu_ps(vert2[c] + i);
+				}
+
+				glm_f32vec4 u, v, t;
+				glm_f32vec4 const Hit = glm_ray_triangle_soa4(Orig, Dir, V0, V1, V2, &u, &v, &t);
+				glm_f32vec4 const Nearer = _mm_and_ps(
+					_mm_cmpge_ps(t, _mm_setzero_ps()),
+					_mm_cmple_ps(t, _mm_set1_ps(Nearest.Hit ? Nearest.Distance : Infinity)));
+				int const Mask = _mm_movemask_ps(_mm_and_ps(Hit, Nearer));
+				if(Mask == 0)
+					continue;
+
+				float U[4], V[4], Dist[4];
+				_mm_storeu_ps(U, u);
+				_mm_storeu_ps(V, v);
+				_mm_storeu_ps(Dist, t);
+				intersect_nearest_lanes(Mask, U, V, Dist, i, Nearest);
+			}
+
+			compute_intersect_batch<float, Q, false>::triangles(orig, dir, vert0, vert1, vert2, Nearest, simd);
+		}
+
+		// Stores the lanes of Mask of x to out
+		GLM_FUNC_QUALIFIER static void store_lanes(glm_f32vec4 Mask, glm_f32vec4 x, float* out)
+		{
+			_mm_storeu_ps(out, glm_vec4_select(Mask, x, _mm_loadu_ps(out)));
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t rays(
+			vec_soa_const_view<3, float, Q> const& orig, vec_soa_const_view<3, float, Q> const& dir,
+			vec<3, float, Q> const& vert0, vec<3, float, Q> const& vert1, vec<3, float, Q> const& vert2, std::size_t triangle,
+			vec_soa_view<2, float, Q>& baryPosition, float* distance, std::size_t* index, std::size_t first)
+		{
+			std::size_t const count = orig.size() - first;
+			std::size_t const simd = first + count - count % 4;
+
+			std::size_t Updated = 0;
+			std::size_t i = first;
+#			if GLM_ARCH & GLM_ARCH_AVX512_BIT
+			{
+				glm_f32vec16 const V0[3] = {_mm512_set1_ps(vert0.x), _mm512_set1_ps(vert0.y), _mm512_set1_ps(vert0.z)};
+				glm_f32vec16 const V1[3] = {_mm512_set1_ps(vert1.x), _mm512_set1_ps(vert1.y), _mm512_set1_ps(vert1.z)};
+				glm_f32vec16 const V2[3] = {_mm512_set1_ps(vert2.x), _mm512_set1_ps(vert2.y), _mm512_set1_ps(vert2.z)};
+				for(; i + 16 <= simd; i += 16)
+				{
+					glm_f32vec16 Orig[3], Dir[3];
+					for(length_t c = 0; c < 3; ++c)
+					{
+						Orig[c] = _mm512_loadu_ps(orig[c] + i);
+						Dir[c] = _mm512_loadu_ps(dir[c] + i);
+					}
+
+					glm_f32vec16 u, v, t;
+					__mmask16 const Hit = glm_ray_triangle_soa16(Orig, Dir, V0, V1, V2, &u, &v, &t);
+					__mmask16 const Update = static_cast<__mmask16>(Hit &
+						_mm512_cmp_ps_mask(t, _mm512_setzero_ps(), _CMP_GE_OQ) &
+						_mm512_cmp_ps_mask(t, _mm512_loadu_ps(distance + i), _CMP_LT_OQ));
+					if(Update == 0)
+						continue;
+
+					// Masked stores leave the other lanes untouched
+					_mm512_mask_storeu_ps(baryPosition[0] + i, Update, u);
+					_mm512_mask_storeu_ps(baryPosition[1] + i, Update, v);
+					_mm512_mask_storeu_ps(distance + i, Update, t);
+					Updated += intersect_store_index(Update, triangle, index + i);
+				}
+			}
+#			endif
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_f32vec8 const V0[3] = {_mm256_set1_ps(vert0.x), _mm256_set1_ps(vert0.y), _mm256_set1_ps(vert0.z)};
+				glm_f32vec8 const V1[3] = {_mm256_set1_ps(vert1.x), _mm256_set1_ps(vert1.y), _mm256_set1_ps(vert1.z)};
+				glm_f32vec8 const V2[3] = {_mm256_set1_ps(vert2.x), _mm256_set1_ps(vert2.y), _mm256_set1_ps(vert2.z)};
+				for(; i + 8 <= simd; i += 8)
+				{
+					glm_f32vec8 Orig[3], Dir[3];
+					for(length_t c = 0; c < 3; ++c)
+					{
+						Orig[c] = _mm256_loadu_ps(orig[c] + i);
+						Dir[c] = _mm256_loadu_ps(dir[c] + i);
+					}
+
+					glm_f32vec8 u, v, t;
+					glm_f32vec8 const Hit = glm_ray_triangle_soa8(Orig, Dir, V0, V1, V2, &u, &v, &t);
+					glm_f32vec8 const Update = _mm256_and_ps(Hit, _mm256_and_ps(
+						_mm256_cmp_ps(t, _mm256_setzero_ps(), _CMP_GE_OQ),
+						_mm256_cmp_ps(t, _mm256_loadu_ps(distance + i), _CMP_LT_OQ)));
+					int const Mask = _mm256_movemask_ps(Update);
+					if(Mask == 0)
+						continue;
+
+					_mm256_storeu_ps(baryPosition[0] + i, _mm256_blendv_ps(_mm256_loadu_ps(baryPosition[0] + i), u, Update));
+					_mm256_storeu_ps(baryPosition[1] + i, _mm256_blendv_ps(_mm256_loadu_ps(baryPosition[1] + i), v, Update));
+					_mm256_storeu_ps(distance + i, _mm256_blendv_ps(_mm256_loadu_ps(distance + i), t, Update));
+					Updated += intersect_store_index(Mask, triangle, index + i);
+				}
+			}
+#			endif
+
+			glm_f32vec4 const V0[3] = {_mm_set1_ps(vert0.x), _mm_set1_ps(vert0.y), _mm_set1_ps(vert0.z)};
+			glm_f32vec4 const V1[3] = {_mm_set1_ps(vert1.x), _mm_set1_ps(vert1.y), _mm_set1_ps(vert1.z)};
+			glm_f32vec4 const V2[3] = {_mm_set1_ps(vert2.x), _mm_set1_ps(vert2.y), _mm_set1_ps(vert2.z)};
+			for(; i < simd; i += 4)
+			{
+				glm_f32vec4 Orig[3], Dir[3];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					Orig[c] = _mm_loadu_ps(orig[c] + i);
+					Dir[c] = _mm_loadu_ps(dir[c] + i);
+				}
+
+				glm_f32vec4 u, v, t;
+				glm_f32vec4 const Hit = glm_ray_triangle_soa4(Orig, Dir, V0, V1, V2, &u, &v, &t);
+				glm_f32vec4 const Update = _mm_and_ps(Hit, _mm_and_ps(
+					_mm_cmpge_ps(t, _mm_setzero_ps()),
+					_mm_cmplt_ps(t, _mm_loadu_ps(distance + i))));
+				int const Mask = _mm_movemask_ps(Update);
+				if(Mask == 0)
+					continue;
+
+				store_lanes(Update, u, baryPosition[0] + i);
+				store_lanes(Update, v, baryPosition[1] + i);
+				store_lanes(Update, t, distance + i);
+				Updated += intersect_store_index(Mask, triangle, index + i);
+			}
+
+			return Updated + compute_intersect_batch<float, Q, false>::rays(orig, dir, vert0, vert1, vert2, triangle, baryPosition, distance, index, simd);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+	template<qualifier Q>
+	struct compute_intersect_batch<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void triangles(
+			vec<3, float, Q> const& orig, vec<3, float, Q> const& dir,
+			vec_soa_const_view<3, float, Q> const& vert0, vec_soa_const_view<3, float, Q> const& vert1, vec_soa_const_view<3, float, Q> const& vert2,
+			intersect_nearest<float, Q>& Nearest, std::size_t first)
+		{
+			std::size_t const count = vert0.size() - first;
+			std::size_t const simd = first + count - count % 4;
+			float const Infinity = std::numeric_limits<float>::infinity();
+
+			glm_f32vec4 const Orig[3] = {vdupq_n_f32(orig.x), vdupq_n_f32(orig.y), vdupq_n_f32(orig.z)};
+			glm_f32vec4 const Dir[3] = {vdupq_n_f32(dir.x), vdupq_n_f32(dir.y), vdupq_n_f32(dir.z)};
+			for(std::size_t i = first; i < simd; i += 4)
+			{
+				glm_f32vec4 V0[3], V1[3], V2[3];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					V0[c] = vld1q_f32(vert0[c] + i);
+					V1[c] = vld1q_f32(vert1[c] + i);
+					V2[c] = vld1q_f32(vert2[c] + i);
+				}
+
+				glm_f32vec4 u, v, t;
+				glm_u32vec4 const Hit = glm_ray_triangle_soa4(Orig, Dir, V0, V1, V2, &u, &v, &t);
+				glm_u32vec4 const Nearer = vandq_u32(
+					vcgeq_f32(t, vdupq_n_f32(0.0f)),
+					vcleq_f32(t, vdupq_n_f32(Nearest.Hit ? Nearest.Distance : Infinity)));
+				int const Mask = glm_u32vec4_movemask(vandq_u32(Hit, Nearer));
+				if(Mask == 0)
+					continue;
+
+				float U[4], V[4], Dist[4];
+				vst1q_f32(U, u);
+				vst1q_f32(V, v);
+				vst1q_f32(Dist, t);
+				intersect_nearest_lanes(Mask, U, V, Dist, i, Nearest);
+			}
+
+			compute_intersect_batch<float, Q, false>::triangles(orig, dir, vert0, vert1, vert2, Nearest, simd);
+		}
+
+		// Stores the lanes of Mask of x to out
+		GLM_FUNC_QUALIFIER static void store_lanes(glm_u32vec4 Mask, glm_f32vec4 x, float* out)
+		{
+			vst1q_f32(out, vbslq_f32(Mask, x, vld1q_f32(out)));
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t rays(
+			vec_soa_const_view<3, float, Q> const& orig, vec_soa_const_view<3, float, Q> const& dir,
+			vec<3, float, Q> const& vert0, vec<3, float, Q> const& vert1, vec<3, float, Q> const& vert2, std::size_t triangle,
+			vec_soa_view<2, float, Q>& baryPosition, float* distance, std::size_t* index, std::size_t first)
+		{
+			std::size_t const count = orig.size() - first;
+			std::size_t const simd = first + count - count % 4;
+
+			std::size_t Updated = 0;
+			glm_f32vec4 const V0[3] = {vdupq_n_f32(vert0.x), vdupq_n_f32(vert0.y), vdupq_n_f32(vert0.z)};
+			glm_f32vec4 const V1[3] = {vdupq_n_f32(vert1.x), vdupq_n_f32(vert1.y), vdupq_n_f32(vert1.z)};
+			glm_f32vec4 const V2[3] = {vdupq_n_f32(vert2.x), vdupq_n_f32(vert2.y), vdupq_n_f32(vert2.z)};
+			for(std::size_t i = first; i < simd; i += 4)
+			{
+				glm_f32vec4 Orig[3], Dir[3];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					Orig[c] = vld1q_f32(orig[c] + i);
+					Dir[c] = vld1q_f32(dir[c] + i);
+				}
+
+				glm_f32vec4 u, v, t;
+				glm_u32vec4 const Hit = glm_ray_triangle_soa4(Orig, Dir, V0, V1, V2, &u, &v, &t);
+				glm_u32vec4 const Update = vandq_u32(Hit, vandq_u32(
+					vcgeq_f32(t, vdupq_n_f32(0.0f)),
+					vcltq_f32(t, vld1q_f32(distance + i))));
+				int const Mask = glm_u32vec4_movemask(Update);
+				if(Mask == 0)
+					continue;
+
+				store_lanes(Update, u, baryPosition[0] + i);
+				store_lanes(Update, v, baryPosition[1] + i);
+				store_lanes(Update, t, distance + i);
+				Updated += intersect_store_index(Mask, triangle, index + i);
+			}
+
+			return Updated + compute_intersect_batch<float, Q, false>::rays(orig, dir, vert0, vert1, vert2, triangle, baryPosition, distance, index, simd);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_ARMV8_BIT
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,95 @@
+/// @ref ext_matrix_affine
+/// @file glm/ext/matrix_affine.hpp
+///
+/// @defgroup ext_matrix_affine GLM_EXT_matrix_affine
+/// @ingroup ext
+///
+/// Defines functions to compose, invert and apply affine transforms stored in a mat3x4.
+///
+/// The mat3x4 holds the upper 3 rows of the equivalent mat4, one row per column: m[i] is row i,
+/// the translation is (m[0].w, m[1].w, m[2].w) and the (0, 0, 0, 1) last row is implicit.
+/// This is the layout of GLSL vec4(p, 1.0) * m expressions, it takes 48 bytes instead of 64 and
+/// the functions never compute the projective row: composing two transforms takes 36 multiplications
+/// and 27 additions instead of 64 and 48 for mat4. affineMultiply and affineInverse of float transforms use SSE kernels when available.
+///
+/// mat3x4(transpose(m)) converts an affine mat4 and transpose(mat4(a)) converts back, see affineFromMat4 and affineToMat4.
+/// multiply of GLM_EXT_matrix_batch composes arrays of transforms in this layout.
+///
+/// Include <glm/ext/matrix_affine.hpp> to use the features of this extension.
+///
+/// @see ext_matrix_transform
+/// @see ext_matrix_batch
+/// @see gtc_matrix_inverse
+
+#pragma once
+
+// Dependencies
+#include "../mat3x4.hpp"
+#include "../mat4x4.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_matrix_affine extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_matrix_affine
+	/// @{
+
+	/// Returns the affine transform stored in the upper 3 rows of m.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<3, 4, T, Q> affineFromMat4(mat<4, 4, T, Q> const& m);
+
+	/// Returns the mat4 of an affine transform, with a (0, 0, 0, 1) last row.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR mat<4, 4, T, Q> affineToMat4(mat<3, 4, T, Q> const& m);
+
+	/// Returns the affine transform that applies b then a, ie the upper 3 rows of affineToMat4(a) * affineToMat4(b).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> affineMultiply(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b);
+
+	/// Returns the inverse of an affine transform, computed from the cofactors of its 3x3 linear part.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> affineInverse(mat<3, 4, T, Q> const& m);
+
+	/// Transforms the point p, ie vec4(p, 1) * m.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR vec<3, T, Q> affineTransformPoint(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& p);
+
+	/// Transforms the direction v, ignoring the translation, ie vec4(v, 0) * m.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL GLM_CONSTEXPR vec<3, T, Q> affineTransformVector(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v);
+
+	/// Transforms the normal n by the inverse transpose of the linear part of m, the result is not normalized.
+	/// The cofactors are computed at each call, mat3(affineInverse(m)) is the same inverse transpose
+	/// to transform many normals.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> affineTransformNormal(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& n);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_affine.inl"
@@ -0,0 +1,123 @@
+/// @ref ext_matrix_affine
+
+#include "../geometric.hpp"
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_affine_multiply
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> call(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+		{
+			mat<3, 4, T, Q> Result;
+			for(length_t i = 0; i < 3; ++i)
+			{
+				Result[i] = b[0] * a[i].x + b[1] * a[i].y + b[2] * a[i].z;
+				Result[i].w += a[i].w;
+			}
+			return Result;
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_affine_inverse
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> call(mat<3, 4, T, Q> const& m)
+		{
+			vec<3, T, Q> const Row0(m[0]);
+			vec<3, T, Q> const Row1(m[1]);
+			vec<3, T, Q> const Row2(m[2]);
+
+			// The cofactors of the linear part are the columns of its inverse times the determinant
+			vec<3, T, Q> const Cof0(cross(Row1, Row2));
+			vec<3, T, Q> const Cof1(cross(Row2, Row0));
+			vec<3, T, Q> const Cof2(cross(Row0, Row1));
+			// Scalar negation, the vector one computes 0 - x which leaves +0 positive unlike the SIMD sign flip
+			vec<3, T, Q> const Sum(Cof0 * m[0].w + Cof1 * m[1].w + Cof2 * m[2].w);
+			vec<3, T, Q> const Translation(-Sum.x, -Sum.y, -Sum.z);
+
+			T const OneOverDeterminant = static_cast<T>(1) / dot(Row0, Cof0);
+
+			mat<3, 4, T, Q> Result;
+			for(length_t i = 0; i < 3; ++i)
+				Result[i] = vec<4, T, Q>(Cof0[i], Cof1[i], Cof2[i], Translation[i]) * OneOverDeterminant;
+			return Result;
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<3, 4, T, Q> affineFromMat4(mat<4, 4, T, Q> const& m)
+	{
+		return mat<3, 4, T, Q>(
+			vec<4, T, Q>(m[0][0], m[1][0], m[2][0], m[3][0]),
+			vec<4, T, Q>(m[0][1], m[1][1], m[2][1], m[3][1]),
+			vec<4, T, Q>(m[0][2], m[1][2], m[2][2], m[3][2]));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR mat<4, 4, T, Q> affineToMat4(mat<3, 4, T, Q> const& m)
+	{
+		return mat<4, 4, T, Q>(
+			vec<4, T, Q>(m[0][0], m[1][0], m[2][0], static_cast<T>(0)),
+			vec<4, T, Q>(m[0][1], m[1][1], m[2][1], static_cast<T>(0)),
+			vec<4, T, Q>(m[0][2], m[1][2], m[2][2], static_cast<T>(0)),
+			vec<4, T, Q>(m[0][3], m[1][3], m[2][3], static_cast<T>(1)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> affineMultiply(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'affineMultiply' only accept floating-point inputs");
+
+		return detail::compute_affine_multiply<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, b);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> affineInverse(mat<3, 4, T, Q> const& m)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'affineInverse' only accept floating-point inputs");
+
+		return detail::compute_affine_inverse<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(m);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, T, Q> affineTransformPoint(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& p)
+	{
+		return vec<3, T, Q>(
+			m[0].x * p.x + m[0].y * p.y + m[0].z * p.z + m[0].w,
+			m[1].x * p.x + m[1].y * p.y + m[1].z * p.z + m[1].w,
+			m[2].x * p.x + m[2].y * p.y + m[2].z * p.z + m[2].w);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER GLM_CONSTEXPR vec<3, T, Q> affineTransformVector(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		return vec<3, T, Q>(
+			m[0].x * v.x + m[0].y * v.y + m[0].z * v.z,
+			m[1].x * v.x + m[1].y * v.y + m[1].z * v.z,
+			m[2].x * v.x + m[2].y * v.y + m[2].z * v.z);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> affineTransformNormal(mat<3, 4, T, Q> const& m, vec<3, T, Q> const& n)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'affineTransformNormal' only accept floating-point inputs");
+
+		vec<3, T, Q> const Row0(m[0]);
+		vec<3, T, Q> const Row1(m[1]);
+		vec<3, T, Q> const Row2(m[2]);
+
+		// Rows of the inverse transpose times the determinant
+		vec<3, T, Q> const Cof0(cross(Row1, Row2));
+		vec<3, T, Q> const Cof1(cross(Row2, Row0));
+		vec<3, T, Q> const Cof2(cross(Row0, Row1));
+
+		return vec<3, T, Q>(dot(Cof0, n), dot(Cof1, n), dot(Cof2, n)) / dot(Row0, Cof0);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_affine_simd.inl"
+#endif
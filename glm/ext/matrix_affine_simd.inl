@@ -0,0 +1,44 @@
+/// @ref ext_matrix_affine
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_affine_multiply<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> call(mat<3, 4, float, Q> const& a, mat<3, 4, float, Q> const& b)
+		{
+			glm_vec4 R[3];
+			glm_mat3x4_affine_mul_packed(&a[0].x, &b[0].x, R);
+
+			mat<3, 4, float, Q> Result;
+			for(length_t i = 0; i < 3; ++i)
+				_mm_storeu_ps(&Result[i].x, R[i]);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_affine_inverse<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, float, Q> call(mat<3, 4, float, Q> const& m)
+		{
+			glm_vec4 M[3];
+			for(length_t i = 0; i < 3; ++i)
+				M[i] = _mm_loadu_ps(&m[i].x);
+
+			glm_vec4 R[3];
+			glm_mat3x4_affine_inverse(M, R);
+
+			mat<3, 4, float, Q> Result;
+			for(length_t i = 0; i < 3; ++i)
+				_mm_storeu_ps(&Result[i].x, R[i]);
+			return Result;
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,118 @@
+/// @ref ext_matrix_batch
+/// @file glm/ext/matrix_batch.hpp
+///
+/// @defgroup ext_matrix_batch GLM_EXT_matrix_batch
+/// @ingroup ext
+///
+/// Defines functions that apply a matrix to whole arrays of vectors and that multiply arrays of matrices.
+///
+/// Internally, vectors are processed as blocks of 4 or 8 lanes in a structure of arrays layout
+/// using SSE, AVX or NEON when available. The results are bitwise identical to the pure C++
+/// fallback and to operator*(mat4, vec4), as long as the compiler doesn't contract multiply
+/// and add into FMA instructions (eg -ffp-contract=fast).
+///
+/// With GLM_FORCE_SIMD_DISPATCH, the float kernels of transform are selected at runtime, see GLM_EXT_simd_dispatch.
+///
+/// multiply computes arrays of mat4 products or of affine transforms, optionally reading the left operands through
+/// an index array, eg to flatten a scene graph: world[i] = world[parent[i]] * local[i].
+/// Affine transforms use the mat3x4 layout of GLM_EXT_matrix_affine, the upper 3 rows of a mat4 stored one row per column,
+/// and each product is affineMultiply(a[i], b[i]).
+/// The float kernels prefetch the left operands ahead of use and write outputs larger than the caches
+/// with non-temporal stores.
+///
+/// Include <glm/ext/matrix_batch.hpp> to use the features of this extension.
+///
+/// @see ext_matrix_transform
+/// @see ext_matrix_affine
+/// @see ext_simd_dispatch
+
+#pragma once
+
+// Dependencies
+#include "../mat4x4.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include "matrix_affine.hpp"
+#include <cstddef>
+
+#if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+#	include "simd_dispatch.hpp"
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_matrix_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_matrix_batch
+	/// @{
+
+	/// Transforms count points by m, treating each input as vec4(in[i], 1) and dropping the w component of the result.
+	/// in and out may be the same array but must not partially overlap.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transform(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = m * in[i] for count vectors.
+	/// in and out may be the same array but must not partially overlap.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transform(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count);
+
+	/// Strided variant of transform for interleaved vertex buffers.
+	/// Element i is read at reinterpret_cast<char const*>(in) + i * inStride and written at reinterpret_cast<char*>(out) + i * outStride.
+	/// Elements only need the alignment of T.
+	///
+	/// @param inStride Distance in bytes between two consecutive input elements
+	/// @param outStride Distance in bytes between two consecutive output elements
+	///
+	/// @tparam L Integer between 3 and 4 included that qualify the dimension of the vector. With 3, inputs are treated as points.
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transform(mat<4, 4, T, Q> const& m, vec<L, T, Q> const* in, std::size_t inStride, vec<L, T, Q>* out, std::size_t outStride, std::size_t count);
+
+	/// Computes out[i] = a[i] * b[i] for count matrices.
+	/// out may be a or b but must not partially overlap them.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void multiply(mat<4, 4, T, Q> const* a, mat<4, 4, T, Q> const* b, mat<4, 4, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = a[indices[i]] * b[i] for count matrices.
+	/// Products are computed in increasing order of i and a[indices[i]] is read after out[i - 1] is written,
+	/// so a may alias out, eg to flatten a scene graph sorted so that parents come before their children.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	/// @tparam genIType Integer scalar types
+	template<typename T, qualifier Q, typename genIType>
+	GLM_FUNC_DISCARD_DECL void multiply(mat<4, 4, T, Q> const* a, genIType const* indices, mat<4, 4, T, Q> const* b, mat<4, 4, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = affineMultiply(a[i], b[i]) for count affine transforms stored as in GLM_EXT_matrix_affine.
+	/// out may be a or b but must not partially overlap them.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void multiply(mat<3, 4, T, Q> const* a, mat<3, 4, T, Q> const* b, mat<3, 4, T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = affineMultiply(a[indices[i]], b[i]) for count affine transforms stored as in GLM_EXT_matrix_affine.
+	/// Products are computed in increasing order of i and a[indices[i]] is read after out[i - 1] is written, so a may alias out.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	/// @tparam genIType Integer scalar types
+	template<typename T, qualifier Q, typename genIType>
+	GLM_FUNC_DISCARD_DECL void multiply(mat<3, 4, T, Q> const* a, genIType const* indices, mat<3, 4, T, Q> const* b, mat<3, 4, T, Q>* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_batch.inl"
@@ -0,0 +1,153 @@
+/// @ref ext_matrix_batch
+
+namespace glm{
+namespace detail
+{
+	template<length_t L, typename T, qualifier Q>
+	struct transform_element{};
+
+	template<typename T, qualifier Q>
+	struct transform_element<3, T, Q>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, T, Q> const& m, T const* s, T* d)
+		{
+			T const x = s[0];
+			T const y = s[1];
+			T const z = s[2];
+
+			// Same operation order as operator*(mat4, vec4) with w == 1
+			d[0] = (m[0][0] * x + m[1][0] * y) + (m[2][0] * z + m[3][0]);
+			d[1] = (m[0][1] * x + m[1][1] * y) + (m[2][1] * z + m[3][1]);
+			d[2] = (m[0][2] * x + m[1][2] * y) + (m[2][2] * z + m[3][2]);
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct transform_element<4, T, Q>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, T, Q> const& m, T const* s, T* d)
+		{
+			T const x = s[0];
+			T const y = s[1];
+			T const z = s[2];
+			T const w = s[3];
+
+			d[0] = (m[0][0] * x + m[1][0] * y) + (m[2][0] * z + m[3][0] * w);
+			d[1] = (m[0][1] * x + m[1][1] * y) + (m[2][1] * z + m[3][1] * w);
+			d[2] = (m[0][2] * x + m[1][2] * y) + (m[2][2] * z + m[3][2] * w);
+			d[3] = (m[0][3] * x + m[1][3] * y) + (m[2][3] * z + m[3][3] * w);
+		}
+	};
+
+	// Index array of the products without indices
+	struct multiply_batch_identity
+	{
+		GLM_FUNC_QUALIFIER std::size_t operator[](std::size_t i) const
+		{
+			return i;
+		}
+	};
+
+	template<length_t C, length_t R, typename T, qualifier Q>
+	struct multiply_element{};
+
+	template<typename T, qualifier Q>
+	struct multiply_element<4, 4, T, Q>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, T, Q> call(mat<4, 4, T, Q> const& a, mat<4, 4, T, Q> const& b)
+		{
+			return a * b;
+		}
+	};
+
+	template<typename T, qualifier Q>
+	struct multiply_element<3, 4, T, Q>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 4, T, Q> call(mat<3, 4, T, Q> const& a, mat<3, 4, T, Q> const& b)
+		{
+			return affineMultiply(a, b);
+		}
+	};
+
+	template<length_t C, length_t R, typename T, qualifier Q, bool UseSimd>
+	struct compute_multiply_batch
+	{
+		template<typename indexType>
+		GLM_FUNC_QUALIFIER static void call(mat<C, R, T, Q> const* a, indexType const& indices, mat<C, R, T, Q> const* b, mat<C, R, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = multiply_element<C, R, T, Q>::call(a[indices[i]], b[i]);
+		}
+	};
+
+	template<length_t L, typename T, qualifier Q, bool UseSimd>
+	struct compute_transform_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, T, Q> const& m, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			for(; count > 0; --count, in += inStride, out += outStride)
+				transform_element<L, T, Q>::call(m, reinterpret_cast<T const*>(in), reinterpret_cast<T*>(out));
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transform(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		transform<3, T, Q>(m, in, sizeof(vec<3, T, Q>), out, sizeof(vec<3, T, Q>), count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transform(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, vec<4, T, Q>* out, std::size_t count)
+	{
+		transform<4, T, Q>(m, in, sizeof(vec<4, T, Q>), out, sizeof(vec<4, T, Q>), count);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transform(mat<4, 4, T, Q> const& m, vec<L, T, Q> const* in, std::size_t inStride, vec<L, T, Q>* out, std::size_t outStride, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'transform' only accept floating-point inputs");
+		static_assert(L == 3 || L == 4, "'transform' only accept vec3 and vec4 inputs");
+
+		detail::compute_transform_batch<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(
+			m, reinterpret_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void multiply(mat<4, 4, T, Q> const* a, mat<4, 4, T, Q> const* b, mat<4, 4, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'multiply' only accept floating-point inputs");
+
+		detail::compute_multiply_batch<4, 4, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, detail::multiply_batch_identity(), b, out, count);
+	}
+
+	template<typename T, qualifier Q, typename genIType>
+	GLM_FUNC_QUALIFIER void multiply(mat<4, 4, T, Q> const* a, genIType const* indices, mat<4, 4, T, Q> const* b, mat<4, 4, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'multiply' only accept floating-point inputs");
+		static_assert(std::numeric_limits<genIType>::is_integer, "'multiply' only accept integer indices");
+
+		detail::compute_multiply_batch<4, 4, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, indices, b, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void multiply(mat<3, 4, T, Q> const* a, mat<3, 4, T, Q> const* b, mat<3, 4, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'multiply' only accept floating-point inputs");
+
+		detail::compute_multiply_batch<3, 4, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, detail::multiply_batch_identity(), b, out, count);
+	}
+
+	template<typename T, qualifier Q, typename genIType>
+	GLM_FUNC_QUALIFIER void multiply(mat<3, 4, T, Q> const* a, genIType const* indices, mat<3, 4, T, Q> const* b, mat<3, 4, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'multiply' only accept floating-point inputs");
+		static_assert(std::numeric_limits<genIType>::is_integer, "'multiply' only accept integer indices");
+
+		detail::compute_multiply_batch<3, 4, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, indices, b, out, count);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_batch_simd.inl"
+#endif
@@ -0,0 +1,257 @@
+/// @ref ext_matrix_batch
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transform_batch_elements(mat<4, 4, T, Q> const& m, T e[16])
+	{
+		for(length_t c = 0; c < 4; ++c)
+		for(length_t r = 0; r < 4; ++r)
+			e[c * 4 + r] = m[c][r];
+	}
+
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Non-temporal stores bypass the caches, they are used for outputs larger than the caches that the batch doesn't read back
+	template<typename matType>
+	GLM_FUNC_QUALIFIER bool multiply_batch_stream(matType const* a, matType const* b, matType const* out, std::size_t count)
+	{
+		std::size_t const CacheSize = static_cast<std::size_t>(8) << 20;
+		if(count * sizeof(matType) <= CacheSize || reinterpret_cast<std::size_t>(out) % 16 != 0)
+			return false;
+
+		bool const OverlapA = a < out + count && out < a + count;
+		bool const OverlapB = b < out + count && out < b + count;
+		return !OverlapA && !OverlapB;
+	}
+
+	// Requests the cache lines of a matrix that may start anywhere in a line
+	template<typename matType>
+	GLM_FUNC_QUALIFIER void multiply_batch_prefetch(matType const* m)
+	{
+		_mm_prefetch(reinterpret_cast<char const*>(m), _MM_HINT_T0);
+		_mm_prefetch(reinterpret_cast<char const*>(m + 1) - 1, _MM_HINT_T0);
+	}
+
+	// Number of products the left operands are prefetched ahead
+	GLM_FUNC_QUALIFIER std::size_t multiply_batch_prefetch_distance()
+	{
+		return 8;
+	}
+
+	template<qualifier Q>
+	struct compute_multiply_batch<4, 4, float, Q, true>
+	{
+		template<typename indexType>
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const* a, indexType const& indices, mat<4, 4, float, Q> const* b, mat<4, 4, float, Q>* out, std::size_t count)
+		{
+			bool const Stream = multiply_batch_stream(a, b, out, count);
+			std::size_t const Distance = multiply_batch_prefetch_distance();
+
+#			if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+				void (* const MulStore)(float const*, float const*, float*, bool) = simd_dispatch().mat4_mul_packed_store;
+#			endif
+
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				if(i + Distance < count)
+					multiply_batch_prefetch(a + indices[i + Distance]);
+
+				float const* const pa = &a[indices[i]][0][0];
+				float const* const pb = &b[i][0][0];
+				float* const po = &out[i][0][0];
+
+#				if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+					MulStore(pa, pb, po, Stream);
+#				elif GLM_ARCH & GLM_ARCH_AVX512_BIT
+					glm_mat4_mul_packed_store_avx512(pa, pb, po, Stream);
+#				elif GLM_ARCH & GLM_ARCH_AVX_BIT
+					glm_mat4_mul_packed_store_avx(pa, pb, po, Stream);
+#				else
+					glm_mat4_mul_packed_store(pa, pb, po, Stream);
+#				endif
+			}
+
+			if(Stream)
+				_mm_sfence();
+		}
+	};
+
+	// Same kernel as affineMultiply, the columns of mat3x4 are vec4 with or without alignment
+	template<qualifier Q>
+	struct compute_multiply_batch<3, 4, float, Q, true>
+	{
+		template<typename indexType>
+		GLM_FUNC_QUALIFIER static void call(mat<3, 4, float, Q> const* a, indexType const& indices, mat<3, 4, float, Q> const* b, mat<3, 4, float, Q>* out, std::size_t count)
+		{
+			bool const Stream = multiply_batch_stream(a, b, out, count);
+			std::size_t const Distance = multiply_batch_prefetch_distance();
+
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				if(i + Distance < count)
+					multiply_batch_prefetch(a + indices[i + Distance]);
+
+				glm_vec4 R[3];
+				glm_mat3x4_affine_mul_packed(&a[indices[i]][0][0], &b[i][0][0], R);
+				glm_vec4_store_n(R, 3, &out[i][0][0], Stream);
+			}
+
+			if(Stream)
+				_mm_sfence();
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_transform_batch<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const& m, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			float e[16];
+			transform_batch_elements(m, e);
+
+#			if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+				simd_dispatch().mat4_mul_point_array(e, in, inStride, out, outStride, count);
+#			elif GLM_ARCH & GLM_ARCH_AVX_BIT
+				glm_mat4_mul_point_array_avx(e, in, inStride, out, outStride, count);
+#			else
+				glm_mat4_mul_point_array(e, in, inStride, out, outStride, count);
+#			endif
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_transform_batch<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const& m, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			float e[16];
+			transform_batch_elements(m, e);
+
+#			if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+				simd_dispatch().mat4_mul_vec4_array(e, in, inStride, out, outStride, count);
+#			elif GLM_ARCH & GLM_ARCH_AVX512_BIT
+				glm_mat4_mul_vec4_array_avx512(e, in, inStride, out, outStride, count);
+#			elif GLM_ARCH & GLM_ARCH_AVX_BIT
+				glm_mat4_mul_vec4_array_avx(e, in, inStride, out, outStride, count);
+#			else
+				glm_mat4_mul_vec4_array(e, in, inStride, out, outStride, count);
+#			endif
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_transform_batch<3, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, double, Q> const& m, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			double e[16];
+			transform_batch_elements(m, e);
+
+			glm_dvec4 M[4];
+			for(length_t c = 0; c < 4; ++c)
+				M[c] = _mm256_loadu_pd(e + c * 4);
+
+			for(; count > 0; --count, in += inStride, out += outStride)
+			{
+				double const* const s = reinterpret_cast<double const*>(in);
+				double* const d = reinterpret_cast<double*>(out);
+
+				// Same operation order as glm_dmat4_mul_dvec4 with w == 1
+				glm_dvec4 const Add0 = _mm256_add_pd(_mm256_mul_pd(M[0], _mm256_broadcast_sd(s + 0)), _mm256_mul_pd(M[1], _mm256_broadcast_sd(s + 1)));
+				glm_dvec4 const Add1 = _mm256_add_pd(_mm256_mul_pd(M[2], _mm256_broadcast_sd(s + 2)), M[3]);
+				glm_dvec4 const R = _mm256_add_pd(Add0, Add1);
+				_mm_storeu_pd(d, _mm256_castpd256_pd128(R));
+				_mm_store_sd(d + 2, _mm256_extractf128_pd(R, 1));
+			}
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_transform_batch<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, double, Q> const& m, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			double e[16];
+			transform_batch_elements(m, e);
+
+			glm_dvec4 M[4];
+			for(length_t c = 0; c < 4; ++c)
+				M[c] = _mm256_loadu_pd(e + c * 4);
+
+			for(; count > 0; --count, in += inStride, out += outStride)
+			{
+				glm_dvec4 const V = _mm256_loadu_pd(reinterpret_cast<double const*>(in));
+				_mm256_storeu_pd(reinterpret_cast<double*>(out), glm_dmat4_mul_dvec4(M, V));
+			}
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#	if GLM_ARCH & GLM_ARCH_NEON_BIT
+	template<qualifier Q>
+	struct compute_transform_batch<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const& m, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			if(inStride == sizeof(float) * 3 && outStride == sizeof(float) * 3)
+			{
+				float32x4_t E[16];
+				for(length_t c = 0; c < 4; ++c)
+				for(length_t r = 0; r < 4; ++r)
+					E[c * 4 + r] = vdupq_n_f32(m[c][r]);
+
+				for(; count >= 4; count -= 4, in += inStride * 4, out += outStride * 4)
+				{
+					float32x4x3_t const V = vld3q_f32(reinterpret_cast<float const*>(in));
+					float32x4x3_t R;
+					for(length_t r = 0; r < 3; ++r)
+					{
+						float32x4_t const a0 = vaddq_f32(vmulq_f32(E[0 + r], V.val[0]), vmulq_f32(E[4 + r], V.val[1]));
+						float32x4_t const a1 = vaddq_f32(vmulq_f32(E[8 + r], V.val[2]), E[12 + r]);
+						R.val[r] = vaddq_f32(a0, a1);
+					}
+					vst3q_f32(reinterpret_cast<float*>(out), R);
+				}
+			}
+
+			for(; count > 0; --count, in += inStride, out += outStride)
+				transform_element<3, float, Q>::call(m, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out));
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_transform_batch<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const& m, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			if(inStride == sizeof(float) * 4 && outStride == sizeof(float) * 4)
+			{
+				float32x4_t E[16];
+				for(length_t c = 0; c < 4; ++c)
+				for(length_t r = 0; r < 4; ++r)
+					E[c * 4 + r] = vdupq_n_f32(m[c][r]);
+
+				for(; count >= 4; count -= 4, in += inStride * 4, out += outStride * 4)
+				{
+					float32x4x4_t const V = vld4q_f32(reinterpret_cast<float const*>(in));
+					float32x4x4_t R;
+					for(length_t r = 0; r < 4; ++r)
+					{
+						float32x4_t const a0 = vaddq_f32(vmulq_f32(E[0 + r], V.val[0]), vmulq_f32(E[4 + r], V.val[1]));
+						float32x4_t const a1 = vaddq_f32(vmulq_f32(E[8 + r], V.val[2]), vmulq_f32(E[12 + r], V.val[3]));
+						R.val[r] = vaddq_f32(a0, a1);
+					}
+					vst4q_f32(reinterpret_cast<float*>(out), R);
+				}
+			}
+
+			for(; count > 0; --count, in += inStride, out += outStride)
+				transform_element<4, float, Q>::call(m, reinterpret_cast<float const*>(in), reinterpret_cast<float*>(out));
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_NEON_BIT
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,82 @@
+/// @ref ext_noise_batch
+/// @file glm/ext/noise_batch.hpp
+///
+/// @defgroup ext_noise_batch GLM_EXT_noise_batch
+/// @ingroup ext
+///
+/// Defines functions evaluating the perlin and simplex noises of GLM_GTC_noise, and fractal sums
+/// of octaves of them, for whole arrays of points stored as structure of arrays.
+///
+/// Internally, float points are processed 4 or 8 at a time using SSE2 or AVX when available, one point per lane.
+/// The kernels follow the operations of the scalar functions in the same order, so the results are the same
+/// as long as the scalar functions don't use the aligned vec4 SIMD functions and the compiler doesn't contract
+/// multiply and add into FMA instructions (eg -ffp-contract=fast). Otherwise the differences stay below 1e-5
+/// for coordinates of magnitude up to a few thousands. Without SSE4.1, floor is emulated and only exact
+/// for coordinates of magnitude below 2^23.
+///
+/// Include <glm/ext/noise_batch.hpp> to use the features of this extension.
+///
+/// @see gtc_noise
+/// @see ext_vector_soa
+
+#pragma once
+
+// Dependencies
+#include "../gtc/noise.hpp"
+#include "vector_soa.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_noise_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_noise_batch
+	/// @{
+
+	/// Computes out[i] = perlin(p[i]), out holding p.size() elements.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the points
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlin(vec_soa_const_view<L, T, Q> const& p, T* out);
+
+	/// Computes out[i] = simplex(p[i]), out holding p.size() elements.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the points
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplex(vec_soa_const_view<L, T, Q> const& p, T* out);
+
+	/// Computes the fractional Brownian motion of the perlin noise at the points p, out holding p.size() elements.
+	/// out[i] is perlin(p[i]) plus, for octaves from 1 to octaves - 1, gain^octave * perlin(p[i] * lacunarity^octave),
+	/// where the powers are accumulated by multiplication. All the octaves of a block of points are summed in registers.
+	///
+	/// @param p Points at which the noise is evaluated
+	/// @param octaves Number of octaves, at least 1
+	/// @param lacunarity Frequency ratio between successive octaves, typically 2
+	/// @param gain Amplitude ratio between successive octaves, typically 0.5
+	/// @param out Array of p.size() sums
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the points
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void perlinFbm(vec_soa_const_view<L, T, Q> const& p, int octaves, T lacunarity, T gain, T* out);
+
+	/// Computes the fractional Brownian motion of the simplex noise at the points p, out holding p.size() elements.
+	/// Octaves are summed like with perlinFbm.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the points
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void simplexFbm(vec_soa_const_view<L, T, Q> const& p, int octaves, T lacunarity, T gain, T* out);
+
+	/// @}
+}//namespace glm
+
+#include "noise_batch.inl"
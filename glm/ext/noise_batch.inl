@@ -0,0 +1,88 @@
+/// @ref ext_noise_batch
+
+#include <cassert>
+
+namespace glm{
+namespace detail
+{
+	struct noise_perlin
+	{
+		template<length_t L, typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static T call(vec<L, T, Q> const& p)
+		{
+			return glm::perlin(p);
+		}
+	};
+
+	struct noise_simplex
+	{
+		template<length_t L, typename T, qualifier Q>
+		GLM_FUNC_QUALIFIER static T call(vec<L, T, Q> const& p)
+		{
+			return glm::simplex(p);
+		}
+	};
+
+	// Points from first to the end of the view are computed one at a time,
+	// SIMD specializations process the leading points and call this for the remaining ones.
+	template<length_t L, typename T, qualifier Q, typename noise, bool UseSimd>
+	struct compute_noise_batch
+	{
+		GLM_FUNC_QUALIFIER static void fbm(vec_soa_const_view<L, T, Q> const& p, int octaves, T lacunarity, T gain, T* out, std::size_t first)
+		{
+			for(std::size_t i = first; i < p.size(); ++i)
+			{
+				vec<L, T, Q> const Position = p.load(i);
+				T Sum = noise::call(Position);
+				T Frequency = static_cast<T>(1);
+				T Amplitude = static_cast<T>(1);
+				for(int o = 1; o < octaves; ++o)
+				{
+					Frequency *= lacunarity;
+					Amplitude *= gain;
+					Sum += Amplitude * noise::call(Position * Frequency);
+				}
+				out[i] = Sum;
+			}
+		}
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlin(vec_soa_const_view<L, T, Q> const& p, T* out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'perlin' accepts only floating-point inputs");
+
+		detail::compute_noise_batch<L, T, Q, detail::noise_perlin, GLM_CONFIG_SIMD == GLM_ENABLE>::fbm(p, 1, static_cast<T>(1), static_cast<T>(1), out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplex(vec_soa_const_view<L, T, Q> const& p, T* out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'simplex' accepts only floating-point inputs");
+
+		detail::compute_noise_batch<L, T, Q, detail::noise_simplex, GLM_CONFIG_SIMD == GLM_ENABLE>::fbm(p, 1, static_cast<T>(1), static_cast<T>(1), out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void perlinFbm(vec_soa_const_view<L, T, Q> const& p, int octaves, T lacunarity, T gain, T* out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'perlinFbm' accepts only floating-point inputs");
+		assert(octaves >= 1);
+
+		detail::compute_noise_batch<L, T, Q, detail::noise_perlin, GLM_CONFIG_SIMD == GLM_ENABLE>::fbm(p, octaves, lacunarity, gain, out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void simplexFbm(vec_soa_const_view<L, T, Q> const& p, int octaves, T lacunarity, T gain, T* out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'simplexFbm' accepts only floating-point inputs");
+		assert(octaves >= 1);
+
+		detail::compute_noise_batch<L, T, Q, detail::noise_simplex, GLM_CONFIG_SIMD == GLM_ENABLE>::fbm(p, octaves, lacunarity, gain, out, 0);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "noise_batch_simd.inl"
+#endif
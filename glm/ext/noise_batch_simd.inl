@@ -0,0 +1,178 @@
+/// @ref ext_noise_batch
+
+#include "../simd/noise.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Kernel evaluating the noise of 4 or 8 points, component c of the points in p[c]
+	template<length_t L, typename noise>
+	struct noise_soa_kernel
+	{};
+
+	template<>
+	struct noise_soa_kernel<2, noise_perlin>
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call4(glm_vec4 const p[2])
+		{
+			return glm_noise_soa4_perlin2(p);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_f32vec8 call8(glm_f32vec8 const p[2])
+		{
+			return glm_noise_soa8_perlin2(p);
+		}
+#		endif
+	};
+
+	template<>
+	struct noise_soa_kernel<3, noise_perlin>
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call4(glm_vec4 const p[3])
+		{
+			return glm_noise_soa4_perlin3(p);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_f32vec8 call8(glm_f32vec8 const p[3])
+		{
+			return glm_noise_soa8_perlin3(p);
+		}
+#		endif
+	};
+
+	template<>
+	struct noise_soa_kernel<4, noise_perlin>
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call4(glm_vec4 const p[4])
+		{
+			return glm_noise_soa4_perlin4(p);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_f32vec8 call8(glm_f32vec8 const p[4])
+		{
+			return glm_noise_soa8_perlin4(p);
+		}
+#		endif
+	};
+
+	template<>
+	struct noise_soa_kernel<2, noise_simplex>
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call4(glm_vec4 const p[2])
+		{
+			return glm_noise_soa4_simplex2(p);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_f32vec8 call8(glm_f32vec8 const p[2])
+		{
+			return glm_noise_soa8_simplex2(p);
+		}
+#		endif
+	};
+
+	template<>
+	struct noise_soa_kernel<3, noise_simplex>
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call4(glm_vec4 const p[3])
+		{
+			return glm_noise_soa4_simplex3(p);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_f32vec8 call8(glm_f32vec8 const p[3])
+		{
+			return glm_noise_soa8_simplex3(p);
+		}
+#		endif
+	};
+
+	template<>
+	struct noise_soa_kernel<4, noise_simplex>
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 call4(glm_vec4 const p[4])
+		{
+			return glm_noise_soa4_simplex4(p);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_f32vec8 call8(glm_f32vec8 const p[4])
+		{
+			return glm_noise_soa8_simplex4(p);
+		}
+#		endif
+	};
+
+	// The octaves of a block of points are summed in a register, the frequency and the amplitude
+	// being accumulated like in the scalar loop
+	template<length_t L, qualifier Q, typename noise>
+	struct compute_noise_batch<L, float, Q, noise, true>
+	{
+		typedef compute_noise_batch<L, float, Q, noise, false> scalar;
+		typedef noise_soa_kernel<L, noise> kernel;
+
+		GLM_FUNC_QUALIFIER static void fbm(vec_soa_const_view<L, float, Q> const& p, int octaves, float lacunarity, float gain, float* out, std::size_t first)
+		{
+			std::size_t const count = p.size() - first;
+			std::size_t const simd = first + count - count % 4;
+			std::size_t i = first;
+			float const* P[L];
+			for(length_t c = 0; c < L; ++c)
+				P[c] = p[c];
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				for(; i + 8 <= simd; i += 8)
+				{
+					glm_f32vec8 Position[L];
+					for(length_t c = 0; c < L; ++c)
+						Position[c] = _mm256_loadu_ps(P[c] + i);
+
+					glm_f32vec8 Sum = kernel::call8(Position);
+					float Frequency = 1.0f;
+					float Amplitude = 1.0f;
+					for(int o = 1; o < octaves; ++o)
+					{
+						Frequency *= lacunarity;
+						Amplitude *= gain;
+
+						glm_f32vec8 Octave[L];
+						for(length_t c = 0; c < L; ++c)
+							Octave[c] = _mm256_mul_ps(Position[c], _mm256_set1_ps(Frequency));
+						Sum = _mm256_add_ps(Sum, _mm256_mul_ps(_mm256_set1_ps(Amplitude), kernel::call8(Octave)));
+					}
+					_mm256_storeu_ps(out + i, Sum);
+				}
+#			endif
+
+			for(; i < simd; i += 4)
+			{
+				glm_vec4 Position[L];
+				for(length_t c = 0; c < L; ++c)
+					Position[c] = _mm_loadu_ps(P[c] + i);
+
+				glm_vec4 Sum = kernel::call4(Position);
+				float Frequency = 1.0f;
+				float Amplitude = 1.0f;
+				for(int o = 1; o < octaves; ++o)
+				{
+					Frequency *= lacunarity;
+					Amplitude *= gain;
+
+					glm_vec4 Octave[L];
+					for(length_t c = 0; c < L; ++c)
+						Octave[c] = _mm_mul_ps(Position[c], _mm_set1_ps(Frequency));
+					Sum = _mm_add_ps(Sum, _mm_mul_ps(_mm_set1_ps(Amplitude), kernel::call4(Octave)));
+				}
+				_mm_storeu_ps(out + i, Sum);
+			}
+
+			scalar::fbm(p, octaves, lacunarity, gain, out, simd);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
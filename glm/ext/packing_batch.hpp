@@ -0,0 +1,85 @@
+/// @ref ext_packing_batch
+/// @file glm/ext/packing_batch.hpp
+///
+/// @defgroup ext_packing_batch GLM_EXT_packing_batch
+/// @ingroup ext
+///
+/// Defines functions that convert whole vertex or pixel buffers between floating-point components
+/// and the packed formats of GLM_GTC_packing, eg to prepare GPU uploads.
+///
+/// Each element gives the same result as the matching single element function,
+/// eg packSnorm3x10_1x2 for packing_snorm3x10_1x2.
+/// Results of NaN inputs are undefined.
+///
+/// Internally, the fixed-point and half formats process blocks of 4 elements using SSE2 when available.
+/// The packed float formats convert one element at a time.
+///
+/// Include <glm/ext/packing_batch.hpp> to use the features of this extension.
+///
+/// @see gtc_packing
+/// @see ext_matrix_batch
+
+#pragma once
+
+// Dependencies
+#include "../packing.hpp"
+#include "../gtc/packing.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_packing_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_packing_batch
+	/// @{
+
+	/// Packed formats of packBatch and unpackBatch, each one named after its single element function.
+	enum packing_format
+	{
+		packing_unorm4x8,			///< packUnorm4x8, 4 components in 4 bytes
+		packing_snorm4x8,			///< packSnorm4x8, 4 components in 4 bytes
+		packing_unorm2x16,			///< packUnorm2x16, 2 components in 4 bytes
+		packing_snorm2x16,			///< packSnorm2x16, 2 components in 4 bytes
+		packing_unorm4x16,			///< packUnorm4x16, 4 components in 8 bytes
+		packing_snorm4x16,			///< packSnorm4x16, 4 components in 8 bytes
+		packing_half2x16,			///< packHalf2x16, 2 components in 4 bytes
+		packing_half4x16,			///< packHalf4x16, 4 components in 8 bytes
+		packing_unorm3x10_1x2,		///< packUnorm3x10_1x2, 4 components in 4 bytes
+		packing_snorm3x10_1x2,		///< packSnorm3x10_1x2, 4 components in 4 bytes
+		packing_unorm1x5_1x6_1x5,	///< packUnorm1x5_1x6_1x5, 3 components in 2 bytes
+		packing_f2x11_1x10,			///< packF2x11_1x10, 3 components in 4 bytes
+		packing_f3x9_e1x5			///< packF3x9_E1x5, 3 components in 4 bytes
+	};
+
+	/// Returns the number of floating-point components of an element of format.
+	GLM_FUNC_DECL length_t packingComponents(packing_format format);
+
+	/// Returns the size in bytes of a packed element of format.
+	GLM_FUNC_DECL std::size_t packingSize(packing_format format);
+
+	/// Packs count elements of packingComponents(format) floats to format.
+	/// Element i is read at reinterpret_cast<char const*>(in) + i * inStride and written at reinterpret_cast<char*>(out) + i * outStride.
+	/// Inputs only need the alignment of float and outputs need no alignment.
+	///
+	/// @param inStride Distance in bytes between two consecutive input elements, eg the vertex size of an interleaved buffer
+	/// @param outStride Distance in bytes between two consecutive output elements
+	///
+	/// @see unpackBatch
+	GLM_FUNC_DISCARD_DECL void packBatch(packing_format format, float const* in, std::size_t inStride, void* out, std::size_t outStride, std::size_t count);
+
+	/// Unpacks count elements of format to packingComponents(format) floats.
+	/// Element i is read at reinterpret_cast<char const*>(in) + i * inStride and written at reinterpret_cast<char*>(out) + i * outStride.
+	/// Inputs need no alignment and outputs only need the alignment of float.
+	///
+	/// @param inStride Distance in bytes between two consecutive input elements
+	/// @param outStride Distance in bytes between two consecutive output elements
+	///
+	/// @see packBatch
+	GLM_FUNC_DISCARD_DECL void unpackBatch(packing_format format, void const* in, std::size_t inStride, float* out, std::size_t outStride, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "packing_batch.inl"
@@ -0,0 +1,202 @@
+/// @ref ext_packing_batch
+
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+	template<typename packType>
+	GLM_FUNC_QUALIFIER void packing_batch_store(char* out, packType Packed)
+	{
+		memcpy(out, &Packed, sizeof(Packed));
+	}
+
+	template<typename packType>
+	GLM_FUNC_QUALIFIER packType packing_batch_load(char const* in)
+	{
+		packType Packed = 0;
+		memcpy(&Packed, in, sizeof(Packed));
+		return Packed;
+	}
+
+	GLM_FUNC_QUALIFIER void packing_batch_store(float* out, vec2 const& v)
+	{
+		out[0] = v.x;
+		out[1] = v.y;
+	}
+
+	GLM_FUNC_QUALIFIER void packing_batch_store(float* out, vec3 const& v)
+	{
+		out[0] = v.x;
+		out[1] = v.y;
+		out[2] = v.z;
+	}
+
+	GLM_FUNC_QUALIFIER void packing_batch_store(float* out, vec4 const& v)
+	{
+		out[0] = v.x;
+		out[1] = v.y;
+		out[2] = v.z;
+		out[3] = v.w;
+	}
+
+	// Packs a single element with the single element function of format
+	GLM_FUNC_QUALIFIER void pack_batch_element(packing_format format, float const* in, char* out)
+	{
+		switch(format)
+		{
+		case packing_unorm4x8:
+			packing_batch_store(out, packUnorm4x8(vec4(in[0], in[1], in[2], in[3])));
+			break;
+		case packing_snorm4x8:
+			packing_batch_store(out, packSnorm4x8(vec4(in[0], in[1], in[2], in[3])));
+			break;
+		case packing_unorm2x16:
+			packing_batch_store(out, packUnorm2x16(vec2(in[0], in[1])));
+			break;
+		case packing_snorm2x16:
+			packing_batch_store(out, packSnorm2x16(vec2(in[0], in[1])));
+			break;
+		case packing_unorm4x16:
+			packing_batch_store(out, packUnorm4x16(vec4(in[0], in[1], in[2], in[3])));
+			break;
+		case packing_snorm4x16:
+			packing_batch_store(out, packSnorm4x16(vec4(in[0], in[1], in[2], in[3])));
+			break;
+		case packing_half2x16:
+			packing_batch_store(out, packHalf2x16(vec2(in[0], in[1])));
+			break;
+		case packing_half4x16:
+			packing_batch_store(out, packHalf4x16(vec4(in[0], in[1], in[2], in[3])));
+			break;
+		case packing_unorm3x10_1x2:
+			packing_batch_store(out, packUnorm3x10_1x2(vec4(in[0], in[1], in[2], in[3])));
+			break;
+		case packing_snorm3x10_1x2:
+			packing_batch_store(out, packSnorm3x10_1x2(vec4(in[0], in[1], in[2], in[3])));
+			break;
+		case packing_unorm1x5_1x6_1x5:
+			packing_batch_store(out, packUnorm1x5_1x6_1x5(vec3(in[0], in[1], in[2])));
+			break;
+		case packing_f2x11_1x10:
+			packing_batch_store(out, packF2x11_1x10(vec3(in[0], in[1], in[2])));
+			break;
+		case packing_f3x9_e1x5:
+			packing_batch_store(out, packF3x9_E1x5(vec3(in[0], in[1], in[2])));
+			break;
+		}
+	}
+
+	// Unpacks a single element with the single element function of format
+	GLM_FUNC_QUALIFIER void unpack_batch_element(packing_format format, char const* in, float* out)
+	{
+		switch(format)
+		{
+		case packing_unorm4x8:
+			packing_batch_store(out, unpackUnorm4x8(packing_batch_load<uint>(in)));
+			break;
+		case packing_snorm4x8:
+			packing_batch_store(out, unpackSnorm4x8(packing_batch_load<uint>(in)));
+			break;
+		case packing_unorm2x16:
+			packing_batch_store(out, unpackUnorm2x16(packing_batch_load<uint>(in)));
+			break;
+		case packing_snorm2x16:
+			packing_batch_store(out, unpackSnorm2x16(packing_batch_load<uint>(in)));
+			break;
+		case packing_unorm4x16:
+			packing_batch_store(out, unpackUnorm4x16(packing_batch_load<uint64>(in)));
+			break;
+		case packing_snorm4x16:
+			packing_batch_store(out, unpackSnorm4x16(packing_batch_load<uint64>(in)));
+			break;
+		case packing_half2x16:
+			packing_batch_store(out, unpackHalf2x16(packing_batch_load<uint>(in)));
+			break;
+		case packing_half4x16:
+			packing_batch_store(out, unpackHalf4x16(packing_batch_load<uint64>(in)));
+			break;
+		case packing_unorm3x10_1x2:
+			packing_batch_store(out, unpackUnorm3x10_1x2(packing_batch_load<uint32>(in)));
+			break;
+		case packing_snorm3x10_1x2:
+			packing_batch_store(out, unpackSnorm3x10_1x2(packing_batch_load<uint32>(in)));
+			break;
+		case packing_unorm1x5_1x6_1x5:
+			packing_batch_store(out, unpackUnorm1x5_1x6_1x5(packing_batch_load<uint16>(in)));
+			break;
+		case packing_f2x11_1x10:
+			packing_batch_store(out, unpackF2x11_1x10(packing_batch_load<uint32>(in)));
+			break;
+		case packing_f3x9_e1x5:
+			packing_batch_store(out, unpackF3x9_E1x5(packing_batch_load<uint32>(in)));
+			break;
+		}
+	}
+
+	template<bool UseSimd>
+	struct compute_packing_batch
+	{
+		GLM_FUNC_QUALIFIER static void pack(packing_format format, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				pack_batch_element(format, reinterpret_cast<float const*>(in + i * inStride), out + i * outStride);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(packing_format format, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				unpack_batch_element(format, in + i * inStride, reinterpret_cast<float*>(out + i * outStride));
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "packing_batch_simd.inl"
+#endif
+
+namespace glm
+{
+	GLM_FUNC_QUALIFIER length_t packingComponents(packing_format format)
+	{
+		switch(format)
+		{
+		case packing_unorm2x16:
+		case packing_snorm2x16:
+		case packing_half2x16:
+			return 2;
+		case packing_unorm1x5_1x6_1x5:
+		case packing_f2x11_1x10:
+		case packing_f3x9_e1x5:
+			return 3;
+		default:
+			return 4;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER std::size_t packingSize(packing_format format)
+	{
+		switch(format)
+		{
+		case packing_unorm1x5_1x6_1x5:
+			return 2;
+		case packing_unorm4x16:
+		case packing_snorm4x16:
+		case packing_half4x16:
+			return 8;
+		default:
+			return 4;
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void packBatch(packing_format format, float const* in, std::size_t inStride, void* out, std::size_t outStride, std::size_t count)
+	{
+		detail::compute_packing_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::pack(format, reinterpret_cast<char const*>(in), inStride, static_cast<char*>(out), outStride, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackBatch(packing_format format, void const* in, std::size_t inStride, float* out, std::size_t outStride, std::size_t count)
+	{
+		detail::compute_packing_batch<GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(format, static_cast<char const*>(in), inStride, reinterpret_cast<char*>(out), outStride, count);
+	}
+}//namespace glm
@@ -0,0 +1,395 @@
+/// @ref ext_packing_batch
+
+#include "../simd/packing.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	enum packing_batch_kind
+	{
+		packing_batch_unorm,
+		packing_batch_snorm,
+		packing_batch_half
+	};
+
+	// Bit fields of the fixed-point and half formats, components with an offset of 32 or more are in the high word of 8 bytes formats
+	struct packing_batch_layout
+	{
+		packing_batch_kind Kind;
+		int Bits[4];
+		int Offset[4];
+		float PackScale[4];
+		float UnpackScale[4];
+	};
+
+	GLM_FUNC_QUALIFIER packing_batch_layout make_packing_batch_layout(packing_batch_kind Kind, int Bits, float PackScale, float UnpackScale)
+	{
+		packing_batch_layout Layout;
+		Layout.Kind = Kind;
+		for(int c = 0; c < 4; ++c)
+		{
+			Layout.Bits[c] = Bits;
+			Layout.Offset[c] = c * Bits;
+			Layout.PackScale[c] = PackScale;
+			Layout.UnpackScale[c] = UnpackScale;
+		}
+		return Layout;
+	}
+
+	// The unpack scales are the constants of the single element functions
+	GLM_FUNC_QUALIFIER packing_batch_layout make_packing_batch_layout(packing_format format)
+	{
+		switch(format)
+		{
+		case packing_unorm4x8:
+			return make_packing_batch_layout(packing_batch_unorm, 8, 255.0f, 0.0039215686274509803921568627451f);
+		case packing_snorm4x8:
+			return make_packing_batch_layout(packing_batch_snorm, 8, 127.0f, 0.0078740157480315f);
+		case packing_unorm2x16:
+			return make_packing_batch_layout(packing_batch_unorm, 16, 65535.0f, 1.5259021896696421759365224689097e-5f);
+		case packing_snorm2x16:
+			return make_packing_batch_layout(packing_batch_snorm, 16, 32767.0f, 3.0518509475997192297128208258309e-5f);
+		case packing_unorm4x16:
+			return make_packing_batch_layout(packing_batch_unorm, 16, 65535.0f, 1.5259021896696421759365224689097e-5f);
+		case packing_snorm4x16:
+			return make_packing_batch_layout(packing_batch_snorm, 16, 32767.0f, 3.0518509475997192297128208258309e-5f);
+		case packing_half2x16:
+			return make_packing_batch_layout(packing_batch_half, 16, 1.0f, 1.0f);
+		case packing_half4x16:
+			return make_packing_batch_layout(packing_batch_half, 16, 1.0f, 1.0f);
+		case packing_unorm3x10_1x2:
+		{
+			packing_batch_layout Layout = make_packing_batch_layout(packing_batch_unorm, 10, 1023.0f, 1.0f / 1023.f);
+			Layout.Bits[3] = 2;
+			Layout.PackScale[3] = 3.0f;
+			Layout.UnpackScale[3] = 1.0f / 3.f;
+			return Layout;
+		}
+		case packing_snorm3x10_1x2:
+		{
+			packing_batch_layout Layout = make_packing_batch_layout(packing_batch_snorm, 10, 511.0f, 1.f / 511.f);
+			Layout.Bits[3] = 2;
+			Layout.PackScale[3] = 1.0f;
+			Layout.UnpackScale[3] = 1.0f;
+			return Layout;
+		}
+		case packing_unorm1x5_1x6_1x5:
+		{
+			packing_batch_layout Layout = make_packing_batch_layout(packing_batch_unorm, 5, 31.0f, 1.f / 31.f);
+			Layout.Bits[1] = 6;
+			Layout.Offset[2] = 11;
+			Layout.PackScale[1] = 63.0f;
+			Layout.UnpackScale[1] = 1.f / 63.f;
+			return Layout;
+		}
+		default: // The packed float formats have no SIMD kernel
+			return make_packing_batch_layout(packing_batch_unorm, 0, 1.0f, 1.0f);
+		}
+	}
+
+	// Loads the components of an element, the other lanes are zero
+	GLM_FUNC_QUALIFIER glm_vec4 packing_batch_load(float const* in, length_t Components)
+	{
+		switch(Components)
+		{
+		case 2:
+			return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const*>(in));
+		case 3:
+			return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const*>(in)), _mm_load_ss(in + 2));
+		default:
+			return _mm_loadu_ps(in);
+		}
+	}
+
+	GLM_FUNC_QUALIFIER void packing_batch_store(float* out, glm_vec4 v, length_t Components)
+	{
+		switch(Components)
+		{
+		case 2:
+			_mm_storel_pi(reinterpret_cast<__m64*>(out), v);
+			break;
+		case 3:
+			_mm_storel_pi(reinterpret_cast<__m64*>(out), v);
+			_mm_store_ss(out + 2, _mm_movehl_ps(v, v));
+			break;
+		default:
+			_mm_storeu_ps(out, v);
+			break;
+		}
+	}
+
+	// Constants of the bit field of a component, computed once per call
+	struct packing_batch_field
+	{
+		glm_vec4 Scale;
+		glm_ivec4 Mask;
+		glm_ivec4 Shift;
+		glm_ivec4 Unshift;
+		bool High;
+	};
+
+	GLM_FUNC_QUALIFIER packing_batch_field make_packing_batch_field(packing_batch_layout const& Layout, bool Pack, length_t c)
+	{
+		int const Shift = Layout.Offset[c] & 31;
+		int const Bits = Layout.Bits[c];
+
+		packing_batch_field Field;
+		Field.Scale = _mm_set1_ps(Pack ? Layout.PackScale[c] : Layout.UnpackScale[c]);
+		Field.Mask = _mm_set1_epi32((1 << Bits) - 1);
+		Field.High = Layout.Offset[c] >= 32;
+
+		// Signed fields are unpacked by shifting them to the top bits then back with sign extension
+		bool const SignExtend = !Pack && Layout.Kind == packing_batch_snorm;
+		Field.Shift = _mm_cvtsi32_si128(SignExtend ? 32 - Shift - Bits : Shift);
+		Field.Unshift = _mm_cvtsi32_si128(32 - Bits);
+		return Field;
+	}
+
+	// Quantizes a component of 4 elements and ORs the bit field into the low or high word of the elements.
+	// Like round, fixed-point formats of aligned vec4 round halfway cases to even.
+	template<packing_batch_kind Kind, bool RoundEven>
+	GLM_FUNC_QUALIFIER void pack_batch_field(packing_batch_field const& Field, glm_vec4 v, glm_ivec4& Low, glm_ivec4& High)
+	{
+		glm_ivec4 Quantized;
+		if(Kind == packing_batch_half)
+			Quantized = glm_vec4_to_half(v);
+		else
+		{
+			glm_vec4 const Min = _mm_set1_ps(Kind == packing_batch_snorm ? -1.0f : 0.0f);
+			glm_vec4 const x = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v, Min), _mm_set1_ps(1.0f)), Field.Scale);
+
+			if(RoundEven)
+				Quantized = _mm_cvtps_epi32(x);
+			else
+			{
+				// Rounds the magnitude, halfway cases up, then restores the sign
+				glm_vec4 const a = _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+				glm_ivec4 const t = _mm_cvttps_epi32(a);
+				glm_ivec4 const Up = _mm_castps_si128(_mm_cmpge_ps(_mm_sub_ps(a, _mm_cvtepi32_ps(t)), _mm_set1_ps(0.5f)));
+				glm_ivec4 const r = _mm_sub_epi32(t, Up);
+				if(Kind == packing_batch_snorm)
+				{
+					glm_ivec4 const s = _mm_srai_epi32(_mm_castps_si128(x), 31);
+					Quantized = _mm_sub_epi32(_mm_xor_si128(r, s), s);
+				}
+				else
+					Quantized = r;
+			}
+		}
+
+		glm_ivec4 const Shifted = _mm_sll_epi32(_mm_and_si128(Quantized, Field.Mask), Field.Shift);
+		if(Field.High)
+			High = _mm_or_si128(High, Shifted);
+		else
+			Low = _mm_or_si128(Low, Shifted);
+	}
+
+	// Extracts a component of 4 elements from their low or high words
+	template<packing_batch_kind Kind>
+	GLM_FUNC_QUALIFIER glm_vec4 unpack_batch_field(packing_batch_field const& Field, glm_ivec4 Low, glm_ivec4 High)
+	{
+		glm_ivec4 const Word = Field.High ? High : Low;
+
+		if(Kind == packing_batch_snorm)
+		{
+			glm_ivec4 const Extended = _mm_sra_epi32(_mm_sll_epi32(Word, Field.Shift), Field.Unshift);
+			glm_vec4 const x = _mm_mul_ps(_mm_cvtepi32_ps(Extended), Field.Scale);
+			return _mm_min_ps(_mm_max_ps(x, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+		}
+
+		glm_ivec4 const Extracted = _mm_and_si128(_mm_srl_epi32(Word, Field.Shift), Field.Mask);
+		if(Kind == packing_batch_half)
+			return glm_half_to_vec4(Extracted);
+		return _mm_mul_ps(_mm_cvtepi32_ps(Extracted), Field.Scale);
+	}
+
+	// Writes the element in lane 0 of the low and high words
+	template<std::size_t Size>
+	GLM_FUNC_QUALIFIER void packing_batch_store(char* out, glm_ivec4 Low, glm_ivec4 High)
+	{
+		if(Size == 8)
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi32(Low, High));
+		else if(Size == 4)
+			packing_batch_store(out, static_cast<uint32>(_mm_cvtsi128_si32(Low)));
+		else
+			packing_batch_store(out, static_cast<uint16>(_mm_cvtsi128_si32(Low)));
+	}
+
+	// Reads the low and high words of an element into lane 0
+	template<std::size_t Size>
+	GLM_FUNC_QUALIFIER glm_ivec4 packing_batch_load(char const* in)
+	{
+		if(Size == 8)
+			return _mm_loadl_epi64(reinterpret_cast<__m128i const*>(in));
+		else if(Size == 4)
+			return _mm_cvtsi32_si128(static_cast<int>(packing_batch_load<uint32>(in)));
+		else
+			return _mm_cvtsi32_si128(static_cast<int>(packing_batch_load<uint16>(in)));
+	}
+
+	// Packs the blocks of 4 elements and returns the number of elements packed
+	template<packing_batch_kind Kind, length_t L, std::size_t Size>
+	GLM_FUNC_QUALIFIER std::size_t pack_batch_blocks(packing_batch_layout const& Layout, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+	{
+		static bool const RoundEven = L == 4 && is_aligned<defaultp>::value;
+
+		packing_batch_field const F0 = make_packing_batch_field(Layout, true, 0);
+		packing_batch_field const F1 = make_packing_batch_field(Layout, true, 1);
+		packing_batch_field const F2 = make_packing_batch_field(Layout, true, 2);
+		packing_batch_field const F3 = make_packing_batch_field(Layout, true, 3);
+
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			char const* const s = in + i * inStride;
+			glm_vec4 x = packing_batch_load(reinterpret_cast<float const*>(s), L);
+			glm_vec4 y = packing_batch_load(reinterpret_cast<float const*>(s + inStride), L);
+			glm_vec4 z = packing_batch_load(reinterpret_cast<float const*>(s + 2 * inStride), L);
+			glm_vec4 w = packing_batch_load(reinterpret_cast<float const*>(s + 3 * inStride), L);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			glm_ivec4 Low = _mm_setzero_si128();
+			glm_ivec4 High = _mm_setzero_si128();
+			pack_batch_field<Kind, RoundEven>(F0, x, Low, High);
+			pack_batch_field<Kind, RoundEven>(F1, y, Low, High);
+			if(L > 2)
+				pack_batch_field<Kind, RoundEven>(F2, z, Low, High);
+			if(L > 3)
+				pack_batch_field<Kind, RoundEven>(F3, w, Low, High);
+
+			char* const d = out + i * outStride;
+			packing_batch_store<Size>(d, Low, High);
+			packing_batch_store<Size>(d + outStride, _mm_shuffle_epi32(Low, _MM_SHUFFLE(3, 2, 1, 1)), _mm_shuffle_epi32(High, _MM_SHUFFLE(3, 2, 1, 1)));
+			packing_batch_store<Size>(d + 2 * outStride, _mm_shuffle_epi32(Low, _MM_SHUFFLE(3, 2, 1, 2)), _mm_shuffle_epi32(High, _MM_SHUFFLE(3, 2, 1, 2)));
+			packing_batch_store<Size>(d + 3 * outStride, _mm_shuffle_epi32(Low, _MM_SHUFFLE(3, 2, 1, 3)), _mm_shuffle_epi32(High, _MM_SHUFFLE(3, 2, 1, 3)));
+		}
+		return i;
+	}
+
+	// Unpacks the blocks of 4 elements and returns the number of elements unpacked
+	template<packing_batch_kind Kind, length_t L, std::size_t Size>
+	GLM_FUNC_QUALIFIER std::size_t unpack_batch_blocks(packing_batch_layout const& Layout, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+	{
+		packing_batch_field const F0 = make_packing_batch_field(Layout, false, 0);
+		packing_batch_field const F1 = make_packing_batch_field(Layout, false, 1);
+		packing_batch_field const F2 = make_packing_batch_field(Layout, false, 2);
+		packing_batch_field const F3 = make_packing_batch_field(Layout, false, 3);
+
+		std::size_t i = 0;
+		for(; i + 4 <= count; i += 4)
+		{
+			// Element words: e0 and e1 in a, e2 and e3 in b, low words in even lanes
+			char const* const s = in + i * inStride;
+			glm_ivec4 const a = _mm_unpacklo_epi64(packing_batch_load<Size>(s), packing_batch_load<Size>(s + inStride));
+			glm_ivec4 const b = _mm_unpacklo_epi64(packing_batch_load<Size>(s + 2 * inStride), packing_batch_load<Size>(s + 3 * inStride));
+			glm_ivec4 const Low = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+			glm_ivec4 const High = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(3, 1, 3, 1)));
+
+			glm_vec4 x = unpack_batch_field<Kind>(F0, Low, High);
+			glm_vec4 y = unpack_batch_field<Kind>(F1, Low, High);
+			glm_vec4 z = L > 2 ? unpack_batch_field<Kind>(F2, Low, High) : _mm_setzero_ps();
+			glm_vec4 w = L > 3 ? unpack_batch_field<Kind>(F3, Low, High) : _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			char* const d = out + i * outStride;
+			packing_batch_store(reinterpret_cast<float*>(d), x, L);
+			packing_batch_store(reinterpret_cast<float*>(d + outStride), y, L);
+			packing_batch_store(reinterpret_cast<float*>(d + 2 * outStride), z, L);
+			packing_batch_store(reinterpret_cast<float*>(d + 3 * outStride), w, L);
+		}
+		return i;
+	}
+
+	template<>
+	struct compute_packing_batch<true>
+	{
+		GLM_FUNC_QUALIFIER static void pack(packing_format format, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			packing_batch_layout const Layout = make_packing_batch_layout(format);
+
+			std::size_t i = 0;
+			switch(format)
+			{
+			case packing_unorm4x8:
+			case packing_unorm3x10_1x2:
+				i = pack_batch_blocks<packing_batch_unorm, 4, 4>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_snorm4x8:
+			case packing_snorm3x10_1x2:
+				i = pack_batch_blocks<packing_batch_snorm, 4, 4>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_unorm2x16:
+				i = pack_batch_blocks<packing_batch_unorm, 2, 4>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_snorm2x16:
+				i = pack_batch_blocks<packing_batch_snorm, 2, 4>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_unorm4x16:
+				i = pack_batch_blocks<packing_batch_unorm, 4, 8>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_snorm4x16:
+				i = pack_batch_blocks<packing_batch_snorm, 4, 8>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_half2x16:
+				i = pack_batch_blocks<packing_batch_half, 2, 4>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_half4x16:
+				i = pack_batch_blocks<packing_batch_half, 4, 8>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_unorm1x5_1x6_1x5:
+				i = pack_batch_blocks<packing_batch_unorm, 3, 2>(Layout, in, inStride, out, outStride, count);
+				break;
+			default:
+				break;
+			}
+
+			compute_packing_batch<false>::pack(format, in + i * inStride, inStride, out + i * outStride, outStride, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(packing_format format, char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+		{
+			packing_batch_layout const Layout = make_packing_batch_layout(format);
+
+			std::size_t i = 0;
+			switch(format)
+			{
+			case packing_unorm4x8:
+			case packing_unorm3x10_1x2:
+				i = unpack_batch_blocks<packing_batch_unorm, 4, 4>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_snorm4x8:
+			case packing_snorm3x10_1x2:
+				i = unpack_batch_blocks<packing_batch_snorm, 4, 4>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_unorm2x16:
+				i = unpack_batch_blocks<packing_batch_unorm, 2, 4>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_snorm2x16:
+				i = unpack_batch_blocks<packing_batch_snorm, 2, 4>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_unorm4x16:
+				i = unpack_batch_blocks<packing_batch_unorm, 4, 8>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_snorm4x16:
+				i = unpack_batch_blocks<packing_batch_snorm, 4, 8>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_half2x16:
+				i = unpack_batch_blocks<packing_batch_half, 2, 4>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_half4x16:
+				i = unpack_batch_blocks<packing_batch_half, 4, 8>(Layout, in, inStride, out, outStride, count);
+				break;
+			case packing_unorm1x5_1x6_1x5:
+				i = unpack_batch_blocks<packing_batch_unorm, 3, 2>(Layout, in, inStride, out, outStride, count);
+				break;
+			default:
+				break;
+			}
+
+			compute_packing_batch<false>::unpack(format, in + i * inStride, inStride, out + i * outStride, outStride, count - i);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
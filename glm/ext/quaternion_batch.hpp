@@ -0,0 +1,107 @@
+/// @ref ext_quaternion_batch
+/// @file glm/ext/quaternion_batch.hpp
+///
+/// @defgroup ext_quaternion_batch GLM_EXT_quaternion_batch
+/// @ingroup ext
+///
+/// Defines functions that interpolate, apply and convert whole arrays of quaternions.
+///
+/// Internally, float quaternions are transposed into a structure of arrays layout and processed
+/// as blocks of 4, 8 or 16 lanes using SSE2, AVX2 or AVX-512 when available; remaining elements
+/// and double quaternions use the scalar functions.
+///
+/// nlerp, transform, mat3_cast and mat4_cast give the same results as the scalar functions, as long
+/// as the compiler doesn't contract multiply and add into FMA instructions (eg -ffp-contract=fast).
+/// slerp uses polynomial approximations of acos and sin, its results are within a few ulps of the scalar slerp.
+///
+/// Include <glm/ext/quaternion_batch.hpp> to use the features of this extension.
+///
+/// @see ext_quaternion_common
+/// @see ext_matrix_batch
+
+#pragma once
+
+// Dependencies
+#include "../gtc/quaternion.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_quaternion_batch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_quaternion_batch
+	/// @{
+
+	/// Computes out[i] = slerp(x[i], y[i], a) for count quaternions, interpolating along the shortest path.
+	/// out may be the same array as x or y but must not partially overlap them.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	///
+	/// @see ext_quaternion_common slerp
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* out, std::size_t count);
+
+	/// Computes out[i] = slerp(x[i], y[i], a[i]) for count quaternions, interpolating along the shortest path.
+	/// out may be the same array as x or y but must not partially overlap them.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* out, std::size_t count);
+
+	/// Normalized linear interpolation along the shortest path: out[i] = normalize(x[i] * (1 - a) + y'[i] * a),
+	/// where y'[i] is y[i] or -y[i] whichever is closer to x[i]. A cheaper approximation of slerp.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void nlerp(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* out, std::size_t count);
+
+	/// Normalized linear interpolation along the shortest path with an interpolation factor per element.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void nlerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* out, std::size_t count);
+
+	/// Rotates count vectors by q: out[i] = q * in[i].
+	/// in and out may be the same array but must not partially overlap.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transform(qua<T, Q> const& q, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Rotates each vector by its own quaternion: out[i] = q[i] * in[i].
+	/// in and out may be the same array but must not partially overlap.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transform(qua<T, Q> const* q, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count);
+
+	/// Converts count quaternions to rotation matrices: out[i] = mat3_cast(q[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	///
+	/// @see gtc_quaternion mat3_cast
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mat3_cast(qua<T, Q> const* q, mat<3, 3, T, Q>* out, std::size_t count);
+
+	/// Converts count quaternions to rotation matrices: out[i] = mat4_cast(q[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	///
+	/// @see gtc_quaternion mat4_cast
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mat4_cast(qua<T, Q> const* q, mat<4, 4, T, Q>* out, std::size_t count);
+
+	/// @}
+}//namespace glm
+
+#include "quaternion_batch.inl"
@@ -0,0 +1,116 @@
+/// @ref ext_quaternion_batch
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER qua<T, Q> nlerp_element(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	{
+		qua<T, Q> const z = dot(x, y) < static_cast<T>(0) ? -y : y;
+		return normalize(x * (static_cast<T>(1) - a) + z * a);
+	}
+
+	// aStep and qStep are 0 to use the same interpolation factor or quaternion for all elements, 1 otherwise
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_quat_batch
+	{
+		GLM_FUNC_QUALIFIER static void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t aStep, qua<T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::slerp(x[i], y[i], a[i * aStep]);
+		}
+
+		GLM_FUNC_QUALIFIER static void nlerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t aStep, qua<T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = nlerp_element(x[i], y[i], a[i * aStep]);
+		}
+
+		GLM_FUNC_QUALIFIER static void rotate(qua<T, Q> const* q, std::size_t qStep, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = q[i * qStep] * in[i];
+		}
+
+		GLM_FUNC_QUALIFIER static void to_mat3(qua<T, Q> const* q, mat<3, 3, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = mat3_cast(q[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void to_mat4(qua<T, Q> const* q, mat<4, 4, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = mat4_cast(q[i]);
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'slerp' only accept floating-point inputs");
+
+		detail::compute_quat_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::slerp(x, y, &a, 0, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'slerp' only accept floating-point inputs");
+
+		detail::compute_quat_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::slerp(x, y, a, 1, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void nlerp(qua<T, Q> const* x, qua<T, Q> const* y, T a, qua<T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'nlerp' only accept floating-point inputs");
+
+		detail::compute_quat_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::nlerp(x, y, &a, 0, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void nlerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, qua<T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'nlerp' only accept floating-point inputs");
+
+		detail::compute_quat_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::nlerp(x, y, a, 1, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transform(qua<T, Q> const& q, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'transform' only accept floating-point inputs");
+
+		detail::compute_quat_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::rotate(&q, 0, in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transform(qua<T, Q> const* q, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'transform' only accept floating-point inputs");
+
+		detail::compute_quat_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::rotate(q, 1, in, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat3_cast(qua<T, Q> const* q, mat<3, 3, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'mat3_cast' only accept floating-point inputs");
+
+		detail::compute_quat_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::to_mat3(q, out, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat4_cast(qua<T, Q> const* q, mat<4, 4, T, Q>* out, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'mat4_cast' only accept floating-point inputs");
+
+		detail::compute_quat_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::to_mat4(q, out, count);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "quaternion_batch_simd.inl"
+#endif
@@ -0,0 +1,252 @@
+/// @ref ext_quaternion_batch
+
+#include "../simd/quaternion.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Blocks of 16, 8 then 4 elements are transposed into registers holding one component of each element,
+	// the remaining elements use the scalar functions
+	template<qualifier Q>
+	struct compute_quat_batch<float, Q, true>
+	{
+		typedef compute_quat_batch<float, Q, false> scalar;
+
+		GLM_FUNC_QUALIFIER static float const* data(qua<float, Q> const* q)
+		{
+			return reinterpret_cast<float const*>(q);
+		}
+
+		GLM_FUNC_QUALIFIER static float* data(qua<float, Q>* q)
+		{
+			return reinterpret_cast<float*>(q);
+		}
+
+		GLM_FUNC_QUALIFIER static void slerp(qua<float, Q> const* x, qua<float, Q> const* y, float const* a, std::size_t aStep, qua<float, Q>* out, std::size_t count)
+		{
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX512_BIT
+				for(; i + 16 <= count; i += 16)
+				{
+					glm_f32vec16 X[4];
+					glm_f32vec16 Y[4];
+					glm_f32vec16 R[4];
+					glm_quat_soa16_load(data(x + i), X);
+					glm_quat_soa16_load(data(y + i), Y);
+					glm_quat_soa16_slerp(X, Y, aStep ? _mm512_loadu_ps(a + i) : _mm512_set1_ps(*a), R);
+					glm_quat_soa16_store(R, data(out + i));
+				}
+#			endif
+
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_f32vec8 X[4];
+					glm_f32vec8 Y[4];
+					glm_f32vec8 R[4];
+					glm_quat_soa8_load(data(x + i), X);
+					glm_quat_soa8_load(data(y + i), Y);
+					glm_quat_soa8_slerp(X, Y, aStep ? _mm256_loadu_ps(a + i) : _mm256_set1_ps(*a), R);
+					glm_quat_soa8_store(R, data(out + i));
+				}
+#			endif
+
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 X[4];
+				glm_vec4 Y[4];
+				glm_vec4 R[4];
+				glm_quat_soa4_load(data(x + i), X);
+				glm_quat_soa4_load(data(y + i), Y);
+				glm_quat_soa4_slerp(X, Y, aStep ? _mm_loadu_ps(a + i) : _mm_set1_ps(*a), R);
+				glm_quat_soa4_store(R, data(out + i));
+			}
+
+			scalar::slerp(x + i, y + i, a + i * aStep, aStep, out + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void nlerp(qua<float, Q> const* x, qua<float, Q> const* y, float const* a, std::size_t aStep, qua<float, Q>* out, std::size_t count)
+		{
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX512_BIT
+				for(; i + 16 <= count; i += 16)
+				{
+					glm_f32vec16 X[4];
+					glm_f32vec16 Y[4];
+					glm_f32vec16 R[4];
+					glm_quat_soa16_load(data(x + i), X);
+					glm_quat_soa16_load(data(y + i), Y);
+					glm_quat_soa16_nlerp(X, Y, aStep ? _mm512_loadu_ps(a + i) : _mm512_set1_ps(*a), R);
+					glm_quat_soa16_store(R, data(out + i));
+				}
+#			endif
+
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_f32vec8 X[4];
+					glm_f32vec8 Y[4];
+					glm_f32vec8 R[4];
+					glm_quat_soa8_load(data(x + i), X);
+					glm_quat_soa8_load(data(y + i), Y);
+					glm_quat_soa8_nlerp(X, Y, aStep ? _mm256_loadu_ps(a + i) : _mm256_set1_ps(*a), R);
+					glm_quat_soa8_store(R, data(out + i));
+				}
+#			endif
+
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 X[4];
+				glm_vec4 Y[4];
+				glm_vec4 R[4];
+				glm_quat_soa4_load(data(x + i), X);
+				glm_quat_soa4_load(data(y + i), Y);
+				glm_quat_soa4_nlerp(X, Y, aStep ? _mm_loadu_ps(a + i) : _mm_set1_ps(*a), R);
+				glm_quat_soa4_store(R, data(out + i));
+			}
+
+			scalar::nlerp(x + i, y + i, a + i * aStep, aStep, out + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void rotate(qua<float, Q> const* q, std::size_t qStep, vec<3, float, Q> const* in, vec<3, float, Q>* out, std::size_t count)
+		{
+			std::size_t i = 0;
+
+			// Aligned vec3 are padded to 4 floats
+			if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+			{
+				float const* const s = reinterpret_cast<float const*>(in);
+				float* const d = reinterpret_cast<float*>(out);
+
+#				if GLM_ARCH & GLM_ARCH_AVX512_BIT
+					glm_f32vec16 Q16[4] = {_mm512_set1_ps(q[0].x), _mm512_set1_ps(q[0].y), _mm512_set1_ps(q[0].z), _mm512_set1_ps(q[0].w)};
+					for(; i + 16 <= count; i += 16)
+					{
+						glm_f32vec16 V[3];
+						glm_f32vec16 R[3];
+						if(qStep)
+							glm_quat_soa16_load(data(q + i), Q16);
+						glm_vec3x16_load(s + i * 3, V);
+						glm_quat_soa16_rotate(Q16, V, R);
+						glm_vec3x16_store(R, d + i * 3);
+					}
+#				endif
+
+#				if GLM_ARCH & GLM_ARCH_AVX2_BIT
+					glm_f32vec8 Q8[4] = {_mm256_set1_ps(q[0].x), _mm256_set1_ps(q[0].y), _mm256_set1_ps(q[0].z), _mm256_set1_ps(q[0].w)};
+					for(; i + 8 <= count; i += 8)
+					{
+						glm_f32vec8 V[3];
+						glm_f32vec8 R[3];
+						if(qStep)
+							glm_quat_soa8_load(data(q + i), Q8);
+						glm_vec3x8_load(s + i * 3, V);
+						glm_quat_soa8_rotate(Q8, V, R);
+						glm_vec3x8_store(R, d + i * 3);
+					}
+#				endif
+
+				glm_vec4 Q4[4] = {_mm_set1_ps(q[0].x), _mm_set1_ps(q[0].y), _mm_set1_ps(q[0].z), _mm_set1_ps(q[0].w)};
+				for(; i + 4 <= count; i += 4)
+				{
+					glm_vec4 V[3];
+					glm_vec4 R[3];
+					if(qStep)
+						glm_quat_soa4_load(data(q + i), Q4);
+					glm_vec3x4_load(s + i * 3, V);
+					glm_quat_soa4_rotate(Q4, V, R);
+					glm_vec3x4_store(R, d + i * 3);
+				}
+			}
+
+			scalar::rotate(q + i * qStep, qStep, in + i, out + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void to_mat3(qua<float, Q> const* q, mat<3, 3, float, Q>* out, std::size_t count)
+		{
+			std::size_t i = 0;
+
+			if(sizeof(mat<3, 3, float, Q>) == sizeof(float) * 9)
+			{
+				float* const d = reinterpret_cast<float*>(out);
+
+#				if GLM_ARCH & GLM_ARCH_AVX512_BIT
+					for(; i + 16 <= count; i += 16)
+					{
+						glm_f32vec16 Q16[4];
+						glm_f32vec16 M[9];
+						glm_quat_soa16_load(data(q + i), Q16);
+						glm_quat_soa16_mat3(Q16, M);
+						glm_mat3_soa16_store(M, d + i * 9);
+					}
+#				endif
+
+#				if GLM_ARCH & GLM_ARCH_AVX2_BIT
+					for(; i + 8 <= count; i += 8)
+					{
+						glm_f32vec8 Q8[4];
+						glm_f32vec8 M[9];
+						glm_quat_soa8_load(data(q + i), Q8);
+						glm_quat_soa8_mat3(Q8, M);
+						glm_mat3_soa8_store(M, d + i * 9);
+					}
+#				endif
+
+				for(; i + 4 <= count; i += 4)
+				{
+					glm_vec4 Q4[4];
+					glm_vec4 M[9];
+					glm_quat_soa4_load(data(q + i), Q4);
+					glm_quat_soa4_mat3(Q4, M);
+					glm_mat3_soa4_store(M, d + i * 9);
+				}
+			}
+
+			scalar::to_mat3(q + i, out + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void to_mat4(qua<float, Q> const* q, mat<4, 4, float, Q>* out, std::size_t count)
+		{
+			std::size_t i = 0;
+			float* const d = reinterpret_cast<float*>(out);
+
+#			if GLM_ARCH & GLM_ARCH_AVX512_BIT
+				for(; i + 16 <= count; i += 16)
+				{
+					glm_f32vec16 Q16[4];
+					glm_f32vec16 M[16];
+					glm_quat_soa16_load(data(q + i), Q16);
+					glm_quat_soa16_mat4(Q16, M);
+					glm_mat4_soa16_store(M, d + i * 16);
+				}
+#			endif
+
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_f32vec8 Q8[4];
+					glm_f32vec8 M[16];
+					glm_quat_soa8_load(data(q + i), Q8);
+					glm_quat_soa8_mat4(Q8, M);
+					glm_mat4_soa8_store(M, d + i * 16);
+				}
+#			endif
+
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 Q4[4];
+				glm_vec4 M[16];
+				glm_quat_soa4_load(data(q + i), Q4);
+				glm_quat_soa4_mat4(Q4, M);
+				glm_mat4_soa4_store(M, d + i * 16);
+			}
+
+			scalar::to_mat4(q + i, out + i, count - i);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,45 @@
+/// @ref ext_scalar_trigonometric
+/// @file glm/ext/scalar_trigonometric.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup ext_scalar_trigonometric GLM_EXT_scalar_trigonometric
+/// @ingroup ext
+///
+/// Include <glm/ext/scalar_trigonometric.hpp> to use the features of this extension.
+///
+/// Computes the sine and the cosine of an angle at once.
+///
+/// @see core_func_trigonometric
+/// @see ext_vector_trigonometric
+
+#pragma once
+
+// Dependencies
+#include "../trigonometric.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_scalar_trigonometric extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_scalar_trigonometric
+	/// @{
+
+	/// Computes the sine and the cosine of angle.
+	///
+	/// @param angle Angle in radians
+	/// @param s Receives sin(angle)
+	/// @param c Receives cos(angle)
+	///
+	/// @tparam genType Floating-point scalar types.
+	///
+	/// @see ext_scalar_trigonometric
+	template<typename genType>
+	GLM_FUNC_DISCARD_DECL void sincos(genType angle, genType& s, genType& c);
+
+	/// @}
+}//namespace glm
+
+#include "scalar_trigonometric.inl"
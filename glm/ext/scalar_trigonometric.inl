@@ -0,0 +1,13 @@
+/// @ref ext_scalar_trigonometric
+
+namespace glm
+{
+	template<typename genType>
+	GLM_FUNC_QUALIFIER void sincos(genType angle, genType& s, genType& c)
+	{
+		static_assert(std::numeric_limits<genType>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'sincos' only accept floating-point inputs");
+
+		s = std::sin(angle);
+		c = std::cos(angle);
+	}
+}//namespace glm
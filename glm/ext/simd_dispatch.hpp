@@ -0,0 +1,61 @@
+/// @ref ext_simd_dispatch
+/// @file glm/ext/simd_dispatch.hpp
+///
+/// @defgroup ext_simd_dispatch GLM_EXT_simd_dispatch
+/// @ingroup ext
+///
+/// Selects at runtime the SIMD kernels of bulk functions, such as transform from GLM_EXT_matrix_batch.
+///
+/// GLM selects instruction sets at compile time, from GLM_FORCE_* defines or compiler arguments with GLM_FORCE_INTRINSICS.
+/// When GLM_FORCE_SIMD_DISPATCH is also defined and the build targets an x86 instruction set below AVX-512,
+/// the kernels of bulk functions are additionally built for AVX and AVX-512 using function target attributes.
+/// The CPU features are detected once with cpuid and bulk functions call the best kernels through a function pointer table.
+///
+/// Without GLM_FORCE_SIMD_DISPATCH, the functions of this extension only report the detected instruction set.
+///
+/// Include <glm/ext/simd_dispatch.hpp> to use the features of this extension.
+///
+/// @see ext_matrix_batch
+
+#pragma once
+
+// Dependencies
+#include "../detail/setup.hpp"
+#include <cstddef>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_simd_dispatch extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_simd_dispatch
+	/// @{
+
+	/// Instruction sets that bulk functions can select at runtime, ordered from the lowest to the highest.
+	enum simd_isa
+	{
+		simd_isa_default,	///< Kernels selected at compile time by GLM_FORCE_* defines or compiler arguments
+		simd_isa_avx,		///< AVX, with operating system support for the YMM registers
+		simd_isa_avx2,		///< AVX2, FMA and F16C
+		simd_isa_avx512		///< AVX-512F, with operating system support for the ZMM and mask registers
+	};
+
+	/// Returns the highest instruction set supported by the CPU and the operating system.
+	/// The detection runs once using cpuid and returns simd_isa_default on non-x86 platforms.
+	GLM_FUNC_DECL simd_isa detectSimdISA();
+
+	/// Returns the instruction set selected for bulk functions.
+	/// Bulk functions use the kernels of the highest instruction set they support up to this one.
+	/// Returns simd_isa_default when GLM_FORCE_SIMD_DISPATCH is not in use.
+	GLM_FUNC_DECL simd_isa selectedSimdISA();
+
+	/// Selects the kernels used by bulk functions, eg to test each code path on a single machine.
+	/// ISA is clamped to the value returned by detectSimdISA.
+	/// This function is not thread safe, it must not run concurrently with bulk functions.
+	GLM_FUNC_DISCARD_DECL void forceSimdISA(simd_isa ISA);
+
+	/// @}
+}//namespace glm
+
+#include "simd_dispatch.inl"
@@ -0,0 +1,150 @@
+/// @ref ext_simd_dispatch
+
+#if (GLM_ARCH & GLM_ARCH_X86_BIT) && (GLM_COMPILER & GLM_COMPILER_VC)
+#	include <intrin.h>
+#elif (GLM_ARCH & GLM_ARCH_X86_BIT) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+#	include <cpuid.h>
+#endif
+
+#if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+#	include "../simd/matrix.h"
+#	include "../simd/packing.h"
+#endif
+
+namespace glm{
+namespace detail
+{
+#	if (GLM_ARCH & GLM_ARCH_X86_BIT) && (GLM_COMPILER & (GLM_COMPILER_VC | GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+	// Returns EAX, EBX, ECX and EDX for a cpuid leaf
+	GLM_FUNC_QUALIFIER void cpuid(unsigned int Leaf, unsigned int SubLeaf, unsigned int Regs[4])
+	{
+#		if GLM_COMPILER & GLM_COMPILER_VC
+			int Info[4];
+			__cpuidex(Info, static_cast<int>(Leaf), static_cast<int>(SubLeaf));
+			for(int i = 0; i < 4; ++i)
+				Regs[i] = static_cast<unsigned int>(Info[i]);
+#		else
+			__cpuid_count(Leaf, SubLeaf, Regs[0], Regs[1], Regs[2], Regs[3]);
+#		endif
+	}
+
+	// Returns the low bits of XCR0, the register states enabled by the operating system
+	GLM_FUNC_QUALIFIER unsigned int xgetbv0()
+	{
+#		if GLM_COMPILER & GLM_COMPILER_VC
+			return static_cast<unsigned int>(_xgetbv(0));
+#		else
+			unsigned int Eax, Edx;
+			__asm__ __volatile__("xgetbv" : "=a"(Eax), "=d"(Edx) : "c"(0));
+			return Eax;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER simd_isa detect_simd_isa()
+	{
+		unsigned int Regs[4];
+		cpuid(0, 0, Regs);
+		unsigned int const MaxLeaf = Regs[0];
+		if(MaxLeaf < 1)
+			return simd_isa_default;
+
+		// AVX requires the operating system to save the XMM and YMM registers
+		cpuid(1, 0, Regs);
+		bool const OSXSAVE = (Regs[2] & (1u << 27)) != 0;
+		bool const AVX = (Regs[2] & (1u << 28)) != 0;
+		bool const FMA = (Regs[2] & (1u << 12)) != 0;
+		bool const F16C = (Regs[2] & (1u << 29)) != 0;
+		if(!OSXSAVE || !AVX)
+			return simd_isa_default;
+
+		unsigned int const XCR0 = xgetbv0();
+		if((XCR0 & 0x06) != 0x06)
+			return simd_isa_default;
+		if(MaxLeaf < 7)
+			return simd_isa_avx;
+
+		cpuid(7, 0, Regs);
+		bool const AVX2 = (Regs[1] & (1u << 5)) != 0;
+		bool const AVX512F = (Regs[1] & (1u << 16)) != 0;
+		if(!AVX2 || !FMA || !F16C)
+			return simd_isa_avx;
+
+		// AVX-512 also requires the opmask and the upper ZMM register states
+		if(AVX512F && (XCR0 & 0xE6) == 0xE6)
+			return simd_isa_avx512;
+		return simd_isa_avx2;
+	}
+#	else
+	GLM_FUNC_QUALIFIER simd_isa detect_simd_isa()
+	{
+		return simd_isa_default;
+	}
+#	endif
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+	// Kernels of the bulk functions, all entries are valid for any selected instruction set
+	struct simd_dispatch_table
+	{
+		simd_isa ISA;
+
+		void (*mat4_mul_point_array)(float const m[16], char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count);
+		void (*mat4_mul_vec4_array)(float const m[16], char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count);
+		void (*mat4_mul_packed_store)(float const a[16], float const b[16], float* out, bool stream);
+		void (*pack_half_array)(float const* in, unsigned short* out, std::size_t count);
+		void (*unpack_half_array)(unsigned short const* in, float* out, std::size_t count);
+	};
+
+	GLM_FUNC_QUALIFIER simd_dispatch_table make_simd_dispatch_table(simd_isa ISA)
+	{
+		bool const AVX = ISA >= simd_isa_avx || (GLM_ARCH & GLM_ARCH_AVX_BIT) != 0;
+		bool const F16C = ISA >= simd_isa_avx2 || GLM_HAS_F16C;
+		bool const AVX512 = ISA >= simd_isa_avx512;
+
+		simd_dispatch_table Table;
+		Table.ISA = ISA;
+		Table.mat4_mul_point_array = AVX ? glm_mat4_mul_point_array_avx : glm_mat4_mul_point_array;
+		Table.mat4_mul_vec4_array = AVX512 ? glm_mat4_mul_vec4_array_avx512 : AVX ? glm_mat4_mul_vec4_array_avx : glm_mat4_mul_vec4_array;
+		Table.mat4_mul_packed_store = AVX512 ? glm_mat4_mul_packed_store_avx512 : AVX ? glm_mat4_mul_packed_store_avx : glm_mat4_mul_packed_store;
+		Table.pack_half_array = F16C ? glm_pack_half_array_f16c : glm_pack_half_array;
+		Table.unpack_half_array = F16C ? glm_unpack_half_array_f16c : glm_unpack_half_array;
+		return Table;
+	}
+
+	GLM_FUNC_QUALIFIER simd_dispatch_table& simd_dispatch_instance()
+	{
+		static simd_dispatch_table Table = make_simd_dispatch_table(detectSimdISA());
+		return Table;
+	}
+
+	GLM_FUNC_QUALIFIER simd_dispatch_table const& simd_dispatch()
+	{
+		return simd_dispatch_instance();
+	}
+#	endif//GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+}//namespace detail
+
+	GLM_FUNC_QUALIFIER simd_isa detectSimdISA()
+	{
+		static simd_isa const ISA = detail::detect_simd_isa();
+		return ISA;
+	}
+
+	GLM_FUNC_QUALIFIER simd_isa selectedSimdISA()
+	{
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			return detail::simd_dispatch().ISA;
+#		else
+			return simd_isa_default;
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER void forceSimdISA(simd_isa ISA)
+	{
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			simd_isa const Detected = detectSimdISA();
+			detail::simd_dispatch_instance() = detail::make_simd_dispatch_table(ISA < Detected ? ISA : Detected);
+#		else
+			static_cast<void>(ISA);
+#		endif
+	}
+}//namespace glm
@@ -0,0 +1,272 @@
+/// @ref ext_vector_soa
+/// @file glm/ext/vector_soa.hpp
+///
+/// @defgroup ext_vector_soa GLM_EXT_vector_soa
+/// @ingroup ext
+///
+/// Defines structure of arrays containers of vectors, storing one array per component,
+/// and lane-wise bulk versions of the geometric and common functions operating on them.
+///
+/// vec_soa_view references component arrays owned by someone else, eg the attribute streams of
+/// a particle system, without copying them. vec_soa owns its component arrays and converts to a view.
+/// Functions take views so that they operate on both: inputs as vec_soa_const_view, which const
+/// arrays, views and containers convert to, and outputs as vec_soa_view, which only writable ones
+/// convert to. Outputs are passed by value so that slices can be written to, and may be the same
+/// arrays as an input.
+///
+/// Internally, float streams are processed 4 or 8 elements at a time using SSE2 or AVX when available.
+/// The results match the scalar functions applied to each element up to rounding: the sums are evaluated
+/// in the same order, but the SIMD vec4 functions and FMA contraction may round differently.
+///
+/// Include <glm/ext/vector_soa.hpp> to use the features of this extension.
+///
+/// @see ext_matrix_batch
+/// @see ext_quaternion_batch
+
+#pragma once
+
+// Dependencies
+#include "../vec2.hpp"
+#include "../vec3.hpp"
+#include "../vec4.hpp"
+#include <cstddef>
+#include <vector>
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_vector_soa extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_vector_soa
+	/// @{
+
+	/// Non-owning read-only view of size vectors stored as L component arrays.
+	/// Functions take their inputs as read-only views, built from writable views and containers, const or not.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q = defaultp>
+	struct vec_soa_const_view
+	{
+		static_assert(L >= 2 && L <= 4, "'vec_soa_const_view' only supports 2 to 4 components");
+
+		typedef T value_type;
+		typedef vec<L, T, Q> vec_type;
+
+		/// Empty view
+		GLM_FUNC_DISCARD_DECL vec_soa_const_view();
+
+		/// View of the components arrays data[0] to data[L - 1], each holding size elements
+		GLM_FUNC_DISCARD_DECL vec_soa_const_view(T const* const data[L], std::size_t size);
+
+		GLM_FUNC_DISCARD_DECL vec_soa_const_view(T const* x, T const* y, std::size_t size);
+		GLM_FUNC_DISCARD_DECL vec_soa_const_view(T const* x, T const* y, T const* z, std::size_t size);
+		GLM_FUNC_DISCARD_DECL vec_soa_const_view(T const* x, T const* y, T const* z, T const* w, std::size_t size);
+
+		/// Number of components of the vectors
+		GLM_FUNC_DECL static constexpr length_t length(){return L;}
+
+		/// Number of vectors
+		GLM_FUNC_DECL std::size_t size() const;
+
+		GLM_FUNC_DECL bool empty() const;
+
+		/// Array of the component c of all the vectors
+		GLM_FUNC_DECL T const* operator[](length_t c) const;
+
+		/// Gathers the vector i
+		GLM_FUNC_DECL vec_type load(std::size_t i) const;
+
+		/// Read-only view of count vectors starting at the vector first
+		GLM_FUNC_DECL vec_soa_const_view slice(std::size_t first, std::size_t count) const;
+
+	protected:
+		T const* Data[L];
+		std::size_t Size;
+	};
+
+	/// Non-owning view of size vectors stored as L component arrays, giving write access to them.
+	/// A writable view is only built from writable arrays, views and containers: const ones only convert to vec_soa_const_view.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q = defaultp>
+	struct vec_soa_view : public vec_soa_const_view<L, T, Q>
+	{
+		typedef vec<L, T, Q> vec_type;
+
+		/// Empty view
+		GLM_FUNC_DISCARD_DECL vec_soa_view();
+
+		/// View of the components arrays data[0] to data[L - 1], each holding size elements
+		GLM_FUNC_DISCARD_DECL vec_soa_view(T* const data[L], std::size_t size);
+
+		GLM_FUNC_DISCARD_DECL vec_soa_view(T* x, T* y, std::size_t size);
+		GLM_FUNC_DISCARD_DECL vec_soa_view(T* x, T* y, T* z, std::size_t size);
+		GLM_FUNC_DISCARD_DECL vec_soa_view(T* x, T* y, T* z, T* w, std::size_t size);
+
+		/// Copies of a const view would give write access to its components
+		GLM_FUNC_DISCARD_DECL vec_soa_view(vec_soa_view& v);
+		GLM_FUNC_DISCARD_DECL vec_soa_view(vec_soa_view&& v);
+		vec_soa_view(vec_soa_view const& v) = delete;
+
+		GLM_FUNC_DISCARD_DECL vec_soa_view& operator=(vec_soa_view& v);
+		GLM_FUNC_DISCARD_DECL vec_soa_view& operator=(vec_soa_view&& v);
+		vec_soa_view& operator=(vec_soa_view const& v) = delete;
+
+		using vec_soa_const_view<L, T, Q>::operator[];
+		using vec_soa_const_view<L, T, Q>::slice;
+
+		/// Array of the component c of all the vectors
+		GLM_FUNC_DECL T* operator[](length_t c);
+
+		/// Scatters v into the vector i
+		GLM_FUNC_DISCARD_DECL void store(std::size_t i, vec_type const& v);
+
+		/// View of count vectors starting at the vector first, giving write access to them as this view
+		GLM_FUNC_DECL vec_soa_view slice(std::size_t first, std::size_t count);
+	};
+
+	/// Container of vectors stored as L component arrays.
+	/// The components arrays are reallocated by resize, which invalidates the views referencing them.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q = defaultp>
+	struct vec_soa : public vec_soa_view<L, T, Q>
+	{
+		typedef vec<L, T, Q> vec_type;
+
+		GLM_FUNC_DISCARD_DECL vec_soa();
+
+		/// Container of size zero initialized vectors
+		GLM_FUNC_DISCARD_DECL explicit vec_soa(std::size_t size);
+
+		/// Container of the count vectors of the array in
+		GLM_FUNC_DISCARD_DECL vec_soa(vec_type const* in, std::size_t count);
+
+		GLM_FUNC_DISCARD_DECL vec_soa(vec_soa const& v);
+		GLM_FUNC_DISCARD_DECL vec_soa(vec_soa&& v);
+
+		GLM_FUNC_DISCARD_DECL vec_soa& operator=(vec_soa const& v);
+		GLM_FUNC_DISCARD_DECL vec_soa& operator=(vec_soa&& v);
+
+		/// Resizes the container, keeping the existing vectors and zero initializing the new ones
+		GLM_FUNC_DISCARD_DECL void resize(std::size_t size);
+
+	private:
+		GLM_FUNC_DISCARD_DECL void bind();
+
+		// Component c is stored at Storage[c * size()]
+		std::vector<T> Storage;
+	};
+
+	typedef vec_soa_const_view<2, float, defaultp>	vec2_soa_const_view;
+	typedef vec_soa_const_view<3, float, defaultp>	vec3_soa_const_view;
+	typedef vec_soa_const_view<4, float, defaultp>	vec4_soa_const_view;
+	typedef vec_soa_const_view<2, double, defaultp>	dvec2_soa_const_view;
+	typedef vec_soa_const_view<3, double, defaultp>	dvec3_soa_const_view;
+	typedef vec_soa_const_view<4, double, defaultp>	dvec4_soa_const_view;
+
+	typedef vec_soa_view<2, float, defaultp>	vec2_soa_view;
+	typedef vec_soa_view<3, float, defaultp>	vec3_soa_view;
+	typedef vec_soa_view<4, float, defaultp>	vec4_soa_view;
+	typedef vec_soa_view<2, double, defaultp>	dvec2_soa_view;
+	typedef vec_soa_view<3, double, defaultp>	dvec3_soa_view;
+	typedef vec_soa_view<4, double, defaultp>	dvec4_soa_view;
+
+	typedef vec_soa<2, float, defaultp>			vec2_soa;
+	typedef vec_soa<3, float, defaultp>			vec3_soa;
+	typedef vec_soa<4, float, defaultp>			vec4_soa;
+	typedef vec_soa<2, double, defaultp>		dvec2_soa;
+	typedef vec_soa<3, double, defaultp>		dvec3_soa;
+	typedef vec_soa<4, double, defaultp>		dvec4_soa;
+
+	/// Copies the vectors of the array in to out, in holding out.size() vectors.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void deinterleave(vec<L, T, Q> const* in, vec_soa_view<L, T, Q> out);
+
+	/// Copies the vectors of in to the array out, out holding in.size() vectors.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void interleave(vec_soa_const_view<L, T, Q> const& in, vec<L, T, Q>* out);
+
+	/// Computes out[i] = dot(x[i], y[i]), out holding x.size() elements.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void dot(vec_soa_const_view<L, T, Q> const& x, vec_soa_const_view<L, T, Q> const& y, T* out);
+
+	/// Computes out[i] = length(x[i]), out holding x.size() elements.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void length(vec_soa_const_view<L, T, Q> const& x, T* out);
+
+	/// Computes out[i] = distance(p0[i], p1[i]), out holding p0.size() elements.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void distance(vec_soa_const_view<L, T, Q> const& p0, vec_soa_const_view<L, T, Q> const& p1, T* out);
+
+	/// Computes out[i] = cross(x[i], y[i]).
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void cross(vec_soa_const_view<3, T, Q> const& x, vec_soa_const_view<3, T, Q> const& y, vec_soa_view<3, T, Q> out);
+
+	/// Computes out[i] = normalize(x[i]).
+	/// Unlike the aligned vec4 normalize, the reciprocal square root is not approximated.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void normalize(vec_soa_const_view<L, T, Q> const& x, vec_soa_view<L, T, Q> out);
+
+	/// Computes out[i] = mix(x[i], y[i], a).
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mix(vec_soa_const_view<L, T, Q> const& x, vec_soa_const_view<L, T, Q> const& y, T a, vec_soa_view<L, T, Q> out);
+
+	/// Computes out[i] = mix(x[i], y[i], a[i]), a holding x.size() elements.
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mix(vec_soa_const_view<L, T, Q> const& x, vec_soa_const_view<L, T, Q> const& y, T const* a, vec_soa_view<L, T, Q> out);
+
+	/// Computes out[i] = clamp(x[i], minVal, maxVal).
+	///
+	/// @tparam L Integer between 2 and 4 inclusive that qualify the number of components of the vectors
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void clamp(vec_soa_const_view<L, T, Q> const& x, T minVal, T maxVal, vec_soa_view<L, T, Q> out);
+
+	/// @}
+}//namespace glm
+
+#include "vector_soa.inl"
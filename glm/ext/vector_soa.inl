@@ -0,0 +1,416 @@
+/// @ref ext_vector_soa
+
+#include "../geometric.hpp"
+#include "../common.hpp"
+#include <cassert>
+#include <utility>
+
+namespace glm
+{
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_const_view<L, T, Q>::vec_soa_const_view()
+		: Size(0)
+	{
+		for(length_t c = 0; c < L; ++c)
+			this->Data[c] = 0;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_const_view<L, T, Q>::vec_soa_const_view(T const* const data[L], std::size_t size)
+		: Size(size)
+	{
+		for(length_t c = 0; c < L; ++c)
+			this->Data[c] = data[c];
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_const_view<L, T, Q>::vec_soa_const_view(T const* x, T const* y, std::size_t size)
+		: Size(size)
+	{
+		static_assert(L == 2, "'vec_soa_const_view' of 2 components requires 2 arrays");
+		this->Data[0] = x;
+		this->Data[1] = y;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_const_view<L, T, Q>::vec_soa_const_view(T const* x, T const* y, T const* z, std::size_t size)
+		: Size(size)
+	{
+		static_assert(L == 3, "'vec_soa_const_view' of 3 components requires 3 arrays");
+		this->Data[0] = x;
+		this->Data[1] = y;
+		this->Data[2] = z;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_const_view<L, T, Q>::vec_soa_const_view(T const* x, T const* y, T const* z, T const* w, std::size_t size)
+		: Size(size)
+	{
+		static_assert(L == 4, "'vec_soa_const_view' of 4 components requires 4 arrays");
+		this->Data[0] = x;
+		this->Data[1] = y;
+		this->Data[2] = z;
+		this->Data[3] = w;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t vec_soa_const_view<L, T, Q>::size() const
+	{
+		return this->Size;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool vec_soa_const_view<L, T, Q>::empty() const
+	{
+		return this->Size == 0;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T const* vec_soa_const_view<L, T, Q>::operator[](length_t c) const
+	{
+		assert(c >= 0 && c < L);
+		return this->Data[c];
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER typename vec_soa_const_view<L, T, Q>::vec_type vec_soa_const_view<L, T, Q>::load(std::size_t i) const
+	{
+		assert(i < this->Size);
+		vec_type Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = this->Data[c][i];
+		return Result;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_const_view<L, T, Q> vec_soa_const_view<L, T, Q>::slice(std::size_t first, std::size_t count) const
+	{
+		assert(first <= this->Size && count <= this->Size - first);
+		vec_soa_const_view Result;
+		for(length_t c = 0; c < L; ++c)
+			Result.Data[c] = this->Data[c] + first;
+		Result.Size = count;
+		return Result;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_view<L, T, Q>::vec_soa_view()
+	{}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_view<L, T, Q>::vec_soa_view(T* const data[L], std::size_t size)
+		: vec_soa_const_view<L, T, Q>(data, size)
+	{}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_view<L, T, Q>::vec_soa_view(T* x, T* y, std::size_t size)
+		: vec_soa_const_view<L, T, Q>(x, y, size)
+	{}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_view<L, T, Q>::vec_soa_view(T* x, T* y, T* z, std::size_t size)
+		: vec_soa_const_view<L, T, Q>(x, y, z, size)
+	{}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_view<L, T, Q>::vec_soa_view(T* x, T* y, T* z, T* w, std::size_t size)
+		: vec_soa_const_view<L, T, Q>(x, y, z, w, size)
+	{}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_view<L, T, Q>::vec_soa_view(vec_soa_view& v)
+		: vec_soa_const_view<L, T, Q>(v)
+	{}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_view<L, T, Q>::vec_soa_view(vec_soa_view&& v)
+		: vec_soa_const_view<L, T, Q>(v)
+	{}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_view<L, T, Q>& vec_soa_view<L, T, Q>::operator=(vec_soa_view& v)
+	{
+		vec_soa_const_view<L, T, Q>::operator=(v);
+		return *this;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_view<L, T, Q>& vec_soa_view<L, T, Q>::operator=(vec_soa_view&& v)
+	{
+		vec_soa_const_view<L, T, Q>::operator=(v);
+		return *this;
+	}
+
+	// The arrays are writable, a writable view only being built from writable arrays
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T* vec_soa_view<L, T, Q>::operator[](length_t c)
+	{
+		assert(c >= 0 && c < L);
+		return const_cast<T*>(this->Data[c]);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void vec_soa_view<L, T, Q>::store(std::size_t i, vec_type const& v)
+	{
+		assert(i < this->Size);
+		for(length_t c = 0; c < L; ++c)
+			(*this)[c][i] = v[c];
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa_view<L, T, Q> vec_soa_view<L, T, Q>::slice(std::size_t first, std::size_t count)
+	{
+		assert(first <= this->Size && count <= this->Size - first);
+		vec_soa_view Result;
+		for(length_t c = 0; c < L; ++c)
+			Result.Data[c] = this->Data[c] + first;
+		Result.Size = count;
+		return Result;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa<L, T, Q>::vec_soa()
+	{}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa<L, T, Q>::vec_soa(std::size_t size)
+		: Storage(size * L, static_cast<T>(0))
+	{
+		this->Size = size;
+		this->bind();
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa<L, T, Q>::vec_soa(vec_type const* in, std::size_t count)
+		: Storage(count * L)
+	{
+		this->Size = count;
+		this->bind();
+		glm::deinterleave(in, *this);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa<L, T, Q>::vec_soa(vec_soa const& v)
+		: vec_soa_view<L, T, Q>()
+		, Storage(v.Storage)
+	{
+		this->Size = v.Size;
+		this->bind();
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa<L, T, Q>::vec_soa(vec_soa&& v)
+		: vec_soa_view<L, T, Q>()
+		, Storage(std::move(v.Storage))
+	{
+		this->Size = v.Size;
+		this->bind();
+		v.Storage.clear();
+		v.Size = 0;
+		v.bind();
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa<L, T, Q>& vec_soa<L, T, Q>::operator=(vec_soa const& v)
+	{
+		this->Storage = v.Storage;
+		this->Size = v.Size;
+		this->bind();
+		return *this;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec_soa<L, T, Q>& vec_soa<L, T, Q>::operator=(vec_soa&& v)
+	{
+		if(this != &v)
+		{
+			this->Storage = std::move(v.Storage);
+			this->Size = v.Size;
+			this->bind();
+			v.Storage.clear();
+			v.Size = 0;
+			v.bind();
+		}
+		return *this;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void vec_soa<L, T, Q>::resize(std::size_t size)
+	{
+		std::vector<T> Resized(size * L, static_cast<T>(0));
+		std::size_t const Kept = size < this->Size ? size : this->Size;
+		for(length_t c = 0; c < L; ++c)
+		for(std::size_t i = 0; i < Kept; ++i)
+			Resized[c * size + i] = this->Data[c][i];
+
+		this->Storage.swap(Resized);
+		this->Size = size;
+		this->bind();
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void vec_soa<L, T, Q>::bind()
+	{
+		for(length_t c = 0; c < L; ++c)
+			this->Data[c] = this->Storage.empty() ? 0 : &this->Storage[0] + c * this->Size;
+	}
+
+namespace detail
+{
+	// Elements from first to the end of the views are computed one at a time,
+	// SIMD specializations process the leading elements and call these for the remaining ones.
+	// aStep is 0 to use the same interpolation factor for all elements, 1 otherwise
+	template<length_t L, typename T, qualifier Q, bool UseSimd>
+	struct compute_vec_soa
+	{
+		GLM_FUNC_QUALIFIER static void deinterleave(vec<L, T, Q> const* in, vec_soa_view<L, T, Q>& out, std::size_t first)
+		{
+			for(std::size_t i = first; i < out.size(); ++i)
+				out.store(i, in[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(vec_soa_const_view<L, T, Q> const& in, vec<L, T, Q>* out, std::size_t first)
+		{
+			for(std::size_t i = first; i < in.size(); ++i)
+				out[i] = in.load(i);
+		}
+
+		GLM_FUNC_QUALIFIER static void dot(vec_soa_const_view<L, T, Q> const& x, vec_soa_const_view<L, T, Q> const& y, T* out, std::size_t first)
+		{
+			for(std::size_t i = first; i < x.size(); ++i)
+				out[i] = glm::dot(x.load(i), y.load(i));
+		}
+
+		GLM_FUNC_QUALIFIER static void length(vec_soa_const_view<L, T, Q> const& x, T* out, std::size_t first)
+		{
+			for(std::size_t i = first; i < x.size(); ++i)
+				out[i] = glm::length(x.load(i));
+		}
+
+		GLM_FUNC_QUALIFIER static void distance(vec_soa_const_view<L, T, Q> const& p0, vec_soa_const_view<L, T, Q> const& p1, T* out, std::size_t first)
+		{
+			for(std::size_t i = first; i < p0.size(); ++i)
+				out[i] = glm::distance(p0.load(i), p1.load(i));
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(vec_soa_const_view<L, T, Q> const& x, vec_soa_view<L, T, Q>& out, std::size_t first)
+		{
+			// Not glm::normalize, the aligned vec4 version approximates the reciprocal square root
+			for(std::size_t i = first; i < x.size(); ++i)
+			{
+				vec<L, T, Q> const v = x.load(i);
+				out.store(i, v * inversesqrt(glm::dot(v, v)));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void mix(vec_soa_const_view<L, T, Q> const& x, vec_soa_const_view<L, T, Q> const& y, T const* a, std::size_t aStep, vec_soa_view<L, T, Q>& out, std::size_t first)
+		{
+			for(std::size_t i = first; i < x.size(); ++i)
+				out.store(i, glm::mix(x.load(i), y.load(i), a[i * aStep]));
+		}
+
+		GLM_FUNC_QUALIFIER static void clamp(vec_soa_const_view<L, T, Q> const& x, T minVal, T maxVal, vec_soa_view<L, T, Q>& out, std::size_t first)
+		{
+			for(std::size_t i = first; i < x.size(); ++i)
+				out.store(i, glm::clamp(x.load(i), minVal, maxVal));
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_vec_soa_cross
+	{
+		GLM_FUNC_QUALIFIER static void call(vec_soa_const_view<3, T, Q> const& x, vec_soa_const_view<3, T, Q> const& y, vec_soa_view<3, T, Q>& out, std::size_t first)
+		{
+			for(std::size_t i = first; i < x.size(); ++i)
+				out.store(i, glm::cross(x.load(i), y.load(i)));
+		}
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void deinterleave(vec<L, T, Q> const* in, vec_soa_view<L, T, Q> out)
+	{
+		detail::compute_vec_soa<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::deinterleave(in, out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void interleave(vec_soa_const_view<L, T, Q> const& in, vec<L, T, Q>* out)
+	{
+		detail::compute_vec_soa<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::interleave(in, out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void dot(vec_soa_const_view<L, T, Q> const& x, vec_soa_const_view<L, T, Q> const& y, T* out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'dot' accepts only floating-point inputs");
+		assert(x.size() == y.size());
+
+		detail::compute_vec_soa<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::dot(x, y, out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void length(vec_soa_const_view<L, T, Q> const& x, T* out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'length' accepts only floating-point inputs");
+
+		detail::compute_vec_soa<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::length(x, out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void distance(vec_soa_const_view<L, T, Q> const& p0, vec_soa_const_view<L, T, Q> const& p1, T* out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'distance' accepts only floating-point inputs");
+		assert(p0.size() == p1.size());
+
+		detail::compute_vec_soa<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::distance(p0, p1, out, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void cross(vec_soa_const_view<3, T, Q> const& x, vec_soa_const_view<3, T, Q> const& y, vec_soa_view<3, T, Q> out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'cross' accepts only floating-point inputs");
+		assert(x.size() == y.size() && x.size() == out.size());
+
+		detail::compute_vec_soa_cross<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(x, y, out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void normalize(vec_soa_const_view<L, T, Q> const& x, vec_soa_view<L, T, Q> out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'normalize' accepts only floating-point inputs");
+		assert(x.size() == out.size());
+
+		detail::compute_vec_soa<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::normalize(x, out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mix(vec_soa_const_view<L, T, Q> const& x, vec_soa_const_view<L, T, Q> const& y, T a, vec_soa_view<L, T, Q> out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'mix' accepts only floating-point inputs");
+		assert(x.size() == y.size() && x.size() == out.size());
+
+		detail::compute_vec_soa<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mix(x, y, &a, 0, out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mix(vec_soa_const_view<L, T, Q> const& x, vec_soa_const_view<L, T, Q> const& y, T const* a, vec_soa_view<L, T, Q> out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'mix' accepts only floating-point inputs");
+		assert(x.size() == y.size() && x.size() == out.size());
+
+		detail::compute_vec_soa<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mix(x, y, a, 1, out, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void clamp(vec_soa_const_view<L, T, Q> const& x, T minVal, T maxVal, vec_soa_view<L, T, Q> out)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'clamp' accepts only floating-point inputs");
+		assert(x.size() == out.size());
+
+		detail::compute_vec_soa<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::clamp(x, minVal, maxVal, out, 0);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "vector_soa_simd.inl"
+#endif
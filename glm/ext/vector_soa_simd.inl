@@ -0,0 +1,450 @@
+/// @ref ext_vector_soa
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Parts of the kernels depending on the number of components, sums are evaluated in the order of compute_dot
+	template<length_t L>
+	struct vec_soa_lanes
+	{};
+
+	template<>
+	struct vec_soa_lanes<2>
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 dot4(float const* const x[2], float const* const y[2], std::size_t i)
+		{
+			glm_vec4 const X = _mm_mul_ps(_mm_loadu_ps(x[0] + i), _mm_loadu_ps(y[0] + i));
+			glm_vec4 const Y = _mm_mul_ps(_mm_loadu_ps(x[1] + i), _mm_loadu_ps(y[1] + i));
+			return _mm_add_ps(X, Y);
+		}
+
+		GLM_FUNC_QUALIFIER static glm_vec4 distance2_4(float const* const p0[2], float const* const p1[2], std::size_t i)
+		{
+			glm_vec4 const X = _mm_sub_ps(_mm_loadu_ps(p1[0] + i), _mm_loadu_ps(p0[0] + i));
+			glm_vec4 const Y = _mm_sub_ps(_mm_loadu_ps(p1[1] + i), _mm_loadu_ps(p0[1] + i));
+			return _mm_add_ps(_mm_mul_ps(X, X), _mm_mul_ps(Y, Y));
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_f32vec8 dot8(float const* const x[2], float const* const y[2], std::size_t i)
+		{
+			glm_f32vec8 const X = _mm256_mul_ps(_mm256_loadu_ps(x[0] + i), _mm256_loadu_ps(y[0] + i));
+			glm_f32vec8 const Y = _mm256_mul_ps(_mm256_loadu_ps(x[1] + i), _mm256_loadu_ps(y[1] + i));
+			return _mm256_add_ps(X, Y);
+		}
+
+		GLM_FUNC_QUALIFIER static glm_f32vec8 distance2_8(float const* const p0[2], float const* const p1[2], std::size_t i)
+		{
+			glm_f32vec8 const X = _mm256_sub_ps(_mm256_loadu_ps(p1[0] + i), _mm256_loadu_ps(p0[0] + i));
+			glm_f32vec8 const Y = _mm256_sub_ps(_mm256_loadu_ps(p1[1] + i), _mm256_loadu_ps(p0[1] + i));
+			return _mm256_add_ps(_mm256_mul_ps(X, X), _mm256_mul_ps(Y, Y));
+		}
+#		endif
+
+		// in holds 4 packed vec2
+		GLM_FUNC_QUALIFIER static void deinterleave4(float const* in, float* const out[2], std::size_t i)
+		{
+			glm_vec4 const a = _mm_loadu_ps(in + 0); // x0 y0 x1 y1
+			glm_vec4 const b = _mm_loadu_ps(in + 4); // x2 y2 x3 y3
+			_mm_storeu_ps(out[0] + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(out[1] + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave4(float const* const in[2], std::size_t i, float* out)
+		{
+			glm_vec4 const x = _mm_loadu_ps(in[0] + i);
+			glm_vec4 const y = _mm_loadu_ps(in[1] + i);
+			_mm_storeu_ps(out + 0, _mm_unpacklo_ps(x, y));
+			_mm_storeu_ps(out + 4, _mm_unpackhi_ps(x, y));
+		}
+	};
+
+	template<>
+	struct vec_soa_lanes<3>
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 dot4(float const* const x[3], float const* const y[3], std::size_t i)
+		{
+			glm_vec4 const X = _mm_mul_ps(_mm_loadu_ps(x[0] + i), _mm_loadu_ps(y[0] + i));
+			glm_vec4 const Y = _mm_mul_ps(_mm_loadu_ps(x[1] + i), _mm_loadu_ps(y[1] + i));
+			glm_vec4 const Z = _mm_mul_ps(_mm_loadu_ps(x[2] + i), _mm_loadu_ps(y[2] + i));
+			return _mm_add_ps(_mm_add_ps(X, Y), Z);
+		}
+
+		GLM_FUNC_QUALIFIER static glm_vec4 distance2_4(float const* const p0[3], float const* const p1[3], std::size_t i)
+		{
+			glm_vec4 const X = _mm_sub_ps(_mm_loadu_ps(p1[0] + i), _mm_loadu_ps(p0[0] + i));
+			glm_vec4 const Y = _mm_sub_ps(_mm_loadu_ps(p1[1] + i), _mm_loadu_ps(p0[1] + i));
+			glm_vec4 const Z = _mm_sub_ps(_mm_loadu_ps(p1[2] + i), _mm_loadu_ps(p0[2] + i));
+			return _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, X), _mm_mul_ps(Y, Y)), _mm_mul_ps(Z, Z));
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_f32vec8 dot8(float const* const x[3], float const* const y[3], std::size_t i)
+		{
+			glm_f32vec8 const X = _mm256_mul_ps(_mm256_loadu_ps(x[0] + i), _mm256_loadu_ps(y[0] + i));
+			glm_f32vec8 const Y = _mm256_mul_ps(_mm256_loadu_ps(x[1] + i), _mm256_loadu_ps(y[1] + i));
+			glm_f32vec8 const Z = _mm256_mul_ps(_mm256_loadu_ps(x[2] + i), _mm256_loadu_ps(y[2] + i));
+			return _mm256_add_ps(_mm256_add_ps(X, Y), Z);
+		}
+
+		GLM_FUNC_QUALIFIER static glm_f32vec8 distance2_8(float const* const p0[3], float const* const p1[3], std::size_t i)
+		{
+			glm_f32vec8 const X = _mm256_sub_ps(_mm256_loadu_ps(p1[0] + i), _mm256_loadu_ps(p0[0] + i));
+			glm_f32vec8 const Y = _mm256_sub_ps(_mm256_loadu_ps(p1[1] + i), _mm256_loadu_ps(p0[1] + i));
+			glm_f32vec8 const Z = _mm256_sub_ps(_mm256_loadu_ps(p1[2] + i), _mm256_loadu_ps(p0[2] + i));
+			return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(X, X), _mm256_mul_ps(Y, Y)), _mm256_mul_ps(Z, Z));
+		}
+#		endif
+
+		// in holds 4 packed vec3
+		GLM_FUNC_QUALIFIER static void deinterleave4(float const* in, float* const out[3], std::size_t i)
+		{
+			glm_vec4 V[3];
+			glm_vec3x4_load(in, V);
+			_mm_storeu_ps(out[0] + i, V[0]);
+			_mm_storeu_ps(out[1] + i, V[1]);
+			_mm_storeu_ps(out[2] + i, V[2]);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave4(float const* const in[3], std::size_t i, float* out)
+		{
+			glm_vec4 const V[3] = {_mm_loadu_ps(in[0] + i), _mm_loadu_ps(in[1] + i), _mm_loadu_ps(in[2] + i)};
+			glm_vec3x4_store(V, out);
+		}
+	};
+
+	template<>
+	struct vec_soa_lanes<4>
+	{
+		GLM_FUNC_QUALIFIER static glm_vec4 dot4(float const* const x[4], float const* const y[4], std::size_t i)
+		{
+			glm_vec4 const X = _mm_mul_ps(_mm_loadu_ps(x[0] + i), _mm_loadu_ps(y[0] + i));
+			glm_vec4 const Y = _mm_mul_ps(_mm_loadu_ps(x[1] + i), _mm_loadu_ps(y[1] + i));
+			glm_vec4 const Z = _mm_mul_ps(_mm_loadu_ps(x[2] + i), _mm_loadu_ps(y[2] + i));
+			glm_vec4 const W = _mm_mul_ps(_mm_loadu_ps(x[3] + i), _mm_loadu_ps(y[3] + i));
+			return _mm_add_ps(_mm_add_ps(X, Y), _mm_add_ps(Z, W));
+		}
+
+		GLM_FUNC_QUALIFIER static glm_vec4 distance2_4(float const* const p0[4], float const* const p1[4], std::size_t i)
+		{
+			glm_vec4 const X = _mm_sub_ps(_mm_loadu_ps(p1[0] + i), _mm_loadu_ps(p0[0] + i));
+			glm_vec4 const Y = _mm_sub_ps(_mm_loadu_ps(p1[1] + i), _mm_loadu_ps(p0[1] + i));
+			glm_vec4 const Z = _mm_sub_ps(_mm_loadu_ps(p1[2] + i), _mm_loadu_ps(p0[2] + i));
+			glm_vec4 const W = _mm_sub_ps(_mm_loadu_ps(p1[3] + i), _mm_loadu_ps(p0[3] + i));
+			return _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, X), _mm_mul_ps(Y, Y)), _mm_add_ps(_mm_mul_ps(Z, Z), _mm_mul_ps(W, W)));
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+		GLM_FUNC_QUALIFIER static glm_f32vec8 dot8(float const* const x[4], float const* const y[4], std::size_t i)
+		{
+			glm_f32vec8 const X = _mm256_mul_ps(_mm256_loadu_ps(x[0] + i), _mm256_loadu_ps(y[0] + i));
+			glm_f32vec8 const Y = _mm256_mul_ps(_mm256_loadu_ps(x[1] + i), _mm256_loadu_ps(y[1] + i));
+			glm_f32vec8 const Z = _mm256_mul_ps(_mm256_loadu_ps(x[2] + i), _mm256_loadu_ps(y[2] + i));
+			glm_f32vec8 const W = _mm256_mul_ps(_mm256_loadu_ps(x[3] + i), _mm256_loadu_ps(y[3] + i));
+			return _mm256_add_ps(_mm256_add_ps(X, Y), _mm256_add_ps(Z, W));
+		}
+
+		GLM_FUNC_QUALIFIER static glm_f32vec8 distance2_8(float const* const p0[4], float const* const p1[4], std::size_t i)
+		{
+			glm_f32vec8 const X = _mm256_sub_ps(_mm256_loadu_ps(p1[0] + i), _mm256_loadu_ps(p0[0] + i));
+			glm_f32vec8 const Y = _mm256_sub_ps(_mm256_loadu_ps(p1[1] + i), _mm256_loadu_ps(p0[1] + i));
+			glm_f32vec8 const Z = _mm256_sub_ps(_mm256_loadu_ps(p1[2] + i), _mm256_loadu_ps(p0[2] + i));
+			glm_f32vec8 const W = _mm256_sub_ps(_mm256_loadu_ps(p1[3] + i), _mm256_loadu_ps(p0[3] + i));
+			return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(X, X), _mm256_mul_ps(Y, Y)), _mm256_add_ps(_mm256_mul_ps(Z, Z), _mm256_mul_ps(W, W)));
+		}
+#		endif
+
+		// in holds 4 packed vec4, transposed like a matrix
+		GLM_FUNC_QUALIFIER static void deinterleave4(float const* in, float* const out[4], std::size_t i)
+		{
+			__m128 a = _mm_loadu_ps(in + 0);
+			__m128 b = _mm_loadu_ps(in + 4);
+			__m128 c = _mm_loadu_ps(in + 8);
+			__m128 d = _mm_loadu_ps(in + 12);
+			_MM_TRANSPOSE4_PS(a, b, c, d);
+			_mm_storeu_ps(out[0] + i, a);
+			_mm_storeu_ps(out[1] + i, b);
+			_mm_storeu_ps(out[2] + i, c);
+			_mm_storeu_ps(out[3] + i, d);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave4(float const* const in[4], std::size_t i, float* out)
+		{
+			__m128 x = _mm_loadu_ps(in[0] + i);
+			__m128 y = _mm_loadu_ps(in[1] + i);
+			__m128 z = _mm_loadu_ps(in[2] + i);
+			__m128 w = _mm_loadu_ps(in[3] + i);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			_mm_storeu_ps(out + 0, x);
+			_mm_storeu_ps(out + 4, y);
+			_mm_storeu_ps(out + 8, z);
+			_mm_storeu_ps(out + 12, w);
+		}
+	};
+
+	// Blocks of 8 then 4 elements are loaded straight from the component arrays,
+	// the remaining elements use the scalar functions
+	template<length_t L, qualifier Q>
+	struct compute_vec_soa<L, float, Q, true>
+	{
+		typedef compute_vec_soa<L, float, Q, false> scalar;
+		typedef vec_soa_lanes<L> lanes;
+
+		GLM_FUNC_QUALIFIER static void deinterleave(vec<L, float, Q> const* in, vec_soa_view<L, float, Q>& out, std::size_t first)
+		{
+			std::size_t const count = out.size() - first;
+			std::size_t const simd = first + count - count % 4;
+			std::size_t i = first;
+
+			// Aligned vec3 are padded to 4 floats
+			if(sizeof(vec<L, float, Q>) == sizeof(float) * L)
+			{
+				float const* const s = reinterpret_cast<float const*>(in);
+				float* O[L];
+				for(length_t c = 0; c < L; ++c)
+					O[c] = out[c];
+
+				for(; i < simd; i += 4)
+					lanes::deinterleave4(s + i * L, O, i);
+			}
+
+			scalar::deinterleave(in, out, i);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(vec_soa_const_view<L, float, Q> const& in, vec<L, float, Q>* out, std::size_t first)
+		{
+			std::size_t const count = in.size() - first;
+			std::size_t const simd = first + count - count % 4;
+			std::size_t i = first;
+
+			if(sizeof(vec<L, float, Q>) == sizeof(float) * L)
+			{
+				float* const d = reinterpret_cast<float*>(out);
+				float const* I[L];
+				for(length_t c = 0; c < L; ++c)
+					I[c] = in[c];
+
+				for(; i < simd; i += 4)
+					lanes::interleave4(I, i, d + i * L);
+			}
+
+			scalar::interleave(in, out, i);
+		}
+
+		GLM_FUNC_QUALIFIER static void dot(vec_soa_const_view<L, float, Q> const& x, vec_soa_const_view<L, float, Q> const& y, float* out, std::size_t first)
+		{
+			std::size_t i = first;
+			float const* X[L];
+			float const* Y[L];
+			for(length_t c = 0; c < L; ++c)
+			{
+				X[c] = x[c];
+				Y[c] = y[c];
+			}
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				for(; i + 8 <= x.size(); i += 8)
+					_mm256_storeu_ps(out + i, lanes::dot8(X, Y, i));
+#			endif
+
+			for(; i + 4 <= x.size(); i += 4)
+				_mm_storeu_ps(out + i, lanes::dot4(X, Y, i));
+
+			scalar::dot(x, y, out, i);
+		}
+
+		GLM_FUNC_QUALIFIER static void length(vec_soa_const_view<L, float, Q> const& x, float* out, std::size_t first)
+		{
+			std::size_t i = first;
+			float const* X[L];
+			for(length_t c = 0; c < L; ++c)
+				X[c] = x[c];
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				for(; i + 8 <= x.size(); i += 8)
+					_mm256_storeu_ps(out + i, _mm256_sqrt_ps(lanes::dot8(X, X, i)));
+#			endif
+
+			for(; i + 4 <= x.size(); i += 4)
+				_mm_storeu_ps(out + i, _mm_sqrt_ps(lanes::dot4(X, X, i)));
+
+			scalar::length(x, out, i);
+		}
+
+		GLM_FUNC_QUALIFIER static void distance(vec_soa_const_view<L, float, Q> const& p0, vec_soa_const_view<L, float, Q> const& p1, float* out, std::size_t first)
+		{
+			std::size_t i = first;
+			float const* P0[L];
+			float const* P1[L];
+			for(length_t c = 0; c < L; ++c)
+			{
+				P0[c] = p0[c];
+				P1[c] = p1[c];
+			}
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				for(; i + 8 <= p0.size(); i += 8)
+					_mm256_storeu_ps(out + i, _mm256_sqrt_ps(lanes::distance2_8(P0, P1, i)));
+#			endif
+
+			for(; i + 4 <= p0.size(); i += 4)
+				_mm_storeu_ps(out + i, _mm_sqrt_ps(lanes::distance2_4(P0, P1, i)));
+
+			scalar::distance(p0, p1, out, i);
+		}
+
+		GLM_FUNC_QUALIFIER static void normalize(vec_soa_const_view<L, float, Q> const& x, vec_soa_view<L, float, Q>& out, std::size_t first)
+		{
+			std::size_t i = first;
+			float const* X[L];
+			float* O[L];
+			for(length_t c = 0; c < L; ++c)
+			{
+				X[c] = x[c];
+				O[c] = out[c];
+			}
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				for(; i + 8 <= x.size(); i += 8)
+				{
+					glm_f32vec8 const Inv = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(lanes::dot8(X, X, i)));
+					for(length_t c = 0; c < L; ++c)
+						_mm256_storeu_ps(O[c] + i, _mm256_mul_ps(_mm256_loadu_ps(X[c] + i), Inv));
+				}
+#			endif
+
+			for(; i + 4 <= x.size(); i += 4)
+			{
+				glm_vec4 const Inv = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lanes::dot4(X, X, i)));
+				for(length_t c = 0; c < L; ++c)
+					_mm_storeu_ps(O[c] + i, _mm_mul_ps(_mm_loadu_ps(X[c] + i), Inv));
+			}
+
+			scalar::normalize(x, out, i);
+		}
+
+		// Components are independent, each array is processed as a stream
+		GLM_FUNC_QUALIFIER static void mix(vec_soa_const_view<L, float, Q> const& x, vec_soa_const_view<L, float, Q> const& y, float const* a, std::size_t aStep, vec_soa_view<L, float, Q>& out, std::size_t first)
+		{
+			std::size_t const count = x.size() - first;
+			std::size_t const simd = count - count % 4;
+
+			for(length_t c = 0; c < L; ++c)
+			{
+				float const* const X = x[c] + first;
+				float const* const Y = y[c] + first;
+				float const* const A = a + first * aStep;
+				float* const O = out[c] + first;
+				std::size_t i = 0;
+
+#				if GLM_ARCH & GLM_ARCH_AVX_BIT
+					glm_f32vec8 const One8 = _mm256_set1_ps(1.0f);
+					for(; i + 8 <= simd; i += 8)
+					{
+						glm_f32vec8 const a8 = aStep ? _mm256_loadu_ps(A + i) : _mm256_set1_ps(*A);
+						glm_f32vec8 const X8 = _mm256_mul_ps(_mm256_loadu_ps(X + i), _mm256_sub_ps(One8, a8));
+						_mm256_storeu_ps(O + i, _mm256_add_ps(X8, _mm256_mul_ps(_mm256_loadu_ps(Y + i), a8)));
+					}
+#				endif
+
+				glm_vec4 const One4 = _mm_set1_ps(1.0f);
+				for(; i < simd; i += 4)
+				{
+					glm_vec4 const a4 = aStep ? _mm_loadu_ps(A + i) : _mm_set1_ps(*A);
+					glm_vec4 const X4 = _mm_mul_ps(_mm_loadu_ps(X + i), _mm_sub_ps(One4, a4));
+					_mm_storeu_ps(O + i, _mm_add_ps(X4, _mm_mul_ps(_mm_loadu_ps(Y + i), a4)));
+				}
+			}
+
+			scalar::mix(x, y, a, aStep, out, first + simd);
+		}
+
+		// _mm_max_ps(minVal, x) and _mm_min_ps(maxVal, x) select like max(x, minVal) and min(x, maxVal), including NaN
+		GLM_FUNC_QUALIFIER static void clamp(vec_soa_const_view<L, float, Q> const& x, float minVal, float maxVal, vec_soa_view<L, float, Q>& out, std::size_t first)
+		{
+			std::size_t const count = x.size() - first;
+			std::size_t const simd = count - count % 4;
+
+			for(length_t c = 0; c < L; ++c)
+			{
+				float const* const X = x[c] + first;
+				float* const O = out[c] + first;
+				std::size_t i = 0;
+
+#				if GLM_ARCH & GLM_ARCH_AVX_BIT
+					glm_f32vec8 const Min8 = _mm256_set1_ps(minVal);
+					glm_f32vec8 const Max8 = _mm256_set1_ps(maxVal);
+					for(; i + 8 <= simd; i += 8)
+						_mm256_storeu_ps(O + i, _mm256_min_ps(Max8, _mm256_max_ps(Min8, _mm256_loadu_ps(X + i))));
+#				endif
+
+				glm_vec4 const Min4 = _mm_set1_ps(minVal);
+				glm_vec4 const Max4 = _mm_set1_ps(maxVal);
+				for(; i < simd; i += 4)
+					_mm_storeu_ps(O + i, _mm_min_ps(Max4, _mm_max_ps(Min4, _mm_loadu_ps(X + i))));
+			}
+
+			scalar::clamp(x, minVal, maxVal, out, first + simd);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_vec_soa_cross<float, Q, true>
+	{
+		// All the components are loaded before storing so that out may be x or y
+		GLM_FUNC_QUALIFIER static void call(vec_soa_const_view<3, float, Q> const& x, vec_soa_const_view<3, float, Q> const& y, vec_soa_view<3, float, Q>& out, std::size_t first)
+		{
+			std::size_t i = first;
+			float const* const x0 = x[0];
+			float const* const x1 = x[1];
+			float const* const x2 = x[2];
+			float const* const y0 = y[0];
+			float const* const y1 = y[1];
+			float const* const y2 = y[2];
+			float* const o0 = out[0];
+			float* const o1 = out[1];
+			float* const o2 = out[2];
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				for(; i + 8 <= x.size(); i += 8)
+				{
+					glm_f32vec8 const X0 = _mm256_loadu_ps(x0 + i);
+					glm_f32vec8 const X1 = _mm256_loadu_ps(x1 + i);
+					glm_f32vec8 const X2 = _mm256_loadu_ps(x2 + i);
+					glm_f32vec8 const Y0 = _mm256_loadu_ps(y0 + i);
+					glm_f32vec8 const Y1 = _mm256_loadu_ps(y1 + i);
+					glm_f32vec8 const Y2 = _mm256_loadu_ps(y2 + i);
+					glm_f32vec8 const R0 = _mm256_sub_ps(_mm256_mul_ps(X1, Y2), _mm256_mul_ps(Y1, X2));
+					glm_f32vec8 const R1 = _mm256_sub_ps(_mm256_mul_ps(X2, Y0), _mm256_mul_ps(Y2, X0));
+					glm_f32vec8 const R2 = _mm256_sub_ps(_mm256_mul_ps(X0, Y1), _mm256_mul_ps(Y0, X1));
+					_mm256_storeu_ps(o0 + i, R0);
+					_mm256_storeu_ps(o1 + i, R1);
+					_mm256_storeu_ps(o2 + i, R2);
+				}
+#			endif
+
+			for(; i + 4 <= x.size(); i += 4)
+			{
+				glm_vec4 const X0 = _mm_loadu_ps(x0 + i);
+				glm_vec4 const X1 = _mm_loadu_ps(x1 + i);
+				glm_vec4 const X2 = _mm_loadu_ps(x2 + i);
+				glm_vec4 const Y0 = _mm_loadu_ps(y0 + i);
+				glm_vec4 const Y1 = _mm_loadu_ps(y1 + i);
+				glm_vec4 const Y2 = _mm_loadu_ps(y2 + i);
+				glm_vec4 const R0 = _mm_sub_ps(_mm_mul_ps(X1, Y2), _mm_mul_ps(Y1, X2));
+				glm_vec4 const R1 = _mm_sub_ps(_mm_mul_ps(X2, Y0), _mm_mul_ps(Y2, X0));
+				glm_vec4 const R2 = _mm_sub_ps(_mm_mul_ps(X0, Y1), _mm_mul_ps(Y0, X1));
+				_mm_storeu_ps(o0 + i, R0);
+				_mm_storeu_ps(o1 + i, R1);
+				_mm_storeu_ps(o2 + i, R2);
+			}
+
+			compute_vec_soa_cross<float, Q, false>::call(x, y, out, i);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,48 @@
+/// @ref ext_vector_trigonometric
+/// @file glm/ext/vector_trigonometric.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup ext_vector_trigonometric GLM_EXT_vector_trigonometric
+/// @ingroup ext
+///
+/// Include <glm/ext/vector_trigonometric.hpp> to use the features of this extension.
+///
+/// Computes the sine and the cosine of each component at once.
+/// With SIMD enabled, aligned vec4 and, with AVX, aligned dvec4 share the range reduction of both functions.
+///
+/// @see core_func_trigonometric
+/// @see ext_scalar_trigonometric
+
+#pragma once
+
+// Dependencies
+#include "../trigonometric.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_EXT_vector_trigonometric extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup ext_vector_trigonometric
+	/// @{
+
+	/// Computes the sine and the cosine of each component of angle.
+	///
+	/// @param angle Angles in radians
+	/// @param s Receives sin(angle)
+	/// @param c Receives cos(angle)
+	///
+	/// @tparam L Integer between 1 and 4 included that qualify the dimension of the vector
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	///
+	/// @see ext_vector_trigonometric
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void sincos(vec<L, T, Q> const& angle, vec<L, T, Q>& s, vec<L, T, Q>& c);
+
+	/// @}
+}//namespace glm
+
+#include "vector_trigonometric.inl"
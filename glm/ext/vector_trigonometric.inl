@@ -0,0 +1,28 @@
+/// @ref ext_vector_trigonometric
+
+namespace glm{
+namespace detail
+{
+	template<length_t L, typename T, qualifier Q, bool Aligned>
+	struct compute_sincos
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const& angle, vec<L, T, Q>& s, vec<L, T, Q>& c)
+		{
+			s = sin(angle);
+			c = cos(angle);
+		}
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sincos(vec<L, T, Q> const& angle, vec<L, T, Q>& s, vec<L, T, Q>& c)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'sincos' only accept floating-point inputs");
+
+		detail::compute_sincos<L, T, Q, detail::is_aligned<Q>::value>::call(angle, s, c);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "vector_trigonometric_simd.inl"
+#endif
@@ -0,0 +1,44 @@
+/// @ref ext_vector_trigonometric
+
+#include "../simd/trigonometric.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & (GLM_ARCH_SSE2_BIT | GLM_ARCH_NEON_BIT)
+	template<qualifier Q>
+	struct compute_sincos<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, float, Q> const& angle, vec<4, float, Q>& s, vec<4, float, Q>& c)
+		{
+			if(glm_vec4_trig_outside_range(angle.data))
+			{
+				s = compute_sin<4, float, Q, false>::call(angle);
+				c = compute_cos<4, float, Q, false>::call(angle);
+				return;
+			}
+
+			glm_vec4_sincos(angle.data, &s.data, &c.data);
+		}
+	};
+#	endif
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<qualifier Q>
+	struct compute_sincos<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<4, double, Q> const& angle, vec<4, double, Q>& s, vec<4, double, Q>& c)
+		{
+			if(glm_dvec4_trig_outside_range(angle.data))
+			{
+				s = compute_sin<4, double, Q, false>::call(angle);
+				c = compute_cos<4, double, Q, false>::call(angle);
+				return;
+			}
+
+			glm_dvec4_sincos(angle.data, &s.data, &c.data);
+		}
+	};
+#	endif
+}//namespace detail
+}//namespace glm
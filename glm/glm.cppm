@@ -1030,6 +1030,27 @@ export namespace glm {
 	using glm::mediump_f64quat;
 	using glm::highp_f64quat;
 	using glm::f64quat;
+	using glm::vec_soa_const_view;
+	using glm::vec_soa_view;
+	using glm::vec_soa;
+	using glm::vec2_soa_const_view;
+	using glm::vec3_soa_const_view;
+	using glm::vec4_soa_const_view;
+	using glm::dvec2_soa_const_view;
+	using glm::dvec3_soa_const_view;
+	using glm::dvec4_soa_const_view;
+	using glm::vec2_soa_view;
+	using glm::vec3_soa_view;
+	using glm::vec4_soa_view;
+	using glm::dvec2_soa_view;
+	using glm::dvec3_soa_view;
+	using glm::dvec4_soa_view;
+	using glm::vec2_soa;
+	using glm::vec3_soa;
+	using glm::vec4_soa;
+	using glm::dvec2_soa;
+	using glm::dvec3_soa;
+	using glm::dvec4_soa;
 
 	// Operators
 	using glm::operator+;
@@ -1763,6 +1784,7 @@ export namespace glm {
 		using glm::greaterThan;
 		using glm::greaterThanEqual;
 		using glm::half_pi;
+		using glm::haltonSequence;
 		using glm::identity;
 		using glm::imulExtended;
 		using glm::infinitePerspective;
@@ -1870,6 +1892,7 @@ export namespace glm {
 		using glm::packUnorm3x5_1x1;
 		using glm::packUnorm4x16;
 		using glm::packUnorm4x4;
+		using glm::pcg32;
 		using glm::perlin;
 		using glm::perspective;
 		using glm::perspectiveFov;
@@ -1902,7 +1925,10 @@ export namespace glm {
 		using glm::quatLookAtLH;
 		using glm::quatLookAtRH;
 		using glm::quat_cast;
+		using glm::r2Sequence;
 		using glm::radians;
+		using glm::randomEngine;
+		using glm::randomSeed;
 		using glm::reflect;
 		using glm::refract;
 		using glm::repeat;
@@ -1929,6 +1955,7 @@ export namespace glm {
 		using glm::sinh;
 		using glm::slerp;
 		using glm::smoothstep;
+		using glm::sobolSequence;
 		using glm::sphericalRand;
 		using glm::sqrt;
 		using glm::step;
@@ -1988,6 +2015,7 @@ export namespace glm {
 		using glm::uround;
 		using glm::usubBorrow;
 		using glm::value_ptr;
+		using glm::xoshiro128x8;
 		using glm::yaw;
 		using glm::zero;
 	}
@@ -1996,6 +2024,8 @@ export namespace glm {
 	inline
 #   endif
 	namespace ext {
+		using glm::YCoCg2rgb;
+		using glm::YCoCgR2rgb;
 		using glm::abs;
 		using glm::acos;
 		using glm::acosh;
@@ -2003,6 +2033,13 @@ export namespace glm {
 		using glm::acoth;
 		using glm::acsc;
 		using glm::acsch;
+		using glm::affineFromMat4;
+		using glm::affineInverse;
+		using glm::affineMultiply;
+		using glm::affineToMat4;
+		using glm::affineTransformNormal;
+		using glm::affineTransformPoint;
+		using glm::affineTransformVector;
 		using glm::all;
 		using glm::angle;
 		using glm::angleAxis;
@@ -2017,6 +2054,12 @@ export namespace glm {
 		using glm::ceil;
 		using glm::clamp;
 		using glm::conjugate;
+		using glm::convertD65XYZToD50XYZ;
+		using glm::convertD65XYZToLinearSRGB;
+		using glm::convertLinearSRGBToD50XYZ;
+		using glm::convertLinearSRGBToD65XYZ;
+		using glm::convertLinearToSRGB;
+		using glm::convertSRGBToLinear;
 		using glm::cos;
 		using glm::cos_one_over_two;
 		using glm::cosh;
@@ -2026,7 +2069,9 @@ export namespace glm {
 		using glm::csc;
 		using glm::csch;
 		using glm::degrees;
+		using glm::deinterleave;
 		using glm::determinant;
+		using glm::detectSimdISA;
 		using glm::distance;
 		using glm::dot;
 		using glm::e;
@@ -2035,6 +2080,9 @@ export namespace glm {
 		using glm::euler;
 		using glm::exp;
 		using glm::exp2;
+		using glm::extractFrustumPlanes;
+		using glm::extractFrustumPlanesNO;
+		using glm::extractFrustumPlanesZO;
 		using glm::faceforward;
 		using glm::fclamp;
 		using glm::findNSB;
@@ -2045,6 +2093,7 @@ export namespace glm {
 		using glm::fma;
 		using glm::fmax;
 		using glm::fmin;
+		using glm::forceSimdISA;
 		using glm::four_over_pi;
 		using glm::fract;
 		using glm::frexp;
@@ -2066,6 +2115,13 @@ export namespace glm {
 		using glm::infinitePerspectiveLH;
 		using glm::infinitePerspectiveRH;
 		using glm::intBitsToFloat;
+		using glm::interleave;
+		using glm::intersectFrustumBox;
+		using glm::intersectFrustumBoxes;
+		using glm::intersectFrustumSphere;
+		using glm::intersectFrustumSpheres;
+		using glm::intersectRayTriangles;
+		using glm::intersectRaysTriangle;
 		using glm::inverse;
 		using glm::inversesqrt;
 		using glm::iround;
@@ -2086,6 +2142,8 @@ export namespace glm {
 		using glm::lookAt;
 		using glm::lookAtLH;
 		using glm::lookAtRH;
+		using glm::mat3_cast;
+		using glm::mat4_cast;
 		using glm::matrixCompMult;
 		using glm::max;
 		using glm::min;
@@ -2094,9 +2152,11 @@ export namespace glm {
 		using glm::mix;
 		using glm::mod;
 		using glm::modf;
+		using glm::multiply;
 		using glm::nextFloat;
 		using glm::nextMultiple;
 		using glm::nextPowerOfTwo;
+		using glm::nlerp;
 		using glm::normalize;
 		using glm::notEqual;
 		using glm::not_;
@@ -2114,6 +2174,25 @@ export namespace glm {
 		using glm::orthoRH_ZO;
 		using glm::orthoZO;
 		using glm::outerProduct;
+		using glm::packBatch;
+		using glm::packingComponents;
+		using glm::packingSize;
+		using glm::packing_f2x11_1x10;
+		using glm::packing_f3x9_e1x5;
+		using glm::packing_format;
+		using glm::packing_half2x16;
+		using glm::packing_half4x16;
+		using glm::packing_snorm2x16;
+		using glm::packing_snorm3x10_1x2;
+		using glm::packing_snorm4x16;
+		using glm::packing_snorm4x8;
+		using glm::packing_unorm1x5_1x6_1x5;
+		using glm::packing_unorm2x16;
+		using glm::packing_unorm3x10_1x2;
+		using glm::packing_unorm4x16;
+		using glm::packing_unorm4x8;
+		using glm::perlin;
+		using glm::perlinFbm;
 		using glm::perspective;
 		using glm::perspectiveFov;
 		using glm::perspectiveFovLH;
@@ -2146,6 +2225,8 @@ export namespace glm {
 		using glm::reflect;
 		using glm::refract;
 		using glm::repeat;
+		using glm::rgb2YCoCg;
+		using glm::rgb2YCoCgR;
 		using glm::root_five;
 		using glm::root_half_pi;
 		using glm::root_ln_four;
@@ -2159,8 +2240,17 @@ export namespace glm {
 		using glm::scale;
 		using glm::sec;
 		using glm::sech;
+		using glm::selectedSimdISA;
 		using glm::sign;
+		using glm::simd_isa;
+		using glm::simd_isa_avx;
+		using glm::simd_isa_avx2;
+		using glm::simd_isa_avx512;
+		using glm::simd_isa_default;
+		using glm::simplex;
+		using glm::simplexFbm;
 		using glm::sin;
+		using glm::sincos;
 		using glm::sinh;
 		using glm::slerp;
 		using glm::smoothstep;
@@ -2170,6 +2260,7 @@ export namespace glm {
 		using glm::tanh;
 		using glm::third;
 		using glm::three_over_two_pi;
+		using glm::transform;
 		using glm::translate;
 		using glm::transpose;
 		using glm::trunc;
@@ -2182,6 +2273,7 @@ export namespace glm {
 		using glm::unProject;
 		using glm::unProjectNO;
 		using glm::unProjectZO;
+		using glm::unpackBatch;
 		using glm::uround;
 		using glm::zero;
 	}
@@ -2205,6 +2297,11 @@ export namespace glm {
 		using glm::io::operator<<;
 		using glm::operator<<;
 		using glm::tdualquat;
+		using glm::bvh;
+		using glm::bvh_node;
+		using glm::covariance_accumulator;
+		using glm::aabb;
+		using glm::obb;
 
 #       if !((GLM_COMPILER & GLM_COMPILER_CUDA) || (GLM_COMPILER & GLM_COMPILER_HIP))
 		using glm::to_string;
@@ -2216,6 +2313,7 @@ export namespace glm {
 		using glm::end;
 
 		using glm::abs;
+		using glm::accumulateCovariance;
 		using glm::acos;
 		using glm::acosh;
 		using glm::adjugate;
@@ -2268,7 +2366,11 @@ export namespace glm {
 		using glm::compMul;
 		using glm::compNormalize;
 		using glm::compScale;
+		using glm::computeBounds;
 		using glm::computeCovarianceMatrix;
+		using glm::computeOrientedBounds;
+		using glm::computeSphereBounds;
+		using glm::computeTriangleBounds;
 		using glm::conjugate;
 		using glm::convertD65XYZToD50XYZ;
 		using glm::convertD65XYZToLinearSRGB;
@@ -2283,6 +2385,7 @@ export namespace glm {
 		using glm::cubicEaseInOut;
 		using glm::cubicEaseOut;
 		using glm::decompose;
+		using glm::decomposeAffine;
 		using glm::degrees;
 		using glm::derivedEulerAngleX;
 		using glm::derivedEulerAngleY;
@@ -2375,6 +2478,8 @@ export namespace glm {
 		using glm::fastSqrt;
 		using glm::fastTan;
 		using glm::fclamp;
+		using glm::findEigenvaluesSymReal;
+		using glm::findEigenvaluesSymRealJacobi;
 		using glm::findLSB;
 		using glm::findMSB;
 		using glm::fliplr;
@@ -2415,6 +2520,7 @@ export namespace glm {
 		using glm::intBitsToFloat;
 		using glm::intermediate;
 		using glm::interpolate;
+		using glm::intersectBoxes;
 		using glm::intersectLineSphere;
 		using glm::intersectLineTriangle;
 		using glm::intersectRayPlane;
@@ -2481,6 +2587,8 @@ export namespace glm {
 		using glm::matrixCross3;
 		using glm::matrixCross4;
 		using glm::max;
+		using glm::mergeBounds;
+		using glm::mergeCovariance;
 		using glm::min;
 		using glm::mirrorClamp;
 		using glm::mirrorRepeat;
@@ -2545,6 +2653,7 @@ export namespace glm {
 		using glm::pickMatrix;
 		using glm::pitch;
 		using glm::polar;
+		using glm::polar_decompose;
 		using glm::pow;
 		using glm::pow2;
 		using glm::pow3;
@@ -2571,12 +2680,15 @@ export namespace glm {
 		using glm::quatLookAtRH;
 		using glm::quat_cast;
 		using glm::quat_identity;
+		using glm::queryBox;
+		using glm::querySphere;
 		using glm::quinticEaseIn;
 		using glm::quinticEaseInOut;
 		using glm::quinticEaseOut;
 		using glm::radialGradient;
 		using glm::radians;
 		using glm::recompose;
+		using glm::recomposeAffine;
 		using glm::reflect;
 		using glm::refract;
 		using glm::repeat;
@@ -2625,6 +2737,7 @@ export namespace glm {
 		using glm::sqrt;
 		using glm::squad;
 		using glm::step;
+		using glm::svd_decompose;
 		using glm::tan;
 		using glm::tanh;
 		using glm::third;
@@ -2632,6 +2745,7 @@ export namespace glm {
 		using glm::toMat3;
 		using glm::toMat4;
 		using glm::toQuat;
+		using glm::transformBounds;
 		using glm::translate;
 		using glm::transpose;
 		using glm::triangleNormal;
@@ -10,6 +10,9 @@
 /// Include <glm/gtc/bitfield.hpp> to use the features of this extension.
 ///
 /// Allow to perform bit operations on integer values
+///
+/// With GLM_FORCE_INTRINSICS, bitfieldInterleave and bitfieldDeinterleave use the BMI2 pdep and pext instructions when the compiler targets them, eg with -mbmi2.
+/// The array versions process several values at a time using SSE2 or AVX2.
 
 #include "../detail/setup.hpp"
 
@@ -21,6 +24,7 @@
 #include "../detail/qualifier.hpp"
 #include "../detail/_vectorize.hpp"
 #include "type_precision.hpp"
+#include <cstddef>
 #include <limits>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
@@ -260,6 +264,40 @@ namespace glm
 	/// @see gtc_bitfield
 	GLM_FUNC_DECL uint64 bitfieldInterleave(uint16 x, uint16 y, uint16 z, uint16 w);
 
+	/// Interleaves the bits of the count vectors of in, out[i] being bitfieldInterleave(in[i]).
+	/// Meant for building the Morton codes of large point sets.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleave(u16vec2 const* in, uint32* out, std::size_t count);
+
+	/// Interleaves the bits of the count vectors of in, out[i] being bitfieldInterleave(in[i]).
+	/// Meant for building the Morton codes of large point sets.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleave(u32vec2 const* in, uint64* out, std::size_t count);
+
+	/// Interleaves the bits of the count vectors of in, out[i] being bitfieldInterleave(in[i].x, in[i].y, in[i].z).
+	/// Meant for building the Morton codes of large point sets.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleave(u16vec3 const* in, uint64* out, std::size_t count);
+
+	/// Interleaves the bits of the count vectors of in, out[i] being bitfieldInterleave(in[i].x, in[i].y, in[i].z).
+	/// Only the 21 lowest bits of each component are fully kept.
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DISCARD_DECL void bitfieldInterleave(u32vec3 const* in, uint64* out, std::size_t count);
+
+	/// Deinterleaves the bits of the count values of in, out[i] being bitfieldDeinterleave(in[i]).
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DISCARD_DECL void bitfieldDeinterleave(uint32 const* in, u16vec2* out, std::size_t count);
+
+	/// Deinterleaves the bits of the count values of in, out[i] being bitfieldDeinterleave(in[i]).
+	///
+	/// @see gtc_bitfield
+	GLM_FUNC_DISCARD_DECL void bitfieldDeinterleave(uint64 const* in, u32vec2* out, std::size_t count);
+
 	/// @}
 } //namespace glm
 
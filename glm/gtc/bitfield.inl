@@ -17,6 +17,9 @@ namespace detail
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint16 bitfieldInterleave(glm::uint8 x, glm::uint8 y)
 	{
+#	if GLM_HAS_BMI2
+		return static_cast<glm::uint16>(_pdep_u32(x, 0x5555u) | _pdep_u32(y, 0xAAAAu));
+#	else
 		glm::uint16 REG1(x);
 		glm::uint16 REG2(y);
 
@@ -30,11 +33,15 @@ namespace detail
 		REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint16>(0x5555);
 
 		return REG1 | static_cast<glm::uint16>(REG2 << 1);
+#	endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint16 x, glm::uint16 y)
 	{
+#	if GLM_HAS_BMI2
+		return _pdep_u32(x, 0x55555555u) | _pdep_u32(y, 0xAAAAAAAAu);
+#	else
 		glm::uint32 REG1(x);
 		glm::uint32 REG2(y);
 
@@ -51,11 +58,15 @@ namespace detail
 		REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint32>(0x55555555);
 
 		return REG1 | (REG2 << 1);
+#	endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y)
 	{
+#	if GLM_HAS_BMI2
+		return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+#	else
 		glm::uint64 REG1(x);
 		glm::uint64 REG2(y);
 
@@ -75,11 +86,15 @@ namespace detail
 		REG2 = ((REG2 <<  1) | REG2) & static_cast<glm::uint64>(0x5555555555555555ull);
 
 		return REG1 | (REG2 << 1);
+#	endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z)
 	{
+#	if GLM_HAS_BMI2
+		return _pdep_u32(x, 0x49249249u) | _pdep_u32(y, 0x92492492u) | _pdep_u32(z, 0x24924924u);
+#	else
 		glm::uint32 REG1(x);
 		glm::uint32 REG2(y);
 		glm::uint32 REG3(z);
@@ -101,11 +116,15 @@ namespace detail
 		REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint32>(0x49249249u);
 
 		return REG1 | (REG2 << 1) | (REG3 << 2);
+#	endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z)
 	{
+#	if GLM_HAS_BMI2
+		return _pdep_u64(x, 0x9249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#	else
 		glm::uint64 REG1(x);
 		glm::uint64 REG2(y);
 		glm::uint64 REG3(z);
@@ -131,11 +150,16 @@ namespace detail
 		REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint64>(0x9249249249249249ull);
 
 		return REG1 | (REG2 << 1) | (REG3 << 2);
+#	endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint32 x, glm::uint32 y, glm::uint32 z)
 	{
+#	if GLM_HAS_BMI2
+		// Only the 22, 21 and 21 lowest bits of x, y and z fit in the result
+		return _pdep_u64(x, 0x9249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull) | _pdep_u64(z, 0x4924924924924924ull);
+#	else
 		glm::uint64 REG1(x);
 		glm::uint64 REG2(y);
 		glm::uint64 REG3(z);
@@ -161,11 +185,15 @@ namespace detail
 		REG3 = ((REG3 <<  2) | REG3) & static_cast<glm::uint64>(0x9249249249249249ull);
 
 		return REG1 | (REG2 << 1) | (REG3 << 2);
+#	endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint32 bitfieldInterleave(glm::uint8 x, glm::uint8 y, glm::uint8 z, glm::uint8 w)
 	{
+#	if GLM_HAS_BMI2
+		return _pdep_u32(x, 0x11111111u) | _pdep_u32(y, 0x22222222u) | _pdep_u32(z, 0x44444444u) | _pdep_u32(w, 0x88888888u);
+#	else
 		glm::uint32 REG1(x);
 		glm::uint32 REG2(y);
 		glm::uint32 REG3(z);
@@ -187,11 +215,15 @@ namespace detail
 		REG4 = ((REG4 <<  3) | REG4) & static_cast<glm::uint32>(0x11111111u);
 
 		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+#	endif
 	}
 
 	template<>
 	GLM_FUNC_QUALIFIER glm::uint64 bitfieldInterleave(glm::uint16 x, glm::uint16 y, glm::uint16 z, glm::uint16 w)
 	{
+#	if GLM_HAS_BMI2
+		return _pdep_u64(x, 0x1111111111111111ull) | _pdep_u64(y, 0x2222222222222222ull) | _pdep_u64(z, 0x4444444444444444ull) | _pdep_u64(w, 0x8888888888888888ull);
+#	else
 		glm::uint64 REG1(x);
 		glm::uint64 REG2(y);
 		glm::uint64 REG3(z);
@@ -218,6 +250,7 @@ namespace detail
 		REG4 = ((REG4 <<  3) | REG4) & static_cast<glm::uint64>(0x1111111111111111ull);
 
 		return REG1 | (REG2 << 1) | (REG3 << 2) | (REG4 << 3);
+#	endif
 	}
 }//namespace detail
 
@@ -339,6 +372,9 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER u8vec2 bitfieldDeinterleave(glm::uint16 x)
 	{
+#	if GLM_HAS_BMI2
+		return glm::u8vec2(_pext_u32(x, 0x5555u), _pext_u32(x, 0xAAAAu));
+#	else
 		uint16 REG1(x);
 		uint16 REG2(x >>= 1);
 
@@ -358,6 +394,7 @@ namespace detail
 		REG2 = ((REG2 >> 8) | REG2) & static_cast<uint16>(0xFFFF);
 
 		return glm::u8vec2(REG1, REG2);
+#	endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int16 x, int16 y)
@@ -393,6 +430,9 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::u16vec2 bitfieldDeinterleave(glm::uint32 x)
 	{
+#	if GLM_HAS_BMI2
+		return glm::u16vec2(_pext_u32(x, 0x55555555u), _pext_u32(x, 0xAAAAAAAAu));
+#	else
 		glm::uint32 REG1(x);
 		glm::uint32 REG2(x >>= 1);
 
@@ -412,6 +452,7 @@ namespace detail
 		REG2 = ((REG2 >> 8) | REG2) & static_cast<glm::uint32>(0x0000FFFF);
 
 		return glm::u16vec2(REG1, REG2);
+#	endif
 	}
 
 	GLM_FUNC_QUALIFIER int64 bitfieldInterleave(int32 x, int32 y)
@@ -447,6 +488,9 @@ namespace detail
 
 	GLM_FUNC_QUALIFIER glm::u32vec2 bitfieldDeinterleave(glm::uint64 x)
 	{
+#	if GLM_HAS_BMI2
+		return glm::u32vec2(_pext_u64(x, 0x5555555555555555ull), _pext_u64(x, 0xAAAAAAAAAAAAAAAAull));
+#	else
 		glm::uint64 REG1(x);
 		glm::uint64 REG2(x >>= 1);
 
@@ -469,6 +513,7 @@ namespace detail
 		REG2 = ((REG2 >> 16) | REG2) & static_cast<glm::uint64>(0x00000000FFFFFFFFull);
 
 		return glm::u32vec2(REG1, REG2);
+#	endif
 	}
 
 	GLM_FUNC_QUALIFIER int32 bitfieldInterleave(int8 x, int8 y, int8 z)
@@ -633,3 +678,85 @@ namespace detail
 		return detail::bitfieldInterleave<uint16, uint64>(v.x, v.y, v.z, v.w);
 	}
 }//namespace glm
+
+namespace glm{
+namespace detail
+{
+	template<bool UseSimd>
+	struct compute_bitfield_interleave_array
+	{
+		GLM_FUNC_QUALIFIER static void interleave(u16vec2 const* in, uint32* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = bitfieldInterleave<uint16, uint32>(in[i].x, in[i].y);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(u32vec2 const* in, uint64* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = bitfieldInterleave<uint32, uint64>(in[i].x, in[i].y);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(u16vec3 const* in, uint64* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = bitfieldInterleave<uint16, uint64>(in[i].x, in[i].y, in[i].z);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(u32vec3 const* in, uint64* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = bitfieldInterleave<uint32, uint64>(in[i].x, in[i].y, in[i].z);
+		}
+
+		GLM_FUNC_QUALIFIER static void deinterleave(uint32 const* in, u16vec2* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = bitfieldDeinterleave(in[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void deinterleave(uint64 const* in, u32vec2* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = bitfieldDeinterleave(in[i]);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "bitfield_simd.inl"
+#endif
+
+namespace glm
+{
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(u16vec2 const* in, uint32* out, std::size_t count)
+	{
+		detail::compute_bitfield_interleave_array<GLM_CONFIG_SIMD == GLM_ENABLE>::interleave(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(u32vec2 const* in, uint64* out, std::size_t count)
+	{
+		detail::compute_bitfield_interleave_array<GLM_CONFIG_SIMD == GLM_ENABLE>::interleave(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(u16vec3 const* in, uint64* out, std::size_t count)
+	{
+		detail::compute_bitfield_interleave_array<GLM_CONFIG_SIMD == GLM_ENABLE>::interleave(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldInterleave(u32vec3 const* in, uint64* out, std::size_t count)
+	{
+		detail::compute_bitfield_interleave_array<GLM_CONFIG_SIMD == GLM_ENABLE>::interleave(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint32 const* in, u16vec2* out, std::size_t count)
+	{
+		detail::compute_bitfield_interleave_array<GLM_CONFIG_SIMD == GLM_ENABLE>::deinterleave(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void bitfieldDeinterleave(uint64 const* in, u32vec2* out, std::size_t count)
+	{
+		detail::compute_bitfield_interleave_array<GLM_CONFIG_SIMD == GLM_ENABLE>::deinterleave(in, out, count);
+	}
+}//namespace glm
@@ -0,0 +1,212 @@
+/// @ref gtc_bitfield
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// With BMI2, pdep and pext are faster than the SIMD kernels for 64-bit codes, one code taking a pdep per component.
+	template<>
+	struct compute_bitfield_interleave_array<true>
+	{
+		GLM_FUNC_QUALIFIER static void interleave(u16vec2 const* in, uint32* out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_u32vec8 const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), glm_u32vec8_interleave_16(v));
+				}
+#			else
+				for(; i + 4 <= count; i += 4)
+				{
+					glm_u32vec4 const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), glm_u32vec4_interleave_16(v));
+				}
+#			endif
+			compute_bitfield_interleave_array<false>::interleave(in + i, out + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void deinterleave(uint32 const* in, u16vec2* out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_u32vec8 const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), glm_u32vec8_deinterleave_16(v));
+				}
+#			else
+				for(; i + 4 <= count; i += 4)
+				{
+					glm_u32vec4 const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), glm_u32vec4_deinterleave_16(v));
+				}
+#			endif
+			compute_bitfield_interleave_array<false>::deinterleave(in + i, out + i, count - i);
+		}
+
+#		if GLM_HAS_BMI2
+		GLM_FUNC_QUALIFIER static void interleave(u32vec2 const* in, uint64* out, std::size_t count)
+		{
+			compute_bitfield_interleave_array<false>::interleave(in, out, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(u16vec3 const* in, uint64* out, std::size_t count)
+		{
+			compute_bitfield_interleave_array<false>::interleave(in, out, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(u32vec3 const* in, uint64* out, std::size_t count)
+		{
+			compute_bitfield_interleave_array<false>::interleave(in, out, count);
+		}
+
+		GLM_FUNC_QUALIFIER static void deinterleave(uint64 const* in, u32vec2* out, std::size_t count)
+		{
+			compute_bitfield_interleave_array<false>::deinterleave(in, out, count);
+		}
+#		else
+		GLM_FUNC_QUALIFIER static void interleave(u32vec2 const* in, uint64* out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 4 <= count; i += 4)
+				{
+					glm_u64vec4 const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), glm_u64vec4_interleave_32(v));
+				}
+#			else
+				for(; i + 2 <= count; i += 2)
+				{
+					glm_u64vec2 const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), glm_u64vec2_interleave_32(v));
+				}
+#			endif
+			compute_bitfield_interleave_array<false>::interleave(in + i, out + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void deinterleave(uint64 const* in, u32vec2* out, std::size_t count)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 4 <= count; i += 4)
+				{
+					glm_u64vec4 const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(in + i));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), glm_u64vec4_deinterleave_32(v));
+				}
+#			else
+				for(; i + 2 <= count; i += 2)
+				{
+					glm_u64vec2 const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), glm_u64vec2_deinterleave_32(v));
+				}
+#			endif
+			compute_bitfield_interleave_array<false>::deinterleave(in + i, out + i, count - i);
+		}
+
+		// Interleaves 4 vectors of 3 components, each component being duplicated in both halves of its 64-bit lane
+		GLM_FUNC_QUALIFIER static void interleave3(glm_u64vec2 x01, glm_u64vec2 y01, glm_u64vec2 z01, glm_u64vec2 x23, glm_u64vec2 y23, glm_u64vec2 z23, uint64* out)
+		{
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				glm_u64vec4 const x = _mm256_inserti128_si256(_mm256_castsi128_si256(x01), x23, 1);
+				glm_u64vec4 const y = _mm256_inserti128_si256(_mm256_castsi128_si256(y01), y23, 1);
+				glm_u64vec4 const z = _mm256_inserti128_si256(_mm256_castsi128_si256(z01), z23, 1);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out), glm_u64vec4_interleave_3(x, y, z));
+#			else
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out), glm_u64vec2_interleave_3(x01, y01, z01));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2), glm_u64vec2_interleave_3(x23, y23, z23));
+#			endif
+		}
+
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE && defined(GLM_FORCE_DEFAULT_ALIGNED_GENTYPES)
+		// Interleaves 4 padded vectors of 3 components stored in a = x0 y0 z0 _, b = x1 y1 z1 _, c = x2 y2 z2 _ and d = x3 y3 z3 _
+		GLM_FUNC_QUALIFIER static void interleave3(glm_u32vec4 a, glm_u32vec4 b, glm_u32vec4 c, glm_u32vec4 d, uint64* out)
+		{
+			glm_vec4 const fa = _mm_castsi128_ps(a);
+			glm_vec4 const fb = _mm_castsi128_ps(b);
+			glm_vec4 const fc = _mm_castsi128_ps(c);
+			glm_vec4 const fd = _mm_castsi128_ps(d);
+
+			interleave3(
+				_mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(0, 0, 0, 0))),
+				_mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(1, 1, 1, 1))),
+				_mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 2, 2, 2))),
+				_mm_castps_si128(_mm_shuffle_ps(fc, fd, _MM_SHUFFLE(0, 0, 0, 0))),
+				_mm_castps_si128(_mm_shuffle_ps(fc, fd, _MM_SHUFFLE(1, 1, 1, 1))),
+				_mm_castps_si128(_mm_shuffle_ps(fc, fd, _MM_SHUFFLE(2, 2, 2, 2))),
+				out);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(u16vec3 const* in, uint64* out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				// The 4 vectors are padded to 32 bytes
+				glm_u32vec4 const v0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+				glm_u32vec4 const v1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i + 2));
+				glm_u32vec4 const Zero = _mm_setzero_si128();
+				interleave3(_mm_unpacklo_epi16(v0, Zero), _mm_unpackhi_epi16(v0, Zero), _mm_unpacklo_epi16(v1, Zero), _mm_unpackhi_epi16(v1, Zero), out + i);
+			}
+			compute_bitfield_interleave_array<false>::interleave(in + i, out + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(u32vec3 const* in, uint64* out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_u32vec4 const* const p = reinterpret_cast<glm_u32vec4 const*>(in + i);
+				interleave3(_mm_loadu_si128(p), _mm_loadu_si128(p + 1), _mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3), out + i);
+			}
+			compute_bitfield_interleave_array<false>::interleave(in + i, out + i, count - i);
+		}
+#		else
+		// Interleaves 4 vectors of 3 components stored in a = x0 y0 z0 x1, b = y1 z1 x2 y2 and c = z2 x3 y3 z3
+		GLM_FUNC_QUALIFIER static void interleave3(glm_u32vec4 a, glm_u32vec4 b, glm_u32vec4 c, uint64* out)
+		{
+			glm_vec4 const fa = _mm_castsi128_ps(a);
+			glm_vec4 const fb = _mm_castsi128_ps(b);
+			glm_vec4 const fc = _mm_castsi128_ps(c);
+
+			interleave3(
+				_mm_castps_si128(_mm_shuffle_ps(fa, fa, _MM_SHUFFLE(3, 3, 0, 0))),
+				_mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(0, 0, 1, 1))),
+				_mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(1, 1, 2, 2))),
+				_mm_castps_si128(_mm_shuffle_ps(fb, fc, _MM_SHUFFLE(1, 1, 2, 2))),
+				_mm_castps_si128(_mm_shuffle_ps(fb, fc, _MM_SHUFFLE(2, 2, 3, 3))),
+				_mm_castps_si128(_mm_shuffle_ps(fc, fc, _MM_SHUFFLE(3, 3, 0, 0))),
+				out);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(u16vec3 const* in, uint64* out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				// The 4 vectors are 24 bytes
+				glm_u32vec4 const v0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+				glm_u32vec4 const v1 = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(reinterpret_cast<char const*>(in + i) + 16));
+				glm_u32vec4 const Zero = _mm_setzero_si128();
+				interleave3(_mm_unpacklo_epi16(v0, Zero), _mm_unpackhi_epi16(v0, Zero), _mm_unpacklo_epi16(v1, Zero), out + i);
+			}
+			compute_bitfield_interleave_array<false>::interleave(in + i, out + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void interleave(u32vec3 const* in, uint64* out, std::size_t count)
+		{
+			std::size_t i = 0;
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_u32vec4 const* const p = reinterpret_cast<glm_u32vec4 const*>(in + i);
+				interleave3(_mm_loadu_si128(p), _mm_loadu_si128(p + 1), _mm_loadu_si128(p + 2), out + i);
+			}
+			compute_bitfield_interleave_array<false>::interleave(in + i, out + i, count - i);
+		}
+#		endif
+#		endif//GLM_HAS_BMI2
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
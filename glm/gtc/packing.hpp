@@ -16,6 +16,11 @@
 // Dependency:
 #include "type_precision.hpp"
 #include "../ext/vector_packing.hpp"
+#include <cstddef>
+
+#if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+#	include "../ext/simd_dispatch.hpp"
+#endif
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_packing extension included")
@@ -512,6 +517,22 @@ namespace glm
 	template<length_t L, qualifier Q>
 	GLM_FUNC_DECL vec<L, float, Q> unpackHalf(vec<L, uint16, Q> const& p);
 
+	/// Converts count floating-point values to the 16-bit floating-point representation found in the OpenGL Specification.
+	/// Each value is converted like packHalf1x16, using F16C when available.
+	///
+	/// @see gtc_packing
+	/// @see uint16 packHalf1x16(float const& v)
+	/// @see void unpackHalf(uint16 const* in, float* out, std::size_t count)
+	GLM_FUNC_DISCARD_DECL void packHalf(float const* in, uint16* out, std::size_t count);
+
+	/// Converts count 16-bit floating-point values to 32-bit floating-point values.
+	/// Each value is converted like unpackHalf1x16, using F16C when available.
+	///
+	/// @see gtc_packing
+	/// @see float unpackHalf1x16(uint16 const& v)
+	/// @see void packHalf(float const* in, uint16* out, std::size_t count)
+	GLM_FUNC_DISCARD_DECL void unpackHalf(uint16 const* in, float* out, std::size_t count);
+
 	/// Convert each component of the normalized floating-point vector into unsigned integer values.
 	///
 	/// @see gtc_packing
@@ -364,7 +364,38 @@ namespace detail
 			return vec<4, float, Q>(detail::toFloat32(Unpack.x), detail::toFloat32(Unpack.y), detail::toFloat32(Unpack.z), detail::toFloat32(Unpack.w));
 		}
 	};
+
+	template<bool UseSimd>
+	struct compute_half_array
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* in, uint16* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				int16 const Topack(detail::toFloat16(in[i]));
+				memcpy(out + i, &Topack, sizeof(uint16));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint16 const* in, float* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				int16 Unpack = 0;
+				memcpy(&Unpack, in + i, sizeof(Unpack));
+				out[i] = detail::toFloat32(Unpack);
+			}
+		}
+	};
 }//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "packing_simd.inl"
+#endif
+
+namespace glm
+{
 
 	GLM_FUNC_QUALIFIER uint8 packUnorm1x8(float v)
 	{
@@ -502,6 +533,16 @@ namespace detail
 		return detail::toFloat32(Unpack);
 	}
 
+	GLM_FUNC_QUALIFIER void packHalf(float const* in, uint16* out, std::size_t count)
+	{
+		detail::compute_half_array<GLM_CONFIG_SIMD == GLM_ENABLE>::pack(in, out, count);
+	}
+
+	GLM_FUNC_QUALIFIER void unpackHalf(uint16 const* in, float* out, std::size_t count)
+	{
+		detail::compute_half_array<GLM_CONFIG_SIMD == GLM_ENABLE>::unpack(in, out, count);
+	}
+
 	GLM_FUNC_QUALIFIER uint64 packHalf4x16(glm::vec4 const& v)
 	{
 		i16vec4 const Unpack(
@@ -0,0 +1,36 @@
+/// @ref gtc_packing
+
+#include "../simd/packing.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct compute_half_array<true>
+	{
+		GLM_FUNC_QUALIFIER static void pack(float const* in, uint16* out, std::size_t count)
+		{
+#			if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+				simd_dispatch().pack_half_array(in, out, count);
+#			elif GLM_HAS_F16C
+				glm_pack_half_array_f16c(in, out, count);
+#			else
+				glm_pack_half_array(in, out, count);
+#			endif
+		}
+
+		GLM_FUNC_QUALIFIER static void unpack(uint16 const* in, float* out, std::size_t count)
+		{
+#			if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+				simd_dispatch().unpack_half_array(in, out, count);
+#			elif GLM_HAS_F16C
+				glm_unpack_half_array_f16c(in, out, count);
+#			else
+				glm_unpack_half_array(in, out, count);
+#			endif
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
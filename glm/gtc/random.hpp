@@ -10,6 +10,19 @@
 /// Include <glm/gtc/random.hpp> to use the features of this extension.
 ///
 /// Generate random number from various distribution methods.
+///
+/// The functions without an engine argument draw from randomEngine(), a pcg32 engine owned by the calling thread,
+/// so that threads don't contend on a shared state. Each thread starts on its own stream, numbered
+/// in the order in which the threads first use it; randomSeed reseeds the engine of the calling thread.
+/// std::srand has no effect on these functions.
+///
+/// Each function also has an overload taking the engine to draw from, which may be pcg32, xoshiro128x8
+/// or any standard engine producing 32 bit values, eg std::mt19937.
+///
+/// The array overloads generate whole arrays of samples from a xoshiro128x8, or map arrays of points uniformly
+/// distributed in [0, 1)^n, such as the low discrepancy sequences haltonSequence, sobolSequence and r2Sequence,
+/// to the distributions. The mappings don't use rejection, float samples are computed 4 at a time with SSE2
+/// when available, using polynomial approximations of sin, cos and log accurate to a few ULP.
 
 #pragma once
 
@@ -17,6 +30,7 @@
 #include "../ext/scalar_int_sized.hpp"
 #include "../ext/scalar_uint_sized.hpp"
 #include "../detail/qualifier.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	pragma message("GLM: GLM_GTC_random extension included")
@@ -27,6 +41,92 @@ namespace glm
 	/// @addtogroup gtc_random
 	/// @{
 
+	/// PCG32 random engine (XSH RR 64/32 variant) of Melissa O'Neill, https://www.pcg-random.org
+	///
+	/// 64 bits of state, a period of 2^64 and 2^63 distinct streams selected at seeding.
+	/// Parallel tasks get reproducible, independent sequences by using the same seed with their own stream,
+	/// or by splitting one stream with discard, which jumps ahead in O(log n) steps.
+	/// Satisfies the requirements of UniformRandomBitGenerator.
+	///
+	/// @see gtc_random
+	struct pcg32
+	{
+		typedef uint32 result_type;
+
+		/// Engine seeded with the default seed on stream 0
+		GLM_FUNC_DISCARD_DECL pcg32();
+
+		GLM_FUNC_DISCARD_DECL explicit pcg32(uint64 Seed, uint64 Stream = 0);
+
+		GLM_FUNC_DISCARD_DECL void seed(uint64 Seed, uint64 Stream = 0);
+
+		GLM_FUNC_DECL static constexpr result_type min() {return 0;}
+		GLM_FUNC_DECL static constexpr result_type max() {return 0xFFFFFFFFu;}
+
+		/// Returns the next value of the sequence
+		GLM_FUNC_DECL result_type operator()();
+
+		/// Advances the sequence by Count values
+		GLM_FUNC_DISCARD_DECL void discard(uint64 Count);
+
+		GLM_FUNC_DECL bool operator==(pcg32 const& Engine) const;
+		GLM_FUNC_DECL bool operator!=(pcg32 const& Engine) const;
+
+	private:
+		uint64 State;
+		uint64 Increment;
+	};
+
+	/// 8 interleaved xoshiro128++ random engines of David Blackman and Sebastiano Vigna, https://prng.di.unimi.it
+	///
+	/// The value i of the sequence is produced by the lane i % 8, lanes being 2^64 values apart in the xoshiro128++ sequence.
+	/// The lanes are advanced together, 8 at a time using SSE2 or AVX2 when available, by generate and the
+	/// array overloads of the random functions. The sequence doesn't depend on the instruction set.
+	/// Distinct streams are seeded from splitmix64 hashes of the seed and the stream.
+	/// Satisfies the requirements of UniformRandomBitGenerator.
+	///
+	/// @see gtc_random
+	struct xoshiro128x8
+	{
+		typedef uint32 result_type;
+
+		/// Engine seeded with the default seed on stream 0
+		GLM_FUNC_DISCARD_DECL xoshiro128x8();
+
+		GLM_FUNC_DISCARD_DECL explicit xoshiro128x8(uint64 Seed, uint64 Stream = 0);
+
+		GLM_FUNC_DISCARD_DECL void seed(uint64 Seed, uint64 Stream = 0);
+
+		GLM_FUNC_DECL static constexpr result_type min() {return 0;}
+		GLM_FUNC_DECL static constexpr result_type max() {return 0xFFFFFFFFu;}
+
+		/// Returns the next value of the sequence
+		GLM_FUNC_DECL result_type operator()();
+
+		/// Writes the next Count values of the sequence to Out, like Count calls to operator()
+		GLM_FUNC_DISCARD_DECL void generate(uint32* Out, std::size_t Count);
+
+		GLM_FUNC_DECL bool operator==(xoshiro128x8 const& Engine) const;
+		GLM_FUNC_DECL bool operator!=(xoshiro128x8 const& Engine) const;
+
+	private:
+		// Word w of the state of lane k is State[w][k]
+		uint32 State[4][8];
+		// Values produced by the last step of the lanes, Block[Next] being the next one returned
+		uint32 Block[8];
+		std::size_t Next;
+	};
+
+	/// Returns the random engine of the calling thread, used by the functions without an engine argument
+	///
+	/// @see gtc_random
+	GLM_FUNC_DECL pcg32& randomEngine();
+
+	/// Seeds the random engine of the calling thread
+	///
+	/// @see gtc_random
+	GLM_FUNC_DISCARD_DECL void randomSeed(uint64 Seed, uint64 Stream = 0);
+
 	/// Generate random numbers in the interval [Min, Max], according a linear distribution
 	///
 	/// @param Min Minimum value included in the sampling
@@ -36,6 +136,16 @@ namespace glm
 	template<typename genType>
 	GLM_FUNC_DECL genType linearRand(genType Min, genType Max);
 
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution
+	///
+	/// @param Min Minimum value included in the sampling
+	/// @param Max Maximum value included in the sampling
+	/// @param Engine Random engine producing 32 bit values
+	/// @tparam genType Value type. Currently supported: float or double scalars.
+	/// @see gtc_random
+	template<typename genType, typename engine>
+	GLM_FUNC_DECL genType linearRand(genType Min, genType Max, engine& Engine);
+
 	/// Generate random numbers in the interval [Min, Max], according a linear distribution
 	///
 	/// @param Min Minimum value included in the sampling
@@ -46,36 +156,178 @@ namespace glm
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_DECL vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max);
 
+	/// Generate random numbers in the interval [Min, Max], according a linear distribution
+	///
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q, typename engine>
+	GLM_FUNC_DECL vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, engine& Engine);
+
+	/// Fills Out with Count random vectors in the interval [Min, Max), according a linear distribution
+	/// Each component is made of the 24 or 53 most significant bits of one or two values of the engine.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, vec<L, T, Q>* Out, std::size_t Count, xoshiro128x8& Engine);
+
 	/// Generate random numbers in the interval [Min, Max], according a gaussian distribution
 	///
 	/// @see gtc_random
 	template<typename genType>
 	GLM_FUNC_DECL genType gaussRand(genType Mean, genType Deviation);
 
+	/// Generate random numbers in the interval [Min, Max], according a gaussian distribution
+	///
+	/// @see gtc_random
+	template<typename genType, typename engine>
+	GLM_FUNC_DECL genType gaussRand(genType Mean, genType Deviation, engine& Engine);
+
+	/// Generate random numbers in the interval [Min, Max], according a gaussian distribution
+	///
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q, typename engine>
+	GLM_FUNC_DECL vec<L, T, Q> gaussRand(vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, engine& Engine);
+
+	/// Fills Out with Count random numbers of the gaussian distribution of gaussRand(Mean, Deviation),
+	/// generated in pairs with the Box-Muller transform.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<typename T>
+	GLM_FUNC_DISCARD_DECL void gaussRand(T Mean, T Deviation, T* Out, std::size_t Count, xoshiro128x8& Engine);
+
+	/// Maps Count points uniformly distributed in [0, 1)^2 to pairs of independent random numbers of the gaussian
+	/// distribution of gaussRand(Mean, Deviation) with the Box-Muller transform.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void gaussRand(T Mean, T Deviation, vec<2, T, Q> const* Uniform, vec<2, T, Q>* Out, std::size_t Count);
+
 	/// Generate a random 2D vector which coordinates are regularly distributed on a circle of a given radius
 	///
 	/// @see gtc_random
 	template<typename T>
 	GLM_FUNC_DECL vec<2, T, defaultp> circularRand(T Radius);
 
+	/// Generate a random 2D vector which coordinates are regularly distributed on a circle of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename engine>
+	GLM_FUNC_DECL vec<2, T, defaultp> circularRand(T Radius, engine& Engine);
+
+	/// Fills Out with Count random 2D vectors regularly distributed on a circle of a given radius
+	///
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void circularRand(T Radius, vec<2, T, Q>* Out, std::size_t Count, xoshiro128x8& Engine);
+
+	/// Maps Count numbers uniformly distributed in [0, 1) to points of a circle of a given radius,
+	/// Uniform[i] being the angle of Out[i] in turns.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void circularRand(T Radius, T const* Uniform, vec<2, T, Q>* Out, std::size_t Count);
+
 	/// Generate a random 3D vector which coordinates are regularly distributed on a sphere of a given radius
 	///
 	/// @see gtc_random
 	template<typename T>
 	GLM_FUNC_DECL vec<3, T, defaultp> sphericalRand(T Radius);
 
+	/// Generate a random 3D vector which coordinates are regularly distributed on a sphere of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename engine>
+	GLM_FUNC_DECL vec<3, T, defaultp> sphericalRand(T Radius, engine& Engine);
+
+	/// Fills Out with Count random 3D vectors regularly distributed on a sphere of a given radius
+	///
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void sphericalRand(T Radius, vec<3, T, Q>* Out, std::size_t Count, xoshiro128x8& Engine);
+
+	/// Maps Count points uniformly distributed in [0, 1)^2 to points of a sphere of a given radius.
+	/// Uniform[i].x gives the z coordinate, 1 - 2 * x, and Uniform[i].y the angle around the z axis in turns,
+	/// an area preserving mapping that keeps the stratification of low discrepancy sequences.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void sphericalRand(T Radius, vec<2, T, Q> const* Uniform, vec<3, T, Q>* Out, std::size_t Count);
+
 	/// Generate a random 2D vector which coordinates are regularly distributed within the area of a disk of a given radius
 	///
 	/// @see gtc_random
 	template<typename T>
 	GLM_FUNC_DECL vec<2, T, defaultp> diskRand(T Radius);
 
+	/// Generate a random 2D vector which coordinates are regularly distributed within the area of a disk of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename engine>
+	GLM_FUNC_DECL vec<2, T, defaultp> diskRand(T Radius, engine& Engine);
+
+	/// Fills Out with Count random 2D vectors regularly distributed within the area of a disk of a given radius
+	///
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void diskRand(T Radius, vec<2, T, Q>* Out, std::size_t Count, xoshiro128x8& Engine);
+
+	/// Maps Count points uniformly distributed in [0, 1)^2 to points within the area of a disk of a given radius.
+	/// Out[i] is at the distance Radius * sqrt(Uniform[i].x) of the center, Uniform[i].y giving its angle in turns.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void diskRand(T Radius, vec<2, T, Q> const* Uniform, vec<2, T, Q>* Out, std::size_t Count);
+
 	/// Generate a random 3D vector which coordinates are regularly distributed within the volume of a ball of a given radius
 	///
 	/// @see gtc_random
 	template<typename T>
 	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius);
 
+	/// Generate a random 3D vector which coordinates are regularly distributed within the volume of a ball of a given radius
+	///
+	/// @see gtc_random
+	template<typename T, typename engine>
+	GLM_FUNC_DECL vec<3, T, defaultp> ballRand(T Radius, engine& Engine);
+
+	/// Writes the points First to First + Count - 1 of the Halton sequence to Out, the components
+	/// being the radical inverses of the index in the bases 2, 3, 5 and 7. The point 0 is the origin.
+	///
+	/// @tparam L Integer between 1 and 4 inclusive that qualify the dimension of the points
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void haltonSequence(std::size_t First, vec<L, T, Q>* Out, std::size_t Count);
+
+	/// Writes the points First to First + Count - 1 of the Sobol sequence to Out, in Gray code order,
+	/// using the direction numbers of Joe and Kuo. The point 0 is the origin. Each block of 2^k points starting
+	/// at a multiple of 2^k has one point in each of the 2^k boxes of an elementary partition of [0, 1)^2
+	/// for the first two dimensions.
+	///
+	/// @tparam L Integer between 1 and 4 inclusive that qualify the dimension of the points
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void sobolSequence(std::size_t First, vec<L, T, Q>* Out, std::size_t Count);
+
+	/// Writes the points First to First + Count - 1 of the R2 sequence of Martin Roberts, generalized to L dimensions, to Out.
+	/// The point n is fract(0.5 + n * a) where the components of a are the powers 1 to L of the inverse of the
+	/// unique positive root g of x^(L+1) = x + 1. The fractions are computed in 64 bit fixed point.
+	///
+	/// @tparam L Integer between 1 and 4 inclusive that qualify the dimension of the points
+	/// @tparam T Floating-point scalar types
+	/// @see gtc_random
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void r2Sequence(std::size_t First, vec<L, T, Q>* Out, std::size_t Count);
+
 	/// @}
 }//namespace glm
 
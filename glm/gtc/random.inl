@@ -2,228 +2,618 @@
 #include "../exponential.hpp"
 #include "../trigonometric.hpp"
 #include "../detail/type_vec1.hpp"
-#include <cstdlib>
-#include <ctime>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 
 namespace glm{
 namespace detail
 {
-	template <length_t L, typename T, qualifier Q>
-	struct compute_rand
+	GLM_FUNC_QUALIFIER uint64 splitmix64(uint64& x)
 	{
-		GLM_FUNC_QUALIFIER static vec<L, T, Q> call();
-	};
+		uint64 z = (x += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
 
-	template <qualifier P>
-	struct compute_rand<1, uint8, P>
+	GLM_FUNC_QUALIFIER uint32 xoshiro128pp_rotl(uint32 x, int k)
 	{
-		GLM_FUNC_QUALIFIER static vec<1, uint8, P> call()
-		{
-			return vec<1, uint8, P>(
-				static_cast<uint8>(std::rand() % std::numeric_limits<uint8>::max()));
-		}
-	};
+		return (x << k) | (x >> (32 - k));
+	}
 
-	template <qualifier P>
-	struct compute_rand<2, uint8, P>
+	// Advances the lane k of State and returns its next value
+	GLM_FUNC_QUALIFIER uint32 xoshiro128pp_next(uint32 State[4][8], std::size_t k)
 	{
-		GLM_FUNC_QUALIFIER static vec<2, uint8, P> call()
+		uint32 const Result = xoshiro128pp_rotl(State[0][k] + State[3][k], 7) + State[0][k];
+		uint32 const t = State[1][k] << 9;
+		State[2][k] ^= State[0][k];
+		State[3][k] ^= State[1][k];
+		State[1][k] ^= State[2][k];
+		State[0][k] ^= State[3][k];
+		State[2][k] ^= t;
+		State[3][k] = xoshiro128pp_rotl(State[3][k], 11);
+		return Result;
+	}
+
+	// Writes Blocks steps of the 8 lanes to Out, the values of a step being stored in lane order
+	template<bool UseSimd>
+	struct compute_xoshiro128x8
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 State[4][8], uint32* Out, std::size_t Blocks)
 		{
-			return vec<2, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
+			for(std::size_t b = 0; b < Blocks; ++b)
+			for(std::size_t k = 0; k < 8; ++k)
+				Out[b * 8 + k] = xoshiro128pp_next(State, k);
 		}
 	};
 
-	template <qualifier P>
-	struct compute_rand<3, uint8, P>
+	template<typename engine>
+	GLM_FUNC_QUALIFIER void check_random_engine()
 	{
-		GLM_FUNC_QUALIFIER static vec<3, uint8, P> call()
-		{
-			return vec<3, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
-		}
+		static_assert(engine::min() == 0 && engine::max() == 0xFFFFFFFFu, "GLM random functions require an engine producing 32 bit values");
+	}
+
+	GLM_FUNC_QUALIFIER uint64 next_random_stream()
+	{
+		static std::atomic<uint64> Stream(0);
+		return Stream.fetch_add(1);
+	}
+
+	template <length_t L, typename T, qualifier Q>
+	struct compute_rand
+	{
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(engine& Engine);
 	};
 
-	template <qualifier P>
-	struct compute_rand<4, uint8, P>
+	template <length_t L, qualifier Q>
+	struct compute_rand<L, uint8, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<4, uint8, P> call()
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint8, Q> call(engine& Engine)
 		{
-			return vec<4, uint8, P>(
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max(),
-				std::rand() % std::numeric_limits<uint8>::max());
+			vec<L, uint8, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = static_cast<uint8>(static_cast<uint32>(Engine()) >> 24);
+			return Result;
 		}
 	};
 
 	template <length_t L, qualifier Q>
 	struct compute_rand<L, uint16, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> call()
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> call(engine& Engine)
 		{
-			return
-				(vec<L, uint16, Q>(compute_rand<L, uint8, Q>::call()) << static_cast<uint16>(8)) |
-				(vec<L, uint16, Q>(compute_rand<L, uint8, Q>::call()));
+			vec<L, uint16, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = static_cast<uint16>(static_cast<uint32>(Engine()) >> 16);
+			return Result;
 		}
 	};
 
 	template <length_t L, qualifier Q>
 	struct compute_rand<L, uint32, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint32, Q> call()
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint32, Q> call(engine& Engine)
 		{
-			return
-				(vec<L, uint32, Q>(compute_rand<L, uint16, Q>::call()) << static_cast<uint32>(16)) |
-				(vec<L, uint32, Q>(compute_rand<L, uint16, Q>::call()));
+			vec<L, uint32, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+				Result[i] = static_cast<uint32>(Engine());
+			return Result;
 		}
 	};
 
 	template <length_t L, qualifier Q>
 	struct compute_rand<L, uint64, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint64, Q> call()
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint64, Q> call(engine& Engine)
 		{
-			return
-				(vec<L, uint64, Q>(compute_rand<L, uint32, Q>::call()) << static_cast<uint64>(32)) |
-				(vec<L, uint64, Q>(compute_rand<L, uint32, Q>::call()));
+			vec<L, uint64, Q> Result;
+			for(length_t i = 0; i < L; ++i)
+			{
+				uint64 const High = static_cast<uint32>(Engine());
+				Result[i] = (High << static_cast<uint64>(32)) | static_cast<uint32>(Engine());
+			}
+			return Result;
 		}
 	};
 
 	template <length_t L, typename T, qualifier Q>
 	struct compute_linearRand
 	{
-		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max);
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, engine& Engine);
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, int8, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, int8, Q> call(vec<L, int8, Q> const& Min, vec<L, int8, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, int8, Q> call(vec<L, int8, Q> const& Min, vec<L, int8, Q> const& Max, engine& Engine)
 		{
-			return (vec<L, int8, Q>(compute_rand<L, uint8, Q>::call() % vec<L, uint8, Q>(Max + static_cast<int8>(1) - Min))) + Min;
+			return (vec<L, int8, Q>(compute_rand<L, uint8, Q>::call(Engine) % vec<L, uint8, Q>(Max + static_cast<int8>(1) - Min))) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, uint8, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint8, Q> call(vec<L, uint8, Q> const& Min, vec<L, uint8, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint8, Q> call(vec<L, uint8, Q> const& Min, vec<L, uint8, Q> const& Max, engine& Engine)
 		{
-			return (compute_rand<L, uint8, Q>::call() % (Max + static_cast<uint8>(1) - Min)) + Min;
+			return (compute_rand<L, uint8, Q>::call(Engine) % (Max + static_cast<uint8>(1) - Min)) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, int16, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, int16, Q> call(vec<L, int16, Q> const& Min, vec<L, int16, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, int16, Q> call(vec<L, int16, Q> const& Min, vec<L, int16, Q> const& Max, engine& Engine)
 		{
-			return (vec<L, int16, Q>(compute_rand<L, uint16, Q>::call() % vec<L, uint16, Q>(Max + static_cast<int16>(1) - Min))) + Min;
+			return (vec<L, int16, Q>(compute_rand<L, uint16, Q>::call(Engine) % vec<L, uint16, Q>(Max + static_cast<int16>(1) - Min))) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, uint16, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> call(vec<L, uint16, Q> const& Min, vec<L, uint16, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint16, Q> call(vec<L, uint16, Q> const& Min, vec<L, uint16, Q> const& Max, engine& Engine)
 		{
-			return (compute_rand<L, uint16, Q>::call() % (Max + static_cast<uint16>(1) - Min)) + Min;
+			return (compute_rand<L, uint16, Q>::call(Engine) % (Max + static_cast<uint16>(1) - Min)) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, int32, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, int32, Q> call(vec<L, int32, Q> const& Min, vec<L, int32, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, int32, Q> call(vec<L, int32, Q> const& Min, vec<L, int32, Q> const& Max, engine& Engine)
 		{
-			return (vec<L, int32, Q>(compute_rand<L, uint32, Q>::call() % vec<L, uint32, Q>(Max + static_cast<int32>(1) - Min))) + Min;
+			return (vec<L, int32, Q>(compute_rand<L, uint32, Q>::call(Engine) % vec<L, uint32, Q>(Max + static_cast<int32>(1) - Min))) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, uint32, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint32, Q> call(vec<L, uint32, Q> const& Min, vec<L, uint32, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint32, Q> call(vec<L, uint32, Q> const& Min, vec<L, uint32, Q> const& Max, engine& Engine)
 		{
-			return (compute_rand<L, uint32, Q>::call() % (Max + static_cast<uint32>(1) - Min)) + Min;
+			return (compute_rand<L, uint32, Q>::call(Engine) % (Max + static_cast<uint32>(1) - Min)) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, int64, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, int64, Q> call(vec<L, int64, Q> const& Min, vec<L, int64, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, int64, Q> call(vec<L, int64, Q> const& Min, vec<L, int64, Q> const& Max, engine& Engine)
 		{
-			return (vec<L, int64, Q>(compute_rand<L, uint64, Q>::call() % vec<L, uint64, Q>(Max + static_cast<int64>(1) - Min))) + Min;
+			return (vec<L, int64, Q>(compute_rand<L, uint64, Q>::call(Engine) % vec<L, uint64, Q>(Max + static_cast<int64>(1) - Min))) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, uint64, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, uint64, Q> call(vec<L, uint64, Q> const& Min, vec<L, uint64, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, uint64, Q> call(vec<L, uint64, Q> const& Min, vec<L, uint64, Q> const& Max, engine& Engine)
 		{
-			return (compute_rand<L, uint64, Q>::call() % (Max + static_cast<uint64>(1) - Min)) + Min;
+			return (compute_rand<L, uint64, Q>::call(Engine) % (Max + static_cast<uint64>(1) - Min)) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, float, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& Min, vec<L, float, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& Min, vec<L, float, Q> const& Max, engine& Engine)
 		{
-			return vec<L, float, Q>(compute_rand<L, uint32, Q>::call()) / static_cast<float>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
+			return vec<L, float, Q>(compute_rand<L, uint32, Q>::call(Engine)) / static_cast<float>(std::numeric_limits<uint32>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, double, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, double, Q> call(vec<L, double, Q> const& Min, vec<L, double, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, double, Q> call(vec<L, double, Q> const& Min, vec<L, double, Q> const& Max, engine& Engine)
 		{
-			return vec<L, double, Q>(compute_rand<L, uint64, Q>::call()) / static_cast<double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+			return vec<L, double, Q>(compute_rand<L, uint64, Q>::call(Engine)) / static_cast<double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
 		}
 	};
 
 	template<length_t L, qualifier Q>
 	struct compute_linearRand<L, long double, Q>
 	{
-		GLM_FUNC_QUALIFIER static vec<L, long double, Q> call(vec<L, long double, Q> const& Min, vec<L, long double, Q> const& Max)
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static vec<L, long double, Q> call(vec<L, long double, Q> const& Min, vec<L, long double, Q> const& Max, engine& Engine)
+		{
+			return vec<L, long double, Q>(compute_rand<L, uint64, Q>::call(Engine)) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+		}
+	};
+
+	// Maps the values of the engine to [0, 1) with the precision of T
+	template<typename T>
+	struct compute_unit_rand
+	{
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static T call(engine& Engine)
+		{
+			uint64 const High = static_cast<uint32>(Engine());
+			uint64 const Bits = (High << static_cast<uint64>(32)) | static_cast<uint32>(Engine());
+			return static_cast<T>(Bits >> 11) * static_cast<T>(1.0 / 9007199254740992.0);
+		}
+	};
+
+	template<>
+	struct compute_unit_rand<float>
+	{
+		template<typename engine>
+		GLM_FUNC_QUALIFIER static float call(engine& Engine)
+		{
+			return static_cast<float>(static_cast<uint32>(Engine()) >> 8) * (1.0f / 16777216.0f);
+		}
+	};
+
+	// Components are generated in memory order, SIMD specializations produce the same values
+	template<length_t L, typename T, qualifier Q, bool UseSimd>
+	struct compute_linearRand_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, vec<L, T, Q>* Out, std::size_t Count, xoshiro128x8& Engine)
+		{
+			vec<L, T, Q> const Range = Max - Min;
+			for(std::size_t i = 0; i < Count; ++i)
+			for(length_t c = 0; c < L; ++c)
+				Out[i][c] = compute_unit_rand<T>::call(Engine) * Range[c] + Min[c];
+		}
+	};
+
+	// Maps points uniformly distributed in [0, 1)^n to the distributions, from first to Count.
+	// SIMD specializations process the leading samples and call these for the remaining ones.
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_rand_mapping
+	{
+		GLM_FUNC_QUALIFIER static void gauss(T Mean, T Scale, vec<2, T, Q> const* Uniform, vec<2, T, Q>* Out, std::size_t Count, std::size_t first)
+		{
+			for(std::size_t i = first; i < Count; ++i)
+			{
+				T const r = sqrt(static_cast<T>(-2) * log(static_cast<T>(1) - Uniform[i].x)) * Scale;
+				T const a = static_cast<T>(6.283185307179586476925286766559) * Uniform[i].y;
+				Out[i] = vec<2, T, Q>(r * cos(a) + Mean, r * sin(a) + Mean);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void circular(T Radius, T const* Uniform, vec<2, T, Q>* Out, std::size_t Count, std::size_t first)
+		{
+			for(std::size_t i = first; i < Count; ++i)
+			{
+				T const a = static_cast<T>(6.283185307179586476925286766559) * Uniform[i];
+				Out[i] = vec<2, T, Q>(cos(a) * Radius, sin(a) * Radius);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void spherical(T Radius, vec<2, T, Q> const* Uniform, vec<3, T, Q>* Out, std::size_t Count, std::size_t first)
+		{
+			for(std::size_t i = first; i < Count; ++i)
+			{
+				T const z = static_cast<T>(1) - static_cast<T>(2) * Uniform[i].x;
+				T const r = sqrt(z * z < static_cast<T>(1) ? static_cast<T>(1) - z * z : static_cast<T>(0)) * Radius;
+				T const a = static_cast<T>(6.283185307179586476925286766559) * Uniform[i].y;
+				Out[i] = vec<3, T, Q>(r * cos(a), r * sin(a), z * Radius);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void disk(T Radius, vec<2, T, Q> const* Uniform, vec<2, T, Q>* Out, std::size_t Count, std::size_t first)
+		{
+			for(std::size_t i = first; i < Count; ++i)
+			{
+				T const r = sqrt(Uniform[i].x) * Radius;
+				T const a = static_cast<T>(6.283185307179586476925286766559) * Uniform[i].y;
+				Out[i] = vec<2, T, Q>(r * cos(a), r * sin(a));
+			}
+		}
+	};
+
+	// Largest value of T below 1
+	template<typename T>
+	GLM_FUNC_QUALIFIER T unit_below_one()
+	{
+		return static_cast<T>(1) - std::numeric_limits<T>::epsilon() / static_cast<T>(2);
+	}
+
+	// Maps the Bits most significant bits of x to [0, 1), Bits being limited by the precision of T
+	template<typename T, typename genUType>
+	GLM_FUNC_QUALIFIER T unit_fixed_point(genUType x)
+	{
+		int const Bits = std::numeric_limits<T>::digits < std::numeric_limits<genUType>::digits ? std::numeric_limits<T>::digits : std::numeric_limits<genUType>::digits;
+		return std::ldexp(static_cast<T>(x >> (std::numeric_limits<genUType>::digits - Bits)), -Bits);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T radical_inverse(uint64 Index, uint32 Base)
+	{
+		double const Inverse = 1.0 / static_cast<double>(Base);
+		double Factor = Inverse;
+		double Result = 0.0;
+		while(Index > 0)
 		{
-			return vec<L, long double, Q>(compute_rand<L, uint64, Q>::call()) / static_cast<long double>(std::numeric_limits<uint64>::max()) * (Max - Min) + Min;
+			Result += static_cast<double>(Index % Base) * Factor;
+			Index /= Base;
+			Factor *= Inverse;
 		}
+		T const Value = static_cast<T>(Result);
+		return Value < unit_below_one<T>() ? Value : unit_below_one<T>();
+	}
+
+	struct sobol_directions
+	{
+		uint32 Data[4][32];
 	};
+
+	// Direction numbers of the first 4 dimensions of new-joe-kuo-6.21201
+	GLM_FUNC_QUALIFIER sobol_directions make_sobol_directions()
+	{
+		static uint32 const Degree[] = {1, 2, 3};
+		static uint32 const Coefficients[] = {0, 1, 1};
+		static uint32 const Initial[3][3] = {{1, 0, 0}, {1, 3, 0}, {1, 3, 1}};
+
+		sobol_directions Result;
+		for(uint32 k = 0; k < 32; ++k)
+			Result.Data[0][k] = 1u << (31 - k);
+
+		for(std::size_t d = 1; d < 4; ++d)
+		{
+			uint32* V = Result.Data[d];
+			uint32 const s = Degree[d - 1];
+			uint32 const a = Coefficients[d - 1];
+			for(uint32 k = 0; k < s; ++k)
+				V[k] = Initial[d - 1][k] << (31 - k);
+			for(uint32 k = s; k < 32; ++k)
+			{
+				V[k] = V[k - s] ^ (V[k - s] >> s);
+				for(uint32 j = 1; j < s; ++j)
+					V[k] ^= ((a >> (s - 1 - j)) & 1u) * V[k - j];
+			}
+		}
+		return Result;
+	}
+
+	GLM_FUNC_QUALIFIER sobol_directions const& sobol_table()
+	{
+		static sobol_directions const Table = make_sobol_directions();
+		return Table;
+	}
 }//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "random_simd.inl"
+#endif
+
+namespace glm
+{
+	GLM_FUNC_QUALIFIER pcg32::pcg32()
+	{
+		this->seed(0x853C49E6748FEA9Bull, 0);
+	}
+
+	GLM_FUNC_QUALIFIER pcg32::pcg32(uint64 Seed, uint64 Stream)
+	{
+		this->seed(Seed, Stream);
+	}
+
+	GLM_FUNC_QUALIFIER void pcg32::seed(uint64 Seed, uint64 Stream)
+	{
+		this->State = 0;
+		this->Increment = (Stream << 1u) | 1u;
+		this->State = this->State * 6364136223846793005ull + this->Increment;
+		this->State += Seed;
+		this->State = this->State * 6364136223846793005ull + this->Increment;
+	}
+
+	GLM_FUNC_QUALIFIER pcg32::result_type pcg32::operator()()
+	{
+		uint64 const Old = this->State;
+		this->State = Old * 6364136223846793005ull + this->Increment;
+		uint32 const XorShifted = static_cast<uint32>(((Old >> 18u) ^ Old) >> 27u);
+		uint32 const Rotation = static_cast<uint32>(Old >> 59u);
+		return (XorShifted >> Rotation) | (XorShifted << ((0u - Rotation) & 31u));
+	}
+
+	// Jump ahead of Brown, "Random Number Generation with Arbitrary Stride", composing the LCG steps by squaring
+	GLM_FUNC_QUALIFIER void pcg32::discard(uint64 Count)
+	{
+		uint64 CurMult = 6364136223846793005ull;
+		uint64 CurPlus = this->Increment;
+		uint64 AccMult = 1;
+		uint64 AccPlus = 0;
+		while(Count > 0)
+		{
+			if(Count & 1u)
+			{
+				AccMult *= CurMult;
+				AccPlus = AccPlus * CurMult + CurPlus;
+			}
+			CurPlus = (CurMult + 1u) * CurPlus;
+			CurMult *= CurMult;
+			Count >>= 1u;
+		}
+		this->State = AccMult * this->State + AccPlus;
+	}
+
+	GLM_FUNC_QUALIFIER bool pcg32::operator==(pcg32 const& Engine) const
+	{
+		return this->State == Engine.State && this->Increment == Engine.Increment;
+	}
+
+	GLM_FUNC_QUALIFIER bool pcg32::operator!=(pcg32 const& Engine) const
+	{
+		return !(*this == Engine);
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128x8::xoshiro128x8()
+	{
+		this->seed(0x853C49E6748FEA9Bull, 0);
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128x8::xoshiro128x8(uint64 Seed, uint64 Stream)
+	{
+		this->seed(Seed, Stream);
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128x8::seed(uint64 Seed, uint64 Stream)
+	{
+		uint64 Hash = Stream;
+		uint64 x = Seed ^ detail::splitmix64(Hash);
+		uint64 const a = detail::splitmix64(x);
+		uint64 const b = detail::splitmix64(x);
+		this->State[0][0] = static_cast<uint32>(a);
+		this->State[1][0] = static_cast<uint32>(a >> 32u);
+		this->State[2][0] = static_cast<uint32>(b);
+		this->State[3][0] = static_cast<uint32>(b >> 32u);
+
+		// The all zero state is the only one xoshiro can't leave
+		if((a | b) == 0)
+			this->State[0][0] = 1;
+
+		// Each lane starts 2^64 values after the previous one
+		static uint32 const Jump[] = {0x8764000bu, 0xf542d2d3u, 0x6fa035c3u, 0x77f2db5bu};
+		for(std::size_t k = 1; k < 8; ++k)
+		{
+			uint32 Jumped[4] = {0, 0, 0, 0};
+			for(std::size_t w = 0; w < 4; ++w)
+				this->State[w][k] = this->State[w][k - 1];
+			for(std::size_t i = 0; i < 4; ++i)
+			for(uint32 Bit = 0; Bit < 32; ++Bit)
+			{
+				if(Jump[i] & (1u << Bit))
+					for(std::size_t w = 0; w < 4; ++w)
+						Jumped[w] ^= this->State[w][k];
+				detail::xoshiro128pp_next(this->State, k);
+			}
+			for(std::size_t w = 0; w < 4; ++w)
+				this->State[w][k] = Jumped[w];
+		}
+
+		for(std::size_t k = 0; k < 8; ++k)
+			this->Block[k] = 0;
+		this->Next = 8;
+	}
+
+	GLM_FUNC_QUALIFIER xoshiro128x8::result_type xoshiro128x8::operator()()
+	{
+		if(this->Next == 8)
+		{
+			detail::compute_xoshiro128x8<false>::call(this->State, this->Block, 1);
+			this->Next = 0;
+		}
+		return this->Block[this->Next++];
+	}
+
+	GLM_FUNC_QUALIFIER void xoshiro128x8::generate(uint32* Out, std::size_t Count)
+	{
+		std::size_t i = 0;
+		for(; i < Count && this->Next < 8; ++i)
+			Out[i] = this->Block[this->Next++];
+
+		std::size_t const Blocks = (Count - i) / 8;
+		detail::compute_xoshiro128x8<GLM_CONFIG_SIMD == GLM_ENABLE>::call(this->State, Out + i, Blocks);
+		i += Blocks * 8;
+
+		for(; i < Count; ++i)
+			Out[i] = (*this)();
+	}
+
+	GLM_FUNC_QUALIFIER bool xoshiro128x8::operator==(xoshiro128x8 const& Engine) const
+	{
+		if(this->Next != Engine.Next)
+			return false;
+		for(std::size_t w = 0; w < 4; ++w)
+		for(std::size_t k = 0; k < 8; ++k)
+			if(this->State[w][k] != Engine.State[w][k])
+				return false;
+		for(std::size_t k = this->Next; k < 8; ++k)
+			if(this->Block[k] != Engine.Block[k])
+				return false;
+		return true;
+	}
+
+	GLM_FUNC_QUALIFIER bool xoshiro128x8::operator!=(xoshiro128x8 const& Engine) const
+	{
+		return !(*this == Engine);
+	}
+
+	GLM_FUNC_QUALIFIER pcg32& randomEngine()
+	{
+		static thread_local pcg32 Engine(0x853C49E6748FEA9Bull, detail::next_random_stream());
+		return Engine;
+	}
+
+	GLM_FUNC_QUALIFIER void randomSeed(uint64 Seed, uint64 Stream)
+	{
+		randomEngine().seed(Seed, Stream);
+	}
 
 	template<typename genType>
 	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max)
 	{
+		return linearRand(Min, Max, randomEngine());
+	}
+
+	template<typename genType, typename engine>
+	GLM_FUNC_QUALIFIER genType linearRand(genType Min, genType Max, engine& Engine)
+	{
+		detail::check_random_engine<engine>();
+
 		return detail::compute_linearRand<1, genType, highp>::call(
 			vec<1, genType, highp>(Min),
-			vec<1, genType, highp>(Max)).x;
+			vec<1, genType, highp>(Max), Engine).x;
 	}
 
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max)
 	{
-		return detail::compute_linearRand<L, T, Q>::call(Min, Max);
+		return linearRand(Min, Max, randomEngine());
+	}
+
+	template<length_t L, typename T, qualifier Q, typename engine>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, engine& Engine)
+	{
+		detail::check_random_engine<engine>();
+
+		return detail::compute_linearRand<L, T, Q>::call(Min, Max, Engine);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void linearRand(vec<L, T, Q> const& Min, vec<L, T, Q> const& Max, vec<L, T, Q>* Out, std::size_t Count, xoshiro128x8& Engine)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'linearRand' array overload accepts only floating-point inputs");
+
+		detail::compute_linearRand_batch<L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(Min, Max, Out, Count, Engine);
 	}
 
 	template<typename genType>
 	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation)
+	{
+		return gaussRand(Mean, Deviation, randomEngine());
+	}
+
+	template<typename genType, typename engine>
+	GLM_FUNC_QUALIFIER genType gaussRand(genType Mean, genType Deviation, engine& Engine)
 	{
 		genType w, x1, x2;
 
 		do
 		{
-			x1 = linearRand(genType(-1), genType(1));
-			x2 = linearRand(genType(-1), genType(1));
+			x1 = linearRand(genType(-1), genType(1), Engine);
+			x2 = linearRand(genType(-1), genType(1), Engine);
 
 			w = x1 * x1 + x2 * x2;
 		} while(w > genType(1));
@@ -234,11 +624,26 @@ namespace detail
 	template<length_t L, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<L, T, Q> gaussRand(vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation)
 	{
-		return detail::functor2<vec, L, T, Q>::call(gaussRand, Mean, Deviation);
+		return gaussRand(Mean, Deviation, randomEngine());
+	}
+
+	template<length_t L, typename T, qualifier Q, typename engine>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> gaussRand(vec<L, T, Q> const& Mean, vec<L, T, Q> const& Deviation, engine& Engine)
+	{
+		vec<L, T, Q> Result;
+		for(length_t i = 0; i < L; ++i)
+			Result[i] = gaussRand(Mean[i], Deviation[i], Engine);
+		return Result;
 	}
 
 	template<typename T>
 	GLM_FUNC_QUALIFIER vec<2, T, defaultp> diskRand(T Radius)
+	{
+		return diskRand(Radius, randomEngine());
+	}
+
+	template<typename T, typename engine>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> diskRand(T Radius, engine& Engine)
 	{
 		assert(Radius > static_cast<T>(0));
 
@@ -249,7 +654,7 @@ namespace detail
 		{
 			Result = linearRand(
 				vec<2, T, defaultp>(-Radius),
-				vec<2, T, defaultp>(Radius));
+				vec<2, T, defaultp>(Radius), Engine);
 			LenRadius = length(Result);
 		}
 		while(LenRadius > Radius);
@@ -259,6 +664,12 @@ namespace detail
 
 	template<typename T>
 	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(T Radius)
+	{
+		return ballRand(Radius, randomEngine());
+	}
+
+	template<typename T, typename engine>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> ballRand(T Radius, engine& Engine)
 	{
 		assert(Radius > static_cast<T>(0));
 
@@ -269,7 +680,7 @@ namespace detail
 		{
 			Result = linearRand(
 				vec<3, T, defaultp>(-Radius),
-				vec<3, T, defaultp>(Radius));
+				vec<3, T, defaultp>(Radius), Engine);
 			LenRadius = length(Result);
 		}
 		while(LenRadius > Radius);
@@ -279,20 +690,32 @@ namespace detail
 
 	template<typename T>
 	GLM_FUNC_QUALIFIER vec<2, T, defaultp> circularRand(T Radius)
+	{
+		return circularRand(Radius, randomEngine());
+	}
+
+	template<typename T, typename engine>
+	GLM_FUNC_QUALIFIER vec<2, T, defaultp> circularRand(T Radius, engine& Engine)
 	{
 		assert(Radius > static_cast<T>(0));
 
-		T a = linearRand(T(0), static_cast<T>(6.283185307179586476925286766559));
+		T a = linearRand(T(0), static_cast<T>(6.283185307179586476925286766559), Engine);
 		return vec<2, T, defaultp>(glm::cos(a), glm::sin(a)) * Radius;
 	}
 
 	template<typename T>
 	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(T Radius)
+	{
+		return sphericalRand(Radius, randomEngine());
+	}
+
+	template<typename T, typename engine>
+	GLM_FUNC_QUALIFIER vec<3, T, defaultp> sphericalRand(T Radius, engine& Engine)
 	{
 		assert(Radius > static_cast<T>(0));
 
-		T theta = linearRand(T(0), T(6.283185307179586476925286766559f));
-		T phi = std::acos(linearRand(T(-1.0f), T(1.0f)));
+		T theta = linearRand(T(0), T(6.283185307179586476925286766559f), Engine);
+		T phi = std::acos(linearRand(T(-1.0f), T(1.0f), Engine));
 
 		T x = std::sin(phi) * std::cos(theta);
 		T y = std::sin(phi) * std::sin(theta);
@@ -300,4 +723,181 @@ namespace detail
 
 		return vec<3, T, defaultp>(x, y, z) * Radius;
 	}
+	template<typename T>
+	GLM_FUNC_QUALIFIER void gaussRand(T Mean, T Deviation, T* Out, std::size_t Count, xoshiro128x8& Engine)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'gaussRand' array overload accepts only floating-point inputs");
+
+		vec<2, T, defaultp> Uniform[48];
+		vec<2, T, defaultp> Pairs[48];
+		for(std::size_t First = 0; First < Count; First += 96)
+		{
+			std::size_t const Size = Count - First < 96 ? Count - First : 96;
+			linearRand(vec<2, T, defaultp>(0), vec<2, T, defaultp>(1), Uniform, (Size + 1) / 2, Engine);
+			gaussRand(Mean, Deviation, Uniform, Pairs, (Size + 1) / 2);
+			for(std::size_t j = 0; j < Size; ++j)
+				Out[First + j] = Pairs[j / 2][static_cast<length_t>(j % 2)];
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void gaussRand(T Mean, T Deviation, vec<2, T, Q> const* Uniform, vec<2, T, Q>* Out, std::size_t Count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'gaussRand' array overload accepts only floating-point inputs");
+
+		detail::compute_rand_mapping<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::gauss(Mean, Deviation * Deviation, Uniform, Out, Count, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void circularRand(T Radius, vec<2, T, Q>* Out, std::size_t Count, xoshiro128x8& Engine)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'circularRand' array overload accepts only floating-point inputs");
+
+		T Uniform[96];
+		for(std::size_t First = 0; First < Count; First += 96)
+		{
+			std::size_t const Size = Count - First < 96 ? Count - First : 96;
+			for(std::size_t j = 0; j < Size; ++j)
+				Uniform[j] = detail::compute_unit_rand<T>::call(Engine);
+			circularRand(Radius, Uniform, Out + First, Size);
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void circularRand(T Radius, T const* Uniform, vec<2, T, Q>* Out, std::size_t Count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'circularRand' array overload accepts only floating-point inputs");
+		assert(Radius > static_cast<T>(0));
+
+		detail::compute_rand_mapping<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::circular(Radius, Uniform, Out, Count, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sphericalRand(T Radius, vec<3, T, Q>* Out, std::size_t Count, xoshiro128x8& Engine)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'sphericalRand' array overload accepts only floating-point inputs");
+
+		vec<2, T, Q> Uniform[48];
+		for(std::size_t First = 0; First < Count; First += 48)
+		{
+			std::size_t const Size = Count - First < 48 ? Count - First : 48;
+			linearRand(vec<2, T, Q>(0), vec<2, T, Q>(1), Uniform, Size, Engine);
+			sphericalRand(Radius, Uniform, Out + First, Size);
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sphericalRand(T Radius, vec<2, T, Q> const* Uniform, vec<3, T, Q>* Out, std::size_t Count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'sphericalRand' array overload accepts only floating-point inputs");
+		assert(Radius > static_cast<T>(0));
+
+		detail::compute_rand_mapping<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::spherical(Radius, Uniform, Out, Count, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void diskRand(T Radius, vec<2, T, Q>* Out, std::size_t Count, xoshiro128x8& Engine)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'diskRand' array overload accepts only floating-point inputs");
+
+		vec<2, T, Q> Uniform[48];
+		for(std::size_t First = 0; First < Count; First += 48)
+		{
+			std::size_t const Size = Count - First < 48 ? Count - First : 48;
+			linearRand(vec<2, T, Q>(0), vec<2, T, Q>(1), Uniform, Size, Engine);
+			diskRand(Radius, Uniform, Out + First, Size);
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void diskRand(T Radius, vec<2, T, Q> const* Uniform, vec<2, T, Q>* Out, std::size_t Count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'diskRand' array overload accepts only floating-point inputs");
+		assert(Radius > static_cast<T>(0));
+
+		detail::compute_rand_mapping<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::disk(Radius, Uniform, Out, Count, 0);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void haltonSequence(std::size_t First, vec<L, T, Q>* Out, std::size_t Count)
+	{
+		static_assert(L >= 1 && L <= 4, "'haltonSequence' only supports 1 to 4 dimensions");
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'haltonSequence' accepts only floating-point inputs");
+
+		static uint32 const Bases[] = {2, 3, 5, 7};
+		for(std::size_t i = 0; i < Count; ++i)
+		for(length_t c = 0; c < L; ++c)
+			Out[i][c] = detail::radical_inverse<T>(static_cast<uint64>(First + i), Bases[c]);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sobolSequence(std::size_t First, vec<L, T, Q>* Out, std::size_t Count)
+	{
+		static_assert(L >= 1 && L <= 4, "'sobolSequence' only supports 1 to 4 dimensions");
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'sobolSequence' accepts only floating-point inputs");
+		assert(static_cast<uint64>(First) + static_cast<uint64>(Count) <= (static_cast<uint64>(1) << 32));
+
+		if(Count == 0)
+			return;
+
+		detail::sobol_directions const& Directions = detail::sobol_table();
+
+		// The point of index n is the sum of the directions of the bits of the Gray code of n
+		uint32 Index = static_cast<uint32>(First);
+		uint32 const Gray = Index ^ (Index >> 1);
+		uint32 X[L];
+		for(length_t c = 0; c < L; ++c)
+		{
+			X[c] = 0;
+			for(uint32 k = 0; k < 32; ++k)
+				if(Gray & (1u << k))
+					X[c] ^= Directions.Data[c][k];
+		}
+
+		// The Gray codes of n and n + 1 differ by the lowest zero bit of n
+		for(std::size_t i = 0; i < Count; ++i, ++Index)
+		{
+			for(length_t c = 0; c < L; ++c)
+				Out[i][c] = detail::unit_fixed_point<T>(X[c]);
+
+			if(i + 1 == Count)
+				break;
+
+			uint32 Bit = 0;
+			while(Index & (1u << Bit))
+				++Bit;
+			for(length_t c = 0; c < L; ++c)
+				X[c] ^= Directions.Data[c][Bit];
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void r2Sequence(std::size_t First, vec<L, T, Q>* Out, std::size_t Count)
+	{
+		static_assert(L >= 1 && L <= 4, "'r2Sequence' only supports 1 to 4 dimensions");
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'r2Sequence' accepts only floating-point inputs");
+
+		// Fixed point iteration converging to the root of x^(L+1) = x + 1
+		double g = 2.0;
+		for(int i = 0; i < 64; ++i)
+			g = std::pow(1.0 + g, 1.0 / static_cast<double>(L + 1));
+
+		// Fractions of 64 bits, the additions wrapping around
+		uint64 Step[L];
+		uint64 X[L];
+		double Alpha = 1.0;
+		for(length_t c = 0; c < L; ++c)
+		{
+			Alpha /= g;
+			Step[c] = static_cast<uint64>(std::ldexp(Alpha, 64));
+			X[c] = (static_cast<uint64>(1) << 63) + Step[c] * static_cast<uint64>(First);
+		}
+
+		for(std::size_t i = 0; i < Count; ++i)
+		for(length_t c = 0; c < L; ++c)
+		{
+			Out[i][c] = detail::unit_fixed_point<T>(X[c]);
+			X[c] += Step[c];
+		}
+	}
 }//namespace glm
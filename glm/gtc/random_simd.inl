@@ -0,0 +1,219 @@
+/// @ref gtc_random
+
+#include "../simd/random.h"
+#include "../simd/exponential.h"
+#include "../simd/trigonometric.h"
+#include <cstring>
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<>
+	struct compute_xoshiro128x8<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(uint32 State[4][8], uint32* Out, std::size_t Blocks)
+		{
+			if(Blocks == 0)
+				return;
+
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				glm_u32vec8 s[4];
+				for(std::size_t w = 0; w < 4; ++w)
+					s[w] = _mm256_loadu_si256(reinterpret_cast<glm_u32vec8 const*>(State[w]));
+
+				for(std::size_t b = 0; b < Blocks; ++b)
+					_mm256_storeu_si256(reinterpret_cast<glm_u32vec8*>(Out + b * 8), glm_xoshiro128pp_soa8(s));
+
+				for(std::size_t w = 0; w < 4; ++w)
+					_mm256_storeu_si256(reinterpret_cast<glm_u32vec8*>(State[w]), s[w]);
+#			else
+				// Lanes 0 to 3 in Low, lanes 4 to 7 in High
+				glm_u32vec4 Low[4];
+				glm_u32vec4 High[4];
+				for(std::size_t w = 0; w < 4; ++w)
+				{
+					Low[w] = _mm_loadu_si128(reinterpret_cast<glm_u32vec4 const*>(State[w]));
+					High[w] = _mm_loadu_si128(reinterpret_cast<glm_u32vec4 const*>(State[w] + 4));
+				}
+
+				for(std::size_t b = 0; b < Blocks; ++b)
+				{
+					_mm_storeu_si128(reinterpret_cast<glm_u32vec4*>(Out + b * 8), glm_xoshiro128pp_soa4(Low));
+					_mm_storeu_si128(reinterpret_cast<glm_u32vec4*>(Out + b * 8 + 4), glm_xoshiro128pp_soa4(High));
+				}
+
+				for(std::size_t w = 0; w < 4; ++w)
+				{
+					_mm_storeu_si128(reinterpret_cast<glm_u32vec4*>(State[w]), Low[w]);
+					_mm_storeu_si128(reinterpret_cast<glm_u32vec4*>(State[w] + 4), High[w]);
+				}
+#			endif
+		}
+	};
+
+	// The components of the vectors are converted as one array of floats, in chunks of 96 values.
+	// Range and Min are repeated over 32 floats so that a register starting at any multiple of 4
+	// of a chunk finds the components of its lanes at the same offset, 96 and 24 being multiples of L.
+	template<length_t L, qualifier Q>
+	struct compute_linearRand_batch<L, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(vec<L, float, Q> const& Min, vec<L, float, Q> const& Max, vec<L, float, Q>* Out, std::size_t Count, xoshiro128x8& Engine)
+		{
+			if(sizeof(vec<L, float, Q>) != sizeof(float) * L)
+			{
+				compute_linearRand_batch<L, float, Q, false>::call(Min, Max, Out, Count, Engine);
+				return;
+			}
+
+			vec<L, float, Q> const Range = Max - Min;
+			float RangePattern[32];
+			float MinPattern[32];
+			for(std::size_t k = 0; k < 32; ++k)
+			{
+				RangePattern[k] = Range[static_cast<length_t>(k % L)];
+				MinPattern[k] = Min[static_cast<length_t>(k % L)];
+			}
+
+			std::size_t const Total = Count * L;
+			uint32 Bits[96];
+			float Values[96];
+			for(std::size_t First = 0; First < Total; First += 96)
+			{
+				std::size_t const Size = Total - First < 96 ? Total - First : 96;
+				std::size_t const simd = Size - Size % 4;
+				Engine.generate(Bits, Size);
+
+				std::size_t j = 0;
+#				if GLM_ARCH & GLM_ARCH_AVX2_BIT
+					for(; j + 8 <= simd; j += 8)
+					{
+						glm_f32vec8 const u = glm_u32vec8_unorm24(_mm256_loadu_si256(reinterpret_cast<glm_u32vec8 const*>(Bits + j)));
+						_mm256_storeu_ps(Values + j, _mm256_add_ps(_mm256_mul_ps(u, _mm256_loadu_ps(RangePattern + j % 24)), _mm256_loadu_ps(MinPattern + j % 24)));
+					}
+#				endif
+				for(; j < simd; j += 4)
+				{
+					glm_f32vec4 const u = glm_u32vec4_unorm24(_mm_loadu_si128(reinterpret_cast<glm_u32vec4 const*>(Bits + j)));
+					_mm_storeu_ps(Values + j, _mm_add_ps(_mm_mul_ps(u, _mm_loadu_ps(RangePattern + j % 24)), _mm_loadu_ps(MinPattern + j % 24)));
+				}
+				for(j = simd; j < Size; ++j)
+					Values[j] = static_cast<float>(Bits[j] >> 8) * (1.0f / 16777216.0f) * RangePattern[j % L] + MinPattern[j % L];
+
+				std::memcpy(reinterpret_cast<char*>(Out) + First * sizeof(float), Values, Size * sizeof(float));
+			}
+		}
+	};
+
+	// Samples are gathered 4 at a time in registers holding one component, the angles are in [0, 2 pi)
+	// where the sincos kernel is accurate.
+	template<qualifier Q>
+	struct compute_rand_mapping<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static glm_f32vec4 angle(float const* Turns)
+		{
+			return _mm_mul_ps(_mm_loadu_ps(Turns), _mm_set1_ps(6.283185307179586476925286766559f));
+		}
+
+		GLM_FUNC_QUALIFIER static void gauss(float Mean, float Scale, vec<2, float, Q> const* Uniform, vec<2, float, Q>* Out, std::size_t Count, std::size_t first)
+		{
+			std::size_t const count = Count - first;
+			std::size_t const simd = first + count - count % 4;
+			for(std::size_t i = first; i < simd; i += 4)
+			{
+				float u[4], v[4];
+				for(std::size_t k = 0; k < 4; ++k)
+				{
+					u[k] = Uniform[i + k].x;
+					v[k] = Uniform[i + k].y;
+				}
+
+				glm_f32vec4 const Log = glm_vec4_log(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_loadu_ps(u)));
+				glm_f32vec4 const r = _mm_mul_ps(_mm_sqrt_ps(_mm_mul_ps(_mm_set1_ps(-2.0f), Log)), _mm_set1_ps(Scale));
+				glm_f32vec4 s, c;
+				glm_vec4_sincos(angle(v), &s, &c);
+
+				float x[4], y[4];
+				_mm_storeu_ps(x, _mm_add_ps(_mm_mul_ps(r, c), _mm_set1_ps(Mean)));
+				_mm_storeu_ps(y, _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(Mean)));
+				for(std::size_t k = 0; k < 4; ++k)
+					Out[i + k] = vec<2, float, Q>(x[k], y[k]);
+			}
+			compute_rand_mapping<float, Q, false>::gauss(Mean, Scale, Uniform, Out, Count, simd);
+		}
+
+		GLM_FUNC_QUALIFIER static void circular(float Radius, float const* Uniform, vec<2, float, Q>* Out, std::size_t Count, std::size_t first)
+		{
+			std::size_t const count = Count - first;
+			std::size_t const simd = first + count - count % 4;
+			for(std::size_t i = first; i < simd; i += 4)
+			{
+				glm_f32vec4 s, c;
+				glm_vec4_sincos(angle(Uniform + i), &s, &c);
+
+				float x[4], y[4];
+				_mm_storeu_ps(x, _mm_mul_ps(c, _mm_set1_ps(Radius)));
+				_mm_storeu_ps(y, _mm_mul_ps(s, _mm_set1_ps(Radius)));
+				for(std::size_t k = 0; k < 4; ++k)
+					Out[i + k] = vec<2, float, Q>(x[k], y[k]);
+			}
+			compute_rand_mapping<float, Q, false>::circular(Radius, Uniform, Out, Count, simd);
+		}
+
+		GLM_FUNC_QUALIFIER static void spherical(float Radius, vec<2, float, Q> const* Uniform, vec<3, float, Q>* Out, std::size_t Count, std::size_t first)
+		{
+			std::size_t const count = Count - first;
+			std::size_t const simd = first + count - count % 4;
+			for(std::size_t i = first; i < simd; i += 4)
+			{
+				float u[4], v[4];
+				for(std::size_t k = 0; k < 4; ++k)
+				{
+					u[k] = Uniform[i + k].x;
+					v[k] = Uniform[i + k].y;
+				}
+
+				glm_f32vec4 const z = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(2.0f), _mm_loadu_ps(u)));
+				glm_f32vec4 const r = _mm_mul_ps(_mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(z, z)), _mm_setzero_ps())), _mm_set1_ps(Radius));
+				glm_f32vec4 s, c;
+				glm_vec4_sincos(angle(v), &s, &c);
+
+				float x[4], y[4], w[4];
+				_mm_storeu_ps(x, _mm_mul_ps(r, c));
+				_mm_storeu_ps(y, _mm_mul_ps(r, s));
+				_mm_storeu_ps(w, _mm_mul_ps(z, _mm_set1_ps(Radius)));
+				for(std::size_t k = 0; k < 4; ++k)
+					Out[i + k] = vec<3, float, Q>(x[k], y[k], w[k]);
+			}
+			compute_rand_mapping<float, Q, false>::spherical(Radius, Uniform, Out, Count, simd);
+		}
+
+		GLM_FUNC_QUALIFIER static void disk(float Radius, vec<2, float, Q> const* Uniform, vec<2, float, Q>* Out, std::size_t Count, std::size_t first)
+		{
+			std::size_t const count = Count - first;
+			std::size_t const simd = first + count - count % 4;
+			for(std::size_t i = first; i < simd; i += 4)
+			{
+				float u[4], v[4];
+				for(std::size_t k = 0; k < 4; ++k)
+				{
+					u[k] = Uniform[i + k].x;
+					v[k] = Uniform[i + k].y;
+				}
+
+				glm_f32vec4 const r = _mm_mul_ps(_mm_sqrt_ps(_mm_loadu_ps(u)), _mm_set1_ps(Radius));
+				glm_f32vec4 s, c;
+				glm_vec4_sincos(angle(v), &s, &c);
+
+				float x[4], y[4];
+				_mm_storeu_ps(x, _mm_mul_ps(r, c));
+				_mm_storeu_ps(y, _mm_mul_ps(r, s));
+				for(std::size_t k = 0; k < 4; ++k)
+					Out[i + k] = vec<2, float, Q>(x[k], y[k]);
+			}
+			compute_rand_mapping<float, Q, false>::disk(Radius, Uniform, Out, Count, simd);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
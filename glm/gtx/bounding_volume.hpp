@@ -0,0 +1,201 @@
+/// @ref gtx_bounding_volume
+/// @file glm/gtx/bounding_volume.hpp
+///
+/// @see core (dependence)
+/// @see gtx_pca (dependence)
+/// @see ext_vector_soa (dependence)
+///
+/// @defgroup gtx_bounding_volume GLM_GTX_bounding_volume
+/// @ingroup gtx
+///
+/// Include <glm/gtx/bounding_volume.hpp> to use the features of this extension.
+///
+/// Axis aligned and oriented bounding boxes: computing them from points, merging and transforming them,
+/// and testing them for overlap with the separating axis theorem.
+///
+/// Oriented boxes are fitted to points with the principal axes of their covariance, computed with gtx_pca.
+/// Arrays of axis aligned boxes are stored as structure of arrays, one array for the minimum corners and one for the maximum corners.
+///
+/// Internally, float arrays are processed 4 or 8 at a time using SSE2 or AVX when available.
+/// Minimums and maximums are exact, so the bounds are the same with and without SIMD.
+///
+/// Example:
+/// ```
+/// std::vector<glm::vec3> Vertices;
+/// // ... fill Vertices
+///
+/// glm::aabb<float> Box = glm::computeBounds(Vertices.data(), Vertices.size());
+/// glm::obb<float> Oriented = glm::computeOrientedBounds(Vertices.data(), Vertices.size());
+///
+/// if(glm::intersectBoxes(Oriented, OtherOriented))
+///     // ... narrow phase
+/// ```
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/vector_soa.hpp"
+#include "../gtx/pca.hpp"
+#include <cstddef>
+#include <cstdint>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_bounding_volume is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_bounding_volume extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_bounding_volume
+	/// @{
+
+	/// Axis aligned bounding box of corners Min and Max.
+	/// A box with Min greater than Max on any axis is empty, computeBounds of no point returns Min = +infinity and Max = -infinity.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q = defaultp>
+	struct aabb
+	{
+		vec<3, T, Q> Min;
+		vec<3, T, Q> Max;
+	};
+
+	/// Oriented bounding box: the points p such that abs(dot(p - Center, Axes[i])) <= HalfExtents[i] for each axis i.
+	/// The columns of Axes are orthonormal and form a right-handed basis.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q = defaultp>
+	struct obb
+	{
+		vec<3, T, Q> Center;
+		mat<3, 3, T, Q> Axes;
+		vec<3, T, Q> HalfExtents;
+	};
+
+	/// Computes the axis aligned bounding box of the count points.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<T, Q> computeBounds(vec<3, T, Q> const* points, std::size_t count);
+
+	/// Computes the axis aligned bounding box of the points.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<T, Q> computeBounds(vec_soa_const_view<3, T, Q> const& points);
+
+	/// Computes the axis aligned bounding box of the boxMin.size() boxes of corners boxMin[i] and boxMax[i],
+	/// the result of mergeBounds over all of them.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<T, Q> computeBounds(vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax);
+
+	/// Computes the axis aligned bounding box of an oriented box.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<T, Q> computeBounds(obb<T, Q> const& box);
+
+	/// Computes the smallest axis aligned box containing the boxes a and b.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<T, Q> mergeBounds(aabb<T, Q> const& a, aabb<T, Q> const& b);
+
+	/// Computes the smallest axis aligned box containing the box a and the point p.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<T, Q> mergeBounds(aabb<T, Q> const& a, vec<3, T, Q> const& p);
+
+	/// Computes the axis aligned bounding box of a non-empty box transformed by the affine transformation m, the last row of m being ignored.
+	/// The box is transformed as a center and half extents, up to rounding it contains the transformed corners of the box.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL aabb<T, Q> transformBounds(mat<4, 4, T, Q> const& m, aabb<T, Q> const& box);
+
+	/// Computes the axis aligned bounding boxes of the boxMin.size() non-empty boxes of corners boxMin[i] and boxMax[i]
+	/// transformed by m, as transformBounds of a single box. The outputs may be the inputs.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void transformBounds(
+		mat<4, 4, T, Q> const& m,
+		vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		vec_soa_view<3, T, Q> outMin, vec_soa_view<3, T, Q> outMax);
+
+	/// Fits an oriented box to the count points, count being at least 1.
+	/// The axes are the principal axes of the covariance of the points, sorted by decreasing variance.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL obb<T, Q> computeOrientedBounds(vec<3, T, Q> const* points, std::size_t count);
+
+	/// Converts an axis aligned box to an oriented box with the identity as axes.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL obb<T, Q> computeOrientedBounds(aabb<T, Q> const& box);
+
+	/// Tests whether two axis aligned boxes overlap. Touching boxes overlap.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectBoxes(aabb<T, Q> const& a, aabb<T, Q> const& b);
+
+	/// Tests whether two oriented boxes overlap, with the separating axis theorem over the 15 candidate axes.
+	/// Touching boxes overlap.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectBoxes(obb<T, Q> const& a, obb<T, Q> const& b);
+
+	/// Tests whether an oriented box and an axis aligned box overlap. Touching boxes overlap.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectBoxes(obb<T, Q> const& a, aabb<T, Q> const& b);
+
+	/// Tests whether an axis aligned box and an oriented box overlap. Touching boxes overlap.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectBoxes(aabb<T, Q> const& a, obb<T, Q> const& b);
+
+	/// Tests the boxMin.size() boxes of corners boxMin[i] and boxMax[i] against the box query, as intersectBoxes.
+	/// Box i overlapping the query sets the bit (i % 32) of mask[i / 32], the other bits of the (boxMin.size() + 31) / 32 words of mask are cleared.
+	///
+	/// @return The number of boxes overlapping the query
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL std::size_t intersectBoxes(
+		aabb<T, Q> const& query,
+		vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		std::uint32_t* mask);
+
+	/// @}
+}//namespace glm
+
+#include "bounding_volume.inl"
@@ -0,0 +1,327 @@
+/// @ref gtx_bounding_volume
+
+#include <cassert>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<T, Q> empty_bounds()
+	{
+		aabb<T, Q> Box;
+		Box.Min = vec<3, T, Q>(std::numeric_limits<T>::infinity());
+		Box.Max = vec<3, T, Q>(-std::numeric_limits<T>::infinity());
+		return Box;
+	}
+
+	// Center and half extents form of the transform, evaluated in the order of the SIMD kernels
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<T, Q> transform_bounds(mat<4, 4, T, Q> const& m, vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax)
+	{
+		vec<3, T, Q> const Center = (boxMin + boxMax) * static_cast<T>(0.5);
+		vec<3, T, Q> const Extent = (boxMax - boxMin) * static_cast<T>(0.5);
+
+		aabb<T, Q> Box;
+		for(length_t r = 0; r < 3; ++r)
+		{
+			T C = m[3][r] + m[0][r] * Center.x;
+			C = C + m[1][r] * Center.y;
+			C = C + m[2][r] * Center.z;
+			T E = abs(m[0][r]) * Extent.x;
+			E = E + abs(m[1][r]) * Extent.y;
+			E = E + abs(m[2][r]) * Extent.z;
+			Box.Min[r] = C - E;
+			Box.Max[r] = C + E;
+		}
+		return Box;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool overlap_bounds(vec<3, T, Q> const& queryMin, vec<3, T, Q> const& queryMax, vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax)
+	{
+		return
+			boxMin.x <= queryMax.x && boxMax.x >= queryMin.x &&
+			boxMin.y <= queryMax.y && boxMax.y >= queryMin.y &&
+			boxMin.z <= queryMax.z && boxMax.z >= queryMin.z;
+	}
+
+	// Elements from first to the end of the arrays are processed one at a time,
+	// SIMD specializations process the leading ones and call this for the remaining ones.
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_bounding_volume
+	{
+		GLM_FUNC_QUALIFIER static void points(vec<3, T, Q> const* points, std::size_t count, aabb<T, Q>& Box, std::size_t first)
+		{
+			for(std::size_t i = first; i < count; ++i)
+			{
+				Box.Min = min(Box.Min, points[i]);
+				Box.Max = max(Box.Max, points[i]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void points(vec_soa_const_view<3, T, Q> const& points, aabb<T, Q>& Box, std::size_t first)
+		{
+			for(std::size_t i = first; i < points.size(); ++i)
+			{
+				vec<3, T, Q> const p = points.load(i);
+				Box.Min = min(Box.Min, p);
+				Box.Max = max(Box.Max, p);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void boxes(vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax, aabb<T, Q>& Box, std::size_t first)
+		{
+			for(std::size_t i = first; i < boxMin.size(); ++i)
+			{
+				Box.Min = min(Box.Min, boxMin.load(i));
+				Box.Max = max(Box.Max, boxMax.load(i));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void transform(
+			mat<4, 4, T, Q> const& m,
+			vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+			vec_soa_view<3, T, Q>& outMin, vec_soa_view<3, T, Q>& outMax, std::size_t first)
+		{
+			for(std::size_t i = first; i < boxMin.size(); ++i)
+			{
+				aabb<T, Q> const Box = transform_bounds(m, boxMin.load(i), boxMax.load(i));
+				outMin.store(i, Box.Min);
+				outMax.store(i, Box.Max);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static std::size_t overlap(
+			aabb<T, Q> const& query,
+			vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+			std::uint32_t* mask, std::size_t first)
+		{
+			std::size_t Count = 0;
+			for(std::size_t i = first; i < boxMin.size(); ++i)
+			{
+				if(!overlap_bounds(query.Min, query.Max, boxMin.load(i), boxMax.load(i)))
+					continue;
+				mask[i / 32] |= static_cast<std::uint32_t>(1) << (i % 32);
+				++Count;
+			}
+			return Count;
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<T, Q> computeBounds(vec<3, T, Q> const* points, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'computeBounds' accepts only floating-point inputs");
+
+		aabb<T, Q> Box = detail::empty_bounds<T, Q>();
+		detail::compute_bounding_volume<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::points(points, count, Box, 0);
+		return Box;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<T, Q> computeBounds(vec_soa_const_view<3, T, Q> const& points)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'computeBounds' accepts only floating-point inputs");
+
+		aabb<T, Q> Box = detail::empty_bounds<T, Q>();
+		detail::compute_bounding_volume<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::points(points, Box, 0);
+		return Box;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<T, Q> computeBounds(vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'computeBounds' accepts only floating-point inputs");
+		assert(boxMax.size() == boxMin.size());
+
+		aabb<T, Q> Box = detail::empty_bounds<T, Q>();
+		detail::compute_bounding_volume<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::boxes(boxMin, boxMax, Box, 0);
+		return Box;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<T, Q> computeBounds(obb<T, Q> const& box)
+	{
+		vec<3, T, Q> Extent(0);
+		for(length_t i = 0; i < 3; ++i)
+			Extent += abs(box.Axes[i]) * box.HalfExtents[i];
+
+		aabb<T, Q> Result;
+		Result.Min = box.Center - Extent;
+		Result.Max = box.Center + Extent;
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<T, Q> mergeBounds(aabb<T, Q> const& a, aabb<T, Q> const& b)
+	{
+		aabb<T, Q> Result;
+		Result.Min = min(a.Min, b.Min);
+		Result.Max = max(a.Max, b.Max);
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<T, Q> mergeBounds(aabb<T, Q> const& a, vec<3, T, Q> const& p)
+	{
+		aabb<T, Q> Result;
+		Result.Min = min(a.Min, p);
+		Result.Max = max(a.Max, p);
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER aabb<T, Q> transformBounds(mat<4, 4, T, Q> const& m, aabb<T, Q> const& box)
+	{
+		return detail::transform_bounds(m, box.Min, box.Max);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void transformBounds(
+		mat<4, 4, T, Q> const& m,
+		vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		vec_soa_view<3, T, Q> outMin, vec_soa_view<3, T, Q> outMax)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'transformBounds' accepts only floating-point inputs");
+		assert(boxMax.size() == boxMin.size() && outMin.size() == boxMin.size() && outMax.size() == boxMin.size());
+
+		detail::compute_bounding_volume<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::transform(m, boxMin, boxMax, outMin, outMax, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER obb<T, Q> computeOrientedBounds(vec<3, T, Q> const* points, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'computeOrientedBounds' accepts only floating-point inputs");
+		assert(count > 0);
+
+		covariance_accumulator<3, T, Q> Covariance;
+		accumulateCovariance(Covariance, points, count);
+
+		vec<3, T, Q> Variances;
+		mat<3, 3, T, Q> Axes;
+		if(findEigenvaluesSymRealJacobi(computeCovarianceMatrix(Covariance), Variances, Axes) == 3)
+			sortEigenvalues(Variances, Axes);
+		else
+			Axes = mat<3, 3, T, Q>(1);
+		Axes[2] = cross(Axes[0], Axes[1]);
+
+		// Extents along the axes, relative to the mean to keep the precision of points far from the origin
+		vec<3, T, Q> Low(std::numeric_limits<T>::infinity());
+		vec<3, T, Q> High(-std::numeric_limits<T>::infinity());
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			vec<3, T, Q> const Local = (points[i] - Covariance.Mean) * Axes;
+			Low = min(Low, Local);
+			High = max(High, Local);
+		}
+
+		obb<T, Q> Box;
+		Box.Center = Covariance.Mean + Axes * ((Low + High) * static_cast<T>(0.5));
+		Box.Axes = Axes;
+		Box.HalfExtents = (High - Low) * static_cast<T>(0.5);
+		return Box;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER obb<T, Q> computeOrientedBounds(aabb<T, Q> const& box)
+	{
+		obb<T, Q> Result;
+		Result.Center = (box.Min + box.Max) * static_cast<T>(0.5);
+		Result.Axes = mat<3, 3, T, Q>(1);
+		Result.HalfExtents = (box.Max - box.Min) * static_cast<T>(0.5);
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectBoxes(aabb<T, Q> const& a, aabb<T, Q> const& b)
+	{
+		return detail::overlap_bounds(a.Min, a.Max, b.Min, b.Max);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectBoxes(obb<T, Q> const& a, obb<T, Q> const& b)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'intersectBoxes' accepts only floating-point inputs");
+
+		// Rotation and translation of b in the frame of a. The epsilon keeps the cross product axes
+		// of nearly parallel edges, close to zero, from separating boxes by rounding.
+		T const Epsilon = std::numeric_limits<T>::epsilon() * static_cast<T>(16);
+		T R[3][3], AbsR[3][3];
+		for(length_t i = 0; i < 3; ++i)
+		for(length_t j = 0; j < 3; ++j)
+		{
+			R[i][j] = dot(a.Axes[i], b.Axes[j]);
+			AbsR[i][j] = abs(R[i][j]) + Epsilon;
+		}
+		vec<3, T, Q> const Translation = b.Center - a.Center;
+		T const t[3] = {dot(Translation, a.Axes[0]), dot(Translation, a.Axes[1]), dot(Translation, a.Axes[2])};
+
+		vec<3, T, Q> const& ea = a.HalfExtents;
+		vec<3, T, Q> const& eb = b.HalfExtents;
+
+		// Axes of a
+		for(length_t i = 0; i < 3; ++i)
+		{
+			T const ra = ea[i];
+			T const rb = eb[0] * AbsR[i][0] + eb[1] * AbsR[i][1] + eb[2] * AbsR[i][2];
+			if(abs(t[i]) > ra + rb)
+				return false;
+		}
+
+		// Axes of b
+		for(length_t j = 0; j < 3; ++j)
+		{
+			T const ra = ea[0] * AbsR[0][j] + ea[1] * AbsR[1][j] + ea[2] * AbsR[2][j];
+			T const rb = eb[j];
+			if(abs(t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j]) > ra + rb)
+				return false;
+		}
+
+		// Cross products of an axis of a and an axis of b
+		for(length_t i = 0; i < 3; ++i)
+		for(length_t j = 0; j < 3; ++j)
+		{
+			length_t const i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+			length_t const j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+			T const ra = ea[i1] * AbsR[i2][j] + ea[i2] * AbsR[i1][j];
+			T const rb = eb[j1] * AbsR[i][j2] + eb[j2] * AbsR[i][j1];
+			if(abs(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > ra + rb)
+				return false;
+		}
+
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectBoxes(obb<T, Q> const& a, aabb<T, Q> const& b)
+	{
+		return intersectBoxes(a, computeOrientedBounds(b));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectBoxes(aabb<T, Q> const& a, obb<T, Q> const& b)
+	{
+		return intersectBoxes(computeOrientedBounds(a), b);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t intersectBoxes(
+		aabb<T, Q> const& query,
+		vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		std::uint32_t* mask)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'intersectBoxes' accepts only floating-point inputs");
+		assert(boxMax.size() == boxMin.size());
+
+		for(std::size_t i = 0, n = (boxMin.size() + 31) / 32; i < n; ++i)
+			mask[i] = 0;
+
+		return detail::compute_bounding_volume<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::overlap(query, boxMin, boxMax, mask, 0);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "bounding_volume_simd.inl"
+#endif
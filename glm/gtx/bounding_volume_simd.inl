@@ -0,0 +1,249 @@
+/// @ref gtx_bounding_volume
+
+#include "../simd/bounding_volume.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	template<qualifier Q>
+	struct compute_bounding_volume<float, Q, true>
+	{
+		// Minimum and maximum of the components of an array
+		GLM_FUNC_QUALIFIER static void reduce(float const* in, std::size_t count, float& Min, float& Max)
+		{
+			std::size_t i = 0;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_f32vec8 Min8 = _mm256_set1_ps(Min);
+				glm_f32vec8 Max8 = _mm256_set1_ps(Max);
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_f32vec8 const v = _mm256_loadu_ps(in + i);
+					Min8 = _mm256_min_ps(Min8, v);
+					Max8 = _mm256_max_ps(Max8, v);
+				}
+				Min = glm_vec8_hmin(Min8);
+				Max = glm_vec8_hmax(Max8);
+			}
+#			endif
+			glm_f32vec4 Min4 = _mm_set1_ps(Min);
+			glm_f32vec4 Max4 = _mm_set1_ps(Max);
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_f32vec4 const v = _mm_loadu_ps(in + i);
+				Min4 = _mm_min_ps(Min4, v);
+				Max4 = _mm_max_ps(Max4, v);
+			}
+			Min = glm_vec4_hmin(Min4);
+			Max = glm_vec4_hmax(Max4);
+
+			for(; i < count; ++i)
+			{
+				Min = glm::min(Min, in[i]);
+				Max = glm::max(Max, in[i]);
+			}
+		}
+
+		// Lane l of the registers of a reduction of packed vec3 holds component l % 3
+		GLM_FUNC_QUALIFIER static void seed_lanes(aabb<float, Q> const& Box, int Count, float* Min, float* Max)
+		{
+			for(int l = 0; l < Count; ++l)
+			{
+				Min[l] = Box.Min[l % 3];
+				Max[l] = Box.Max[l % 3];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void reduce_lanes(float const* Min, float const* Max, int Count, aabb<float, Q>& Box)
+		{
+			for(int l = 0; l < Count; ++l)
+			{
+				Box.Min[l % 3] = glm::min(Box.Min[l % 3], Min[l]);
+				Box.Max[l % 3] = glm::max(Box.Max[l % 3], Max[l]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void points(vec<3, float, Q> const* points, std::size_t count, aabb<float, Q>& Box, std::size_t first)
+		{
+			if(sizeof(vec<3, float, Q>) != sizeof(float) * 3)
+			{
+				compute_bounding_volume<float, Q, false>::points(points, count, Box, first);
+				return;
+			}
+
+			float const* const In = reinterpret_cast<float const*>(points);
+			std::size_t i = first;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			if(i + 8 <= count)
+			{
+				float MinLanes[24], MaxLanes[24];
+				seed_lanes(Box, 24, MinLanes, MaxLanes);
+				glm_f32vec8 Min[3], Max[3];
+				for(int k = 0; k < 3; ++k)
+				{
+					Min[k] = _mm256_loadu_ps(MinLanes + 8 * k);
+					Max[k] = _mm256_loadu_ps(MaxLanes + 8 * k);
+				}
+				for(; i + 8 <= count; i += 8)
+					glm_minmax_aos8(In + 3 * i, Min, Max);
+
+				for(int k = 0; k < 3; ++k)
+				{
+					_mm256_storeu_ps(MinLanes + 8 * k, Min[k]);
+					_mm256_storeu_ps(MaxLanes + 8 * k, Max[k]);
+				}
+				reduce_lanes(MinLanes, MaxLanes, 24, Box);
+			}
+#			endif
+			if(i + 4 <= count)
+			{
+				float MinLanes[12], MaxLanes[12];
+				seed_lanes(Box, 12, MinLanes, MaxLanes);
+				glm_f32vec4 Min[3], Max[3];
+				for(int k = 0; k < 3; ++k)
+				{
+					Min[k] = _mm_loadu_ps(MinLanes + 4 * k);
+					Max[k] = _mm_loadu_ps(MaxLanes + 4 * k);
+				}
+				for(; i + 4 <= count; i += 4)
+					glm_minmax_aos4(In + 3 * i, Min, Max);
+
+				for(int k = 0; k < 3; ++k)
+				{
+					_mm_storeu_ps(MinLanes + 4 * k, Min[k]);
+					_mm_storeu_ps(MaxLanes + 4 * k, Max[k]);
+				}
+				reduce_lanes(MinLanes, MaxLanes, 12, Box);
+			}
+
+			compute_bounding_volume<float, Q, false>::points(points, count, Box, i);
+		}
+
+		GLM_FUNC_QUALIFIER static void points(vec_soa_const_view<3, float, Q> const& points, aabb<float, Q>& Box, std::size_t first)
+		{
+			std::size_t const count = points.size() - first;
+			for(length_t c = 0; c < 3; ++c)
+				reduce(points[c] + first, count, Box.Min[c], Box.Max[c]);
+		}
+
+		GLM_FUNC_QUALIFIER static void boxes(vec_soa_const_view<3, float, Q> const& boxMin, vec_soa_const_view<3, float, Q> const& boxMax, aabb<float, Q>& Box, std::size_t first)
+		{
+			std::size_t const count = boxMin.size() - first;
+			for(length_t c = 0; c < 3; ++c)
+			{
+				float Unused = -std::numeric_limits<float>::infinity();
+				reduce(boxMin[c] + first, count, Box.Min[c], Unused);
+				Unused = std::numeric_limits<float>::infinity();
+				reduce(boxMax[c] + first, count, Unused, Box.Max[c]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void transform(
+			mat<4, 4, float, Q> const& m,
+			vec_soa_const_view<3, float, Q> const& boxMin, vec_soa_const_view<3, float, Q> const& boxMax,
+			vec_soa_view<3, float, Q>& outMin, vec_soa_view<3, float, Q>& outMax, std::size_t first)
+		{
+			float Elements[16];
+			for(length_t c = 0; c < 4; ++c)
+			for(length_t r = 0; r < 4; ++r)
+				Elements[c * 4 + r] = m[c][r];
+
+			std::size_t const count = boxMin.size() - first;
+			std::size_t const simd = first + count - count % 4;
+
+			std::size_t i = first;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_f32vec8 e[16], a[16];
+				glm_aabb_transform_splat8(Elements, e, a);
+				for(; i + 8 <= simd; i += 8)
+				{
+					glm_f32vec8 InMin[3], InMax[3], OutMin[3], OutMax[3];
+					for(length_t c = 0; c < 3; ++c)
+					{
+						InMin[c] = _mm256_loadu_ps(boxMin[c] + i);
+						InMax[c] = _mm256_loadu_ps(boxMax[c] + i);
+					}
+					glm_aabb_transform_soa8(e, a, InMin, InMax, OutMin, OutMax);
+					for(length_t c = 0; c < 3; ++c)
+					{
+						_mm256_storeu_ps(outMin[c] + i, OutMin[c]);
+						_mm256_storeu_ps(outMax[c] + i, OutMax[c]);
+					}
+				}
+			}
+#			endif
+			glm_f32vec4 e[16], a[16];
+			glm_aabb_transform_splat4(Elements, e, a);
+			for(; i < simd; i += 4)
+			{
+				glm_f32vec4 InMin[3], InMax[3], OutMin[3], OutMax[3];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					InMin[c] = _mm_loadu_ps(boxMin[c] + i);
+					InMax[c] = _mm_loadu_ps(boxMax[c] + i);
+				}
+				glm_aabb_transform_soa4(e, a, InMin, InMax, OutMin, OutMax);
+				for(length_t c = 0; c < 3; ++c)
+				{
+					_mm_storeu_ps(outMin[c] + i, OutMin[c]);
+					_mm_storeu_ps(outMax[c] + i, OutMax[c]);
+				}
+			}
+
+			compute_bounding_volume<float, Q, false>::transform(m, boxMin, boxMax, outMin, outMax, simd);
+		}
+
+		// Blocks of 4 and 8 boxes start at multiples of 4 and 8 so that their bits never straddle two words of the mask
+		GLM_FUNC_QUALIFIER static std::size_t overlap(
+			aabb<float, Q> const& query,
+			vec_soa_const_view<3, float, Q> const& boxMin, vec_soa_const_view<3, float, Q> const& boxMax,
+			std::uint32_t* mask, std::size_t first)
+		{
+			assert(first % 8 == 0);
+
+			std::size_t const count = boxMin.size() - first;
+			std::size_t const simd = first + count - count % 4;
+			std::size_t Count = 0;
+
+			std::size_t i = first;
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+			{
+				glm_f32vec8 const QueryMin[3] = {_mm256_set1_ps(query.Min.x), _mm256_set1_ps(query.Min.y), _mm256_set1_ps(query.Min.z)};
+				glm_f32vec8 const QueryMax[3] = {_mm256_set1_ps(query.Max.x), _mm256_set1_ps(query.Max.y), _mm256_set1_ps(query.Max.z)};
+				for(; i + 8 <= simd; i += 8)
+				{
+					glm_f32vec8 BoxMin[3], BoxMax[3];
+					for(length_t c = 0; c < 3; ++c)
+					{
+						BoxMin[c] = _mm256_loadu_ps(boxMin[c] + i);
+						BoxMax[c] = _mm256_loadu_ps(boxMax[c] + i);
+					}
+					int const Mask = _mm256_movemask_ps(glm_aabb_overlap_soa8(QueryMin, QueryMax, BoxMin, BoxMax));
+					mask[i / 32] |= static_cast<std::uint32_t>(Mask) << (i % 32);
+					Count += static_cast<std::size_t>(bitCount(Mask));
+				}
+			}
+#			endif
+			glm_f32vec4 const QueryMin[3] = {_mm_set1_ps(query.Min.x), _mm_set1_ps(query.Min.y), _mm_set1_ps(query.Min.z)};
+			glm_f32vec4 const QueryMax[3] = {_mm_set1_ps(query.Max.x), _mm_set1_ps(query.Max.y), _mm_set1_ps(query.Max.z)};
+			for(; i < simd; i += 4)
+			{
+				glm_f32vec4 BoxMin[3], BoxMax[3];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					BoxMin[c] = _mm_loadu_ps(boxMin[c] + i);
+					BoxMax[c] = _mm_loadu_ps(boxMax[c] + i);
+				}
+				int const Mask = _mm_movemask_ps(glm_aabb_overlap_soa4(QueryMin, QueryMax, BoxMin, BoxMax));
+				mask[i / 32] |= static_cast<std::uint32_t>(Mask) << (i % 32);
+				Count += static_cast<std::size_t>(bitCount(Mask));
+			}
+
+			return Count + compute_bounding_volume<float, Q, false>::overlap(query, boxMin, boxMax, mask, simd);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
@@ -0,0 +1,191 @@
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.hpp
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+/// @see ext_vector_soa (dependence)
+///
+/// @defgroup gtx_bvh GLM_GTX_bvh
+/// @ingroup gtx
+///
+/// Include <glm/gtx/bvh.hpp> to use the features of this extension.
+///
+/// Bounding volume hierarchy over the axis aligned bounding boxes of primitives, so that ray, box and sphere
+/// queries visit O(log n) primitives instead of all of them. The exact ray tests are the ones of gtx_intersect.
+///
+/// The hierarchy is built top-down with binned surface area heuristic splits, optionally on several threads.
+/// Nodes are stored in a single array in depth-first order, the two children of an inner node being adjacent,
+/// so that the traversal reads memory mostly forward. The result doesn't depend on the number of threads.
+///
+/// Example:
+/// ```
+/// glm::vec3_soa Vert0, Vert1, Vert2;
+/// // ... fill the triangles
+///
+/// glm::vec3_soa BoxMin(Vert0.size()), BoxMax(Vert0.size());
+/// glm::computeTriangleBounds(Vert0, Vert1, Vert2, BoxMin, BoxMax);
+///
+/// glm::bvh<float> Bvh;
+/// Bvh.build(BoxMin, BoxMax);
+///
+/// glm::vec2 Bary;
+/// float Distance;
+/// std::size_t Triangle;
+/// if(glm::intersectRayTriangle(Bvh, Orig, Dir, Vert0, Vert1, Vert2, Bary, Distance, Triangle))
+///     // ... Triangle is the nearest triangle hit by the ray
+/// ```
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+#include "../ext/vector_soa.hpp"
+#include "../gtx/intersect.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#ifndef GLM_ENABLE_EXPERIMENTAL
+#	error "GLM: GLM_GTX_bvh is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
+#elif GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	pragma message("GLM: GLM_GTX_bvh extension included")
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_bvh
+	/// @{
+
+	/// Node of a bvh, bounding the primitives of its subtree.
+	/// An inner node has Count == 0 and its children are the nodes First and First + 1.
+	/// A leaf has Count > 0 primitives, listed by bvh::indices() from First.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q = defaultp>
+	struct bvh_node
+	{
+		vec<3, T, Q> Min;
+		std::uint32_t First;
+		vec<3, T, Q> Max;
+		std::uint32_t Count;
+	};
+
+	/// Bounding volume hierarchy over primitives given by their axis aligned bounding boxes.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q = defaultp>
+	struct bvh
+	{
+		typedef bvh_node<T, Q> node_type;
+
+		GLM_FUNC_DISCARD_DECL bvh();
+
+		/// Builds the hierarchy of the boxMin.size() primitives, primitive i being bounded by boxMin[i] and boxMax[i].
+		/// The bounds are only read during the build.
+		///
+		/// @param leafSize Maximum number of primitives per leaf, at least 1
+		/// @param threads Maximum number of threads building subtrees concurrently, rounded down to a power of two, 1 builds on the calling thread only
+		GLM_FUNC_DISCARD_DECL void build(vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax, std::size_t leafSize = 4, unsigned threads = 1);
+
+		/// Number of primitives
+		GLM_FUNC_DECL std::size_t size() const;
+
+		GLM_FUNC_DECL bool empty() const;
+
+		/// Nodes in depth-first order, the root being the first one
+		GLM_FUNC_DECL std::vector<node_type> const& nodes() const;
+
+		/// Primitives referenced by the leaves
+		GLM_FUNC_DECL std::vector<std::uint32_t> const& indices() const;
+
+	private:
+		std::vector<node_type> Nodes;
+		std::vector<std::uint32_t> Indices;
+	};
+
+	/// Computes the bounding boxes of the triangles vert0[i], vert1[i] and vert2[i] in boxMin and boxMax.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void computeTriangleBounds(
+		vec_soa_const_view<3, T, Q> const& vert0, vec_soa_const_view<3, T, Q> const& vert1, vec_soa_const_view<3, T, Q> const& vert2,
+		vec_soa_view<3, T, Q> boxMin, vec_soa_view<3, T, Q> boxMax);
+
+	/// Computes the bounding boxes of the spheres of centers center[i] and radii radius[i] in boxMin and boxMax.
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void computeSphereBounds(
+		vec_soa_const_view<3, T, Q> const& center, T const* radius,
+		vec_soa_view<3, T, Q> boxMin, vec_soa_view<3, T, Q> boxMax);
+
+	/// Finds the nearest triangle hit by a ray among the triangles of a bvh built from their bounds,
+	/// using intersectRayTriangle. When several triangles are hit at the nearest distance, the one with the lowest index is returned.
+	///
+	/// @param baryPosition Barycentric coordinates of the hit in the nearest triangle
+	/// @param distance Distance of the nearest hit, in multiples of the length of dir
+	/// @param index Index of the nearest triangle
+	/// @return true if a triangle is hit in front of the origin, false otherwise and the outputs are left unchanged
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayTriangle(
+		bvh<T, Q> const& tree,
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec_soa_const_view<3, T, Q> const& vert0, vec_soa_const_view<3, T, Q> const& vert1, vec_soa_const_view<3, T, Q> const& vert2,
+		vec<2, T, Q>& baryPosition, T& distance, std::size_t& index);
+
+	/// Finds the nearest sphere hit by a ray among the spheres of a bvh built from their bounds,
+	/// using intersectRaySphere. When several spheres are hit at the nearest distance, the one with the lowest index is returned.
+	///
+	/// @param rayNormalizedDirection Direction of the ray, unit length
+	/// @param intersectionDistance Distance of the nearest hit, as computed by intersectRaySphere
+	/// @param index Index of the nearest sphere
+	/// @return true if a sphere is hit, false otherwise and the outputs are left unchanged
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRaySphere(
+		bvh<T, Q> const& tree,
+		vec<3, T, Q> const& rayStarting, vec<3, T, Q> const& rayNormalizedDirection,
+		vec_soa_const_view<3, T, Q> const& sphereCenter, T const* sphereRadius,
+		T& intersectionDistance, std::size_t& index);
+
+	/// Appends to out the primitives whose bounding box, boxMin[i] and boxMax[i] as given to bvh::build,
+	/// overlaps the box of corners queryMin and queryMax. Touching boxes overlap.
+	///
+	/// @return The number of primitives appended
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL std::size_t queryBox(
+		bvh<T, Q> const& tree,
+		vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		vec<3, T, Q> const& queryMin, vec<3, T, Q> const& queryMax,
+		std::vector<std::size_t>& out);
+
+	/// Appends to out the primitives whose bounding box, boxMin[i] and boxMax[i] as given to bvh::build,
+	/// overlaps the sphere of center queryCenter and radius queryRadius. Touching volumes overlap.
+	///
+	/// @return The number of primitives appended
+	///
+	/// @tparam T Floating-point scalar types
+	/// @tparam Q Value from qualifier enum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL std::size_t querySphere(
+		bvh<T, Q> const& tree,
+		vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		vec<3, T, Q> const& queryCenter, T queryRadius,
+		std::vector<std::size_t>& out);
+
+	/// @}
+}//namespace glm
+
+#include "bvh.inl"
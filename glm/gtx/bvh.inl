@@ -0,0 +1,536 @@
+/// @ref gtx_bvh
+
+#include "../common.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <limits>
+#include <thread>
+
+namespace glm{
+namespace detail
+{
+	// Traversal stack size: the build switches to median splits below depth 32, which bounds the depth to 64 for 2^32 primitives
+	static std::size_t const bvh_max_depth = 64;
+	static std::size_t const bvh_sah_depth = 32;
+
+	// Number of bins of the surface area heuristic split search
+	static std::size_t const bvh_bins = 16;
+
+	// Subtrees with fewer primitives are built on the thread of their parent
+	static std::size_t const bvh_parallel_count = 1024;
+
+	// Levels of the tree whose subtrees are built on a new thread, each level doubling the number of
+	// threads building concurrently: 2^levels is the largest power of two not above threads
+	GLM_FUNC_QUALIFIER std::size_t bvh_thread_levels(unsigned threads)
+	{
+		std::size_t Levels = 0;
+		while((static_cast<std::size_t>(2) << Levels) <= static_cast<std::size_t>(threads))
+			++Levels;
+		return Levels;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T bvh_half_area(vec<3, T, Q> const& Min, vec<3, T, Q> const& Max)
+	{
+		vec<3, T, Q> const d = Max - Min;
+		return d.x * d.y + d.y * d.z + d.z * d.x;
+	}
+
+	template<typename T, qualifier Q>
+	struct bvh_builder
+	{
+		struct bin
+		{
+			vec<3, T, Q> Min;
+			vec<3, T, Q> Max;
+			std::size_t Count;
+		};
+
+		vec_soa_const_view<3, T, Q> BoxMin;
+		vec_soa_const_view<3, T, Q> BoxMax;
+		std::vector<vec<3, T, Q> > Centroids;
+		std::uint32_t* Indices;
+		bvh_node<T, Q>* Nodes;
+		std::atomic<std::uint32_t> NodeCount;
+		std::size_t LeafSize;
+
+		GLM_FUNC_QUALIFIER std::size_t bin_index(T Centroid, T Origin, T Scale) const
+		{
+			T const Bin = (Centroid - Origin) * Scale;
+			return Bin > static_cast<T>(0) ? glm::min(static_cast<std::size_t>(Bin), bvh_bins - 1) : 0;
+		}
+
+		// Builds the subtree of node from the primitives Indices[begin] to Indices[end - 1], recursive so never forced inline
+		GLM_NEVER_INLINE void build(std::uint32_t node, std::size_t begin, std::size_t end, std::size_t depth, std::size_t threadLevels)
+		{
+			vec<3, T, Q> Min(std::numeric_limits<T>::max());
+			vec<3, T, Q> Max(-std::numeric_limits<T>::max());
+			vec<3, T, Q> CentroidMin(Min);
+			vec<3, T, Q> CentroidMax(Max);
+			for(std::size_t i = begin; i < end; ++i)
+			{
+				std::uint32_t const Primitive = Indices[i];
+				Min = glm::min(Min, BoxMin.load(Primitive));
+				Max = glm::max(Max, BoxMax.load(Primitive));
+				CentroidMin = glm::min(CentroidMin, Centroids[Primitive]);
+				CentroidMax = glm::max(CentroidMax, Centroids[Primitive]);
+			}
+
+			bvh_node<T, Q>& Node = Nodes[node];
+			Node.Min = Min;
+			Node.Max = Max;
+
+			std::size_t const Count = end - begin;
+			if(Count <= LeafSize)
+			{
+				Node.First = static_cast<std::uint32_t>(begin);
+				Node.Count = static_cast<std::uint32_t>(Count);
+				return;
+			}
+
+			std::size_t const Mid = split(begin, end, depth, CentroidMin, CentroidMax);
+
+			std::uint32_t const Left = NodeCount.fetch_add(2);
+			Node.First = Left;
+			Node.Count = 0;
+
+			if(threadLevels > 0 && Count >= bvh_parallel_count)
+			{
+				std::thread Thread(&bvh_builder::build, this, Left, begin, Mid, depth + 1, threadLevels - 1);
+				build(Left + 1, Mid, end, depth + 1, threadLevels - 1);
+				Thread.join();
+			}
+			else
+			{
+				build(Left, begin, Mid, depth + 1, 0);
+				build(Left + 1, Mid, end, depth + 1, 0);
+			}
+		}
+
+		// Partitions the primitives of a node and returns the first primitive of the right child
+		GLM_FUNC_QUALIFIER std::size_t split(std::size_t begin, std::size_t end, std::size_t depth, vec<3, T, Q> const& CentroidMin, vec<3, T, Q> const& CentroidMax)
+		{
+			vec<3, T, Q> const Extent = CentroidMax - CentroidMin;
+
+			if(depth < bvh_sah_depth)
+			{
+				T BestCost = std::numeric_limits<T>::infinity();
+				length_t BestAxis = 0;
+				std::size_t BestBin = 0;
+
+				for(length_t Axis = 0; Axis < 3; ++Axis)
+				{
+					if(!(Extent[Axis] > static_cast<T>(0)))
+						continue;
+
+					T const Scale = static_cast<T>(bvh_bins) / Extent[Axis];
+					bin Bins[bvh_bins];
+					for(std::size_t b = 0; b < bvh_bins; ++b)
+					{
+						Bins[b].Min = vec<3, T, Q>(std::numeric_limits<T>::max());
+						Bins[b].Max = vec<3, T, Q>(-std::numeric_limits<T>::max());
+						Bins[b].Count = 0;
+					}
+					for(std::size_t i = begin; i < end; ++i)
+					{
+						std::uint32_t const Primitive = Indices[i];
+						bin& Bin = Bins[bin_index(Centroids[Primitive][Axis], CentroidMin[Axis], Scale)];
+						Bin.Min = glm::min(Bin.Min, BoxMin.load(Primitive));
+						Bin.Max = glm::max(Bin.Max, BoxMax.load(Primitive));
+						++Bin.Count;
+					}
+
+					// Cost of the primitives left of each split, then added to the cost of the ones right of it
+					T Costs[bvh_bins - 1];
+					vec<3, T, Q> SideMin = Bins[0].Min;
+					vec<3, T, Q> SideMax = Bins[0].Max;
+					std::size_t SideCount = 0;
+					for(std::size_t b = 0; b < bvh_bins - 1; ++b)
+					{
+						SideMin = glm::min(SideMin, Bins[b].Min);
+						SideMax = glm::max(SideMax, Bins[b].Max);
+						SideCount += Bins[b].Count;
+						Costs[b] = SideCount > 0 ? bvh_half_area(SideMin, SideMax) * static_cast<T>(SideCount) : std::numeric_limits<T>::infinity();
+					}
+					SideMin = Bins[bvh_bins - 1].Min;
+					SideMax = Bins[bvh_bins - 1].Max;
+					SideCount = 0;
+					for(std::size_t b = bvh_bins - 1; b > 0; --b)
+					{
+						SideMin = glm::min(SideMin, Bins[b].Min);
+						SideMax = glm::max(SideMax, Bins[b].Max);
+						SideCount += Bins[b].Count;
+						T const Cost = SideCount > 0 ? Costs[b - 1] + bvh_half_area(SideMin, SideMax) * static_cast<T>(SideCount) : std::numeric_limits<T>::infinity();
+						if(Cost < BestCost)
+						{
+							BestCost = Cost;
+							BestAxis = Axis;
+							BestBin = b - 1;
+						}
+					}
+				}
+
+				if(BestCost < std::numeric_limits<T>::infinity())
+				{
+					T const Origin = CentroidMin[BestAxis];
+					T const Scale = static_cast<T>(bvh_bins) / Extent[BestAxis];
+					std::uint32_t* const Mid = std::partition(Indices + begin, Indices + end, [&](std::uint32_t Primitive)
+					{
+						return this->bin_index(this->Centroids[Primitive][BestAxis], Origin, Scale) <= BestBin;
+					});
+					std::size_t const Split = static_cast<std::size_t>(Mid - Indices);
+					if(Split > begin && Split < end)
+						return Split;
+				}
+			}
+
+			// Median split along the largest extent, when the heuristic is disabled or the centroids are too close to be separated
+			length_t Axis = Extent.x > Extent.y ? 0 : 1;
+			Axis = Extent[Axis] > Extent.z ? Axis : 2;
+			std::size_t const Split = begin + (end - begin) / 2;
+			std::nth_element(Indices + begin, Indices + Split, Indices + end, [&](std::uint32_t a, std::uint32_t b)
+			{
+				T const ca = this->Centroids[a][Axis];
+				T const cb = this->Centroids[b][Axis];
+				return ca < cb || (!(cb < ca) && a < b);
+			});
+			return Split;
+		}
+
+		// Copies the subtree of src to dst in depth-first order, children pairs being appended before their subtrees
+		GLM_NEVER_INLINE static void flatten(bvh_node<T, Q> const* src, std::uint32_t node, std::vector<bvh_node<T, Q> >& dst, std::size_t at)
+		{
+			if(src[node].Count > 0)
+				return;
+
+			std::uint32_t const Left = src[node].First;
+			std::uint32_t const Child = static_cast<std::uint32_t>(dst.size());
+			dst[at].First = Child;
+			dst.push_back(src[Left]);
+			dst.push_back(src[Left + 1]);
+			flatten(src, Left, dst, Child);
+			flatten(src, Left + 1, dst, Child + 1);
+		}
+	};
+
+	// Slab test of a ray against a box, conservatively rounded so that a primitive hit by the ray isn't culled
+	// by a rounding error of its box. Returns the entry distance in enter when the box is hit before maxDistance.
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool bvh_ray_box(
+		bvh_node<T, Q> const& node, vec<3, T, Q> const& orig, vec<3, T, Q> const& invDir, T maxDistance, T& enter)
+	{
+		T const Tolerance = static_cast<T>(1) + static_cast<T>(8) * std::numeric_limits<T>::epsilon();
+
+		T Enter = static_cast<T>(0);
+		T Exit = std::numeric_limits<T>::infinity();
+		for(length_t c = 0; c < 3; ++c)
+		{
+			T Near = (node.Min[c] - orig[c]) * invDir[c];
+			T Far = (node.Max[c] - orig[c]) * invDir[c];
+			if(Near > Far)
+				std::swap(Near, Far);
+
+			// NaN, for a ray parallel to a face of the box starting in its plane, doesn't restrict the range
+			Enter = Near > Enter ? Near : Enter;
+			Exit = Far < Exit ? Far : Exit;
+		}
+
+		enter = Enter;
+		return Enter <= Exit * Tolerance && Enter <= maxDistance * Tolerance;
+	}
+
+	// Visits the leaves hit by a ray from the nearest, skipping the nodes entered after the current nearest distance.
+	// visit(primitive, nearest) tests a primitive and updates nearest when it is hit nearer.
+	template<typename T, qualifier Q, typename visitor>
+	GLM_FUNC_QUALIFIER void bvh_traverse_ray(bvh<T, Q> const& tree, vec<3, T, Q> const& orig, vec<3, T, Q> const& dir, T& nearest, visitor visit)
+	{
+		if(tree.empty())
+			return;
+
+		bvh_node<T, Q> const* const Nodes = &tree.nodes()[0];
+		std::uint32_t const* const Indices = &tree.indices()[0];
+		vec<3, T, Q> const InvDir = static_cast<T>(1) / dir;
+
+		std::uint32_t Stack[bvh_max_depth + 1];
+		std::size_t Size = 0;
+
+		T Enter;
+		if(bvh_ray_box(Nodes[0], orig, InvDir, nearest, Enter))
+			Stack[Size++] = 0;
+
+		while(Size > 0)
+		{
+			bvh_node<T, Q> const& Node = Nodes[Stack[--Size]];
+			if(Node.Count > 0)
+			{
+				for(std::uint32_t i = Node.First; i < Node.First + Node.Count; ++i)
+					visit(Indices[i], nearest);
+				continue;
+			}
+
+			T EnterLeft, EnterRight;
+			bool const HitLeft = bvh_ray_box(Nodes[Node.First], orig, InvDir, nearest, EnterLeft);
+			bool const HitRight = bvh_ray_box(Nodes[Node.First + 1], orig, InvDir, nearest, EnterRight);
+
+			assert(Size + 2 <= bvh_max_depth + 1);
+			if(HitLeft && HitRight)
+			{
+				// The nearest child is popped first
+				bool const LeftFirst = !(EnterRight < EnterLeft);
+				Stack[Size++] = Node.First + (LeftFirst ? 1u : 0u);
+				Stack[Size++] = Node.First + (LeftFirst ? 0u : 1u);
+			}
+			else if(HitLeft)
+				Stack[Size++] = Node.First;
+			else if(HitRight)
+				Stack[Size++] = Node.First + 1;
+		}
+	}
+
+	// Visits the primitives whose box overlaps a volume, overlap(min, max) testing a box
+	template<typename T, qualifier Q, typename tester>
+	GLM_FUNC_QUALIFIER std::size_t bvh_query(
+		bvh<T, Q> const& tree, vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		tester overlap, std::vector<std::size_t>& out)
+	{
+		if(tree.empty())
+			return 0;
+
+		bvh_node<T, Q> const* const Nodes = &tree.nodes()[0];
+		std::uint32_t const* const Indices = &tree.indices()[0];
+
+		std::uint32_t Stack[bvh_max_depth + 1];
+		std::size_t Size = 0;
+		std::size_t const Appended = out.size();
+
+		if(overlap(Nodes[0].Min, Nodes[0].Max))
+			Stack[Size++] = 0;
+
+		while(Size > 0)
+		{
+			bvh_node<T, Q> const& Node = Nodes[Stack[--Size]];
+			if(Node.Count > 0)
+			{
+				for(std::uint32_t i = Node.First; i < Node.First + Node.Count; ++i)
+				{
+					if(overlap(boxMin.load(Indices[i]), boxMax.load(Indices[i])))
+						out.push_back(Indices[i]);
+				}
+				continue;
+			}
+
+			assert(Size + 2 <= bvh_max_depth + 1);
+			if(overlap(Nodes[Node.First + 1].Min, Nodes[Node.First + 1].Max))
+				Stack[Size++] = Node.First + 1;
+			if(overlap(Nodes[Node.First].Min, Nodes[Node.First].Max))
+				Stack[Size++] = Node.First;
+		}
+
+		return out.size() - Appended;
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bvh<T, Q>::bvh()
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void bvh<T, Q>::build(vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax, std::size_t leafSize, unsigned threads)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'bvh' accepts only floating-point inputs");
+		assert(boxMax.size() == boxMin.size());
+		assert(leafSize > 0);
+		assert(boxMin.size() <= static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max() / 2));
+
+		std::size_t const Count = boxMin.size();
+		this->Nodes.clear();
+		this->Indices.resize(Count);
+		if(Count == 0)
+			return;
+
+		for(std::size_t i = 0; i < Count; ++i)
+			this->Indices[i] = static_cast<std::uint32_t>(i);
+
+		// A tree of Count non empty leaves has 2 * Count - 1 nodes
+		std::vector<node_type> Tree(2 * Count - 1);
+
+		detail::bvh_builder<T, Q> Builder;
+		Builder.BoxMin = boxMin;
+		Builder.BoxMax = boxMax;
+		Builder.Centroids.resize(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Builder.Centroids[i] = (boxMin.load(i) + boxMax.load(i)) * static_cast<T>(0.5);
+		Builder.Indices = &this->Indices[0];
+		Builder.Nodes = &Tree[0];
+		Builder.NodeCount = 1;
+		Builder.LeafSize = glm::max<std::size_t>(leafSize, 1);
+
+		Builder.build(0, 0, Count, 0, detail::bvh_thread_levels(threads));
+
+		// Nodes are allocated in an order depending on the threads scheduling
+		this->Nodes.reserve(Builder.NodeCount);
+		this->Nodes.push_back(Tree[0]);
+		detail::bvh_builder<T, Q>::flatten(&Tree[0], 0, this->Nodes, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t bvh<T, Q>::size() const
+	{
+		return this->Indices.size();
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool bvh<T, Q>::empty() const
+	{
+		return this->Nodes.empty();
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::vector<typename bvh<T, Q>::node_type> const& bvh<T, Q>::nodes() const
+	{
+		return this->Nodes;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::vector<std::uint32_t> const& bvh<T, Q>::indices() const
+	{
+		return this->Indices;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void computeTriangleBounds(
+		vec_soa_const_view<3, T, Q> const& vert0, vec_soa_const_view<3, T, Q> const& vert1, vec_soa_const_view<3, T, Q> const& vert2,
+		vec_soa_view<3, T, Q> boxMin, vec_soa_view<3, T, Q> boxMax)
+	{
+		assert(vert1.size() == vert0.size() && vert2.size() == vert0.size());
+		assert(boxMin.size() == vert0.size() && boxMax.size() == vert0.size());
+
+		for(length_t c = 0; c < 3; ++c)
+		for(std::size_t i = 0; i < vert0.size(); ++i)
+		{
+			boxMin[c][i] = glm::min(glm::min(vert0[c][i], vert1[c][i]), vert2[c][i]);
+			boxMax[c][i] = glm::max(glm::max(vert0[c][i], vert1[c][i]), vert2[c][i]);
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void computeSphereBounds(
+		vec_soa_const_view<3, T, Q> const& center, T const* radius,
+		vec_soa_view<3, T, Q> boxMin, vec_soa_view<3, T, Q> boxMax)
+	{
+		assert(boxMin.size() == center.size() && boxMax.size() == center.size());
+
+		for(length_t c = 0; c < 3; ++c)
+		for(std::size_t i = 0; i < center.size(); ++i)
+		{
+			boxMin[c][i] = center[c][i] - radius[i];
+			boxMax[c][i] = center[c][i] + radius[i];
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayTriangle(
+		bvh<T, Q> const& tree,
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec_soa_const_view<3, T, Q> const& vert0, vec_soa_const_view<3, T, Q> const& vert1, vec_soa_const_view<3, T, Q> const& vert2,
+		vec<2, T, Q>& baryPosition, T& distance, std::size_t& index)
+	{
+		assert(vert0.size() == tree.size() && vert1.size() == tree.size() && vert2.size() == tree.size());
+
+		bool Hit = false;
+		vec<2, T, Q> NearestBary(0);
+		std::size_t NearestIndex = 0;
+		T Nearest = std::numeric_limits<T>::infinity();
+
+		detail::bvh_traverse_ray(tree, orig, dir, Nearest, [&](std::size_t i, T& nearest)
+		{
+			vec<2, T, Q> Bary;
+			T Distance;
+			if(!intersectRayTriangle(orig, dir, vert0.load(i), vert1.load(i), vert2.load(i), Bary, Distance) || !(Distance >= static_cast<T>(0)))
+				return;
+			if(Hit && (Distance > nearest || (Distance == nearest && i > NearestIndex)))
+				return;
+
+			Hit = true;
+			NearestBary = Bary;
+			NearestIndex = i;
+			nearest = Distance;
+		});
+
+		if(!Hit)
+			return false;
+
+		baryPosition = NearestBary;
+		distance = Nearest;
+		index = NearestIndex;
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRaySphere(
+		bvh<T, Q> const& tree,
+		vec<3, T, Q> const& rayStarting, vec<3, T, Q> const& rayNormalizedDirection,
+		vec_soa_const_view<3, T, Q> const& sphereCenter, T const* sphereRadius,
+		T& intersectionDistance, std::size_t& index)
+	{
+		assert(sphereCenter.size() == tree.size());
+
+		bool Hit = false;
+		std::size_t NearestIndex = 0;
+		T Nearest = std::numeric_limits<T>::infinity();
+
+		detail::bvh_traverse_ray(tree, rayStarting, rayNormalizedDirection, Nearest, [&](std::size_t i, T& nearest)
+		{
+			T Distance;
+			if(!intersectRaySphere(rayStarting, rayNormalizedDirection, sphereCenter.load(i), sphereRadius[i] * sphereRadius[i], Distance))
+				return;
+			if(Hit && (Distance > nearest || (Distance == nearest && i > NearestIndex)))
+				return;
+
+			Hit = true;
+			NearestIndex = i;
+			nearest = Distance;
+		});
+
+		if(!Hit)
+			return false;
+
+		intersectionDistance = Nearest;
+		index = NearestIndex;
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t queryBox(
+		bvh<T, Q> const& tree,
+		vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		vec<3, T, Q> const& queryMin, vec<3, T, Q> const& queryMax,
+		std::vector<std::size_t>& out)
+	{
+		assert(boxMin.size() == tree.size() && boxMax.size() == tree.size());
+
+		return detail::bvh_query(tree, boxMin, boxMax, [&](vec<3, T, Q> const& Min, vec<3, T, Q> const& Max)
+		{
+			return all(lessThanEqual(Min, queryMax)) && all(lessThanEqual(queryMin, Max));
+		}, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t querySphere(
+		bvh<T, Q> const& tree,
+		vec_soa_const_view<3, T, Q> const& boxMin, vec_soa_const_view<3, T, Q> const& boxMax,
+		vec<3, T, Q> const& queryCenter, T queryRadius,
+		std::vector<std::size_t>& out)
+	{
+		assert(boxMin.size() == tree.size() && boxMax.size() == tree.size());
+
+		T const RadiusSquared = queryRadius * queryRadius;
+		return detail::bvh_query(tree, boxMin, boxMax, [&](vec<3, T, Q> const& Min, vec<3, T, Q> const& Max)
+		{
+			vec<3, T, Q> const Closest = clamp(queryCenter, Min, Max);
+			vec<3, T, Q> const d = Closest - queryCenter;
+			return dot(d, d) <= RadiusSquared;
+		}, out);
+	}
+}//namespace glm
@@ -9,6 +9,13 @@
 /// Include <glm/gtx/matrix_decompose.hpp> to use the features of this extension.
 ///
 /// Decomposes a model matrix to translations, rotation and scale components
+///
+/// decomposeAffine and recomposeAffine skip the perspective partition of affine transforms, and have batch variants
+/// processing arrays of mat4 or mat3x4 on several threads. A mat3x4 holds an affine transform in the layout of
+/// GLM_EXT_matrix_affine, the upper 3 rows of the mat4 one row per column, so that the batches exchange transforms
+/// with affineMultiply and affineTransformPoint. Internally, the float batch variants process 4 or 8
+/// matrices at a time using SSE2 or AVX2 when available, with the same results as the single matrix functions
+/// as long as the compiler doesn't contract multiply and add into FMA instructions.
 
 #pragma once
 
@@ -19,6 +26,8 @@
 #include "../geometric.hpp"
 #include "../gtc/quaternion.hpp"
 #include "../gtc/matrix_transform.hpp"
+#include "../ext/matrix_affine.hpp"
+#include <cstddef>
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_matrix_decompose is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -44,6 +53,68 @@ namespace glm
 		vec<3, T, Q> const& scale, qua<T, Q> const& orientation, vec<3, T, Q> const& translation,
 		vec<3, T, Q> const& skew, vec<4, T, Q> const& perspective);
 
+	/// Decomposes an affine transform to translation, rotation, scale and skew components, ignoring the last row of modelMatrix.
+	/// Returns false if the upper 3x3 part is singular, a scale factor not being larger than epsilon times the largest one,
+	/// scale and skew being then null and orientation the identity.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL bool decomposeAffine(
+		mat<4, 4, T, Q> const& modelMatrix,
+		vec<3, T, Q> & scale, qua<T, Q> & orientation, vec<3, T, Q> & translation, vec<3, T, Q> & skew);
+
+	/// Decomposes an affine transform stored as in GLM_EXT_matrix_affine, ie the upper 3 rows of modelMatrix one row per column,
+	/// to translation, rotation, scale and skew components.
+	/// @see gtx_matrix_decompose
+	/// @see ext_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL bool decomposeAffine(
+		mat<3, 4, T, Q> const& modelMatrix,
+		vec<3, T, Q> & scale, qua<T, Q> & orientation, vec<3, T, Q> & translation, vec<3, T, Q> & skew);
+
+	/// Decomposes count affine transforms as decomposeAffine, using up to threads threads each processing a contiguous range of matrices.
+	/// skew may be null if the skew components aren't needed.
+	/// Returns the number of matrices that aren't singular.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL std::size_t decomposeAffine(
+		mat<4, 4, T, Q> const* modelMatrix,
+		vec<3, T, Q>* scale, qua<T, Q>* orientation, vec<3, T, Q>* translation, vec<3, T, Q>* skew,
+		std::size_t count, unsigned threads = 1);
+
+	/// Decomposes count affine transforms stored as in GLM_EXT_matrix_affine as decomposeAffine, using up to threads threads.
+	/// skew may be null if the skew components aren't needed.
+	/// Returns the number of matrices that aren't singular.
+	/// @see gtx_matrix_decompose
+	/// @see ext_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL std::size_t decomposeAffine(
+		mat<3, 4, T, Q> const* modelMatrix,
+		vec<3, T, Q>* scale, qua<T, Q>* orientation, vec<3, T, Q>* translation, vec<3, T, Q>* skew,
+		std::size_t count, unsigned threads = 1);
+
+	/// Recomposes an affine transform from the components computed by decomposeAffine.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> recomposeAffine(
+		vec<3, T, Q> const& scale, qua<T, Q> const& orientation, vec<3, T, Q> const& translation, vec<3, T, Q> const& skew);
+
+	/// Recomposes count affine transforms as recomposeAffine, using up to threads threads each processing a contiguous range of matrices.
+	/// skew may be null for transforms without skew.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void recomposeAffine(
+		vec<3, T, Q> const* scale, qua<T, Q> const* orientation, vec<3, T, Q> const* translation, vec<3, T, Q> const* skew,
+		mat<4, 4, T, Q>* modelMatrix, std::size_t count, unsigned threads = 1);
+
+	/// Recomposes count affine transforms as affineFromMat4(recomposeAffine(...)), stored as in GLM_EXT_matrix_affine.
+	/// skew may be null for transforms without skew.
+	/// @see gtx_matrix_decompose
+	/// @see ext_matrix_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void recomposeAffine(
+		vec<3, T, Q> const* scale, qua<T, Q> const* orientation, vec<3, T, Q> const* translation, vec<3, T, Q> const* skew,
+		mat<3, 4, T, Q>* modelMatrix, std::size_t count, unsigned threads = 1);
+
 	/// @}
 }//namespace glm
 
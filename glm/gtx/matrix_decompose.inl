@@ -3,6 +3,9 @@
 #include "../gtc/constants.hpp"
 #include "../gtc/epsilon.hpp"
 #include "../gtx/transform.hpp"
+#include <limits>
+#include <thread>
+#include <vector>
 
 namespace glm{
 namespace detail
@@ -23,79 +26,12 @@ namespace detail
 	{
 		return v * desiredLength / length(v);
 	}
-}//namespace detail
-
-	// Matrix decompose
-	// http://www.opensource.apple.com/source/WebCore/WebCore-514/platform/graphics/transforms/TransformationMatrix.cpp
-	// Decomposes the mode matrix to translations,rotation scale components
 
+	// Scale, shear and rotation of the upper 3x3 part of a model matrix, whose columns are in Row
 	template<typename T, qualifier Q>
-	GLM_FUNC_QUALIFIER bool decompose(mat<4, 4, T, Q> const& ModelMatrix, vec<3, T, Q> & Scale, qua<T, Q> & Orientation, vec<3, T, Q> & Translation, vec<3, T, Q> & Skew, vec<4, T, Q> & Perspective)
+	GLM_FUNC_QUALIFIER void decompose_rows(vec<3, T, Q> Row[3], vec<3, T, Q> & Scale, qua<T, Q> & Orientation, vec<3, T, Q> & Skew)
 	{
-		mat<4, 4, T, Q> LocalMatrix(ModelMatrix);
-
-		// Normalize the matrix.
-		if(epsilonEqual(LocalMatrix[3][3], static_cast<T>(0), epsilon<T>()))
-			return false;
-
-		for(length_t i = 0; i < 4; ++i)
-		for(length_t j = 0; j < 4; ++j)
-			LocalMatrix[i][j] /= LocalMatrix[3][3];
-
-		// perspectiveMatrix is used to solve for perspective, but it also provides
-		// an easy way to test for singularity of the upper 3x3 component.
-		mat<4, 4, T, Q> PerspectiveMatrix(LocalMatrix);
-
-		for(length_t i = 0; i < 3; i++)
-			PerspectiveMatrix[i][3] = static_cast<T>(0);
-		PerspectiveMatrix[3][3] = static_cast<T>(1);
-
-		/// TODO: Fixme!
-		if(epsilonEqual(determinant(PerspectiveMatrix), static_cast<T>(0), epsilon<T>()))
-			return false;
-
-		// First, isolate perspective.  This is the messiest.
-		if(
-			epsilonNotEqual(LocalMatrix[0][3], static_cast<T>(0), epsilon<T>()) ||
-			epsilonNotEqual(LocalMatrix[1][3], static_cast<T>(0), epsilon<T>()) ||
-			epsilonNotEqual(LocalMatrix[2][3], static_cast<T>(0), epsilon<T>()))
-		{
-			// rightHandSide is the right hand side of the equation.
-			vec<4, T, Q> RightHandSide;
-			RightHandSide[0] = LocalMatrix[0][3];
-			RightHandSide[1] = LocalMatrix[1][3];
-			RightHandSide[2] = LocalMatrix[2][3];
-			RightHandSide[3] = LocalMatrix[3][3];
-
-			// Solve the equation by inverting PerspectiveMatrix and multiplying
-			// rightHandSide by the inverse.  (This is the easiest way, not
-			// necessarily the best.)
-			mat<4, 4, T, Q> InversePerspectiveMatrix = glm::inverse(PerspectiveMatrix);//   inverse(PerspectiveMatrix, inversePerspectiveMatrix);
-			mat<4, 4, T, Q> TransposedInversePerspectiveMatrix = glm::transpose(InversePerspectiveMatrix);//   transposeMatrix4(inversePerspectiveMatrix, transposedInversePerspectiveMatrix);
-
-			Perspective = TransposedInversePerspectiveMatrix * RightHandSide;
-			//  v4MulPointByMatrix(rightHandSide, transposedInversePerspectiveMatrix, perspectivePoint);
-
-			// Clear the perspective partition
-			LocalMatrix[0][3] = LocalMatrix[1][3] = LocalMatrix[2][3] = static_cast<T>(0);
-			LocalMatrix[3][3] = static_cast<T>(1);
-		}
-		else
-		{
-			// No perspective.
-			Perspective = vec<4, T, Q>(0, 0, 0, 1);
-		}
-
-		// Next take care of translation (easy).
-		Translation = vec<3, T, Q>(LocalMatrix[3]);
-		LocalMatrix[3] = vec<4, T, Q>(0, 0, 0, LocalMatrix[3].w);
-
-		vec<3, T, Q> Row[3], Pdum3;
-
-		// Now get scale and shear.
-		for(length_t i = 0; i < 3; ++i)
-		for(length_t j = 0; j < 3; ++j)
-			Row[i][j] = LocalMatrix[i][j];
+		vec<3, T, Q> Pdum3;
 
 		// Compute X scale factor and normalize first row.
 		Scale.x = length(Row[0]);// v3Length(Row[0]);
@@ -187,6 +123,184 @@ namespace detail
 			Orientation[k + off] = root * (Row[i][k] + Row[k][i]);
 			Orientation.w = root * (Row[j][k] - Row[k][j]);
 		} // End if <= 0
+	}
+
+	// decompose_rows of an affine transform, resetting the components of singular transforms
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool decompose_affine(vec<3, T, Q> Row[3], vec<3, T, Q> & Scale, qua<T, Q> & Orientation, vec<3, T, Q> & Skew)
+	{
+		decompose_rows(Row, Scale, Orientation, Skew);
+
+		vec<3, T, Q> const AbsScale = abs(Scale);
+		T const MinScale = epsilon<T>() * max(max(AbsScale.x, AbsScale.y), AbsScale.z);
+		if(AbsScale.x > MinScale && AbsScale.y > MinScale && AbsScale.z > MinScale)
+			return true;
+
+		Scale = vec<3, T, Q>(static_cast<T>(0));
+		Orientation = qua<T, Q>::wxyz(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+		Skew = vec<3, T, Q>(static_cast<T>(0));
+		return false;
+	}
+
+	// Columns of the upper 3x3 part of an affine transform, in the order of operations of the SIMD kernels
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void recompose_affine(vec<3, T, Q> const& Scale, qua<T, Q> const& Orientation, vec<3, T, Q> const& Skew, vec<3, T, Q> Column[3])
+	{
+		mat<3, 3, T, Q> const Rotation = mat3_cast(Orientation);
+		Column[0] = Rotation[0] * Scale.x;
+		Column[1] = (Rotation[0] * Skew.z + Rotation[1]) * Scale.y;
+		Column[2] = ((Rotation[0] * Skew.y + Rotation[1] * Skew.x) + Rotation[2]) * Scale.z;
+	}
+
+	// Splits [0, count) in up to threads contiguous ranges processed concurrently by Func(first, last), returns the sum of the results
+	template<typename F>
+	GLM_FUNC_QUALIFIER std::size_t decompose_parallel(std::size_t count, unsigned threads, F const& Func)
+	{
+		// Fewer matrices per thread don't make up for starting the thread
+		std::size_t const MinCount = 16384;
+		std::size_t const Threads = glm::min(static_cast<std::size_t>(threads), count / MinCount);
+		if(Threads <= 1)
+			return Func(static_cast<std::size_t>(0), count);
+
+		std::vector<std::size_t> Results(Threads);
+		std::vector<std::thread> Workers;
+		Workers.reserve(Threads - 1);
+		for(std::size_t t = 1; t < Threads; ++t)
+		{
+			std::size_t const First = count * t / Threads;
+			std::size_t const Last = count * (t + 1) / Threads;
+			std::size_t* const Result = &Results[t];
+			Workers.push_back(std::thread([&Func, Result, First, Last]()
+			{
+				*Result = Func(First, Last);
+			}));
+		}
+		Results[0] = Func(static_cast<std::size_t>(0), count / Threads);
+		for(std::size_t t = 0; t < Workers.size(); ++t)
+			Workers[t].join();
+
+		std::size_t Sum = 0;
+		for(std::size_t t = 0; t < Threads; ++t)
+			Sum += Results[t];
+		return Sum;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void recompose_store(mat<4, 4, T, Q> const& m, mat<4, 4, T, Q>& out)
+	{
+		out = m;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void recompose_store(mat<4, 4, T, Q> const& m, mat<3, 4, T, Q>& out)
+	{
+		out = affineFromMat4(m);
+	}
+
+	// Batch decomposition of mat4 and mat3x4 arrays, SIMD specializations process the leading
+	// matrices and call this for the remaining ones
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_matrix_decompose
+	{
+		template<typename matType>
+		GLM_FUNC_QUALIFIER static std::size_t decompose(
+			matType const* in,
+			vec<3, T, Q>* scale, qua<T, Q>* orientation, vec<3, T, Q>* translation, vec<3, T, Q>* skew,
+			std::size_t count)
+		{
+			std::size_t Count = 0;
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				vec<3, T, Q> Skew;
+				Count += decomposeAffine(in[i], scale[i], orientation[i], translation[i], skew ? skew[i] : Skew) ? 1 : 0;
+			}
+			return Count;
+		}
+
+		template<typename matType>
+		GLM_FUNC_QUALIFIER static void recompose(
+			vec<3, T, Q> const* scale, qua<T, Q> const* orientation, vec<3, T, Q> const* translation, vec<3, T, Q> const* skew,
+			matType* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				recompose_store(recomposeAffine(scale[i], orientation[i], translation[i], skew ? skew[i] : vec<3, T, Q>(static_cast<T>(0))), out[i]);
+		}
+	};
+}//namespace detail
+
+	// Matrix decompose
+	// http://www.opensource.apple.com/source/WebCore/WebCore-514/platform/graphics/transforms/TransformationMatrix.cpp
+	// Decomposes the mode matrix to translations,rotation scale components
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool decompose(mat<4, 4, T, Q> const& ModelMatrix, vec<3, T, Q> & Scale, qua<T, Q> & Orientation, vec<3, T, Q> & Translation, vec<3, T, Q> & Skew, vec<4, T, Q> & Perspective)
+	{
+		mat<4, 4, T, Q> LocalMatrix(ModelMatrix);
+
+		// Normalize the matrix.
+		if(epsilonEqual(LocalMatrix[3][3], static_cast<T>(0), epsilon<T>()))
+			return false;
+
+		for(length_t i = 0; i < 4; ++i)
+		for(length_t j = 0; j < 4; ++j)
+			LocalMatrix[i][j] /= LocalMatrix[3][3];
+
+		// perspectiveMatrix is used to solve for perspective, but it also provides
+		// an easy way to test for singularity of the upper 3x3 component.
+		mat<4, 4, T, Q> PerspectiveMatrix(LocalMatrix);
+
+		for(length_t i = 0; i < 3; i++)
+			PerspectiveMatrix[i][3] = static_cast<T>(0);
+		PerspectiveMatrix[3][3] = static_cast<T>(1);
+
+		/// TODO: Fixme!
+		if(epsilonEqual(determinant(PerspectiveMatrix), static_cast<T>(0), epsilon<T>()))
+			return false;
+
+		// First, isolate perspective.  This is the messiest.
+		if(
+			epsilonNotEqual(LocalMatrix[0][3], static_cast<T>(0), epsilon<T>()) ||
+			epsilonNotEqual(LocalMatrix[1][3], static_cast<T>(0), epsilon<T>()) ||
+			epsilonNotEqual(LocalMatrix[2][3], static_cast<T>(0), epsilon<T>()))
+		{
+			// rightHandSide is the right hand side of the equation.
+			vec<4, T, Q> RightHandSide;
+			RightHandSide[0] = LocalMatrix[0][3];
+			RightHandSide[1] = LocalMatrix[1][3];
+			RightHandSide[2] = LocalMatrix[2][3];
+			RightHandSide[3] = LocalMatrix[3][3];
+
+			// Solve the equation by inverting PerspectiveMatrix and multiplying
+			// rightHandSide by the inverse.  (This is the easiest way, not
+			// necessarily the best.)
+			mat<4, 4, T, Q> InversePerspectiveMatrix = glm::inverse(PerspectiveMatrix);//   inverse(PerspectiveMatrix, inversePerspectiveMatrix);
+			mat<4, 4, T, Q> TransposedInversePerspectiveMatrix = glm::transpose(InversePerspectiveMatrix);//   transposeMatrix4(inversePerspectiveMatrix, transposedInversePerspectiveMatrix);
+
+			Perspective = TransposedInversePerspectiveMatrix * RightHandSide;
+			//  v4MulPointByMatrix(rightHandSide, transposedInversePerspectiveMatrix, perspectivePoint);
+
+			// Clear the perspective partition
+			LocalMatrix[0][3] = LocalMatrix[1][3] = LocalMatrix[2][3] = static_cast<T>(0);
+			LocalMatrix[3][3] = static_cast<T>(1);
+		}
+		else
+		{
+			// No perspective.
+			Perspective = vec<4, T, Q>(0, 0, 0, 1);
+		}
+
+		// Next take care of translation (easy).
+		Translation = vec<3, T, Q>(LocalMatrix[3]);
+		LocalMatrix[3] = vec<4, T, Q>(0, 0, 0, LocalMatrix[3].w);
+
+		vec<3, T, Q> Row[3];
+
+		// Now get scale and shear.
+		for(length_t i = 0; i < 3; ++i)
+		for(length_t j = 0; j < 3; ++j)
+			Row[i][j] = LocalMatrix[i][j];
+
+		detail::decompose_rows(Row, Scale, Orientation, Skew);
 
 		return true;
 	}
@@ -231,4 +345,105 @@ namespace detail
 
 		return m;
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool decomposeAffine(mat<4, 4, T, Q> const& ModelMatrix, vec<3, T, Q> & Scale, qua<T, Q> & Orientation, vec<3, T, Q> & Translation, vec<3, T, Q> & Skew)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'decomposeAffine' accepts only floating-point inputs");
+
+		vec<3, T, Q> Row[3] = {vec<3, T, Q>(ModelMatrix[0]), vec<3, T, Q>(ModelMatrix[1]), vec<3, T, Q>(ModelMatrix[2])};
+		Translation = vec<3, T, Q>(ModelMatrix[3]);
+		return detail::decompose_affine(Row, Scale, Orientation, Skew);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool decomposeAffine(mat<3, 4, T, Q> const& ModelMatrix, vec<3, T, Q> & Scale, qua<T, Q> & Orientation, vec<3, T, Q> & Translation, vec<3, T, Q> & Skew)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'decomposeAffine' accepts only floating-point inputs");
+
+		// ModelMatrix[r] is row r of the transform, Row[c] receives column c as in the mat4 overload
+		vec<3, T, Q> Row[3];
+		for(length_t c = 0; c < 3; ++c)
+			Row[c] = vec<3, T, Q>(ModelMatrix[0][c], ModelMatrix[1][c], ModelMatrix[2][c]);
+		Translation = vec<3, T, Q>(ModelMatrix[0][3], ModelMatrix[1][3], ModelMatrix[2][3]);
+		return detail::decompose_affine(Row, Scale, Orientation, Skew);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t decomposeAffine(
+		mat<4, 4, T, Q> const* ModelMatrix,
+		vec<3, T, Q>* Scale, qua<T, Q>* Orientation, vec<3, T, Q>* Translation, vec<3, T, Q>* Skew,
+		std::size_t Count, unsigned Threads)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'decomposeAffine' accepts only floating-point inputs");
+
+		return detail::decompose_parallel(Count, Threads, [=](std::size_t First, std::size_t Last)
+		{
+			return detail::compute_matrix_decompose<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::decompose(
+				ModelMatrix + First, Scale + First, Orientation + First, Translation + First, Skew ? Skew + First : Skew, Last - First);
+		});
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t decomposeAffine(
+		mat<3, 4, T, Q> const* ModelMatrix,
+		vec<3, T, Q>* Scale, qua<T, Q>* Orientation, vec<3, T, Q>* Translation, vec<3, T, Q>* Skew,
+		std::size_t Count, unsigned Threads)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'decomposeAffine' accepts only floating-point inputs");
+
+		return detail::decompose_parallel(Count, Threads, [=](std::size_t First, std::size_t Last)
+		{
+			return detail::compute_matrix_decompose<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::decompose(
+				ModelMatrix + First, Scale + First, Orientation + First, Translation + First, Skew ? Skew + First : Skew, Last - First);
+		});
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> recomposeAffine(vec<3, T, Q> const& Scale, qua<T, Q> const& Orientation, vec<3, T, Q> const& Translation, vec<3, T, Q> const& Skew)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'recomposeAffine' accepts only floating-point inputs");
+
+		vec<3, T, Q> Column[3];
+		detail::recompose_affine(Scale, Orientation, Skew, Column);
+		return mat<4, 4, T, Q>(
+			vec<4, T, Q>(Column[0], static_cast<T>(0)),
+			vec<4, T, Q>(Column[1], static_cast<T>(0)),
+			vec<4, T, Q>(Column[2], static_cast<T>(0)),
+			vec<4, T, Q>(Translation, static_cast<T>(1)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void recomposeAffine(
+		vec<3, T, Q> const* Scale, qua<T, Q> const* Orientation, vec<3, T, Q> const* Translation, vec<3, T, Q> const* Skew,
+		mat<4, 4, T, Q>* ModelMatrix, std::size_t Count, unsigned Threads)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'recomposeAffine' accepts only floating-point inputs");
+
+		detail::decompose_parallel(Count, Threads, [=](std::size_t First, std::size_t Last)
+		{
+			detail::compute_matrix_decompose<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::recompose(
+				Scale + First, Orientation + First, Translation + First, Skew ? Skew + First : Skew, ModelMatrix + First, Last - First);
+			return static_cast<std::size_t>(0);
+		});
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void recomposeAffine(
+		vec<3, T, Q> const* Scale, qua<T, Q> const* Orientation, vec<3, T, Q> const* Translation, vec<3, T, Q> const* Skew,
+		mat<3, 4, T, Q>* ModelMatrix, std::size_t Count, unsigned Threads)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'recomposeAffine' accepts only floating-point inputs");
+
+		detail::decompose_parallel(Count, Threads, [=](std::size_t First, std::size_t Last)
+		{
+			detail::compute_matrix_decompose<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::recompose(
+				Scale + First, Orientation + First, Translation + First, Skew ? Skew + First : Skew, ModelMatrix + First, Last - First);
+			return static_cast<std::size_t>(0);
+		});
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_decompose_simd.inl"
+#endif
@@ -0,0 +1,227 @@
+/// @ref gtx_matrix_decompose
+
+#include "../simd/matrix_decompose.h"
+#include "../integer.hpp"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Blocks of 8 then 4 matrices are transposed into registers holding one element of each matrix,
+	// the remaining matrices use the scalar functions
+	template<qualifier Q>
+	struct compute_matrix_decompose<float, Q, true>
+	{
+		typedef compute_matrix_decompose<float, Q, false> scalar;
+
+		template<typename genType>
+		GLM_FUNC_QUALIFIER static float const* data(genType const* p)
+		{
+			return reinterpret_cast<float const*>(p);
+		}
+
+		template<typename genType>
+		GLM_FUNC_QUALIFIER static float* data(genType* p)
+		{
+			return reinterpret_cast<float*>(p);
+		}
+
+		// Aligned vec3 are padded to 4 floats
+		GLM_FUNC_QUALIFIER static bool packed()
+		{
+			return sizeof(vec<3, float, Q>) == sizeof(float) * 3;
+		}
+
+		// Upper 3x3 part and translation of 4 matrices
+		GLM_FUNC_QUALIFIER static void load4(mat<4, 4, float, Q> const* in, glm_vec4 m[9], glm_vec4 t[3])
+		{
+			glm_vec4 e[16];
+			glm_mat4_soa4_load(data(in), e);
+			for(int c = 0; c < 3; ++c)
+			for(int r = 0; r < 3; ++r)
+				m[c * 3 + r] = e[c * 4 + r];
+			for(int r = 0; r < 3; ++r)
+				t[r] = e[12 + r];
+		}
+
+		GLM_FUNC_QUALIFIER static void load4(mat<3, 4, float, Q> const* in, glm_vec4 m[9], glm_vec4 t[3])
+		{
+			glm_vec4 e[12];
+			glm_mat3x4_soa4_load(data(in), e);
+			for(int r = 0; r < 3; ++r)
+			{
+				for(int c = 0; c < 3; ++c)
+					m[c * 3 + r] = e[r * 4 + c];
+				t[r] = e[r * 4 + 3];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void store4(glm_vec4 const m[9], glm_vec4 const t[3], mat<4, 4, float, Q>* out)
+		{
+			glm_vec4 const Zero = _mm_setzero_ps();
+			glm_vec4 e[16];
+			for(int c = 0; c < 3; ++c)
+			{
+				for(int r = 0; r < 3; ++r)
+					e[c * 4 + r] = m[c * 3 + r];
+				e[c * 4 + 3] = Zero;
+			}
+			for(int r = 0; r < 3; ++r)
+				e[12 + r] = t[r];
+			e[15] = _mm_set1_ps(1.0f);
+			glm_mat4_soa4_store(e, data(out));
+		}
+
+		GLM_FUNC_QUALIFIER static void store4(glm_vec4 const m[9], glm_vec4 const t[3], mat<3, 4, float, Q>* out)
+		{
+			glm_vec4 e[12];
+			for(int r = 0; r < 3; ++r)
+			{
+				for(int c = 0; c < 3; ++c)
+					e[r * 4 + c] = m[c * 3 + r];
+				e[r * 4 + 3] = t[r];
+			}
+			glm_mat3x4_soa4_store(e, data(out));
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+		GLM_FUNC_QUALIFIER static void load8(mat<4, 4, float, Q> const* in, glm_f32vec8 m[9], glm_f32vec8 t[3])
+		{
+			glm_f32vec8 e[16];
+			glm_mat4_soa8_load(data(in), e);
+			for(int c = 0; c < 3; ++c)
+			for(int r = 0; r < 3; ++r)
+				m[c * 3 + r] = e[c * 4 + r];
+			for(int r = 0; r < 3; ++r)
+				t[r] = e[12 + r];
+		}
+
+		GLM_FUNC_QUALIFIER static void load8(mat<3, 4, float, Q> const* in, glm_f32vec8 m[9], glm_f32vec8 t[3])
+		{
+			glm_f32vec8 e[12];
+			glm_mat3x4_soa8_load(data(in), e);
+			for(int r = 0; r < 3; ++r)
+			{
+				for(int c = 0; c < 3; ++c)
+					m[c * 3 + r] = e[r * 4 + c];
+				t[r] = e[r * 4 + 3];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void store8(glm_f32vec8 const m[9], glm_f32vec8 const t[3], mat<4, 4, float, Q>* out)
+		{
+			glm_f32vec8 const Zero = _mm256_setzero_ps();
+			glm_f32vec8 e[16];
+			for(int c = 0; c < 3; ++c)
+			{
+				for(int r = 0; r < 3; ++r)
+					e[c * 4 + r] = m[c * 3 + r];
+				e[c * 4 + 3] = Zero;
+			}
+			for(int r = 0; r < 3; ++r)
+				e[12 + r] = t[r];
+			e[15] = _mm256_set1_ps(1.0f);
+			glm_mat4_soa8_store(e, data(out));
+		}
+
+		GLM_FUNC_QUALIFIER static void store8(glm_f32vec8 const m[9], glm_f32vec8 const t[3], mat<3, 4, float, Q>* out)
+		{
+			glm_f32vec8 e[12];
+			for(int r = 0; r < 3; ++r)
+			{
+				for(int c = 0; c < 3; ++c)
+					e[r * 4 + c] = m[c * 3 + r];
+				e[r * 4 + 3] = t[r];
+			}
+			glm_mat3x4_soa8_store(e, data(out));
+		}
+#		endif
+
+		template<typename matType>
+		GLM_FUNC_QUALIFIER static std::size_t decompose(
+			matType const* in,
+			vec<3, float, Q>* scale, qua<float, Q>* orientation, vec<3, float, Q>* translation, vec<3, float, Q>* skew,
+			std::size_t count)
+		{
+			if(!packed())
+				return scalar::decompose(in, scale, orientation, translation, skew, count);
+
+			std::size_t i = 0;
+			std::size_t Count = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_f32vec8 m[9], Translation[3], Scale[3], Orientation[4], Skew[3];
+					load8(in + i, m, Translation);
+					Count += static_cast<std::size_t>(bitCount(_mm256_movemask_ps(glm_decompose_affine_soa8(m, Scale, Orientation, Skew))));
+					glm_vec3x8_store(Scale, data(scale + i));
+					glm_quat_soa8_store(Orientation, data(orientation + i));
+					glm_vec3x8_store(Translation, data(translation + i));
+					if(skew)
+						glm_vec3x8_store(Skew, data(skew + i));
+				}
+#			endif
+
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 m[9], Translation[3], Scale[3], Orientation[4], Skew[3];
+				load4(in + i, m, Translation);
+				Count += static_cast<std::size_t>(bitCount(_mm_movemask_ps(glm_decompose_affine_soa4(m, Scale, Orientation, Skew))));
+				glm_vec3x4_store(Scale, data(scale + i));
+				glm_quat_soa4_store(Orientation, data(orientation + i));
+				glm_vec3x4_store(Translation, data(translation + i));
+				if(skew)
+					glm_vec3x4_store(Skew, data(skew + i));
+			}
+
+			return Count + scalar::decompose(in + i, scale + i, orientation + i, translation + i, skew ? skew + i : skew, count - i);
+		}
+
+		template<typename matType>
+		GLM_FUNC_QUALIFIER static void recompose(
+			vec<3, float, Q> const* scale, qua<float, Q> const* orientation, vec<3, float, Q> const* translation, vec<3, float, Q> const* skew,
+			matType* out, std::size_t count)
+		{
+			if(!packed())
+			{
+				scalar::recompose(scale, orientation, translation, skew, out, count);
+				return;
+			}
+
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_f32vec8 Scale[3], Orientation[4], Translation[3], m[9];
+					glm_f32vec8 Skew[3] = {_mm256_setzero_ps(), _mm256_setzero_ps(), _mm256_setzero_ps()};
+					glm_vec3x8_load(data(scale + i), Scale);
+					glm_quat_soa8_load(data(orientation + i), Orientation);
+					glm_vec3x8_load(data(translation + i), Translation);
+					if(skew)
+						glm_vec3x8_load(data(skew + i), Skew);
+					glm_recompose_affine_soa8(Scale, Orientation, Skew, m);
+					store8(m, Translation, out + i);
+				}
+#			endif
+
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 Scale[3], Orientation[4], Translation[3], m[9];
+				glm_vec4 Skew[3] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+				glm_vec3x4_load(data(scale + i), Scale);
+				glm_quat_soa4_load(data(orientation + i), Orientation);
+				glm_vec3x4_load(data(translation + i), Translation);
+				if(skew)
+					glm_vec3x4_load(data(skew + i), Skew);
+				glm_recompose_affine_soa4(Scale, Orientation, Skew, m);
+				store4(m, Translation, out + i);
+			}
+
+			scalar::recompose(scale + i, orientation + i, translation + i, skew ? skew + i : skew, out + i, count - i);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
@@ -9,11 +9,17 @@
 /// Include <glm/gtx/matrix_factorisation.hpp> to use the features of this extension.
 ///
 /// Functions to factor matrices in various forms
+///
+/// svd_decompose and polar_decompose factor 3x3 matrices with the branchless Jacobi method of McAdams et al.,
+/// "Computing the Singular Value Decomposition of 3x3 matrices with minimal branching and elementary floating point operations".
+/// Their batch variants process 4 or 8 float matrices at a time using SSE2 or AVX2 when available, with the same results
+/// as the single matrix functions as long as the compiler doesn't contract multiply and add into FMA instructions.
 
 #pragma once
 
 // Dependency:
 #include "../glm.hpp"
+#include <cstddef>
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_matrix_factorisation is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -25,6 +31,7 @@
 Suggestions:
  - Move helper functions flipud and fliplr to another file: They may be helpful in more general circumstances.
  - Implement other types of matrix factorisation, such as: QL and LQ, L(D)U, eigendecompositions, etc...
+ - Extend svd_decompose to matrices of other sizes.
 */
 
 namespace glm
@@ -61,6 +68,34 @@ namespace glm
 	template <length_t C, length_t R, typename T, qualifier Q>
 	GLM_FUNC_DISCARD_DECL void rq_decompose(mat<C, R, T, Q> const& in, mat<(C < R ? C : R), R, T, Q>& r, mat<C, (C < R ? C : R), T, Q>& q);
 
+	/// Performs the singular value decomposition of a 3x3 matrix.
+	/// Returns 2 rotation matrices u and v and the singular values s such that u*diagonal3x3(s)*transpose(v)=in.
+	/// The absolute values of s are in decreasing order, the first 2 being positive or null and the last one being negative if in is a reflection.
+	/// A fixed number of Jacobi sweeps is performed whatever the input, singular and sheared matrices included.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void svd_decompose(mat<3, 3, T, Q> const& in, mat<3, 3, T, Q>& u, vec<3, T, Q>& s, mat<3, 3, T, Q>& v);
+
+	/// Performs the singular value decomposition of count 3x3 matrices as svd_decompose.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void svd_decompose(mat<3, 3, T, Q> const* in, mat<3, 3, T, Q>* u, vec<3, T, Q>* s, mat<3, 3, T, Q>* v, std::size_t count);
+
+	/// Performs the polar decomposition of a 3x3 matrix from its singular value decomposition.
+	/// Returns a rotation matrix r and a symmetric matrix p such that r*p=in, p having a negative eigenvalue if in is a reflection.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void polar_decompose(mat<3, 3, T, Q> const& in, mat<3, 3, T, Q>& r, mat<3, 3, T, Q>& p);
+
+	/// Performs the polar decomposition of count 3x3 matrices as polar_decompose.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void polar_decompose(mat<3, 3, T, Q> const* in, mat<3, 3, T, Q>* r, mat<3, 3, T, Q>* p, std::size_t count);
+
 	/// @}
 }
 
@@ -1,7 +1,227 @@
 /// @ref gtx_matrix_factorisation
 
+#include <limits>
+
 namespace glm
 {
+namespace detail
+{
+	// Half angle of the Jacobi rotation of the pivot block of a symmetric matrix. The angle is approximated from the
+	// pivot block and replaced by pi/8 where the approximation is poor, so that each rotation reduces the off-diagonal
+	// element without branches.
+	template<typename T>
+	GLM_FUNC_QUALIFIER void svd_jacobi_half_angle(T app, T apq, T aqq, T& ch, T& sh)
+	{
+		T const Ch = static_cast<T>(2) * (app - aqq);
+		T const Sh = apq;
+		T const InvLength = static_cast<T>(1) / sqrt(Ch * Ch + Sh * Sh);
+		bool const Accurate = static_cast<T>(5.82842712474619009760) * (Sh * Sh) < Ch * Ch; // 3 + 2 * sqrt(2)
+		ch = Accurate ? Ch * InvLength : static_cast<T>(0.92387953251128675613); // cos(pi / 8)
+		sh = Accurate ? Sh * InvLength : static_cast<T>(0.38268343236508977173); // sin(pi / 8)
+	}
+
+	// Cosine and sine of the Givens rotation zeroing a2 against the pivot a1, from the half angle on the side avoiding cancellation
+	template<typename T>
+	GLM_FUNC_QUALIFIER void svd_qr_rotation(T a1, T a2, T& c, T& s)
+	{
+		T const Tolerance = sqrt(std::numeric_limits<T>::min());
+		T const Rho = sqrt(a1 * a1 + a2 * a2);
+		T const Sh = Rho > Tolerance ? a2 : static_cast<T>(0);
+		T const Ch = abs(a1) + max(Rho, Tolerance);
+		T const CosHalf = a1 < static_cast<T>(0) ? Sh : Ch;
+		T const SinHalf = a1 < static_cast<T>(0) ? Ch : Sh;
+		T const InvLength2 = static_cast<T>(1) / (CosHalf * CosHalf + SinHalf * SinHalf);
+		c = (CosHalf * CosHalf - SinHalf * SinHalf) * InvLength2;
+		s = static_cast<T>(2) * CosHalf * SinHalf * InvLength2;
+	}
+
+	// m, u and v hold row r of column c in [c * 3 + r], such that u * diagonal3x3(s) * transpose(v) = m:
+	// v diagonalizes transpose(m) * m by Jacobi rotations accumulated in a quaternion, the columns of m * v
+	// are sorted by decreasing length and u is the product of the Givens rotations of their QR factorisation.
+	template<typename T>
+	GLM_FUNC_QUALIFIER void svd3x3(T const m[9], T u[9], T s[3], T v[9])
+	{
+		// The 4 sweeps of McAdams et al. leave errors up to 1e-2 on random matrices, 6 and 8 sweeps converge to the precision of float and double
+		int const Sweeps = sizeof(T) > sizeof(float) ? 8 : 6;
+		T const Tolerance = sqrt(std::numeric_limits<T>::min());
+
+		// Scaling by the largest element keeps the elements of transpose(m) * m in range
+		T Largest = static_cast<T>(0);
+		for(int i = 0; i < 9; ++i)
+			Largest = max(Largest, abs(m[i]));
+		T const Scale = Largest > static_cast<T>(0) ? static_cast<T>(1) / Largest : static_cast<T>(1);
+
+		T a[9];
+		for(int i = 0; i < 9; ++i)
+			a[i] = m[i] * Scale;
+
+		T n[9];
+		for(int c = 0; c < 3; ++c)
+		for(int r = 0; r < 3; ++r)
+			n[c * 3 + r] = a[r * 3 + 0] * a[c * 3 + 0] + a[r * 3 + 1] * a[c * 3 + 1] + a[r * 3 + 2] * a[c * 3 + 2];
+
+		// Rotations G of the pivots (0, 1), (1, 2) and (2, 0), turning e_p towards e_q about e_r: n = transpose(G) * n * G and v = v * G
+		T q[4] = {static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1)};
+		for(int Sweep = 0; Sweep < Sweeps; ++Sweep)
+		for(int p = 0; p < 3; ++p)
+		{
+			int const k = (p + 1) % 3;
+			int const r = (p + 2) % 3;
+
+			// Converged off-diagonal elements are flushed to zero, further rotations would make them subnormal
+			T const Npk = abs(n[p * 3 + k]) < Tolerance ? static_cast<T>(0) : n[p * 3 + k];
+
+			T ch, sh;
+			svd_jacobi_half_angle(n[p * 4], Npk, n[k * 4], ch, sh);
+			T const Cos = ch * ch - sh * sh;
+			T const Sin = static_cast<T>(2) * ch * sh;
+
+			T const Xp = Cos * n[p * 4] + Sin * Npk;
+			T const Yp = Cos * Npk + Sin * n[k * 4];
+			T const Xk = Cos * Npk - Sin * n[p * 4];
+			T const Yk = Cos * n[k * 4] - Sin * Npk;
+			T const Rp = Cos * n[r * 3 + p] + Sin * n[r * 3 + k];
+			T const Rk = Cos * n[r * 3 + k] - Sin * n[r * 3 + p];
+			n[p * 4] = Cos * Xp + Sin * Yp;
+			n[k * 4] = Cos * Yk - Sin * Xk;
+			n[p * 3 + k] = n[k * 3 + p] = Cos * Xk + Sin * Yk;
+			n[r * 3 + p] = n[p * 3 + r] = Rp;
+			n[r * 3 + k] = n[k * 3 + r] = Rk;
+
+			T const Qp = ch * q[p] + sh * q[k];
+			T const Qk = ch * q[k] - sh * q[p];
+			T const Qr = ch * q[r] + sh * q[3];
+			T const Qw = ch * q[3] - sh * q[r];
+			q[p] = Qp;
+			q[k] = Qk;
+			q[r] = Qr;
+			q[3] = Qw;
+		}
+
+		// Rotation matrix of the normalized quaternion, in the order of mat3_cast
+		T const InvLength = static_cast<T>(1) / sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+		T const qx = q[0] * InvLength;
+		T const qy = q[1] * InvLength;
+		T const qz = q[2] * InvLength;
+		T const qw = q[3] * InvLength;
+		T const qxx = qx * qx;
+		T const qyy = qy * qy;
+		T const qzz = qz * qz;
+		T const qxz = qx * qz;
+		T const qxy = qx * qy;
+		T const qyz = qy * qz;
+		T const qwx = qw * qx;
+		T const qwy = qw * qy;
+		T const qwz = qw * qz;
+		v[0] = static_cast<T>(1) - static_cast<T>(2) * (qyy + qzz);
+		v[1] = static_cast<T>(2) * (qxy + qwz);
+		v[2] = static_cast<T>(2) * (qxz - qwy);
+		v[3] = static_cast<T>(2) * (qxy - qwz);
+		v[4] = static_cast<T>(1) - static_cast<T>(2) * (qxx + qzz);
+		v[5] = static_cast<T>(2) * (qyz + qwx);
+		v[6] = static_cast<T>(2) * (qxz + qwy);
+		v[7] = static_cast<T>(2) * (qyz - qwx);
+		v[8] = static_cast<T>(1) - static_cast<T>(2) * (qxx + qyy);
+
+		T b[9];
+		for(int c = 0; c < 3; ++c)
+		for(int r = 0; r < 3; ++r)
+			b[c * 3 + r] = a[0 * 3 + r] * v[c * 3 + 0] + a[1 * 3 + r] * v[c * 3 + 1] + a[2 * 3 + r] * v[c * 3 + 2];
+
+		// Columns sorted by decreasing length, one of the swapped columns being negated to keep v a rotation
+		T Length2[3];
+		for(int c = 0; c < 3; ++c)
+			Length2[c] = b[c * 3 + 0] * b[c * 3 + 0] + b[c * 3 + 1] * b[c * 3 + 1] + b[c * 3 + 2] * b[c * 3 + 2];
+		for(int i = 0; i < 2; ++i)
+		for(int j = i + 1; j < 3; ++j)
+		{
+			if(!(Length2[i] < Length2[j]))
+				continue;
+			for(int r = 0; r < 3; ++r)
+			{
+				T const B = b[i * 3 + r];
+				b[i * 3 + r] = b[j * 3 + r];
+				b[j * 3 + r] = -B;
+				T const V = v[i * 3 + r];
+				v[i * 3 + r] = v[j * 3 + r];
+				v[j * 3 + r] = -V;
+			}
+			T const L = Length2[i];
+			Length2[i] = Length2[j];
+			Length2[j] = L;
+		}
+
+		// Givens rotations G zeroing the rows k of columns p below the diagonal: b = transpose(G) * b and u = u * G
+		for(int i = 0; i < 9; ++i)
+			u[i] = i % 4 == 0 ? static_cast<T>(1) : static_cast<T>(0);
+		for(int p = 0; p < 2; ++p)
+		for(int k = p + 1; k < 3; ++k)
+		{
+			T Cos, Sin;
+			svd_qr_rotation(b[p * 4], b[p * 3 + k], Cos, Sin);
+			for(int i = 0; i < 3; ++i)
+			{
+				T const Bp = b[i * 3 + p];
+				T const Bk = b[i * 3 + k];
+				b[i * 3 + p] = Cos * Bp + Sin * Bk;
+				b[i * 3 + k] = Cos * Bk - Sin * Bp;
+				T const Up = u[p * 3 + i];
+				T const Uk = u[k * 3 + i];
+				u[p * 3 + i] = Cos * Up + Sin * Uk;
+				u[k * 3 + i] = Cos * Uk - Sin * Up;
+			}
+		}
+
+		for(int i = 0; i < 3; ++i)
+			s[i] = b[i * 4] * Largest;
+	}
+
+	// r = u * transpose(v) and p = v * diagonal3x3(s) * transpose(v)
+	template<typename T>
+	GLM_FUNC_QUALIFIER void polar3x3(T const u[9], T const s[3], T const v[9], T r[9], T p[9])
+	{
+		for(int c = 0; c < 3; ++c)
+		for(int i = 0; i < 3; ++i)
+		{
+			r[c * 3 + i] = u[0 * 3 + i] * v[0 * 3 + c] + u[1 * 3 + i] * v[1 * 3 + c] + u[2 * 3 + i] * v[2 * 3 + c];
+			p[c * 3 + i] = v[0 * 3 + i] * s[0] * v[0 * 3 + c] + v[1 * 3 + i] * s[1] * v[1 * 3 + c] + v[2 * 3 + i] * s[2] * v[2 * 3 + c];
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void svd_load(mat<3, 3, T, Q> const& in, T out[9])
+	{
+		for(length_t c = 0; c < 3; ++c)
+		for(length_t r = 0; r < 3; ++r)
+			out[c * 3 + r] = in[c][r];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void svd_store(T const in[9], mat<3, 3, T, Q>& out)
+	{
+		for(length_t c = 0; c < 3; ++c)
+		for(length_t r = 0; r < 3; ++r)
+			out[c][r] = in[c * 3 + r];
+	}
+
+	// Matrices are factored one at a time, SIMD specializations process the leading ones and call this for the remaining ones
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_matrix_factorisation
+	{
+		GLM_FUNC_QUALIFIER static void svd(mat<3, 3, T, Q> const* in, mat<3, 3, T, Q>* u, vec<3, T, Q>* s, mat<3, 3, T, Q>* v, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				svd_decompose(in[i], u[i], s[i], v[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void polar(mat<3, 3, T, Q> const* in, mat<3, 3, T, Q>* r, mat<3, 3, T, Q>* p, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				polar_decompose(in[i], r[i], p[i]);
+		}
+	};
+}//namespace detail
+
 	template <length_t C, length_t R, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER mat<C, R, T, Q> flipud(mat<C, R, T, Q> const& in)
 	{
@@ -81,4 +301,49 @@ namespace glm
 		tq = fliplr(tq);
 		q = transpose(tq);
 	}
+	template <typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void svd_decompose(mat<3, 3, T, Q> const& in, mat<3, 3, T, Q>& u, vec<3, T, Q>& s, mat<3, 3, T, Q>& v)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'svd_decompose' accepts only floating-point inputs");
+
+		T M[9], U[9], S[3], V[9];
+		detail::svd_load(in, M);
+		detail::svd3x3(M, U, S, V);
+		detail::svd_store(U, u);
+		s = vec<3, T, Q>(S[0], S[1], S[2]);
+		detail::svd_store(V, v);
+	}
+
+	template <typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void svd_decompose(mat<3, 3, T, Q> const* in, mat<3, 3, T, Q>* u, vec<3, T, Q>* s, mat<3, 3, T, Q>* v, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'svd_decompose' accepts only floating-point inputs");
+
+		detail::compute_matrix_factorisation<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::svd(in, u, s, v, count);
+	}
+
+	template <typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void polar_decompose(mat<3, 3, T, Q> const& in, mat<3, 3, T, Q>& r, mat<3, 3, T, Q>& p)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'polar_decompose' accepts only floating-point inputs");
+
+		T M[9], U[9], S[3], V[9], R[9], P[9];
+		detail::svd_load(in, M);
+		detail::svd3x3(M, U, S, V);
+		detail::polar3x3(U, S, V, R, P);
+		detail::svd_store(R, r);
+		detail::svd_store(P, p);
+	}
+
+	template <typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void polar_decompose(mat<3, 3, T, Q> const* in, mat<3, 3, T, Q>* r, mat<3, 3, T, Q>* p, std::size_t count)
+	{
+		static_assert(std::numeric_limits<T>::is_iec559 || GLM_CONFIG_UNRESTRICTED_FLOAT, "'polar_decompose' accepts only floating-point inputs");
+
+		detail::compute_matrix_factorisation<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::polar(in, r, p, count);
+	}
 } //namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_factorisation_simd.inl"
+#endif
@@ -0,0 +1,106 @@
+/// @ref gtx_matrix_factorisation
+
+#include "../simd/matrix_factorisation.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_SSE2_BIT
+	// Blocks of 8 then 4 matrices are transposed into registers holding one element of each matrix,
+	// the remaining matrices use the scalar functions
+	template<qualifier Q>
+	struct compute_matrix_factorisation<float, Q, true>
+	{
+		typedef compute_matrix_factorisation<float, Q, false> scalar;
+
+		template<typename genType>
+		GLM_FUNC_QUALIFIER static float const* data(genType const* p)
+		{
+			return reinterpret_cast<float const*>(p);
+		}
+
+		template<typename genType>
+		GLM_FUNC_QUALIFIER static float* data(genType* p)
+		{
+			return reinterpret_cast<float*>(p);
+		}
+
+		// Aligned vec3 and mat3 are padded to 4 floats per column
+		GLM_FUNC_QUALIFIER static bool packed()
+		{
+			return sizeof(vec<3, float, Q>) == sizeof(float) * 3 && sizeof(mat<3, 3, float, Q>) == sizeof(float) * 9;
+		}
+
+		GLM_FUNC_QUALIFIER static void svd(mat<3, 3, float, Q> const* in, mat<3, 3, float, Q>* u, vec<3, float, Q>* s, mat<3, 3, float, Q>* v, std::size_t count)
+		{
+			if(!packed())
+			{
+				scalar::svd(in, u, s, v, count);
+				return;
+			}
+
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_f32vec8 m[9], U[9], S[3], V[9];
+					glm_mat3_soa8_load(data(in + i), m);
+					glm_svd3x3_soa8(m, U, S, V);
+					glm_mat3_soa8_store(U, data(u + i));
+					glm_vec3x8_store(S, data(s + i));
+					glm_mat3_soa8_store(V, data(v + i));
+				}
+#			endif
+
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 m[9], U[9], S[3], V[9];
+				glm_mat3_soa4_load(data(in + i), m);
+				glm_svd3x3_soa4(m, U, S, V);
+				glm_mat3_soa4_store(U, data(u + i));
+				glm_vec3x4_store(S, data(s + i));
+				glm_mat3_soa4_store(V, data(v + i));
+			}
+
+			scalar::svd(in + i, u + i, s + i, v + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void polar(mat<3, 3, float, Q> const* in, mat<3, 3, float, Q>* r, mat<3, 3, float, Q>* p, std::size_t count)
+		{
+			if(!packed())
+			{
+				scalar::polar(in, r, p, count);
+				return;
+			}
+
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX2_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					glm_f32vec8 m[9], U[9], S[3], V[9], R[9], P[9];
+					glm_mat3_soa8_load(data(in + i), m);
+					glm_svd3x3_soa8(m, U, S, V);
+					glm_polar3x3_soa8(U, S, V, R, P);
+					glm_mat3_soa8_store(R, data(r + i));
+					glm_mat3_soa8_store(P, data(p + i));
+				}
+#			endif
+
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 m[9], U[9], S[3], V[9], R[9], P[9];
+				glm_mat3_soa4_load(data(in + i), m);
+				glm_svd3x3_soa4(m, U, S, V);
+				glm_polar3x3_soa4(U, S, V, R, P);
+				glm_mat3_soa4_store(R, data(r + i));
+				glm_mat3_soa4_store(P, data(p + i));
+			}
+
+			scalar::polar(in + i, r + i, p + i, count - i);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+}//namespace detail
+}//namespace glm
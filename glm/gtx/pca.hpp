@@ -41,6 +41,7 @@
 // Dependency:
 #include "../glm.hpp"
 #include "../ext/scalar_relational.hpp"
+#include <cstddef>
 
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #	error "GLM: GLM_GTX_pca is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it."
@@ -75,6 +76,62 @@ namespace glm {
 	template<length_t D, typename T, qualifier Q, typename I>
 	GLM_FUNC_DECL mat<D, D, T, Q> computeCovarianceMatrix(I const& b, I const& e, vec<D, T, Q> const& c);
 
+	/// Running mean and covariance of a stream of points, accumulated in a single pass with Welford's algorithm.
+	/// Unlike summing the products of absolute coordinates, the deviations are accumulated around the running mean,
+	/// so that points far from the origin don't lose the precision of their spread.
+	/// Accumulators of separate chunks of points, eg computed by separate threads, are combined by mergeCovariance.
+	///
+	/// Example:
+	/// ```
+	/// glm::covariance_accumulator<3, double> Acc;
+	/// glm::accumulateCovariance(Acc, ptData.data(), ptData.size(), std::thread::hardware_concurrency());
+	/// glm::dmat3 covarMat = glm::computeCovarianceMatrix(Acc);
+	/// // ... Acc.Mean is the center of gravity
+	/// ```
+	template<length_t D, typename T, qualifier Q = defaultp>
+	struct covariance_accumulator
+	{
+		/// Empty accumulator
+		GLM_FUNC_DISCARD_DECL covariance_accumulator();
+
+		/// Number of points accumulated
+		std::size_t Count;
+
+		/// Mean of the points
+		vec<D, T, Q> Mean;
+
+		/// Sum of the outer products of the deviations from the mean
+		mat<D, D, T, Q> Scatter;
+	};
+
+	/// Adds the point `v` to the accumulator `acc`
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, vec<D, T, Q> const& v);
+
+	/// Adds the `n` points of `v` to the accumulator `acc`, converting them to the precision of the accumulator.
+	/// The points are read once, by chunks which are centered on their own mean then merged.
+	/// @param v Points to a memory holding `n` times vectors
+	/// @param n Number of points in v
+	template<length_t D, typename T, typename U, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, vec<D, U, Q> const* v, std::size_t n);
+
+	/// Adds the `n` points of `v` to the accumulator `acc` using up to `threads` threads, each accumulating a contiguous range
+	/// of points. The partial accumulators are merged in order, so the result only depends on the number of threads.
+	/// @param v Points to a memory holding `n` times vectors
+	/// @param n Number of points in v
+	/// @param threads Maximum number of threads, 1 accumulating on the calling thread only
+	template<length_t D, typename T, typename U, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, vec<D, U, Q> const* v, std::size_t n, unsigned threads);
+
+	/// Adds the points accumulated by `other` to `acc`, as if they had been accumulated by `acc`, up to rounding
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_DISCARD_DECL void mergeCovariance(covariance_accumulator<D, T, Q>& acc, covariance_accumulator<D, T, Q> const& other);
+
+	/// Compute the covariance matrix of the points accumulated by `acc` around their mean, zero when no point was accumulated.
+	/// It matches computeCovarianceMatrix of the same points and their center of gravity, up to rounding.
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_DECL mat<D, D, T, Q> computeCovarianceMatrix(covariance_accumulator<D, T, Q> const& acc);
+
 	/// Assuming the provided covariance matrix `covarMat` is symmetric and real-valued, this function find the `D` Eigenvalues of the matrix, and also provides the corresponding Eigenvectors.
 	/// Note: the data in `outEigenvalues` and `outEigenvectors` are in matching order, i.e. `outEigenvector[i]` is the Eigenvector of the Eigenvalue `outEigenvalue[i]`.
 	/// This is a numeric implementation to find the Eigenvalues, using 'QL decomposition` (variant of QR decomposition: https://en.wikipedia.org/wiki/QR_decomposition).
@@ -91,6 +148,21 @@ namespace glm {
 		mat<D, D, T, Q>& outEigenvectors
 	);
 
+	/// Same as findEigenvaluesSymReal for 3x3 matrices, using cyclic Jacobi rotations instead of the generic Householder reduction and QL iterations.
+	/// The eigenvectors are orthonormal to working precision, and small eigenvalues keep a precision relative to the largest one.
+	///
+	/// @param[in] covarMat A symmetric, real-valued covariance matrix, e.g. computed from computeCovarianceMatrix
+	/// @param[out] outEigenvalues Vector to receive the found eigenvalues, not sorted
+	/// @param[out] outEigenvectors Matrix to receive the found eigenvectors corresponding to the found eigenvalues, as column vectors
+	/// @return 3, or 0 if the rotations didn't converge, which only happens for matrices holding NaN or infinity
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL unsigned int findEigenvaluesSymRealJacobi
+	(
+		mat<3, 3, T, Q> const& covarMat,
+		vec<3, T, Q>& outEigenvalues,
+		mat<3, 3, T, Q>& outEigenvectors
+	);
+
 	/// Sorts a group of Eigenvalues&Eigenvectors, for largest Eigenvalue to smallest Eigenvalue.
 	/// The data in `outEigenvalues` and `outEigenvectors` are assumed to be matching order, i.e. `outEigenvector[i]` is the Eigenvector of the Eigenvalue `outEigenvalue[i]`.
 	template<typename T, qualifier Q>
@@ -1,7 +1,10 @@
 /// @ref gtx_pca
 
 #include <algorithm>
+#include <limits>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace glm {
 
@@ -62,6 +65,124 @@ namespace glm {
 		return m;
 	}
 
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER covariance_accumulator<D, T, Q>::covariance_accumulator()
+		: Count(0)
+		, Mean(static_cast<T>(0))
+		, Scatter(static_cast<T>(0))
+	{}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, vec<D, T, Q> const& v)
+	{
+		++acc.Count;
+		vec<D, T, Q> const Delta = v - acc.Mean;
+		acc.Mean += Delta / static_cast<T>(acc.Count);
+
+		// Delta * (v - Mean) written so that Scatter stays exactly symmetric
+		T const Weight = static_cast<T>(acc.Count - 1) / static_cast<T>(acc.Count);
+		for(length_t x = 0; x < D; ++x)
+			for(length_t y = 0; y < D; ++y)
+				acc.Scatter[x][y] += Weight * (Delta[x] * Delta[y]);
+	}
+
+	template<length_t D, typename T, typename U, qualifier Q>
+	GLM_FUNC_QUALIFIER void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, vec<D, U, Q> const* v, std::size_t n)
+	{
+		// Points per chunk, few enough to be read from the cache by the second pass over the chunk
+		std::size_t const Chunk = 256;
+
+		for(std::size_t First = 0; First < n; First += Chunk)
+		{
+			std::size_t const Count = glm::min(Chunk, n - First);
+
+			// Points are shifted by the first one of the chunk, so that the sum doesn't lose the spread of points far from the origin
+			vec<D, T, Q> const Shift(v[First]);
+			vec<D, T, Q> Sum(static_cast<T>(0));
+			for(std::size_t i = First; i < First + Count; ++i)
+				Sum += vec<D, T, Q>(v[i]) - Shift;
+			vec<D, T, Q> const ShiftedMean = Sum / static_cast<T>(Count);
+
+			covariance_accumulator<D, T, Q> Part;
+			Part.Count = Count;
+			Part.Mean = Shift + ShiftedMean;
+			for(std::size_t i = First; i < First + Count; ++i)
+			{
+				vec<D, T, Q> const Delta = (vec<D, T, Q>(v[i]) - Shift) - ShiftedMean;
+				for(length_t x = 0; x < D; ++x)
+					for(length_t y = 0; y < D; ++y)
+						Part.Scatter[x][y] += Delta[x] * Delta[y];
+			}
+
+			mergeCovariance(acc, Part);
+		}
+	}
+
+	template<length_t D, typename T, typename U, qualifier Q>
+	GLM_FUNC_QUALIFIER void accumulateCovariance(covariance_accumulator<D, T, Q>& acc, vec<D, U, Q> const* v, std::size_t n, unsigned threads)
+	{
+		// Fewer points per thread don't make up for starting the thread
+		std::size_t const MinCount = 65536;
+		std::size_t const Threads = glm::min(static_cast<std::size_t>(threads), n / MinCount);
+		if(Threads <= 1)
+		{
+			accumulateCovariance(acc, v, n);
+			return;
+		}
+
+		std::vector<covariance_accumulator<D, T, Q> > Parts(Threads);
+		std::vector<std::thread> Workers;
+		Workers.reserve(Threads - 1);
+		for(std::size_t t = 1; t < Threads; ++t)
+		{
+			std::size_t const First = n * t / Threads;
+			std::size_t const Last = n * (t + 1) / Threads;
+			covariance_accumulator<D, T, Q>* const Part = &Parts[t];
+			Workers.push_back(std::thread([Part, v, First, Last]()
+			{
+				accumulateCovariance(*Part, v + First, Last - First);
+			}));
+		}
+		accumulateCovariance(Parts[0], v, n / Threads);
+		for(std::size_t t = 0; t < Workers.size(); ++t)
+			Workers[t].join();
+
+		for(std::size_t t = 0; t < Threads; ++t)
+			mergeCovariance(acc, Parts[t]);
+	}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mergeCovariance(covariance_accumulator<D, T, Q>& acc, covariance_accumulator<D, T, Q> const& other)
+	{
+		if(other.Count == 0)
+			return;
+		if(acc.Count == 0)
+		{
+			acc = other;
+			return;
+		}
+
+		// Chan et al. pairwise update
+		std::size_t const Count = acc.Count + other.Count;
+		T const Ratio = static_cast<T>(other.Count) / static_cast<T>(Count);
+		T const Weight = static_cast<T>(acc.Count) * Ratio;
+		vec<D, T, Q> const Delta = other.Mean - acc.Mean;
+
+		acc.Count = Count;
+		acc.Mean += Delta * Ratio;
+		for(length_t x = 0; x < D; ++x)
+			for(length_t y = 0; y < D; ++y)
+				acc.Scatter[x][y] += other.Scatter[x][y] + Weight * (Delta[x] * Delta[y]);
+	}
+
+	template<length_t D, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<D, D, T, Q> computeCovarianceMatrix(covariance_accumulator<D, T, Q> const& acc)
+	{
+		if(acc.Count == 0)
+			return mat<D, D, T, Q>(static_cast<T>(0));
+		return acc.Scatter / static_cast<T>(acc.Count);
+	}
+
 	namespace _internal_
 	{
 
@@ -277,6 +398,82 @@ namespace glm {
 		return D;
 	}
 
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER unsigned int findEigenvaluesSymRealJacobi
+	(
+		mat<3, 3, T, Q> const& covarMat,
+		vec<3, T, Q>& outEigenvalues,
+		mat<3, 3, T, Q>& outEigenvectors
+	)
+	{
+		static const length_t Pairs[3][2] = {{0, 1}, {0, 2}, {1, 2}};
+		const int MAX_SWEEPS = 50;
+
+		T a[3][3]; // a[r][c], made diagonal by the rotations
+		T v[3][3]; // product of the rotations
+		for(length_t r = 0; r < 3; ++r)
+			for(length_t c = 0; c < 3; ++c)
+			{
+				a[r][c] = covarMat[c][r];
+				v[r][c] = r == c ? static_cast<T>(1) : static_cast<T>(0);
+			}
+
+		for(int Sweep = 0; Sweep < MAX_SWEEPS; ++Sweep)
+		{
+			T const Off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+			T const Norm = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2] + static_cast<T>(2) * Off;
+			T const Epsilon = std::numeric_limits<T>::epsilon();
+
+			// Converged when the off-diagonal elements are negligible relative to the whole matrix, false for NaN
+			if(Off <= Norm * (Epsilon * Epsilon) * static_cast<T>(0.0625))
+			{
+				for(length_t i = 0; i < 3; ++i)
+				{
+					outEigenvalues[i] = a[i][i];
+					for(length_t j = 0; j < 3; ++j)
+						outEigenvectors[i][j] = v[j][i];
+				}
+				return 3;
+			}
+
+			for(length_t k = 0; k < 3; ++k)
+			{
+				length_t const p = Pairs[k][0];
+				length_t const q = Pairs[k][1];
+				length_t const r = 3 - p - q;
+				T const apq = a[p][q];
+				if(apq == static_cast<T>(0))
+					continue;
+
+				// Rotation zeroing a[p][q], with the smaller angle for stability
+				T const Theta = (a[q][q] - a[p][p]) / (static_cast<T>(2) * apq);
+				T const t = (Theta >= static_cast<T>(0) ? static_cast<T>(1) : static_cast<T>(-1)) / (glm::abs(Theta) + glm::sqrt(Theta * Theta + static_cast<T>(1)));
+				T const c = static_cast<T>(1) / glm::sqrt(t * t + static_cast<T>(1));
+				T const s = t * c;
+				T const Tau = s / (static_cast<T>(1) + c);
+
+				a[p][p] -= t * apq;
+				a[q][q] += t * apq;
+				a[p][q] = a[q][p] = static_cast<T>(0);
+
+				T const arp = a[r][p];
+				T const arq = a[r][q];
+				a[r][p] = a[p][r] = arp - s * (arq + Tau * arp);
+				a[r][q] = a[q][r] = arq + s * (arp - Tau * arq);
+
+				for(length_t i = 0; i < 3; ++i)
+				{
+					T const vip = v[i][p];
+					T const viq = v[i][q];
+					v[i][p] = vip - s * (viq + Tau * vip);
+					v[i][q] = viq + s * (vip - Tau * viq);
+				}
+			}
+		}
+
+		return 0; // Too many sweeps in findEigenvaluesSymRealJacobi
+	}
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER void sortEigenvalues(vec<2, T, Q>& eigenvalues, mat<2, 2, T, Q>& eigenvectors)
 	{
@@ -0,0 +1,161 @@
+/// @ref simd
+/// @file glm/simd/bounding_volume.h
+
+#pragma once
+
+#include "platform.h"
+
+// Axis aligned box kernels of GLM_GTX_bounding_volume. Boxes are held as structure of arrays, component c of the
+// corners of several boxes being held in register c, except for the reduction of packed vec3 arrays.
+// The transform follows transformBounds in the same order of operations.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Updates the minimums and maximums of 4 packed vec3. Register k holds the floats 4k to 4k + 3 of the array,
+// so lane l of register k always holds component (4k + l) % 3 whatever the number of points processed.
+GLM_FUNC_QUALIFIER void glm_minmax_aos4(float const* in, glm_f32vec4 Min[3], glm_f32vec4 Max[3])
+{
+	for(int k = 0; k < 3; ++k)
+	{
+		glm_f32vec4 const v = _mm_loadu_ps(in + 4 * k);
+		Min[k] = _mm_min_ps(Min[k], v);
+		Max[k] = _mm_max_ps(Max[k], v);
+	}
+}
+
+// Minimum and maximum of the lanes
+GLM_FUNC_QUALIFIER float glm_vec4_hmin(glm_f32vec4 v)
+{
+	v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = _mm_min_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtss_f32(v);
+}
+
+GLM_FUNC_QUALIFIER float glm_vec4_hmax(glm_f32vec4 v)
+{
+	v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = _mm_max_ss(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtss_f32(v);
+}
+
+// Splats the elements of a column major 4x4 matrix and their absolute values
+GLM_FUNC_QUALIFIER void glm_aabb_transform_splat4(float const m[16], glm_f32vec4 e[16], glm_f32vec4 a[16])
+{
+	glm_f32vec4 const SignMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000)));
+	for(int i = 0; i < 16; ++i)
+	{
+		e[i] = _mm_set1_ps(m[i]);
+		a[i] = _mm_andnot_ps(SignMask, e[i]);
+	}
+}
+
+// Transforms 4 boxes by the splatted matrix e, a holding the absolute values of its elements
+GLM_FUNC_QUALIFIER void glm_aabb_transform_soa4(
+	glm_f32vec4 const e[16], glm_f32vec4 const a[16],
+	glm_f32vec4 const inMin[3], glm_f32vec4 const inMax[3],
+	glm_f32vec4 outMin[3], glm_f32vec4 outMax[3])
+{
+	glm_f32vec4 const Half = _mm_set1_ps(0.5f);
+	glm_f32vec4 Center[3], Extent[3];
+	for(int c = 0; c < 3; ++c)
+	{
+		Center[c] = _mm_mul_ps(_mm_add_ps(inMin[c], inMax[c]), Half);
+		Extent[c] = _mm_mul_ps(_mm_sub_ps(inMax[c], inMin[c]), Half);
+	}
+
+	for(int r = 0; r < 3; ++r)
+	{
+		glm_f32vec4 C = _mm_add_ps(e[12 + r], _mm_mul_ps(e[0 + r], Center[0]));
+		C = _mm_add_ps(C, _mm_mul_ps(e[4 + r], Center[1]));
+		C = _mm_add_ps(C, _mm_mul_ps(e[8 + r], Center[2]));
+		glm_f32vec4 E = _mm_mul_ps(a[0 + r], Extent[0]);
+		E = _mm_add_ps(E, _mm_mul_ps(a[4 + r], Extent[1]));
+		E = _mm_add_ps(E, _mm_mul_ps(a[8 + r], Extent[2]));
+		outMin[r] = _mm_sub_ps(C, E);
+		outMax[r] = _mm_add_ps(C, E);
+	}
+}
+
+// Returns the mask of the lanes where the box of corners boxMin and boxMax overlaps the query box
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_aabb_overlap_soa4(
+	glm_f32vec4 const queryMin[3], glm_f32vec4 const queryMax[3],
+	glm_f32vec4 const boxMin[3], glm_f32vec4 const boxMax[3])
+{
+	glm_f32vec4 Overlap = _mm_and_ps(_mm_cmple_ps(boxMin[0], queryMax[0]), _mm_cmpge_ps(boxMax[0], queryMin[0]));
+	Overlap = _mm_and_ps(Overlap, _mm_and_ps(_mm_cmple_ps(boxMin[1], queryMax[1]), _mm_cmpge_ps(boxMax[1], queryMin[1])));
+	Overlap = _mm_and_ps(Overlap, _mm_and_ps(_mm_cmple_ps(boxMin[2], queryMax[2]), _mm_cmpge_ps(boxMax[2], queryMin[2])));
+	return Overlap;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Updates the minimums and maximums of 8 packed vec3, lane l of register k holding component (8k + l) % 3
+GLM_FUNC_QUALIFIER void glm_minmax_aos8(float const* in, glm_f32vec8 Min[3], glm_f32vec8 Max[3])
+{
+	for(int k = 0; k < 3; ++k)
+	{
+		glm_f32vec8 const v = _mm256_loadu_ps(in + 8 * k);
+		Min[k] = _mm256_min_ps(Min[k], v);
+		Max[k] = _mm256_max_ps(Max[k], v);
+	}
+}
+
+GLM_FUNC_QUALIFIER float glm_vec8_hmin(glm_f32vec8 v)
+{
+	return glm_vec4_hmin(_mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+}
+
+GLM_FUNC_QUALIFIER float glm_vec8_hmax(glm_f32vec8 v)
+{
+	return glm_vec4_hmax(_mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+}
+
+GLM_FUNC_QUALIFIER void glm_aabb_transform_splat8(float const m[16], glm_f32vec8 e[16], glm_f32vec8 a[16])
+{
+	glm_f32vec8 const SignMask = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(0x80000000)));
+	for(int i = 0; i < 16; ++i)
+	{
+		e[i] = _mm256_set1_ps(m[i]);
+		a[i] = _mm256_andnot_ps(SignMask, e[i]);
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_aabb_transform_soa8(
+	glm_f32vec8 const e[16], glm_f32vec8 const a[16],
+	glm_f32vec8 const inMin[3], glm_f32vec8 const inMax[3],
+	glm_f32vec8 outMin[3], glm_f32vec8 outMax[3])
+{
+	glm_f32vec8 const Half = _mm256_set1_ps(0.5f);
+	glm_f32vec8 Center[3], Extent[3];
+	for(int c = 0; c < 3; ++c)
+	{
+		Center[c] = _mm256_mul_ps(_mm256_add_ps(inMin[c], inMax[c]), Half);
+		Extent[c] = _mm256_mul_ps(_mm256_sub_ps(inMax[c], inMin[c]), Half);
+	}
+
+	for(int r = 0; r < 3; ++r)
+	{
+		glm_f32vec8 C = _mm256_add_ps(e[12 + r], _mm256_mul_ps(e[0 + r], Center[0]));
+		C = _mm256_add_ps(C, _mm256_mul_ps(e[4 + r], Center[1]));
+		C = _mm256_add_ps(C, _mm256_mul_ps(e[8 + r], Center[2]));
+		glm_f32vec8 E = _mm256_mul_ps(a[0 + r], Extent[0]);
+		E = _mm256_add_ps(E, _mm256_mul_ps(a[4 + r], Extent[1]));
+		E = _mm256_add_ps(E, _mm256_mul_ps(a[8 + r], Extent[2]));
+		outMin[r] = _mm256_sub_ps(C, E);
+		outMax[r] = _mm256_add_ps(C, E);
+	}
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_aabb_overlap_soa8(
+	glm_f32vec8 const queryMin[3], glm_f32vec8 const queryMax[3],
+	glm_f32vec8 const boxMin[3], glm_f32vec8 const boxMax[3])
+{
+	glm_f32vec8 Overlap = _mm256_and_ps(_mm256_cmp_ps(boxMin[0], queryMax[0], _CMP_LE_OQ), _mm256_cmp_ps(boxMax[0], queryMin[0], _CMP_GE_OQ));
+	Overlap = _mm256_and_ps(Overlap, _mm256_and_ps(_mm256_cmp_ps(boxMin[1], queryMax[1], _CMP_LE_OQ), _mm256_cmp_ps(boxMax[1], queryMin[1], _CMP_GE_OQ)));
+	Overlap = _mm256_and_ps(Overlap, _mm256_and_ps(_mm256_cmp_ps(boxMin[2], queryMax[2], _CMP_LE_OQ), _mm256_cmp_ps(boxMax[2], queryMin[2], _CMP_GE_OQ)));
+	return Overlap;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
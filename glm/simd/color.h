@@ -0,0 +1,86 @@
+/// @ref simd
+/// @file glm/simd/color.h
+
+#pragma once
+
+#include "exponential.h"
+#include "trigonometric.h"
+
+// Kernels of GLM_EXT_color_space_batch. The sRGB transfer functions follow compute_rgbToSrgb and compute_srgbToRgb
+// of gtc_color_space, pow being evaluated as exp2(log2(x) * y) with the kernels of exponential.h.
+// The color space kernels take 4 colors stored as r, g and b lanes and follow the operation order
+// of the functions of gtx_color_space_YCoCg and gtx_color_encoding.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// x clamped to [0, 1], then x * 12.92 below 0.0031308 and pow(x, Exponent) * 1.055 - 0.055 otherwise
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_linear_to_srgb(glm_f32vec4 x, glm_f32vec4 Exponent)
+{
+	glm_f32vec4 const Clamped = _mm_min_ps(_mm_max_ps(x, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+	glm_f32vec4 const Linear = _mm_mul_ps(Clamped, _mm_set1_ps(12.92f));
+
+	// Lanes of the linear segment are moved to 1 to keep log2 in its domain
+	glm_f32vec4 const Low = _mm_cmplt_ps(Clamped, _mm_set1_ps(0.0031308f));
+	glm_f32vec4 const Base = glm_vec4_select(Low, _mm_set1_ps(1.0f), Clamped);
+	glm_f32vec4 const Pow = glm_vec4_exp2(_mm_mul_ps(glm_vec4_log2(Base), Exponent));
+	glm_f32vec4 const Curve = _mm_sub_ps(_mm_mul_ps(Pow, _mm_set1_ps(1.055f)), _mm_set1_ps(0.055f));
+
+	return glm_vec4_select(Low, Linear, Curve);
+}
+
+// x * (1 / 12.92) up to 0.04045 and pow((x + 0.055) / 1.055, Gamma) otherwise
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_srgb_to_linear(glm_f32vec4 x, glm_f32vec4 Gamma)
+{
+	glm_f32vec4 const Linear = _mm_mul_ps(x, _mm_set1_ps(0.07739938080495356037151702786378f));
+
+	glm_f32vec4 const Low = _mm_cmple_ps(x, _mm_set1_ps(0.04045f));
+	glm_f32vec4 const Base = glm_vec4_select(Low, _mm_set1_ps(1.0f), _mm_mul_ps(_mm_add_ps(x, _mm_set1_ps(0.055f)), _mm_set1_ps(0.94786729857819905213270142180095f)));
+	glm_f32vec4 const Curve = glm_vec4_exp2(_mm_mul_ps(glm_vec4_log2(Base), Gamma));
+
+	return glm_vec4_select(Low, Linear, Curve);
+}
+
+GLM_FUNC_QUALIFIER void glm_color_soa4_rgb2YCoCg(glm_f32vec4 const in[3], glm_f32vec4 out[3])
+{
+	glm_f32vec4 const Quarter = _mm_set1_ps(0.25f);
+	glm_f32vec4 const Half = _mm_set1_ps(0.5f);
+
+	out[0] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(in[0], Quarter), _mm_mul_ps(in[1], Half)), _mm_mul_ps(in[2], Quarter));
+	out[1] = _mm_sub_ps(_mm_mul_ps(in[0], Half), _mm_mul_ps(in[2], Half));
+	out[2] = _mm_sub_ps(_mm_add_ps(_mm_xor_ps(_mm_mul_ps(in[0], Quarter), _mm_set1_ps(-0.0f)), _mm_mul_ps(in[1], Half)), _mm_mul_ps(in[2], Quarter));
+}
+
+GLM_FUNC_QUALIFIER void glm_color_soa4_YCoCg2rgb(glm_f32vec4 const in[3], glm_f32vec4 out[3])
+{
+	out[0] = _mm_sub_ps(_mm_add_ps(in[0], in[1]), in[2]);
+	out[1] = _mm_add_ps(in[0], in[2]);
+	out[2] = _mm_sub_ps(_mm_sub_ps(in[0], in[1]), in[2]);
+}
+
+GLM_FUNC_QUALIFIER void glm_color_soa4_rgb2YCoCgR(glm_f32vec4 const in[3], glm_f32vec4 out[3])
+{
+	glm_f32vec4 const Sum = _mm_add_ps(in[0], in[2]);
+
+	out[0] = _mm_add_ps(_mm_mul_ps(in[1], _mm_set1_ps(0.5f)), _mm_mul_ps(Sum, _mm_set1_ps(0.25f)));
+	out[1] = _mm_sub_ps(in[0], in[2]);
+	out[2] = _mm_sub_ps(in[1], _mm_mul_ps(Sum, _mm_set1_ps(0.5f)));
+}
+
+GLM_FUNC_QUALIFIER void glm_color_soa4_YCoCgR2rgb(glm_f32vec4 const in[3], glm_f32vec4 out[3])
+{
+	glm_f32vec4 const Half = _mm_set1_ps(0.5f);
+	glm_f32vec4 const Tmp = _mm_sub_ps(in[0], _mm_mul_ps(in[2], Half));
+
+	out[1] = _mm_add_ps(in[2], Tmp);
+	out[2] = _mm_sub_ps(Tmp, _mm_mul_ps(in[1], Half));
+	out[0] = _mm_add_ps(out[2], in[1]);
+}
+
+// Channel c of the colors becomes M[c] * in[c] + N[c] * in[c] + O[c] * in[c], the form of the functions of gtx_color_encoding
+GLM_FUNC_QUALIFIER void glm_color_soa4_scale(glm_f32vec4 const in[3], float const M[3], float const N[3], float const O[3], glm_f32vec4 out[3])
+{
+	for(int c = 0; c < 3; ++c)
+		out[c] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(M[c]), in[c]), _mm_mul_ps(_mm_set1_ps(N[c]), in[c])), _mm_mul_ps(_mm_set1_ps(O[c]), in[c]));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
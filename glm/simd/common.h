@@ -247,3 +247,53 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_inf(glm_vec4 x)
 }
 
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_add(glm_f64vec4 a, glm_f64vec4 b)
+{
+	return _mm256_add_pd(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_sub(glm_f64vec4 a, glm_f64vec4 b)
+{
+	return _mm256_sub_pd(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_mul(glm_f64vec4 a, glm_f64vec4 b)
+{
+	return _mm256_mul_pd(a, b);
+}
+
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_fma(glm_f64vec4 a, glm_f64vec4 b, glm_f64vec4 c)
+{
+#	ifdef GLM_FORCE_FMA
+		return _mm256_fmadd_pd(a, b, c);
+#	else
+		return glm_dvec4_add(glm_dvec4_mul(a, b), c);
+#	endif
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_fma(glm_f32vec8 a, glm_f32vec8 b, glm_f32vec8 c)
+{
+#	ifdef GLM_FORCE_FMA
+		return _mm256_fmadd_ps(a, b, c);
+#	else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#	endif
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_vec16_fma(glm_f32vec16 a, glm_f32vec16 b, glm_f32vec16 c)
+{
+#	ifdef GLM_FORCE_FMA
+		return _mm512_fmadd_ps(a, b, c);
+#	else
+		return _mm512_add_ps(_mm512_mul_ps(a, b), c);
+#	endif
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
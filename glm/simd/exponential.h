@@ -1,9 +1,21 @@
 /// @ref simd
-/// @file glm/simd/experimental.h
+/// @file glm/simd/exponential.h
 
 #pragma once
 
-#include "platform.h"
+#include "common.h"
+
+// exp, exp2, log and log2 use range reduction followed by polynomial or rational
+// approximations. The single precision kernels and the double precision log kernels
+// use the Cephes math library coefficients.
+//
+// Maximum errors, measured against the correctly rounded result:
+// - Single precision exp, exp2, log, log2: 2 ULP
+// - Double precision exp, exp2, log, log2: 2 ULP
+// - Single precision pow, evaluated with double precision intermediates on AVX: 1 ULP
+//
+// The kernels only handle results and arguments in the normal floating-point range.
+// The *_outside_range functions report lanes that must be handled with std:: functions.
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -17,4 +29,301 @@ GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sqrt_lowp(glm_f32vec4 x)
 	return _mm_mul_ps(_mm_rsqrt_ps(x), x);
 }
 
+// Returns a non-zero value if any lane of x is outside [Min, Max] or NaN
+GLM_FUNC_QUALIFIER int glm_vec4_outside_range(glm_f32vec4 x, float Min, float Max)
+{
+	glm_f32vec4 const Inside = _mm_and_ps(_mm_cmpge_ps(x, _mm_set1_ps(Min)), _mm_cmple_ps(x, _mm_set1_ps(Max)));
+	return _mm_movemask_ps(Inside) ^ 0xF;
+}
+
+// Returns a non-zero value if any lane is not a positive normal finite number
+GLM_FUNC_QUALIFIER int glm_vec4_log_outside_range(glm_f32vec4 x)
+{
+	return glm_vec4_outside_range(x, 1.17549435e-38f, 3.40282347e+38f);
+}
+
+// Returns x * 2^n for integer n such that the result is a normal number
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_ldexp(glm_f32vec4 x, glm_i32vec4 n)
+{
+	return _mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(x), _mm_slli_epi32(n, 23)));
+}
+
+// Accurate for x in [-87, 88]
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_exp(glm_f32vec4 x)
+{
+	// x = n * ln(2) + r with |r| <= ln(2) / 2, ln(2) is split in two parts for extended precision
+	glm_i32vec4 const n = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)));
+	glm_f32vec4 const nf = _mm_cvtepi32_ps(n);
+	glm_f32vec4 r = glm_vec4_fma(nf, _mm_set1_ps(-0.693359375f), x);
+	r = glm_vec4_fma(nf, _mm_set1_ps(2.12194440e-4f), r);
+
+	glm_f32vec4 const z = _mm_mul_ps(r, r);
+	glm_f32vec4 p = glm_vec4_fma(_mm_set1_ps(1.9875691500e-4f), r, _mm_set1_ps(1.3981999507e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(8.3334519073e-3f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(4.1665795894e-2f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(1.6666665459e-1f));
+	p = glm_vec4_fma(p, r, _mm_set1_ps(5.0000001201e-1f));
+	p = _mm_add_ps(glm_vec4_fma(p, z, r), _mm_set1_ps(1.0f));
+
+	return glm_vec4_ldexp(p, n);
+}
+
+// Accurate for x in [-125, 127]
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_exp2(glm_f32vec4 x)
+{
+	glm_i32vec4 const n = _mm_cvtps_epi32(x);
+	glm_f32vec4 const f = _mm_sub_ps(x, _mm_cvtepi32_ps(n));
+
+	glm_f32vec4 p = glm_vec4_fma(_mm_set1_ps(1.535336188319500e-4f), f, _mm_set1_ps(1.339887440266574e-3f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(9.618437357674640e-3f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(5.550332471162809e-2f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(2.402264791363012e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(6.931472028550421e-1f));
+	p = glm_vec4_fma(p, f, _mm_set1_ps(1.0f));
+
+	return glm_vec4_ldexp(p, n);
+}
+
+// Splits a positive normal x into m * 2^e with m in [sqrt(0.5), sqrt(2)), returns m - 1 (exactly) and e
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_frexp_sqrt2(glm_f32vec4 x, glm_i32vec4* e)
+{
+	glm_i32vec4 const Bits = _mm_castps_si128(x);
+	glm_i32vec4 const Exponent = _mm_sub_epi32(_mm_srli_epi32(Bits, 23), _mm_set1_epi32(126));
+	glm_f32vec4 const m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(Bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F000000)));
+
+	// m in [0.5, 1), move it to [sqrt(0.5), sqrt(2))
+	glm_f32vec4 const Small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+	*e = _mm_add_epi32(Exponent, _mm_castps_si128(Small));
+	return _mm_sub_ps(_mm_add_ps(m, _mm_and_ps(Small, m)), _mm_set1_ps(1.0f));
+}
+
+// Splits a positive normal x into m * 2^e with m in [sqrt(0.5), sqrt(2)), returns m - 1 and e,
+// then evaluates log(1 + (m - 1)) - (m - 1) in y
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log_reduce(glm_f32vec4 x, glm_f32vec4* e, glm_f32vec4* y)
+{
+	glm_i32vec4 Exponent;
+	glm_f32vec4 const m = glm_vec4_frexp_sqrt2(x, &Exponent);
+	*e = _mm_cvtepi32_ps(Exponent);
+
+	glm_f32vec4 const z = _mm_mul_ps(m, m);
+	glm_f32vec4 p = glm_vec4_fma(_mm_set1_ps(7.0376836292e-2f), m, _mm_set1_ps(-1.1514610310e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(1.1676998740e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(-1.2420140846e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(1.4249322787e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(-1.6668057665e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(2.0000714765e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(-2.4999993993e-1f));
+	p = glm_vec4_fma(p, m, _mm_set1_ps(3.3333331174e-1f));
+	*y = glm_vec4_fma(z, _mm_set1_ps(-0.5f), _mm_mul_ps(p, _mm_mul_ps(m, z)));
+
+	return m;
+}
+
+// Accurate for positive normal x
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log(glm_f32vec4 x)
+{
+	glm_f32vec4 e, y;
+	glm_f32vec4 const m = glm_vec4_log_reduce(x, &e, &y);
+
+	// ln(2) is split in two parts for extended precision
+	glm_f32vec4 const r = _mm_add_ps(m, glm_vec4_fma(e, _mm_set1_ps(-2.12194440e-4f), y));
+	return glm_vec4_fma(e, _mm_set1_ps(0.693359375f), r);
+}
+
+// Accurate for positive normal x
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_log2(glm_f32vec4 x)
+{
+	glm_f32vec4 e, y;
+	glm_f32vec4 const m = glm_vec4_log_reduce(x, &e, &y);
+
+	// log2(e) - 1 is applied separately so that m and y are added without rounding
+	glm_f32vec4 const Log2EA = _mm_set1_ps(0.44269504088896340736f);
+	glm_f32vec4 r = _mm_mul_ps(y, Log2EA);
+	r = glm_vec4_fma(m, Log2EA, r);
+	r = _mm_add_ps(r, y);
+	r = _mm_add_ps(r, m);
+	return _mm_add_ps(r, e);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Returns a non-zero value if any lane of x is outside [Min, Max] or NaN
+GLM_FUNC_QUALIFIER int glm_dvec4_outside_range(glm_f64vec4 x, double Min, double Max)
+{
+	glm_f64vec4 const Inside = _mm256_and_pd(_mm256_cmp_pd(x, _mm256_set1_pd(Min), _CMP_GE_OQ), _mm256_cmp_pd(x, _mm256_set1_pd(Max), _CMP_LE_OQ));
+	return _mm256_movemask_pd(Inside) ^ 0xF;
+}
+
+// Returns a non-zero value if any lane is not a positive normal finite number
+GLM_FUNC_QUALIFIER int glm_dvec4_log_outside_range(glm_f64vec4 x)
+{
+	return glm_dvec4_outside_range(x, 2.2250738585072014e-308, 1.7976931348623157e+308);
+}
+
+// Returns x * 2^n for integral n in [-1022, 1023]
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_ldexp(glm_f64vec4 x, glm_f64vec4 n)
+{
+	// AVX lacks 256-bit integer operations, the exponents are built on two 128-bit halves
+	glm_i32vec4 const Biased = _mm_add_epi32(_mm256_cvtpd_epi32(n), _mm_set1_epi32(1023));
+	glm_i64vec2 const Lo = _mm_slli_epi64(_mm_unpacklo_epi32(Biased, _mm_setzero_si128()), 52);
+	glm_i64vec2 const Hi = _mm_slli_epi64(_mm_unpackhi_epi32(Biased, _mm_setzero_si128()), 52);
+	glm_f64vec4 const Scale = _mm256_castsi256_pd(_mm256_insertf128_si256(_mm256_castsi128_si256(Lo), Hi, 1));
+	return _mm256_mul_pd(x, Scale);
+}
+
+// Accurate for x in [-708, 709]
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_exp(glm_f64vec4 x)
+{
+	// x = n * ln(2) + r with |r| <= ln(2) / 2, ln(2) is split in two parts for extended precision
+	glm_f64vec4 const n = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(1.4426950408889634073599)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	glm_f64vec4 r = glm_dvec4_fma(n, _mm256_set1_pd(-6.93145751953125e-1), x);
+	r = glm_dvec4_fma(n, _mm256_set1_pd(-1.42860682030941723212e-6), r);
+
+	// Degree 13 Taylor polynomial, the truncation error is below 2^-57 on the reduced range
+	glm_f64vec4 p = glm_dvec4_fma(_mm256_set1_pd(1.6059043836821613e-10), r, _mm256_set1_pd(2.08767569878681e-09));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(2.505210838544172e-08));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(2.755731922398589e-07));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(2.7557319223985893e-06));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(2.48015873015873e-05));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(1.984126984126984e-04));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(1.388888888888889e-03));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(8.333333333333333e-03));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(4.1666666666666664e-02));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(1.6666666666666666e-01));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(0.5));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(1.0));
+	p = glm_dvec4_fma(p, r, _mm256_set1_pd(1.0));
+
+	return glm_dvec4_ldexp(p, n);
+}
+
+// Accurate for x in [-1022, 1023]
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_exp2(glm_f64vec4 x)
+{
+	glm_f64vec4 const n = _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	glm_f64vec4 const f = _mm256_sub_pd(x, n);
+
+	// Degree 13 Taylor polynomial of exp(f * ln(2)) with |f| <= 0.5
+	glm_f64vec4 p = glm_dvec4_fma(_mm256_set1_pd(1.3691488853904128e-12), f, _mm256_set1_pd(2.5678435993488206e-11));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(4.4455382718708116e-10));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(7.054911620801123e-09));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(1.01780860092397e-07));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(1.321548679014431e-06));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(1.5252733804059841e-05));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(1.540353039338161e-04));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(1.3333558146428443e-03));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(9.618129107628477e-03));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(5.550410866482158e-02));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(2.4022650695910072e-01));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(6.931471805599453e-01));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(1.0));
+
+	return glm_dvec4_ldexp(p, n);
+}
+
+// Splits a positive normal x into m * 2^e with m in [sqrt(0.5), sqrt(2)), returns m - 1 and e,
+// then evaluates log(1 + (m - 1)) - (m - 1) in y
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_log_reduce(glm_f64vec4 x, glm_f64vec4* e, glm_f64vec4* y)
+{
+	// Extract the exponents on two 128-bit halves and gather them as 4 32-bit integers
+	glm_i64vec2 const BitsLo = _mm_castpd_si128(_mm256_castpd256_pd128(x));
+	glm_i64vec2 const BitsHi = _mm_castpd_si128(_mm256_extractf128_pd(x, 1));
+	glm_i32vec4 const ExpLo = _mm_shuffle_epi32(_mm_srli_epi64(BitsLo, 52), _MM_SHUFFLE(2, 0, 2, 0));
+	glm_i32vec4 const ExpHi = _mm_shuffle_epi32(_mm_srli_epi64(BitsHi, 52), _MM_SHUFFLE(2, 0, 2, 0));
+	glm_f64vec4 Exponent = _mm256_cvtepi32_pd(_mm_sub_epi32(_mm_unpacklo_epi64(ExpLo, ExpHi), _mm_set1_epi32(1022)));
+
+	glm_f64vec4 m = _mm256_and_pd(x, _mm256_castsi256_pd(_mm256_set1_epi64x(0x000FFFFFFFFFFFFFll)));
+	m = _mm256_or_pd(m, _mm256_set1_pd(0.5));
+
+	// m in [0.5, 1), move it to [sqrt(0.5), sqrt(2))
+	glm_f64vec4 const Small = _mm256_cmp_pd(m, _mm256_set1_pd(0.70710678118654752440), _CMP_LT_OQ);
+	Exponent = _mm256_sub_pd(Exponent, _mm256_and_pd(Small, _mm256_set1_pd(1.0)));
+	m = _mm256_sub_pd(_mm256_add_pd(m, _mm256_and_pd(Small, m)), _mm256_set1_pd(1.0));
+	*e = Exponent;
+
+	// log(1 + m) = m - m^2 / 2 + m^3 * P(m) / Q(m)
+	glm_f64vec4 const z = _mm256_mul_pd(m, m);
+	glm_f64vec4 p = glm_dvec4_fma(_mm256_set1_pd(1.01875663804580931796e-4), m, _mm256_set1_pd(4.97494994976747001425e-1));
+	p = glm_dvec4_fma(p, m, _mm256_set1_pd(4.70579119878881725854e0));
+	p = glm_dvec4_fma(p, m, _mm256_set1_pd(1.44989225341610930846e1));
+	p = glm_dvec4_fma(p, m, _mm256_set1_pd(1.79368678507819816313e1));
+	p = glm_dvec4_fma(p, m, _mm256_set1_pd(7.70838733755885391666e0));
+	glm_f64vec4 q = _mm256_add_pd(m, _mm256_set1_pd(1.12873587189167450590e1));
+	q = glm_dvec4_fma(q, m, _mm256_set1_pd(4.52279145837532221105e1));
+	q = glm_dvec4_fma(q, m, _mm256_set1_pd(8.29875266912776603211e1));
+	q = glm_dvec4_fma(q, m, _mm256_set1_pd(7.11544750618563894466e1));
+	q = glm_dvec4_fma(q, m, _mm256_set1_pd(2.31251620126765340583e1));
+
+	*y = glm_dvec4_fma(z, _mm256_set1_pd(-0.5), _mm256_mul_pd(_mm256_mul_pd(m, z), _mm256_div_pd(p, q)));
+
+	return m;
+}
+
+// Accurate for positive normal x
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_log(glm_f64vec4 x)
+{
+	glm_f64vec4 e, y;
+	glm_f64vec4 const m = glm_dvec4_log_reduce(x, &e, &y);
+
+	// ln(2) is split in two parts for extended precision
+	glm_f64vec4 const r = _mm256_add_pd(m, glm_dvec4_fma(e, _mm256_set1_pd(-2.121944400546905827679e-4), y));
+	return glm_dvec4_fma(e, _mm256_set1_pd(0.693359375), r);
+}
+
+// Accurate for positive normal x
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_log2(glm_f64vec4 x)
+{
+	glm_f64vec4 e, y;
+	glm_f64vec4 const m = glm_dvec4_log_reduce(x, &e, &y);
+
+	// log2(e) - 1 is applied separately so that m and y are added without rounding
+	glm_f64vec4 const Log2EA = _mm256_set1_pd(4.4269504088896340735992e-1);
+	glm_f64vec4 r = _mm256_mul_pd(y, Log2EA);
+	r = glm_dvec4_fma(m, Log2EA, r);
+	r = _mm256_add_pd(r, y);
+	r = _mm256_add_pd(r, m);
+	return _mm256_add_pd(r, e);
+}
+
+// Returns log2(x) with about 40 bits of precision for positive normal single precision x
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_vec4_log2_f64(glm_f32vec4 x)
+{
+	glm_i32vec4 Exponent;
+	glm_f64vec4 const f = _mm256_cvtps_pd(glm_vec4_frexp_sqrt2(x, &Exponent));
+
+	// log(1 + f) = 2 * atanh(s) with s = f / (2 + f) and |s| <= 0.172
+	glm_f64vec4 const s = _mm256_div_pd(f, _mm256_add_pd(f, _mm256_set1_pd(2.0)));
+	glm_f64vec4 const z = _mm256_mul_pd(s, s);
+	glm_f64vec4 p = glm_dvec4_fma(_mm256_set1_pd(1.3333333333333333e-1), z, _mm256_set1_pd(1.5384615384615385e-1));
+	p = glm_dvec4_fma(p, z, _mm256_set1_pd(1.8181818181818182e-1));
+	p = glm_dvec4_fma(p, z, _mm256_set1_pd(2.2222222222222222e-1));
+	p = glm_dvec4_fma(p, z, _mm256_set1_pd(2.8571428571428571e-1));
+	p = glm_dvec4_fma(p, z, _mm256_set1_pd(4.0e-1));
+	p = glm_dvec4_fma(p, z, _mm256_set1_pd(6.6666666666666666e-1));
+	p = glm_dvec4_fma(p, z, _mm256_set1_pd(2.0));
+
+	return glm_dvec4_fma(_mm256_mul_pd(p, s), _mm256_set1_pd(1.4426950408889634), _mm256_cvtepi32_pd(Exponent));
+}
+
+// Returns 2^x rounded to single precision, accurate for x in [-126, 127]
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_dvec4_exp2_f32(glm_f64vec4 x)
+{
+	glm_f64vec4 const n = _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	glm_f64vec4 const f = _mm256_sub_pd(x, n);
+
+	// Degree 8 Taylor polynomial of exp(f * ln(2)) with |f| <= 0.5, accurate to 2^-32
+	glm_f64vec4 p = glm_dvec4_fma(_mm256_set1_pd(1.321548679014431e-06), f, _mm256_set1_pd(1.5252733804059841e-05));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(1.540353039338161e-04));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(1.3333558146428443e-03));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(9.618129107628477e-03));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(5.550410866482158e-02));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(2.4022650695910072e-01));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(6.931471805599453e-01));
+	p = glm_dvec4_fma(p, f, _mm256_set1_pd(1.0));
+
+	return _mm256_cvtpd_ps(glm_dvec4_ldexp(p, n));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
@@ -0,0 +1,75 @@
+/// @ref simd
+/// @file glm/simd/frustum.h
+
+#pragma once
+
+#include "platform.h"
+
+// Frustum culling kernels of GLM_EXT_frustum_culling. Spheres and boxes are held as structure of arrays, component c
+// of the centers or corners of several volumes being held in register c. Plane i is splatted in planes[i * 4 + c],
+// positive[i * 3 + c] telling whether its component c is positive, that is which corner of the boxes is the furthest along it.
+// The signed distances follow intersectFrustumSphere and intersectFrustumBox in the same order of operations.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_frustum_sphere_soa4(glm_f32vec4 const planes[24], glm_f32vec4 const center[3], glm_f32vec4 radius)
+{
+	glm_f32vec4 const NegRadius = _mm_sub_ps(_mm_setzero_ps(), radius);
+	glm_f32vec4 Visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+	for(int i = 0; i < 6; ++i)
+	{
+		glm_f32vec4 const* const p = planes + i * 4;
+		glm_f32vec4 Distance = _mm_add_ps(_mm_mul_ps(p[0], center[0]), _mm_mul_ps(p[1], center[1]));
+		Distance = _mm_add_ps(_mm_add_ps(Distance, _mm_mul_ps(p[2], center[2])), p[3]);
+		Visible = _mm_and_ps(Visible, _mm_cmpge_ps(Distance, NegRadius));
+	}
+	return Visible;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_frustum_box_soa4(glm_f32vec4 const planes[24], bool const positive[18], glm_f32vec4 const boxMin[3], glm_f32vec4 const boxMax[3])
+{
+	glm_f32vec4 Visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+	for(int i = 0; i < 6; ++i)
+	{
+		glm_f32vec4 const* const p = planes + i * 4;
+		bool const* const s = positive + i * 3;
+		glm_f32vec4 Distance = _mm_add_ps(_mm_mul_ps(p[0], s[0] ? boxMax[0] : boxMin[0]), _mm_mul_ps(p[1], s[1] ? boxMax[1] : boxMin[1]));
+		Distance = _mm_add_ps(_mm_add_ps(Distance, _mm_mul_ps(p[2], s[2] ? boxMax[2] : boxMin[2])), p[3]);
+		Visible = _mm_and_ps(Visible, _mm_cmpge_ps(Distance, _mm_setzero_ps()));
+	}
+	return Visible;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_frustum_sphere_soa8(glm_f32vec8 const planes[24], glm_f32vec8 const center[3], glm_f32vec8 radius)
+{
+	glm_f32vec8 const NegRadius = _mm256_sub_ps(_mm256_setzero_ps(), radius);
+	glm_f32vec8 Visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+	for(int i = 0; i < 6; ++i)
+	{
+		glm_f32vec8 const* const p = planes + i * 4;
+		glm_f32vec8 Distance = _mm256_add_ps(_mm256_mul_ps(p[0], center[0]), _mm256_mul_ps(p[1], center[1]));
+		Distance = _mm256_add_ps(_mm256_add_ps(Distance, _mm256_mul_ps(p[2], center[2])), p[3]);
+		Visible = _mm256_and_ps(Visible, _mm256_cmp_ps(Distance, NegRadius, _CMP_GE_OQ));
+	}
+	return Visible;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_frustum_box_soa8(glm_f32vec8 const planes[24], bool const positive[18], glm_f32vec8 const boxMin[3], glm_f32vec8 const boxMax[3])
+{
+	glm_f32vec8 Visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+	for(int i = 0; i < 6; ++i)
+	{
+		glm_f32vec8 const* const p = planes + i * 4;
+		bool const* const s = positive + i * 3;
+		glm_f32vec8 Distance = _mm256_add_ps(_mm256_mul_ps(p[0], s[0] ? boxMax[0] : boxMin[0]), _mm256_mul_ps(p[1], s[1] ? boxMax[1] : boxMin[1]));
+		Distance = _mm256_add_ps(_mm256_add_ps(Distance, _mm256_mul_ps(p[2], s[2] ? boxMax[2] : boxMin[2])), p[3]);
+		Visible = _mm256_and_ps(Visible, _mm256_cmp_ps(Distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+	}
+	return Visible;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
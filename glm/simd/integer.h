@@ -112,4 +112,220 @@ GLM_FUNC_QUALIFIER glm_uvec4 glm_i128_interleave2(glm_uvec4 x, glm_uvec4 y)
 	return Reg1;
 }
 
+// Number of bits set in each 32-bit lane
+GLM_FUNC_QUALIFIER glm_ivec4 glm_i32vec4_bit_count(glm_ivec4 v)
+{
+#	if GLM_HAS_AVX512_VPOPCNTDQ
+		return _mm_popcnt_epi32(v);
+#	elif GLM_ARCH & GLM_ARCH_SSSE3_BIT
+		// Counts of the two nibbles of each byte looked up in a table, then the 4 byte counts of each lane summed
+		glm_ivec4 const Table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		glm_ivec4 const Low = _mm_set1_epi8(0x0F);
+		glm_ivec4 const lo = _mm_shuffle_epi8(Table, _mm_and_si128(v, Low));
+		glm_ivec4 const hi = _mm_shuffle_epi8(Table, _mm_and_si128(_mm_srli_epi16(v, 4), Low));
+		glm_ivec4 const Bytes = _mm_add_epi8(lo, hi);
+		return _mm_madd_epi16(_mm_maddubs_epi16(Bytes, _mm_set1_epi8(1)), _mm_set1_epi16(1));
+#	else
+		v = _mm_sub_epi32(v, _mm_and_si128(_mm_srli_epi32(v, 1), _mm_set1_epi32(0x55555555)));
+		v = _mm_add_epi32(_mm_and_si128(v, _mm_set1_epi32(0x33333333)), _mm_and_si128(_mm_srli_epi32(v, 2), _mm_set1_epi32(0x33333333)));
+		v = _mm_and_si128(_mm_add_epi32(v, _mm_srli_epi32(v, 4)), _mm_set1_epi32(0x0F0F0F0F));
+		v = _mm_add_epi32(v, _mm_srli_epi32(v, 8));
+		v = _mm_add_epi32(v, _mm_srli_epi32(v, 16));
+		return _mm_and_si128(v, _mm_set1_epi32(0x3F));
+#	endif
+}
+
+// Index of the most significant bit set in each 32-bit lane, -1 for zero lanes
+GLM_FUNC_QUALIFIER glm_ivec4 glm_i32vec4_find_msb(glm_ivec4 v)
+{
+#	if GLM_HAS_AVX512_CD
+		return _mm_sub_epi32(_mm_set1_epi32(31), _mm_lzcnt_epi32(v));
+#	else
+		// The exponent of the value converted to float. Keeping only the highest bit of each run of ones clears the bit
+		// below the most significant bit so that the conversion can't round up to the next power of two.
+		glm_ivec4 const y = _mm_andnot_si128(_mm_srli_epi32(v, 1), v);
+		glm_ivec4 const Exponent = _mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(y)), 23), _mm_set1_epi32(127));
+
+		// The conversion is signed, lanes with the bit 31 set are handled apart. Zero lanes have an exponent of -127.
+		glm_ivec4 const High = _mm_srai_epi32(v, 31);
+		glm_ivec4 const Zero = _mm_cmpeq_epi32(v, _mm_setzero_si128());
+		glm_ivec4 const Result = _mm_or_si128(_mm_and_si128(High, _mm_set1_epi32(31)), _mm_andnot_si128(High, Exponent));
+		return _mm_or_si128(Result, Zero);
+#	endif
+}
+
+// Index of the least significant bit set in each 32-bit lane, -1 for zero lanes
+GLM_FUNC_QUALIFIER glm_ivec4 glm_i32vec4_find_lsb(glm_ivec4 v)
+{
+	glm_ivec4 const Lowest = _mm_and_si128(v, _mm_sub_epi32(_mm_setzero_si128(), v));
+
+#	if GLM_HAS_AVX512_CD
+		return _mm_sub_epi32(_mm_set1_epi32(31), _mm_lzcnt_epi32(Lowest));
+#	else
+		// The lowest bit converts exactly, bit 31 to -2^31 whose sign is masked out. Zero lanes have an exponent of -127.
+		glm_ivec4 const Biased = _mm_and_si128(_mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(Lowest)), 23), _mm_set1_epi32(0xFF));
+		glm_ivec4 const Zero = _mm_cmpeq_epi32(v, _mm_setzero_si128());
+		return _mm_or_si128(_mm_sub_epi32(Biased, _mm_set1_epi32(127)), Zero);
+#	endif
+}
+
+// Interleaves the bits of the low and high halves of each 32-bit lane, the bits of the low half taking the even positions.
+// This is the outer perfect shuffle of Hacker's Delight, equivalent to bitfieldInterleave(uint16, uint16) applied to u16vec2 values.
+GLM_FUNC_QUALIFIER glm_u32vec4 glm_u32vec4_interleave_16(glm_u32vec4 v)
+{
+	glm_u32vec4 t;
+	t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi32(v, 8)), _mm_set1_epi32(0x0000FF00));
+	v = _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi32(t, 8)));
+	t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi32(v, 4)), _mm_set1_epi32(0x00F000F0));
+	v = _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi32(t, 4)));
+	t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi32(v, 2)), _mm_set1_epi32(0x0C0C0C0C));
+	v = _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi32(t, 2)));
+	t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi32(v, 1)), _mm_set1_epi32(0x22222222));
+	return _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi32(t, 1)));
+}
+
+// Inverse of glm_u32vec4_interleave_16: moves the even bits of each 32-bit lane to its low half and the odd bits to its high half
+GLM_FUNC_QUALIFIER glm_u32vec4 glm_u32vec4_deinterleave_16(glm_u32vec4 v)
+{
+	glm_u32vec4 t;
+	t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi32(v, 1)), _mm_set1_epi32(0x22222222));
+	v = _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi32(t, 1)));
+	t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi32(v, 2)), _mm_set1_epi32(0x0C0C0C0C));
+	v = _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi32(t, 2)));
+	t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi32(v, 4)), _mm_set1_epi32(0x00F000F0));
+	v = _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi32(t, 4)));
+	t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi32(v, 8)), _mm_set1_epi32(0x0000FF00));
+	return _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi32(t, 8)));
+}
+
+// Interleaves the bits of the low and high halves of each 64-bit lane, the bits of the low half taking the even positions
+GLM_FUNC_QUALIFIER glm_u64vec2 glm_u64vec2_interleave_32(glm_u64vec2 v)
+{
+	glm_u64vec2 t;
+	t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi64(v, 16)), _mm_set1_epi64x(0x00000000FFFF0000ll));
+	v = _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi64(t, 16)));
+	return glm_u32vec4_interleave_16(v);
+}
+
+// Inverse of glm_u64vec2_interleave_32
+GLM_FUNC_QUALIFIER glm_u64vec2 glm_u64vec2_deinterleave_32(glm_u64vec2 v)
+{
+	v = glm_u32vec4_deinterleave_16(v);
+	glm_u64vec2 const t = _mm_and_si128(_mm_xor_si128(v, _mm_srli_epi64(v, 16)), _mm_set1_epi64x(0x00000000FFFF0000ll));
+	return _mm_xor_si128(v, _mm_xor_si128(t, _mm_slli_epi64(t, 16)));
+}
+
+// Interleaves the bits of x, y and z for each 64-bit lane, with the same results as bitfieldInterleave(uint32, uint32, uint32).
+// The 32-bit components must be stored in both halves of their 64-bit lane.
+GLM_FUNC_QUALIFIER glm_u64vec2 glm_u64vec2_interleave_3(glm_u64vec2 x, glm_u64vec2 y, glm_u64vec2 z)
+{
+	glm_u64vec2 const Mask4 = _mm_set1_epi64x(static_cast<long long>(0xFFFF00000000FFFFull));
+	glm_u64vec2 const Mask3 = _mm_set1_epi64x(0x00FF0000FF0000FFll);
+	glm_u64vec2 const Mask2 = _mm_set1_epi64x(static_cast<long long>(0xF00F00F00F00F00Full));
+	glm_u64vec2 const Mask1 = _mm_set1_epi64x(0x30C30C30C30C30C3ll);
+	glm_u64vec2 const Mask0 = _mm_set1_epi64x(static_cast<long long>(0x9249249249249249ull));
+
+	// REG = ((REG << 32) | REG) & 0xFFFF00000000FFFF, the high half already holds REG
+	x = _mm_and_si128(x, Mask4);
+	y = _mm_and_si128(y, Mask4);
+	z = _mm_and_si128(z, Mask4);
+
+	x = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(x, 16), x), Mask3);
+	y = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(y, 16), y), Mask3);
+	z = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(z, 16), z), Mask3);
+
+	x = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(x, 8), x), Mask2);
+	y = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(y, 8), y), Mask2);
+	z = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(z, 8), z), Mask2);
+
+	x = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(x, 4), x), Mask1);
+	y = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(y, 4), y), Mask1);
+	z = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(z, 4), z), Mask1);
+
+	x = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(x, 2), x), Mask0);
+	y = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(y, 2), y), Mask0);
+	z = _mm_and_si128(_mm_or_si128(_mm_slli_epi64(z, 2), z), Mask0);
+
+	return _mm_or_si128(x, _mm_or_si128(_mm_slli_epi64(y, 1), _mm_slli_epi64(z, 2)));
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// AVX2 version of glm_u32vec4_interleave_16
+GLM_FUNC_QUALIFIER glm_u32vec8 glm_u32vec8_interleave_16(glm_u32vec8 v)
+{
+	glm_u32vec8 t;
+	t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi32(v, 8)), _mm256_set1_epi32(0x0000FF00));
+	v = _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi32(t, 8)));
+	t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi32(v, 4)), _mm256_set1_epi32(0x00F000F0));
+	v = _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi32(t, 4)));
+	t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi32(v, 2)), _mm256_set1_epi32(0x0C0C0C0C));
+	v = _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi32(t, 2)));
+	t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi32(v, 1)), _mm256_set1_epi32(0x22222222));
+	return _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi32(t, 1)));
+}
+
+// AVX2 version of glm_u32vec4_deinterleave_16
+GLM_FUNC_QUALIFIER glm_u32vec8 glm_u32vec8_deinterleave_16(glm_u32vec8 v)
+{
+	glm_u32vec8 t;
+	t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi32(v, 1)), _mm256_set1_epi32(0x22222222));
+	v = _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi32(t, 1)));
+	t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi32(v, 2)), _mm256_set1_epi32(0x0C0C0C0C));
+	v = _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi32(t, 2)));
+	t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi32(v, 4)), _mm256_set1_epi32(0x00F000F0));
+	v = _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi32(t, 4)));
+	t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi32(v, 8)), _mm256_set1_epi32(0x0000FF00));
+	return _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi32(t, 8)));
+}
+
+// AVX2 version of glm_u64vec2_interleave_32
+GLM_FUNC_QUALIFIER glm_u64vec4 glm_u64vec4_interleave_32(glm_u64vec4 v)
+{
+	glm_u64vec4 const t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi64(v, 16)), _mm256_set1_epi64x(0x00000000FFFF0000ll));
+	return glm_u32vec8_interleave_16(_mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi64(t, 16))));
+}
+
+// AVX2 version of glm_u64vec2_deinterleave_32
+GLM_FUNC_QUALIFIER glm_u64vec4 glm_u64vec4_deinterleave_32(glm_u64vec4 v)
+{
+	v = glm_u32vec8_deinterleave_16(v);
+	glm_u64vec4 const t = _mm256_and_si256(_mm256_xor_si256(v, _mm256_srli_epi64(v, 16)), _mm256_set1_epi64x(0x00000000FFFF0000ll));
+	return _mm256_xor_si256(v, _mm256_xor_si256(t, _mm256_slli_epi64(t, 16)));
+}
+
+// AVX2 version of glm_u64vec2_interleave_3
+GLM_FUNC_QUALIFIER glm_u64vec4 glm_u64vec4_interleave_3(glm_u64vec4 x, glm_u64vec4 y, glm_u64vec4 z)
+{
+	glm_u64vec4 const Mask4 = _mm256_set1_epi64x(static_cast<long long>(0xFFFF00000000FFFFull));
+	glm_u64vec4 const Mask3 = _mm256_set1_epi64x(0x00FF0000FF0000FFll);
+	glm_u64vec4 const Mask2 = _mm256_set1_epi64x(static_cast<long long>(0xF00F00F00F00F00Full));
+	glm_u64vec4 const Mask1 = _mm256_set1_epi64x(0x30C30C30C30C30C3ll);
+	glm_u64vec4 const Mask0 = _mm256_set1_epi64x(static_cast<long long>(0x9249249249249249ull));
+
+	x = _mm256_and_si256(x, Mask4);
+	y = _mm256_and_si256(y, Mask4);
+	z = _mm256_and_si256(z, Mask4);
+
+	x = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(x, 16), x), Mask3);
+	y = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(y, 16), y), Mask3);
+	z = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(z, 16), z), Mask3);
+
+	x = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(x, 8), x), Mask2);
+	y = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(y, 8), y), Mask2);
+	z = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(z, 8), z), Mask2);
+
+	x = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(x, 4), x), Mask1);
+	y = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(y, 4), y), Mask1);
+	z = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(z, 4), z), Mask1);
+
+	x = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(x, 2), x), Mask0);
+	y = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(y, 2), y), Mask0);
+	z = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(z, 2), z), Mask0);
+
+	return _mm256_or_si256(x, _mm256_or_si256(_mm256_slli_epi64(y, 1), _mm256_slli_epi64(z, 2)));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
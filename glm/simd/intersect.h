@@ -0,0 +1,222 @@
+/// @ref simd
+/// @file glm/simd/intersect.h
+
+#pragma once
+
+#include "platform.h"
+
+// Moller-Trumbore ray triangle kernels of GLM_EXT_intersect_batch. Each lane tests its own ray against
+// its own triangle, component c of the vectors being held in register c, so that the same kernel tests
+// one ray against several triangles and several rays against one triangle.
+// The operations follow intersectRayTriangle of gtx_intersect in the same order, including its
+// handling of NaN through the rejection tests.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Returns the mask of the lanes where the ray hits the triangle, with their barycentric coordinates in u and v and their distance in t
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_ray_triangle_soa4(
+	glm_f32vec4 const orig[3], glm_f32vec4 const dir[3],
+	glm_f32vec4 const v0[3], glm_f32vec4 const v1[3], glm_f32vec4 const v2[3],
+	glm_f32vec4* u, glm_f32vec4* v, glm_f32vec4* t)
+{
+	glm_f32vec4 const e1[3] = {_mm_sub_ps(v1[0], v0[0]), _mm_sub_ps(v1[1], v0[1]), _mm_sub_ps(v1[2], v0[2])};
+	glm_f32vec4 const e2[3] = {_mm_sub_ps(v2[0], v0[0]), _mm_sub_ps(v2[1], v0[1]), _mm_sub_ps(v2[2], v0[2])};
+
+	// p = cross(dir, e2), det = dot(e1, p)
+	glm_f32vec4 const p[3] = {
+		_mm_sub_ps(_mm_mul_ps(dir[1], e2[2]), _mm_mul_ps(e2[1], dir[2])),
+		_mm_sub_ps(_mm_mul_ps(dir[2], e2[0]), _mm_mul_ps(e2[2], dir[0])),
+		_mm_sub_ps(_mm_mul_ps(dir[0], e2[1]), _mm_mul_ps(e2[0], dir[1]))};
+	glm_f32vec4 const det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1[0], p[0]), _mm_mul_ps(e1[1], p[1])), _mm_mul_ps(e1[2], p[2]));
+
+	// s = orig - v0, U = dot(s, p), q = cross(s, e1), V = dot(dir, q)
+	glm_f32vec4 const s[3] = {_mm_sub_ps(orig[0], v0[0]), _mm_sub_ps(orig[1], v0[1]), _mm_sub_ps(orig[2], v0[2])};
+	glm_f32vec4 const U = _mm_add_ps(_mm_add_ps(_mm_mul_ps(s[0], p[0]), _mm_mul_ps(s[1], p[1])), _mm_mul_ps(s[2], p[2]));
+	glm_f32vec4 const q[3] = {
+		_mm_sub_ps(_mm_mul_ps(s[1], e1[2]), _mm_mul_ps(e1[1], s[2])),
+		_mm_sub_ps(_mm_mul_ps(s[2], e1[0]), _mm_mul_ps(e1[2], s[0])),
+		_mm_sub_ps(_mm_mul_ps(s[0], e1[1]), _mm_mul_ps(e1[0], s[1]))};
+	glm_f32vec4 const V = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dir[0], q[0]), _mm_mul_ps(dir[1], q[1])), _mm_mul_ps(dir[2], q[2]));
+	glm_f32vec4 const UV = _mm_add_ps(U, V);
+
+	glm_f32vec4 const Zero = _mm_setzero_ps();
+	glm_f32vec4 const RejectPos = _mm_or_ps(
+		_mm_or_ps(_mm_cmplt_ps(U, Zero), _mm_cmpgt_ps(U, det)),
+		_mm_or_ps(_mm_cmplt_ps(V, Zero), _mm_cmpgt_ps(UV, det)));
+	glm_f32vec4 const RejectNeg = _mm_or_ps(
+		_mm_or_ps(_mm_cmpgt_ps(U, Zero), _mm_cmplt_ps(U, det)),
+		_mm_or_ps(_mm_cmpgt_ps(V, Zero), _mm_cmplt_ps(UV, det)));
+	glm_f32vec4 const Hit = _mm_or_ps(
+		_mm_andnot_ps(RejectPos, _mm_cmpgt_ps(det, Zero)),
+		_mm_andnot_ps(RejectNeg, _mm_cmplt_ps(det, Zero)));
+
+	glm_f32vec4 const InvDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+	*t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2[0], q[0]), _mm_mul_ps(e2[1], q[1])), _mm_mul_ps(e2[2], q[2])), InvDet);
+	*u = _mm_mul_ps(U, InvDet);
+	*v = _mm_mul_ps(V, InvDet);
+
+	return Hit;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Returns the mask of the lanes where the ray hits the triangle, with their barycentric coordinates in u and v and their distance in t
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_ray_triangle_soa8(
+	glm_f32vec8 const orig[3], glm_f32vec8 const dir[3],
+	glm_f32vec8 const v0[3], glm_f32vec8 const v1[3], glm_f32vec8 const v2[3],
+	glm_f32vec8* u, glm_f32vec8* v, glm_f32vec8* t)
+{
+	glm_f32vec8 const e1[3] = {_mm256_sub_ps(v1[0], v0[0]), _mm256_sub_ps(v1[1], v0[1]), _mm256_sub_ps(v1[2], v0[2])};
+	glm_f32vec8 const e2[3] = {_mm256_sub_ps(v2[0], v0[0]), _mm256_sub_ps(v2[1], v0[1]), _mm256_sub_ps(v2[2], v0[2])};
+
+	glm_f32vec8 const p[3] = {
+		_mm256_sub_ps(_mm256_mul_ps(dir[1], e2[2]), _mm256_mul_ps(e2[1], dir[2])),
+		_mm256_sub_ps(_mm256_mul_ps(dir[2], e2[0]), _mm256_mul_ps(e2[2], dir[0])),
+		_mm256_sub_ps(_mm256_mul_ps(dir[0], e2[1]), _mm256_mul_ps(e2[0], dir[1]))};
+	glm_f32vec8 const det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e1[0], p[0]), _mm256_mul_ps(e1[1], p[1])), _mm256_mul_ps(e1[2], p[2]));
+
+	glm_f32vec8 const s[3] = {_mm256_sub_ps(orig[0], v0[0]), _mm256_sub_ps(orig[1], v0[1]), _mm256_sub_ps(orig[2], v0[2])};
+	glm_f32vec8 const U = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(s[0], p[0]), _mm256_mul_ps(s[1], p[1])), _mm256_mul_ps(s[2], p[2]));
+	glm_f32vec8 const q[3] = {
+		_mm256_sub_ps(_mm256_mul_ps(s[1], e1[2]), _mm256_mul_ps(e1[1], s[2])),
+		_mm256_sub_ps(_mm256_mul_ps(s[2], e1[0]), _mm256_mul_ps(e1[2], s[0])),
+		_mm256_sub_ps(_mm256_mul_ps(s[0], e1[1]), _mm256_mul_ps(e1[0], s[1]))};
+	glm_f32vec8 const V = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dir[0], q[0]), _mm256_mul_ps(dir[1], q[1])), _mm256_mul_ps(dir[2], q[2]));
+	glm_f32vec8 const UV = _mm256_add_ps(U, V);
+
+	glm_f32vec8 const Zero = _mm256_setzero_ps();
+	glm_f32vec8 const RejectPos = _mm256_or_ps(
+		_mm256_or_ps(_mm256_cmp_ps(U, Zero, _CMP_LT_OQ), _mm256_cmp_ps(U, det, _CMP_GT_OQ)),
+		_mm256_or_ps(_mm256_cmp_ps(V, Zero, _CMP_LT_OQ), _mm256_cmp_ps(UV, det, _CMP_GT_OQ)));
+	glm_f32vec8 const RejectNeg = _mm256_or_ps(
+		_mm256_or_ps(_mm256_cmp_ps(U, Zero, _CMP_GT_OQ), _mm256_cmp_ps(U, det, _CMP_LT_OQ)),
+		_mm256_or_ps(_mm256_cmp_ps(V, Zero, _CMP_GT_OQ), _mm256_cmp_ps(UV, det, _CMP_LT_OQ)));
+	glm_f32vec8 const Hit = _mm256_or_ps(
+		_mm256_andnot_ps(RejectPos, _mm256_cmp_ps(det, Zero, _CMP_GT_OQ)),
+		_mm256_andnot_ps(RejectNeg, _mm256_cmp_ps(det, Zero, _CMP_LT_OQ)));
+
+	glm_f32vec8 const InvDet = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+	*t = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2[0], q[0]), _mm256_mul_ps(e2[1], q[1])), _mm256_mul_ps(e2[2], q[2])), InvDet);
+	*u = _mm256_mul_ps(U, InvDet);
+	*v = _mm256_mul_ps(V, InvDet);
+
+	return Hit;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+	// GCC 12 reports the _mm512_undefined_ps used by AVX-512 intrinsics as uninitialized, bug 105593
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wuninitialized"
+#	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// Returns the mask of the lanes where the ray hits the triangle, with their barycentric coordinates in u and v and their distance in t
+GLM_FUNC_QUALIFIER __mmask16 glm_ray_triangle_soa16(
+	glm_f32vec16 const orig[3], glm_f32vec16 const dir[3],
+	glm_f32vec16 const v0[3], glm_f32vec16 const v1[3], glm_f32vec16 const v2[3],
+	glm_f32vec16* u, glm_f32vec16* v, glm_f32vec16* t)
+{
+	glm_f32vec16 const e1[3] = {_mm512_sub_ps(v1[0], v0[0]), _mm512_sub_ps(v1[1], v0[1]), _mm512_sub_ps(v1[2], v0[2])};
+	glm_f32vec16 const e2[3] = {_mm512_sub_ps(v2[0], v0[0]), _mm512_sub_ps(v2[1], v0[1]), _mm512_sub_ps(v2[2], v0[2])};
+
+	glm_f32vec16 const p[3] = {
+		_mm512_sub_ps(_mm512_mul_ps(dir[1], e2[2]), _mm512_mul_ps(e2[1], dir[2])),
+		_mm512_sub_ps(_mm512_mul_ps(dir[2], e2[0]), _mm512_mul_ps(e2[2], dir[0])),
+		_mm512_sub_ps(_mm512_mul_ps(dir[0], e2[1]), _mm512_mul_ps(e2[0], dir[1]))};
+	glm_f32vec16 const det = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(e1[0], p[0]), _mm512_mul_ps(e1[1], p[1])), _mm512_mul_ps(e1[2], p[2]));
+
+	glm_f32vec16 const s[3] = {_mm512_sub_ps(orig[0], v0[0]), _mm512_sub_ps(orig[1], v0[1]), _mm512_sub_ps(orig[2], v0[2])};
+	glm_f32vec16 const U = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(s[0], p[0]), _mm512_mul_ps(s[1], p[1])), _mm512_mul_ps(s[2], p[2]));
+	glm_f32vec16 const q[3] = {
+		_mm512_sub_ps(_mm512_mul_ps(s[1], e1[2]), _mm512_mul_ps(e1[1], s[2])),
+		_mm512_sub_ps(_mm512_mul_ps(s[2], e1[0]), _mm512_mul_ps(e1[2], s[0])),
+		_mm512_sub_ps(_mm512_mul_ps(s[0], e1[1]), _mm512_mul_ps(e1[0], s[1]))};
+	glm_f32vec16 const V = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(dir[0], q[0]), _mm512_mul_ps(dir[1], q[1])), _mm512_mul_ps(dir[2], q[2]));
+	glm_f32vec16 const UV = _mm512_add_ps(U, V);
+
+	// Comparisons produce lane masks instead of vectors
+	glm_f32vec16 const Zero = _mm512_setzero_ps();
+	__mmask16 const RejectPos = static_cast<__mmask16>(
+		_mm512_cmp_ps_mask(U, Zero, _CMP_LT_OQ) | _mm512_cmp_ps_mask(U, det, _CMP_GT_OQ) |
+		_mm512_cmp_ps_mask(V, Zero, _CMP_LT_OQ) | _mm512_cmp_ps_mask(UV, det, _CMP_GT_OQ));
+	__mmask16 const RejectNeg = static_cast<__mmask16>(
+		_mm512_cmp_ps_mask(U, Zero, _CMP_GT_OQ) | _mm512_cmp_ps_mask(U, det, _CMP_LT_OQ) |
+		_mm512_cmp_ps_mask(V, Zero, _CMP_GT_OQ) | _mm512_cmp_ps_mask(UV, det, _CMP_LT_OQ));
+	__mmask16 const Hit = static_cast<__mmask16>(
+		(~RejectPos & _mm512_cmp_ps_mask(det, Zero, _CMP_GT_OQ)) |
+		(~RejectNeg & _mm512_cmp_ps_mask(det, Zero, _CMP_LT_OQ)));
+
+	glm_f32vec16 const InvDet = _mm512_div_ps(_mm512_set1_ps(1.0f), det);
+	*t = _mm512_mul_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(e2[0], q[0]), _mm512_mul_ps(e2[1], q[1])), _mm512_mul_ps(e2[2], q[2])), InvDet);
+	*u = _mm512_mul_ps(U, InvDet);
+	*v = _mm512_mul_ps(V, InvDet);
+
+	return Hit;
+}
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC diagnostic pop
+#endif
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+// ARMv7 NEON has no vector division, its reciprocal estimate would change the results
+#if GLM_ARCH & GLM_ARCH_ARMV8_BIT
+
+// Returns the mask of the lanes where the ray hits the triangle, with their barycentric coordinates in u and v and their distance in t
+GLM_FUNC_QUALIFIER glm_u32vec4 glm_ray_triangle_soa4(
+	glm_f32vec4 const orig[3], glm_f32vec4 const dir[3],
+	glm_f32vec4 const v0[3], glm_f32vec4 const v1[3], glm_f32vec4 const v2[3],
+	glm_f32vec4* u, glm_f32vec4* v, glm_f32vec4* t)
+{
+	glm_f32vec4 const e1[3] = {vsubq_f32(v1[0], v0[0]), vsubq_f32(v1[1], v0[1]), vsubq_f32(v1[2], v0[2])};
+	glm_f32vec4 const e2[3] = {vsubq_f32(v2[0], v0[0]), vsubq_f32(v2[1], v0[1]), vsubq_f32(v2[2], v0[2])};
+
+	glm_f32vec4 const p[3] = {
+		vsubq_f32(vmulq_f32(dir[1], e2[2]), vmulq_f32(e2[1], dir[2])),
+		vsubq_f32(vmulq_f32(dir[2], e2[0]), vmulq_f32(e2[2], dir[0])),
+		vsubq_f32(vmulq_f32(dir[0], e2[1]), vmulq_f32(e2[0], dir[1]))};
+	glm_f32vec4 const det = vaddq_f32(vaddq_f32(vmulq_f32(e1[0], p[0]), vmulq_f32(e1[1], p[1])), vmulq_f32(e1[2], p[2]));
+
+	glm_f32vec4 const s[3] = {vsubq_f32(orig[0], v0[0]), vsubq_f32(orig[1], v0[1]), vsubq_f32(orig[2], v0[2])};
+	glm_f32vec4 const U = vaddq_f32(vaddq_f32(vmulq_f32(s[0], p[0]), vmulq_f32(s[1], p[1])), vmulq_f32(s[2], p[2]));
+	glm_f32vec4 const q[3] = {
+		vsubq_f32(vmulq_f32(s[1], e1[2]), vmulq_f32(e1[1], s[2])),
+		vsubq_f32(vmulq_f32(s[2], e1[0]), vmulq_f32(e1[2], s[0])),
+		vsubq_f32(vmulq_f32(s[0], e1[1]), vmulq_f32(e1[0], s[1]))};
+	glm_f32vec4 const V = vaddq_f32(vaddq_f32(vmulq_f32(dir[0], q[0]), vmulq_f32(dir[1], q[1])), vmulq_f32(dir[2], q[2]));
+	glm_f32vec4 const UV = vaddq_f32(U, V);
+
+	glm_f32vec4 const Zero = vdupq_n_f32(0.0f);
+	glm_u32vec4 const RejectPos = vorrq_u32(
+		vorrq_u32(vcltq_f32(U, Zero), vcgtq_f32(U, det)),
+		vorrq_u32(vcltq_f32(V, Zero), vcgtq_f32(UV, det)));
+	glm_u32vec4 const RejectNeg = vorrq_u32(
+		vorrq_u32(vcgtq_f32(U, Zero), vcltq_f32(U, det)),
+		vorrq_u32(vcgtq_f32(V, Zero), vcltq_f32(UV, det)));
+	glm_u32vec4 const Hit = vorrq_u32(
+		vbicq_u32(vcgtq_f32(det, Zero), RejectPos),
+		vbicq_u32(vcltq_f32(det, Zero), RejectNeg));
+
+	glm_f32vec4 const InvDet = vdivq_f32(vdupq_n_f32(1.0f), det);
+	*t = vmulq_f32(vaddq_f32(vaddq_f32(vmulq_f32(e2[0], q[0]), vmulq_f32(e2[1], q[1])), vmulq_f32(e2[2], q[2])), InvDet);
+	*u = vmulq_f32(U, InvDet);
+	*v = vmulq_f32(V, InvDet);
+
+	return Hit;
+}
+
+// Returns the lanes of a mask as the low 4 bits of an integer, as _mm_movemask_ps
+GLM_FUNC_QUALIFIER int glm_u32vec4_movemask(glm_u32vec4 mask)
+{
+	static uint32_t const Bits[4] = {1, 2, 4, 8};
+	return static_cast<int>(vaddvq_u32(vandq_u32(mask, vld1q_u32(Bits))));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_ARMV8_BIT
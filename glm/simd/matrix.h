@@ -4,6 +4,7 @@
 #pragma once
 
 #include "geometric.h"
+#include <cstddef>
 
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
@@ -1037,4 +1038,753 @@ GLM_FUNC_QUALIFIER void glm_mat4_outerProduct(__m128 const& c, __m128 const& r,
 	out[3] = _mm_mul_ps(c, _mm_shuffle_ps(r, r, _MM_SHUFFLE(3, 3, 3, 3)));
 }
 
+// Splats each of the 16 elements of a column-major matrix in its own register
+GLM_FUNC_QUALIFIER void glm_mat4_splat(float const m[16], glm_vec4 out[16])
+{
+	for(int i = 0; i < 16; ++i)
+		out[i] = _mm_set1_ps(m[i]);
+}
+
+// Deinterleaves 4 packed vec3 (x0 y0 z0 x1 y1 z1 ...) into x, y and z lanes
+GLM_FUNC_QUALIFIER void glm_vec3x4_load(float const* in, glm_vec4 out[3])
+{
+	__m128 const a = _mm_loadu_ps(in + 0); // x0 y0 z0 x1
+	__m128 const b = _mm_loadu_ps(in + 4); // y1 z1 x2 y2
+	__m128 const c = _mm_loadu_ps(in + 8); // z2 x3 y3 z3
+
+	__m128 const Tx0 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+	__m128 const Ty0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+	__m128 const Ty1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+	__m128 const Tz0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+
+	out[0] = _mm_shuffle_ps(a, Tx0, _MM_SHUFFLE(2, 0, 3, 0));
+	out[1] = _mm_shuffle_ps(Ty0, Ty1, _MM_SHUFFLE(2, 0, 2, 0));
+	out[2] = _mm_shuffle_ps(Tz0, c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// Interleaves x, y and z lanes back into 4 packed vec3
+GLM_FUNC_QUALIFIER void glm_vec3x4_store(glm_vec4 const in[3], float* out)
+{
+	__m128 const T0 = _mm_shuffle_ps(in[0], in[1], _MM_SHUFFLE(0, 0, 0, 0));
+	__m128 const T1 = _mm_shuffle_ps(in[2], in[0], _MM_SHUFFLE(1, 1, 0, 0));
+	__m128 const T2 = _mm_shuffle_ps(in[1], in[2], _MM_SHUFFLE(1, 1, 1, 1));
+	__m128 const T3 = _mm_shuffle_ps(in[0], in[1], _MM_SHUFFLE(2, 2, 2, 2));
+	__m128 const T4 = _mm_shuffle_ps(in[2], in[0], _MM_SHUFFLE(3, 3, 2, 2));
+	__m128 const T5 = _mm_shuffle_ps(in[1], in[2], _MM_SHUFFLE(3, 3, 3, 3));
+
+	_mm_storeu_ps(out + 0, _mm_shuffle_ps(T0, T1, _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(out + 4, _mm_shuffle_ps(T2, T3, _MM_SHUFFLE(2, 0, 2, 0)));
+	_mm_storeu_ps(out + 8, _mm_shuffle_ps(T4, T5, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+// Transforms 4 points (w == 1) stored as x, y and z lanes by a matrix splatted with glm_mat4_splat.
+// The operation order matches operator*(mat4, vec4) so that results are bitwise identical.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_point_soa4(glm_vec4 const e[16], glm_vec4 const in[3], glm_vec4 out[3])
+{
+	out[0] = _mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(e[0], in[0]), _mm_mul_ps(e[4], in[1])),
+		_mm_add_ps(_mm_mul_ps(e[8], in[2]), e[12]));
+	out[1] = _mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(e[1], in[0]), _mm_mul_ps(e[5], in[1])),
+		_mm_add_ps(_mm_mul_ps(e[9], in[2]), e[13]));
+	out[2] = _mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(e[2], in[0]), _mm_mul_ps(e[6], in[1])),
+		_mm_add_ps(_mm_mul_ps(e[10], in[2]), e[14]));
+}
+
+
+// Transforms count points (w == 1) of a column-major matrix m, the points are read every inStride bytes and written every outStride bytes
+GLM_FUNC_QUALIFIER void glm_mat4_mul_point_array(float const m[16], char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+{
+	glm_vec4 E[16];
+	glm_mat4_splat(m, E);
+
+	for(; count >= 4; count -= 4, in += inStride * 4, out += outStride * 4)
+	{
+		glm_vec4 V[3];
+		glm_vec4 R[3];
+
+		if(inStride == sizeof(float) * 3)
+			glm_vec3x4_load(reinterpret_cast<float const*>(in), V);
+		else
+		{
+			float const* const s0 = reinterpret_cast<float const*>(in);
+			float const* const s1 = reinterpret_cast<float const*>(in + 1 * inStride);
+			float const* const s2 = reinterpret_cast<float const*>(in + 2 * inStride);
+			float const* const s3 = reinterpret_cast<float const*>(in + 3 * inStride);
+			for(int c = 0; c < 3; ++c)
+				V[c] = _mm_setr_ps(s0[c], s1[c], s2[c], s3[c]);
+		}
+
+		glm_mat4_mul_point_soa4(E, V, R);
+
+		if(outStride == sizeof(float) * 3)
+			glm_vec3x4_store(R, reinterpret_cast<float*>(out));
+		else
+		{
+			float Lanes[3][4];
+			for(int c = 0; c < 3; ++c)
+				_mm_storeu_ps(Lanes[c], R[c]);
+			for(std::size_t j = 0; j < 4; ++j)
+			{
+				float* const d = reinterpret_cast<float*>(out + j * outStride);
+				d[0] = Lanes[0][j];
+				d[1] = Lanes[1][j];
+				d[2] = Lanes[2][j];
+			}
+		}
+	}
+
+	for(; count > 0; --count, in += inStride, out += outStride)
+	{
+		float const* const s = reinterpret_cast<float const*>(in);
+		float* const d = reinterpret_cast<float*>(out);
+		float const x = s[0];
+		float const y = s[1];
+		float const z = s[2];
+
+		// Same operation order as glm_mat4_mul_point_soa4
+		d[0] = (m[0] * x + m[4] * y) + (m[8] * z + m[12]);
+		d[1] = (m[1] * x + m[5] * y) + (m[9] * z + m[13]);
+		d[2] = (m[2] * x + m[6] * y) + (m[10] * z + m[14]);
+	}
+}
+
+// Computes out = m * in for count vec4 read every inStride bytes and written every outStride bytes
+GLM_FUNC_QUALIFIER void glm_mat4_mul_vec4_array(float const m[16], char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+{
+	glm_vec4 M[4];
+	for(int c = 0; c < 4; ++c)
+		M[c] = _mm_loadu_ps(m + c * 4);
+
+	for(; count > 0; --count, in += inStride, out += outStride)
+	{
+		glm_vec4 const V = _mm_loadu_ps(reinterpret_cast<float const*>(in));
+		_mm_storeu_ps(reinterpret_cast<float*>(out), glm_mat4_mul_vec4(M, V));
+	}
+}
+
+// Computes out = a * b for column-major matrices stored at any float aligned address.
+// The operation order matches operator*(mat4, mat4) so that results are bitwise identical.
+GLM_FUNC_QUALIFIER void glm_mat4_mul_packed(float const a[16], float const b[16], glm_vec4 out[4])
+{
+	glm_vec4 const A0 = _mm_loadu_ps(a + 0);
+	glm_vec4 const A1 = _mm_loadu_ps(a + 4);
+	glm_vec4 const A2 = _mm_loadu_ps(a + 8);
+	glm_vec4 const A3 = _mm_loadu_ps(a + 12);
+
+	for(int i = 0; i < 4; ++i)
+	{
+		glm_vec4 const B = _mm_loadu_ps(b + i * 4);
+
+		glm_vec4 const m0 = _mm_mul_ps(A0, _mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 0, 0, 0)));
+		glm_vec4 const a0 = glm_vec4_fma(A1, _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 1, 1, 1)), m0);
+		glm_vec4 const a1 = glm_vec4_fma(A2, _mm_shuffle_ps(B, B, _MM_SHUFFLE(2, 2, 2, 2)), a0);
+		glm_vec4 const a2 = glm_vec4_fma(A3, _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 3, 3, 3)), a1);
+
+		out[i] = a2;
+	}
+}
+
+// Stores n vec4 with non-temporal stores if stream is true, out must then be 16 bytes aligned
+GLM_FUNC_QUALIFIER void glm_vec4_store_n(glm_vec4 const* in, int n, float* out, bool stream)
+{
+	for(int i = 0; i < n; ++i)
+	{
+		if(stream)
+			_mm_stream_ps(out + i * 4, in[i]);
+		else
+			_mm_storeu_ps(out + i * 4, in[i]);
+	}
+}
+
+// Computes out = a * b with glm_mat4_mul_packed and stores it with glm_vec4_store_n
+GLM_FUNC_QUALIFIER void glm_mat4_mul_packed_store(float const a[16], float const b[16], float* out, bool stream)
+{
+	glm_vec4 R[4];
+	glm_mat4_mul_packed(a, b, R);
+	glm_vec4_store_n(R, 4, out, stream);
+}
+
+// Computes the affine transform applying b then a, each stored at any float aligned address as the upper 3 rows
+// of a mat4, one row per vec4. The operation order matches affineMultiply so that results are bitwise identical.
+GLM_FUNC_QUALIFIER void glm_mat3x4_affine_mul_packed(float const a[12], float const b[12], glm_vec4 out[3])
+{
+	glm_vec4 const B0 = _mm_loadu_ps(b + 0);
+	glm_vec4 const B1 = _mm_loadu_ps(b + 4);
+	glm_vec4 const B2 = _mm_loadu_ps(b + 8);
+
+	for(int i = 0; i < 3; ++i)
+	{
+		// Broadcasts from memory don't compete with the multiplications for the shuffle unit
+		glm_vec4 const m0 = _mm_mul_ps(B0, _mm_set1_ps(a[i * 4 + 0]));
+		glm_vec4 const a0 = glm_vec4_fma(B1, _mm_set1_ps(a[i * 4 + 1]), m0);
+		glm_vec4 const a1 = glm_vec4_fma(B2, _mm_set1_ps(a[i * 4 + 2]), a0);
+
+		// Only the w lane receives the translation of a
+		glm_vec4 const w0 = _mm_add_ps(a1, _mm_set_ps(a[i * 4 + 3], 0.0f, 0.0f, 0.0f));
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			out[i] = _mm_blend_ps(a1, w0, 0x8);
+#		else
+			glm_vec4 const MaskW = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+			out[i] = _mm_or_ps(_mm_and_ps(MaskW, w0), _mm_andnot_ps(MaskW, a1));
+#		endif
+	}
+}
+
+// Computes the inverse of an affine transform stored as the upper 3 rows of a mat4, one row per vec4.
+// The operation order matches affineInverse so that results are bitwise identical.
+GLM_FUNC_QUALIFIER void glm_mat3x4_affine_inverse(glm_vec4 const in[3], glm_vec4 out[3])
+{
+	// Cofactors of the linear part, the w lanes are zero for finite inputs
+	glm_vec4 Cof[4];
+	Cof[0] = glm_vec4_cross(in[1], in[2]);
+	Cof[1] = glm_vec4_cross(in[2], in[0]);
+	Cof[2] = glm_vec4_cross(in[0], in[1]);
+
+	glm_vec4 const m0 = _mm_mul_ps(Cof[0], _mm_shuffle_ps(in[0], in[0], _MM_SHUFFLE(3, 3, 3, 3)));
+	glm_vec4 const m1 = _mm_mul_ps(Cof[1], _mm_shuffle_ps(in[1], in[1], _MM_SHUFFLE(3, 3, 3, 3)));
+	glm_vec4 const m2 = _mm_mul_ps(Cof[2], _mm_shuffle_ps(in[2], in[2], _MM_SHUFFLE(3, 3, 3, 3)));
+	// Flipping the sign bit negates zero to -0 as the scalar negation does, 0 - x would give +0
+	Cof[3] = _mm_xor_ps(_mm_add_ps(_mm_add_ps(m0, m1), m2), _mm_set1_ps(-0.0f));
+
+	glm_vec4 const d0 = _mm_mul_ps(in[0], Cof[0]);
+	glm_vec4 const d1 = _mm_add_ss(d0, _mm_shuffle_ps(d0, d0, _MM_SHUFFLE(1, 1, 1, 1)));
+	glm_vec4 const d2 = _mm_add_ss(d1, _mm_shuffle_ps(d0, d0, _MM_SHUFFLE(2, 2, 2, 2)));
+	glm_vec4 const Rcp0 = _mm_div_ss(_mm_set_ss(1.0f), d2);
+	glm_vec4 const Rcp1 = _mm_shuffle_ps(Rcp0, Rcp0, _MM_SHUFFLE(0, 0, 0, 0));
+
+	// The rows of the inverse are the columns of the cofactors and of the translation
+	glm_vec4 Rows[4];
+	glm_mat4_transpose(Cof, Rows);
+
+	for(int i = 0; i < 3; ++i)
+		out[i] = _mm_mul_ps(Rows[i], Rcp1);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_mul_dvec4(glm_dvec4 const m[4], glm_dvec4 v)
+{
+	double const* s = reinterpret_cast<double const*>(&v);
+
+	__m256d m0 = _mm256_mul_pd(m[0], _mm256_broadcast_sd(s + 0));
+	__m256d m1 = _mm256_mul_pd(m[1], _mm256_broadcast_sd(s + 1));
+	__m256d m2 = _mm256_mul_pd(m[2], _mm256_broadcast_sd(s + 2));
+	__m256d m3 = _mm256_mul_pd(m[3], _mm256_broadcast_sd(s + 3));
+
+	__m256d a0 = _mm256_add_pd(m0, m1);
+	__m256d a1 = _mm256_add_pd(m2, m3);
+	__m256d a2 = _mm256_add_pd(a0, a1);
+
+	return a2;
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_mul(glm_dvec4 const in1[4], glm_dvec4 const in2[4], glm_dvec4 out[4])
+{
+	// Each column of in2 is read straight from memory through broadcasts, which
+	// avoids the cross-lane shuffles AVX lacks for 64-bit elements.
+	double const* s = reinterpret_cast<double const*>(in2);
+
+	for(int i = 0; i < 4; ++i)
+	{
+		__m256d m0 = _mm256_mul_pd(in1[0], _mm256_broadcast_sd(s + i * 4 + 0));
+		__m256d a0 = glm_dvec4_fma(in1[1], _mm256_broadcast_sd(s + i * 4 + 1), m0);
+		__m256d a1 = glm_dvec4_fma(in1[2], _mm256_broadcast_sd(s + i * 4 + 2), a0);
+		__m256d a2 = glm_dvec4_fma(in1[3], _mm256_broadcast_sd(s + i * 4 + 3), a1);
+
+		out[i] = a2;
+	}
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_transpose(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	__m256d tmp0 = _mm256_unpacklo_pd(in[0], in[1]);
+	__m256d tmp1 = _mm256_unpackhi_pd(in[0], in[1]);
+	__m256d tmp2 = _mm256_unpacklo_pd(in[2], in[3]);
+	__m256d tmp3 = _mm256_unpackhi_pd(in[2], in[3]);
+
+	out[0] = _mm256_permute2f128_pd(tmp0, tmp2, 0x20);
+	out[1] = _mm256_permute2f128_pd(tmp1, tmp3, 0x20);
+	out[2] = _mm256_permute2f128_pd(tmp0, tmp2, 0x31);
+	out[3] = _mm256_permute2f128_pd(tmp1, tmp3, 0x31);
+}
+
+// Signed cofactors of the matrix laid out as columns, ie the adjugate:
+// inverse(m) == adjugate(m) / determinant(m)
+GLM_FUNC_QUALIFIER void glm_dmat4_adjugate(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	// (m[3][k], m[3][k], m[2][k], m[2][k])
+	__m256d Lo32 = _mm256_permute2f128_pd(in[3], in[2], 0x20);
+	__m256d Hi32 = _mm256_permute2f128_pd(in[3], in[2], 0x31);
+	__m256d Pair32_0 = _mm256_unpacklo_pd(Lo32, Lo32);
+	__m256d Pair32_1 = _mm256_unpackhi_pd(Lo32, Lo32);
+	__m256d Pair32_2 = _mm256_unpacklo_pd(Hi32, Hi32);
+	__m256d Pair32_3 = _mm256_unpackhi_pd(Hi32, Hi32);
+
+	// (m[2][k], m[2][k], m[1][k], m[1][k])
+	__m256d Lo21 = _mm256_permute2f128_pd(in[2], in[1], 0x20);
+	__m256d Hi21 = _mm256_permute2f128_pd(in[2], in[1], 0x31);
+	__m256d Swp21_0 = _mm256_unpacklo_pd(Lo21, Lo21);
+	__m256d Swp21_1 = _mm256_unpackhi_pd(Lo21, Lo21);
+	__m256d Swp21_2 = _mm256_unpacklo_pd(Hi21, Hi21);
+	__m256d Swp21_3 = _mm256_unpackhi_pd(Hi21, Hi21);
+
+	// (m[3][k], m[3][k], m[3][k], m[2][k])
+	__m256d Swp32_0 = _mm256_blend_pd(_mm256_permute2f128_pd(Pair32_0, Pair32_0, 0x00), Pair32_0, 0x8);
+	__m256d Swp32_1 = _mm256_blend_pd(_mm256_permute2f128_pd(Pair32_1, Pair32_1, 0x00), Pair32_1, 0x8);
+	__m256d Swp32_2 = _mm256_blend_pd(_mm256_permute2f128_pd(Pair32_2, Pair32_2, 0x00), Pair32_2, 0x8);
+	__m256d Swp32_3 = _mm256_blend_pd(_mm256_permute2f128_pd(Pair32_3, Pair32_3, 0x00), Pair32_3, 0x8);
+
+	//	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+	//	valType SubFactor00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+	//	valType SubFactor06 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+	//	valType SubFactor13 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+	__m256d Fac0 = _mm256_sub_pd(_mm256_mul_pd(Swp21_2, Swp32_3), _mm256_mul_pd(Swp32_2, Swp21_3));
+	__m256d Fac1 = _mm256_sub_pd(_mm256_mul_pd(Swp21_1, Swp32_3), _mm256_mul_pd(Swp32_1, Swp21_3));
+	__m256d Fac2 = _mm256_sub_pd(_mm256_mul_pd(Swp21_1, Swp32_2), _mm256_mul_pd(Swp32_1, Swp21_2));
+	__m256d Fac3 = _mm256_sub_pd(_mm256_mul_pd(Swp21_0, Swp32_3), _mm256_mul_pd(Swp32_0, Swp21_3));
+	__m256d Fac4 = _mm256_sub_pd(_mm256_mul_pd(Swp21_0, Swp32_2), _mm256_mul_pd(Swp32_0, Swp21_2));
+	__m256d Fac5 = _mm256_sub_pd(_mm256_mul_pd(Swp21_0, Swp32_1), _mm256_mul_pd(Swp32_0, Swp21_1));
+
+	// (m[1][k], m[0][k], m[0][k], m[0][k])
+	__m256d Lo10 = _mm256_permute2f128_pd(in[1], in[0], 0x20);
+	__m256d Hi10 = _mm256_permute2f128_pd(in[1], in[0], 0x31);
+	__m256d Temp0 = _mm256_unpacklo_pd(Lo10, Lo10);
+	__m256d Temp1 = _mm256_unpackhi_pd(Lo10, Lo10);
+	__m256d Temp2 = _mm256_unpacklo_pd(Hi10, Hi10);
+	__m256d Temp3 = _mm256_unpackhi_pd(Hi10, Hi10);
+	__m256d Vec0 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp0, Temp0, 0x11), Temp0, 0x1);
+	__m256d Vec1 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp1, Temp1, 0x11), Temp1, 0x1);
+	__m256d Vec2 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp2, Temp2, 0x11), Temp2, 0x1);
+	__m256d Vec3 = _mm256_blend_pd(_mm256_permute2f128_pd(Temp3, Temp3, 0x11), Temp3, 0x1);
+
+	__m256d SignA = _mm256_set_pd(-1.0,  1.0, -1.0,  1.0);
+	__m256d SignB = _mm256_set_pd( 1.0, -1.0,  1.0, -1.0);
+
+	// Inv0 = Vec1 * Fac0 - Vec2 * Fac1 + Vec3 * Fac2
+	__m256d Sub00 = _mm256_sub_pd(_mm256_mul_pd(Vec1, Fac0), _mm256_mul_pd(Vec2, Fac1));
+	out[0] = _mm256_mul_pd(SignA, _mm256_add_pd(Sub00, _mm256_mul_pd(Vec3, Fac2)));
+
+	// Inv1 = Vec0 * Fac0 - Vec2 * Fac3 + Vec3 * Fac4
+	__m256d Sub01 = _mm256_sub_pd(_mm256_mul_pd(Vec0, Fac0), _mm256_mul_pd(Vec2, Fac3));
+	out[1] = _mm256_mul_pd(SignB, _mm256_add_pd(Sub01, _mm256_mul_pd(Vec3, Fac4)));
+
+	// Inv2 = Vec0 * Fac1 - Vec1 * Fac3 + Vec3 * Fac5
+	__m256d Sub02 = _mm256_sub_pd(_mm256_mul_pd(Vec0, Fac1), _mm256_mul_pd(Vec1, Fac3));
+	out[2] = _mm256_mul_pd(SignA, _mm256_add_pd(Sub02, _mm256_mul_pd(Vec3, Fac5)));
+
+	// Inv3 = Vec0 * Fac2 - Vec1 * Fac4 + Vec2 * Fac5
+	__m256d Sub03 = _mm256_sub_pd(_mm256_mul_pd(Vec0, Fac2), _mm256_mul_pd(Vec1, Fac4));
+	out[3] = _mm256_mul_pd(SignB, _mm256_add_pd(Sub03, _mm256_mul_pd(Vec2, Fac5)));
+}
+
+// Returns the determinant splatted in the four components
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_determinant_adjugate(glm_dvec4 const in[4], glm_dvec4 const adj[4])
+{
+	// (Inverse[0][0], Inverse[1][0], Inverse[2][0], Inverse[3][0])
+	__m256d Row0 = _mm256_unpacklo_pd(adj[0], adj[1]);
+	__m256d Row1 = _mm256_unpacklo_pd(adj[2], adj[3]);
+	__m256d Row2 = _mm256_permute2f128_pd(Row0, Row1, 0x20);
+
+	//	valType Determinant = (m[0][0] * Inverse[0][0] + m[0][1] * Inverse[1][0])
+	//						+ (m[0][2] * Inverse[2][0] + m[0][3] * Inverse[3][0]);
+	__m256d Dot0 = _mm256_mul_pd(in[0], Row2);
+	__m256d Add0 = _mm256_hadd_pd(Dot0, Dot0);
+	__m256d Swp0 = _mm256_permute2f128_pd(Add0, Add0, 0x01);
+	return _mm256_add_pd(Add0, Swp0);
+}
+
+GLM_FUNC_QUALIFIER glm_dvec4 glm_dmat4_determinant(glm_dvec4 const in[4])
+{
+	glm_dvec4 Adj[4];
+	glm_dmat4_adjugate(in, Adj);
+	return glm_dmat4_determinant_adjugate(in, Adj);
+}
+
+GLM_FUNC_QUALIFIER void glm_dmat4_inverse(glm_dvec4 const in[4], glm_dvec4 out[4])
+{
+	glm_dvec4 Adj[4];
+	glm_dmat4_adjugate(in, Adj);
+
+	__m256d Det0 = glm_dmat4_determinant_adjugate(in, Adj);
+	__m256d Rcp0 = _mm256_div_pd(_mm256_set1_pd(1.0), Det0);
+
+	//	Inverse /= Determinant;
+	out[0] = _mm256_mul_pd(Adj[0], Rcp0);
+	out[1] = _mm256_mul_pd(Adj[1], Rcp0);
+	out[2] = _mm256_mul_pd(Adj[2], Rcp0);
+	out[3] = _mm256_mul_pd(Adj[3], Rcp0);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Float kernels of bulk functions, also built with target attributes for runtime dispatch
+#if GLM_ARCH_DISPATCH & GLM_ARCH_AVX_BIT
+
+// Splats each of the 16 elements of a column-major matrix in its own register
+GLM_FUNC_TARGET_AVX GLM_FUNC_QUALIFIER void glm_mat4_splat8(float const m[16], glm_f32vec8 out[16])
+{
+	for(int i = 0; i < 16; ++i)
+		out[i] = _mm256_set1_ps(m[i]);
+}
+
+// Deinterleaves 8 packed vec3 into x, y and z lanes, same shuffles as glm_vec3x4_load on both 128-bit halves
+GLM_FUNC_TARGET_AVX GLM_FUNC_QUALIFIER void glm_vec3x8_load(float const* in, glm_f32vec8 out[3])
+{
+	__m256 const a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 0)), _mm_loadu_ps(in + 12), 1);
+	__m256 const b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 4)), _mm_loadu_ps(in + 16), 1);
+	__m256 const c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(in + 8)), _mm_loadu_ps(in + 20), 1);
+
+	__m256 const Tx0 = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+	__m256 const Ty0 = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+	__m256 const Ty1 = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+	__m256 const Tz0 = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+
+	out[0] = _mm256_shuffle_ps(a, Tx0, _MM_SHUFFLE(2, 0, 3, 0));
+	out[1] = _mm256_shuffle_ps(Ty0, Ty1, _MM_SHUFFLE(2, 0, 2, 0));
+	out[2] = _mm256_shuffle_ps(Tz0, c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+// Interleaves x, y and z lanes back into 8 packed vec3
+GLM_FUNC_TARGET_AVX GLM_FUNC_QUALIFIER void glm_vec3x8_store(glm_f32vec8 const in[3], float* out)
+{
+	__m256 const T0 = _mm256_shuffle_ps(in[0], in[1], _MM_SHUFFLE(0, 0, 0, 0));
+	__m256 const T1 = _mm256_shuffle_ps(in[2], in[0], _MM_SHUFFLE(1, 1, 0, 0));
+	__m256 const T2 = _mm256_shuffle_ps(in[1], in[2], _MM_SHUFFLE(1, 1, 1, 1));
+	__m256 const T3 = _mm256_shuffle_ps(in[0], in[1], _MM_SHUFFLE(2, 2, 2, 2));
+	__m256 const T4 = _mm256_shuffle_ps(in[2], in[0], _MM_SHUFFLE(3, 3, 2, 2));
+	__m256 const T5 = _mm256_shuffle_ps(in[1], in[2], _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m256 const a = _mm256_shuffle_ps(T0, T1, _MM_SHUFFLE(2, 0, 2, 0));
+	__m256 const b = _mm256_shuffle_ps(T2, T3, _MM_SHUFFLE(2, 0, 2, 0));
+	__m256 const c = _mm256_shuffle_ps(T4, T5, _MM_SHUFFLE(2, 0, 2, 0));
+
+	_mm_storeu_ps(out + 0, _mm256_castps256_ps128(a));
+	_mm_storeu_ps(out + 4, _mm256_castps256_ps128(b));
+	_mm_storeu_ps(out + 8, _mm256_castps256_ps128(c));
+	_mm_storeu_ps(out + 12, _mm256_extractf128_ps(a, 1));
+	_mm_storeu_ps(out + 16, _mm256_extractf128_ps(b, 1));
+	_mm_storeu_ps(out + 20, _mm256_extractf128_ps(c, 1));
+}
+
+// Transforms 8 points (w == 1) stored as x, y and z lanes by a matrix splatted with glm_mat4_splat8
+GLM_FUNC_TARGET_AVX GLM_FUNC_QUALIFIER void glm_mat4_mul_point_soa8(glm_f32vec8 const e[16], glm_f32vec8 const in[3], glm_f32vec8 out[3])
+{
+	out[0] = _mm256_add_ps(
+		_mm256_add_ps(_mm256_mul_ps(e[0], in[0]), _mm256_mul_ps(e[4], in[1])),
+		_mm256_add_ps(_mm256_mul_ps(e[8], in[2]), e[12]));
+	out[1] = _mm256_add_ps(
+		_mm256_add_ps(_mm256_mul_ps(e[1], in[0]), _mm256_mul_ps(e[5], in[1])),
+		_mm256_add_ps(_mm256_mul_ps(e[9], in[2]), e[13]));
+	out[2] = _mm256_add_ps(
+		_mm256_add_ps(_mm256_mul_ps(e[2], in[0]), _mm256_mul_ps(e[6], in[1])),
+		_mm256_add_ps(_mm256_mul_ps(e[10], in[2]), e[14]));
+}
+
+// Transforms 2 consecutive vec4 at once, m holds each matrix column duplicated in both halves
+GLM_FUNC_TARGET_AVX GLM_FUNC_QUALIFIER glm_f32vec8 glm_mat4_mul_vec4x2(glm_f32vec8 const m[4], glm_f32vec8 v)
+{
+	__m256 const m0 = _mm256_mul_ps(m[0], _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m256 const m1 = _mm256_mul_ps(m[1], _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m256 const m2 = _mm256_mul_ps(m[2], _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)));
+	__m256 const m3 = _mm256_mul_ps(m[3], _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)));
+
+	__m256 const a0 = _mm256_add_ps(m0, m1);
+	__m256 const a1 = _mm256_add_ps(m2, m3);
+	return _mm256_add_ps(a0, a1);
+}
+
+// AVX version of glm_mat4_mul_point_array, packed points are processed 8 at a time
+GLM_FUNC_TARGET_AVX GLM_FUNC_QUALIFIER void glm_mat4_mul_point_array_avx(float const m[16], char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+{
+	if(inStride == sizeof(float) * 3 && outStride == sizeof(float) * 3)
+	{
+		glm_f32vec8 E[16];
+		glm_mat4_splat8(m, E);
+
+		for(; count >= 8; count -= 8, in += inStride * 8, out += outStride * 8)
+		{
+			glm_f32vec8 V[3];
+			glm_f32vec8 R[3];
+			glm_vec3x8_load(reinterpret_cast<float const*>(in), V);
+			glm_mat4_mul_point_soa8(E, V, R);
+			glm_vec3x8_store(R, reinterpret_cast<float*>(out));
+		}
+	}
+
+	glm_mat4_mul_point_array(m, in, inStride, out, outStride, count);
+}
+
+// AVX version of glm_mat4_mul_vec4_array, vectors are processed 2 at a time
+GLM_FUNC_TARGET_AVX GLM_FUNC_QUALIFIER void glm_mat4_mul_vec4_array_avx(float const m[16], char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+{
+	glm_f32vec8 M[4];
+	for(int c = 0; c < 4; ++c)
+		M[c] = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + c * 4));
+
+	for(; count >= 2; count -= 2, in += inStride * 2, out += outStride * 2)
+	{
+		float const* const s0 = reinterpret_cast<float const*>(in);
+		float const* const s1 = reinterpret_cast<float const*>(in + 1 * inStride);
+		glm_f32vec8 const V = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(s0)), _mm_loadu_ps(s1), 1);
+		glm_f32vec8 const R = glm_mat4_mul_vec4x2(M, V);
+		_mm_storeu_ps(reinterpret_cast<float*>(out), _mm256_castps256_ps128(R));
+		_mm_storeu_ps(reinterpret_cast<float*>(out + 1 * outStride), _mm256_extractf128_ps(R, 1));
+	}
+
+	glm_mat4_mul_vec4_array(m, in, inStride, out, outStride, count);
+}
+
+// AVX version of glm_mat4_mul_packed computing two columns per register
+GLM_FUNC_TARGET_AVX GLM_FUNC_QUALIFIER void glm_mat4_mul_packed_avx(float const a[16], float const b[16], glm_f32vec8 out[2])
+{
+	glm_f32vec8 const A0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 0));
+	glm_f32vec8 const A1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 4));
+	glm_f32vec8 const A2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 8));
+	glm_f32vec8 const A3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(a + 12));
+
+	for(int i = 0; i < 2; ++i)
+	{
+		glm_f32vec8 const B = _mm256_loadu_ps(b + i * 8);
+
+		glm_f32vec8 const m0 = _mm256_mul_ps(A0, _mm256_permute_ps(B, _MM_SHUFFLE(0, 0, 0, 0)));
+#		ifdef GLM_FORCE_FMA
+			glm_f32vec8 const a0 = _mm256_fmadd_ps(A1, _mm256_permute_ps(B, _MM_SHUFFLE(1, 1, 1, 1)), m0);
+			glm_f32vec8 const a1 = _mm256_fmadd_ps(A2, _mm256_permute_ps(B, _MM_SHUFFLE(2, 2, 2, 2)), a0);
+			glm_f32vec8 const a2 = _mm256_fmadd_ps(A3, _mm256_permute_ps(B, _MM_SHUFFLE(3, 3, 3, 3)), a1);
+#		else
+			glm_f32vec8 const a0 = _mm256_add_ps(_mm256_mul_ps(A1, _mm256_permute_ps(B, _MM_SHUFFLE(1, 1, 1, 1))), m0);
+			glm_f32vec8 const a1 = _mm256_add_ps(_mm256_mul_ps(A2, _mm256_permute_ps(B, _MM_SHUFFLE(2, 2, 2, 2))), a0);
+			glm_f32vec8 const a2 = _mm256_add_ps(_mm256_mul_ps(A3, _mm256_permute_ps(B, _MM_SHUFFLE(3, 3, 3, 3))), a1);
+#		endif
+
+		out[i] = a2;
+	}
+}
+
+// Stores a mat4 held in two registers, with non-temporal stores if stream is true. Non-temporal stores require out to be 16 bytes aligned.
+GLM_FUNC_TARGET_AVX GLM_FUNC_QUALIFIER void glm_mat4_store_avx(glm_f32vec8 const in[2], float* out, bool stream)
+{
+	if(stream)
+	{
+		_mm_stream_ps(out + 0, _mm256_castps256_ps128(in[0]));
+		_mm_stream_ps(out + 4, _mm256_extractf128_ps(in[0], 1));
+		_mm_stream_ps(out + 8, _mm256_castps256_ps128(in[1]));
+		_mm_stream_ps(out + 12, _mm256_extractf128_ps(in[1], 1));
+	}
+	else
+	{
+		_mm256_storeu_ps(out + 0, in[0]);
+		_mm256_storeu_ps(out + 8, in[1]);
+	}
+}
+
+// Computes out = a * b with glm_mat4_mul_packed_avx and stores it with glm_mat4_store_avx
+GLM_FUNC_TARGET_AVX GLM_FUNC_QUALIFIER void glm_mat4_mul_packed_store_avx(float const a[16], float const b[16], float* out, bool stream)
+{
+	glm_f32vec8 R[2];
+	glm_mat4_mul_packed_avx(a, b, R);
+	glm_mat4_store_avx(R, out, stream);
+}
+
+#endif//GLM_ARCH_DISPATCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH_DISPATCH & GLM_ARCH_AVX512_BIT
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+	// GCC 12 reports the _mm512_undefined_ps used by AVX-512 intrinsics as uninitialized, bug 105593
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wuninitialized"
+#	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// glm_mat4_mul_packed with the whole matrix in one register, column i of the result is held in lane i
+GLM_FUNC_TARGET_AVX512 GLM_FUNC_QUALIFIER __m512 glm_mat4_mul_packed_avx512(float const a[16], float const b[16])
+{
+	__m512 const B = _mm512_loadu_ps(b);
+
+	__m512 const A0 = _mm512_broadcast_f32x4(_mm_loadu_ps(a + 0));
+	__m512 const A1 = _mm512_broadcast_f32x4(_mm_loadu_ps(a + 4));
+	__m512 const A2 = _mm512_broadcast_f32x4(_mm_loadu_ps(a + 8));
+	__m512 const A3 = _mm512_broadcast_f32x4(_mm_loadu_ps(a + 12));
+
+	// Same operation order as glm_dmat4_mul and the aligned C++ implementation
+	__m512 const m0 = _mm512_mul_ps(A0, _mm512_permute_ps(B, _MM_SHUFFLE(0, 0, 0, 0)));
+#	ifdef GLM_FORCE_FMA
+		__m512 const a0 = _mm512_fmadd_ps(A1, _mm512_permute_ps(B, _MM_SHUFFLE(1, 1, 1, 1)), m0);
+		__m512 const a1 = _mm512_fmadd_ps(A2, _mm512_permute_ps(B, _MM_SHUFFLE(2, 2, 2, 2)), a0);
+		__m512 const a2 = _mm512_fmadd_ps(A3, _mm512_permute_ps(B, _MM_SHUFFLE(3, 3, 3, 3)), a1);
+#	else
+		__m512 const a0 = _mm512_add_ps(_mm512_mul_ps(A1, _mm512_permute_ps(B, _MM_SHUFFLE(1, 1, 1, 1))), m0);
+		__m512 const a1 = _mm512_add_ps(_mm512_mul_ps(A2, _mm512_permute_ps(B, _MM_SHUFFLE(2, 2, 2, 2))), a0);
+		__m512 const a2 = _mm512_add_ps(_mm512_mul_ps(A3, _mm512_permute_ps(B, _MM_SHUFFLE(3, 3, 3, 3))), a1);
+#	endif
+
+	return a2;
+}
+
+// Stores a mat4 held in one register, with non-temporal stores if stream is true. Non-temporal stores require out to be 16 bytes aligned.
+GLM_FUNC_TARGET_AVX512 GLM_FUNC_QUALIFIER void glm_mat4_store_avx512(__m512 in, float* out, bool stream)
+{
+	if(stream)
+	{
+		_mm_stream_ps(out + 0, _mm512_castps512_ps128(in));
+		_mm_stream_ps(out + 4, _mm512_extractf32x4_ps(in, 1));
+		_mm_stream_ps(out + 8, _mm512_extractf32x4_ps(in, 2));
+		_mm_stream_ps(out + 12, _mm512_extractf32x4_ps(in, 3));
+	}
+	else
+		_mm512_storeu_ps(out, in);
+}
+
+// Computes out = a * b with glm_mat4_mul_packed_avx512 and stores it with glm_mat4_store_avx512
+GLM_FUNC_TARGET_AVX512 GLM_FUNC_QUALIFIER void glm_mat4_mul_packed_store_avx512(float const a[16], float const b[16], float* out, bool stream)
+{
+	glm_mat4_store_avx512(glm_mat4_mul_packed_avx512(a, b), out, stream);
+}
+
+// Transforms 4 consecutive vec4 at once, m holds each matrix column in all four lanes
+GLM_FUNC_TARGET_AVX512 GLM_FUNC_QUALIFIER glm_f32vec16 glm_mat4_mul_vec4x4(glm_f32vec16 const m[4], glm_f32vec16 v)
+{
+	__m512 const m0 = _mm512_mul_ps(m[0], _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+	__m512 const m1 = _mm512_mul_ps(m[1], _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)));
+	__m512 const m2 = _mm512_mul_ps(m[2], _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)));
+	__m512 const m3 = _mm512_mul_ps(m[3], _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)));
+
+	__m512 const a0 = _mm512_add_ps(m0, m1);
+	__m512 const a1 = _mm512_add_ps(m2, m3);
+	return _mm512_add_ps(a0, a1);
+}
+
+// AVX-512 version of glm_mat4_mul_vec4_array, vectors are processed 4 at a time
+GLM_FUNC_TARGET_AVX512 GLM_FUNC_QUALIFIER void glm_mat4_mul_vec4_array_avx512(float const m[16], char const* in, std::size_t inStride, char* out, std::size_t outStride, std::size_t count)
+{
+	glm_f32vec16 M[4];
+	for(int c = 0; c < 4; ++c)
+		M[c] = _mm512_broadcast_f32x4(_mm_loadu_ps(m + c * 4));
+
+	if(inStride == sizeof(float) * 4 && outStride == sizeof(float) * 4)
+	{
+		for(; count >= 4; count -= 4, in += inStride * 4, out += outStride * 4)
+		{
+			glm_f32vec16 const V = _mm512_loadu_ps(reinterpret_cast<float const*>(in));
+			_mm512_storeu_ps(reinterpret_cast<float*>(out), glm_mat4_mul_vec4x4(M, V));
+		}
+	}
+
+	for(; count >= 4; count -= 4, in += inStride * 4, out += outStride * 4)
+	{
+		glm_f32vec16 V = _mm512_castps128_ps512(_mm_loadu_ps(reinterpret_cast<float const*>(in)));
+		V = _mm512_insertf32x4(V, _mm_loadu_ps(reinterpret_cast<float const*>(in + 1 * inStride)), 1);
+		V = _mm512_insertf32x4(V, _mm_loadu_ps(reinterpret_cast<float const*>(in + 2 * inStride)), 2);
+		V = _mm512_insertf32x4(V, _mm_loadu_ps(reinterpret_cast<float const*>(in + 3 * inStride)), 3);
+
+		glm_f32vec16 const R = glm_mat4_mul_vec4x4(M, V);
+		_mm_storeu_ps(reinterpret_cast<float*>(out), _mm512_castps512_ps128(R));
+		_mm_storeu_ps(reinterpret_cast<float*>(out + 1 * outStride), _mm512_extractf32x4_ps(R, 1));
+		_mm_storeu_ps(reinterpret_cast<float*>(out + 2 * outStride), _mm512_extractf32x4_ps(R, 2));
+		_mm_storeu_ps(reinterpret_cast<float*>(out + 3 * outStride), _mm512_extractf32x4_ps(R, 3));
+	}
+
+	glm_mat4_mul_vec4_array(m, in, inStride, out, outStride, count);
+}
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC diagnostic pop
+#endif
+
+#endif//GLM_ARCH_DISPATCH & GLM_ARCH_AVX512_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+	// GCC 12 reports the _mm512_undefined_ps used by AVX-512 intrinsics as uninitialized, bug 105593
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wuninitialized"
+#	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+GLM_FUNC_QUALIFIER void glm_mat4_mul_avx512(glm_vec4 const in1[4], glm_vec4 const in2[4], glm_vec4 out[4])
+{
+	__m512 const Result = glm_mat4_mul_packed_avx512(reinterpret_cast<float const*>(in1), reinterpret_cast<float const*>(in2));
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), Result);
+}
+
+GLM_FUNC_QUALIFIER void glm_mat4_transpose_avx512(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	__m512 const m = _mm512_loadu_ps(reinterpret_cast<float const*>(in));
+	__m512i const Index = _mm512_set_epi32(15, 11, 7, 3, 14, 10, 6, 2, 13, 9, 5, 1, 12, 8, 4, 0);
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), _mm512_permutexvar_ps(Index, m));
+}
+
+// glm_mat4_inverse computing the six Fac and the four inverse columns in lanes of two registers.
+// Element permutations replace the shuffles, the operation order and so the results are the same.
+GLM_FUNC_QUALIFIER void glm_mat4_inverse_avx512(glm_vec4 const in[4], glm_vec4 out[4])
+{
+	__m512 const m = _mm512_loadu_ps(reinterpret_cast<float const*>(in));
+
+	// Lane i of FacLo holds Fac[i], lanes 0 and 1 of FacHi hold Fac4 and Fac5:
+	// Fac[i] = Swp00 * Swp01 - Swp02 * Swp03
+	__m512 FacLo;
+	{
+		__m512 const Swp00 = _mm512_permutexvar_ps(_mm512_set_epi32(4, 4, 8, 8, 5, 5, 9, 9, 5, 5, 9, 9, 6, 6, 10, 10), m);
+		__m512 const Swp01 = _mm512_permutexvar_ps(_mm512_set_epi32(11, 15, 15, 15, 10, 14, 14, 14, 11, 15, 15, 15, 11, 15, 15, 15), m);
+		__m512 const Swp02 = _mm512_permutexvar_ps(_mm512_set_epi32(8, 12, 12, 12, 9, 13, 13, 13, 9, 13, 13, 13, 10, 14, 14, 14), m);
+		__m512 const Swp03 = _mm512_permutexvar_ps(_mm512_set_epi32(7, 7, 11, 11, 6, 6, 10, 10, 7, 7, 11, 11, 7, 7, 11, 11), m);
+		FacLo = _mm512_sub_ps(_mm512_mul_ps(Swp00, Swp01), _mm512_mul_ps(Swp02, Swp03));
+	}
+
+	__m512 FacHi;
+	{
+		__m512 const Swp00 = _mm512_permutexvar_ps(_mm512_set_epi32(4, 4, 8, 8, 4, 4, 8, 8, 4, 4, 8, 8, 4, 4, 8, 8), m);
+		__m512 const Swp01 = _mm512_permutexvar_ps(_mm512_set_epi32(9, 13, 13, 13, 10, 14, 14, 14, 9, 13, 13, 13, 10, 14, 14, 14), m);
+		__m512 const Swp02 = _mm512_permutexvar_ps(_mm512_set_epi32(8, 12, 12, 12, 8, 12, 12, 12, 8, 12, 12, 12, 8, 12, 12, 12), m);
+		__m512 const Swp03 = _mm512_permutexvar_ps(_mm512_set_epi32(5, 5, 9, 9, 6, 6, 10, 10, 5, 5, 9, 9, 6, 6, 10, 10), m);
+		FacHi = _mm512_sub_ps(_mm512_mul_ps(Swp00, Swp01), _mm512_mul_ps(Swp02, Swp03));
+	}
+
+	// Vec[i] = (m[1][i], m[0][i], m[0][i], m[0][i])
+	// Inv0 = SignB * (Vec1 * Fac0 - Vec2 * Fac1 + Vec3 * Fac2)
+	// Inv1 = SignA * (Vec0 * Fac0 - Vec2 * Fac3 + Vec3 * Fac4)
+	// Inv2 = SignB * (Vec0 * Fac1 - Vec1 * Fac3 + Vec3 * Fac5)
+	// Inv3 = SignA * (Vec0 * Fac2 - Vec1 * Fac4 + Vec2 * Fac5)
+	__m512 const VecA = _mm512_permutexvar_ps(_mm512_set_epi32(0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 4, 1, 1, 1, 5), m);
+	__m512 const VecB = _mm512_permutexvar_ps(_mm512_set_epi32(1, 1, 1, 5, 1, 1, 1, 5, 2, 2, 2, 6, 2, 2, 2, 6), m);
+	__m512 const VecC = _mm512_permutexvar_ps(_mm512_set_epi32(2, 2, 2, 6, 3, 3, 3, 7, 3, 3, 3, 7, 3, 3, 3, 7), m);
+	__m512 const FacA = _mm512_permutex2var_ps(FacLo, _mm512_set_epi32(11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 3, 2, 1, 0), FacHi);
+	__m512 const FacB = _mm512_permutex2var_ps(FacLo, _mm512_set_epi32(19, 18, 17, 16, 15, 14, 13, 12, 15, 14, 13, 12, 7, 6, 5, 4), FacHi);
+	__m512 const FacC = _mm512_permutex2var_ps(FacLo, _mm512_set_epi32(23, 22, 21, 20, 23, 22, 21, 20, 19, 18, 17, 16, 11, 10, 9, 8), FacHi);
+
+	__m512 const Sign = _mm512_set_ps(
+		 1.0f,-1.0f, 1.0f,-1.0f,
+		-1.0f, 1.0f,-1.0f, 1.0f,
+		 1.0f,-1.0f, 1.0f,-1.0f,
+		-1.0f, 1.0f,-1.0f, 1.0f);
+
+	__m512 const Mul0 = _mm512_mul_ps(VecA, FacA);
+	__m512 const Mul1 = _mm512_mul_ps(VecB, FacB);
+	__m512 const Mul2 = _mm512_mul_ps(VecC, FacC);
+	__m512 const Sub0 = _mm512_sub_ps(Mul0, Mul1);
+	__m512 const Add0 = _mm512_add_ps(Sub0, Mul2);
+	__m512 const Inv = _mm512_mul_ps(Sign, Add0);
+
+	//	valType Determinant = m[0][0] * Inverse[0][0]
+	//						+ m[0][1] * Inverse[1][0]
+	//						+ m[0][2] * Inverse[2][0]
+	//						+ m[0][3] * Inverse[3][0];
+	__m128 const Row2 = _mm512_castps512_ps128(_mm512_permutexvar_ps(_mm512_set_epi32(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 8, 4, 0), Inv));
+	__m128 const Det0 = glm_vec4_dot(in[0], Row2);
+	__m128 const Rcp0 = _mm_div_ps(_mm_set1_ps(1.0f), Det0);
+
+	//	Inverse /= Determinant;
+	_mm512_storeu_ps(reinterpret_cast<float*>(out), _mm512_mul_ps(Inv, _mm512_broadcast_f32x4(Rcp0)));
+}
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC diagnostic pop
+#endif
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
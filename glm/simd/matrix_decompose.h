@@ -0,0 +1,327 @@
+/// @ref simd
+/// @file glm/simd/matrix_decompose.h
+
+#pragma once
+
+#include "quaternion.h"
+#include <limits>
+
+// Kernels of the affine batch functions of GLM_GTX_matrix_decompose. Matrices are transposed into one register
+// per element, m[c * 3 + r] holding row r of column c of the upper 3x3 part, so that each lane holds one matrix.
+// The operation orders match decomposeAffine and recomposeAffine, the quaternion extraction evaluating the
+// 4 cases of the scalar code and selecting the one of each lane.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Loads 4 mat3x4 affine transforms stored as in GLM_EXT_matrix_affine, one row per vec4,
+// out[r * 4 + c] receiving row r of column c, the translation being column 3
+GLM_FUNC_QUALIFIER void glm_mat3x4_soa4_load(float const* in, glm_vec4 out[12])
+{
+	for(int g = 0; g < 3; ++g)
+	{
+		glm_vec4 const Block[4] = {_mm_loadu_ps(in + g * 4), _mm_loadu_ps(in + 12 + g * 4), _mm_loadu_ps(in + 24 + g * 4), _mm_loadu_ps(in + 36 + g * 4)};
+		glm_mat4_transpose(Block, out + g * 4);
+	}
+}
+
+// Stores 4 mat3x4 affine transforms from their components, in[r * 4 + c] holding row r of column c
+GLM_FUNC_QUALIFIER void glm_mat3x4_soa4_store(glm_vec4 const in[12], float* out)
+{
+	for(int g = 0; g < 3; ++g)
+	{
+		glm_vec4 Block[4];
+		glm_mat4_transpose(in + g * 4, Block);
+		_mm_storeu_ps(out + g * 4, Block[0]);
+		_mm_storeu_ps(out + 12 + g * 4, Block[1]);
+		_mm_storeu_ps(out + 24 + g * 4, Block[2]);
+		_mm_storeu_ps(out + 36 + g * 4, Block[3]);
+	}
+}
+
+// Loads 4 mat4, out[c * 4 + r] receives row r of column c
+GLM_FUNC_QUALIFIER void glm_mat4_soa4_load(float const* in, glm_vec4 out[16])
+{
+	for(int c = 0; c < 4; ++c)
+	{
+		glm_vec4 const Columns[4] = {_mm_loadu_ps(in + c * 4), _mm_loadu_ps(in + 16 + c * 4), _mm_loadu_ps(in + 32 + c * 4), _mm_loadu_ps(in + 48 + c * 4)};
+		glm_mat4_transpose(Columns, out + c * 4);
+	}
+}
+
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec3_soa4_dot(glm_vec4 const a[3], glm_vec4 const b[3])
+{
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])), _mm_mul_ps(a[2], b[2]));
+}
+
+// Decomposes the upper 3x3 parts m of 4 affine transforms, m[c * 3 + r] holding row r of column c.
+// Returns the mask of the lanes that aren't singular, the others receiving a null scale and skew and an identity orientation.
+GLM_FUNC_QUALIFIER glm_vec4 glm_decompose_affine_soa4(glm_vec4 const m[9], glm_vec4 Scale[3], glm_vec4 Orientation[4], glm_vec4 Skew[3])
+{
+	glm_vec4 const Zero = _mm_setzero_ps();
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+	glm_vec4 const Half = _mm_set1_ps(0.5f);
+
+	glm_vec4 Row0[3], Row1[3], Row2[3];
+
+	// Gram-Schmidt orthogonalization of the columns, computing the scale and shear factors
+	Scale[0] = _mm_sqrt_ps(glm_vec3_soa4_dot(m + 0, m + 0));
+	for(int r = 0; r < 3; ++r)
+		Row0[r] = _mm_div_ps(m[r], Scale[0]);
+
+	Skew[2] = glm_vec3_soa4_dot(Row0, m + 3);
+	for(int r = 0; r < 3; ++r)
+		Row1[r] = _mm_sub_ps(m[3 + r], _mm_mul_ps(Row0[r], Skew[2]));
+	Scale[1] = _mm_sqrt_ps(glm_vec3_soa4_dot(Row1, Row1));
+	for(int r = 0; r < 3; ++r)
+		Row1[r] = _mm_div_ps(Row1[r], Scale[1]);
+	Skew[2] = _mm_div_ps(Skew[2], Scale[1]);
+
+	Skew[1] = glm_vec3_soa4_dot(Row0, m + 6);
+	for(int r = 0; r < 3; ++r)
+		Row2[r] = _mm_sub_ps(m[6 + r], _mm_mul_ps(Row0[r], Skew[1]));
+	Skew[0] = glm_vec3_soa4_dot(Row1, Row2);
+	for(int r = 0; r < 3; ++r)
+		Row2[r] = _mm_sub_ps(Row2[r], _mm_mul_ps(Row1[r], Skew[0]));
+	Scale[2] = _mm_sqrt_ps(glm_vec3_soa4_dot(Row2, Row2));
+	for(int r = 0; r < 3; ++r)
+		Row2[r] = _mm_div_ps(Row2[r], Scale[2]);
+	Skew[1] = _mm_div_ps(Skew[1], Scale[2]);
+	Skew[0] = _mm_div_ps(Skew[0], Scale[2]);
+
+	// Singular when a scale factor is not larger than epsilon times the largest one
+	glm_vec4 const MaxScale = _mm_max_ps(_mm_max_ps(Scale[0], Scale[1]), Scale[2]);
+	glm_vec4 const MinScale = _mm_mul_ps(_mm_set1_ps(std::numeric_limits<float>::epsilon()), MaxScale);
+	glm_vec4 const Valid = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(Scale[0], MinScale), _mm_cmpgt_ps(Scale[1], MinScale)), _mm_cmpgt_ps(Scale[2], MinScale));
+
+	// Flip the axes and the scale factors of the transforms with a negative determinant
+	glm_vec4 const Cross[3] = {
+		_mm_sub_ps(_mm_mul_ps(Row1[1], Row2[2]), _mm_mul_ps(Row2[1], Row1[2])),
+		_mm_sub_ps(_mm_mul_ps(Row1[2], Row2[0]), _mm_mul_ps(Row2[2], Row1[0])),
+		_mm_sub_ps(_mm_mul_ps(Row1[0], Row2[1]), _mm_mul_ps(Row2[0], Row1[1]))};
+	glm_vec4 const Flip = _mm_and_ps(_mm_cmplt_ps(glm_vec3_soa4_dot(Row0, Cross), Zero), _mm_set1_ps(-0.0f));
+	for(int r = 0; r < 3; ++r)
+	{
+		Scale[r] = _mm_xor_ps(Scale[r], Flip);
+		Row0[r] = _mm_xor_ps(Row0[r], Flip);
+		Row1[r] = _mm_xor_ps(Row1[r], Flip);
+		Row2[r] = _mm_xor_ps(Row2[r], Flip);
+	}
+
+	// Quaternion of the rotation: the trace case, or the case of the largest diagonal element i
+	glm_vec4 const Trace = _mm_add_ps(_mm_add_ps(Row0[0], Row1[1]), Row2[2]);
+	glm_vec4 const CaseT = _mm_cmpgt_ps(Trace, Zero);
+	glm_vec4 const Greater1 = _mm_cmpgt_ps(Row1[1], Row0[0]);
+	glm_vec4 const Greater2 = _mm_cmpgt_ps(Row2[2], glm_vec4_select(Greater1, Row1[1], Row0[0]));
+	glm_vec4 const Case2 = _mm_andnot_ps(CaseT, Greater2);
+	glm_vec4 const Case1 = _mm_andnot_ps(CaseT, _mm_andnot_ps(Greater2, Greater1));
+	glm_vec4 const Case0 = _mm_andnot_ps(CaseT, _mm_andnot_ps(Greater2, _mm_andnot_ps(Greater1, _mm_castsi128_ps(_mm_set1_epi32(-1)))));
+
+	glm_vec4 Radicand = Trace;
+	Radicand = glm_vec4_select(Case0, _mm_sub_ps(_mm_sub_ps(Row0[0], Row1[1]), Row2[2]), Radicand);
+	Radicand = glm_vec4_select(Case1, _mm_sub_ps(_mm_sub_ps(Row1[1], Row2[2]), Row0[0]), Radicand);
+	Radicand = glm_vec4_select(Case2, _mm_sub_ps(_mm_sub_ps(Row2[2], Row0[0]), Row1[1]), Radicand);
+	glm_vec4 const Root = _mm_sqrt_ps(_mm_add_ps(Radicand, One));
+	glm_vec4 const Diagonal = _mm_mul_ps(Half, Root);
+	glm_vec4 const Factor = _mm_div_ps(Half, Root);
+
+	glm_vec4 const Dx = _mm_sub_ps(Row1[2], Row2[1]);
+	glm_vec4 const Dy = _mm_sub_ps(Row2[0], Row0[2]);
+	glm_vec4 const Dz = _mm_sub_ps(Row0[1], Row1[0]);
+	glm_vec4 const Sxy = _mm_add_ps(Row0[1], Row1[0]);
+	glm_vec4 const Sxz = _mm_add_ps(Row0[2], Row2[0]);
+	glm_vec4 const Syz = _mm_add_ps(Row1[2], Row2[1]);
+
+	glm_vec4 const x = _mm_mul_ps(Factor, glm_vec4_select(Case1, Sxy, glm_vec4_select(Case2, Sxz, Dx)));
+	glm_vec4 const y = _mm_mul_ps(Factor, glm_vec4_select(Case0, Sxy, glm_vec4_select(Case2, Syz, Dy)));
+	glm_vec4 const z = _mm_mul_ps(Factor, glm_vec4_select(Case0, Sxz, glm_vec4_select(Case1, Syz, Dz)));
+	glm_vec4 const w = _mm_mul_ps(Factor, glm_vec4_select(Case0, Dx, glm_vec4_select(Case1, Dy, Dz)));
+	Orientation[0] = glm_vec4_select(Case0, Diagonal, x);
+	Orientation[1] = glm_vec4_select(Case1, Diagonal, y);
+	Orientation[2] = glm_vec4_select(Case2, Diagonal, z);
+	Orientation[3] = glm_vec4_select(CaseT, Diagonal, w);
+
+	for(int r = 0; r < 3; ++r)
+	{
+		Scale[r] = _mm_and_ps(Valid, Scale[r]);
+		Skew[r] = _mm_and_ps(Valid, Skew[r]);
+		Orientation[r] = _mm_and_ps(Valid, Orientation[r]);
+	}
+	Orientation[3] = glm_vec4_select(Valid, Orientation[3], One);
+
+	return Valid;
+}
+
+// Recomposes the upper 3x3 parts m of 4 affine transforms from their decomposition, m[c * 3 + r] receiving row r of column c
+GLM_FUNC_QUALIFIER void glm_recompose_affine_soa4(glm_vec4 const Scale[3], glm_vec4 const Orientation[4], glm_vec4 const Skew[3], glm_vec4 m[9])
+{
+	glm_vec4 Rotation[9];
+	glm_quat_soa4_mat3(Orientation, Rotation);
+
+	for(int r = 0; r < 3; ++r)
+	{
+		m[0 + r] = _mm_mul_ps(Rotation[0 + r], Scale[0]);
+		m[3 + r] = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(Rotation[0 + r], Skew[2]), Rotation[3 + r]), Scale[1]);
+		m[6 + r] = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Rotation[0 + r], Skew[1]), _mm_mul_ps(Rotation[3 + r], Skew[0])), Rotation[6 + r]), Scale[2]);
+	}
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// 8 lanes variant of glm_mat3x4_soa4_load
+GLM_FUNC_QUALIFIER void glm_mat3x4_soa8_load(float const* in, glm_f32vec8 out[12])
+{
+	for(int g = 0; g < 3; ++g)
+	{
+		glm_f32vec8 const Block[4] = {
+			glm_vec8_loadu2(in + g * 4, in + 48 + g * 4),
+			glm_vec8_loadu2(in + 12 + g * 4, in + 60 + g * 4),
+			glm_vec8_loadu2(in + 24 + g * 4, in + 72 + g * 4),
+			glm_vec8_loadu2(in + 36 + g * 4, in + 84 + g * 4)};
+		glm_vec8_transpose4(Block, out + g * 4);
+	}
+}
+
+// 8 lanes variant of glm_mat3x4_soa4_store
+GLM_FUNC_QUALIFIER void glm_mat3x4_soa8_store(glm_f32vec8 const in[12], float* out)
+{
+	for(int g = 0; g < 3; ++g)
+	{
+		glm_f32vec8 Block[4];
+		glm_vec8_transpose4(in + g * 4, Block);
+		glm_vec8_storeu2(out + g * 4, out + 48 + g * 4, Block[0]);
+		glm_vec8_storeu2(out + 12 + g * 4, out + 60 + g * 4, Block[1]);
+		glm_vec8_storeu2(out + 24 + g * 4, out + 72 + g * 4, Block[2]);
+		glm_vec8_storeu2(out + 36 + g * 4, out + 84 + g * 4, Block[3]);
+	}
+}
+
+// 8 lanes variant of glm_mat4_soa4_load
+GLM_FUNC_QUALIFIER void glm_mat4_soa8_load(float const* in, glm_f32vec8 out[16])
+{
+	for(int c = 0; c < 4; ++c)
+	{
+		glm_f32vec8 const Columns[4] = {
+			glm_vec8_loadu2(in + c * 4, in + 64 + c * 4),
+			glm_vec8_loadu2(in + 16 + c * 4, in + 80 + c * 4),
+			glm_vec8_loadu2(in + 32 + c * 4, in + 96 + c * 4),
+			glm_vec8_loadu2(in + 48 + c * 4, in + 112 + c * 4)};
+		glm_vec8_transpose4(Columns, out + c * 4);
+	}
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec3_soa8_dot(glm_f32vec8 const a[3], glm_f32vec8 const b[3])
+{
+	return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[0], b[0]), _mm256_mul_ps(a[1], b[1])), _mm256_mul_ps(a[2], b[2]));
+}
+
+// 8 lanes variant of glm_decompose_affine_soa4
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_decompose_affine_soa8(glm_f32vec8 const m[9], glm_f32vec8 Scale[3], glm_f32vec8 Orientation[4], glm_f32vec8 Skew[3])
+{
+	glm_f32vec8 const Zero = _mm256_setzero_ps();
+	glm_f32vec8 const One = _mm256_set1_ps(1.0f);
+	glm_f32vec8 const Half = _mm256_set1_ps(0.5f);
+
+	glm_f32vec8 Row0[3], Row1[3], Row2[3];
+
+	Scale[0] = _mm256_sqrt_ps(glm_vec3_soa8_dot(m + 0, m + 0));
+	for(int r = 0; r < 3; ++r)
+		Row0[r] = _mm256_div_ps(m[r], Scale[0]);
+
+	Skew[2] = glm_vec3_soa8_dot(Row0, m + 3);
+	for(int r = 0; r < 3; ++r)
+		Row1[r] = _mm256_sub_ps(m[3 + r], _mm256_mul_ps(Row0[r], Skew[2]));
+	Scale[1] = _mm256_sqrt_ps(glm_vec3_soa8_dot(Row1, Row1));
+	for(int r = 0; r < 3; ++r)
+		Row1[r] = _mm256_div_ps(Row1[r], Scale[1]);
+	Skew[2] = _mm256_div_ps(Skew[2], Scale[1]);
+
+	Skew[1] = glm_vec3_soa8_dot(Row0, m + 6);
+	for(int r = 0; r < 3; ++r)
+		Row2[r] = _mm256_sub_ps(m[6 + r], _mm256_mul_ps(Row0[r], Skew[1]));
+	Skew[0] = glm_vec3_soa8_dot(Row1, Row2);
+	for(int r = 0; r < 3; ++r)
+		Row2[r] = _mm256_sub_ps(Row2[r], _mm256_mul_ps(Row1[r], Skew[0]));
+	Scale[2] = _mm256_sqrt_ps(glm_vec3_soa8_dot(Row2, Row2));
+	for(int r = 0; r < 3; ++r)
+		Row2[r] = _mm256_div_ps(Row2[r], Scale[2]);
+	Skew[1] = _mm256_div_ps(Skew[1], Scale[2]);
+	Skew[0] = _mm256_div_ps(Skew[0], Scale[2]);
+
+	glm_f32vec8 const MaxScale = _mm256_max_ps(_mm256_max_ps(Scale[0], Scale[1]), Scale[2]);
+	glm_f32vec8 const MinScale = _mm256_mul_ps(_mm256_set1_ps(std::numeric_limits<float>::epsilon()), MaxScale);
+	glm_f32vec8 const Valid = _mm256_and_ps(_mm256_and_ps(
+		_mm256_cmp_ps(Scale[0], MinScale, _CMP_GT_OQ), _mm256_cmp_ps(Scale[1], MinScale, _CMP_GT_OQ)), _mm256_cmp_ps(Scale[2], MinScale, _CMP_GT_OQ));
+
+	glm_f32vec8 const Cross[3] = {
+		_mm256_sub_ps(_mm256_mul_ps(Row1[1], Row2[2]), _mm256_mul_ps(Row2[1], Row1[2])),
+		_mm256_sub_ps(_mm256_mul_ps(Row1[2], Row2[0]), _mm256_mul_ps(Row2[2], Row1[0])),
+		_mm256_sub_ps(_mm256_mul_ps(Row1[0], Row2[1]), _mm256_mul_ps(Row2[0], Row1[1]))};
+	glm_f32vec8 const Flip = _mm256_and_ps(_mm256_cmp_ps(glm_vec3_soa8_dot(Row0, Cross), Zero, _CMP_LT_OQ), _mm256_set1_ps(-0.0f));
+	for(int r = 0; r < 3; ++r)
+	{
+		Scale[r] = _mm256_xor_ps(Scale[r], Flip);
+		Row0[r] = _mm256_xor_ps(Row0[r], Flip);
+		Row1[r] = _mm256_xor_ps(Row1[r], Flip);
+		Row2[r] = _mm256_xor_ps(Row2[r], Flip);
+	}
+
+	glm_f32vec8 const Trace = _mm256_add_ps(_mm256_add_ps(Row0[0], Row1[1]), Row2[2]);
+	glm_f32vec8 const CaseT = _mm256_cmp_ps(Trace, Zero, _CMP_GT_OQ);
+	glm_f32vec8 const Greater1 = _mm256_cmp_ps(Row1[1], Row0[0], _CMP_GT_OQ);
+	glm_f32vec8 const Greater2 = _mm256_cmp_ps(Row2[2], _mm256_blendv_ps(Row0[0], Row1[1], Greater1), _CMP_GT_OQ);
+	glm_f32vec8 const Case2 = _mm256_andnot_ps(CaseT, Greater2);
+	glm_f32vec8 const Case1 = _mm256_andnot_ps(CaseT, _mm256_andnot_ps(Greater2, Greater1));
+	glm_f32vec8 const Case0 = _mm256_andnot_ps(CaseT, _mm256_andnot_ps(Greater2, _mm256_andnot_ps(Greater1, _mm256_castsi256_ps(_mm256_set1_epi32(-1)))));
+
+	glm_f32vec8 Radicand = Trace;
+	Radicand = _mm256_blendv_ps(Radicand, _mm256_sub_ps(_mm256_sub_ps(Row0[0], Row1[1]), Row2[2]), Case0);
+	Radicand = _mm256_blendv_ps(Radicand, _mm256_sub_ps(_mm256_sub_ps(Row1[1], Row2[2]), Row0[0]), Case1);
+	Radicand = _mm256_blendv_ps(Radicand, _mm256_sub_ps(_mm256_sub_ps(Row2[2], Row0[0]), Row1[1]), Case2);
+	glm_f32vec8 const Root = _mm256_sqrt_ps(_mm256_add_ps(Radicand, One));
+	glm_f32vec8 const Diagonal = _mm256_mul_ps(Half, Root);
+	glm_f32vec8 const Factor = _mm256_div_ps(Half, Root);
+
+	glm_f32vec8 const Dx = _mm256_sub_ps(Row1[2], Row2[1]);
+	glm_f32vec8 const Dy = _mm256_sub_ps(Row2[0], Row0[2]);
+	glm_f32vec8 const Dz = _mm256_sub_ps(Row0[1], Row1[0]);
+	glm_f32vec8 const Sxy = _mm256_add_ps(Row0[1], Row1[0]);
+	glm_f32vec8 const Sxz = _mm256_add_ps(Row0[2], Row2[0]);
+	glm_f32vec8 const Syz = _mm256_add_ps(Row1[2], Row2[1]);
+
+	glm_f32vec8 const x = _mm256_mul_ps(Factor, _mm256_blendv_ps(_mm256_blendv_ps(Dx, Sxz, Case2), Sxy, Case1));
+	glm_f32vec8 const y = _mm256_mul_ps(Factor, _mm256_blendv_ps(_mm256_blendv_ps(Dy, Syz, Case2), Sxy, Case0));
+	glm_f32vec8 const z = _mm256_mul_ps(Factor, _mm256_blendv_ps(_mm256_blendv_ps(Dz, Syz, Case1), Sxz, Case0));
+	glm_f32vec8 const w = _mm256_mul_ps(Factor, _mm256_blendv_ps(_mm256_blendv_ps(Dz, Dy, Case1), Dx, Case0));
+	Orientation[0] = _mm256_blendv_ps(x, Diagonal, Case0);
+	Orientation[1] = _mm256_blendv_ps(y, Diagonal, Case1);
+	Orientation[2] = _mm256_blendv_ps(z, Diagonal, Case2);
+	Orientation[3] = _mm256_blendv_ps(w, Diagonal, CaseT);
+
+	for(int r = 0; r < 3; ++r)
+	{
+		Scale[r] = _mm256_and_ps(Valid, Scale[r]);
+		Skew[r] = _mm256_and_ps(Valid, Skew[r]);
+		Orientation[r] = _mm256_and_ps(Valid, Orientation[r]);
+	}
+	Orientation[3] = _mm256_blendv_ps(One, Orientation[3], Valid);
+
+	return Valid;
+}
+
+// 8 lanes variant of glm_recompose_affine_soa4
+GLM_FUNC_QUALIFIER void glm_recompose_affine_soa8(glm_f32vec8 const Scale[3], glm_f32vec8 const Orientation[4], glm_f32vec8 const Skew[3], glm_f32vec8 m[9])
+{
+	glm_f32vec8 Rotation[9];
+	glm_quat_soa8_mat3(Orientation, Rotation);
+
+	for(int r = 0; r < 3; ++r)
+	{
+		m[0 + r] = _mm256_mul_ps(Rotation[0 + r], Scale[0]);
+		m[3 + r] = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(Rotation[0 + r], Skew[2]), Rotation[3 + r]), Scale[1]);
+		m[6 + r] = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(Rotation[0 + r], Skew[1]), _mm256_mul_ps(Rotation[3 + r], Skew[0])), Rotation[6 + r]), Scale[2]);
+	}
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
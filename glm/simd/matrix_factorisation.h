@@ -0,0 +1,355 @@
+/// @ref simd
+/// @file glm/simd/matrix_factorisation.h
+
+#pragma once
+
+#include "quaternion.h"
+
+// Kernels of the batch functions of GLM_GTX_matrix_factorisation. Matrices are transposed into one register per
+// element, m[c * 3 + r] holding row r of column c, so that each lane holds one matrix. The operation orders match
+// svd_decompose and polar_decompose, conditional swaps and the choices of the rotations being selected per lane.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Loads 4 packed mat3, out[c * 3 + r] receives row r of column c
+GLM_FUNC_QUALIFIER void glm_mat3_soa4_load(float const* in, glm_vec4 out[9])
+{
+	glm_vec4 const Lo[4] = {_mm_loadu_ps(in + 0), _mm_loadu_ps(in + 9), _mm_loadu_ps(in + 18), _mm_loadu_ps(in + 27)};
+	glm_vec4 const Hi[4] = {_mm_loadu_ps(in + 4), _mm_loadu_ps(in + 13), _mm_loadu_ps(in + 22), _mm_loadu_ps(in + 31)};
+	glm_mat4_transpose(Lo, out + 0);
+	glm_mat4_transpose(Hi, out + 4);
+	out[8] = _mm_set_ps(in[35], in[26], in[17], in[8]);
+}
+
+// Cosine and sine of the Jacobi rotation of the pivot block app, apq, aqq, and their half angle
+GLM_FUNC_QUALIFIER void glm_svd_jacobi_soa4(glm_vec4 app, glm_vec4 apq, glm_vec4 aqq, glm_vec4* ch, glm_vec4* sh, glm_vec4* c, glm_vec4* s)
+{
+	glm_vec4 const Two = _mm_set1_ps(2.0f);
+	glm_vec4 const Ch = _mm_mul_ps(Two, _mm_sub_ps(app, aqq));
+	glm_vec4 const Sh = apq;
+	glm_vec4 const InvLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(Ch, Ch), _mm_mul_ps(Sh, Sh))));
+	glm_vec4 const Accurate = _mm_cmplt_ps(_mm_mul_ps(_mm_set1_ps(5.82842712474619009760f), _mm_mul_ps(Sh, Sh)), _mm_mul_ps(Ch, Ch));
+	*ch = glm_vec4_select(Accurate, _mm_mul_ps(Ch, InvLength), _mm_set1_ps(0.92387953251128675613f));
+	*sh = glm_vec4_select(Accurate, _mm_mul_ps(Sh, InvLength), _mm_set1_ps(0.38268343236508977173f));
+	*c = _mm_sub_ps(_mm_mul_ps(*ch, *ch), _mm_mul_ps(*sh, *sh));
+	*s = _mm_mul_ps(_mm_mul_ps(Two, *ch), *sh);
+}
+
+// Cosine and sine of the Givens rotation zeroing a2 against the pivot a1
+GLM_FUNC_QUALIFIER void glm_svd_qr_soa4(glm_vec4 a1, glm_vec4 a2, glm_vec4* c, glm_vec4* s)
+{
+	glm_vec4 const Zero = _mm_setzero_ps();
+	glm_vec4 const Tolerance = _mm_set1_ps(1.0842021724855044e-19f); // sqrt(std::numeric_limits<float>::min())
+	glm_vec4 const Rho = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(a1, a1), _mm_mul_ps(a2, a2)));
+	glm_vec4 const Sh = glm_vec4_select(_mm_cmpgt_ps(Rho, Tolerance), a2, Zero);
+	glm_vec4 const Ch = _mm_add_ps(glm_vec4_abs(a1), _mm_max_ps(Rho, Tolerance));
+	glm_vec4 const Negative = _mm_cmplt_ps(a1, Zero);
+	glm_vec4 const CosHalf = glm_vec4_select(Negative, Sh, Ch);
+	glm_vec4 const SinHalf = glm_vec4_select(Negative, Ch, Sh);
+	glm_vec4 const InvLength2 = _mm_div_ps(_mm_set1_ps(1.0f), _mm_add_ps(_mm_mul_ps(CosHalf, CosHalf), _mm_mul_ps(SinHalf, SinHalf)));
+	*c = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(CosHalf, CosHalf), _mm_mul_ps(SinHalf, SinHalf)), InvLength2);
+	*s = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(2.0f), CosHalf), SinHalf), InvLength2);
+}
+
+// Singular value decomposition of 4 matrices, u * diagonal3x3(s) * transpose(v) = m
+GLM_FUNC_QUALIFIER void glm_svd3x3_soa4(glm_vec4 const m[9], glm_vec4 u[9], glm_vec4 s[3], glm_vec4 v[9])
+{
+	glm_vec4 const Zero = _mm_setzero_ps();
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+	glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+	glm_vec4 const Tolerance = _mm_set1_ps(1.0842021724855044e-19f); // sqrt(std::numeric_limits<float>::min())
+
+	glm_vec4 Largest = Zero;
+	for(int i = 0; i < 9; ++i)
+		Largest = _mm_max_ps(Largest, glm_vec4_abs(m[i]));
+	glm_vec4 const Scale = glm_vec4_select(_mm_cmpgt_ps(Largest, Zero), _mm_div_ps(One, Largest), One);
+
+	glm_vec4 a[9];
+	for(int i = 0; i < 9; ++i)
+		a[i] = _mm_mul_ps(m[i], Scale);
+
+	glm_vec4 n[9];
+	for(int c = 0; c < 3; ++c)
+	for(int r = 0; r < 3; ++r)
+		n[c * 3 + r] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[r * 3 + 0], a[c * 3 + 0]), _mm_mul_ps(a[r * 3 + 1], a[c * 3 + 1])), _mm_mul_ps(a[r * 3 + 2], a[c * 3 + 2]));
+
+	glm_vec4 q[4] = {Zero, Zero, Zero, One};
+	for(int Sweep = 0; Sweep < 6; ++Sweep)
+	for(int p = 0; p < 3; ++p)
+	{
+		int const k = (p + 1) % 3;
+		int const r = (p + 2) % 3;
+
+		glm_vec4 const Npk = glm_vec4_select(_mm_cmplt_ps(glm_vec4_abs(n[p * 3 + k]), Tolerance), Zero, n[p * 3 + k]);
+
+		glm_vec4 ch, sh, Cos, Sin;
+		glm_svd_jacobi_soa4(n[p * 4], Npk, n[k * 4], &ch, &sh, &Cos, &Sin);
+
+		glm_vec4 const Xp = _mm_add_ps(_mm_mul_ps(Cos, n[p * 4]), _mm_mul_ps(Sin, Npk));
+		glm_vec4 const Yp = _mm_add_ps(_mm_mul_ps(Cos, Npk), _mm_mul_ps(Sin, n[k * 4]));
+		glm_vec4 const Xk = _mm_sub_ps(_mm_mul_ps(Cos, Npk), _mm_mul_ps(Sin, n[p * 4]));
+		glm_vec4 const Yk = _mm_sub_ps(_mm_mul_ps(Cos, n[k * 4]), _mm_mul_ps(Sin, Npk));
+		glm_vec4 const Rp = _mm_add_ps(_mm_mul_ps(Cos, n[r * 3 + p]), _mm_mul_ps(Sin, n[r * 3 + k]));
+		glm_vec4 const Rk = _mm_sub_ps(_mm_mul_ps(Cos, n[r * 3 + k]), _mm_mul_ps(Sin, n[r * 3 + p]));
+		n[p * 4] = _mm_add_ps(_mm_mul_ps(Cos, Xp), _mm_mul_ps(Sin, Yp));
+		n[k * 4] = _mm_sub_ps(_mm_mul_ps(Cos, Yk), _mm_mul_ps(Sin, Xk));
+		n[p * 3 + k] = n[k * 3 + p] = _mm_add_ps(_mm_mul_ps(Cos, Xk), _mm_mul_ps(Sin, Yk));
+		n[r * 3 + p] = n[p * 3 + r] = Rp;
+		n[r * 3 + k] = n[k * 3 + r] = Rk;
+
+		glm_vec4 const Qp = _mm_add_ps(_mm_mul_ps(ch, q[p]), _mm_mul_ps(sh, q[k]));
+		glm_vec4 const Qk = _mm_sub_ps(_mm_mul_ps(ch, q[k]), _mm_mul_ps(sh, q[p]));
+		glm_vec4 const Qr = _mm_add_ps(_mm_mul_ps(ch, q[r]), _mm_mul_ps(sh, q[3]));
+		glm_vec4 const Qw = _mm_sub_ps(_mm_mul_ps(ch, q[3]), _mm_mul_ps(sh, q[r]));
+		q[p] = Qp;
+		q[k] = Qk;
+		q[r] = Qr;
+		q[3] = Qw;
+	}
+
+	glm_vec4 const Length2 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(q[0], q[0]), _mm_mul_ps(q[1], q[1])), _mm_mul_ps(q[2], q[2])), _mm_mul_ps(q[3], q[3]));
+	glm_vec4 const InvLength = _mm_div_ps(One, _mm_sqrt_ps(Length2));
+	for(int i = 0; i < 4; ++i)
+		q[i] = _mm_mul_ps(q[i], InvLength);
+	glm_quat_soa4_mat3(q, v);
+
+	glm_vec4 b[9];
+	for(int c = 0; c < 3; ++c)
+	for(int r = 0; r < 3; ++r)
+		b[c * 3 + r] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0 * 3 + r], v[c * 3 + 0]), _mm_mul_ps(a[1 * 3 + r], v[c * 3 + 1])), _mm_mul_ps(a[2 * 3 + r], v[c * 3 + 2]));
+
+	glm_vec4 ColumnLength2[3];
+	for(int c = 0; c < 3; ++c)
+		ColumnLength2[c] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b[c * 3 + 0], b[c * 3 + 0]), _mm_mul_ps(b[c * 3 + 1], b[c * 3 + 1])), _mm_mul_ps(b[c * 3 + 2], b[c * 3 + 2]));
+	for(int i = 0; i < 2; ++i)
+	for(int j = i + 1; j < 3; ++j)
+	{
+		glm_vec4 const Swap = _mm_cmplt_ps(ColumnLength2[i], ColumnLength2[j]);
+		for(int r = 0; r < 3; ++r)
+		{
+			glm_vec4 const B = b[i * 3 + r];
+			b[i * 3 + r] = glm_vec4_select(Swap, b[j * 3 + r], B);
+			b[j * 3 + r] = glm_vec4_select(Swap, _mm_xor_ps(B, SignMask), b[j * 3 + r]);
+			glm_vec4 const V = v[i * 3 + r];
+			v[i * 3 + r] = glm_vec4_select(Swap, v[j * 3 + r], V);
+			v[j * 3 + r] = glm_vec4_select(Swap, _mm_xor_ps(V, SignMask), v[j * 3 + r]);
+		}
+		glm_vec4 const L = ColumnLength2[i];
+		ColumnLength2[i] = glm_vec4_select(Swap, ColumnLength2[j], L);
+		ColumnLength2[j] = glm_vec4_select(Swap, L, ColumnLength2[j]);
+	}
+
+	for(int i = 0; i < 9; ++i)
+		u[i] = i % 4 == 0 ? One : Zero;
+	for(int p = 0; p < 2; ++p)
+	for(int k = p + 1; k < 3; ++k)
+	{
+		glm_vec4 Cos, Sin;
+		glm_svd_qr_soa4(b[p * 4], b[p * 3 + k], &Cos, &Sin);
+		for(int i = 0; i < 3; ++i)
+		{
+			glm_vec4 const Bp = b[i * 3 + p];
+			glm_vec4 const Bk = b[i * 3 + k];
+			b[i * 3 + p] = _mm_add_ps(_mm_mul_ps(Cos, Bp), _mm_mul_ps(Sin, Bk));
+			b[i * 3 + k] = _mm_sub_ps(_mm_mul_ps(Cos, Bk), _mm_mul_ps(Sin, Bp));
+			glm_vec4 const Up = u[p * 3 + i];
+			glm_vec4 const Uk = u[k * 3 + i];
+			u[p * 3 + i] = _mm_add_ps(_mm_mul_ps(Cos, Up), _mm_mul_ps(Sin, Uk));
+			u[k * 3 + i] = _mm_sub_ps(_mm_mul_ps(Cos, Uk), _mm_mul_ps(Sin, Up));
+		}
+	}
+
+	for(int i = 0; i < 3; ++i)
+		s[i] = _mm_mul_ps(b[i * 4], Largest);
+}
+
+// Polar decomposition from the singular value decomposition, r = u * transpose(v) and p = v * diagonal3x3(s) * transpose(v)
+GLM_FUNC_QUALIFIER void glm_polar3x3_soa4(glm_vec4 const u[9], glm_vec4 const s[3], glm_vec4 const v[9], glm_vec4 r[9], glm_vec4 p[9])
+{
+	for(int c = 0; c < 3; ++c)
+	for(int i = 0; i < 3; ++i)
+	{
+		r[c * 3 + i] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(u[0 * 3 + i], v[0 * 3 + c]), _mm_mul_ps(u[1 * 3 + i], v[1 * 3 + c])), _mm_mul_ps(u[2 * 3 + i], v[2 * 3 + c]));
+		p[c * 3 + i] = _mm_add_ps(_mm_add_ps(
+			_mm_mul_ps(_mm_mul_ps(v[0 * 3 + i], s[0]), v[0 * 3 + c]),
+			_mm_mul_ps(_mm_mul_ps(v[1 * 3 + i], s[1]), v[1 * 3 + c])),
+			_mm_mul_ps(_mm_mul_ps(v[2 * 3 + i], s[2]), v[2 * 3 + c]));
+	}
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// 8 lanes variant of glm_mat3_soa4_load
+GLM_FUNC_QUALIFIER void glm_mat3_soa8_load(float const* in, glm_f32vec8 out[9])
+{
+	glm_f32vec8 const Lo[4] = {glm_vec8_loadu2(in + 0, in + 36), glm_vec8_loadu2(in + 9, in + 45), glm_vec8_loadu2(in + 18, in + 54), glm_vec8_loadu2(in + 27, in + 63)};
+	glm_f32vec8 const Hi[4] = {glm_vec8_loadu2(in + 4, in + 40), glm_vec8_loadu2(in + 13, in + 49), glm_vec8_loadu2(in + 22, in + 58), glm_vec8_loadu2(in + 31, in + 67)};
+	glm_vec8_transpose4(Lo, out + 0);
+	glm_vec8_transpose4(Hi, out + 4);
+	out[8] = _mm256_set_ps(in[71], in[62], in[53], in[44], in[35], in[26], in[17], in[8]);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_abs(glm_f32vec8 x)
+{
+	return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+}
+
+// 8 lanes variant of glm_svd_jacobi_soa4
+GLM_FUNC_QUALIFIER void glm_svd_jacobi_soa8(glm_f32vec8 app, glm_f32vec8 apq, glm_f32vec8 aqq, glm_f32vec8* ch, glm_f32vec8* sh, glm_f32vec8* c, glm_f32vec8* s)
+{
+	glm_f32vec8 const Two = _mm256_set1_ps(2.0f);
+	glm_f32vec8 const Ch = _mm256_mul_ps(Two, _mm256_sub_ps(app, aqq));
+	glm_f32vec8 const Sh = apq;
+	glm_f32vec8 const InvLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(Ch, Ch), _mm256_mul_ps(Sh, Sh))));
+	glm_f32vec8 const Accurate = _mm256_cmp_ps(_mm256_mul_ps(_mm256_set1_ps(5.82842712474619009760f), _mm256_mul_ps(Sh, Sh)), _mm256_mul_ps(Ch, Ch), _CMP_LT_OQ);
+	*ch = _mm256_blendv_ps(_mm256_set1_ps(0.92387953251128675613f), _mm256_mul_ps(Ch, InvLength), Accurate);
+	*sh = _mm256_blendv_ps(_mm256_set1_ps(0.38268343236508977173f), _mm256_mul_ps(Sh, InvLength), Accurate);
+	*c = _mm256_sub_ps(_mm256_mul_ps(*ch, *ch), _mm256_mul_ps(*sh, *sh));
+	*s = _mm256_mul_ps(_mm256_mul_ps(Two, *ch), *sh);
+}
+
+// 8 lanes variant of glm_svd_qr_soa4
+GLM_FUNC_QUALIFIER void glm_svd_qr_soa8(glm_f32vec8 a1, glm_f32vec8 a2, glm_f32vec8* c, glm_f32vec8* s)
+{
+	glm_f32vec8 const Zero = _mm256_setzero_ps();
+	glm_f32vec8 const Tolerance = _mm256_set1_ps(1.0842021724855044e-19f); // sqrt(std::numeric_limits<float>::min())
+	glm_f32vec8 const Rho = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(a1, a1), _mm256_mul_ps(a2, a2)));
+	glm_f32vec8 const Sh = _mm256_blendv_ps(Zero, a2, _mm256_cmp_ps(Rho, Tolerance, _CMP_GT_OQ));
+	glm_f32vec8 const Ch = _mm256_add_ps(glm_vec8_abs(a1), _mm256_max_ps(Rho, Tolerance));
+	glm_f32vec8 const Negative = _mm256_cmp_ps(a1, Zero, _CMP_LT_OQ);
+	glm_f32vec8 const CosHalf = _mm256_blendv_ps(Ch, Sh, Negative);
+	glm_f32vec8 const SinHalf = _mm256_blendv_ps(Sh, Ch, Negative);
+	glm_f32vec8 const InvLength2 = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_add_ps(_mm256_mul_ps(CosHalf, CosHalf), _mm256_mul_ps(SinHalf, SinHalf)));
+	*c = _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(CosHalf, CosHalf), _mm256_mul_ps(SinHalf, SinHalf)), InvLength2);
+	*s = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), CosHalf), SinHalf), InvLength2);
+}
+
+// 8 lanes variant of glm_svd3x3_soa4
+GLM_FUNC_QUALIFIER void glm_svd3x3_soa8(glm_f32vec8 const m[9], glm_f32vec8 u[9], glm_f32vec8 s[3], glm_f32vec8 v[9])
+{
+	glm_f32vec8 const Zero = _mm256_setzero_ps();
+	glm_f32vec8 const One = _mm256_set1_ps(1.0f);
+	glm_f32vec8 const SignMask = _mm256_set1_ps(-0.0f);
+	glm_f32vec8 const Tolerance = _mm256_set1_ps(1.0842021724855044e-19f); // sqrt(std::numeric_limits<float>::min())
+
+	glm_f32vec8 Largest = Zero;
+	for(int i = 0; i < 9; ++i)
+		Largest = _mm256_max_ps(Largest, glm_vec8_abs(m[i]));
+	glm_f32vec8 const Scale = _mm256_blendv_ps(One, _mm256_div_ps(One, Largest), _mm256_cmp_ps(Largest, Zero, _CMP_GT_OQ));
+
+	glm_f32vec8 a[9];
+	for(int i = 0; i < 9; ++i)
+		a[i] = _mm256_mul_ps(m[i], Scale);
+
+	glm_f32vec8 n[9];
+	for(int c = 0; c < 3; ++c)
+	for(int r = 0; r < 3; ++r)
+		n[c * 3 + r] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[r * 3 + 0], a[c * 3 + 0]), _mm256_mul_ps(a[r * 3 + 1], a[c * 3 + 1])), _mm256_mul_ps(a[r * 3 + 2], a[c * 3 + 2]));
+
+	glm_f32vec8 q[4] = {Zero, Zero, Zero, One};
+	for(int Sweep = 0; Sweep < 6; ++Sweep)
+	for(int p = 0; p < 3; ++p)
+	{
+		int const k = (p + 1) % 3;
+		int const r = (p + 2) % 3;
+
+		glm_f32vec8 const Npk = _mm256_blendv_ps(n[p * 3 + k], Zero, _mm256_cmp_ps(glm_vec8_abs(n[p * 3 + k]), Tolerance, _CMP_LT_OQ));
+
+		glm_f32vec8 ch, sh, Cos, Sin;
+		glm_svd_jacobi_soa8(n[p * 4], Npk, n[k * 4], &ch, &sh, &Cos, &Sin);
+
+		glm_f32vec8 const Xp = _mm256_add_ps(_mm256_mul_ps(Cos, n[p * 4]), _mm256_mul_ps(Sin, Npk));
+		glm_f32vec8 const Yp = _mm256_add_ps(_mm256_mul_ps(Cos, Npk), _mm256_mul_ps(Sin, n[k * 4]));
+		glm_f32vec8 const Xk = _mm256_sub_ps(_mm256_mul_ps(Cos, Npk), _mm256_mul_ps(Sin, n[p * 4]));
+		glm_f32vec8 const Yk = _mm256_sub_ps(_mm256_mul_ps(Cos, n[k * 4]), _mm256_mul_ps(Sin, Npk));
+		glm_f32vec8 const Rp = _mm256_add_ps(_mm256_mul_ps(Cos, n[r * 3 + p]), _mm256_mul_ps(Sin, n[r * 3 + k]));
+		glm_f32vec8 const Rk = _mm256_sub_ps(_mm256_mul_ps(Cos, n[r * 3 + k]), _mm256_mul_ps(Sin, n[r * 3 + p]));
+		n[p * 4] = _mm256_add_ps(_mm256_mul_ps(Cos, Xp), _mm256_mul_ps(Sin, Yp));
+		n[k * 4] = _mm256_sub_ps(_mm256_mul_ps(Cos, Yk), _mm256_mul_ps(Sin, Xk));
+		n[p * 3 + k] = n[k * 3 + p] = _mm256_add_ps(_mm256_mul_ps(Cos, Xk), _mm256_mul_ps(Sin, Yk));
+		n[r * 3 + p] = n[p * 3 + r] = Rp;
+		n[r * 3 + k] = n[k * 3 + r] = Rk;
+
+		glm_f32vec8 const Qp = _mm256_add_ps(_mm256_mul_ps(ch, q[p]), _mm256_mul_ps(sh, q[k]));
+		glm_f32vec8 const Qk = _mm256_sub_ps(_mm256_mul_ps(ch, q[k]), _mm256_mul_ps(sh, q[p]));
+		glm_f32vec8 const Qr = _mm256_add_ps(_mm256_mul_ps(ch, q[r]), _mm256_mul_ps(sh, q[3]));
+		glm_f32vec8 const Qw = _mm256_sub_ps(_mm256_mul_ps(ch, q[3]), _mm256_mul_ps(sh, q[r]));
+		q[p] = Qp;
+		q[k] = Qk;
+		q[r] = Qr;
+		q[3] = Qw;
+	}
+
+	glm_f32vec8 const Length2 = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(q[0], q[0]), _mm256_mul_ps(q[1], q[1])), _mm256_mul_ps(q[2], q[2])), _mm256_mul_ps(q[3], q[3]));
+	glm_f32vec8 const InvLength = _mm256_div_ps(One, _mm256_sqrt_ps(Length2));
+	for(int i = 0; i < 4; ++i)
+		q[i] = _mm256_mul_ps(q[i], InvLength);
+	glm_quat_soa8_mat3(q, v);
+
+	glm_f32vec8 b[9];
+	for(int c = 0; c < 3; ++c)
+	for(int r = 0; r < 3; ++r)
+		b[c * 3 + r] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[0 * 3 + r], v[c * 3 + 0]), _mm256_mul_ps(a[1 * 3 + r], v[c * 3 + 1])), _mm256_mul_ps(a[2 * 3 + r], v[c * 3 + 2]));
+
+	glm_f32vec8 ColumnLength2[3];
+	for(int c = 0; c < 3; ++c)
+		ColumnLength2[c] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(b[c * 3 + 0], b[c * 3 + 0]), _mm256_mul_ps(b[c * 3 + 1], b[c * 3 + 1])), _mm256_mul_ps(b[c * 3 + 2], b[c * 3 + 2]));
+	for(int i = 0; i < 2; ++i)
+	for(int j = i + 1; j < 3; ++j)
+	{
+		glm_f32vec8 const Swap = _mm256_cmp_ps(ColumnLength2[i], ColumnLength2[j], _CMP_LT_OQ);
+		for(int r = 0; r < 3; ++r)
+		{
+			glm_f32vec8 const B = b[i * 3 + r];
+			b[i * 3 + r] = _mm256_blendv_ps(B, b[j * 3 + r], Swap);
+			b[j * 3 + r] = _mm256_blendv_ps(b[j * 3 + r], _mm256_xor_ps(B, SignMask), Swap);
+			glm_f32vec8 const V = v[i * 3 + r];
+			v[i * 3 + r] = _mm256_blendv_ps(V, v[j * 3 + r], Swap);
+			v[j * 3 + r] = _mm256_blendv_ps(v[j * 3 + r], _mm256_xor_ps(V, SignMask), Swap);
+		}
+		glm_f32vec8 const L = ColumnLength2[i];
+		ColumnLength2[i] = _mm256_blendv_ps(L, ColumnLength2[j], Swap);
+		ColumnLength2[j] = _mm256_blendv_ps(ColumnLength2[j], L, Swap);
+	}
+
+	for(int i = 0; i < 9; ++i)
+		u[i] = i % 4 == 0 ? One : Zero;
+	for(int p = 0; p < 2; ++p)
+	for(int k = p + 1; k < 3; ++k)
+	{
+		glm_f32vec8 Cos, Sin;
+		glm_svd_qr_soa8(b[p * 4], b[p * 3 + k], &Cos, &Sin);
+		for(int i = 0; i < 3; ++i)
+		{
+			glm_f32vec8 const Bp = b[i * 3 + p];
+			glm_f32vec8 const Bk = b[i * 3 + k];
+			b[i * 3 + p] = _mm256_add_ps(_mm256_mul_ps(Cos, Bp), _mm256_mul_ps(Sin, Bk));
+			b[i * 3 + k] = _mm256_sub_ps(_mm256_mul_ps(Cos, Bk), _mm256_mul_ps(Sin, Bp));
+			glm_f32vec8 const Up = u[p * 3 + i];
+			glm_f32vec8 const Uk = u[k * 3 + i];
+			u[p * 3 + i] = _mm256_add_ps(_mm256_mul_ps(Cos, Up), _mm256_mul_ps(Sin, Uk));
+			u[k * 3 + i] = _mm256_sub_ps(_mm256_mul_ps(Cos, Uk), _mm256_mul_ps(Sin, Up));
+		}
+	}
+
+	for(int i = 0; i < 3; ++i)
+		s[i] = _mm256_mul_ps(b[i * 4], Largest);
+}
+
+// 8 lanes variant of glm_polar3x3_soa4
+GLM_FUNC_QUALIFIER void glm_polar3x3_soa8(glm_f32vec8 const u[9], glm_f32vec8 const s[3], glm_f32vec8 const v[9], glm_f32vec8 r[9], glm_f32vec8 p[9])
+{
+	for(int c = 0; c < 3; ++c)
+	for(int i = 0; i < 3; ++i)
+	{
+		r[c * 3 + i] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(u[0 * 3 + i], v[0 * 3 + c]), _mm256_mul_ps(u[1 * 3 + i], v[1 * 3 + c])), _mm256_mul_ps(u[2 * 3 + i], v[2 * 3 + c]));
+		p[c * 3 + i] = _mm256_add_ps(_mm256_add_ps(
+			_mm256_mul_ps(_mm256_mul_ps(v[0 * 3 + i], s[0]), v[0 * 3 + c]),
+			_mm256_mul_ps(_mm256_mul_ps(v[1 * 3 + i], s[1]), v[1 * 3 + c])),
+			_mm256_mul_ps(_mm256_mul_ps(v[2 * 3 + i], s[2]), v[2 * 3 + c]));
+	}
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
@@ -0,0 +1,1017 @@
+/// @ref simd
+/// @file glm/simd/noise.h
+
+#pragma once
+
+#include "common.h"
+
+// Kernels of GLM_EXT_noise_batch. Each lane evaluates the noise of one point, the components of the
+// points being passed in separate registers. The operations are those of the gtc_noise functions in the
+// same order, and the constants are converted from double like the T(...) casts of gtc_noise.
+// Floors of values of 2^23 or more are only exact with SSE4.1.
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_floor(glm_f32vec4 x)
+{
+	return glm_vec4_floor(x);
+}
+
+// step(edge, x): x < edge ? 0 : 1
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_step(glm_f32vec4 edge, glm_f32vec4 x)
+{
+	return _mm_and_ps(_mm_cmpnlt_ps(x, edge), _mm_set1_ps(1.0f));
+}
+
+// x > y ? 1 : 0
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_greater(glm_f32vec4 x, glm_f32vec4 y)
+{
+	return _mm_and_ps(_mm_cmpgt_ps(x, y), _mm_set1_ps(1.0f));
+}
+
+// x < 0 ? 1 : 0
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_negative(glm_f32vec4 x)
+{
+	return _mm_and_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_fract(glm_f32vec4 x)
+{
+	return _mm_sub_ps(x, glm_noise_soa4_floor(x));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_abs(glm_f32vec4 x)
+{
+	return _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+}
+
+// mod(x, 289) of the common functions, with a division
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_mod(glm_f32vec4 x)
+{
+	glm_f32vec4 const y = _mm_set1_ps(289.0f);
+	return _mm_sub_ps(x, _mm_mul_ps(y, glm_noise_soa4_floor(_mm_div_ps(x, y))));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_mod289(glm_f32vec4 x)
+{
+	glm_f32vec4 const Floor = glm_noise_soa4_floor(_mm_mul_ps(x, _mm_set1_ps(1.0f / 289.0f)));
+	return _mm_sub_ps(x, _mm_mul_ps(Floor, _mm_set1_ps(289.0f)));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_permute(glm_f32vec4 x)
+{
+	return glm_noise_soa4_mod289(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(34.0f)), _mm_set1_ps(1.0f)), x));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_taylor_inv_sqrt(glm_f32vec4 r)
+{
+	return _mm_sub_ps(_mm_set1_ps(static_cast<float>(1.79284291400159)), _mm_mul_ps(_mm_set1_ps(static_cast<float>(0.85373472095314)), r));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_fade(glm_f32vec4 t)
+{
+	glm_f32vec4 const t3 = _mm_mul_ps(_mm_mul_ps(t, t), t);
+	glm_f32vec4 const Poly = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f));
+	return _mm_mul_ps(t3, Poly);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_mix(glm_f32vec4 x, glm_f32vec4 y, glm_f32vec4 a)
+{
+	return _mm_add_ps(_mm_mul_ps(x, _mm_sub_ps(_mm_set1_ps(1.0f), a)), _mm_mul_ps(y, a));
+}
+
+// Dot products of 2, 3 and 4 components, summed in the order of compute_dot
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_dot2(glm_f32vec4 ax, glm_f32vec4 ay, glm_f32vec4 bx, glm_f32vec4 by)
+{
+	return _mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_dot3(glm_f32vec4 const a[3], glm_f32vec4 const b[3])
+{
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])), _mm_mul_ps(a[2], b[2]));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_dot4(glm_f32vec4 const a[4], glm_f32vec4 const b[4])
+{
+	glm_f32vec4 const xy = _mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1]));
+	glm_f32vec4 const zw = _mm_add_ps(_mm_mul_ps(a[2], b[2]), _mm_mul_ps(a[3], b[3]));
+	return _mm_add_ps(xy, zw);
+}
+
+// perlin(vec2(p[0], p[1]))
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_perlin2(glm_f32vec4 const p[2])
+{
+	glm_f32vec4 const One = _mm_set1_ps(1.0f);
+	glm_f32vec4 const Half = _mm_set1_ps(0.5f);
+
+	glm_f32vec4 const FloorX = glm_noise_soa4_floor(p[0]);
+	glm_f32vec4 const FloorY = glm_noise_soa4_floor(p[1]);
+	glm_f32vec4 const X0 = glm_noise_soa4_mod(FloorX);
+	glm_f32vec4 const X1 = glm_noise_soa4_mod(_mm_add_ps(FloorX, One));
+	glm_f32vec4 const Y0 = glm_noise_soa4_mod(FloorY);
+	glm_f32vec4 const Y1 = glm_noise_soa4_mod(_mm_add_ps(FloorY, One));
+	glm_f32vec4 const Fx0 = glm_noise_soa4_fract(p[0]);
+	glm_f32vec4 const Fy0 = glm_noise_soa4_fract(p[1]);
+	glm_f32vec4 const Fx1 = _mm_sub_ps(Fx0, One);
+	glm_f32vec4 const Fy1 = _mm_sub_ps(Fy0, One);
+
+	// Corners 00, 10, 01 and 11
+	glm_f32vec4 const PermX0 = glm_noise_soa4_permute(X0);
+	glm_f32vec4 const PermX1 = glm_noise_soa4_permute(X1);
+	glm_f32vec4 const Hash[4] = {
+		glm_noise_soa4_permute(_mm_add_ps(PermX0, Y0)),
+		glm_noise_soa4_permute(_mm_add_ps(PermX1, Y0)),
+		glm_noise_soa4_permute(_mm_add_ps(PermX0, Y1)),
+		glm_noise_soa4_permute(_mm_add_ps(PermX1, Y1))};
+	glm_f32vec4 const Fx[4] = {Fx0, Fx1, Fx0, Fx1};
+	glm_f32vec4 const Fy[4] = {Fy0, Fy0, Fy1, Fy1};
+
+	glm_f32vec4 N[4];
+	for(int c = 0; c < 4; ++c)
+	{
+		glm_f32vec4 Gx = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.0f), glm_noise_soa4_fract(_mm_div_ps(Hash[c], _mm_set1_ps(41.0f)))), One);
+		glm_f32vec4 const Gy = _mm_sub_ps(glm_noise_soa4_abs(Gx), Half);
+		Gx = _mm_sub_ps(Gx, glm_noise_soa4_floor(_mm_add_ps(Gx, Half)));
+
+		glm_f32vec4 const Norm = glm_noise_soa4_taylor_inv_sqrt(glm_noise_soa4_dot2(Gx, Gy, Gx, Gy));
+		N[c] = glm_noise_soa4_dot2(_mm_mul_ps(Gx, Norm), _mm_mul_ps(Gy, Norm), Fx[c], Fy[c]);
+	}
+
+	glm_f32vec4 const FadeX = glm_noise_soa4_fade(Fx0);
+	glm_f32vec4 const FadeY = glm_noise_soa4_fade(Fy0);
+	glm_f32vec4 const Nx0 = glm_noise_soa4_mix(N[0], N[1], FadeX);
+	glm_f32vec4 const Nx1 = glm_noise_soa4_mix(N[2], N[3], FadeX);
+	return _mm_mul_ps(_mm_set1_ps(static_cast<float>(2.3)), glm_noise_soa4_mix(Nx0, Nx1, FadeY));
+}
+
+// perlin(vec3(p[0], p[1], p[2]))
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_perlin3(glm_f32vec4 const p[3])
+{
+	glm_f32vec4 const One = _mm_set1_ps(1.0f);
+	glm_f32vec4 const Half = _mm_set1_ps(0.5f);
+	glm_f32vec4 const Zero = _mm_setzero_ps();
+
+	glm_f32vec4 Pi[2][3];
+	glm_f32vec4 Pf[2][3];
+	for(int c = 0; c < 3; ++c)
+	{
+		glm_f32vec4 const Floor = glm_noise_soa4_floor(p[c]);
+		Pi[0][c] = glm_noise_soa4_mod289(Floor);
+		Pi[1][c] = glm_noise_soa4_mod289(_mm_add_ps(Floor, One));
+		Pf[0][c] = glm_noise_soa4_fract(p[c]);
+		Pf[1][c] = _mm_sub_ps(Pf[0][c], One);
+	}
+
+	// Corner k has the x offset k & 1, the y offset k >> 1 & 1 and the z offset k >> 2
+	glm_f32vec4 const PermX[2] = {glm_noise_soa4_permute(Pi[0][0]), glm_noise_soa4_permute(Pi[1][0])};
+	glm_f32vec4 N[8];
+	for(int k = 0; k < 8; ++k)
+	{
+		int const x = k & 1;
+		int const y = (k >> 1) & 1;
+		int const z = k >> 2;
+
+		glm_f32vec4 const Hashxy = glm_noise_soa4_permute(_mm_add_ps(PermX[x], Pi[y][1]));
+		glm_f32vec4 const Hash = glm_noise_soa4_permute(_mm_add_ps(Hashxy, Pi[z][2]));
+
+		glm_f32vec4 G[3];
+		G[0] = _mm_mul_ps(Hash, _mm_set1_ps(static_cast<float>(1.0 / 7.0)));
+		G[1] = _mm_sub_ps(glm_noise_soa4_fract(_mm_mul_ps(glm_noise_soa4_floor(G[0]), _mm_set1_ps(static_cast<float>(1.0 / 7.0)))), Half);
+		G[0] = glm_noise_soa4_fract(G[0]);
+		G[2] = _mm_sub_ps(_mm_sub_ps(Half, glm_noise_soa4_abs(G[0])), glm_noise_soa4_abs(G[1]));
+		glm_f32vec4 const Sz = glm_noise_soa4_step(G[2], Zero);
+		G[0] = _mm_sub_ps(G[0], _mm_mul_ps(Sz, _mm_sub_ps(glm_noise_soa4_step(Zero, G[0]), Half)));
+		G[1] = _mm_sub_ps(G[1], _mm_mul_ps(Sz, _mm_sub_ps(glm_noise_soa4_step(Zero, G[1]), Half)));
+
+		glm_f32vec4 const Norm = glm_noise_soa4_taylor_inv_sqrt(glm_noise_soa4_dot3(G, G));
+		for(int c = 0; c < 3; ++c)
+			G[c] = _mm_mul_ps(G[c], Norm);
+
+		glm_f32vec4 const F[3] = {Pf[x][0], Pf[y][1], Pf[z][2]};
+		N[k] = glm_noise_soa4_dot3(G, F);
+	}
+
+	glm_f32vec4 const FadeX = glm_noise_soa4_fade(Pf[0][0]);
+	glm_f32vec4 const FadeY = glm_noise_soa4_fade(Pf[0][1]);
+	glm_f32vec4 const FadeZ = glm_noise_soa4_fade(Pf[0][2]);
+	glm_f32vec4 Nz[4];
+	for(int k = 0; k < 4; ++k)
+		Nz[k] = glm_noise_soa4_mix(N[k], N[k + 4], FadeZ);
+	glm_f32vec4 const Nyz0 = glm_noise_soa4_mix(Nz[0], Nz[2], FadeY);
+	glm_f32vec4 const Nyz1 = glm_noise_soa4_mix(Nz[1], Nz[3], FadeY);
+	return _mm_mul_ps(_mm_set1_ps(static_cast<float>(2.2)), glm_noise_soa4_mix(Nyz0, Nyz1, FadeX));
+}
+
+// perlin(vec4(p[0], p[1], p[2], p[3]))
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_perlin4(glm_f32vec4 const p[4])
+{
+	glm_f32vec4 const One = _mm_set1_ps(1.0f);
+	glm_f32vec4 const Half = _mm_set1_ps(0.5f);
+	glm_f32vec4 const Zero = _mm_setzero_ps();
+
+	glm_f32vec4 Pi[2][4];
+	glm_f32vec4 Pf[2][4];
+	for(int c = 0; c < 4; ++c)
+	{
+		glm_f32vec4 const Floor = glm_noise_soa4_floor(p[c]);
+		Pi[0][c] = glm_noise_soa4_mod(Floor);
+		Pi[1][c] = glm_noise_soa4_mod(_mm_add_ps(Floor, One));
+		Pf[0][c] = glm_noise_soa4_fract(p[c]);
+		Pf[1][c] = _mm_sub_ps(Pf[0][c], One);
+	}
+
+	// Corner k has the x offset k & 1, the y offset k >> 1 & 1, the z offset k >> 2 & 1 and the w offset k >> 3
+	glm_f32vec4 const PermX[2] = {glm_noise_soa4_permute(Pi[0][0]), glm_noise_soa4_permute(Pi[1][0])};
+	glm_f32vec4 N[16];
+	for(int k = 0; k < 16; ++k)
+	{
+		int const x = k & 1;
+		int const y = (k >> 1) & 1;
+		int const z = (k >> 2) & 1;
+		int const w = k >> 3;
+
+		glm_f32vec4 const Hashxy = glm_noise_soa4_permute(_mm_add_ps(PermX[x], Pi[y][1]));
+		glm_f32vec4 const Hashxyz = glm_noise_soa4_permute(_mm_add_ps(Hashxy, Pi[z][2]));
+		glm_f32vec4 const Hash = glm_noise_soa4_permute(_mm_add_ps(Hashxyz, Pi[w][3]));
+
+		glm_f32vec4 G[4];
+		G[0] = _mm_div_ps(Hash, _mm_set1_ps(7.0f));
+		G[1] = _mm_div_ps(glm_noise_soa4_floor(G[0]), _mm_set1_ps(7.0f));
+		G[2] = _mm_div_ps(glm_noise_soa4_floor(G[1]), _mm_set1_ps(6.0f));
+		G[0] = _mm_sub_ps(glm_noise_soa4_fract(G[0]), Half);
+		G[1] = _mm_sub_ps(glm_noise_soa4_fract(G[1]), Half);
+		G[2] = _mm_sub_ps(glm_noise_soa4_fract(G[2]), Half);
+		G[3] = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.75f), glm_noise_soa4_abs(G[0])), glm_noise_soa4_abs(G[1])), glm_noise_soa4_abs(G[2]));
+		glm_f32vec4 const Sw = glm_noise_soa4_step(G[3], Zero);
+		G[0] = _mm_sub_ps(G[0], _mm_mul_ps(Sw, _mm_sub_ps(glm_noise_soa4_step(Zero, G[0]), Half)));
+		G[1] = _mm_sub_ps(G[1], _mm_mul_ps(Sw, _mm_sub_ps(glm_noise_soa4_step(Zero, G[1]), Half)));
+
+		glm_f32vec4 const Norm = glm_noise_soa4_taylor_inv_sqrt(glm_noise_soa4_dot4(G, G));
+		for(int c = 0; c < 4; ++c)
+			G[c] = _mm_mul_ps(G[c], Norm);
+
+		glm_f32vec4 const F[4] = {Pf[x][0], Pf[y][1], Pf[z][2], Pf[w][3]};
+		N[k] = glm_noise_soa4_dot4(G, F);
+	}
+
+	glm_f32vec4 const FadeX = glm_noise_soa4_fade(Pf[0][0]);
+	glm_f32vec4 const FadeY = glm_noise_soa4_fade(Pf[0][1]);
+	glm_f32vec4 const FadeZ = glm_noise_soa4_fade(Pf[0][2]);
+	glm_f32vec4 const FadeW = glm_noise_soa4_fade(Pf[0][3]);
+	glm_f32vec4 Nzw[4];
+	for(int k = 0; k < 4; ++k)
+	{
+		glm_f32vec4 const N0w = glm_noise_soa4_mix(N[k], N[k + 8], FadeW);
+		glm_f32vec4 const N1w = glm_noise_soa4_mix(N[k + 4], N[k + 12], FadeW);
+		Nzw[k] = glm_noise_soa4_mix(N0w, N1w, FadeZ);
+	}
+	glm_f32vec4 const Nyzw0 = glm_noise_soa4_mix(Nzw[0], Nzw[2], FadeY);
+	glm_f32vec4 const Nyzw1 = glm_noise_soa4_mix(Nzw[1], Nzw[3], FadeY);
+	return _mm_mul_ps(_mm_set1_ps(static_cast<float>(2.2)), glm_noise_soa4_mix(Nyzw0, Nyzw1, FadeX));
+}
+
+// simplex(vec2(p[0], p[1]))
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_simplex2(glm_f32vec4 const p[2])
+{
+	glm_f32vec4 const One = _mm_set1_ps(1.0f);
+	glm_f32vec4 const Half = _mm_set1_ps(0.5f);
+	glm_f32vec4 const C0 = _mm_set1_ps(static_cast<float>(0.211324865405187));
+	glm_f32vec4 const C1 = _mm_set1_ps(static_cast<float>(0.366025403784439));
+	glm_f32vec4 const C2 = _mm_set1_ps(static_cast<float>(-0.577350269189626));
+	glm_f32vec4 const C3 = _mm_set1_ps(static_cast<float>(0.024390243902439));
+
+	// First corner
+	glm_f32vec4 const Skew = glm_noise_soa4_dot2(p[0], p[1], C1, C1);
+	glm_f32vec4 Ix = glm_noise_soa4_floor(_mm_add_ps(p[0], Skew));
+	glm_f32vec4 Iy = glm_noise_soa4_floor(_mm_add_ps(p[1], Skew));
+	glm_f32vec4 const Unskew = glm_noise_soa4_dot2(Ix, Iy, C0, C0);
+	glm_f32vec4 const X0[2] = {_mm_add_ps(_mm_sub_ps(p[0], Ix), Unskew), _mm_add_ps(_mm_sub_ps(p[1], Iy), Unskew)};
+
+	// Other corners
+	glm_f32vec4 const I1x = glm_noise_soa4_greater(X0[0], X0[1]);
+	glm_f32vec4 const I1y = _mm_sub_ps(One, I1x);
+	glm_f32vec4 const X1[2] = {_mm_sub_ps(_mm_add_ps(X0[0], C0), I1x), _mm_sub_ps(_mm_add_ps(X0[1], C0), I1y)};
+	glm_f32vec4 const X2[2] = {_mm_add_ps(X0[0], C2), _mm_add_ps(X0[1], C2)};
+
+	// Permutations
+	Ix = glm_noise_soa4_mod(Ix);
+	Iy = glm_noise_soa4_mod(Iy);
+	glm_f32vec4 const Ox[3] = {_mm_setzero_ps(), I1x, One};
+	glm_f32vec4 const Oy[3] = {_mm_setzero_ps(), I1y, One};
+	glm_f32vec4 const* const X[3] = {X0, X1, X2};
+
+	glm_f32vec4 Result = _mm_setzero_ps();
+	for(int k = 0; k < 3; ++k)
+	{
+		glm_f32vec4 const Permy = glm_noise_soa4_permute(_mm_add_ps(Iy, Oy[k]));
+		glm_f32vec4 const Hash = glm_noise_soa4_permute(_mm_add_ps(_mm_add_ps(Permy, Ix), Ox[k]));
+
+		glm_f32vec4 M = _mm_max_ps(_mm_sub_ps(Half, glm_noise_soa4_dot2(X[k][0], X[k][1], X[k][0], X[k][1])), _mm_setzero_ps());
+		M = _mm_mul_ps(M, M);
+		M = _mm_mul_ps(M, M);
+
+		// Gradients: 41 points uniformly over a line, mapped onto a diamond
+		glm_f32vec4 const Gx = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(2.0f), glm_noise_soa4_fract(_mm_mul_ps(Hash, C3))), One);
+		glm_f32vec4 const H = _mm_sub_ps(glm_noise_soa4_abs(Gx), Half);
+		glm_f32vec4 const A0 = _mm_sub_ps(Gx, glm_noise_soa4_floor(_mm_add_ps(Gx, Half)));
+		M = _mm_mul_ps(M, glm_noise_soa4_taylor_inv_sqrt(_mm_add_ps(_mm_mul_ps(A0, A0), _mm_mul_ps(H, H))));
+
+		glm_f32vec4 const G = glm_noise_soa4_dot2(A0, H, X[k][0], X[k][1]);
+		Result = k == 0 ? _mm_mul_ps(M, G) : _mm_add_ps(Result, _mm_mul_ps(M, G));
+	}
+
+	return _mm_mul_ps(_mm_set1_ps(130.0f), Result);
+}
+
+// simplex(vec3(p[0], p[1], p[2]))
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_simplex3(glm_f32vec4 const p[3])
+{
+	glm_f32vec4 const One = _mm_set1_ps(1.0f);
+	glm_f32vec4 const Cx = _mm_set1_ps(static_cast<float>(1.0 / 6.0));
+	glm_f32vec4 const Cy = _mm_set1_ps(static_cast<float>(1.0 / 3.0));
+	glm_f32vec4 const Cyyy[3] = {Cy, Cy, Cy};
+	glm_f32vec4 const Cxxx[3] = {Cx, Cx, Cx};
+
+	// First corner
+	glm_f32vec4 const Skew = glm_noise_soa4_dot3(p, Cyyy);
+	glm_f32vec4 I[3];
+	for(int c = 0; c < 3; ++c)
+		I[c] = glm_noise_soa4_floor(_mm_add_ps(p[c], Skew));
+	glm_f32vec4 const Unskew = glm_noise_soa4_dot3(I, Cxxx);
+	glm_f32vec4 X[4][3];
+	for(int c = 0; c < 3; ++c)
+		X[0][c] = _mm_add_ps(_mm_sub_ps(p[c], I[c]), Unskew);
+
+	// Other corners
+	glm_f32vec4 const G[3] = {
+		glm_noise_soa4_step(X[0][1], X[0][0]),
+		glm_noise_soa4_step(X[0][2], X[0][1]),
+		glm_noise_soa4_step(X[0][0], X[0][2])};
+	glm_f32vec4 const L[3] = {_mm_sub_ps(One, G[2]), _mm_sub_ps(One, G[0]), _mm_sub_ps(One, G[1])};
+	glm_f32vec4 O[4][3];
+	for(int c = 0; c < 3; ++c)
+	{
+		O[0][c] = _mm_setzero_ps();
+		O[1][c] = _mm_min_ps(G[c], L[c]);
+		O[2][c] = _mm_max_ps(G[c], L[c]);
+		O[3][c] = One;
+		X[1][c] = _mm_add_ps(_mm_sub_ps(X[0][c], O[1][c]), Cx);
+		X[2][c] = _mm_add_ps(_mm_sub_ps(X[0][c], O[2][c]), Cy);
+		X[3][c] = _mm_sub_ps(X[0][c], _mm_set1_ps(0.5f));
+	}
+
+	// Permutations
+	for(int c = 0; c < 3; ++c)
+		I[c] = glm_noise_soa4_mod289(I[c]);
+
+	// Gradients: 7x7 points over a square, mapped onto an octahedron
+	float const n_ = static_cast<float>(0.142857142857);
+	glm_f32vec4 const NsX = _mm_set1_ps(n_ * 2.0f);
+	glm_f32vec4 const NsY = _mm_set1_ps(n_ * 0.5f - 1.0f);
+	glm_f32vec4 const NsZ = _mm_set1_ps(n_ * 1.0f);
+
+	glm_f32vec4 D[4];
+	glm_f32vec4 M[4];
+	for(int k = 0; k < 4; ++k)
+	{
+		glm_f32vec4 const Permz = glm_noise_soa4_permute(_mm_add_ps(I[2], O[k][2]));
+		glm_f32vec4 const Permy = glm_noise_soa4_permute(_mm_add_ps(_mm_add_ps(Permz, I[1]), O[k][1]));
+		glm_f32vec4 const Hash = glm_noise_soa4_permute(_mm_add_ps(_mm_add_ps(Permy, I[0]), O[k][0]));
+
+		glm_f32vec4 const J = _mm_sub_ps(Hash, _mm_mul_ps(_mm_set1_ps(49.0f), glm_noise_soa4_floor(_mm_mul_ps(_mm_mul_ps(Hash, NsZ), NsZ))));
+		glm_f32vec4 const Fx = glm_noise_soa4_floor(_mm_mul_ps(J, NsZ));
+		glm_f32vec4 const Fy = glm_noise_soa4_floor(_mm_sub_ps(J, _mm_mul_ps(_mm_set1_ps(7.0f), Fx)));
+		glm_f32vec4 const Gx = _mm_add_ps(_mm_mul_ps(Fx, NsX), NsY);
+		glm_f32vec4 const Gy = _mm_add_ps(_mm_mul_ps(Fy, NsX), NsY);
+		glm_f32vec4 const H = _mm_sub_ps(_mm_sub_ps(One, glm_noise_soa4_abs(Gx)), glm_noise_soa4_abs(Gy));
+
+		// -step(h, 0.0), a negative zero when h > 0
+		glm_f32vec4 const Sh = _mm_xor_ps(glm_noise_soa4_step(H, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+		glm_f32vec4 const Sx = _mm_add_ps(_mm_mul_ps(glm_noise_soa4_floor(Gx), _mm_set1_ps(2.0f)), One);
+		glm_f32vec4 const Sy = _mm_add_ps(_mm_mul_ps(glm_noise_soa4_floor(Gy), _mm_set1_ps(2.0f)), One);
+
+		glm_f32vec4 P[3] = {_mm_add_ps(Gx, _mm_mul_ps(Sx, Sh)), _mm_add_ps(Gy, _mm_mul_ps(Sy, Sh)), H};
+		glm_f32vec4 const Norm = glm_noise_soa4_taylor_inv_sqrt(glm_noise_soa4_dot3(P, P));
+		for(int c = 0; c < 3; ++c)
+			P[c] = _mm_mul_ps(P[c], Norm);
+
+		D[k] = glm_noise_soa4_dot3(P, X[k]);
+		M[k] = _mm_max_ps(_mm_sub_ps(_mm_set1_ps(static_cast<float>(0.6)), glm_noise_soa4_dot3(X[k], X[k])), _mm_setzero_ps());
+		M[k] = _mm_mul_ps(M[k], M[k]);
+		M[k] = _mm_mul_ps(M[k], M[k]);
+	}
+
+	return _mm_mul_ps(_mm_set1_ps(42.0f), glm_noise_soa4_dot4(M, D));
+}
+
+// grad4(j, ip) of gtc_noise, ip being (1/294, 1/49, 1/7, 0)
+GLM_FUNC_QUALIFIER void glm_noise_soa4_grad4(glm_f32vec4 j, glm_f32vec4 out[4])
+{
+	glm_f32vec4 const Ip[3] = {_mm_set1_ps(1.0f / 294.0f), _mm_set1_ps(1.0f / 49.0f), _mm_set1_ps(1.0f / 7.0f)};
+	for(int c = 0; c < 3; ++c)
+		out[c] = _mm_sub_ps(_mm_mul_ps(glm_noise_soa4_floor(_mm_mul_ps(glm_noise_soa4_fract(_mm_mul_ps(j, Ip[c])), _mm_set1_ps(7.0f))), Ip[2]), _mm_set1_ps(1.0f));
+	glm_f32vec4 const Abs[3] = {glm_noise_soa4_abs(out[0]), glm_noise_soa4_abs(out[1]), glm_noise_soa4_abs(out[2])};
+	glm_f32vec4 const Ones[3] = {_mm_set1_ps(1.0f), _mm_set1_ps(1.0f), _mm_set1_ps(1.0f)};
+	out[3] = _mm_sub_ps(_mm_set1_ps(1.5f), glm_noise_soa4_dot3(Abs, Ones));
+	glm_f32vec4 const Sw = glm_noise_soa4_negative(out[3]);
+	for(int c = 0; c < 3; ++c)
+	{
+		glm_f32vec4 const S = glm_noise_soa4_negative(out[c]);
+		out[c] = _mm_add_ps(out[c], _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(S, _mm_set1_ps(2.0f)), _mm_set1_ps(1.0f)), Sw));
+	}
+}
+
+// simplex(vec4(p[0], p[1], p[2], p[3]))
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_noise_soa4_simplex4(glm_f32vec4 const p[4])
+{
+	glm_f32vec4 const Zero = _mm_setzero_ps();
+	glm_f32vec4 const One = _mm_set1_ps(1.0f);
+	float const C[4] = {
+		static_cast<float>(0.138196601125011),
+		static_cast<float>(0.276393202250021),
+		static_cast<float>(0.414589803375032),
+		static_cast<float>(-0.447213595499958)};
+	glm_f32vec4 const F4 = _mm_set1_ps(static_cast<float>(0.309016994374947451));
+	glm_f32vec4 const F4s[4] = {F4, F4, F4, F4};
+	glm_f32vec4 const Cx = _mm_set1_ps(C[0]);
+	glm_f32vec4 const Cxs[4] = {Cx, Cx, Cx, Cx};
+
+	// First corner
+	glm_f32vec4 const Skew = glm_noise_soa4_dot4(p, F4s);
+	glm_f32vec4 I[4];
+	for(int c = 0; c < 4; ++c)
+		I[c] = glm_noise_soa4_floor(_mm_add_ps(p[c], Skew));
+	glm_f32vec4 const Unskew = glm_noise_soa4_dot4(I, Cxs);
+	glm_f32vec4 X[5][4];
+	for(int c = 0; c < 4; ++c)
+		X[0][c] = _mm_add_ps(_mm_sub_ps(p[c], I[c]), Unskew);
+
+	// Other corners, rank sorting originally contributed by Bill Licea-Kane, AMD (formerly ATI)
+	glm_f32vec4 const IsX[3] = {
+		glm_noise_soa4_step(X[0][1], X[0][0]),
+		glm_noise_soa4_step(X[0][2], X[0][0]),
+		glm_noise_soa4_step(X[0][3], X[0][0])};
+	glm_f32vec4 const IsYZ[3] = {
+		glm_noise_soa4_step(X[0][2], X[0][1]),
+		glm_noise_soa4_step(X[0][3], X[0][1]),
+		glm_noise_soa4_step(X[0][3], X[0][2])};
+	glm_f32vec4 Rank[4];
+	Rank[0] = _mm_add_ps(_mm_add_ps(IsX[0], IsX[1]), IsX[2]);
+	Rank[1] = _mm_add_ps(_mm_sub_ps(One, IsX[0]), _mm_add_ps(IsYZ[0], IsYZ[1]));
+	Rank[2] = _mm_add_ps(_mm_add_ps(_mm_sub_ps(One, IsX[1]), _mm_sub_ps(One, IsYZ[0])), IsYZ[2]);
+	Rank[3] = _mm_add_ps(_mm_add_ps(_mm_sub_ps(One, IsX[2]), _mm_sub_ps(One, IsYZ[1])), _mm_sub_ps(One, IsYZ[2]));
+
+	// O[k] is the offset of the corner k, O[1] to O[3] being i1 to i3 of gtc_noise
+	glm_f32vec4 O[5][4];
+	for(int c = 0; c < 4; ++c)
+	{
+		O[0][c] = Zero;
+		O[3][c] = _mm_max_ps(_mm_min_ps(Rank[c], One), Zero);
+		O[2][c] = _mm_max_ps(_mm_min_ps(_mm_sub_ps(Rank[c], One), One), Zero);
+		O[1][c] = _mm_max_ps(_mm_min_ps(_mm_sub_ps(Rank[c], _mm_set1_ps(2.0f)), One), Zero);
+		O[4][c] = One;
+		for(int k = 1; k < 4; ++k)
+			X[k][c] = _mm_add_ps(_mm_sub_ps(X[0][c], O[k][c]), _mm_set1_ps(C[k - 1]));
+		X[4][c] = _mm_add_ps(X[0][c], _mm_set1_ps(C[3]));
+	}
+
+	// Permutations
+	for(int c = 0; c < 4; ++c)
+		I[c] = glm_noise_soa4_mod(I[c]);
+
+	glm_f32vec4 D[5];
+	glm_f32vec4 M[5];
+	for(int k = 0; k < 5; ++k)
+	{
+		glm_f32vec4 Hash;
+		if(k == 0)
+			Hash = glm_noise_soa4_permute(_mm_add_ps(glm_noise_soa4_permute(_mm_add_ps(glm_noise_soa4_permute(_mm_add_ps(glm_noise_soa4_permute(I[3]), I[2])), I[1])), I[0]));
+		else
+		{
+			Hash = glm_noise_soa4_permute(_mm_add_ps(I[3], O[k][3]));
+			for(int c = 2; c >= 0; --c)
+				Hash = glm_noise_soa4_permute(_mm_add_ps(_mm_add_ps(Hash, I[c]), O[k][c]));
+		}
+
+		// Gradients: 7x7x6 points over a cube, mapped onto a 4-cross polytope
+		glm_f32vec4 P[4];
+		glm_noise_soa4_grad4(Hash, P);
+		glm_f32vec4 const Norm = glm_noise_soa4_taylor_inv_sqrt(glm_noise_soa4_dot4(P, P));
+		for(int c = 0; c < 4; ++c)
+			P[c] = _mm_mul_ps(P[c], Norm);
+
+		D[k] = glm_noise_soa4_dot4(P, X[k]);
+		M[k] = _mm_max_ps(_mm_sub_ps(_mm_set1_ps(static_cast<float>(0.6)), glm_noise_soa4_dot4(X[k], X[k])), Zero);
+		M[k] = _mm_mul_ps(M[k], M[k]);
+		M[k] = _mm_mul_ps(M[k], M[k]);
+	}
+
+	glm_f32vec4 const Sum0 = glm_noise_soa4_dot3(M, D);
+	glm_f32vec4 const Sum1 = glm_noise_soa4_dot2(M[3], M[4], D[3], D[4]);
+	return _mm_mul_ps(_mm_set1_ps(49.0f), _mm_add_ps(Sum0, Sum1));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_floor(glm_f32vec8 x)
+{
+	return _mm256_floor_ps(x);
+}
+
+// step(edge, x): x < edge ? 0 : 1
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_step(glm_f32vec8 edge, glm_f32vec8 x)
+{
+	return _mm256_and_ps(_mm256_cmp_ps(x, edge, _CMP_NLT_UQ), _mm256_set1_ps(1.0f));
+}
+
+// x > y ? 1 : 0
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_greater(glm_f32vec8 x, glm_f32vec8 y)
+{
+	return _mm256_and_ps(_mm256_cmp_ps(x, y, _CMP_GT_OQ), _mm256_set1_ps(1.0f));
+}
+
+// x < 0 ? 1 : 0
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_negative(glm_f32vec8 x)
+{
+	return _mm256_and_ps(_mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(1.0f));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_fract(glm_f32vec8 x)
+{
+	return _mm256_sub_ps(x, glm_noise_soa8_floor(x));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_abs(glm_f32vec8 x)
+{
+	return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+}
+
+// mod(x, 289) of the common functions, with a division
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_mod(glm_f32vec8 x)
+{
+	glm_f32vec8 const y = _mm256_set1_ps(289.0f);
+	return _mm256_sub_ps(x, _mm256_mul_ps(y, glm_noise_soa8_floor(_mm256_div_ps(x, y))));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_mod289(glm_f32vec8 x)
+{
+	glm_f32vec8 const Floor = glm_noise_soa8_floor(_mm256_mul_ps(x, _mm256_set1_ps(1.0f / 289.0f)));
+	return _mm256_sub_ps(x, _mm256_mul_ps(Floor, _mm256_set1_ps(289.0f)));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_permute(glm_f32vec8 x)
+{
+	return glm_noise_soa8_mod289(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(34.0f)), _mm256_set1_ps(1.0f)), x));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_taylor_inv_sqrt(glm_f32vec8 r)
+{
+	return _mm256_sub_ps(_mm256_set1_ps(static_cast<float>(1.79284291400159)), _mm256_mul_ps(_mm256_set1_ps(static_cast<float>(0.85373472095314)), r));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_fade(glm_f32vec8 t)
+{
+	glm_f32vec8 const t3 = _mm256_mul_ps(_mm256_mul_ps(t, t), t);
+	glm_f32vec8 const Poly = _mm256_add_ps(_mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f))), _mm256_set1_ps(10.0f));
+	return _mm256_mul_ps(t3, Poly);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_mix(glm_f32vec8 x, glm_f32vec8 y, glm_f32vec8 a)
+{
+	return _mm256_add_ps(_mm256_mul_ps(x, _mm256_sub_ps(_mm256_set1_ps(1.0f), a)), _mm256_mul_ps(y, a));
+}
+
+// Dot products of 2, 3 and 4 components, summed in the order of compute_dot
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_dot2(glm_f32vec8 ax, glm_f32vec8 ay, glm_f32vec8 bx, glm_f32vec8 by)
+{
+	return _mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_dot3(glm_f32vec8 const a[3], glm_f32vec8 const b[3])
+{
+	return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[0], b[0]), _mm256_mul_ps(a[1], b[1])), _mm256_mul_ps(a[2], b[2]));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_dot4(glm_f32vec8 const a[4], glm_f32vec8 const b[4])
+{
+	glm_f32vec8 const xy = _mm256_add_ps(_mm256_mul_ps(a[0], b[0]), _mm256_mul_ps(a[1], b[1]));
+	glm_f32vec8 const zw = _mm256_add_ps(_mm256_mul_ps(a[2], b[2]), _mm256_mul_ps(a[3], b[3]));
+	return _mm256_add_ps(xy, zw);
+}
+
+// perlin(vec2(p[0], p[1]))
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_perlin2(glm_f32vec8 const p[2])
+{
+	glm_f32vec8 const One = _mm256_set1_ps(1.0f);
+	glm_f32vec8 const Half = _mm256_set1_ps(0.5f);
+
+	glm_f32vec8 const FloorX = glm_noise_soa8_floor(p[0]);
+	glm_f32vec8 const FloorY = glm_noise_soa8_floor(p[1]);
+	glm_f32vec8 const X0 = glm_noise_soa8_mod(FloorX);
+	glm_f32vec8 const X1 = glm_noise_soa8_mod(_mm256_add_ps(FloorX, One));
+	glm_f32vec8 const Y0 = glm_noise_soa8_mod(FloorY);
+	glm_f32vec8 const Y1 = glm_noise_soa8_mod(_mm256_add_ps(FloorY, One));
+	glm_f32vec8 const Fx0 = glm_noise_soa8_fract(p[0]);
+	glm_f32vec8 const Fy0 = glm_noise_soa8_fract(p[1]);
+	glm_f32vec8 const Fx1 = _mm256_sub_ps(Fx0, One);
+	glm_f32vec8 const Fy1 = _mm256_sub_ps(Fy0, One);
+
+	// Corners 00, 10, 01 and 11
+	glm_f32vec8 const PermX0 = glm_noise_soa8_permute(X0);
+	glm_f32vec8 const PermX1 = glm_noise_soa8_permute(X1);
+	glm_f32vec8 const Hash[4] = {
+		glm_noise_soa8_permute(_mm256_add_ps(PermX0, Y0)),
+		glm_noise_soa8_permute(_mm256_add_ps(PermX1, Y0)),
+		glm_noise_soa8_permute(_mm256_add_ps(PermX0, Y1)),
+		glm_noise_soa8_permute(_mm256_add_ps(PermX1, Y1))};
+	glm_f32vec8 const Fx[4] = {Fx0, Fx1, Fx0, Fx1};
+	glm_f32vec8 const Fy[4] = {Fy0, Fy0, Fy1, Fy1};
+
+	glm_f32vec8 N[4];
+	for(int c = 0; c < 4; ++c)
+	{
+		glm_f32vec8 Gx = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), glm_noise_soa8_fract(_mm256_div_ps(Hash[c], _mm256_set1_ps(41.0f)))), One);
+		glm_f32vec8 const Gy = _mm256_sub_ps(glm_noise_soa8_abs(Gx), Half);
+		Gx = _mm256_sub_ps(Gx, glm_noise_soa8_floor(_mm256_add_ps(Gx, Half)));
+
+		glm_f32vec8 const Norm = glm_noise_soa8_taylor_inv_sqrt(glm_noise_soa8_dot2(Gx, Gy, Gx, Gy));
+		N[c] = glm_noise_soa8_dot2(_mm256_mul_ps(Gx, Norm), _mm256_mul_ps(Gy, Norm), Fx[c], Fy[c]);
+	}
+
+	glm_f32vec8 const FadeX = glm_noise_soa8_fade(Fx0);
+	glm_f32vec8 const FadeY = glm_noise_soa8_fade(Fy0);
+	glm_f32vec8 const Nx0 = glm_noise_soa8_mix(N[0], N[1], FadeX);
+	glm_f32vec8 const Nx1 = glm_noise_soa8_mix(N[2], N[3], FadeX);
+	return _mm256_mul_ps(_mm256_set1_ps(static_cast<float>(2.3)), glm_noise_soa8_mix(Nx0, Nx1, FadeY));
+}
+
+// perlin(vec3(p[0], p[1], p[2]))
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_perlin3(glm_f32vec8 const p[3])
+{
+	glm_f32vec8 const One = _mm256_set1_ps(1.0f);
+	glm_f32vec8 const Half = _mm256_set1_ps(0.5f);
+	glm_f32vec8 const Zero = _mm256_setzero_ps();
+
+	glm_f32vec8 Pi[2][3];
+	glm_f32vec8 Pf[2][3];
+	for(int c = 0; c < 3; ++c)
+	{
+		glm_f32vec8 const Floor = glm_noise_soa8_floor(p[c]);
+		Pi[0][c] = glm_noise_soa8_mod289(Floor);
+		Pi[1][c] = glm_noise_soa8_mod289(_mm256_add_ps(Floor, One));
+		Pf[0][c] = glm_noise_soa8_fract(p[c]);
+		Pf[1][c] = _mm256_sub_ps(Pf[0][c], One);
+	}
+
+	// Corner k has the x offset k & 1, the y offset k >> 1 & 1 and the z offset k >> 2
+	glm_f32vec8 const PermX[2] = {glm_noise_soa8_permute(Pi[0][0]), glm_noise_soa8_permute(Pi[1][0])};
+	glm_f32vec8 N[8];
+	for(int k = 0; k < 8; ++k)
+	{
+		int const x = k & 1;
+		int const y = (k >> 1) & 1;
+		int const z = k >> 2;
+
+		glm_f32vec8 const Hashxy = glm_noise_soa8_permute(_mm256_add_ps(PermX[x], Pi[y][1]));
+		glm_f32vec8 const Hash = glm_noise_soa8_permute(_mm256_add_ps(Hashxy, Pi[z][2]));
+
+		glm_f32vec8 G[3];
+		G[0] = _mm256_mul_ps(Hash, _mm256_set1_ps(static_cast<float>(1.0 / 7.0)));
+		G[1] = _mm256_sub_ps(glm_noise_soa8_fract(_mm256_mul_ps(glm_noise_soa8_floor(G[0]), _mm256_set1_ps(static_cast<float>(1.0 / 7.0)))), Half);
+		G[0] = glm_noise_soa8_fract(G[0]);
+		G[2] = _mm256_sub_ps(_mm256_sub_ps(Half, glm_noise_soa8_abs(G[0])), glm_noise_soa8_abs(G[1]));
+		glm_f32vec8 const Sz = glm_noise_soa8_step(G[2], Zero);
+		G[0] = _mm256_sub_ps(G[0], _mm256_mul_ps(Sz, _mm256_sub_ps(glm_noise_soa8_step(Zero, G[0]), Half)));
+		G[1] = _mm256_sub_ps(G[1], _mm256_mul_ps(Sz, _mm256_sub_ps(glm_noise_soa8_step(Zero, G[1]), Half)));
+
+		glm_f32vec8 const Norm = glm_noise_soa8_taylor_inv_sqrt(glm_noise_soa8_dot3(G, G));
+		for(int c = 0; c < 3; ++c)
+			G[c] = _mm256_mul_ps(G[c], Norm);
+
+		glm_f32vec8 const F[3] = {Pf[x][0], Pf[y][1], Pf[z][2]};
+		N[k] = glm_noise_soa8_dot3(G, F);
+	}
+
+	glm_f32vec8 const FadeX = glm_noise_soa8_fade(Pf[0][0]);
+	glm_f32vec8 const FadeY = glm_noise_soa8_fade(Pf[0][1]);
+	glm_f32vec8 const FadeZ = glm_noise_soa8_fade(Pf[0][2]);
+	glm_f32vec8 Nz[4];
+	for(int k = 0; k < 4; ++k)
+		Nz[k] = glm_noise_soa8_mix(N[k], N[k + 4], FadeZ);
+	glm_f32vec8 const Nyz0 = glm_noise_soa8_mix(Nz[0], Nz[2], FadeY);
+	glm_f32vec8 const Nyz1 = glm_noise_soa8_mix(Nz[1], Nz[3], FadeY);
+	return _mm256_mul_ps(_mm256_set1_ps(static_cast<float>(2.2)), glm_noise_soa8_mix(Nyz0, Nyz1, FadeX));
+}
+
+// perlin(vec4(p[0], p[1], p[2], p[3]))
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_perlin4(glm_f32vec8 const p[4])
+{
+	glm_f32vec8 const One = _mm256_set1_ps(1.0f);
+	glm_f32vec8 const Half = _mm256_set1_ps(0.5f);
+	glm_f32vec8 const Zero = _mm256_setzero_ps();
+
+	glm_f32vec8 Pi[2][4];
+	glm_f32vec8 Pf[2][4];
+	for(int c = 0; c < 4; ++c)
+	{
+		glm_f32vec8 const Floor = glm_noise_soa8_floor(p[c]);
+		Pi[0][c] = glm_noise_soa8_mod(Floor);
+		Pi[1][c] = glm_noise_soa8_mod(_mm256_add_ps(Floor, One));
+		Pf[0][c] = glm_noise_soa8_fract(p[c]);
+		Pf[1][c] = _mm256_sub_ps(Pf[0][c], One);
+	}
+
+	// Corner k has the x offset k & 1, the y offset k >> 1 & 1, the z offset k >> 2 & 1 and the w offset k >> 3
+	glm_f32vec8 const PermX[2] = {glm_noise_soa8_permute(Pi[0][0]), glm_noise_soa8_permute(Pi[1][0])};
+	glm_f32vec8 N[16];
+	for(int k = 0; k < 16; ++k)
+	{
+		int const x = k & 1;
+		int const y = (k >> 1) & 1;
+		int const z = (k >> 2) & 1;
+		int const w = k >> 3;
+
+		glm_f32vec8 const Hashxy = glm_noise_soa8_permute(_mm256_add_ps(PermX[x], Pi[y][1]));
+		glm_f32vec8 const Hashxyz = glm_noise_soa8_permute(_mm256_add_ps(Hashxy, Pi[z][2]));
+		glm_f32vec8 const Hash = glm_noise_soa8_permute(_mm256_add_ps(Hashxyz, Pi[w][3]));
+
+		glm_f32vec8 G[4];
+		G[0] = _mm256_div_ps(Hash, _mm256_set1_ps(7.0f));
+		G[1] = _mm256_div_ps(glm_noise_soa8_floor(G[0]), _mm256_set1_ps(7.0f));
+		G[2] = _mm256_div_ps(glm_noise_soa8_floor(G[1]), _mm256_set1_ps(6.0f));
+		G[0] = _mm256_sub_ps(glm_noise_soa8_fract(G[0]), Half);
+		G[1] = _mm256_sub_ps(glm_noise_soa8_fract(G[1]), Half);
+		G[2] = _mm256_sub_ps(glm_noise_soa8_fract(G[2]), Half);
+		G[3] = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(0.75f), glm_noise_soa8_abs(G[0])), glm_noise_soa8_abs(G[1])), glm_noise_soa8_abs(G[2]));
+		glm_f32vec8 const Sw = glm_noise_soa8_step(G[3], Zero);
+		G[0] = _mm256_sub_ps(G[0], _mm256_mul_ps(Sw, _mm256_sub_ps(glm_noise_soa8_step(Zero, G[0]), Half)));
+		G[1] = _mm256_sub_ps(G[1], _mm256_mul_ps(Sw, _mm256_sub_ps(glm_noise_soa8_step(Zero, G[1]), Half)));
+
+		glm_f32vec8 const Norm = glm_noise_soa8_taylor_inv_sqrt(glm_noise_soa8_dot4(G, G));
+		for(int c = 0; c < 4; ++c)
+			G[c] = _mm256_mul_ps(G[c], Norm);
+
+		glm_f32vec8 const F[4] = {Pf[x][0], Pf[y][1], Pf[z][2], Pf[w][3]};
+		N[k] = glm_noise_soa8_dot4(G, F);
+	}
+
+	glm_f32vec8 const FadeX = glm_noise_soa8_fade(Pf[0][0]);
+	glm_f32vec8 const FadeY = glm_noise_soa8_fade(Pf[0][1]);
+	glm_f32vec8 const FadeZ = glm_noise_soa8_fade(Pf[0][2]);
+	glm_f32vec8 const FadeW = glm_noise_soa8_fade(Pf[0][3]);
+	glm_f32vec8 Nzw[4];
+	for(int k = 0; k < 4; ++k)
+	{
+		glm_f32vec8 const N0w = glm_noise_soa8_mix(N[k], N[k + 8], FadeW);
+		glm_f32vec8 const N1w = glm_noise_soa8_mix(N[k + 4], N[k + 12], FadeW);
+		Nzw[k] = glm_noise_soa8_mix(N0w, N1w, FadeZ);
+	}
+	glm_f32vec8 const Nyzw0 = glm_noise_soa8_mix(Nzw[0], Nzw[2], FadeY);
+	glm_f32vec8 const Nyzw1 = glm_noise_soa8_mix(Nzw[1], Nzw[3], FadeY);
+	return _mm256_mul_ps(_mm256_set1_ps(static_cast<float>(2.2)), glm_noise_soa8_mix(Nyzw0, Nyzw1, FadeX));
+}
+
+// simplex(vec2(p[0], p[1]))
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_simplex2(glm_f32vec8 const p[2])
+{
+	glm_f32vec8 const One = _mm256_set1_ps(1.0f);
+	glm_f32vec8 const Half = _mm256_set1_ps(0.5f);
+	glm_f32vec8 const C0 = _mm256_set1_ps(static_cast<float>(0.211324865405187));
+	glm_f32vec8 const C1 = _mm256_set1_ps(static_cast<float>(0.366025403784439));
+	glm_f32vec8 const C2 = _mm256_set1_ps(static_cast<float>(-0.577350269189626));
+	glm_f32vec8 const C3 = _mm256_set1_ps(static_cast<float>(0.024390243902439));
+
+	// First corner
+	glm_f32vec8 const Skew = glm_noise_soa8_dot2(p[0], p[1], C1, C1);
+	glm_f32vec8 Ix = glm_noise_soa8_floor(_mm256_add_ps(p[0], Skew));
+	glm_f32vec8 Iy = glm_noise_soa8_floor(_mm256_add_ps(p[1], Skew));
+	glm_f32vec8 const Unskew = glm_noise_soa8_dot2(Ix, Iy, C0, C0);
+	glm_f32vec8 const X0[2] = {_mm256_add_ps(_mm256_sub_ps(p[0], Ix), Unskew), _mm256_add_ps(_mm256_sub_ps(p[1], Iy), Unskew)};
+
+	// Other corners
+	glm_f32vec8 const I1x = glm_noise_soa8_greater(X0[0], X0[1]);
+	glm_f32vec8 const I1y = _mm256_sub_ps(One, I1x);
+	glm_f32vec8 const X1[2] = {_mm256_sub_ps(_mm256_add_ps(X0[0], C0), I1x), _mm256_sub_ps(_mm256_add_ps(X0[1], C0), I1y)};
+	glm_f32vec8 const X2[2] = {_mm256_add_ps(X0[0], C2), _mm256_add_ps(X0[1], C2)};
+
+	// Permutations
+	Ix = glm_noise_soa8_mod(Ix);
+	Iy = glm_noise_soa8_mod(Iy);
+	glm_f32vec8 const Ox[3] = {_mm256_setzero_ps(), I1x, One};
+	glm_f32vec8 const Oy[3] = {_mm256_setzero_ps(), I1y, One};
+	glm_f32vec8 const* const X[3] = {X0, X1, X2};
+
+	glm_f32vec8 Result = _mm256_setzero_ps();
+	for(int k = 0; k < 3; ++k)
+	{
+		glm_f32vec8 const Permy = glm_noise_soa8_permute(_mm256_add_ps(Iy, Oy[k]));
+		glm_f32vec8 const Hash = glm_noise_soa8_permute(_mm256_add_ps(_mm256_add_ps(Permy, Ix), Ox[k]));
+
+		glm_f32vec8 M = _mm256_max_ps(_mm256_sub_ps(Half, glm_noise_soa8_dot2(X[k][0], X[k][1], X[k][0], X[k][1])), _mm256_setzero_ps());
+		M = _mm256_mul_ps(M, M);
+		M = _mm256_mul_ps(M, M);
+
+		// Gradients: 41 points uniformly over a line, mapped onto a diamond
+		glm_f32vec8 const Gx = _mm256_sub_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), glm_noise_soa8_fract(_mm256_mul_ps(Hash, C3))), One);
+		glm_f32vec8 const H = _mm256_sub_ps(glm_noise_soa8_abs(Gx), Half);
+		glm_f32vec8 const A0 = _mm256_sub_ps(Gx, glm_noise_soa8_floor(_mm256_add_ps(Gx, Half)));
+		M = _mm256_mul_ps(M, glm_noise_soa8_taylor_inv_sqrt(_mm256_add_ps(_mm256_mul_ps(A0, A0), _mm256_mul_ps(H, H))));
+
+		glm_f32vec8 const G = glm_noise_soa8_dot2(A0, H, X[k][0], X[k][1]);
+		Result = k == 0 ? _mm256_mul_ps(M, G) : _mm256_add_ps(Result, _mm256_mul_ps(M, G));
+	}
+
+	return _mm256_mul_ps(_mm256_set1_ps(130.0f), Result);
+}
+
+// simplex(vec3(p[0], p[1], p[2]))
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_simplex3(glm_f32vec8 const p[3])
+{
+	glm_f32vec8 const One = _mm256_set1_ps(1.0f);
+	glm_f32vec8 const Cx = _mm256_set1_ps(static_cast<float>(1.0 / 6.0));
+	glm_f32vec8 const Cy = _mm256_set1_ps(static_cast<float>(1.0 / 3.0));
+	glm_f32vec8 const Cyyy[3] = {Cy, Cy, Cy};
+	glm_f32vec8 const Cxxx[3] = {Cx, Cx, Cx};
+
+	// First corner
+	glm_f32vec8 const Skew = glm_noise_soa8_dot3(p, Cyyy);
+	glm_f32vec8 I[3];
+	for(int c = 0; c < 3; ++c)
+		I[c] = glm_noise_soa8_floor(_mm256_add_ps(p[c], Skew));
+	glm_f32vec8 const Unskew = glm_noise_soa8_dot3(I, Cxxx);
+	glm_f32vec8 X[4][3];
+	for(int c = 0; c < 3; ++c)
+		X[0][c] = _mm256_add_ps(_mm256_sub_ps(p[c], I[c]), Unskew);
+
+	// Other corners
+	glm_f32vec8 const G[3] = {
+		glm_noise_soa8_step(X[0][1], X[0][0]),
+		glm_noise_soa8_step(X[0][2], X[0][1]),
+		glm_noise_soa8_step(X[0][0], X[0][2])};
+	glm_f32vec8 const L[3] = {_mm256_sub_ps(One, G[2]), _mm256_sub_ps(One, G[0]), _mm256_sub_ps(One, G[1])};
+	glm_f32vec8 O[4][3];
+	for(int c = 0; c < 3; ++c)
+	{
+		O[0][c] = _mm256_setzero_ps();
+		O[1][c] = _mm256_min_ps(G[c], L[c]);
+		O[2][c] = _mm256_max_ps(G[c], L[c]);
+		O[3][c] = One;
+		X[1][c] = _mm256_add_ps(_mm256_sub_ps(X[0][c], O[1][c]), Cx);
+		X[2][c] = _mm256_add_ps(_mm256_sub_ps(X[0][c], O[2][c]), Cy);
+		X[3][c] = _mm256_sub_ps(X[0][c], _mm256_set1_ps(0.5f));
+	}
+
+	// Permutations
+	for(int c = 0; c < 3; ++c)
+		I[c] = glm_noise_soa8_mod289(I[c]);
+
+	// Gradients: 7x7 points over a square, mapped onto an octahedron
+	float const n_ = static_cast<float>(0.142857142857);
+	glm_f32vec8 const NsX = _mm256_set1_ps(n_ * 2.0f);
+	glm_f32vec8 const NsY = _mm256_set1_ps(n_ * 0.5f - 1.0f);
+	glm_f32vec8 const NsZ = _mm256_set1_ps(n_ * 1.0f);
+
+	glm_f32vec8 D[4];
+	glm_f32vec8 M[4];
+	for(int k = 0; k < 4; ++k)
+	{
+		glm_f32vec8 const Permz = glm_noise_soa8_permute(_mm256_add_ps(I[2], O[k][2]));
+		glm_f32vec8 const Permy = glm_noise_soa8_permute(_mm256_add_ps(_mm256_add_ps(Permz, I[1]), O[k][1]));
+		glm_f32vec8 const Hash = glm_noise_soa8_permute(_mm256_add_ps(_mm256_add_ps(Permy, I[0]), O[k][0]));
+
+		glm_f32vec8 const J = _mm256_sub_ps(Hash, _mm256_mul_ps(_mm256_set1_ps(49.0f), glm_noise_soa8_floor(_mm256_mul_ps(_mm256_mul_ps(Hash, NsZ), NsZ))));
+		glm_f32vec8 const Fx = glm_noise_soa8_floor(_mm256_mul_ps(J, NsZ));
+		glm_f32vec8 const Fy = glm_noise_soa8_floor(_mm256_sub_ps(J, _mm256_mul_ps(_mm256_set1_ps(7.0f), Fx)));
+		glm_f32vec8 const Gx = _mm256_add_ps(_mm256_mul_ps(Fx, NsX), NsY);
+		glm_f32vec8 const Gy = _mm256_add_ps(_mm256_mul_ps(Fy, NsX), NsY);
+		glm_f32vec8 const H = _mm256_sub_ps(_mm256_sub_ps(One, glm_noise_soa8_abs(Gx)), glm_noise_soa8_abs(Gy));
+
+		// -step(h, 0.0), a negative zero when h > 0
+		glm_f32vec8 const Sh = _mm256_xor_ps(glm_noise_soa8_step(H, _mm256_setzero_ps()), _mm256_set1_ps(-0.0f));
+		glm_f32vec8 const Sx = _mm256_add_ps(_mm256_mul_ps(glm_noise_soa8_floor(Gx), _mm256_set1_ps(2.0f)), One);
+		glm_f32vec8 const Sy = _mm256_add_ps(_mm256_mul_ps(glm_noise_soa8_floor(Gy), _mm256_set1_ps(2.0f)), One);
+
+		glm_f32vec8 P[3] = {_mm256_add_ps(Gx, _mm256_mul_ps(Sx, Sh)), _mm256_add_ps(Gy, _mm256_mul_ps(Sy, Sh)), H};
+		glm_f32vec8 const Norm = glm_noise_soa8_taylor_inv_sqrt(glm_noise_soa8_dot3(P, P));
+		for(int c = 0; c < 3; ++c)
+			P[c] = _mm256_mul_ps(P[c], Norm);
+
+		D[k] = glm_noise_soa8_dot3(P, X[k]);
+		M[k] = _mm256_max_ps(_mm256_sub_ps(_mm256_set1_ps(static_cast<float>(0.6)), glm_noise_soa8_dot3(X[k], X[k])), _mm256_setzero_ps());
+		M[k] = _mm256_mul_ps(M[k], M[k]);
+		M[k] = _mm256_mul_ps(M[k], M[k]);
+	}
+
+	return _mm256_mul_ps(_mm256_set1_ps(42.0f), glm_noise_soa8_dot4(M, D));
+}
+
+// grad4(j, ip) of gtc_noise, ip being (1/294, 1/49, 1/7, 0)
+GLM_FUNC_QUALIFIER void glm_noise_soa8_grad4(glm_f32vec8 j, glm_f32vec8 out[4])
+{
+	glm_f32vec8 const Ip[3] = {_mm256_set1_ps(1.0f / 294.0f), _mm256_set1_ps(1.0f / 49.0f), _mm256_set1_ps(1.0f / 7.0f)};
+	for(int c = 0; c < 3; ++c)
+		out[c] = _mm256_sub_ps(_mm256_mul_ps(glm_noise_soa8_floor(_mm256_mul_ps(glm_noise_soa8_fract(_mm256_mul_ps(j, Ip[c])), _mm256_set1_ps(7.0f))), Ip[2]), _mm256_set1_ps(1.0f));
+	glm_f32vec8 const Abs[3] = {glm_noise_soa8_abs(out[0]), glm_noise_soa8_abs(out[1]), glm_noise_soa8_abs(out[2])};
+	glm_f32vec8 const Ones[3] = {_mm256_set1_ps(1.0f), _mm256_set1_ps(1.0f), _mm256_set1_ps(1.0f)};
+	out[3] = _mm256_sub_ps(_mm256_set1_ps(1.5f), glm_noise_soa8_dot3(Abs, Ones));
+	glm_f32vec8 const Sw = glm_noise_soa8_negative(out[3]);
+	for(int c = 0; c < 3; ++c)
+	{
+		glm_f32vec8 const S = glm_noise_soa8_negative(out[c]);
+		out[c] = _mm256_add_ps(out[c], _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(S, _mm256_set1_ps(2.0f)), _mm256_set1_ps(1.0f)), Sw));
+	}
+}
+
+// simplex(vec4(p[0], p[1], p[2], p[3]))
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_noise_soa8_simplex4(glm_f32vec8 const p[4])
+{
+	glm_f32vec8 const Zero = _mm256_setzero_ps();
+	glm_f32vec8 const One = _mm256_set1_ps(1.0f);
+	float const C[4] = {
+		static_cast<float>(0.138196601125011),
+		static_cast<float>(0.276393202250021),
+		static_cast<float>(0.414589803375032),
+		static_cast<float>(-0.447213595499958)};
+	glm_f32vec8 const F4 = _mm256_set1_ps(static_cast<float>(0.309016994374947451));
+	glm_f32vec8 const F4s[4] = {F4, F4, F4, F4};
+	glm_f32vec8 const Cx = _mm256_set1_ps(C[0]);
+	glm_f32vec8 const Cxs[4] = {Cx, Cx, Cx, Cx};
+
+	// First corner
+	glm_f32vec8 const Skew = glm_noise_soa8_dot4(p, F4s);
+	glm_f32vec8 I[4];
+	for(int c = 0; c < 4; ++c)
+		I[c] = glm_noise_soa8_floor(_mm256_add_ps(p[c], Skew));
+	glm_f32vec8 const Unskew = glm_noise_soa8_dot4(I, Cxs);
+	glm_f32vec8 X[5][4];
+	for(int c = 0; c < 4; ++c)
+		X[0][c] = _mm256_add_ps(_mm256_sub_ps(p[c], I[c]), Unskew);
+
+	// Other corners, rank sorting originally contributed by Bill Licea-Kane, AMD (formerly ATI)
+	glm_f32vec8 const IsX[3] = {
+		glm_noise_soa8_step(X[0][1], X[0][0]),
+		glm_noise_soa8_step(X[0][2], X[0][0]),
+		glm_noise_soa8_step(X[0][3], X[0][0])};
+	glm_f32vec8 const IsYZ[3] = {
+		glm_noise_soa8_step(X[0][2], X[0][1]),
+		glm_noise_soa8_step(X[0][3], X[0][1]),
+		glm_noise_soa8_step(X[0][3], X[0][2])};
+	glm_f32vec8 Rank[4];
+	Rank[0] = _mm256_add_ps(_mm256_add_ps(IsX[0], IsX[1]), IsX[2]);
+	Rank[1] = _mm256_add_ps(_mm256_sub_ps(One, IsX[0]), _mm256_add_ps(IsYZ[0], IsYZ[1]));
+	Rank[2] = _mm256_add_ps(_mm256_add_ps(_mm256_sub_ps(One, IsX[1]), _mm256_sub_ps(One, IsYZ[0])), IsYZ[2]);
+	Rank[3] = _mm256_add_ps(_mm256_add_ps(_mm256_sub_ps(One, IsX[2]), _mm256_sub_ps(One, IsYZ[1])), _mm256_sub_ps(One, IsYZ[2]));
+
+	// O[k] is the offset of the corner k, O[1] to O[3] being i1 to i3 of gtc_noise
+	glm_f32vec8 O[5][4];
+	for(int c = 0; c < 4; ++c)
+	{
+		O[0][c] = Zero;
+		O[3][c] = _mm256_max_ps(_mm256_min_ps(Rank[c], One), Zero);
+		O[2][c] = _mm256_max_ps(_mm256_min_ps(_mm256_sub_ps(Rank[c], One), One), Zero);
+		O[1][c] = _mm256_max_ps(_mm256_min_ps(_mm256_sub_ps(Rank[c], _mm256_set1_ps(2.0f)), One), Zero);
+		O[4][c] = One;
+		for(int k = 1; k < 4; ++k)
+			X[k][c] = _mm256_add_ps(_mm256_sub_ps(X[0][c], O[k][c]), _mm256_set1_ps(C[k - 1]));
+		X[4][c] = _mm256_add_ps(X[0][c], _mm256_set1_ps(C[3]));
+	}
+
+	// Permutations
+	for(int c = 0; c < 4; ++c)
+		I[c] = glm_noise_soa8_mod(I[c]);
+
+	glm_f32vec8 D[5];
+	glm_f32vec8 M[5];
+	for(int k = 0; k < 5; ++k)
+	{
+		glm_f32vec8 Hash;
+		if(k == 0)
+			Hash = glm_noise_soa8_permute(_mm256_add_ps(glm_noise_soa8_permute(_mm256_add_ps(glm_noise_soa8_permute(_mm256_add_ps(glm_noise_soa8_permute(I[3]), I[2])), I[1])), I[0]));
+		else
+		{
+			Hash = glm_noise_soa8_permute(_mm256_add_ps(I[3], O[k][3]));
+			for(int c = 2; c >= 0; --c)
+				Hash = glm_noise_soa8_permute(_mm256_add_ps(_mm256_add_ps(Hash, I[c]), O[k][c]));
+		}
+
+		// Gradients: 7x7x6 points over a cube, mapped onto a 4-cross polytope
+		glm_f32vec8 P[4];
+		glm_noise_soa8_grad4(Hash, P);
+		glm_f32vec8 const Norm = glm_noise_soa8_taylor_inv_sqrt(glm_noise_soa8_dot4(P, P));
+		for(int c = 0; c < 4; ++c)
+			P[c] = _mm256_mul_ps(P[c], Norm);
+
+		D[k] = glm_noise_soa8_dot4(P, X[k]);
+		M[k] = _mm256_max_ps(_mm256_sub_ps(_mm256_set1_ps(static_cast<float>(0.6)), glm_noise_soa8_dot4(X[k], X[k])), Zero);
+		M[k] = _mm256_mul_ps(M[k], M[k]);
+		M[k] = _mm256_mul_ps(M[k], M[k]);
+	}
+
+	glm_f32vec8 const Sum0 = glm_noise_soa8_dot3(M, D);
+	glm_f32vec8 const Sum1 = glm_noise_soa8_dot2(M[3], M[4], D[3], D[4]);
+	return _mm256_mul_ps(_mm256_set1_ps(49.0f), _mm256_add_ps(Sum0, Sum1));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
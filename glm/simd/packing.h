@@ -3,6 +3,178 @@
 
 #pragma once
 
+#include "platform.h"
+#include <cstddef>
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+// Converts 4 floats to half floats stored in the low 16 bits of 32-bit lanes.
+// Same results as detail::toFloat16, including the rounding of ties away from zero and the NaN significands.
+GLM_FUNC_QUALIFIER glm_ivec4 glm_vec4_to_half(glm_vec4 v)
+{
+	glm_ivec4 const i = _mm_castps_si128(v);
+	glm_ivec4 const s = _mm_and_si128(_mm_srli_epi32(i, 16), _mm_set1_epi32(0x8000));
+	glm_ivec4 const a = _mm_and_si128(i, _mm_set1_epi32(0x7fffffff));
+
+	// Normalized: rebias the exponent and round the significand, a carry increments the exponent
+	glm_ivec4 const Norm0 = _mm_srli_epi32(_mm_add_epi32(a, _mm_set1_epi32(0x1000 - 0x38000000)), 13);
+	glm_ivec4 const Overflow = _mm_cmpgt_epi32(Norm0, _mm_set1_epi32(0x7c00));
+	glm_ivec4 const Norm = _mm_or_si128(_mm_and_si128(Overflow, _mm_set1_epi32(0x7c00)), _mm_andnot_si128(Overflow, Norm0));
+
+	// Denormalized: the magnitude in units of the smallest half denormal, rounded half up
+	glm_vec4 const q = _mm_mul_ps(_mm_castsi128_ps(a), _mm_set1_ps(16777216.0f));
+	glm_ivec4 const t = _mm_cvttps_epi32(q);
+	glm_ivec4 const Up = _mm_castps_si128(_mm_cmpge_ps(_mm_sub_ps(q, _mm_cvtepi32_ps(t)), _mm_set1_ps(0.5f)));
+	glm_ivec4 const Denorm = _mm_sub_epi32(t, Up);
+
+	// NaN: keep the 10 leftmost bits of the significand, at least one of them set
+	glm_ivec4 const m = _mm_srli_epi32(_mm_and_si128(i, _mm_set1_epi32(0x007fffff)), 13);
+	glm_ivec4 const Zero = _mm_and_si128(_mm_cmpeq_epi32(m, _mm_setzero_si128()), _mm_set1_epi32(1));
+	glm_ivec4 const NaN = _mm_or_si128(_mm_or_si128(m, _mm_set1_epi32(0x7c00)), Zero);
+
+	glm_ivec4 const IsNaN = _mm_cmpgt_epi32(a, _mm_set1_epi32(0x7f800000));
+	glm_ivec4 const IsNorm = _mm_cmpgt_epi32(a, _mm_set1_epi32(0x387fffff));
+	glm_ivec4 const Finite = _mm_or_si128(_mm_and_si128(IsNorm, Norm), _mm_andnot_si128(IsNorm, Denorm));
+	glm_ivec4 const Result = _mm_or_si128(_mm_and_si128(IsNaN, NaN), _mm_andnot_si128(IsNaN, Finite));
+	return _mm_or_si128(Result, s);
+}
+
+// Converts 4 half floats stored in the low 16 bits of 32-bit lanes, the high bits being zero.
+// Same results as detail::toFloat32, NaN significands are preserved.
+GLM_FUNC_QUALIFIER glm_vec4 glm_half_to_vec4(glm_ivec4 h)
+{
+	glm_ivec4 const s = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+	glm_ivec4 const em = _mm_and_si128(h, _mm_set1_epi32(0x7fff));
+
+	// Normalized, infinity and NaN: rebias the exponent, twice for infinity and NaN
+	glm_ivec4 const IsInfNaN = _mm_cmpgt_epi32(em, _mm_set1_epi32(0x7bff));
+	glm_ivec4 const Rebias = _mm_add_epi32(_mm_set1_epi32(0x38000000), _mm_and_si128(IsInfNaN, _mm_set1_epi32(0x38000000)));
+	glm_ivec4 const Norm = _mm_add_epi32(_mm_slli_epi32(em, 13), Rebias);
+
+	// Zero and denormalized: the significand in units of the smallest half denormal
+	glm_ivec4 const Denorm = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(em), _mm_set1_ps(1.0f / 16777216.0f)));
+
+	glm_ivec4 const IsDenorm = _mm_cmplt_epi32(em, _mm_set1_epi32(0x0400));
+	glm_ivec4 const Result = _mm_or_si128(_mm_and_si128(IsDenorm, Denorm), _mm_andnot_si128(IsDenorm, Norm));
+	return _mm_castsi128_ps(_mm_or_si128(Result, s));
+}
+
+// Packs the low 16 bits of the 32-bit lanes of a and b
+GLM_FUNC_QUALIFIER glm_ivec4 glm_i32vec4_pack_16(glm_ivec4 a, glm_ivec4 b)
+{
+	// Sign extends the low 16 bits so that the signed saturation keeps them
+	glm_ivec4 const a16 = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+	glm_ivec4 const b16 = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+	return _mm_packs_epi32(a16, b16);
+}
+
+// Converts count floats to half floats, 8 at a time, the remaining ones through a zero padded block
+GLM_FUNC_QUALIFIER void glm_pack_half_array(float const* in, unsigned short* out, std::size_t count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= count; i += 8)
+	{
+		glm_ivec4 const a = glm_vec4_to_half(_mm_loadu_ps(in + i));
+		glm_ivec4 const b = glm_vec4_to_half(_mm_loadu_ps(in + i + 4));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), glm_i32vec4_pack_16(a, b));
+	}
+
+	if(i < count)
+	{
+		float Block[8] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+		unsigned short Packed[8];
+		for(std::size_t j = 0; j < count - i; ++j)
+			Block[j] = in[i + j];
+		glm_ivec4 const a = glm_vec4_to_half(_mm_loadu_ps(Block));
+		glm_ivec4 const b = glm_vec4_to_half(_mm_loadu_ps(Block + 4));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Packed), glm_i32vec4_pack_16(a, b));
+		for(std::size_t j = 0; j < count - i; ++j)
+			out[i + j] = Packed[j];
+	}
+}
+
+// Converts count half floats to floats, 8 at a time, the remaining ones through a zero padded block
+GLM_FUNC_QUALIFIER void glm_unpack_half_array(unsigned short const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= count; i += 8)
+	{
+		glm_ivec4 const h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i));
+		_mm_storeu_ps(out + i, glm_half_to_vec4(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+		_mm_storeu_ps(out + i + 4, glm_half_to_vec4(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+	}
+
+	if(i < count)
+	{
+		unsigned short Block[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+		float Unpacked[8];
+		for(std::size_t j = 0; j < count - i; ++j)
+			Block[j] = in[i + j];
+		glm_ivec4 const h = _mm_loadu_si128(reinterpret_cast<__m128i const*>(Block));
+		_mm_storeu_ps(Unpacked, glm_half_to_vec4(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+		_mm_storeu_ps(Unpacked + 4, glm_half_to_vec4(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+		for(std::size_t j = 0; j < count - i; ++j)
+			out[i + j] = Unpacked[j];
+	}
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_HAS_F16C || (GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE)
+
+// Converts 8 floats to half floats with the same results as glm_vec4_to_half.
+// F16C rounds ties to even while detail::toFloat16 rounds them away from zero: a float exactly halfway
+// between two half floats takes the one after the truncated value. F16C also sets the quiet bit of NaN,
+// blocks containing NaN use glm_vec4_to_half.
+GLM_FUNC_TARGET_F16C GLM_FUNC_QUALIFIER __m128i glm_vec8_to_half_f16c(glm_f32vec8 v)
+{
+	if(_mm256_movemask_ps(_mm256_cmp_ps(v, v, _CMP_UNORD_Q)))
+		return glm_i32vec4_pack_16(glm_vec4_to_half(_mm256_castps256_ps128(v)), glm_vec4_to_half(_mm256_extractf128_ps(v, 1)));
+
+	__m128i const Even = _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	__m128i const Trunc = _mm256_cvtps_ph(v, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+	__m128i const Next = _mm_add_epi16(Trunc, _mm_set1_epi16(1));
+
+	// Halfway values are exact floats, half floats having 11 significant bits
+	glm_f32vec8 const Mid = _mm256_mul_ps(_mm256_add_ps(_mm256_cvtph_ps(Trunc), _mm256_cvtph_ps(Next)), _mm256_set1_ps(0.5f));
+	__m256i const Tie32 = _mm256_castps_si256(_mm256_cmp_ps(v, Mid, _CMP_EQ_OQ));
+	__m128i const Tie = _mm_packs_epi32(_mm256_castsi256_si128(Tie32), _mm256_extracti128_si256(Tie32, 1));
+	return _mm_blendv_epi8(Even, Next, Tie);
+}
+
+// Converts 8 half floats to floats with the same results as glm_half_to_vec4.
+// F16C sets the quiet bit of NaN, blocks containing NaN use glm_half_to_vec4.
+GLM_FUNC_TARGET_F16C GLM_FUNC_QUALIFIER glm_f32vec8 glm_half8_to_vec8_f16c(__m128i h)
+{
+	__m128i const IsNaN = _mm_cmpgt_epi16(_mm_and_si128(h, _mm_set1_epi16(0x7fff)), _mm_set1_epi16(0x7c00));
+	if(_mm_movemask_epi8(IsNaN))
+	{
+		glm_vec4 const a = glm_half_to_vec4(_mm_unpacklo_epi16(h, _mm_setzero_si128()));
+		glm_vec4 const b = glm_half_to_vec4(_mm_unpackhi_epi16(h, _mm_setzero_si128()));
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(a), b, 1);
+	}
+
+	return _mm256_cvtph_ps(h);
+}
+
+// F16C version of glm_pack_half_array
+GLM_FUNC_TARGET_F16C GLM_FUNC_QUALIFIER void glm_pack_half_array_f16c(float const* in, unsigned short* out, std::size_t count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= count; i += 8)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), glm_vec8_to_half_f16c(_mm256_loadu_ps(in + i)));
+
+	glm_pack_half_array(in + i, out + i, count - i);
+}
+
+// F16C version of glm_unpack_half_array
+GLM_FUNC_TARGET_F16C GLM_FUNC_QUALIFIER void glm_unpack_half_array_f16c(unsigned short const* in, float* out, std::size_t count)
+{
+	std::size_t i = 0;
+	for(; i + 8 <= count; i += 8)
+		_mm256_storeu_ps(out + i, glm_half8_to_vec8_f16c(_mm_loadu_si128(reinterpret_cast<__m128i const*>(in + i))));
+
+	glm_unpack_half_array(in + i, out + i, count - i);
+}
+
+#endif//GLM_HAS_F16C || (GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE)
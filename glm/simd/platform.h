@@ -304,7 +304,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 // Instruction sets
 
-// User defines: GLM_FORCE_PURE GLM_FORCE_INTRINSICS GLM_FORCE_SSE2 GLM_FORCE_SSE3 GLM_FORCE_AVX GLM_FORCE_AVX2 GLM_FORCE_AVX2
+// User defines: GLM_FORCE_PURE GLM_FORCE_INTRINSICS GLM_FORCE_SSE2 GLM_FORCE_SSE3 GLM_FORCE_AVX GLM_FORCE_AVX2 GLM_FORCE_AVX512
 
 #define GLM_ARCH_MIPS_BIT	  (0x10000000)
 #define GLM_ARCH_PPC_BIT	  (0x20000000)
@@ -323,6 +323,7 @@
 #define GLM_ARCH_SSE42_BIT	(0x00000040)
 #define GLM_ARCH_AVX_BIT	(0x00000080)
 #define GLM_ARCH_AVX2_BIT	(0x00000100)
+#define GLM_ARCH_AVX512_BIT	(0x00000200)
 
 #define GLM_ARCH_UNKNOWN	(0)
 #define GLM_ARCH_X86		(GLM_ARCH_X86_BIT)
@@ -334,6 +335,7 @@
 #define GLM_ARCH_SSE42		(GLM_ARCH_SSE42_BIT | GLM_ARCH_SSE41)
 #define GLM_ARCH_AVX		(GLM_ARCH_AVX_BIT | GLM_ARCH_SSE42)
 #define GLM_ARCH_AVX2		(GLM_ARCH_AVX2_BIT | GLM_ARCH_AVX)
+#define GLM_ARCH_AVX512		(GLM_ARCH_AVX512_BIT | GLM_ARCH_AVX2)
 #define GLM_ARCH_ARM		(GLM_ARCH_ARM_BIT)
 #define GLM_ARCH_ARMV8		(GLM_ARCH_NEON_BIT | GLM_ARCH_SIMD_BIT | GLM_ARCH_ARM | GLM_ARCH_ARMV8_BIT)
 #define GLM_ARCH_NEON		(GLM_ARCH_NEON_BIT | GLM_ARCH_SIMD_BIT | GLM_ARCH_ARM)
@@ -349,6 +351,9 @@
 #		define GLM_ARCH (GLM_ARCH_NEON)
 #	endif
 #	define GLM_FORCE_INTRINSICS
+#elif defined(GLM_FORCE_AVX512)
+#	define GLM_ARCH (GLM_ARCH_AVX512)
+#	define GLM_FORCE_INTRINSICS
 #elif defined(GLM_FORCE_AVX2)
 #	define GLM_ARCH (GLM_ARCH_AVX2)
 #	define GLM_FORCE_INTRINSICS
@@ -374,7 +379,9 @@
 #	define GLM_ARCH (GLM_ARCH_SSE)
 #	define GLM_FORCE_INTRINSICS
 #elif defined(GLM_FORCE_INTRINSICS) && !defined(GLM_FORCE_XYZW_ONLY)
-#	if defined(__AVX2__)
+#	if defined(__AVX512F__)
+#		define GLM_ARCH (GLM_ARCH_AVX512)
+#	elif defined(__AVX2__)
 #		define GLM_ARCH (GLM_ARCH_AVX2)
 #	elif defined(__AVX__)
 #		define GLM_ARCH (GLM_ARCH_AVX)
@@ -417,7 +424,9 @@
 #	endif
 #endif
 
-#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+#	include <immintrin.h>
+#elif GLM_ARCH & GLM_ARCH_AVX2_BIT
 #	include <immintrin.h>
 #elif GLM_ARCH & GLM_ARCH_AVX_BIT
 #	include <immintrin.h>
@@ -438,6 +447,63 @@
 #	include "neon.h"
 #endif//GLM_ARCH
 
+// GLM_FORCE_SIMD_DISPATCH builds the kernels of bulk functions for instruction sets above GLM_ARCH
+// using function target attributes, GLM_EXT_simd_dispatch selects them at runtime
+#if defined(GLM_FORCE_SIMD_DISPATCH) && (GLM_ARCH & GLM_ARCH_SSE2_BIT) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG | GLM_COMPILER_VC))
+#	define GLM_ARCH_DISPATCH (GLM_ARCH | GLM_ARCH_AVX512)
+#else
+#	define GLM_ARCH_DISPATCH (GLM_ARCH)
+#endif
+
+#if (GLM_ARCH_DISPATCH & GLM_ARCH_AVX_BIT) && !(GLM_ARCH & GLM_ARCH_AVX_BIT)
+#	include <immintrin.h>
+#endif
+
+#if (GLM_ARCH_DISPATCH & GLM_ARCH_AVX_BIT) && !(GLM_ARCH & GLM_ARCH_AVX_BIT) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+#	define GLM_FUNC_TARGET_AVX __attribute__((target("avx")))
+#else
+#	define GLM_FUNC_TARGET_AVX
+#endif
+
+#if (GLM_ARCH_DISPATCH & GLM_ARCH_AVX512_BIT) && !(GLM_ARCH & GLM_ARCH_AVX512_BIT) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+#	define GLM_FUNC_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#	define GLM_FUNC_TARGET_AVX512
+#endif
+
+// F16C has no GLM_ARCH level, every CPU supporting AVX2 supports it
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__F16C__) || (GLM_COMPILER & GLM_COMPILER_VC))
+#	define GLM_HAS_F16C 1
+#else
+#	define GLM_HAS_F16C 0
+#endif
+
+#if !GLM_HAS_F16C && (GLM_ARCH_DISPATCH & GLM_ARCH_AVX2_BIT) && (GLM_COMPILER & (GLM_COMPILER_GCC | GLM_COMPILER_CLANG))
+#	define GLM_FUNC_TARGET_F16C __attribute__((target("avx2,f16c")))
+#else
+#	define GLM_FUNC_TARGET_F16C
+#endif
+
+// BMI2 has no GLM_ARCH level either, its 64-bit pdep and pext are only available on x86-64
+#if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && (defined(__BMI2__) || (GLM_COMPILER & GLM_COMPILER_VC)) && (defined(__x86_64__) || defined(_M_X64))
+#	define GLM_HAS_BMI2 1
+#else
+#	define GLM_HAS_BMI2 0
+#endif
+
+// AVX-512 subsets of the integer functions, AVX512VL providing their 128-bit forms
+#if (GLM_ARCH & GLM_ARCH_AVX512_BIT) && defined(__AVX512VL__) && defined(__AVX512CD__)
+#	define GLM_HAS_AVX512_CD 1
+#else
+#	define GLM_HAS_AVX512_CD 0
+#endif
+
+#if (GLM_ARCH & GLM_ARCH_AVX512_BIT) && defined(__AVX512VL__) && defined(__AVX512VPOPCNTDQ__)
+#	define GLM_HAS_AVX512_VPOPCNTDQ 1
+#else
+#	define GLM_HAS_AVX512_VPOPCNTDQ 0
+#endif
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 	typedef __m128			glm_f32vec4;
 	typedef __m128i			glm_i32vec4;
@@ -452,16 +518,23 @@
 	typedef glm_f64vec2		glm_dvec2;
 #endif
 
-#if GLM_ARCH & GLM_ARCH_AVX_BIT
+#if GLM_ARCH_DISPATCH & GLM_ARCH_AVX_BIT
+	typedef __m256			glm_f32vec8;
 	typedef __m256d			glm_f64vec4;
 	typedef glm_f64vec4		glm_dvec4;
 #endif
 
-#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#if GLM_ARCH_DISPATCH & GLM_ARCH_AVX2_BIT
+	typedef __m256i			glm_i32vec8;
+	typedef __m256i			glm_u32vec8;
 	typedef __m256i			glm_i64vec4;
 	typedef __m256i			glm_u64vec4;
 #endif
 
+#if GLM_ARCH_DISPATCH & GLM_ARCH_AVX512_BIT
+	typedef __m512			glm_f32vec16;
+#endif
+
 #if GLM_ARCH & GLM_ARCH_NEON_BIT
 	typedef float32x4_t			glm_f32vec4;
 	typedef int32x4_t			glm_i32vec4;
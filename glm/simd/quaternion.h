@@ -0,0 +1,806 @@
+/// @ref simd
+/// @file glm/simd/quaternion.h
+
+#pragma once
+
+#include "matrix.h"
+#include "trigonometric.h"
+
+// Kernels of GLM_EXT_quaternion_batch. Quaternions are transposed into one register per component,
+// in x, y, z, w order whatever GLM_FORCE_QUAT_DATA_WXYZ, so that each lane holds one quaternion.
+// The operation orders match the scalar functions: only slerp differs, by the accuracy of the
+// polynomial acos and sin and by computing sin(angle) as sqrt((1 - cos(angle)) * (1 + cos(angle))).
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Loads 4 quaternions, out receives the x, y, z and w components
+GLM_FUNC_QUALIFIER void glm_quat_soa4_load(float const* in, glm_vec4 out[4])
+{
+	glm_vec4 Q[4];
+	Q[0] = _mm_loadu_ps(in + 0);
+	Q[1] = _mm_loadu_ps(in + 4);
+	Q[2] = _mm_loadu_ps(in + 8);
+	Q[3] = _mm_loadu_ps(in + 12);
+
+#	ifdef GLM_FORCE_QUAT_DATA_WXYZ
+		glm_vec4 T[4];
+		glm_mat4_transpose(Q, T);
+		out[0] = T[1];
+		out[1] = T[2];
+		out[2] = T[3];
+		out[3] = T[0];
+#	else
+		glm_mat4_transpose(Q, out);
+#	endif
+}
+
+// Stores 4 quaternions from their x, y, z and w components
+GLM_FUNC_QUALIFIER void glm_quat_soa4_store(glm_vec4 const in[4], float* out)
+{
+	glm_vec4 Q[4];
+#	ifdef GLM_FORCE_QUAT_DATA_WXYZ
+		glm_vec4 T[4];
+		T[0] = in[3];
+		T[1] = in[0];
+		T[2] = in[1];
+		T[3] = in[2];
+		glm_mat4_transpose(T, Q);
+#	else
+		glm_mat4_transpose(in, Q);
+#	endif
+
+	_mm_storeu_ps(out + 0, Q[0]);
+	_mm_storeu_ps(out + 4, Q[1]);
+	_mm_storeu_ps(out + 8, Q[2]);
+	_mm_storeu_ps(out + 12, Q[3]);
+}
+
+// Stores 4 packed mat3 from their components, in[c * 3 + r] holding row r of column c
+GLM_FUNC_QUALIFIER void glm_mat3_soa4_store(glm_vec4 const in[9], float* out)
+{
+	glm_vec4 Lo[4];
+	glm_vec4 Hi[4];
+	glm_mat4_transpose(in + 0, Lo);
+	glm_mat4_transpose(in + 4, Hi);
+
+	_mm_storeu_ps(out + 0, Lo[0]);
+	_mm_storeu_ps(out + 4, Hi[0]);
+	_mm_storeu_ps(out + 9, Lo[1]);
+	_mm_storeu_ps(out + 13, Hi[1]);
+	_mm_storeu_ps(out + 18, Lo[2]);
+	_mm_storeu_ps(out + 22, Hi[2]);
+	_mm_storeu_ps(out + 27, Lo[3]);
+	_mm_storeu_ps(out + 31, Hi[3]);
+
+	_mm_store_ss(out + 8, in[8]);
+	_mm_store_ss(out + 17, _mm_shuffle_ps(in[8], in[8], _MM_SHUFFLE(1, 1, 1, 1)));
+	_mm_store_ss(out + 26, _mm_shuffle_ps(in[8], in[8], _MM_SHUFFLE(2, 2, 2, 2)));
+	_mm_store_ss(out + 35, _mm_shuffle_ps(in[8], in[8], _MM_SHUFFLE(3, 3, 3, 3)));
+}
+
+// Stores the same column of 4 packed mat4 from its components
+GLM_FUNC_QUALIFIER void glm_mat4_soa4_store_column(glm_vec4 const in[4], float* out)
+{
+	glm_vec4 Columns[4];
+	glm_mat4_transpose(in, Columns);
+
+	_mm_storeu_ps(out + 0, Columns[0]);
+	_mm_storeu_ps(out + 16, Columns[1]);
+	_mm_storeu_ps(out + 32, Columns[2]);
+	_mm_storeu_ps(out + 48, Columns[3]);
+}
+
+// Stores 4 mat4 from their components, in[c * 4 + r] holding row r of column c
+GLM_FUNC_QUALIFIER void glm_mat4_soa4_store(glm_vec4 const in[16], float* out)
+{
+	glm_mat4_soa4_store_column(in + 0, out + 0);
+	glm_mat4_soa4_store_column(in + 4, out + 4);
+	glm_mat4_soa4_store_column(in + 8, out + 8);
+	glm_mat4_soa4_store_column(in + 12, out + 12);
+}
+
+// Flips y where dot(x, y) is negative so that interpolations take the shortest path, returns the absolute dot products
+GLM_FUNC_QUALIFIER glm_vec4 glm_quat_soa4_shortest(glm_vec4 const x[4], glm_vec4 const y[4], glm_vec4 z[4])
+{
+	// Same operation order as dot(qua, qua)
+	glm_vec4 const Dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x[3], y[3]), _mm_mul_ps(x[0], y[0])), _mm_add_ps(_mm_mul_ps(x[1], y[1]), _mm_mul_ps(x[2], y[2])));
+	glm_vec4 const Sign = _mm_and_ps(_mm_cmplt_ps(Dot, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+
+	z[0] = _mm_xor_ps(y[0], Sign);
+	z[1] = _mm_xor_ps(y[1], Sign);
+	z[2] = _mm_xor_ps(y[2], Sign);
+	z[3] = _mm_xor_ps(y[3], Sign);
+	return _mm_xor_ps(Dot, Sign);
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa4_slerp(glm_vec4 const x[4], glm_vec4 const y[4], glm_vec4 a, glm_vec4 out[4])
+{
+	glm_vec4 z[4];
+	glm_vec4 const CosTheta = glm_quat_soa4_shortest(x, y, z);
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+	glm_vec4 const OneMinusA = _mm_sub_ps(One, a);
+
+	// Lanes with cos(angle) > 1 - epsilon are linearly interpolated, sin(angle) would be a near zero denominator
+	glm_vec4 const Linear = _mm_cmpgt_ps(CosTheta, _mm_set1_ps(1.0f - 1.1920928955078125e-7f));
+
+	glm_vec4 const Angle = glm_vec4_acos(CosTheta);
+	glm_vec4 const SinAngle = _mm_sqrt_ps(_mm_mul_ps(_mm_sub_ps(One, CosTheta), _mm_add_ps(One, CosTheta)));
+	glm_vec4 const Sin0 = glm_vec4_sin(_mm_mul_ps(OneMinusA, Angle));
+	glm_vec4 const Sin1 = glm_vec4_sin(_mm_mul_ps(a, Angle));
+
+	glm_vec4 const Lerp0 = _mm_add_ps(_mm_mul_ps(x[0], OneMinusA), _mm_mul_ps(z[0], a));
+	glm_vec4 const Slerp0 = _mm_div_ps(_mm_add_ps(_mm_mul_ps(Sin0, x[0]), _mm_mul_ps(Sin1, z[0])), SinAngle);
+	out[0] = glm_vec4_select(Linear, Lerp0, Slerp0);
+
+	glm_vec4 const Lerp1 = _mm_add_ps(_mm_mul_ps(x[1], OneMinusA), _mm_mul_ps(z[1], a));
+	glm_vec4 const Slerp1 = _mm_div_ps(_mm_add_ps(_mm_mul_ps(Sin0, x[1]), _mm_mul_ps(Sin1, z[1])), SinAngle);
+	out[1] = glm_vec4_select(Linear, Lerp1, Slerp1);
+
+	glm_vec4 const Lerp2 = _mm_add_ps(_mm_mul_ps(x[2], OneMinusA), _mm_mul_ps(z[2], a));
+	glm_vec4 const Slerp2 = _mm_div_ps(_mm_add_ps(_mm_mul_ps(Sin0, x[2]), _mm_mul_ps(Sin1, z[2])), SinAngle);
+	out[2] = glm_vec4_select(Linear, Lerp2, Slerp2);
+
+	glm_vec4 const Lerp3 = _mm_add_ps(_mm_mul_ps(x[3], OneMinusA), _mm_mul_ps(z[3], a));
+	glm_vec4 const Slerp3 = _mm_div_ps(_mm_add_ps(_mm_mul_ps(Sin0, x[3]), _mm_mul_ps(Sin1, z[3])), SinAngle);
+	out[3] = glm_vec4_select(Linear, Lerp3, Slerp3);
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa4_nlerp(glm_vec4 const x[4], glm_vec4 const y[4], glm_vec4 a, glm_vec4 out[4])
+{
+	glm_vec4 z[4];
+	glm_quat_soa4_shortest(x, y, z);
+	glm_vec4 const OneMinusA = _mm_sub_ps(_mm_set1_ps(1.0f), a);
+
+	glm_vec4 r[4];
+	r[0] = _mm_add_ps(_mm_mul_ps(x[0], OneMinusA), _mm_mul_ps(z[0], a));
+	r[1] = _mm_add_ps(_mm_mul_ps(x[1], OneMinusA), _mm_mul_ps(z[1], a));
+	r[2] = _mm_add_ps(_mm_mul_ps(x[2], OneMinusA), _mm_mul_ps(z[2], a));
+	r[3] = _mm_add_ps(_mm_mul_ps(x[3], OneMinusA), _mm_mul_ps(z[3], a));
+
+	glm_vec4 const Length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(r[3], r[3]), _mm_mul_ps(r[0], r[0])), _mm_add_ps(_mm_mul_ps(r[1], r[1]), _mm_mul_ps(r[2], r[2]))));
+	glm_vec4 const OneOverLength = _mm_div_ps(_mm_set1_ps(1.0f), Length);
+
+	// Like normalize, a zero length quaternion becomes the identity
+	glm_vec4 const Zero = _mm_cmple_ps(Length, _mm_setzero_ps());
+	out[0] = glm_vec4_select(Zero, _mm_setzero_ps(), _mm_mul_ps(r[0], OneOverLength));
+	out[1] = glm_vec4_select(Zero, _mm_setzero_ps(), _mm_mul_ps(r[1], OneOverLength));
+	out[2] = glm_vec4_select(Zero, _mm_setzero_ps(), _mm_mul_ps(r[2], OneOverLength));
+	out[3] = glm_vec4_select(Zero, _mm_set1_ps(1.0f), _mm_mul_ps(r[3], OneOverLength));
+}
+
+// Computes q * v, the operation order matches operator*(qua, vec3)
+GLM_FUNC_QUALIFIER void glm_quat_soa4_rotate(glm_vec4 const q[4], glm_vec4 const v[3], glm_vec4 out[3])
+{
+	glm_vec4 const uv0 = _mm_sub_ps(_mm_mul_ps(q[1], v[2]), _mm_mul_ps(v[1], q[2]));
+	glm_vec4 const uv1 = _mm_sub_ps(_mm_mul_ps(q[2], v[0]), _mm_mul_ps(v[2], q[0]));
+	glm_vec4 const uv2 = _mm_sub_ps(_mm_mul_ps(q[0], v[1]), _mm_mul_ps(v[0], q[1]));
+
+	glm_vec4 const uuv0 = _mm_sub_ps(_mm_mul_ps(q[1], uv2), _mm_mul_ps(uv1, q[2]));
+	glm_vec4 const uuv1 = _mm_sub_ps(_mm_mul_ps(q[2], uv0), _mm_mul_ps(uv2, q[0]));
+	glm_vec4 const uuv2 = _mm_sub_ps(_mm_mul_ps(q[0], uv1), _mm_mul_ps(uv0, q[1]));
+
+	glm_vec4 const Two = _mm_set1_ps(2.0f);
+	out[0] = _mm_add_ps(v[0], _mm_mul_ps(_mm_add_ps(_mm_mul_ps(uv0, q[3]), uuv0), Two));
+	out[1] = _mm_add_ps(v[1], _mm_mul_ps(_mm_add_ps(_mm_mul_ps(uv1, q[3]), uuv1), Two));
+	out[2] = _mm_add_ps(v[2], _mm_mul_ps(_mm_add_ps(_mm_mul_ps(uv2, q[3]), uuv2), Two));
+}
+
+// Computes the components of mat3_cast(q), out[c * 3 + r] receives row r of column c
+GLM_FUNC_QUALIFIER void glm_quat_soa4_mat3(glm_vec4 const q[4], glm_vec4 out[9])
+{
+	glm_vec4 const qxx = _mm_mul_ps(q[0], q[0]);
+	glm_vec4 const qyy = _mm_mul_ps(q[1], q[1]);
+	glm_vec4 const qzz = _mm_mul_ps(q[2], q[2]);
+	glm_vec4 const qxz = _mm_mul_ps(q[0], q[2]);
+	glm_vec4 const qxy = _mm_mul_ps(q[0], q[1]);
+	glm_vec4 const qyz = _mm_mul_ps(q[1], q[2]);
+	glm_vec4 const qwx = _mm_mul_ps(q[3], q[0]);
+	glm_vec4 const qwy = _mm_mul_ps(q[3], q[1]);
+	glm_vec4 const qwz = _mm_mul_ps(q[3], q[2]);
+
+	glm_vec4 const One = _mm_set1_ps(1.0f);
+	glm_vec4 const Two = _mm_set1_ps(2.0f);
+
+	out[0] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(qyy, qzz)));
+	out[1] = _mm_mul_ps(Two, _mm_add_ps(qxy, qwz));
+	out[2] = _mm_mul_ps(Two, _mm_sub_ps(qxz, qwy));
+
+	out[3] = _mm_mul_ps(Two, _mm_sub_ps(qxy, qwz));
+	out[4] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(qxx, qzz)));
+	out[5] = _mm_mul_ps(Two, _mm_add_ps(qyz, qwx));
+
+	out[6] = _mm_mul_ps(Two, _mm_add_ps(qxz, qwy));
+	out[7] = _mm_mul_ps(Two, _mm_sub_ps(qyz, qwx));
+	out[8] = _mm_sub_ps(One, _mm_mul_ps(Two, _mm_add_ps(qxx, qyy)));
+}
+
+// Computes the components of mat4_cast(q), out[c * 4 + r] receives row r of column c
+GLM_FUNC_QUALIFIER void glm_quat_soa4_mat4(glm_vec4 const q[4], glm_vec4 out[16])
+{
+	glm_vec4 m[9];
+	glm_quat_soa4_mat3(q, m);
+
+	glm_vec4 const Zero = _mm_setzero_ps();
+	out[0] = m[0];
+	out[1] = m[1];
+	out[2] = m[2];
+	out[3] = Zero;
+	out[4] = m[3];
+	out[5] = m[4];
+	out[6] = m[5];
+	out[7] = Zero;
+	out[8] = m[6];
+	out[9] = m[7];
+	out[10] = m[8];
+	out[11] = Zero;
+	out[12] = Zero;
+	out[13] = Zero;
+	out[14] = Zero;
+	out[15] = _mm_set1_ps(1.0f);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// Transposes the 4x4 blocks held in the low and high halves of 4 registers
+GLM_FUNC_QUALIFIER void glm_vec8_transpose4(glm_f32vec8 const in[4], glm_f32vec8 out[4])
+{
+	glm_f32vec8 const T0 = _mm256_unpacklo_ps(in[0], in[1]);
+	glm_f32vec8 const T1 = _mm256_unpackhi_ps(in[0], in[1]);
+	glm_f32vec8 const T2 = _mm256_unpacklo_ps(in[2], in[3]);
+	glm_f32vec8 const T3 = _mm256_unpackhi_ps(in[2], in[3]);
+
+	out[0] = _mm256_shuffle_ps(T0, T2, _MM_SHUFFLE(1, 0, 1, 0));
+	out[1] = _mm256_shuffle_ps(T0, T2, _MM_SHUFFLE(3, 2, 3, 2));
+	out[2] = _mm256_shuffle_ps(T1, T3, _MM_SHUFFLE(1, 0, 1, 0));
+	out[3] = _mm256_shuffle_ps(T1, T3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// Loads a register from two 128-bit halves
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_loadu2(float const* lo, float const* hi)
+{
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+}
+
+// Stores the two 128-bit halves of a register
+GLM_FUNC_QUALIFIER void glm_vec8_storeu2(float* lo, float* hi, glm_f32vec8 v)
+{
+	_mm_storeu_ps(lo, _mm256_castps256_ps128(v));
+	_mm_storeu_ps(hi, _mm256_extractf128_ps(v, 1));
+}
+
+// 8 lanes variant of glm_quat_soa4_load
+GLM_FUNC_QUALIFIER void glm_quat_soa8_load(float const* in, glm_f32vec8 out[4])
+{
+	glm_f32vec8 Q[4];
+	Q[0] = glm_vec8_loadu2(in + 0, in + 16);
+	Q[1] = glm_vec8_loadu2(in + 4, in + 20);
+	Q[2] = glm_vec8_loadu2(in + 8, in + 24);
+	Q[3] = glm_vec8_loadu2(in + 12, in + 28);
+
+#	ifdef GLM_FORCE_QUAT_DATA_WXYZ
+		glm_f32vec8 T[4];
+		glm_vec8_transpose4(Q, T);
+		out[0] = T[1];
+		out[1] = T[2];
+		out[2] = T[3];
+		out[3] = T[0];
+#	else
+		glm_vec8_transpose4(Q, out);
+#	endif
+}
+
+// 8 lanes variant of glm_quat_soa4_store
+GLM_FUNC_QUALIFIER void glm_quat_soa8_store(glm_f32vec8 const in[4], float* out)
+{
+	glm_f32vec8 Q[4];
+#	ifdef GLM_FORCE_QUAT_DATA_WXYZ
+		glm_f32vec8 T[4];
+		T[0] = in[3];
+		T[1] = in[0];
+		T[2] = in[1];
+		T[3] = in[2];
+		glm_vec8_transpose4(T, Q);
+#	else
+		glm_vec8_transpose4(in, Q);
+#	endif
+
+	glm_vec8_storeu2(out + 0, out + 16, Q[0]);
+	glm_vec8_storeu2(out + 4, out + 20, Q[1]);
+	glm_vec8_storeu2(out + 8, out + 24, Q[2]);
+	glm_vec8_storeu2(out + 12, out + 28, Q[3]);
+}
+
+// 8 lanes variant of glm_mat3_soa4_store
+GLM_FUNC_QUALIFIER void glm_mat3_soa8_store(glm_f32vec8 const in[9], float* out)
+{
+	glm_f32vec8 Lo[4];
+	glm_f32vec8 Hi[4];
+	glm_vec8_transpose4(in + 0, Lo);
+	glm_vec8_transpose4(in + 4, Hi);
+
+	glm_vec8_storeu2(out + 0, out + 36, Lo[0]);
+	glm_vec8_storeu2(out + 4, out + 40, Hi[0]);
+	glm_vec8_storeu2(out + 9, out + 45, Lo[1]);
+	glm_vec8_storeu2(out + 13, out + 49, Hi[1]);
+	glm_vec8_storeu2(out + 18, out + 54, Lo[2]);
+	glm_vec8_storeu2(out + 22, out + 58, Hi[2]);
+	glm_vec8_storeu2(out + 27, out + 63, Lo[3]);
+	glm_vec8_storeu2(out + 31, out + 67, Hi[3]);
+
+	float Last[8];
+	_mm256_storeu_ps(Last, in[8]);
+	for(int i = 0; i < 8; ++i)
+		out[i * 9 + 8] = Last[i];
+}
+
+// 8 lanes variant of glm_mat4_soa4_store_column
+GLM_FUNC_QUALIFIER void glm_mat4_soa8_store_column(glm_f32vec8 const in[4], float* out)
+{
+	glm_f32vec8 Columns[4];
+	glm_vec8_transpose4(in, Columns);
+
+	glm_vec8_storeu2(out + 0, out + 64, Columns[0]);
+	glm_vec8_storeu2(out + 16, out + 80, Columns[1]);
+	glm_vec8_storeu2(out + 32, out + 96, Columns[2]);
+	glm_vec8_storeu2(out + 48, out + 112, Columns[3]);
+}
+
+// 8 lanes variant of glm_mat4_soa4_store
+GLM_FUNC_QUALIFIER void glm_mat4_soa8_store(glm_f32vec8 const in[16], float* out)
+{
+	glm_mat4_soa8_store_column(in + 0, out + 0);
+	glm_mat4_soa8_store_column(in + 4, out + 4);
+	glm_mat4_soa8_store_column(in + 8, out + 8);
+	glm_mat4_soa8_store_column(in + 12, out + 12);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_quat_soa8_shortest(glm_f32vec8 const x[4], glm_f32vec8 const y[4], glm_f32vec8 z[4])
+{
+	glm_f32vec8 const Dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x[3], y[3]), _mm256_mul_ps(x[0], y[0])), _mm256_add_ps(_mm256_mul_ps(x[1], y[1]), _mm256_mul_ps(x[2], y[2])));
+	glm_f32vec8 const Sign = _mm256_and_ps(_mm256_cmp_ps(Dot, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(-0.0f));
+
+	z[0] = _mm256_xor_ps(y[0], Sign);
+	z[1] = _mm256_xor_ps(y[1], Sign);
+	z[2] = _mm256_xor_ps(y[2], Sign);
+	z[3] = _mm256_xor_ps(y[3], Sign);
+	return _mm256_xor_ps(Dot, Sign);
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa8_slerp(glm_f32vec8 const x[4], glm_f32vec8 const y[4], glm_f32vec8 a, glm_f32vec8 out[4])
+{
+	glm_f32vec8 z[4];
+	glm_f32vec8 const CosTheta = glm_quat_soa8_shortest(x, y, z);
+	glm_f32vec8 const One = _mm256_set1_ps(1.0f);
+	glm_f32vec8 const OneMinusA = _mm256_sub_ps(One, a);
+
+	glm_f32vec8 const Linear = _mm256_cmp_ps(CosTheta, _mm256_set1_ps(1.0f - 1.1920928955078125e-7f), _CMP_GT_OQ);
+
+	glm_f32vec8 const Angle = glm_vec8_acos(CosTheta);
+	glm_f32vec8 const SinAngle = _mm256_sqrt_ps(_mm256_mul_ps(_mm256_sub_ps(One, CosTheta), _mm256_add_ps(One, CosTheta)));
+	glm_f32vec8 const Sin0 = glm_vec8_sin(_mm256_mul_ps(OneMinusA, Angle));
+	glm_f32vec8 const Sin1 = glm_vec8_sin(_mm256_mul_ps(a, Angle));
+
+	glm_f32vec8 const Lerp0 = _mm256_add_ps(_mm256_mul_ps(x[0], OneMinusA), _mm256_mul_ps(z[0], a));
+	glm_f32vec8 const Slerp0 = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(Sin0, x[0]), _mm256_mul_ps(Sin1, z[0])), SinAngle);
+	out[0] = _mm256_blendv_ps(Slerp0, Lerp0, Linear);
+
+	glm_f32vec8 const Lerp1 = _mm256_add_ps(_mm256_mul_ps(x[1], OneMinusA), _mm256_mul_ps(z[1], a));
+	glm_f32vec8 const Slerp1 = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(Sin0, x[1]), _mm256_mul_ps(Sin1, z[1])), SinAngle);
+	out[1] = _mm256_blendv_ps(Slerp1, Lerp1, Linear);
+
+	glm_f32vec8 const Lerp2 = _mm256_add_ps(_mm256_mul_ps(x[2], OneMinusA), _mm256_mul_ps(z[2], a));
+	glm_f32vec8 const Slerp2 = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(Sin0, x[2]), _mm256_mul_ps(Sin1, z[2])), SinAngle);
+	out[2] = _mm256_blendv_ps(Slerp2, Lerp2, Linear);
+
+	glm_f32vec8 const Lerp3 = _mm256_add_ps(_mm256_mul_ps(x[3], OneMinusA), _mm256_mul_ps(z[3], a));
+	glm_f32vec8 const Slerp3 = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(Sin0, x[3]), _mm256_mul_ps(Sin1, z[3])), SinAngle);
+	out[3] = _mm256_blendv_ps(Slerp3, Lerp3, Linear);
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa8_nlerp(glm_f32vec8 const x[4], glm_f32vec8 const y[4], glm_f32vec8 a, glm_f32vec8 out[4])
+{
+	glm_f32vec8 z[4];
+	glm_quat_soa8_shortest(x, y, z);
+	glm_f32vec8 const OneMinusA = _mm256_sub_ps(_mm256_set1_ps(1.0f), a);
+
+	glm_f32vec8 r[4];
+	r[0] = _mm256_add_ps(_mm256_mul_ps(x[0], OneMinusA), _mm256_mul_ps(z[0], a));
+	r[1] = _mm256_add_ps(_mm256_mul_ps(x[1], OneMinusA), _mm256_mul_ps(z[1], a));
+	r[2] = _mm256_add_ps(_mm256_mul_ps(x[2], OneMinusA), _mm256_mul_ps(z[2], a));
+	r[3] = _mm256_add_ps(_mm256_mul_ps(x[3], OneMinusA), _mm256_mul_ps(z[3], a));
+
+	glm_f32vec8 const Length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(r[3], r[3]), _mm256_mul_ps(r[0], r[0])), _mm256_add_ps(_mm256_mul_ps(r[1], r[1]), _mm256_mul_ps(r[2], r[2]))));
+	glm_f32vec8 const OneOverLength = _mm256_div_ps(_mm256_set1_ps(1.0f), Length);
+
+	glm_f32vec8 const Zero = _mm256_cmp_ps(Length, _mm256_setzero_ps(), _CMP_LE_OQ);
+	out[0] = _mm256_blendv_ps(_mm256_mul_ps(r[0], OneOverLength), _mm256_setzero_ps(), Zero);
+	out[1] = _mm256_blendv_ps(_mm256_mul_ps(r[1], OneOverLength), _mm256_setzero_ps(), Zero);
+	out[2] = _mm256_blendv_ps(_mm256_mul_ps(r[2], OneOverLength), _mm256_setzero_ps(), Zero);
+	out[3] = _mm256_blendv_ps(_mm256_mul_ps(r[3], OneOverLength), _mm256_set1_ps(1.0f), Zero);
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa8_rotate(glm_f32vec8 const q[4], glm_f32vec8 const v[3], glm_f32vec8 out[3])
+{
+	glm_f32vec8 const uv0 = _mm256_sub_ps(_mm256_mul_ps(q[1], v[2]), _mm256_mul_ps(v[1], q[2]));
+	glm_f32vec8 const uv1 = _mm256_sub_ps(_mm256_mul_ps(q[2], v[0]), _mm256_mul_ps(v[2], q[0]));
+	glm_f32vec8 const uv2 = _mm256_sub_ps(_mm256_mul_ps(q[0], v[1]), _mm256_mul_ps(v[0], q[1]));
+
+	glm_f32vec8 const uuv0 = _mm256_sub_ps(_mm256_mul_ps(q[1], uv2), _mm256_mul_ps(uv1, q[2]));
+	glm_f32vec8 const uuv1 = _mm256_sub_ps(_mm256_mul_ps(q[2], uv0), _mm256_mul_ps(uv2, q[0]));
+	glm_f32vec8 const uuv2 = _mm256_sub_ps(_mm256_mul_ps(q[0], uv1), _mm256_mul_ps(uv0, q[1]));
+
+	glm_f32vec8 const Two = _mm256_set1_ps(2.0f);
+	out[0] = _mm256_add_ps(v[0], _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(uv0, q[3]), uuv0), Two));
+	out[1] = _mm256_add_ps(v[1], _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(uv1, q[3]), uuv1), Two));
+	out[2] = _mm256_add_ps(v[2], _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(uv2, q[3]), uuv2), Two));
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa8_mat3(glm_f32vec8 const q[4], glm_f32vec8 out[9])
+{
+	glm_f32vec8 const qxx = _mm256_mul_ps(q[0], q[0]);
+	glm_f32vec8 const qyy = _mm256_mul_ps(q[1], q[1]);
+	glm_f32vec8 const qzz = _mm256_mul_ps(q[2], q[2]);
+	glm_f32vec8 const qxz = _mm256_mul_ps(q[0], q[2]);
+	glm_f32vec8 const qxy = _mm256_mul_ps(q[0], q[1]);
+	glm_f32vec8 const qyz = _mm256_mul_ps(q[1], q[2]);
+	glm_f32vec8 const qwx = _mm256_mul_ps(q[3], q[0]);
+	glm_f32vec8 const qwy = _mm256_mul_ps(q[3], q[1]);
+	glm_f32vec8 const qwz = _mm256_mul_ps(q[3], q[2]);
+
+	glm_f32vec8 const One = _mm256_set1_ps(1.0f);
+	glm_f32vec8 const Two = _mm256_set1_ps(2.0f);
+
+	out[0] = _mm256_sub_ps(One, _mm256_mul_ps(Two, _mm256_add_ps(qyy, qzz)));
+	out[1] = _mm256_mul_ps(Two, _mm256_add_ps(qxy, qwz));
+	out[2] = _mm256_mul_ps(Two, _mm256_sub_ps(qxz, qwy));
+
+	out[3] = _mm256_mul_ps(Two, _mm256_sub_ps(qxy, qwz));
+	out[4] = _mm256_sub_ps(One, _mm256_mul_ps(Two, _mm256_add_ps(qxx, qzz)));
+	out[5] = _mm256_mul_ps(Two, _mm256_add_ps(qyz, qwx));
+
+	out[6] = _mm256_mul_ps(Two, _mm256_add_ps(qxz, qwy));
+	out[7] = _mm256_mul_ps(Two, _mm256_sub_ps(qyz, qwx));
+	out[8] = _mm256_sub_ps(One, _mm256_mul_ps(Two, _mm256_add_ps(qxx, qyy)));
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa8_mat4(glm_f32vec8 const q[4], glm_f32vec8 out[16])
+{
+	glm_f32vec8 m[9];
+	glm_quat_soa8_mat3(q, m);
+
+	glm_f32vec8 const Zero = _mm256_setzero_ps();
+	out[0] = m[0];
+	out[1] = m[1];
+	out[2] = m[2];
+	out[3] = Zero;
+	out[4] = m[3];
+	out[5] = m[4];
+	out[6] = m[5];
+	out[7] = Zero;
+	out[8] = m[6];
+	out[9] = m[7];
+	out[10] = m[8];
+	out[11] = Zero;
+	out[12] = Zero;
+	out[13] = Zero;
+	out[14] = Zero;
+	out[15] = _mm256_set1_ps(1.0f);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+	// GCC 12 reports the _mm512_undefined_ps used by AVX-512 intrinsics as uninitialized, bug 105593
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wuninitialized"
+#	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// Transposes the 4x4 matrix of 128-bit blocks held by 4 registers
+GLM_FUNC_QUALIFIER void glm_vec16_transpose_blocks(glm_f32vec16 const in[4], glm_f32vec16 out[4])
+{
+	glm_f32vec16 const T0 = _mm512_shuffle_f32x4(in[0], in[1], _MM_SHUFFLE(1, 0, 1, 0));
+	glm_f32vec16 const T1 = _mm512_shuffle_f32x4(in[0], in[1], _MM_SHUFFLE(3, 2, 3, 2));
+	glm_f32vec16 const T2 = _mm512_shuffle_f32x4(in[2], in[3], _MM_SHUFFLE(1, 0, 1, 0));
+	glm_f32vec16 const T3 = _mm512_shuffle_f32x4(in[2], in[3], _MM_SHUFFLE(3, 2, 3, 2));
+
+	out[0] = _mm512_shuffle_f32x4(T0, T2, _MM_SHUFFLE(2, 0, 2, 0));
+	out[1] = _mm512_shuffle_f32x4(T0, T2, _MM_SHUFFLE(3, 1, 3, 1));
+	out[2] = _mm512_shuffle_f32x4(T1, T3, _MM_SHUFFLE(2, 0, 2, 0));
+	out[3] = _mm512_shuffle_f32x4(T1, T3, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+// Transposes the 4x4 matrices held in each 128-bit block of 4 registers
+GLM_FUNC_QUALIFIER void glm_vec16_transpose4(glm_f32vec16 const in[4], glm_f32vec16 out[4])
+{
+	glm_f32vec16 const T0 = _mm512_unpacklo_ps(in[0], in[1]);
+	glm_f32vec16 const T1 = _mm512_unpackhi_ps(in[0], in[1]);
+	glm_f32vec16 const T2 = _mm512_unpacklo_ps(in[2], in[3]);
+	glm_f32vec16 const T3 = _mm512_unpackhi_ps(in[2], in[3]);
+
+	out[0] = _mm512_shuffle_ps(T0, T2, _MM_SHUFFLE(1, 0, 1, 0));
+	out[1] = _mm512_shuffle_ps(T0, T2, _MM_SHUFFLE(3, 2, 3, 2));
+	out[2] = _mm512_shuffle_ps(T1, T3, _MM_SHUFFLE(1, 0, 1, 0));
+	out[3] = _mm512_shuffle_ps(T1, T3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// Stores the four 128-bit blocks of a register, block b at out + b * stride
+GLM_FUNC_QUALIFIER void glm_vec16_storeu4(float* out, int stride, glm_f32vec16 v)
+{
+	_mm_storeu_ps(out, _mm512_castps512_ps128(v));
+	_mm_storeu_ps(out + stride, _mm512_extractf32x4_ps(v, 1));
+	_mm_storeu_ps(out + stride * 2, _mm512_extractf32x4_ps(v, 2));
+	_mm_storeu_ps(out + stride * 3, _mm512_extractf32x4_ps(v, 3));
+}
+
+// 16 lanes variant of glm_quat_soa4_load
+GLM_FUNC_QUALIFIER void glm_quat_soa16_load(float const* in, glm_f32vec16 out[4])
+{
+	glm_f32vec16 Q[4];
+	Q[0] = _mm512_loadu_ps(in + 0);
+	Q[1] = _mm512_loadu_ps(in + 16);
+	Q[2] = _mm512_loadu_ps(in + 32);
+	Q[3] = _mm512_loadu_ps(in + 48);
+
+	// Register i receives quaternions i, i + 4, i + 8 and i + 12 so that lanes follow the quaternion order
+	glm_f32vec16 B[4];
+	glm_vec16_transpose_blocks(Q, B);
+
+#	ifdef GLM_FORCE_QUAT_DATA_WXYZ
+		glm_f32vec16 T[4];
+		glm_vec16_transpose4(B, T);
+		out[0] = T[1];
+		out[1] = T[2];
+		out[2] = T[3];
+		out[3] = T[0];
+#	else
+		glm_vec16_transpose4(B, out);
+#	endif
+}
+
+// 16 lanes variant of glm_quat_soa4_store
+GLM_FUNC_QUALIFIER void glm_quat_soa16_store(glm_f32vec16 const in[4], float* out)
+{
+	glm_f32vec16 B[4];
+#	ifdef GLM_FORCE_QUAT_DATA_WXYZ
+		glm_f32vec16 T[4];
+		T[0] = in[3];
+		T[1] = in[0];
+		T[2] = in[1];
+		T[3] = in[2];
+		glm_vec16_transpose4(T, B);
+#	else
+		glm_vec16_transpose4(in, B);
+#	endif
+
+	glm_f32vec16 Q[4];
+	glm_vec16_transpose_blocks(B, Q);
+
+	_mm512_storeu_ps(out + 0, Q[0]);
+	_mm512_storeu_ps(out + 16, Q[1]);
+	_mm512_storeu_ps(out + 32, Q[2]);
+	_mm512_storeu_ps(out + 48, Q[3]);
+}
+
+// Loads 16 packed vec3 as x, y and z lanes
+GLM_FUNC_QUALIFIER void glm_vec3x16_load(float const* in, glm_f32vec16 out[3])
+{
+	glm_f32vec8 Lo[3];
+	glm_f32vec8 Hi[3];
+	glm_vec3x8_load(in, Lo);
+	glm_vec3x8_load(in + 24, Hi);
+
+	out[0] = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(Lo[0])), _mm256_castps_pd(Hi[0]), 1));
+	out[1] = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(Lo[1])), _mm256_castps_pd(Hi[1]), 1));
+	out[2] = _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(Lo[2])), _mm256_castps_pd(Hi[2]), 1));
+}
+
+// Interleaves x, y and z lanes back into 16 packed vec3
+GLM_FUNC_QUALIFIER void glm_vec3x16_store(glm_f32vec16 const in[3], float* out)
+{
+	glm_f32vec8 Lo[3];
+	Lo[0] = _mm512_castps512_ps256(in[0]);
+	Lo[1] = _mm512_castps512_ps256(in[1]);
+	Lo[2] = _mm512_castps512_ps256(in[2]);
+
+	glm_f32vec8 Hi[3];
+	Hi[0] = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(in[0]), 1));
+	Hi[1] = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(in[1]), 1));
+	Hi[2] = _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(in[2]), 1));
+
+	glm_vec3x8_store(Lo, out);
+	glm_vec3x8_store(Hi, out + 24);
+}
+
+// 16 lanes variant of glm_mat3_soa4_store
+GLM_FUNC_QUALIFIER void glm_mat3_soa16_store(glm_f32vec16 const in[9], float* out)
+{
+	glm_f32vec16 Lo[4];
+	glm_f32vec16 Hi[4];
+	glm_vec16_transpose4(in + 0, Lo);
+	glm_vec16_transpose4(in + 4, Hi);
+
+	glm_vec16_storeu4(out + 0, 36, Lo[0]);
+	glm_vec16_storeu4(out + 4, 36, Hi[0]);
+	glm_vec16_storeu4(out + 9, 36, Lo[1]);
+	glm_vec16_storeu4(out + 13, 36, Hi[1]);
+	glm_vec16_storeu4(out + 18, 36, Lo[2]);
+	glm_vec16_storeu4(out + 22, 36, Hi[2]);
+	glm_vec16_storeu4(out + 27, 36, Lo[3]);
+	glm_vec16_storeu4(out + 31, 36, Hi[3]);
+
+	float Last[16];
+	_mm512_storeu_ps(Last, in[8]);
+	for(int i = 0; i < 16; ++i)
+		out[i * 9 + 8] = Last[i];
+}
+
+// 16 lanes variant of glm_mat4_soa4_store_column
+GLM_FUNC_QUALIFIER void glm_mat4_soa16_store_column(glm_f32vec16 const in[4], float* out)
+{
+	glm_f32vec16 Columns[4];
+	glm_vec16_transpose4(in, Columns);
+
+	glm_vec16_storeu4(out + 0, 64, Columns[0]);
+	glm_vec16_storeu4(out + 16, 64, Columns[1]);
+	glm_vec16_storeu4(out + 32, 64, Columns[2]);
+	glm_vec16_storeu4(out + 48, 64, Columns[3]);
+}
+
+// 16 lanes variant of glm_mat4_soa4_store
+GLM_FUNC_QUALIFIER void glm_mat4_soa16_store(glm_f32vec16 const in[16], float* out)
+{
+	glm_mat4_soa16_store_column(in + 0, out + 0);
+	glm_mat4_soa16_store_column(in + 4, out + 4);
+	glm_mat4_soa16_store_column(in + 8, out + 8);
+	glm_mat4_soa16_store_column(in + 12, out + 12);
+}
+
+// Negates the lanes of v selected by Mask
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_vec16_negate_mask(__mmask16 Mask, glm_f32vec16 v)
+{
+	return _mm512_castsi512_ps(_mm512_mask_xor_epi32(_mm512_castps_si512(v), Mask, _mm512_castps_si512(v), _mm512_set1_epi32(static_cast<int>(0x80000000))));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_quat_soa16_shortest(glm_f32vec16 const x[4], glm_f32vec16 const y[4], glm_f32vec16 z[4])
+{
+	glm_f32vec16 const Dot = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(x[3], y[3]), _mm512_mul_ps(x[0], y[0])), _mm512_add_ps(_mm512_mul_ps(x[1], y[1]), _mm512_mul_ps(x[2], y[2])));
+	__mmask16 const Negative = _mm512_cmp_ps_mask(Dot, _mm512_setzero_ps(), _CMP_LT_OQ);
+
+	z[0] = glm_vec16_negate_mask(Negative, y[0]);
+	z[1] = glm_vec16_negate_mask(Negative, y[1]);
+	z[2] = glm_vec16_negate_mask(Negative, y[2]);
+	z[3] = glm_vec16_negate_mask(Negative, y[3]);
+	return glm_vec16_negate_mask(Negative, Dot);
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa16_slerp(glm_f32vec16 const x[4], glm_f32vec16 const y[4], glm_f32vec16 a, glm_f32vec16 out[4])
+{
+	glm_f32vec16 z[4];
+	glm_f32vec16 const CosTheta = glm_quat_soa16_shortest(x, y, z);
+	glm_f32vec16 const One = _mm512_set1_ps(1.0f);
+	glm_f32vec16 const OneMinusA = _mm512_sub_ps(One, a);
+
+	__mmask16 const Linear = _mm512_cmp_ps_mask(CosTheta, _mm512_set1_ps(1.0f - 1.1920928955078125e-7f), _CMP_GT_OQ);
+
+	glm_f32vec16 const Angle = glm_vec16_acos(CosTheta);
+	glm_f32vec16 const SinAngle = _mm512_sqrt_ps(_mm512_mul_ps(_mm512_sub_ps(One, CosTheta), _mm512_add_ps(One, CosTheta)));
+	glm_f32vec16 const Sin0 = glm_vec16_sin(_mm512_mul_ps(OneMinusA, Angle));
+	glm_f32vec16 const Sin1 = glm_vec16_sin(_mm512_mul_ps(a, Angle));
+
+	glm_f32vec16 const Lerp0 = _mm512_add_ps(_mm512_mul_ps(x[0], OneMinusA), _mm512_mul_ps(z[0], a));
+	glm_f32vec16 const Slerp0 = _mm512_div_ps(_mm512_add_ps(_mm512_mul_ps(Sin0, x[0]), _mm512_mul_ps(Sin1, z[0])), SinAngle);
+	out[0] = _mm512_mask_blend_ps(Linear, Slerp0, Lerp0);
+
+	glm_f32vec16 const Lerp1 = _mm512_add_ps(_mm512_mul_ps(x[1], OneMinusA), _mm512_mul_ps(z[1], a));
+	glm_f32vec16 const Slerp1 = _mm512_div_ps(_mm512_add_ps(_mm512_mul_ps(Sin0, x[1]), _mm512_mul_ps(Sin1, z[1])), SinAngle);
+	out[1] = _mm512_mask_blend_ps(Linear, Slerp1, Lerp1);
+
+	glm_f32vec16 const Lerp2 = _mm512_add_ps(_mm512_mul_ps(x[2], OneMinusA), _mm512_mul_ps(z[2], a));
+	glm_f32vec16 const Slerp2 = _mm512_div_ps(_mm512_add_ps(_mm512_mul_ps(Sin0, x[2]), _mm512_mul_ps(Sin1, z[2])), SinAngle);
+	out[2] = _mm512_mask_blend_ps(Linear, Slerp2, Lerp2);
+
+	glm_f32vec16 const Lerp3 = _mm512_add_ps(_mm512_mul_ps(x[3], OneMinusA), _mm512_mul_ps(z[3], a));
+	glm_f32vec16 const Slerp3 = _mm512_div_ps(_mm512_add_ps(_mm512_mul_ps(Sin0, x[3]), _mm512_mul_ps(Sin1, z[3])), SinAngle);
+	out[3] = _mm512_mask_blend_ps(Linear, Slerp3, Lerp3);
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa16_nlerp(glm_f32vec16 const x[4], glm_f32vec16 const y[4], glm_f32vec16 a, glm_f32vec16 out[4])
+{
+	glm_f32vec16 z[4];
+	glm_quat_soa16_shortest(x, y, z);
+	glm_f32vec16 const OneMinusA = _mm512_sub_ps(_mm512_set1_ps(1.0f), a);
+
+	glm_f32vec16 r[4];
+	r[0] = _mm512_add_ps(_mm512_mul_ps(x[0], OneMinusA), _mm512_mul_ps(z[0], a));
+	r[1] = _mm512_add_ps(_mm512_mul_ps(x[1], OneMinusA), _mm512_mul_ps(z[1], a));
+	r[2] = _mm512_add_ps(_mm512_mul_ps(x[2], OneMinusA), _mm512_mul_ps(z[2], a));
+	r[3] = _mm512_add_ps(_mm512_mul_ps(x[3], OneMinusA), _mm512_mul_ps(z[3], a));
+
+	glm_f32vec16 const Length = _mm512_sqrt_ps(_mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(r[3], r[3]), _mm512_mul_ps(r[0], r[0])), _mm512_add_ps(_mm512_mul_ps(r[1], r[1]), _mm512_mul_ps(r[2], r[2]))));
+	glm_f32vec16 const OneOverLength = _mm512_div_ps(_mm512_set1_ps(1.0f), Length);
+
+	__mmask16 const Zero = _mm512_cmp_ps_mask(Length, _mm512_setzero_ps(), _CMP_LE_OQ);
+	out[0] = _mm512_mask_blend_ps(Zero, _mm512_mul_ps(r[0], OneOverLength), _mm512_setzero_ps());
+	out[1] = _mm512_mask_blend_ps(Zero, _mm512_mul_ps(r[1], OneOverLength), _mm512_setzero_ps());
+	out[2] = _mm512_mask_blend_ps(Zero, _mm512_mul_ps(r[2], OneOverLength), _mm512_setzero_ps());
+	out[3] = _mm512_mask_blend_ps(Zero, _mm512_mul_ps(r[3], OneOverLength), _mm512_set1_ps(1.0f));
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa16_rotate(glm_f32vec16 const q[4], glm_f32vec16 const v[3], glm_f32vec16 out[3])
+{
+	glm_f32vec16 const uv0 = _mm512_sub_ps(_mm512_mul_ps(q[1], v[2]), _mm512_mul_ps(v[1], q[2]));
+	glm_f32vec16 const uv1 = _mm512_sub_ps(_mm512_mul_ps(q[2], v[0]), _mm512_mul_ps(v[2], q[0]));
+	glm_f32vec16 const uv2 = _mm512_sub_ps(_mm512_mul_ps(q[0], v[1]), _mm512_mul_ps(v[0], q[1]));
+
+	glm_f32vec16 const uuv0 = _mm512_sub_ps(_mm512_mul_ps(q[1], uv2), _mm512_mul_ps(uv1, q[2]));
+	glm_f32vec16 const uuv1 = _mm512_sub_ps(_mm512_mul_ps(q[2], uv0), _mm512_mul_ps(uv2, q[0]));
+	glm_f32vec16 const uuv2 = _mm512_sub_ps(_mm512_mul_ps(q[0], uv1), _mm512_mul_ps(uv0, q[1]));
+
+	glm_f32vec16 const Two = _mm512_set1_ps(2.0f);
+	out[0] = _mm512_add_ps(v[0], _mm512_mul_ps(_mm512_add_ps(_mm512_mul_ps(uv0, q[3]), uuv0), Two));
+	out[1] = _mm512_add_ps(v[1], _mm512_mul_ps(_mm512_add_ps(_mm512_mul_ps(uv1, q[3]), uuv1), Two));
+	out[2] = _mm512_add_ps(v[2], _mm512_mul_ps(_mm512_add_ps(_mm512_mul_ps(uv2, q[3]), uuv2), Two));
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa16_mat3(glm_f32vec16 const q[4], glm_f32vec16 out[9])
+{
+	glm_f32vec16 const qxx = _mm512_mul_ps(q[0], q[0]);
+	glm_f32vec16 const qyy = _mm512_mul_ps(q[1], q[1]);
+	glm_f32vec16 const qzz = _mm512_mul_ps(q[2], q[2]);
+	glm_f32vec16 const qxz = _mm512_mul_ps(q[0], q[2]);
+	glm_f32vec16 const qxy = _mm512_mul_ps(q[0], q[1]);
+	glm_f32vec16 const qyz = _mm512_mul_ps(q[1], q[2]);
+	glm_f32vec16 const qwx = _mm512_mul_ps(q[3], q[0]);
+	glm_f32vec16 const qwy = _mm512_mul_ps(q[3], q[1]);
+	glm_f32vec16 const qwz = _mm512_mul_ps(q[3], q[2]);
+
+	glm_f32vec16 const One = _mm512_set1_ps(1.0f);
+	glm_f32vec16 const Two = _mm512_set1_ps(2.0f);
+
+	out[0] = _mm512_sub_ps(One, _mm512_mul_ps(Two, _mm512_add_ps(qyy, qzz)));
+	out[1] = _mm512_mul_ps(Two, _mm512_add_ps(qxy, qwz));
+	out[2] = _mm512_mul_ps(Two, _mm512_sub_ps(qxz, qwy));
+
+	out[3] = _mm512_mul_ps(Two, _mm512_sub_ps(qxy, qwz));
+	out[4] = _mm512_sub_ps(One, _mm512_mul_ps(Two, _mm512_add_ps(qxx, qzz)));
+	out[5] = _mm512_mul_ps(Two, _mm512_add_ps(qyz, qwx));
+
+	out[6] = _mm512_mul_ps(Two, _mm512_add_ps(qxz, qwy));
+	out[7] = _mm512_mul_ps(Two, _mm512_sub_ps(qyz, qwx));
+	out[8] = _mm512_sub_ps(One, _mm512_mul_ps(Two, _mm512_add_ps(qxx, qyy)));
+}
+
+GLM_FUNC_QUALIFIER void glm_quat_soa16_mat4(glm_f32vec16 const q[4], glm_f32vec16 out[16])
+{
+	glm_f32vec16 m[9];
+	glm_quat_soa16_mat3(q, m);
+
+	glm_f32vec16 const Zero = _mm512_setzero_ps();
+	out[0] = m[0];
+	out[1] = m[1];
+	out[2] = m[2];
+	out[3] = Zero;
+	out[4] = m[3];
+	out[5] = m[4];
+	out[6] = m[5];
+	out[7] = Zero;
+	out[8] = m[6];
+	out[9] = m[7];
+	out[10] = m[8];
+	out[11] = Zero;
+	out[12] = Zero;
+	out[13] = Zero;
+	out[14] = Zero;
+	out[15] = _mm512_set1_ps(1.0f);
+}
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC diagnostic pop
+#endif
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
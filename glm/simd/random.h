@@ -0,0 +1,63 @@
+/// @ref simd
+/// @file glm/simd/random.h
+
+#pragma once
+
+#include "platform.h"
+
+// Kernels of the xoshiro128x8 engine of GLM_GTC_random. Each lane runs its own xoshiro128++
+// sequence, word w of the states of the lanes being held in s[w].
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+// Returns the next value of the 4 lanes and advances their states
+GLM_FUNC_QUALIFIER glm_u32vec4 glm_xoshiro128pp_soa4(glm_u32vec4 s[4])
+{
+	glm_u32vec4 const Sum = _mm_add_epi32(s[0], s[3]);
+	glm_u32vec4 const Result = _mm_add_epi32(_mm_or_si128(_mm_slli_epi32(Sum, 7), _mm_srli_epi32(Sum, 25)), s[0]);
+	glm_u32vec4 const t = _mm_slli_epi32(s[1], 9);
+
+	s[2] = _mm_xor_si128(s[2], s[0]);
+	s[3] = _mm_xor_si128(s[3], s[1]);
+	s[1] = _mm_xor_si128(s[1], s[2]);
+	s[0] = _mm_xor_si128(s[0], s[3]);
+	s[2] = _mm_xor_si128(s[2], t);
+	s[3] = _mm_or_si128(_mm_slli_epi32(s[3], 11), _mm_srli_epi32(s[3], 21));
+
+	return Result;
+}
+
+// Maps the 24 most significant bits of x to [0, 1)
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_u32vec4_unorm24(glm_u32vec4 x)
+{
+	return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(x, 8)), _mm_set1_ps(1.0f / 16777216.0f));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// Returns the next value of the 8 lanes and advances their states
+GLM_FUNC_QUALIFIER glm_u32vec8 glm_xoshiro128pp_soa8(glm_u32vec8 s[4])
+{
+	glm_u32vec8 const Sum = _mm256_add_epi32(s[0], s[3]);
+	glm_u32vec8 const Result = _mm256_add_epi32(_mm256_or_si256(_mm256_slli_epi32(Sum, 7), _mm256_srli_epi32(Sum, 25)), s[0]);
+	glm_u32vec8 const t = _mm256_slli_epi32(s[1], 9);
+
+	s[2] = _mm256_xor_si256(s[2], s[0]);
+	s[3] = _mm256_xor_si256(s[3], s[1]);
+	s[1] = _mm256_xor_si256(s[1], s[2]);
+	s[0] = _mm256_xor_si256(s[0], s[3]);
+	s[2] = _mm256_xor_si256(s[2], t);
+	s[3] = _mm256_or_si256(_mm256_slli_epi32(s[3], 11), _mm256_srli_epi32(s[3], 21));
+
+	return Result;
+}
+
+// Maps the 24 most significant bits of x to [0, 1)
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_u32vec8_unorm24(glm_u32vec8 x)
+{
+	return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(x, 8)), _mm256_set1_ps(1.0f / 16777216.0f));
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
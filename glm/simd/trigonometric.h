@@ -3,7 +3,457 @@
 
 #pragma once
 
+#include "common.h"
+
+// Polynomial approximations derived from the Cephes math library.
+//
+// Single precision, measured against the correctly rounded result:
+// - sin, cos: 2 ULP for |x| <= 64, absolute error below 1e-7 for |x| <= 8192
+// - tan: 4 ULP for |x| <= 64
+// - asin, acos, atan: 2 ULP
+// Double precision, measured against long double std:: functions:
+// - sin, cos: 2 ULP for |x| <= 1048576
+// - tan: 4 ULP for |x| <= 1048576
+//
+// Beyond 8192 (single) and 1048576 (double), the range reduction loses precision:
+// glm_vec4_trig_outside_range and glm_dvec4_trig_outside_range report lanes that must be handled with std:: functions.
+
 #if GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_select(glm_f32vec4 mask, glm_f32vec4 a, glm_f32vec4 b)
+{
+	return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Returns a non-zero value if any lane is out of the range where sin, cos and tan kernels are accurate, infinite or NaN
+GLM_FUNC_QUALIFIER int glm_vec4_trig_outside_range(glm_f32vec4 x)
+{
+	return _mm_movemask_ps(_mm_cmpnle_ps(glm_vec4_abs(x), _mm_set1_ps(8192.0f)));
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_f32vec4 x, glm_f32vec4* s, glm_f32vec4* c)
+{
+	glm_f32vec4 const SignMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000)));
+	glm_f32vec4 const SignX = _mm_and_ps(x, SignMask);
+	glm_f32vec4 const AbsX = _mm_andnot_ps(SignMask, x);
+
+	// Octant j = |x| * 4 / pi rounded up to even so that |r| <= pi / 4
+	glm_i32vec4 j = _mm_cvttps_epi32(_mm_mul_ps(AbsX, _mm_set1_ps(1.27323954473516f)));
+	j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+	glm_f32vec4 const y = _mm_cvtepi32_ps(j);
+
+	// Extended precision modular arithmetic
+	glm_f32vec4 r = glm_vec4_fma(y, _mm_set1_ps(-0.78515625f), AbsX);
+	r = glm_vec4_fma(y, _mm_set1_ps(-2.4187564849853515625e-4f), r);
+	r = glm_vec4_fma(y, _mm_set1_ps(-3.77489497744594108e-8f), r);
+
+	glm_f32vec4 const z = _mm_mul_ps(r, r);
+
+	glm_f32vec4 PolyCos = glm_vec4_fma(_mm_set1_ps(2.443315711809948e-5f), z, _mm_set1_ps(-1.388731625493765e-3f));
+	PolyCos = glm_vec4_fma(PolyCos, z, _mm_set1_ps(4.166664568298827e-2f));
+	PolyCos = glm_vec4_fma(PolyCos, _mm_mul_ps(z, z), glm_vec4_fma(z, _mm_set1_ps(-0.5f), _mm_set1_ps(1.0f)));
+
+	glm_f32vec4 PolySin = glm_vec4_fma(_mm_set1_ps(-1.9515295891e-4f), z, _mm_set1_ps(8.3321608736e-3f));
+	PolySin = glm_vec4_fma(PolySin, z, _mm_set1_ps(-1.6666654611e-1f));
+	PolySin = glm_vec4_fma(PolySin, _mm_mul_ps(z, r), r);
+
+	// Octants 2 and 6 swap the polynomials, sin is negative in octants 4 and 6, cos in octants 2 and 4
+	glm_f32vec4 const Swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+	glm_f32vec4 const SignSin = _mm_xor_ps(SignX, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29)));
+	glm_f32vec4 const SignCos = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+
+	*s = _mm_xor_ps(glm_vec4_select(Swap, PolySin, PolyCos), SignSin);
+	*c = _mm_xor_ps(glm_vec4_select(Swap, PolyCos, PolySin), SignCos);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sin(glm_f32vec4 x)
+{
+	glm_f32vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_cos(glm_f32vec4 x)
+{
+	glm_f32vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_tan(glm_f32vec4 x)
+{
+	glm_f32vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return _mm_div_ps(s, c);
+}
+
+// Evaluates asin(t) for |t| <= 0.5 given z = t * t
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_asin_poly(glm_f32vec4 t, glm_f32vec4 z)
+{
+	glm_f32vec4 p = glm_vec4_fma(_mm_set1_ps(4.2163199048e-2f), z, _mm_set1_ps(2.4181311049e-2f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(4.5470025998e-2f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(7.4953002686e-2f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(1.6666752422e-1f));
+	return glm_vec4_fma(p, _mm_mul_ps(z, t), t);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_asin(glm_f32vec4 x)
+{
+	glm_f32vec4 const SignMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000)));
+	glm_f32vec4 const SignX = _mm_and_ps(x, SignMask);
+	glm_f32vec4 const AbsX = _mm_andnot_ps(SignMask, x);
+
+	// For |x| > 0.5, asin(x) = pi / 2 - 2 * asin(sqrt((1 - |x|) / 2)), |x| > 1 produces NaN through the square root
+	glm_f32vec4 const Big = _mm_cmpgt_ps(AbsX, _mm_set1_ps(0.5f));
+	glm_f32vec4 const zBig = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), AbsX), _mm_set1_ps(0.5f));
+	glm_f32vec4 const z = glm_vec4_select(Big, zBig, _mm_mul_ps(AbsX, AbsX));
+	glm_f32vec4 const t = glm_vec4_select(Big, _mm_sqrt_ps(zBig), AbsX);
+
+	glm_f32vec4 const p = glm_vec4_asin_poly(t, z);
+	glm_f32vec4 const r = glm_vec4_select(Big, glm_vec4_fma(p, _mm_set1_ps(-2.0f), _mm_set1_ps(1.57079632679489661923f)), p);
+	return _mm_or_ps(r, SignX);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_acos(glm_f32vec4 x)
+{
+	glm_f32vec4 const AbsX = glm_vec4_abs(x);
+
+	// For |x| > 0.5, acos(x) = 2 * asin(sqrt((1 - |x|) / 2)) mirrored around pi / 2 for negative x
+	glm_f32vec4 const Big = _mm_cmpgt_ps(AbsX, _mm_set1_ps(0.5f));
+	glm_f32vec4 const zBig = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), AbsX), _mm_set1_ps(0.5f));
+	glm_f32vec4 const z = glm_vec4_select(Big, zBig, _mm_mul_ps(x, x));
+	glm_f32vec4 const t = glm_vec4_select(Big, _mm_sqrt_ps(zBig), x);
+
+	glm_f32vec4 const p = glm_vec4_asin_poly(t, z);
+	glm_f32vec4 const Twice = _mm_add_ps(p, p);
+	glm_f32vec4 const rBig = glm_vec4_select(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps(3.14159265358979323846f), Twice), Twice);
+	return glm_vec4_select(Big, rBig, _mm_sub_ps(_mm_set1_ps(1.57079632679489661923f), p));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_atan(glm_f32vec4 x)
+{
+	glm_f32vec4 const SignMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000)));
+	glm_f32vec4 const SignX = _mm_and_ps(x, SignMask);
+	glm_f32vec4 const AbsX = _mm_andnot_ps(SignMask, x);
+
+	// Reduce to |t| <= tan(pi / 8) using atan(x) = pi / 2 - atan(1 / x) and atan(x) = pi / 4 + atan((x - 1) / (x + 1))
+	glm_f32vec4 const Big = _mm_cmpgt_ps(AbsX, _mm_set1_ps(2.414213562373095f));
+	glm_f32vec4 const Mid = _mm_andnot_ps(Big, _mm_cmpgt_ps(AbsX, _mm_set1_ps(0.4142135623730950f)));
+
+	glm_f32vec4 const One = _mm_set1_ps(1.0f);
+	glm_f32vec4 t = glm_vec4_select(Big, _mm_div_ps(_mm_set1_ps(-1.0f), AbsX), AbsX);
+	t = glm_vec4_select(Mid, _mm_div_ps(_mm_sub_ps(AbsX, One), _mm_add_ps(AbsX, One)), t);
+	glm_f32vec4 const Offset = _mm_or_ps(_mm_and_ps(Big, _mm_set1_ps(1.57079632679489661923f)), _mm_and_ps(Mid, _mm_set1_ps(0.78539816339744830962f)));
+
+	glm_f32vec4 const z = _mm_mul_ps(t, t);
+	glm_f32vec4 p = glm_vec4_fma(_mm_set1_ps(8.05374449538e-2f), z, _mm_set1_ps(-1.38776856032e-1f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(1.99777106478e-1f));
+	p = glm_vec4_fma(p, z, _mm_set1_ps(-3.33329491539e-1f));
+	p = glm_vec4_fma(p, _mm_mul_ps(z, t), t);
+
+	return _mm_xor_ps(_mm_add_ps(Offset, p), SignX);
+}
+
 #endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
 
+#if GLM_ARCH & GLM_ARCH_AVX_BIT
+
+// Returns a non-zero value if any lane is out of the range where sin, cos and tan kernels are accurate, infinite or NaN
+GLM_FUNC_QUALIFIER int glm_dvec4_trig_outside_range(glm_f64vec4 x)
+{
+	glm_f64vec4 const AbsX = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+	return _mm256_movemask_pd(_mm256_cmp_pd(AbsX, _mm256_set1_pd(1048576.0), _CMP_NLE_UQ));
+}
+
+GLM_FUNC_QUALIFIER void glm_dvec4_sincos(glm_f64vec4 x, glm_f64vec4* s, glm_f64vec4* c)
+{
+	glm_f64vec4 const SignMask = _mm256_set1_pd(-0.0);
+	glm_f64vec4 const SignX = _mm256_and_pd(x, SignMask);
+	glm_f64vec4 const AbsX = _mm256_andnot_pd(SignMask, x);
+
+	// Quadrant q such that j = 2 * q is the octant |x| * 4 / pi rounded up to even.
+	// AVX lacks 64-bit integer operations so the quadrant is tracked in floating point.
+	glm_f64vec4 const q = _mm256_round_pd(glm_dvec4_fma(AbsX, _mm256_set1_pd(0.63661977236758134308), _mm256_set1_pd(0.5)), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+	glm_f64vec4 const y = _mm256_add_pd(q, q);
+
+	// Extended precision modular arithmetic
+	glm_f64vec4 r = glm_dvec4_fma(y, _mm256_set1_pd(-7.85398125648498535156e-1), AbsX);
+	r = glm_dvec4_fma(y, _mm256_set1_pd(-3.77489470793079817668e-8), r);
+	r = glm_dvec4_fma(y, _mm256_set1_pd(-2.69515142907905952645e-15), r);
+
+	glm_f64vec4 const z = _mm256_mul_pd(r, r);
+
+	glm_f64vec4 PolySin = glm_dvec4_fma(_mm256_set1_pd(1.58962301576546568060e-10), z, _mm256_set1_pd(-2.50507477628578072866e-8));
+	PolySin = glm_dvec4_fma(PolySin, z, _mm256_set1_pd(2.75573136213857245213e-6));
+	PolySin = glm_dvec4_fma(PolySin, z, _mm256_set1_pd(-1.98412698295895385996e-4));
+	PolySin = glm_dvec4_fma(PolySin, z, _mm256_set1_pd(8.33333333332211858878e-3));
+	PolySin = glm_dvec4_fma(PolySin, z, _mm256_set1_pd(-1.66666666666666307295e-1));
+	PolySin = glm_dvec4_fma(PolySin, _mm256_mul_pd(z, r), r);
+
+	glm_f64vec4 PolyCos = glm_dvec4_fma(_mm256_set1_pd(-1.13585365213876817300e-11), z, _mm256_set1_pd(2.08757008419747316778e-9));
+	PolyCos = glm_dvec4_fma(PolyCos, z, _mm256_set1_pd(-2.75573141792967388112e-7));
+	PolyCos = glm_dvec4_fma(PolyCos, z, _mm256_set1_pd(2.48015872888517045348e-5));
+	PolyCos = glm_dvec4_fma(PolyCos, z, _mm256_set1_pd(-1.38888888888730564116e-3));
+	PolyCos = glm_dvec4_fma(PolyCos, z, _mm256_set1_pd(4.16666666666665929218e-2));
+	PolyCos = glm_dvec4_fma(PolyCos, _mm256_mul_pd(z, z), glm_dvec4_fma(z, _mm256_set1_pd(-0.5), _mm256_set1_pd(1.0)));
+
+	// Odd quadrants swap the polynomials, sin is negative in quadrants 2 and 3, cos in quadrants 1 and 2
+	glm_f64vec4 const Mod2 = _mm256_sub_pd(q, _mm256_mul_pd(_mm256_set1_pd(2.0), _mm256_floor_pd(_mm256_mul_pd(q, _mm256_set1_pd(0.5)))));
+	glm_f64vec4 const Mod4 = _mm256_sub_pd(q, _mm256_mul_pd(_mm256_set1_pd(4.0), _mm256_floor_pd(_mm256_mul_pd(q, _mm256_set1_pd(0.25)))));
+	glm_f64vec4 const Swap = _mm256_cmp_pd(Mod2, _mm256_setzero_pd(), _CMP_NEQ_OQ);
+	glm_f64vec4 const NegSin = _mm256_cmp_pd(Mod4, _mm256_set1_pd(2.0), _CMP_GE_OQ);
+	glm_f64vec4 const NegCos = _mm256_and_pd(
+		_mm256_cmp_pd(Mod4, _mm256_set1_pd(1.0), _CMP_GE_OQ),
+		_mm256_cmp_pd(Mod4, _mm256_set1_pd(2.0), _CMP_LE_OQ));
+
+	glm_f64vec4 const SignSin = _mm256_xor_pd(SignX, _mm256_and_pd(NegSin, SignMask));
+	glm_f64vec4 const SignCos = _mm256_and_pd(NegCos, SignMask);
+
+	*s = _mm256_xor_pd(_mm256_blendv_pd(PolySin, PolyCos, Swap), SignSin);
+	*c = _mm256_xor_pd(_mm256_blendv_pd(PolyCos, PolySin, Swap), SignCos);
+}
+
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_sin(glm_f64vec4 x)
+{
+	glm_f64vec4 s, c;
+	glm_dvec4_sincos(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_cos(glm_f64vec4 x)
+{
+	glm_f64vec4 s, c;
+	glm_dvec4_sincos(x, &s, &c);
+	return c;
+}
+
+GLM_FUNC_QUALIFIER glm_f64vec4 glm_dvec4_tan(glm_f64vec4 x)
+{
+	glm_f64vec4 s, c;
+	glm_dvec4_sincos(x, &s, &c);
+	return _mm256_div_pd(s, c);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+// 8 lanes variant of glm_vec4_sincos
+GLM_FUNC_QUALIFIER void glm_vec8_sincos(glm_f32vec8 x, glm_f32vec8* s, glm_f32vec8* c)
+{
+	glm_f32vec8 const SignMask = _mm256_set1_ps(-0.0f);
+	glm_f32vec8 const SignX = _mm256_and_ps(x, SignMask);
+	glm_f32vec8 const AbsX = _mm256_andnot_ps(SignMask, x);
+
+	__m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(AbsX, _mm256_set1_ps(1.27323954473516f)));
+	j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+	glm_f32vec8 const y = _mm256_cvtepi32_ps(j);
+
+	glm_f32vec8 r = glm_vec8_fma(y, _mm256_set1_ps(-0.78515625f), AbsX);
+	r = glm_vec8_fma(y, _mm256_set1_ps(-2.4187564849853515625e-4f), r);
+	r = glm_vec8_fma(y, _mm256_set1_ps(-3.77489497744594108e-8f), r);
+
+	glm_f32vec8 const z = _mm256_mul_ps(r, r);
+
+	glm_f32vec8 PolyCos = glm_vec8_fma(_mm256_set1_ps(2.443315711809948e-5f), z, _mm256_set1_ps(-1.388731625493765e-3f));
+	PolyCos = glm_vec8_fma(PolyCos, z, _mm256_set1_ps(4.166664568298827e-2f));
+	PolyCos = glm_vec8_fma(PolyCos, _mm256_mul_ps(z, z), glm_vec8_fma(z, _mm256_set1_ps(-0.5f), _mm256_set1_ps(1.0f)));
+
+	glm_f32vec8 PolySin = glm_vec8_fma(_mm256_set1_ps(-1.9515295891e-4f), z, _mm256_set1_ps(8.3321608736e-3f));
+	PolySin = glm_vec8_fma(PolySin, z, _mm256_set1_ps(-1.6666654611e-1f));
+	PolySin = glm_vec8_fma(PolySin, _mm256_mul_ps(z, r), r);
+
+	glm_f32vec8 const Swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_setzero_si256()));
+	glm_f32vec8 const SignSin = _mm256_xor_ps(SignX, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, _mm256_set1_epi32(4)), 29)));
+	glm_f32vec8 const SignCos = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29));
+
+	*s = _mm256_xor_ps(_mm256_blendv_ps(PolyCos, PolySin, Swap), SignSin);
+	*c = _mm256_xor_ps(_mm256_blendv_ps(PolySin, PolyCos, Swap), SignCos);
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_sin(glm_f32vec8 x)
+{
+	glm_f32vec8 s, c;
+	glm_vec8_sincos(x, &s, &c);
+	return s;
+}
+
+// 8 lanes variant of glm_vec4_asin_poly
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_asin_poly(glm_f32vec8 t, glm_f32vec8 z)
+{
+	glm_f32vec8 p = glm_vec8_fma(_mm256_set1_ps(4.2163199048e-2f), z, _mm256_set1_ps(2.4181311049e-2f));
+	p = glm_vec8_fma(p, z, _mm256_set1_ps(4.5470025998e-2f));
+	p = glm_vec8_fma(p, z, _mm256_set1_ps(7.4953002686e-2f));
+	p = glm_vec8_fma(p, z, _mm256_set1_ps(1.6666752422e-1f));
+	return glm_vec8_fma(p, _mm256_mul_ps(z, t), t);
+}
+
+// 8 lanes variant of glm_vec4_acos
+GLM_FUNC_QUALIFIER glm_f32vec8 glm_vec8_acos(glm_f32vec8 x)
+{
+	glm_f32vec8 const AbsX = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+
+	glm_f32vec8 const Big = _mm256_cmp_ps(AbsX, _mm256_set1_ps(0.5f), _CMP_GT_OQ);
+	glm_f32vec8 const zBig = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), AbsX), _mm256_set1_ps(0.5f));
+	glm_f32vec8 const z = _mm256_blendv_ps(_mm256_mul_ps(x, x), zBig, Big);
+	glm_f32vec8 const t = _mm256_blendv_ps(x, _mm256_sqrt_ps(zBig), Big);
+
+	glm_f32vec8 const p = glm_vec8_asin_poly(t, z);
+	glm_f32vec8 const Twice = _mm256_add_ps(p, p);
+	glm_f32vec8 const rBig = _mm256_blendv_ps(Twice, _mm256_sub_ps(_mm256_set1_ps(3.14159265358979323846f), Twice), _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ));
+	return _mm256_blendv_ps(_mm256_sub_ps(_mm256_set1_ps(1.57079632679489661923f), p), rBig, Big);
+}
+
+#endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+
+#if GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+	// GCC 12 reports the _mm512_undefined_ps used by AVX-512 intrinsics as uninitialized, bug 105593
+#	pragma GCC diagnostic push
+#	pragma GCC diagnostic ignored "-Wuninitialized"
+#	pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// 16 lanes variant of glm_vec4_sincos
+GLM_FUNC_QUALIFIER void glm_vec16_sincos(glm_f32vec16 x, glm_f32vec16* s, glm_f32vec16* c)
+{
+	__m512i const SignMask = _mm512_set1_epi32(static_cast<int>(0x80000000));
+	__m512i const SignX = _mm512_and_si512(_mm512_castps_si512(x), SignMask);
+	glm_f32vec16 const AbsX = _mm512_abs_ps(x);
+
+	__m512i j = _mm512_cvttps_epi32(_mm512_mul_ps(AbsX, _mm512_set1_ps(1.27323954473516f)));
+	j = _mm512_and_si512(_mm512_add_epi32(j, _mm512_set1_epi32(1)), _mm512_set1_epi32(~1));
+	glm_f32vec16 const y = _mm512_cvtepi32_ps(j);
+
+	glm_f32vec16 r = glm_vec16_fma(y, _mm512_set1_ps(-0.78515625f), AbsX);
+	r = glm_vec16_fma(y, _mm512_set1_ps(-2.4187564849853515625e-4f), r);
+	r = glm_vec16_fma(y, _mm512_set1_ps(-3.77489497744594108e-8f), r);
+
+	glm_f32vec16 const z = _mm512_mul_ps(r, r);
+
+	glm_f32vec16 PolyCos = glm_vec16_fma(_mm512_set1_ps(2.443315711809948e-5f), z, _mm512_set1_ps(-1.388731625493765e-3f));
+	PolyCos = glm_vec16_fma(PolyCos, z, _mm512_set1_ps(4.166664568298827e-2f));
+	PolyCos = glm_vec16_fma(PolyCos, _mm512_mul_ps(z, z), glm_vec16_fma(z, _mm512_set1_ps(-0.5f), _mm512_set1_ps(1.0f)));
+
+	glm_f32vec16 PolySin = glm_vec16_fma(_mm512_set1_ps(-1.9515295891e-4f), z, _mm512_set1_ps(8.3321608736e-3f));
+	PolySin = glm_vec16_fma(PolySin, z, _mm512_set1_ps(-1.6666654611e-1f));
+	PolySin = glm_vec16_fma(PolySin, _mm512_mul_ps(z, r), r);
+
+	__mmask16 const Swap = _mm512_cmpeq_epi32_mask(_mm512_and_si512(j, _mm512_set1_epi32(2)), _mm512_setzero_si512());
+	__m512i const SignSin = _mm512_xor_si512(SignX, _mm512_slli_epi32(_mm512_and_si512(j, _mm512_set1_epi32(4)), 29));
+	__m512i const SignCos = _mm512_slli_epi32(_mm512_andnot_si512(_mm512_sub_epi32(j, _mm512_set1_epi32(2)), _mm512_set1_epi32(4)), 29);
+
+	*s = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mask_blend_ps(Swap, PolyCos, PolySin)), SignSin));
+	*c = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mask_blend_ps(Swap, PolySin, PolyCos)), SignCos));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_vec16_sin(glm_f32vec16 x)
+{
+	glm_f32vec16 s, c;
+	glm_vec16_sincos(x, &s, &c);
+	return s;
+}
+
+// 16 lanes variant of glm_vec4_asin_poly
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_vec16_asin_poly(glm_f32vec16 t, glm_f32vec16 z)
+{
+	glm_f32vec16 p = glm_vec16_fma(_mm512_set1_ps(4.2163199048e-2f), z, _mm512_set1_ps(2.4181311049e-2f));
+	p = glm_vec16_fma(p, z, _mm512_set1_ps(4.5470025998e-2f));
+	p = glm_vec16_fma(p, z, _mm512_set1_ps(7.4953002686e-2f));
+	p = glm_vec16_fma(p, z, _mm512_set1_ps(1.6666752422e-1f));
+	return glm_vec16_fma(p, _mm512_mul_ps(z, t), t);
+}
+
+// 16 lanes variant of glm_vec4_acos
+GLM_FUNC_QUALIFIER glm_f32vec16 glm_vec16_acos(glm_f32vec16 x)
+{
+	glm_f32vec16 const AbsX = _mm512_abs_ps(x);
+
+	__mmask16 const Big = _mm512_cmp_ps_mask(AbsX, _mm512_set1_ps(0.5f), _CMP_GT_OQ);
+	glm_f32vec16 const zBig = _mm512_mul_ps(_mm512_sub_ps(_mm512_set1_ps(1.0f), AbsX), _mm512_set1_ps(0.5f));
+	glm_f32vec16 const z = _mm512_mask_blend_ps(Big, _mm512_mul_ps(x, x), zBig);
+	glm_f32vec16 const t = _mm512_mask_blend_ps(Big, x, _mm512_sqrt_ps(zBig));
+
+	glm_f32vec16 const p = glm_vec16_asin_poly(t, z);
+	glm_f32vec16 const Twice = _mm512_add_ps(p, p);
+	__mmask16 const Negative = _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_LT_OQ);
+	glm_f32vec16 const rBig = _mm512_mask_blend_ps(Negative, Twice, _mm512_sub_ps(_mm512_set1_ps(3.14159265358979323846f), Twice));
+	return _mm512_mask_blend_ps(Big, _mm512_sub_ps(_mm512_set1_ps(1.57079632679489661923f), p), rBig);
+}
+
+#if GLM_COMPILER & GLM_COMPILER_GCC
+#	pragma GCC diagnostic pop
+#endif
+
+#endif//GLM_ARCH & GLM_ARCH_AVX512_BIT
+
+#if GLM_ARCH & GLM_ARCH_NEON_BIT
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_fma(glm_f32vec4 a, glm_f32vec4 b, glm_f32vec4 c)
+{
+#	ifdef GLM_FORCE_FMA
+		return vfmaq_f32(c, a, b);
+#	else
+		return vaddq_f32(vmulq_f32(a, b), c);
+#	endif
+}
+
+// Returns a non-zero value if any lane is out of the range where sin, cos and tan kernels are accurate, infinite or NaN
+GLM_FUNC_QUALIFIER int glm_vec4_trig_outside_range(glm_f32vec4 x)
+{
+	uint32x4_t const Inside = vcleq_f32(vabsq_f32(x), vdupq_n_f32(8192.0f));
+	uint32x2_t const Min = vpmin_u32(vget_low_u32(Inside), vget_high_u32(Inside));
+	return vget_lane_u32(vpmin_u32(Min, Min), 0) == 0 ? 1 : 0;
+}
+
+GLM_FUNC_QUALIFIER void glm_vec4_sincos(glm_f32vec4 x, glm_f32vec4* s, glm_f32vec4* c)
+{
+	uint32x4_t const SignMask = vdupq_n_u32(0x80000000);
+	uint32x4_t const SignX = vandq_u32(vreinterpretq_u32_f32(x), SignMask);
+	glm_f32vec4 const AbsX = vabsq_f32(x);
+
+	// Octant j = |x| * 4 / pi rounded up to even so that |r| <= pi / 4
+	uint32x4_t j = vcvtq_u32_f32(vmulq_f32(AbsX, vdupq_n_f32(1.27323954473516f)));
+	j = vandq_u32(vaddq_u32(j, vdupq_n_u32(1)), vdupq_n_u32(~1u));
+	glm_f32vec4 const y = vcvtq_f32_u32(j);
+
+	// Extended precision modular arithmetic
+	glm_f32vec4 r = glm_vec4_fma(y, vdupq_n_f32(-0.78515625f), AbsX);
+	r = glm_vec4_fma(y, vdupq_n_f32(-2.4187564849853515625e-4f), r);
+	r = glm_vec4_fma(y, vdupq_n_f32(-3.77489497744594108e-8f), r);
+
+	glm_f32vec4 const z = vmulq_f32(r, r);
+
+	glm_f32vec4 PolyCos = glm_vec4_fma(vdupq_n_f32(2.443315711809948e-5f), z, vdupq_n_f32(-1.388731625493765e-3f));
+	PolyCos = glm_vec4_fma(PolyCos, z, vdupq_n_f32(4.166664568298827e-2f));
+	PolyCos = glm_vec4_fma(PolyCos, vmulq_f32(z, z), glm_vec4_fma(z, vdupq_n_f32(-0.5f), vdupq_n_f32(1.0f)));
+
+	glm_f32vec4 PolySin = glm_vec4_fma(vdupq_n_f32(-1.9515295891e-4f), z, vdupq_n_f32(8.3321608736e-3f));
+	PolySin = glm_vec4_fma(PolySin, z, vdupq_n_f32(-1.6666654611e-1f));
+	PolySin = glm_vec4_fma(PolySin, vmulq_f32(z, r), r);
+
+	// Octants 2 and 6 swap the polynomials, sin is negative in octants 4 and 6, cos in octants 2 and 4
+	uint32x4_t const Swap = vceqq_u32(vandq_u32(j, vdupq_n_u32(2)), vdupq_n_u32(0));
+	uint32x4_t const SignSin = veorq_u32(SignX, vshlq_n_u32(vandq_u32(j, vdupq_n_u32(4)), 29));
+	uint32x4_t const SignCos = vshlq_n_u32(vbicq_u32(vdupq_n_u32(4), vsubq_u32(j, vdupq_n_u32(2))), 29);
+
+	*s = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(Swap, PolySin, PolyCos)), SignSin));
+	*c = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(Swap, PolyCos, PolySin)), SignCos));
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_sin(glm_f32vec4 x)
+{
+	glm_f32vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return s;
+}
+
+GLM_FUNC_QUALIFIER glm_f32vec4 glm_vec4_cos(glm_f32vec4 x)
+{
+	glm_f32vec4 s, c;
+	glm_vec4_sincos(x, &s, &c);
+	return c;
+}
+
+#endif//GLM_ARCH & GLM_ARCH_NEON_BIT
@@ -2,11 +2,33 @@
 
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
+#include <cstddef>
+
+// The default frustum planes of a default projection use a depth range from 0 to 1
+static int test_frustum_planes()
+{
+	int Error = 0;
+
+	glm::mat4 const Projection = glm::perspective(glm::half_pi<float>(), 1.0f, 1.0f, 10.0f);
+	glm::vec4 Planes[6], Expected[6];
+	glm::extractFrustumPlanes(Projection, Planes);
+	glm::extractFrustumPlanesZO(Projection, Expected);
+	for(std::size_t i = 0; i < 6; ++i)
+		Error += Planes[i] == Expected[i] ? 0 : 1;
+
+	// Near plane at depth 1
+	Error += glm::intersectFrustumSphere(Planes, glm::vec3(0, 0, -1.01f), 0.0f) ? 0 : 1;
+	Error += !glm::intersectFrustumSphere(Planes, glm::vec3(0, 0, -0.99f), 0.0f) ? 0 : 1;
+
+	return Error;
+}
 
 int main()
 {
 	int Error = 0;
 
+	Error += test_frustum_planes();
+
 	return Error;
 }
 
@@ -3,10 +3,28 @@
 #include <glm/glm.hpp>
 #include <glm/ext.hpp>
 
+// The frustum planes of a default projection bound the +z half space of the view
+static int test_frustum_planes()
+{
+	int Error = 0;
+
+	glm::vec4 Planes[6];
+	glm::extractFrustumPlanes(glm::perspective(glm::half_pi<float>(), 1.0f, 1.0f, 10.0f), Planes);
+
+	Error += glm::intersectFrustumSphere(Planes, glm::vec3(0, 0, 5), 0.0f) ? 0 : 1;
+	Error += !glm::intersectFrustumSphere(Planes, glm::vec3(0, 0, -5), 0.0f) ? 0 : 1;
+	Error += glm::intersectFrustumBox(Planes, glm::vec3(-1, -1, 2), glm::vec3(1, 1, 3)) ? 0 : 1;
+	Error += !glm::intersectFrustumBox(Planes, glm::vec3(-1, -1, -3), glm::vec3(1, 1, -2)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
+	Error += test_frustum_planes();
+
 	return Error;
 }
 
@@ -5,8 +5,13 @@
 #include <glm/ext/vector_float2.hpp>
 #include <glm/ext/vector_float3.hpp>
 #include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_double4.hpp>
 #include <glm/common.hpp>
 #include <glm/exponential.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <cmath>
 
 static int test_pow()
 {
@@ -166,6 +171,75 @@ static int test_inversesqrt()
 	return Error;
 }
 
+template<typename vecType, typename F, typename G>
+static int test_function(F VecFunc, G ScalarFunc, typename vecType::value_type Min, typename vecType::value_type Max, int MaxULPs)
+{
+	typedef typename vecType::value_type T;
+
+	int Error = 0;
+
+	int const Count = 4096;
+	for(int i = 0; i < Count; i += 4)
+	{
+		vecType x;
+		for(glm::length_t k = 0; k < 4; ++k)
+			x[k] = Min + (Max - Min) * static_cast<T>(i + k) / static_cast<T>(Count - 1);
+
+		vecType const Result = VecFunc(x);
+		for(glm::length_t k = 0; k < 4; ++k)
+			Error += glm::equal(glm::vec<1, T>(Result[k]), glm::vec<1, T>(ScalarFunc(x[k])), MaxULPs)[0] || std::abs(Result[k]) < static_cast<T>(1e-6) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename vecType>
+static int test_accuracy()
+{
+	typedef typename vecType::value_type T;
+
+	int Error = 0;
+
+	Error += test_function<vecType>([](vecType const& x) { return glm::exp(x); }, [](T x) { return std::exp(x); }, static_cast<T>(-80), static_cast<T>(80), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::exp2(x); }, [](T x) { return std::exp2(x); }, static_cast<T>(-120), static_cast<T>(120), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::log(x); }, [](T x) { return std::log(x); }, static_cast<T>(0.001), static_cast<T>(4), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::log(x); }, [](T x) { return std::log(x); }, static_cast<T>(1), static_cast<T>(1e30), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::log2(x); }, [](T x) { return std::log2(x); }, static_cast<T>(0.001), static_cast<T>(4), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::log2(x); }, [](T x) { return std::log2(x); }, static_cast<T>(1), static_cast<T>(1e30), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::pow(x, vecType(static_cast<T>(2.5))); }, [](T x) { return std::pow(x, static_cast<T>(2.5)); }, static_cast<T>(0.001), static_cast<T>(1000), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::pow(vecType(static_cast<T>(1.5)), x); }, [](T x) { return std::pow(static_cast<T>(1.5), x); }, static_cast<T>(-100), static_cast<T>(100), 4);
+
+	return Error;
+}
+
+template<typename vecType>
+static int test_special()
+{
+	typedef typename vecType::value_type T;
+
+	int Error = 0;
+
+	// Arguments outside of the range of the SIMD kernels
+	vecType const Exp = glm::exp(vecType(static_cast<T>(1000), static_cast<T>(-1000), static_cast<T>(0), static_cast<T>(1)));
+	Error += std::isinf(Exp.x) && Exp.y == static_cast<T>(0) && Exp.z == static_cast<T>(1) ? 0 : 1;
+	Error += glm::equal(glm::vec<1, T>(Exp.w), glm::vec<1, T>(std::exp(static_cast<T>(1))), 4)[0] ? 0 : 1;
+
+	vecType const Log = glm::log(vecType(static_cast<T>(0), static_cast<T>(-1), static_cast<T>(1), static_cast<T>(2)));
+	Error += std::isinf(Log.x) && Log.x < static_cast<T>(0) && std::isnan(Log.y) && Log.z == static_cast<T>(0) ? 0 : 1;
+	Error += glm::equal(glm::vec<1, T>(Log.w), glm::vec<1, T>(std::log(static_cast<T>(2))), 4)[0] ? 0 : 1;
+
+	vecType const Log2 = glm::log2(vecType(static_cast<T>(1), static_cast<T>(2), static_cast<T>(1024), static_cast<T>(0.125)));
+	Error += glm::all(glm::equal(Log2, vecType(static_cast<T>(0), static_cast<T>(1), static_cast<T>(10), static_cast<T>(-3)), 0)) ? 0 : 1;
+
+	vecType const Exp2 = glm::exp2(vecType(static_cast<T>(0), static_cast<T>(1), static_cast<T>(10), static_cast<T>(-3)));
+	Error += glm::all(glm::equal(Exp2, vecType(static_cast<T>(1), static_cast<T>(2), static_cast<T>(1024), static_cast<T>(0.125)), 0)) ? 0 : 1;
+
+	vecType const Pow = glm::pow(vecType(static_cast<T>(-2), static_cast<T>(0), static_cast<T>(2), static_cast<T>(4)), vecType(static_cast<T>(3), static_cast<T>(0), static_cast<T>(10), static_cast<T>(0.5)));
+	Error += glm::all(glm::equal(Pow, vecType(static_cast<T>(-8), static_cast<T>(1), static_cast<T>(1024), static_cast<T>(2)), 0)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -177,6 +251,17 @@ int main()
 	Error += test_exp2();
 	Error += test_log2();
 	Error += test_inversesqrt();
+	Error += test_accuracy<glm::vec4>();
+	Error += test_accuracy<glm::dvec4>();
+	Error += test_special<glm::vec4>();
+	Error += test_special<glm::dvec4>();
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_accuracy<glm::aligned_vec4>();
+		Error += test_accuracy<glm::aligned_dvec4>();
+		Error += test_special<glm::aligned_vec4>();
+		Error += test_special<glm::aligned_dvec4>();
+#	endif
 
 	return Error;
 }
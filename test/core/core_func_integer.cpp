@@ -1557,6 +1557,142 @@ namespace bitCount
 	}
 }//bitCount
 
+// Compares bitCount, findLSB and findMSB of every backend with loops over the bits
+namespace bitScan
+{
+	template<typename genIUType>
+	static int bitCount_loop(genIUType Value)
+	{
+		typedef typename std::make_unsigned<genIUType>::type utype;
+
+		int Count = 0;
+		for(utype x = static_cast<utype>(Value); x != 0; x >>= 1)
+			Count += static_cast<int>(x & 1);
+		return Count;
+	}
+
+	template<typename genIUType>
+	static int findLSB_loop(genIUType Value)
+	{
+		typedef typename std::make_unsigned<genIUType>::type utype;
+
+		for(int i = 0; i < static_cast<int>(sizeof(genIUType) * 8); ++i)
+			if(static_cast<utype>(Value) & (utype(1) << i))
+				return i;
+		return -1;
+	}
+
+	// Negative signed values return the index of their sign bit
+	template<typename genIUType>
+	static int findMSB_loop(genIUType Value)
+	{
+		typedef typename std::make_unsigned<genIUType>::type utype;
+
+		for(int i = static_cast<int>(sizeof(genIUType) * 8) - 1; i >= 0; --i)
+			if(static_cast<utype>(Value) & (utype(1) << i))
+				return i;
+		return -1;
+	}
+
+	template<typename genIUType>
+	static std::vector<genIUType> values()
+	{
+		typedef typename std::make_unsigned<genIUType>::type utype;
+
+		std::vector<genIUType> Values;
+		Values.push_back(0);
+		Values.push_back(static_cast<genIUType>(~utype(0)));
+		Values.push_back(std::numeric_limits<genIUType>::min());
+		Values.push_back(std::numeric_limits<genIUType>::max());
+		for(int i = 0; i < static_cast<int>(sizeof(genIUType) * 8); ++i)
+		{
+			Values.push_back(static_cast<genIUType>(utype(1) << i));
+			Values.push_back(static_cast<genIUType>((utype(1) << i) - 1));
+			Values.push_back(static_cast<genIUType>(~(utype(1) << i)));
+		}
+
+		glm::uint64 Seed = 1;
+		for(int i = 0; i < 256; ++i)
+		{
+			Seed = Seed * 6364136223846793005ull + 1442695040888963407ull;
+			Values.push_back(static_cast<genIUType>(Seed >> (i % 32)));
+		}
+
+		return Values;
+	}
+
+	template<typename genIUType>
+	static int test_scalar()
+	{
+		int Error = 0;
+
+		std::vector<genIUType> const Values = values<genIUType>();
+		for(std::size_t i = 0; i < Values.size(); ++i)
+		{
+			Error += glm::bitCount(Values[i]) == bitCount_loop(Values[i]) ? 0 : 1;
+			Error += glm::findLSB(Values[i]) == findLSB_loop(Values[i]) ? 0 : 1;
+			Error += glm::findMSB(Values[i]) == findMSB_loop(Values[i]) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	template<typename genIUType, glm::qualifier Q>
+	static int test_vec()
+	{
+		int Error = 0;
+
+		std::vector<genIUType> const Values = values<genIUType>();
+		for(std::size_t i = 0; i + 3 < Values.size(); ++i)
+		{
+			glm::vec<4, genIUType, Q> const v(Values[i], Values[i + 1], Values[i + 2], Values[i + 3]);
+
+			glm::vec<4, int, Q> const Count = glm::bitCount(v);
+			glm::vec<4, int, Q> const LSB = glm::findLSB(v);
+			glm::vec<4, int, Q> const MSB = glm::findMSB(v);
+
+			for(glm::length_t c = 0; c < 4; ++c)
+			{
+				Error += Count[c] == bitCount_loop(v[c]) ? 0 : 1;
+				Error += LSB[c] == findLSB_loop(v[c]) ? 0 : 1;
+				Error += MSB[c] == findMSB_loop(v[c]) ? 0 : 1;
+			}
+
+			glm::vec<3, genIUType, Q> const w(v);
+			Error += glm::all(glm::equal(glm::bitCount(w), glm::vec<3, int, Q>(Count))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::findLSB(w), glm::vec<3, int, Q>(LSB))) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::findMSB(w), glm::vec<3, int, Q>(MSB))) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_scalar<glm::int8>();
+		Error += test_scalar<glm::uint16>();
+		Error += test_scalar<glm::int32>();
+		Error += test_scalar<glm::uint32>();
+		Error += test_scalar<glm::int64>();
+		Error += test_scalar<glm::uint64>();
+
+		Error += test_vec<glm::int32, glm::defaultp>();
+		Error += test_vec<glm::uint32, glm::defaultp>();
+		Error += test_vec<glm::int64, glm::defaultp>();
+		Error += test_vec<glm::uint64, glm::defaultp>();
+
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += test_vec<glm::int32, glm::aligned_highp>();
+			Error += test_vec<glm::uint32, glm::aligned_highp>();
+			Error += test_vec<glm::uint64, glm::aligned_highp>();
+#		endif
+
+		return Error;
+	}
+}//namespace bitScan
+
 int main()
 {
 	int Error = 0;
@@ -1571,6 +1707,7 @@ int main()
 	Error += ::usubBorrow::test();
 	Error += ::bitfieldInsert::test();
 	Error += ::bitfieldExtract::test();
+	Error += ::bitScan::test();
 
 #	ifdef NDEBUG
 		std::size_t const Samples = 1000;
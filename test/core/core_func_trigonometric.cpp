@@ -1,10 +1,88 @@
 #include <glm/trigonometric.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_double4.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <cmath>
 
-int main()
+template<typename vecType, typename F, typename G>
+static int test_function(F VecFunc, G ScalarFunc, typename vecType::value_type Min, typename vecType::value_type Max, int MaxULPs)
+{
+	typedef typename vecType::value_type T;
+
+	int Error = 0;
+
+	int const Count = 4096;
+	for(int i = 0; i < Count; i += 4)
+	{
+		vecType x;
+		for(glm::length_t k = 0; k < 4; ++k)
+			x[k] = Min + (Max - Min) * static_cast<T>(i + k) / static_cast<T>(Count - 1);
+
+		vecType const Result = VecFunc(x);
+		for(glm::length_t k = 0; k < 4; ++k)
+			Error += glm::equal(glm::vec<1, T>(Result[k]), glm::vec<1, T>(ScalarFunc(x[k])), MaxULPs)[0] || std::abs(Result[k]) < static_cast<T>(1e-6) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename vecType>
+static int test_trigonometric()
+{
+	typedef typename vecType::value_type T;
+
+	int Error = 0;
+
+	Error += test_function<vecType>([](vecType const& x) { return glm::sin(x); }, [](T x) { return std::sin(x); }, static_cast<T>(-64), static_cast<T>(64), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::cos(x); }, [](T x) { return std::cos(x); }, static_cast<T>(-64), static_cast<T>(64), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::tan(x); }, [](T x) { return std::tan(x); }, static_cast<T>(-64), static_cast<T>(64), 8);
+	Error += test_function<vecType>([](vecType const& x) { return glm::asin(x); }, [](T x) { return std::asin(x); }, static_cast<T>(-1), static_cast<T>(1), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::acos(x); }, [](T x) { return std::acos(x); }, static_cast<T>(-1), static_cast<T>(1), 4);
+	Error += test_function<vecType>([](vecType const& x) { return glm::atan(x); }, [](T x) { return std::atan(x); }, static_cast<T>(-100), static_cast<T>(100), 4);
+
+	return Error;
+}
+
+template<typename vecType>
+static int test_special()
 {
+	typedef typename vecType::value_type T;
+
 	int Error = 0;
 
+	vecType const Out(static_cast<T>(2), static_cast<T>(-2), static_cast<T>(-1), static_cast<T>(1));
+	vecType const Asin = glm::asin(Out);
+	vecType const Acos = glm::acos(Out);
+	Error += std::isnan(Asin.x) && std::isnan(Asin.y) && std::isnan(Acos.x) && std::isnan(Acos.y) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::vec<2, T>(Asin.z, Asin.w), glm::vec<2, T>(std::asin(static_cast<T>(-1)), std::asin(static_cast<T>(1))), 1)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::vec<2, T>(Acos.z, Acos.w), glm::vec<2, T>(std::acos(static_cast<T>(-1)), std::acos(static_cast<T>(1))), 1)) ? 0 : 1;
+
+	vecType const Large(static_cast<T>(1e5), static_cast<T>(-3e7), static_cast<T>(0.5), static_cast<T>(0));
+	vecType const Sin = glm::sin(Large);
+	for(glm::length_t k = 0; k < 4; ++k)
+		Error += glm::equal(glm::vec<1, T>(Sin[k]), glm::vec<1, T>(std::sin(Large[k])), 4)[0] ? 0 : 1;
 
 	return Error;
 }
 
+int main()
+{
+	int Error = 0;
+
+	Error += test_trigonometric<glm::vec4>();
+	Error += test_trigonometric<glm::dvec4>();
+	Error += test_special<glm::vec4>();
+	Error += test_special<glm::dvec4>();
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_trigonometric<glm::aligned_vec4>();
+		Error += test_trigonometric<glm::aligned_dvec4>();
+		Error += test_special<glm::aligned_vec4>();
+		Error += test_special<glm::aligned_dvec4>();
+#	endif
+
+	return Error;
+}
@@ -0,0 +1,213 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/ext/color_space_batch.hpp>
+#include <glm/gtx/color_space_YCoCg.hpp>
+#include <glm/gtx/color_encoding.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_uint3_sized.hpp>
+#include <glm/ext/vector_uint4_sized.hpp>
+#include <glm/ext/vector_float1.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <vector>
+
+// Counts covering empty arrays, the SIMD blocks and their tails
+static std::size_t const Counts[] = {0, 1, 3, 4, 5, 7, 8, 13, 64, 65, 131};
+
+template<glm::length_t L, typename T, glm::qualifier Q>
+static std::vector<glm::vec<L, T, Q> > colors(std::size_t Count, T Min, T Max)
+{
+	std::vector<glm::vec<L, T, Q> > Colors(Count + 1);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < L; ++c)
+		Colors[i][c] = Min + (Max - Min) * static_cast<T>((i * 37 + static_cast<std::size_t>(c) * 11) % 101) / static_cast<T>(100);
+
+	// Guard element that the functions must not write
+	Colors[Count] = glm::vec<L, T, Q>(static_cast<T>(-7));
+	return Colors;
+}
+
+template<glm::length_t L, typename T, glm::qualifier Q>
+static int test_transfer(T Epsilon)
+{
+	typedef glm::vec<L, T, Q> vecType;
+
+	int Error = 0;
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+		std::vector<vecType> const In = colors<L, T, Q>(Count, static_cast<T>(-0.1), static_cast<T>(1.1));
+
+		std::vector<vecType> Out(Count + 1, vecType(static_cast<T>(-7)));
+		glm::convertLinearToSRGB(&In[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], glm::convertLinearToSRGB(In[i]), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], vecType(static_cast<T>(-7)), static_cast<T>(0))) ? 0 : 1;
+
+		glm::convertLinearToSRGB(&In[0], &Out[0], Count, static_cast<T>(2.2));
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], glm::convertLinearToSRGB(In[i], static_cast<T>(2.2)), Epsilon)) ? 0 : 1;
+
+		glm::convertSRGBToLinear(&In[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], glm::convertSRGBToLinear(In[i]), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], vecType(static_cast<T>(-7)), static_cast<T>(0))) ? 0 : 1;
+
+		glm::convertSRGBToLinear(&In[0], &Out[0], Count, static_cast<T>(2.2));
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], glm::convertSRGBToLinear(In[i], static_cast<T>(2.2)), Epsilon)) ? 0 : 1;
+
+		// In place round trip
+		std::vector<vecType> Colors = colors<L, T, Q>(Count, static_cast<T>(0), static_cast<T>(1));
+		glm::convertLinearToSRGB(&Colors[0], &Colors[0], Count);
+		glm::convertSRGBToLinear(&Colors[0], &Colors[0], Count);
+		std::vector<vecType> const Expected = colors<L, T, Q>(Count, static_cast<T>(0), static_cast<T>(1));
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Colors[i], Expected[i], static_cast<T>(1e-4))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<glm::length_t L, glm::qualifier Q>
+static int test_uint8()
+{
+	typedef glm::vec<L, float, Q> vecType;
+	typedef glm::vec<L, glm::uint8, Q> u8vecType;
+
+	int Error = 0;
+
+	std::vector<u8vecType> Encoded(257);
+	for(std::size_t i = 0; i < 256; ++i)
+		Encoded[i] = u8vecType(static_cast<glm::uint8>(i));
+	Encoded[256] = u8vecType(static_cast<glm::uint8>(7));
+
+	std::vector<vecType> Linear(257, vecType(-7.0f));
+	glm::convertSRGBToLinear(&Encoded[0], &Linear[0], 256);
+	for(std::size_t i = 0; i < 256; ++i)
+	{
+		vecType const Expected = glm::convertSRGBToLinear(vecType(Encoded[i]) / 255.0f);
+		for(glm::length_t c = 0; c < L; ++c)
+		{
+			float const Value = L == 4 && c == 3 ? static_cast<float>(i) / 255.0f : Expected[c];
+			Error += Linear[i][c] == Value ? 0 : 1;
+		}
+	}
+	Error += glm::all(glm::equal(Linear[256], vecType(-7.0f), 0.0f)) ? 0 : 1;
+
+	// Decoding then encoding the 256 values gives them back
+	std::vector<u8vecType> RoundTrip(257, u8vecType(static_cast<glm::uint8>(7)));
+	glm::convertLinearToSRGB(&Linear[0], &RoundTrip[0], 256);
+	for(std::size_t i = 0; i < 257; ++i)
+		Error += RoundTrip[i] == Encoded[i] ? 0 : 1;
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+		std::vector<vecType> const In = colors<L, float, Q>(Count, -0.1f, 1.1f);
+		std::vector<u8vecType> Out(Count + 1, u8vecType(static_cast<glm::uint8>(7)));
+		glm::convertLinearToSRGB(&In[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vecType const Expected = glm::convertLinearToSRGB(In[i]) * 255.0f;
+			for(glm::length_t c = 0; c < L; ++c)
+			{
+				float const Value = L == 4 && c == 3 ? glm::clamp(In[i][c], 0.0f, 1.0f) * 255.0f : Expected[c];
+				Error += glm::abs(static_cast<float>(Out[i][c]) - Value) <= 0.5001f ? 0 : 1;
+			}
+		}
+		Error += Out[Count] == u8vecType(static_cast<glm::uint8>(7)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q, typename batch, typename single>
+static int test_color_space(batch Batch, single Single, T Epsilon)
+{
+	typedef glm::vec<3, T, Q> vecType;
+
+	int Error = 0;
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+		std::vector<vecType> const In = colors<3, T, Q>(Count, static_cast<T>(-1), static_cast<T>(2));
+
+		std::vector<vecType> Out(Count + 1, vecType(static_cast<T>(-7)));
+		Batch(&In[0], &Out[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], Single(In[i]), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], vecType(static_cast<T>(-7)), static_cast<T>(0))) ? 0 : 1;
+
+		// In place
+		std::vector<vecType> Colors(In);
+		Batch(&Colors[0], &Colors[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Colors[i], Out[i], static_cast<T>(0))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_color_spaces()
+{
+	typedef glm::vec<3, T, Q> vecType;
+
+	// Only FMA contraction of the single color functions may change the last bits
+	T const Epsilon = static_cast<T>(1e-6);
+
+	int Error = 0;
+
+	Error += test_color_space<T, Q>(
+		static_cast<void(*)(vecType const*, vecType*, std::size_t)>(glm::rgb2YCoCg),
+		static_cast<vecType(*)(vecType const&)>(glm::rgb2YCoCg), Epsilon);
+	Error += test_color_space<T, Q>(
+		static_cast<void(*)(vecType const*, vecType*, std::size_t)>(glm::YCoCg2rgb),
+		static_cast<vecType(*)(vecType const&)>(glm::YCoCg2rgb), Epsilon);
+	Error += test_color_space<T, Q>(
+		static_cast<void(*)(vecType const*, vecType*, std::size_t)>(glm::rgb2YCoCgR),
+		static_cast<vecType(*)(vecType const&)>(glm::rgb2YCoCgR), Epsilon);
+	Error += test_color_space<T, Q>(
+		static_cast<void(*)(vecType const*, vecType*, std::size_t)>(glm::YCoCgR2rgb),
+		static_cast<vecType(*)(vecType const&)>(glm::YCoCgR2rgb), Epsilon);
+	Error += test_color_space<T, Q>(
+		static_cast<void(*)(vecType const*, vecType*, std::size_t)>(glm::convertLinearSRGBToD65XYZ),
+		static_cast<vecType(*)(vecType const&)>(glm::convertLinearSRGBToD65XYZ), Epsilon * static_cast<T>(16));
+	Error += test_color_space<T, Q>(
+		static_cast<void(*)(vecType const*, vecType*, std::size_t)>(glm::convertLinearSRGBToD50XYZ),
+		static_cast<vecType(*)(vecType const&)>(glm::convertLinearSRGBToD50XYZ), Epsilon);
+	Error += test_color_space<T, Q>(
+		static_cast<void(*)(vecType const*, vecType*, std::size_t)>(glm::convertD65XYZToLinearSRGB),
+		static_cast<vecType(*)(vecType const&)>(glm::convertD65XYZToLinearSRGB), Epsilon);
+	Error += test_color_space<T, Q>(
+		static_cast<void(*)(vecType const*, vecType*, std::size_t)>(glm::convertD65XYZToD50XYZ),
+		static_cast<vecType(*)(vecType const&)>(glm::convertD65XYZToD50XYZ), Epsilon);
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_transfer<1, float, glm::defaultp>(1e-5f);
+	Error += test_transfer<2, float, glm::defaultp>(1e-5f);
+	Error += test_transfer<3, float, glm::defaultp>(1e-5f);
+	Error += test_transfer<4, float, glm::defaultp>(1e-5f);
+	Error += test_transfer<3, float, glm::packed_highp>(1e-5f);
+	Error += test_transfer<4, float, glm::packed_highp>(1e-5f);
+	Error += test_transfer<3, double, glm::defaultp>(1e-12);
+	Error += test_transfer<4, double, glm::defaultp>(1e-12);
+
+	Error += test_uint8<3, glm::defaultp>();
+	Error += test_uint8<4, glm::defaultp>();
+
+	Error += test_color_spaces<float, glm::defaultp>();
+	Error += test_color_spaces<float, glm::packed_highp>();
+	Error += test_color_spaces<double, glm::defaultp>();
+
+	return Error;
+}
@@ -0,0 +1,370 @@
+#include <glm/ext/frustum_culling.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/scalar_constants.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/integer.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Whether a point is inside the clip volume of m, the depth ranging from 0 or -1 to 1
+template<typename T>
+static bool inside_clip(glm::mat<4, 4, T, glm::defaultp> const& m, glm::vec<3, T, glm::defaultp> const& p, bool zeroToOne)
+{
+	glm::vec<4, T, glm::defaultp> const Clip = m * glm::vec<4, T, glm::defaultp>(p, static_cast<T>(1));
+	T const Near = zeroToOne ? static_cast<T>(0) : -Clip.w;
+	return -Clip.w <= Clip.x && Clip.x <= Clip.w && -Clip.w <= Clip.y && Clip.y <= Clip.w && Near <= Clip.z && Clip.z <= Clip.w;
+}
+
+template<typename T>
+static int test_planes()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::vec<4, T, glm::defaultp> vec4Type;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4Type;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	T const Fovy = glm::half_pi<T>();
+	T const Near = static_cast<T>(1);
+	T const Far = static_cast<T>(10);
+
+	// Right handed projections look down -z, left handed ones down +z
+	struct projection
+	{
+		mat4Type Matrix;
+		bool ZeroToOne;
+		T Forward;
+	};
+	projection const Projections[] = {
+		{glm::perspectiveRH_ZO(Fovy, static_cast<T>(1), Near, Far), true, static_cast<T>(-1)},
+		{glm::perspectiveRH_NO(Fovy, static_cast<T>(1), Near, Far), false, static_cast<T>(-1)},
+		{glm::perspectiveLH_ZO(Fovy, static_cast<T>(1), Near, Far), true, static_cast<T>(1)},
+		{glm::perspectiveLH_NO(Fovy, static_cast<T>(1), Near, Far), false, static_cast<T>(1)}};
+
+	for(std::size_t k = 0; k < sizeof(Projections) / sizeof(Projections[0]); ++k)
+	{
+		projection const& Projection = Projections[k];
+
+		vec4Type Planes[6];
+		if(Projection.ZeroToOne)
+			glm::extractFrustumPlanesZO(Projection.Matrix, Planes);
+		else
+			glm::extractFrustumPlanesNO(Projection.Matrix, Planes);
+
+		for(std::size_t i = 0; i < 6; ++i)
+			Error += glm::equal(glm::length(vec3Type(Planes[i])), static_cast<T>(1), Epsilon) ? 0 : 1;
+
+		// Near and far planes at their distance along the view direction
+		T const f = Projection.Forward;
+		Error += glm::equal(glm::dot(vec3Type(Planes[4]), vec3Type(0, 0, f * 3)) + Planes[4].w, static_cast<T>(2), Epsilon) ? 0 : 1;
+		Error += glm::equal(glm::dot(vec3Type(Planes[5]), vec3Type(0, 0, f * 3)) + Planes[5].w, static_cast<T>(7), Epsilon) ? 0 : 1;
+
+		// 90 degrees field of view: the side planes pass through (+-d, +-d, f * d)
+		Error += glm::intersectFrustumSphere(Planes, vec3Type(0, 0, f * 5), static_cast<T>(0)) ? 0 : 1;
+		Error += glm::intersectFrustumSphere(Planes, vec3Type(4, -4, f * 5), static_cast<T>(0)) ? 0 : 1;
+		Error += !glm::intersectFrustumSphere(Planes, vec3Type(6, 0, f * 5), static_cast<T>(0)) ? 0 : 1;
+		Error += !glm::intersectFrustumSphere(Planes, vec3Type(0, -6, f * 5), static_cast<T>(0)) ? 0 : 1;
+		Error += !glm::intersectFrustumSphere(Planes, vec3Type(0, 0, f * static_cast<T>(0.5)), static_cast<T>(0)) ? 0 : 1;
+		Error += !glm::intersectFrustumSphere(Planes, vec3Type(0, 0, f * 11), static_cast<T>(0)) ? 0 : 1;
+		Error += !glm::intersectFrustumSphere(Planes, vec3Type(0, 0, -f * 5), static_cast<T>(0)) ? 0 : 1;
+
+		// Spheres and boxes crossing a plane are visible
+		Error += glm::intersectFrustumSphere(Planes, vec3Type(0, 0, f * 11), static_cast<T>(1.5)) ? 0 : 1;
+		Error += glm::intersectFrustumSphere(Planes, vec3Type(6, 0, f * 5), static_cast<T>(1)) ? 0 : 1;
+		Error += !glm::intersectFrustumSphere(Planes, vec3Type(0, 0, f * 11), static_cast<T>(0.5)) ? 0 : 1;
+		Error += glm::intersectFrustumBox(Planes, vec3Type(5, -1, -9), vec3Type(7, 1, 9)) ? 0 : 1;
+		Error += !glm::intersectFrustumBox(Planes, vec3Type(11, -1, -9), vec3Type(13, 1, 9)) ? 0 : 1;
+		Error += !glm::intersectFrustumBox(Planes, vec3Type(-1, -1, glm::min(-f * 2, -f)), vec3Type(1, 1, glm::max(-f * 2, -f))) ? 0 : 1;
+		Error += !glm::intersectFrustumBox(Planes, vec3Type(-1, -1, glm::min(f * static_cast<T>(0.2), f * static_cast<T>(0.8))), vec3Type(1, 1, glm::max(f * static_cast<T>(0.2), f * static_cast<T>(0.8)))) ? 0 : 1;
+
+		// Points of a view-projection matrix against the clip volume
+		mat4Type const View = glm::lookAtRH(vec3Type(3, 2, 1), vec3Type(-2, 0, -4), vec3Type(0, 1, 0));
+		mat4Type const ViewProjection = Projection.Matrix * View;
+		if(Projection.ZeroToOne)
+			glm::extractFrustumPlanesZO(ViewProjection, Planes);
+		else
+			glm::extractFrustumPlanesNO(ViewProjection, Planes);
+
+		// Points of the view space on both sides of the side planes, at depths on both sides of the near and far planes:
+		// (x, y, f * z) in view space is inside when abs(x) <= z and abs(y) <= z, z being between 1 and 10
+		mat4Type const ViewInverse = glm::inverse(View);
+		T const Depths[] = {static_cast<T>(0.9), static_cast<T>(1.1), static_cast<T>(5), static_cast<T>(9.9), static_cast<T>(10.1)};
+		T const Slopes[] = {static_cast<T>(-1.2), static_cast<T>(-0.99), static_cast<T>(-0.5), static_cast<T>(0), static_cast<T>(0.99), static_cast<T>(1.01)};
+		for(T const Depth : Depths)
+		for(T const SlopeX : Slopes)
+		for(T const SlopeY : Slopes)
+		{
+			vec3Type const Point(ViewInverse * vec4Type(SlopeX * Depth, SlopeY * Depth, f * Depth, static_cast<T>(1)));
+			bool const Expected = glm::abs(SlopeX) <= static_cast<T>(1) && glm::abs(SlopeY) <= static_cast<T>(1) && Depth >= Near && Depth <= Far;
+			Error += inside_clip(ViewProjection, Point, Projection.ZeroToOne) == Expected ? 0 : 1;
+			Error += glm::intersectFrustumSphere(Planes, Point, static_cast<T>(0)) == Expected ? 0 : 1;
+			Error += glm::intersectFrustumBox(Planes, Point, Point) == Expected ? 0 : 1;
+		}
+	}
+
+	// Default depth range
+	{
+		mat4Type const Projection = glm::perspective(Fovy, static_cast<T>(1), Near, Far);
+		vec4Type Planes[6], Expected[6];
+		glm::extractFrustumPlanes(Projection, Planes);
+#		if GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT
+			glm::extractFrustumPlanesZO(Projection, Expected);
+#		else
+			glm::extractFrustumPlanesNO(Projection, Expected);
+#		endif
+		for(std::size_t i = 0; i < 6; ++i)
+			Error += Planes[i] == Expected[i] ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Bits of the mask beyond count are cleared and the words beyond the mask untouched
+static int check_mask(std::vector<std::uint32_t> const& Mask, std::size_t Count, std::size_t Visible)
+{
+	int Error = 0;
+
+	std::size_t const Words = (Count + 31) / 32;
+	std::size_t Bits = 0;
+	for(std::size_t i = 0; i < Words; ++i)
+		Bits += static_cast<std::size_t>(glm::bitCount(Mask[i]));
+	Error += Bits == Visible ? 0 : 1;
+	if(Count % 32 != 0)
+		Error += (Mask[Words - 1] >> (Count % 32)) == 0 ? 0 : 1;
+	Error += Mask[Words] == 0xFFFFFFFFu ? 0 : 1;
+
+	return Error;
+}
+
+// Counts around the blocks of 8 and 4 lanes and the 32 bit mask words
+static std::size_t const Counts[] = {0, 1, 4, 5, 8, 12, 13, 31, 32, 33, 37, 64, 65, 97};
+
+// Planes of a frustum and a point of each face, away from the other planes
+template<typename T>
+struct frustum
+{
+	glm::vec<4, T, glm::defaultp> Planes[6];
+	glm::vec<3, T, glm::defaultp> Faces[6];
+};
+
+// The box x in [-4, 4], y in [-2, 2], z in [-8, -1] seen as a frustum: with axis aligned normals, distances are exact
+template<typename T>
+static frustum<T> box_frustum()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::vec<4, T, glm::defaultp> vec4Type;
+
+	frustum<T> Result;
+	Result.Planes[0] = vec4Type(1, 0, 0, 4);
+	Result.Planes[1] = vec4Type(-1, 0, 0, 4);
+	Result.Planes[2] = vec4Type(0, 1, 0, 2);
+	Result.Planes[3] = vec4Type(0, -1, 0, 2);
+	Result.Planes[4] = vec4Type(0, 0, -1, -1);
+	Result.Planes[5] = vec4Type(0, 0, 1, 8);
+	Result.Faces[0] = vec3Type(-4, 0, static_cast<T>(-4.5));
+	Result.Faces[1] = vec3Type(4, 0, static_cast<T>(-4.5));
+	Result.Faces[2] = vec3Type(0, -2, static_cast<T>(-4.5));
+	Result.Faces[3] = vec3Type(0, 2, static_cast<T>(-4.5));
+	Result.Faces[4] = vec3Type(0, 0, -1);
+	Result.Faces[5] = vec3Type(0, 0, -8);
+	return Result;
+}
+
+// Planes of Projection * View, the side faces taken at a depth halfway between near and far.
+// Forward is -1 for right handed views, 1 for left handed ones.
+template<typename T>
+static frustum<T> view_frustum(glm::mat<4, 4, T, glm::defaultp> const& Projection, glm::mat<4, 4, T, glm::defaultp> const& View, bool ZeroToOne, T Fovy, T Aspect, T Near, T Far, T Forward)
+{
+	typedef glm::vec<4, T, glm::defaultp> vec4Type;
+
+	frustum<T> Result;
+	if(ZeroToOne)
+		glm::extractFrustumPlanesZO(Projection * View, Result.Planes);
+	else
+		glm::extractFrustumPlanesNO(Projection * View, Result.Planes);
+
+	T const Depth = (Near + Far) / static_cast<T>(2);
+	T const Height = Depth * glm::tan(Fovy / static_cast<T>(2));
+	T const Width = Height * Aspect;
+	vec4Type const Faces[6] = {
+		vec4Type(-Width, 0, Forward * Depth, 1),
+		vec4Type(Width, 0, Forward * Depth, 1),
+		vec4Type(0, -Height, Forward * Depth, 1),
+		vec4Type(0, Height, Forward * Depth, 1),
+		vec4Type(0, 0, Forward * Near, 1),
+		vec4Type(0, 0, Forward * Far, 1)};
+
+	glm::mat<4, 4, T, glm::defaultp> const ViewInverse = glm::inverse(View);
+	for(std::size_t p = 0; p < 6; ++p)
+		Result.Faces[p] = glm::vec<3, T, glm::defaultp>(ViewInverse * Faces[p]);
+	return Result;
+}
+
+// Volumes around a face of the frustum, their center moved outward by Offset times the volume's reach along the plane normal:
+// volumes with an offset up to 1 straddle or touch the plane and are visible, farther ones are culled
+template<typename T>
+struct straddle
+{
+	std::size_t Plane;
+	T Offset;
+	T Size;
+
+	bool visible() const
+	{
+		return Offset <= static_cast<T>(1) || Size == static_cast<T>(0);
+	}
+};
+
+// Every plane with every offset and size; lane i gets case i * 7, cycling the cases across the lanes of the blocks
+template<typename T>
+static std::vector<straddle<T> > make_cases(std::vector<T> const& Offsets, std::vector<T> const& Sizes)
+{
+	std::vector<straddle<T> > Cases;
+	for(std::size_t s = 0; s < Sizes.size(); ++s)
+	for(std::size_t o = 0; o < Offsets.size(); ++o)
+	for(std::size_t p = 0; p < 6; ++p)
+	{
+		straddle<T> const Case = {p, Offsets[o], Sizes[s]};
+		Cases.push_back(Case);
+	}
+	return Cases;
+}
+
+template<typename T>
+static int test_spheres(frustum<T> const& Frustum, std::vector<straddle<T> > const& Cases)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	int Error = 0;
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+
+		glm::vec_soa<3, T> Center(Count);
+		std::vector<T> Radius(Count);
+		std::vector<bool> Visible(Count);
+		std::size_t Expected = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			straddle<T> const& Case = Cases[i * 7 % Cases.size()];
+			vec3Type const Normal(Frustum.Planes[Case.Plane]);
+			Center.store(i, Frustum.Faces[Case.Plane] - Normal * (Case.Offset * Case.Size));
+			Radius[i] = Case.Size;
+			Visible[i] = Case.visible();
+			Expected += Visible[i] ? 1 : 0;
+
+			Error += glm::intersectFrustumSphere(Frustum.Planes, Center.load(i), Radius[i]) == Visible[i] ? 0 : 1;
+		}
+
+		std::vector<std::uint32_t> Mask(Count / 32 + 2, 0xFFFFFFFFu);
+		std::size_t const Result = glm::intersectFrustumSpheres(Frustum.Planes, glm::vec_soa_view<3, T>(Center), Radius.data(), Mask.data());
+
+		Error += Result == Expected ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += (((Mask[i / 32] >> (i % 32)) & 1u) != 0) == Visible[i] ? 0 : 1;
+		Error += check_mask(Mask, Count, Result);
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_boxes(frustum<T> const& Frustum, std::vector<straddle<T> > const& Cases)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	int Error = 0;
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+
+		glm::vec_soa<3, T> BoxMin(Count), BoxMax(Count);
+		std::vector<bool> Visible(Count);
+		std::size_t Expected = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			// A cube reaches Size times the L1 norm of the normal along it
+			straddle<T> const& Case = Cases[i * 7 % Cases.size()];
+			vec3Type const Normal(Frustum.Planes[Case.Plane]);
+			T const Reach = Case.Size * (glm::abs(Normal.x) + glm::abs(Normal.y) + glm::abs(Normal.z));
+			vec3Type const Center = Frustum.Faces[Case.Plane] - Normal * (Case.Offset * Reach);
+			BoxMin.store(i, Center - Case.Size);
+			BoxMax.store(i, Center + Case.Size);
+			Visible[i] = Case.visible();
+			Expected += Visible[i] ? 1 : 0;
+
+			Error += glm::intersectFrustumBox(Frustum.Planes, BoxMin.load(i), BoxMax.load(i)) == Visible[i] ? 0 : 1;
+		}
+
+		std::vector<std::uint32_t> Mask(Count / 32 + 2, 0xFFFFFFFFu);
+		std::size_t const Result = glm::intersectFrustumBoxes(Frustum.Planes, glm::vec_soa_view<3, T>(BoxMin), glm::vec_soa_view<3, T>(BoxMax), Mask.data());
+
+		Error += Result == Expected ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += (((Mask[i / 32] >> (i % 32)) & 1u) != 0) == Visible[i] ? 0 : 1;
+		Error += check_mask(Mask, Count, Result);
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_batches()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	int Error = 0;
+
+	// Exact distances: volumes touching a plane, offset 1, and points on a plane, size 0, are visible
+	{
+		frustum<T> const Frustum = box_frustum<T>();
+		std::vector<T> const Offsets = {static_cast<T>(-1), static_cast<T>(0), static_cast<T>(0.5), static_cast<T>(1), static_cast<T>(1.5)};
+		std::vector<T> const Sizes = {static_cast<T>(0), static_cast<T>(0.5), static_cast<T>(1)};
+		std::vector<straddle<T> > const Cases = make_cases(Offsets, Sizes);
+
+		Error += test_spheres(Frustum, Cases);
+		Error += test_boxes(Frustum, Cases);
+	}
+
+	// Extracted planes are rounded, the offsets keep away from the boundary
+	{
+		std::vector<T> const Offsets = {static_cast<T>(-1), static_cast<T>(0.5), static_cast<T>(1.5), static_cast<T>(3)};
+		std::vector<T> const Sizes = {static_cast<T>(0.25), static_cast<T>(0.5)};
+		std::vector<straddle<T> > const Cases = make_cases(Offsets, Sizes);
+
+		T const Fovy = static_cast<T>(1);
+		T const Aspect = static_cast<T>(1.5);
+		T const Near = static_cast<T>(0.5);
+		T const Far = static_cast<T>(20);
+		frustum<T> const FrustumRH = view_frustum(
+			glm::perspectiveRH_ZO(Fovy, Aspect, Near, Far), glm::lookAtRH(vec3Type(0), vec3Type(1, 0, -1), vec3Type(0, 1, 0)),
+			true, Fovy, Aspect, Near, Far, static_cast<T>(-1));
+		frustum<T> const FrustumLH = view_frustum(
+			glm::perspectiveLH_NO(Fovy, Aspect, Near, Far), glm::lookAtLH(vec3Type(1, 2, 3), vec3Type(0), vec3Type(0, 1, 0)),
+			false, Fovy, Aspect, Near, Far, static_cast<T>(1));
+
+		Error += test_spheres(FrustumRH, Cases);
+		Error += test_boxes(FrustumRH, Cases);
+		Error += test_spheres(FrustumLH, Cases);
+		Error += test_boxes(FrustumLH, Cases);
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_planes<float>();
+	Error += test_planes<double>();
+	Error += test_batches<float>();
+	Error += test_batches<double>();
+
+	return Error;
+}
@@ -0,0 +1,220 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/ext/intersect_batch.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <limits>
+#include <vector>
+#include <cstddef>
+
+static std::size_t const Counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 33, 64, 67, 300};
+
+// Triangles scattered around the origin with both windings, some of them degenerated
+template<typename T>
+static void make_triangles(std::size_t Count, glm::vec_soa<3, T>& V0, glm::vec_soa<3, T>& V1, glm::vec_soa<3, T>& V2)
+{
+	V0.resize(Count);
+	V1.resize(Count);
+	V2.resize(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec<3, T, glm::defaultp> const Center(
+			static_cast<T>(static_cast<int>((i * 7) % 11) - 5) * T(0.2),
+			static_cast<T>(static_cast<int>((i * 5) % 13) - 6) * T(0.2),
+			static_cast<T>(static_cast<int>((i * 3) % 17)) * T(0.5) - T(2));
+		glm::vec<3, T, glm::defaultp> const A(T(1), T(0.1) * static_cast<T>(i % 3), T(0.2));
+		glm::vec<3, T, glm::defaultp> const B(T(-0.3), T(1), T(-0.1) * static_cast<T>(i % 4));
+
+		V0.store(i, Center);
+		V1.store(i, i % 2 == 0 ? Center + A : Center + B);
+		V2.store(i, i % 9 == 4 ? Center + A * T(2) : (i % 2 == 0 ? Center + B : Center + A));
+	}
+}
+
+template<typename T>
+static glm::vec<3, T, glm::defaultp> make_origin(std::size_t r)
+{
+	return glm::vec<3, T, glm::defaultp>(
+		static_cast<T>(static_cast<int>((r * 3) % 9) - 4) * T(0.17),
+		static_cast<T>(static_cast<int>((r * 7) % 9) - 4) * T(0.13),
+		T(-5));
+}
+
+template<typename T>
+static glm::vec<3, T, glm::defaultp> make_direction(std::size_t r)
+{
+	return glm::vec<3, T, glm::defaultp>(
+		static_cast<T>(static_cast<int>(r % 5) - 2) * T(0.01),
+		static_cast<T>(static_cast<int>(r % 3) - 1) * T(0.02),
+		r % 7 == 3 ? T(-1) : T(1));
+}
+
+template<typename T>
+static int test_triangles()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::vec<2, T, glm::defaultp> vec2Type;
+
+	int Error = 0;
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+		glm::vec_soa<3, T> V0, V1, V2;
+		make_triangles(Count, V0, V1, V2);
+
+		for(std::size_t r = 0; r < 40; ++r)
+		{
+			vec3Type const Orig = make_origin<T>(r);
+			vec3Type const Dir = make_direction<T>(r);
+
+			// Nearest hit in front of the origin with the single triangle function
+			bool ExpectedHit = false;
+			vec2Type ExpectedBary(0);
+			T ExpectedDistance(0);
+			std::size_t ExpectedIndex = 0;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec2Type Bary(0);
+				T Distance(0);
+				if(!glm::intersectRayTriangle(Orig, Dir, V0.load(i), V1.load(i), V2.load(i), Bary, Distance) || Distance < T(0))
+					continue;
+				if(ExpectedHit && !(Distance < ExpectedDistance))
+					continue;
+				ExpectedHit = true;
+				ExpectedBary = Bary;
+				ExpectedDistance = Distance;
+				ExpectedIndex = i;
+			}
+
+			vec2Type Bary(-1);
+			T Distance(-1);
+			std::size_t Index = Count + 1;
+			bool const Hit = glm::intersectRayTriangles(Orig, Dir, V0, V1, V2, Bary, Distance, Index);
+
+			Error += Hit == ExpectedHit ? 0 : 1;
+			if(Hit)
+			{
+				Error += Index == ExpectedIndex ? 0 : 1;
+				Error += glm::abs(Distance - ExpectedDistance) <= std::numeric_limits<T>::epsilon() * T(16) ? 0 : 1;
+				Error += glm::abs(Bary.x - ExpectedBary.x) <= std::numeric_limits<T>::epsilon() * T(16) ? 0 : 1;
+				Error += glm::abs(Bary.y - ExpectedBary.y) <= std::numeric_limits<T>::epsilon() * T(16) ? 0 : 1;
+			}
+			else
+			{
+				// The outputs are left unchanged
+				Error += Index == Count + 1 && Distance == T(-1) && Bary.x == T(-1) ? 0 : 1;
+			}
+		}
+	}
+
+	return Error;
+}
+
+// Duplicated triangles are hit at the same distance, the lowest index is returned
+static int test_ties()
+{
+	int Error = 0;
+
+	glm::vec3_soa V0(20), V1(20), V2(20);
+	for(std::size_t i = 0; i < 20; ++i)
+	{
+		float const z = i < 11 ? 3.0f : 1.0f;
+		V0.store(i, glm::vec3(-1, -1, z));
+		V1.store(i, glm::vec3(1, -1, z));
+		V2.store(i, glm::vec3(0, 1, z));
+	}
+
+	glm::vec2 Bary(0);
+	float Distance = 0;
+	std::size_t Index = 0;
+	Error += glm::intersectRayTriangles(glm::vec3(0, 0, 0), glm::vec3(0, 0, 1), V0, V1, V2, Bary, Distance, Index) ? 0 : 1;
+	Error += Index == 11 ? 0 : 1;
+	Error += Distance == 1.0f ? 0 : 1;
+
+	// Behind the origin
+	Error += !glm::intersectRayTriangles(glm::vec3(0, 0, 0), glm::vec3(0, 0, -1), V0, V1, V2, Bary, Distance, Index) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_rays()
+{
+	typedef glm::vec<2, T, glm::defaultp> vec2Type;
+
+	int Error = 0;
+
+	glm::vec_soa<3, T> V0, V1, V2;
+	make_triangles(40, V0, V1, V2);
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+		glm::vec_soa<3, T> Orig(Count), Dir(Count);
+		for(std::size_t r = 0; r < Count; ++r)
+		{
+			Orig.store(r, make_origin<T>(r));
+			Dir.store(r, make_direction<T>(r));
+		}
+
+		// Each ray traverses all the triangles
+		glm::vec_soa<2, T> Bary(Count);
+		std::vector<T> Distance(Count + 1, std::numeric_limits<T>::infinity());
+		std::vector<std::size_t> Index(Count + 1, 1000);
+		std::size_t Updated = 0;
+		for(std::size_t i = 0; i < V0.size(); ++i)
+			Updated += glm::intersectRaysTriangle(Orig, Dir, V0.load(i), V1.load(i), V2.load(i), i, Bary, &Distance[0], &Index[0]);
+
+		std::size_t ExpectedUpdated = 0;
+		for(std::size_t r = 0; r < Count; ++r)
+		{
+			vec2Type ExpectedBary(0);
+			T ExpectedDistance(0);
+			std::size_t ExpectedIndex = 1000;
+			bool const Hit = glm::intersectRayTriangles(Orig.load(r), Dir.load(r), V0, V1, V2, ExpectedBary, ExpectedDistance, ExpectedIndex);
+
+			// The ray is updated by each triangle nearer than the previous hits
+			T Nearest = std::numeric_limits<T>::infinity();
+			for(std::size_t i = 0; i < V0.size(); ++i)
+			{
+				vec2Type b;
+				T d;
+				if(glm::intersectRayTriangle(Orig.load(r), Dir.load(r), V0.load(i), V1.load(i), V2.load(i), b, d) && d >= T(0) && d < Nearest)
+				{
+					Nearest = d;
+					++ExpectedUpdated;
+				}
+			}
+
+			Error += Index[r] == ExpectedIndex ? 0 : 1;
+			if(Hit)
+			{
+				// Both functions process rays and triangles by different blocks, only FMA contraction may change the last bits
+				Error += glm::abs(Distance[r] - ExpectedDistance) <= std::numeric_limits<T>::epsilon() * T(16) ? 0 : 1;
+				Error += glm::abs(Bary[0][r] - ExpectedBary.x) <= std::numeric_limits<T>::epsilon() * T(16) ? 0 : 1;
+				Error += glm::abs(Bary[1][r] - ExpectedBary.y) <= std::numeric_limits<T>::epsilon() * T(16) ? 0 : 1;
+			}
+			else
+				Error += Distance[r] == std::numeric_limits<T>::infinity() ? 0 : 1;
+		}
+		Error += Updated == ExpectedUpdated ? 0 : 1;
+
+		// Guard elements
+		Error += Index[Count] == 1000 ? 0 : 1;
+		Error += Distance[Count] == std::numeric_limits<T>::infinity() ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_triangles<float>();
+	Error += test_triangles<double>();
+	Error += test_ties();
+	Error += test_rays<float>();
+	Error += test_rays<double>();
+
+	return Error;
+}
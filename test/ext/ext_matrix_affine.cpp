@@ -0,0 +1,167 @@
+#include <glm/ext/matrix_affine.hpp>
+#include <glm/ext/matrix_float3x3.hpp>
+#include <glm/ext/matrix_float3x4.hpp>
+#include <glm/ext/matrix_double3x4.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <cmath>
+#include <cstring>
+
+template<typename T>
+static glm::mat<4, 4, T, glm::defaultp> make_transform(int i)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	glm::mat<4, 4, T, glm::defaultp> Result(1);
+	Result = glm::translate(Result, vec3(T(i) * T(0.5), T(-1.25), T(3) - T(i)));
+	Result = glm::rotate(Result, T(0.3) + T(i) * T(0.7), glm::normalize(vec3(T(1), T(i % 3), T(-2))));
+	Result = glm::scale(Result, vec3(T(1.5), T(0.75) + T(i) * T(0.125), (i & 1) ? T(-2) : T(2)));
+	return Result;
+}
+
+template<typename T>
+static int test_conversion()
+{
+	typedef glm::mat<3, 4, T, glm::defaultp> mat3x4;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	mat4 const M = make_transform<T>(1);
+	mat3x4 const A = glm::affineFromMat4(M);
+
+	Error += glm::all(glm::equal(A, mat3x4(glm::transpose(M)), T(0))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::affineToMat4(A), M, T(0))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::affineToMat4(mat3x4(1)), mat4(1), T(0))) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_multiply()
+{
+	typedef glm::mat<3, 4, T, glm::defaultp> mat3x4;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	for(int i = 0; i < 8; ++i)
+	{
+		mat4 const A = make_transform<T>(i);
+		mat4 const B = make_transform<T>(i + 3);
+
+		mat3x4 const Result = glm::affineMultiply(glm::affineFromMat4(A), glm::affineFromMat4(B));
+		Error += glm::all(glm::equal(glm::affineToMat4(Result), A * B, T(0.0001))) ? 0 : 1;
+	}
+
+	mat3x4 const M = glm::affineFromMat4(make_transform<T>(5));
+	Error += glm::all(glm::equal(glm::affineMultiply(M, mat3x4(1)), M, T(0))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::affineMultiply(mat3x4(1), M), M, T(0))) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_inverse()
+{
+	typedef glm::mat<3, 4, T, glm::defaultp> mat3x4;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	for(int i = 0; i < 8; ++i)
+	{
+		mat4 const M = make_transform<T>(i);
+		mat3x4 const A = glm::affineFromMat4(M);
+		mat3x4 const Inverse = glm::affineInverse(A);
+
+		Error += glm::all(glm::equal(glm::affineToMat4(Inverse), glm::affineInverse(M), T(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineMultiply(A, Inverse), mat3x4(1), T(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineMultiply(Inverse, A), mat3x4(1), T(0.0001))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Without translation, the translation of the inverse is a signed zero.
+// The SIMD implementation negates like the scalar one, the sign bits must be the same.
+static int test_inverse_zero_translation()
+{
+	int Error = 0;
+
+	// The off-diagonal cofactors of a scale are +0, the translation sum is +0 and its negation -0 divided by the determinant
+	float const Scales[] = {2.0f, -2.0f};
+	for(std::size_t i = 0; i < sizeof(Scales) / sizeof(Scales[0]); ++i)
+	{
+		glm::mat3x4 const Inverse = glm::affineInverse(glm::mat3x4(glm::vec4(1.5f, 0, 0, 0), glm::vec4(0, 0.75f, 0, 0), glm::vec4(0, 0, Scales[i], 0)));
+		for(glm::length_t r = 0; r < 3; ++r)
+			Error += Inverse[r].w == 0.0f && std::signbit(Inverse[r].w) == (Scales[i] > 0.0f) ? 0 : 1;
+	}
+
+	// FMA contraction of the scalar implementation may change the sign of a sum of zeros
+#	ifndef GLM_FORCE_FMA
+	for(int i = 0; i < 8; ++i)
+	{
+		glm::mat3x4 A = glm::affineFromMat4(make_transform<float>(i));
+		for(glm::length_t r = 0; r < 3; ++r)
+			A[r].w = 0.0f;
+
+		glm::mat3x4 const Inverse = glm::affineInverse(A);
+		glm::mat3x4 const Expected = glm::detail::compute_affine_inverse<float, glm::defaultp, false>::call(A);
+		for(glm::length_t r = 0; r < 3; ++r)
+			Error += std::memcmp(&Inverse[r].w, &Expected[r].w, sizeof(float)) == 0 ? 0 : 1;
+	}
+#	endif
+
+	return Error;
+}
+
+template<typename T>
+static int test_transform()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::vec<4, T, glm::defaultp> vec4;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3;
+	typedef glm::mat<3, 4, T, glm::defaultp> mat3x4;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	for(int i = 0; i < 8; ++i)
+	{
+		mat4 const M = make_transform<T>(i);
+		mat3x4 const A = glm::affineFromMat4(M);
+		vec3 const V(T(i) - T(2.5), T(0.75), T(1) + T(i) * T(0.25));
+
+		Error += glm::all(glm::equal(glm::affineTransformPoint(A, V), vec3(M * vec4(V, 1)), T(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineTransformPoint(A, V), vec4(V, 1) * A, T(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineTransformVector(A, V), vec3(M * vec4(V, 0)), T(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineTransformNormal(A, V), glm::inverseTranspose(mat3(M)) * V, T(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineTransformNormal(A, V), mat3(glm::affineInverse(A)) * V, T(0.0001))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_conversion<float>();
+	Error += test_conversion<double>();
+	Error += test_multiply<float>();
+	Error += test_multiply<double>();
+	Error += test_inverse<float>();
+	Error += test_inverse<double>();
+	Error += test_inverse_zero_translation();
+	Error += test_transform<float>();
+	Error += test_transform<double>();
+
+	return Error;
+}
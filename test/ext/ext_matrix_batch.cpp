@@ -0,0 +1,257 @@
+#include <glm/ext/matrix_batch.hpp>
+#include <glm/ext/matrix_float3x4.hpp>
+#include <glm/ext/matrix_double3x4.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_double4.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+
+template<typename matType>
+static matType make_matrix()
+{
+	typedef typename matType::value_type T;
+
+	return matType(
+		T(0.5), T(-1.25), T(2), T(0),
+		T(1.5), T(0.75), T(-0.5), T(0),
+		T(-2), T(0.25), T(1.125), T(0),
+		T(3), T(-4), T(5.5), T(1));
+}
+
+template<typename vecType>
+static vecType make_vector(std::size_t i)
+{
+	typedef typename vecType::value_type T;
+
+	vecType Result;
+	for(glm::length_t c = 0; c < vecType::length(); ++c)
+		Result[c] = static_cast<T>(static_cast<int>((i * 7 + static_cast<std::size_t>(c) * 3) % 23) - 11) * static_cast<T>(0.125);
+	return Result;
+}
+
+template<typename T, glm::qualifier Q>
+static glm::vec<3, T, Q> reference(glm::mat<4, 4, T, Q> const& M, glm::vec<3, T, Q> const& V)
+{
+	return glm::vec<3, T, Q>(M * glm::vec<4, T, Q>(V, static_cast<T>(1)));
+}
+
+template<typename T, glm::qualifier Q>
+static glm::vec<4, T, Q> reference(glm::mat<4, 4, T, Q> const& M, glm::vec<4, T, Q> const& V)
+{
+	return M * V;
+}
+
+template<typename matType, typename vecType>
+static int test_transform_contiguous()
+{
+	typedef typename matType::value_type T;
+
+	int Error = 0;
+
+	matType const M = make_matrix<matType>();
+
+	std::size_t const Counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 1001};
+	for(std::size_t n = 0; n < sizeof(Counts) / sizeof(Counts[0]); ++n)
+	{
+		std::size_t const Count = Counts[n];
+
+		std::vector<vecType> In(Count + 1);
+		std::vector<vecType> Out(Count + 1, vecType(static_cast<T>(-1)));
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = make_vector<vecType>(i);
+
+		glm::transform(M, &In[0], &Out[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], reference(M, In[i]), static_cast<T>(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], vecType(static_cast<T>(-1)), static_cast<T>(0))) ? 0 : 1;
+
+		// In place
+		glm::transform(M, &In[0], &In[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(In[i], Out[i], static_cast<T>(0))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+struct vertex
+{
+	glm::vec3 Position;
+	glm::vec2 Texcoord;
+};
+
+static int test_transform_strided()
+{
+	int Error = 0;
+
+	glm::mat4 const M = make_matrix<glm::mat4>();
+
+	std::size_t const Counts[] = {0, 1, 4, 7, 8, 13, 257};
+	for(std::size_t n = 0; n < sizeof(Counts) / sizeof(Counts[0]); ++n)
+	{
+		std::size_t const Count = Counts[n];
+
+		std::vector<vertex> Vertices(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Vertices[i].Position = make_vector<glm::vec3>(i);
+			Vertices[i].Texcoord = glm::vec2(static_cast<float>(i));
+		}
+
+		// Interleaved input to packed output
+		std::vector<glm::vec3> Packed(Count + 1);
+		glm::transform(M, &Vertices[0].Position, sizeof(vertex), &Packed[0], sizeof(glm::vec3), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Packed[i], reference(M, Vertices[i].Position), 0.0001f)) ? 0 : 1;
+
+		// Interleaved in place, other attributes must be preserved
+		glm::transform(M, &Vertices[0].Position, sizeof(vertex), &Vertices[0].Position, sizeof(vertex), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Vertices[i].Position, Packed[i], 0.0f)) ? 0 : 1;
+			Error += glm::all(glm::equal(Vertices[i].Texcoord, glm::vec2(static_cast<float>(i)), 0.0f)) ? 0 : 1;
+		}
+
+		// Packed input to interleaved output
+		std::vector<glm::vec4> In4(Count + 1);
+		std::vector<glm::vec4> Out4(Count * 2 + 1, glm::vec4(-1.0f));
+		for(std::size_t i = 0; i < Count; ++i)
+			In4[i] = make_vector<glm::vec4>(i);
+		glm::transform(M, &In4[0], sizeof(glm::vec4), &Out4[0], sizeof(glm::vec4) * 2, Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Out4[i * 2], reference(M, In4[i]), 0.0001f)) ? 0 : 1;
+			Error += glm::all(glm::equal(Out4[i * 2 + 1], glm::vec4(-1.0f), 0.0f)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template<typename matType>
+static matType make_transform(std::size_t i)
+{
+	typedef typename matType::value_type T;
+
+	matType Result;
+	for(glm::length_t c = 0; c < matType::length(); ++c)
+	for(glm::length_t r = 0; r < matType::col_type::length(); ++r)
+		Result[c][r] = static_cast<T>(static_cast<int>((i * 5 + static_cast<std::size_t>(c * 4 + r) * 3) % 17) - 8) * static_cast<T>(0.125);
+	return Result;
+}
+
+template<typename T, glm::qualifier Q>
+static glm::mat<4, 4, T, Q> reference(glm::mat<4, 4, T, Q> const& A, glm::mat<4, 4, T, Q> const& B)
+{
+	return A * B;
+}
+
+// Affine transforms stored as in GLM_EXT_matrix_affine, with an implicit (0, 0, 0, 1) last row
+template<typename T, glm::qualifier Q>
+static glm::mat<3, 4, T, Q> reference(glm::mat<3, 4, T, Q> const& A, glm::mat<3, 4, T, Q> const& B)
+{
+	return glm::affineFromMat4(glm::affineToMat4(A) * glm::affineToMat4(B));
+}
+
+template<typename matType>
+static int test_multiply()
+{
+	typedef typename matType::value_type T;
+
+	int Error = 0;
+
+	std::size_t const Counts[] = {0, 1, 7, 8, 9, 33};
+	for(std::size_t n = 0; n < sizeof(Counts) / sizeof(Counts[0]); ++n)
+	{
+		std::size_t const Count = Counts[n];
+
+		std::vector<matType> A(Count + 1);
+		std::vector<matType> B(Count + 1);
+		std::vector<matType> Out(Count + 1, matType(static_cast<T>(-1)));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			A[i] = make_transform<matType>(i);
+			B[i] = make_transform<matType>(i + 3);
+		}
+
+		glm::multiply(&A[0], &B[0], &Out[0], Count);
+
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], reference(A[i], B[i]), static_cast<T>(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], matType(static_cast<T>(-1)), static_cast<T>(0))) ? 0 : 1;
+
+		// In place
+		glm::multiply(&A[0], &B[0], &B[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(B[i], Out[i], static_cast<T>(0))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Flattens a scene graph where the parent of node i is (i - 1) / 2
+template<typename matType>
+static int test_multiply_indexed()
+{
+	typedef typename matType::value_type T;
+
+	int Error = 0;
+
+	std::size_t const Count = 37;
+
+	std::vector<matType> Local(Count);
+	std::vector<int> Parent(Count, 0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Local[i] = make_transform<matType>(i) * static_cast<T>(0.5);
+		Parent[i] = static_cast<int>(i > 0 ? (i - 1) / 2 : 0);
+	}
+
+	std::vector<matType> Expected(Count);
+	Expected[0] = Local[0];
+	for(std::size_t i = 1; i < Count; ++i)
+		Expected[i] = reference(Expected[static_cast<std::size_t>(Parent[i])], Local[i]);
+
+	std::vector<matType> World(Count);
+	World[0] = Local[0];
+	glm::multiply(&World[0], &Parent[1], &Local[1], &World[1], Count - 1);
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(World[i], Expected[i], static_cast<T>(0.0001))) ? 0 : 1;
+
+	// Separate parent array
+	std::vector<matType> Out(Count);
+	glm::multiply(&Expected[0], &Parent[1], &Local[1], &Out[1], Count - 1);
+	for(std::size_t i = 1; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], World[i], static_cast<T>(0))) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_transform_contiguous<glm::mat4, glm::vec3>();
+	Error += test_transform_contiguous<glm::mat4, glm::vec4>();
+	Error += test_transform_contiguous<glm::dmat4, glm::dvec3>();
+	Error += test_transform_contiguous<glm::dmat4, glm::dvec4>();
+	Error += test_transform_strided();
+	Error += test_multiply<glm::mat4>();
+	Error += test_multiply<glm::dmat4>();
+	Error += test_multiply<glm::mat3x4>();
+	Error += test_multiply<glm::dmat3x4>();
+	Error += test_multiply_indexed<glm::mat4>();
+	Error += test_multiply_indexed<glm::dmat4>();
+	Error += test_multiply_indexed<glm::mat3x4>();
+	Error += test_multiply_indexed<glm::dmat3x4>();
+
+	return Error;
+}
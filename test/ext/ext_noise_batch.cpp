@@ -0,0 +1,151 @@
+#include <glm/ext/noise_batch.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+#include <cstddef>
+
+static std::size_t const Counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 64, 67};
+
+// Mixes integer coordinates, where the fractional parts are 0, with negative and fractional ones
+template<glm::length_t L, typename T>
+static glm::vec<L, T, glm::defaultp> make_point(std::size_t i)
+{
+	glm::vec<L, T, glm::defaultp> Result;
+	for(glm::length_t c = 0; c < L; ++c)
+	{
+		std::size_t const k = i * 13 + static_cast<std::size_t>(c) * 7;
+		Result[c] = i % 5 == 0 ? static_cast<T>(static_cast<int>(k % 23) - 11) : static_cast<T>(static_cast<int>(k % 997) - 498) * T(0.0371);
+	}
+	return Result;
+}
+
+template<glm::length_t L, typename T>
+static glm::vec_soa<L, T> make_points(std::size_t Count)
+{
+	glm::vec_soa<L, T> Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Points.store(i, make_point<L, T>(i));
+	return Points;
+}
+
+template<glm::length_t L, typename T>
+static T fbm_perlin(glm::vec<L, T, glm::defaultp> const& p, int Octaves, T Lacunarity, T Gain)
+{
+	T Sum = glm::perlin(p);
+	T Frequency = T(1);
+	T Amplitude = T(1);
+	for(int o = 1; o < Octaves; ++o)
+	{
+		Frequency *= Lacunarity;
+		Amplitude *= Gain;
+		Sum += Amplitude * glm::perlin(p * Frequency);
+	}
+	return Sum;
+}
+
+template<glm::length_t L, typename T>
+static T fbm_simplex(glm::vec<L, T, glm::defaultp> const& p, int Octaves, T Lacunarity, T Gain)
+{
+	T Sum = glm::simplex(p);
+	T Frequency = T(1);
+	T Amplitude = T(1);
+	for(int o = 1; o < Octaves; ++o)
+	{
+		Frequency *= Lacunarity;
+		Amplitude *= Gain;
+		Sum += Amplitude * glm::simplex(p * Frequency);
+	}
+	return Sum;
+}
+
+template<glm::length_t L, typename T>
+static int test_noise()
+{
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-5);
+
+	for(std::size_t Count : Counts)
+	{
+		glm::vec_soa<L, T> const Points = make_points<L, T>(Count);
+
+		// An extra element checks that nothing is written past the end
+		std::vector<T> Perlin(Count + 1, T(7));
+		glm::perlin(Points, Perlin.data());
+		std::vector<T> Simplex(Count + 1, T(7));
+		glm::simplex(Points, Simplex.data());
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::equal(Perlin[i], glm::perlin(Points.load(i)), Epsilon) ? 0 : 1;
+			Error += glm::equal(Simplex[i], glm::simplex(Points.load(i)), Epsilon) ? 0 : 1;
+		}
+		Error += glm::equal(Perlin[Count], T(7), T(0)) ? 0 : 1;
+		Error += glm::equal(Simplex[Count], T(7), T(0)) ? 0 : 1;
+	}
+
+	// The noises don't depend on where the points are in the arrays, only writable views can be sliced
+	glm::vec_soa<L, T> Points = make_points<L, T>(16);
+	std::vector<T> All(16);
+	glm::perlin(Points, All.data());
+	std::vector<T> Slice(13);
+	glm::perlin(Points.slice(3, 13), Slice.data());
+	for(std::size_t i = 0; i < 13; ++i)
+		Error += glm::equal(Slice[i], All[i + 3], T(0)) ? 0 : 1;
+
+	return Error;
+}
+
+template<glm::length_t L, typename T>
+static int test_fbm()
+{
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(1e-5);
+
+	for(std::size_t Count : Counts)
+	{
+		glm::vec_soa<L, T> const Points = make_points<L, T>(Count);
+
+		for(int Octaves = 1; Octaves <= 5; Octaves += 2)
+		{
+			std::vector<T> Perlin(Count + 1, T(7));
+			glm::perlinFbm(Points, Octaves, T(2), T(0.5), Perlin.data());
+			std::vector<T> Simplex(Count + 1, T(7));
+			glm::simplexFbm(Points, Octaves, T(1.9), T(0.6), Simplex.data());
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += glm::equal(Perlin[i], fbm_perlin(Points.load(i), Octaves, T(2), T(0.5)), Epsilon) ? 0 : 1;
+				Error += glm::equal(Simplex[i], fbm_simplex(Points.load(i), Octaves, T(1.9), T(0.6)), Epsilon) ? 0 : 1;
+			}
+			Error += glm::equal(Perlin[Count], T(7), T(0)) ? 0 : 1;
+			Error += glm::equal(Simplex[Count], T(7), T(0)) ? 0 : 1;
+		}
+
+		// A single octave is the noise itself
+		std::vector<T> Noise(Count);
+		glm::perlin(Points, Noise.data());
+		std::vector<T> Fbm(Count);
+		glm::perlinFbm(Points, 1, T(2), T(0.5), Fbm.data());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::equal(Fbm[i], Noise[i], T(0)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_noise<2, float>();
+	Error += test_noise<3, float>();
+	Error += test_noise<4, float>();
+	Error += test_noise<3, double>();
+	Error += test_fbm<2, float>();
+	Error += test_fbm<3, float>();
+	Error += test_fbm<4, float>();
+	Error += test_fbm<4, double>();
+
+	return Error;
+}
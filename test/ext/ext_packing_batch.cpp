@@ -0,0 +1,228 @@
+#include <glm/ext/packing_batch.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+#include <cstring>
+
+static glm::packing_format const Formats[] =
+{
+	glm::packing_unorm4x8,
+	glm::packing_snorm4x8,
+	glm::packing_unorm2x16,
+	glm::packing_snorm2x16,
+	glm::packing_unorm4x16,
+	glm::packing_snorm4x16,
+	glm::packing_half2x16,
+	glm::packing_half4x16,
+	glm::packing_unorm3x10_1x2,
+	glm::packing_snorm3x10_1x2,
+	glm::packing_unorm1x5_1x6_1x5,
+	glm::packing_f2x11_1x10,
+	glm::packing_f3x9_e1x5
+};
+
+template<typename packType>
+static void store(unsigned char* out, packType Packed)
+{
+	std::memcpy(out, &Packed, sizeof(Packed));
+}
+
+template<typename packType>
+static packType load(unsigned char const* in)
+{
+	packType Packed = 0;
+	std::memcpy(&Packed, in, sizeof(Packed));
+	return Packed;
+}
+
+template<glm::length_t L>
+static void store(float* out, glm::vec<L, float, glm::defaultp> const& v)
+{
+	for(glm::length_t c = 0; c < L; ++c)
+		out[c] = v[c];
+}
+
+// Expected results, from the single element functions
+static void pack_element(glm::packing_format Format, float const* in, unsigned char* out)
+{
+	glm::vec2 const v2(in[0], in[1]);
+	glm::vec3 const v3(in[0], in[1], in[2]);
+	glm::vec4 const v4(in[0], in[1], in[2], in[3]);
+
+	switch(Format)
+	{
+	case glm::packing_unorm4x8: store(out, glm::packUnorm4x8(v4)); break;
+	case glm::packing_snorm4x8: store(out, glm::packSnorm4x8(v4)); break;
+	case glm::packing_unorm2x16: store(out, glm::packUnorm2x16(v2)); break;
+	case glm::packing_snorm2x16: store(out, glm::packSnorm2x16(v2)); break;
+	case glm::packing_unorm4x16: store(out, glm::packUnorm4x16(v4)); break;
+	case glm::packing_snorm4x16: store(out, glm::packSnorm4x16(v4)); break;
+	case glm::packing_half2x16: store(out, glm::packHalf2x16(v2)); break;
+	case glm::packing_half4x16: store(out, glm::packHalf4x16(v4)); break;
+	case glm::packing_unorm3x10_1x2: store(out, glm::packUnorm3x10_1x2(v4)); break;
+	case glm::packing_snorm3x10_1x2: store(out, glm::packSnorm3x10_1x2(v4)); break;
+	case glm::packing_unorm1x5_1x6_1x5: store(out, glm::packUnorm1x5_1x6_1x5(v3)); break;
+	case glm::packing_f2x11_1x10: store(out, glm::packF2x11_1x10(v3)); break;
+	case glm::packing_f3x9_e1x5: store(out, glm::packF3x9_E1x5(v3)); break;
+	}
+}
+
+static void unpack_element(glm::packing_format Format, unsigned char const* in, float* out)
+{
+	switch(Format)
+	{
+	case glm::packing_unorm4x8: store(out, glm::unpackUnorm4x8(load<glm::uint>(in))); break;
+	case glm::packing_snorm4x8: store(out, glm::unpackSnorm4x8(load<glm::uint>(in))); break;
+	case glm::packing_unorm2x16: store(out, glm::unpackUnorm2x16(load<glm::uint>(in))); break;
+	case glm::packing_snorm2x16: store(out, glm::unpackSnorm2x16(load<glm::uint>(in))); break;
+	case glm::packing_unorm4x16: store(out, glm::unpackUnorm4x16(load<glm::uint64>(in))); break;
+	case glm::packing_snorm4x16: store(out, glm::unpackSnorm4x16(load<glm::uint64>(in))); break;
+	case glm::packing_half2x16: store(out, glm::unpackHalf2x16(load<glm::uint>(in))); break;
+	case glm::packing_half4x16: store(out, glm::unpackHalf4x16(load<glm::uint64>(in))); break;
+	case glm::packing_unorm3x10_1x2: store(out, glm::unpackUnorm3x10_1x2(load<glm::uint32>(in))); break;
+	case glm::packing_snorm3x10_1x2: store(out, glm::unpackSnorm3x10_1x2(load<glm::uint32>(in))); break;
+	case glm::packing_unorm1x5_1x6_1x5: store(out, glm::unpackUnorm1x5_1x6_1x5(load<glm::uint16>(in))); break;
+	case glm::packing_f2x11_1x10: store(out, glm::unpackF2x11_1x10(load<glm::uint32>(in))); break;
+	case glm::packing_f3x9_e1x5: store(out, glm::unpackF3x9_E1x5(load<glm::uint32>(in))); break;
+	}
+}
+
+static int test_layout()
+{
+	int Error = 0;
+
+	Error += glm::packingComponents(glm::packing_unorm4x8) == 4 ? 0 : 1;
+	Error += glm::packingComponents(glm::packing_half2x16) == 2 ? 0 : 1;
+	Error += glm::packingComponents(glm::packing_unorm1x5_1x6_1x5) == 3 ? 0 : 1;
+	Error += glm::packingComponents(glm::packing_f3x9_e1x5) == 3 ? 0 : 1;
+	Error += glm::packingSize(glm::packing_unorm1x5_1x6_1x5) == 2 ? 0 : 1;
+	Error += glm::packingSize(glm::packing_snorm3x10_1x2) == 4 ? 0 : 1;
+	Error += glm::packingSize(glm::packing_half4x16) == 8 ? 0 : 1;
+	Error += glm::packingSize(glm::packing_unorm4x16) == 8 ? 0 : 1;
+
+	return Error;
+}
+
+// Inputs are interleaved in 5 floats vertices, outputs are unaligned and separated by padding bytes that must be left untouched
+static int test_pack()
+{
+	int Error = 0;
+
+	std::size_t const Count = 37;
+	std::size_t const InStride = 5 * sizeof(float);
+
+	std::vector<float> In(Count * 5);
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = static_cast<float>(static_cast<int>((i * 37) % 101) - 50) / 40.0f;
+
+	// Halfway cases, out of range and special values
+	In[0] = 0.5f / 255.0f;
+	In[1] = 1.5f / 127.0f;
+	In[2] = -0.5f;
+	In[3] = 1.0f;
+	In[5] = -1.0f;
+	In[6] = 0.0f;
+	In[7] = -0.0f;
+	In[8] = 1000.0f;
+	In[10] = 65504.0f;
+	In[11] = 1.0e-6f;
+	In[12] = 0.5f / 31.0f;
+	In[13] = -1000.0f;
+
+	for(glm::packing_format Format : Formats)
+	{
+		std::size_t const Size = glm::packingSize(Format);
+		std::size_t const OutStride = Size + 3;
+
+		for(std::size_t n = 0; n <= Count; n += (n < 9 ? 1 : 7))
+		{
+			std::vector<unsigned char> Out(Count * OutStride + 1, 0xcd);
+			glm::packBatch(Format, &In[0], InStride, &Out[1], OutStride, n);
+
+			std::vector<unsigned char> Expected(Count * OutStride + 1, 0xcd);
+			for(std::size_t i = 0; i < n; ++i)
+				pack_element(Format, &In[i * 5], &Expected[1 + i * OutStride]);
+
+			Error += std::memcmp(&Out[0], &Expected[0], Out.size()) == 0 ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+static int test_unpack()
+{
+	int Error = 0;
+
+	std::size_t const Count = 37;
+	std::size_t const OutStride = 5 * sizeof(float);
+
+	for(glm::packing_format Format : Formats)
+	{
+		std::size_t const Size = glm::packingSize(Format);
+		std::size_t const InStride = Size + 3;
+
+		std::vector<unsigned char> In(Count * InStride + 1);
+		glm::uint32 Seed = 7;
+		for(std::size_t i = 0; i < In.size(); ++i)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			In[i] = static_cast<unsigned char>(Seed >> 24);
+		}
+
+		for(std::size_t n = 0; n <= Count; n += (n < 9 ? 1 : 7))
+		{
+			std::vector<float> Out(Count * 5, 7.0f);
+			glm::unpackBatch(Format, &In[1], InStride, &Out[0], OutStride, n);
+
+			std::vector<float> Expected(Count * 5, 7.0f);
+			for(std::size_t i = 0; i < n; ++i)
+				unpack_element(Format, &In[1 + i * InStride], &Expected[i * 5]);
+
+			// Bitwise comparison, NaN half floats included
+			Error += std::memcmp(&Out[0], &Expected[0], Out.size() * sizeof(float)) == 0 ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// Unpacking then packing again gives back the packed values
+static int test_round_trip()
+{
+	int Error = 0;
+
+	std::size_t const Count = 64;
+
+	glm::packing_format const RoundTrip[] = {glm::packing_unorm4x8, glm::packing_snorm2x16, glm::packing_unorm4x16, glm::packing_unorm3x10_1x2, glm::packing_unorm1x5_1x6_1x5};
+	for(glm::packing_format Format : RoundTrip)
+	{
+		std::size_t const Size = glm::packingSize(Format);
+		std::size_t const L = static_cast<std::size_t>(glm::packingComponents(Format));
+
+		std::vector<unsigned char> Packed(Count * Size);
+		for(std::size_t i = 0; i < Packed.size(); ++i)
+			Packed[i] = static_cast<unsigned char>(i * 29 + 3);
+
+		std::vector<float> Unpacked(Count * L);
+		glm::unpackBatch(Format, &Packed[0], Size, &Unpacked[0], L * sizeof(float), Count);
+
+		std::vector<unsigned char> Repacked(Count * Size);
+		glm::packBatch(Format, &Unpacked[0], L * sizeof(float), &Repacked[0], Size, Count);
+
+		Error += Packed == Repacked ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_layout();
+	Error += test_pack();
+	Error += test_unpack();
+	Error += test_round_trip();
+
+	return Error;
+}
@@ -0,0 +1,190 @@
+#include <glm/ext/quaternion_batch.hpp>
+#include <glm/ext/quaternion_common.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_constants.hpp>
+#include <vector>
+#include <cstddef>
+
+static std::size_t const Counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 64, 67};
+
+template<typename T>
+static glm::qua<T, glm::defaultp> make_quat(std::size_t i)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	T const Angle = static_cast<T>(i) * T(0.37) - T(3);
+	vec3 const Axis = glm::normalize(vec3(T(1), T(i % 5) - T(2), T(0.5) + T(i % 3)));
+	glm::qua<T, glm::defaultp> const Result = glm::angleAxis(Angle, Axis);
+
+	// Both hemispheres so that slerp and nlerp take the shortest path on some elements and not on others
+	return (i % 3 == 0) ? -Result : Result;
+}
+
+template<typename T>
+static glm::vec<3, T, glm::defaultp> make_vec3(std::size_t i)
+{
+	return glm::vec<3, T, glm::defaultp>(static_cast<T>(i) * T(0.25) - T(2), T(1.5) - static_cast<T>(i % 7), T(0.75) + static_cast<T>(i % 4));
+}
+
+template<typename T>
+static int test_slerp()
+{
+	typedef glm::qua<T, glm::defaultp> quat;
+
+	int Error = 0;
+
+	for(std::size_t Count : Counts)
+	{
+		std::vector<quat> X(Count + 1), Y(Count + 1), Out(Count + 1, quat(T(7), T(7), T(7), T(7)));
+		std::vector<T> A(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = make_quat<T>(i);
+			// Some elements are close enough for slerp to fall back to a linear interpolation
+			Y[i] = (i % 4 == 1) ? X[i] : make_quat<T>(i * 7 + 3);
+			A[i] = static_cast<T>(i % 11) / T(10);
+		}
+
+		glm::slerp(X.data(), Y.data(), T(0.3), Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], glm::slerp(X[i], Y[i], T(0.3)), T(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], quat(T(7), T(7), T(7), T(7)))) ? 0 : 1;
+
+		glm::slerp(X.data(), Y.data(), A.data(), Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], glm::slerp(X[i], Y[i], A[i]), T(0.0001))) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], quat(T(7), T(7), T(7), T(7)))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_nlerp()
+{
+	typedef glm::qua<T, glm::defaultp> quat;
+
+	int Error = 0;
+
+	for(std::size_t Count : Counts)
+	{
+		std::vector<quat> X(Count + 1), Y(Count + 1), Out(Count + 1, quat(T(7), T(7), T(7), T(7)));
+		std::vector<T> A(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = make_quat<T>(i);
+			Y[i] = make_quat<T>(i * 5 + 1);
+			A[i] = static_cast<T>(i % 9) / T(8);
+		}
+
+		glm::nlerp(X.data(), Y.data(), A.data(), Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			quat const Z = glm::dot(X[i], Y[i]) < T(0) ? -Y[i] : Y[i];
+			quat const Expected = glm::normalize(X[i] * (T(1) - A[i]) + Z * A[i]);
+			Error += glm::all(glm::equal(Out[i], Expected, T(0.00001))) ? 0 : 1;
+		}
+		Error += glm::all(glm::equal(Out[Count], quat(T(7), T(7), T(7), T(7)))) ? 0 : 1;
+
+		// The end points are reproduced up to the shortest path sign
+		glm::nlerp(X.data(), Y.data(), T(1), Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::abs(glm::abs(glm::dot(Out[i], Y[i])) - T(1)) < T(0.0001) ? 0 : 1;
+	}
+
+	// Like normalize, a zero length interpolation gives the identity
+	std::vector<quat> Zero(5, quat(T(0), T(0), T(0), T(0))), Y(5, make_quat<T>(1)), Out(5);
+	glm::nlerp(Zero.data(), Y.data(), T(0), Out.data(), 5);
+	for(std::size_t i = 0; i < 5; ++i)
+		Error += glm::all(glm::equal(Out[i], quat(T(1), T(0), T(0), T(0)))) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_transform()
+{
+	typedef glm::qua<T, glm::defaultp> quat;
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	int Error = 0;
+
+	for(std::size_t Count : Counts)
+	{
+		std::vector<quat> Q(Count + 1);
+		std::vector<vec3> In(Count + 1), Out(Count + 1, vec3(T(7)));
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Q[i] = make_quat<T>(i);
+			In[i] = make_vec3<T>(i);
+		}
+
+		glm::transform(Q.data(), In.data(), Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], Q[i] * In[i], T(0.00001))) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], vec3(T(7)), T(0))) ? 0 : 1;
+
+		quat const R = make_quat<T>(Count + 2);
+		glm::transform(R, In.data(), Out.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], R * In[i], T(0.00001))) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], vec3(T(7)), T(0))) ? 0 : 1;
+
+		// In place
+		std::vector<vec3> InOut(In);
+		glm::transform(Q.data(), InOut.data(), InOut.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(InOut[i], Q[i] * In[i], T(0.00001))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_mat_cast()
+{
+	typedef glm::qua<T, glm::defaultp> quat;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	for(std::size_t Count : Counts)
+	{
+		std::vector<quat> Q(Count + 1);
+		std::vector<mat3> Out3(Count + 1, mat3(T(7)));
+		std::vector<mat4> Out4(Count + 1, mat4(T(7)));
+		for(std::size_t i = 0; i < Count; ++i)
+			Q[i] = make_quat<T>(i);
+
+		glm::mat3_cast(Q.data(), Out3.data(), Count);
+		glm::mat4_cast(Q.data(), Out4.data(), Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Out3[i], glm::mat3_cast(Q[i]), T(0.00001))) ? 0 : 1;
+			Error += glm::all(glm::equal(Out4[i], glm::mat4_cast(Q[i]), T(0.00001))) ? 0 : 1;
+		}
+		Error += glm::all(glm::equal(Out3[Count], mat3(T(7)), T(0))) ? 0 : 1;
+		Error += glm::all(glm::equal(Out4[Count], mat4(T(7)), T(0))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_slerp<float>();
+	Error += test_slerp<double>();
+	Error += test_nlerp<float>();
+	Error += test_nlerp<double>();
+	Error += test_transform<float>();
+	Error += test_transform<double>();
+	Error += test_mat_cast<float>();
+	Error += test_mat_cast<double>();
+
+	return Error;
+}
@@ -0,0 +1,32 @@
+#include <glm/ext/scalar_trigonometric.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/scalar_constants.hpp>
+
+template<typename T>
+static int test_sincos()
+{
+	int Error = 0;
+
+	for(int i = -64; i < 64; ++i)
+	{
+		T const Angle = static_cast<T>(i) * glm::pi<T>() / static_cast<T>(12);
+
+		T s, c;
+		glm::sincos(Angle, s, c);
+
+		Error += glm::equal(s, glm::sin(Angle), 0) ? 0 : 1;
+		Error += glm::equal(c, glm::cos(Angle), 0) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_sincos<float>();
+	Error += test_sincos<double>();
+
+	return Error;
+}
@@ -0,0 +1,186 @@
+#define GLM_FORCE_SIMD_DISPATCH
+#include <glm/ext/simd_dispatch.hpp>
+#include <glm/ext/matrix_batch.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+
+static glm::simd_isa const ISAs[] = {glm::simd_isa_default, glm::simd_isa_avx, glm::simd_isa_avx2, glm::simd_isa_avx512};
+
+static int test_detect()
+{
+	int Error = 0;
+
+	glm::simd_isa const ISA = glm::detectSimdISA();
+	Error += ISA >= glm::simd_isa_default && ISA <= glm::simd_isa_avx512 ? 0 : 1;
+	Error += glm::detectSimdISA() == ISA ? 0 : 1;
+
+#	if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+		Error += glm::selectedSimdISA() == ISA ? 0 : 1;
+#	else
+		Error += glm::selectedSimdISA() == glm::simd_isa_default ? 0 : 1;
+#	endif
+
+	return Error;
+}
+
+static int test_force()
+{
+	int Error = 0;
+
+	glm::simd_isa const Detected = glm::detectSimdISA();
+
+	for(std::size_t i = 0; i < sizeof(ISAs) / sizeof(ISAs[0]); ++i)
+	{
+		glm::forceSimdISA(ISAs[i]);
+
+#		if GLM_CONFIG_SIMD_DISPATCH == GLM_ENABLE
+			Error += glm::selectedSimdISA() == (ISAs[i] < Detected ? ISAs[i] : Detected) ? 0 : 1;
+#		else
+			Error += glm::selectedSimdISA() == glm::simd_isa_default ? 0 : 1;
+#		endif
+	}
+
+	glm::forceSimdISA(Detected);
+
+	return Error;
+}
+
+template<typename vecType>
+static vecType make_vector(std::size_t i)
+{
+	vecType Result;
+	for(glm::length_t c = 0; c < vecType::length(); ++c)
+		Result[c] = static_cast<float>(static_cast<int>((i * 7 + static_cast<std::size_t>(c) * 3) % 23) - 11) * 0.125f;
+	return Result;
+}
+
+// All kernels use the same operation order, their results must be bitwise identical
+template<typename vecType>
+static int test_transform()
+{
+	int Error = 0;
+
+	glm::mat4 const M(
+		0.5f, -1.25f, 2.0f, 0.0f,
+		1.5f, 0.75f, -0.5f, 0.0f,
+		-2.0f, 0.25f, 1.125f, 0.0f,
+		3.0f, -4.0f, 5.5f, 1.0f);
+
+	std::size_t const Count = 37;
+	std::vector<vecType> In(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = make_vector<vecType>(i);
+
+	glm::forceSimdISA(glm::simd_isa_default);
+	std::vector<vecType> Expected(Count);
+	glm::transform(M, &In[0], &Expected[0], Count);
+
+	for(std::size_t i = 0; i < sizeof(ISAs) / sizeof(ISAs[0]); ++i)
+	{
+		glm::forceSimdISA(ISAs[i]);
+
+		for(std::size_t n = 0; n <= Count; ++n)
+		{
+			std::vector<vecType> Out(Count, vecType(-1.0f));
+			glm::transform(M, &In[0], &Out[0], n);
+
+			for(std::size_t j = 0; j < n; ++j)
+				Error += glm::all(glm::equal(Out[j], Expected[j], 0.0f)) ? 0 : 1;
+			for(std::size_t j = n; j < Count; ++j)
+				Error += glm::all(glm::equal(Out[j], vecType(-1.0f), 0.0f)) ? 0 : 1;
+		}
+	}
+
+	glm::forceSimdISA(glm::detectSimdISA());
+
+	return Error;
+}
+
+// All the matrix product kernels use the operation order of operator*, indexed or not
+static int test_multiply()
+{
+	int Error = 0;
+
+	std::size_t const Count = 13;
+	std::vector<glm::mat4> A(Count), B(Count), Expected(Count);
+	std::vector<unsigned int> Indices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		for(glm::length_t c = 0; c < 4; ++c)
+		{
+			A[i][c] = make_vector<glm::vec4>(i * 4 + static_cast<std::size_t>(c));
+			B[i][c] = make_vector<glm::vec4>(i * 4 + static_cast<std::size_t>(c) + 100);
+		}
+		Indices[i] = static_cast<unsigned int>((i * 5) % Count);
+	}
+
+	for(std::size_t i = 0; i < sizeof(ISAs) / sizeof(ISAs[0]); ++i)
+	{
+		glm::forceSimdISA(ISAs[i]);
+
+		std::vector<glm::mat4> Out(Count), Indexed(Count);
+		glm::multiply(&A[0], &B[0], &Out[0], Count);
+		glm::multiply(&A[0], &Indices[0], &B[0], &Indexed[0], Count);
+		for(std::size_t j = 0; j < Count; ++j)
+		{
+			Error += Out[j] == A[j] * B[j] ? 0 : 1;
+			Error += Indexed[j] == A[Indices[j]] * B[j] ? 0 : 1;
+		}
+	}
+
+	glm::forceSimdISA(glm::detectSimdISA());
+
+	return Error;
+}
+
+// The half float kernels of all instruction sets convert like packHalf1x16 and unpackHalf1x16
+static int test_half()
+{
+	int Error = 0;
+
+	std::size_t const Count = 37;
+	std::vector<float> Floats(Count);
+	std::vector<glm::uint16> Halves(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Floats[i] = static_cast<float>(static_cast<int>(i) - 18) * 0.0625f + 0.00048828125f;
+		Halves[i] = static_cast<glm::uint16>(i * 1777);
+	}
+
+	for(std::size_t i = 0; i < sizeof(ISAs) / sizeof(ISAs[0]); ++i)
+	{
+		glm::forceSimdISA(ISAs[i]);
+
+		std::vector<glm::uint16> Packed(Count);
+		glm::packHalf(&Floats[0], &Packed[0], Count);
+		for(std::size_t j = 0; j < Count; ++j)
+			Error += Packed[j] == glm::packHalf1x16(Floats[j]) ? 0 : 1;
+
+		std::vector<float> Unpacked(Count);
+		glm::unpackHalf(&Halves[0], &Unpacked[0], Count);
+		for(std::size_t j = 0; j < Count; ++j)
+			Error += glm::packHalf1x16(Unpacked[j]) == Halves[j] ? 0 : 1;
+	}
+
+	glm::forceSimdISA(glm::detectSimdISA());
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_detect();
+	Error += test_force();
+	Error += test_transform<glm::vec3>();
+	Error += test_transform<glm::vec4>();
+	Error += test_multiply();
+	Error += test_half();
+
+	return Error;
+}
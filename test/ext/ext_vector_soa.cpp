@@ -0,0 +1,321 @@
+#include <glm/ext/vector_soa.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+static std::size_t const Counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 64, 67};
+
+template<glm::length_t L, typename T>
+static glm::vec<L, T, glm::defaultp> make_vec(std::size_t i)
+{
+	glm::vec<L, T, glm::defaultp> Result;
+	for(glm::length_t c = 0; c < L; ++c)
+		Result[c] = static_cast<T>((i * 7 + static_cast<std::size_t>(c) * 3) % 19) * T(0.25) - T(2);
+	return Result;
+}
+
+// Const arrays, views and containers only convert to read-only views
+template<typename viewType>
+struct slice_type
+{
+	typedef decltype(std::declval<viewType&>().slice(0, 0)) type;
+};
+
+static_assert(std::is_same<slice_type<glm::vec3_soa_view>::type, glm::vec3_soa_view>::value, "vec_soa_view slices aren't writable");
+static_assert(std::is_same<slice_type<glm::vec3_soa>::type, glm::vec3_soa_view>::value, "vec_soa slices aren't writable");
+static_assert(std::is_same<slice_type<glm::vec3_soa_view const>::type, glm::vec3_soa_const_view>::value, "const vec_soa_view can be sliced into a writable view");
+static_assert(std::is_same<slice_type<glm::vec3_soa const>::type, glm::vec3_soa_const_view>::value, "const vec_soa can be sliced into a writable view");
+static_assert(std::is_same<slice_type<glm::vec3_soa_const_view>::type, glm::vec3_soa_const_view>::value, "vec_soa_const_view slices aren't read-only");
+
+static_assert(std::is_constructible<glm::vec3_soa_view, glm::vec3_soa&>::value, "vec_soa doesn't convert to vec_soa_view");
+static_assert(!std::is_constructible<glm::vec3_soa_view, glm::vec3_soa const&>::value, "const vec_soa converts to vec_soa_view");
+static_assert(!std::is_constructible<glm::vec3_soa_view, glm::vec3_soa_view const&>::value, "const vec_soa_view converts to vec_soa_view");
+static_assert(!std::is_constructible<glm::vec3_soa_view, glm::vec3_soa_const_view const&>::value, "vec_soa_const_view converts to vec_soa_view");
+static_assert(!std::is_assignable<glm::vec3_soa_view&, glm::vec3_soa_view const&>::value, "const vec_soa_view can be assigned to vec_soa_view");
+static_assert(std::is_constructible<glm::vec3_soa_const_view, glm::vec3_soa const&>::value, "const vec_soa doesn't convert to vec_soa_const_view");
+static_assert(std::is_constructible<glm::vec3_soa_const_view, glm::vec3_soa_view const&>::value, "const vec_soa_view doesn't convert to vec_soa_const_view");
+
+template<typename inType, typename outType, typename = void>
+struct can_normalize : public std::false_type{};
+
+template<typename inType, typename outType>
+struct can_normalize<inType, outType, decltype(void(glm::normalize(std::declval<inType>(), std::declval<outType>())))> : public std::true_type{};
+
+static_assert(can_normalize<glm::vec3_soa const&, glm::vec3_soa&>::value, "normalize doesn't read const vec_soa");
+static_assert(can_normalize<glm::vec3_soa_const_view const&, glm::vec3_soa_view>::value, "normalize doesn't read vec_soa_const_view");
+static_assert(!can_normalize<glm::vec3_soa const&, glm::vec3_soa const&>::value, "normalize writes to const vec_soa");
+static_assert(!can_normalize<glm::vec3_soa const&, glm::vec3_soa_view const&>::value, "normalize writes to const vec_soa_view");
+
+template<glm::length_t L, typename T>
+static int test_view()
+{
+	typedef glm::vec<L, T, glm::defaultp> vec_type;
+
+	int Error = 0;
+
+	// View of arrays owned by the caller
+	std::vector<T> Storage(L * 5);
+	T* Data[L];
+	for(glm::length_t c = 0; c < L; ++c)
+		Data[c] = &Storage[static_cast<std::size_t>(c) * 5];
+	glm::vec_soa_view<L, T> View(Data, 5);
+
+	Error += View.size() == 5 ? 0 : 1;
+	Error += !View.empty() ? 0 : 1;
+	Error += glm::vec_soa_view<L, T>::length() == L ? 0 : 1;
+	Error += glm::vec_soa_view<L, T>().empty() ? 0 : 1;
+
+	for(std::size_t i = 0; i < 5; ++i)
+		View.store(i, make_vec<L, T>(i));
+	for(std::size_t i = 0; i < 5; ++i)
+	{
+		Error += glm::all(glm::equal(View.load(i), make_vec<L, T>(i))) ? 0 : 1;
+		for(glm::length_t c = 0; c < L; ++c)
+			Error += glm::equal(Storage[static_cast<std::size_t>(c) * 5 + i], make_vec<L, T>(i)[c], T(0)) ? 0 : 1;
+	}
+
+	// Slices reference the same arrays
+	glm::vec_soa_view<L, T> Slice = View.slice(2, 3);
+	Error += Slice.size() == 3 ? 0 : 1;
+	Error += Slice[0] == View[0] + 2 ? 0 : 1;
+	Slice.store(0, vec_type(T(9)));
+	Error += glm::all(glm::equal(View.load(2), vec_type(T(9)))) ? 0 : 1;
+
+	// Read-only views of const arrays
+	T const* const ConstData[L] = {};
+	glm::vec_soa_const_view<L, T> const ConstView(Data, 5);
+	Error += ConstView.size() == 5 && ConstView[0] == View[0] ? 0 : 1;
+	Error += glm::vec_soa_const_view<L, T>(ConstData, 0).empty() ? 0 : 1;
+	glm::vec_soa_const_view<L, T> const ConstSlice = ConstView.slice(2, 3);
+	Error += ConstSlice.size() == 3 && ConstSlice[0] == View[0] + 2 ? 0 : 1;
+	Error += glm::all(glm::equal(ConstSlice.load(0), vec_type(T(9)))) ? 0 : 1;
+
+	return Error;
+}
+
+template<glm::length_t L, typename T>
+static int test_container()
+{
+	typedef glm::vec<L, T, glm::defaultp> vec_type;
+
+	int Error = 0;
+
+	glm::vec_soa<L, T> Empty;
+	Error += Empty.empty() ? 0 : 1;
+
+	glm::vec_soa<L, T> Zero(7);
+	Error += Zero.size() == 7 ? 0 : 1;
+	for(std::size_t i = 0; i < 7; ++i)
+		Error += glm::all(glm::equal(Zero.load(i), vec_type(T(0)))) ? 0 : 1;
+
+	for(std::size_t Count : Counts)
+	{
+		std::vector<vec_type> In(Count + 1);
+		for(std::size_t i = 0; i < Count; ++i)
+			In[i] = make_vec<L, T>(i);
+
+		glm::vec_soa<L, T> Soa(In.data(), Count);
+		Error += Soa.size() == Count ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Soa.load(i), In[i])) ? 0 : 1;
+
+		std::vector<vec_type> Out(Count + 1, vec_type(T(7)));
+		glm::interleave(Soa, Out.data());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Out[i], In[i])) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[Count], vec_type(T(7)))) ? 0 : 1;
+
+		// Copies own their arrays
+		glm::vec_soa<L, T> Copy(Soa);
+		if(Count > 0)
+		{
+			Copy.store(0, vec_type(T(5)));
+			Error += glm::all(glm::equal(Soa.load(0), In[0])) ? 0 : 1;
+			Error += Copy[0] != Soa[0] ? 0 : 1;
+		}
+
+		glm::vec_soa<L, T> Moved(std::move(Copy));
+		Error += Moved.size() == Count ? 0 : 1;
+		Error += Copy.empty() ? 0 : 1;
+
+		Copy = Soa;
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Copy.load(i), In[i])) ? 0 : 1;
+
+		// Resizing keeps the existing vectors
+		Soa.resize(Count + 3);
+		Error += Soa.size() == Count + 3 ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Soa.load(i), In[i])) ? 0 : 1;
+		for(std::size_t i = Count; i < Count + 3; ++i)
+			Error += glm::all(glm::equal(Soa.load(i), vec_type(T(0)))) ? 0 : 1;
+		Soa.resize(Count / 2);
+		for(std::size_t i = 0; i < Count / 2; ++i)
+			Error += glm::all(glm::equal(Soa.load(i), In[i])) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<glm::length_t L, typename T>
+static int test_geometric()
+{
+	typedef glm::vec<L, T, glm::defaultp> vec_type;
+
+	T const Epsilon = static_cast<T>(0.00001);
+
+	int Error = 0;
+
+	for(std::size_t Count : Counts)
+	{
+		std::vector<vec_type> X(Count), Y(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = make_vec<L, T>(i);
+			Y[i] = make_vec<L, T>(i * 3 + 1) + vec_type(T(0.125));
+		}
+		glm::vec_soa<L, T> SoaX(X.data(), Count);
+		glm::vec_soa<L, T> SoaY(Y.data(), Count);
+
+		std::vector<T> Out(Count + 1, T(7));
+		glm::dot(SoaX, SoaY, Out.data());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::equal(Out[i], glm::dot(X[i], Y[i]), Epsilon) ? 0 : 1;
+		Error += glm::equal(Out[Count], T(7), Epsilon) ? 0 : 1;
+
+		glm::length(SoaX, Out.data());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::equal(Out[i], glm::length(X[i]), Epsilon) ? 0 : 1;
+		Error += glm::equal(Out[Count], T(7), Epsilon) ? 0 : 1;
+
+		glm::distance(SoaX, SoaY, Out.data());
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::equal(Out[i], glm::distance(X[i], Y[i]), Epsilon) ? 0 : 1;
+		Error += glm::equal(Out[Count], T(7), Epsilon) ? 0 : 1;
+
+		// Compared to a division by the length, the aligned vec4 normalize approximates the reciprocal square root
+		glm::vec_soa<L, T> Result(Count);
+		glm::normalize(SoaY, Result);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Result.load(i), Y[i] / glm::length(Y[i]), Epsilon)) ? 0 : 1;
+
+		// In place
+		glm::normalize(SoaY, SoaY);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(SoaY.load(i), Y[i] / glm::length(Y[i]), Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_cross()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	T const Epsilon = static_cast<T>(0.00001);
+
+	int Error = 0;
+
+	for(std::size_t Count : Counts)
+	{
+		std::vector<vec3> X(Count), Y(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = make_vec<3, T>(i);
+			Y[i] = make_vec<3, T>(i * 5 + 2);
+		}
+		glm::vec_soa<3, T> SoaX(X.data(), Count);
+		glm::vec_soa<3, T> SoaY(Y.data(), Count);
+
+		glm::vec_soa<3, T> Result(Count);
+		glm::cross(SoaX, SoaY, Result);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Result.load(i), glm::cross(X[i], Y[i]), Epsilon)) ? 0 : 1;
+
+		// In place, the output is one of the inputs
+		glm::cross(SoaX, SoaY, SoaX);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(SoaX.load(i), glm::cross(X[i], Y[i]), Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<glm::length_t L, typename T>
+static int test_common()
+{
+	typedef glm::vec<L, T, glm::defaultp> vec_type;
+
+	T const Epsilon = static_cast<T>(0.00001);
+
+	int Error = 0;
+
+	for(std::size_t Count : Counts)
+	{
+		std::vector<vec_type> X(Count), Y(Count);
+		std::vector<T> A(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = make_vec<L, T>(i);
+			Y[i] = make_vec<L, T>(i * 3 + 1);
+			A[i] = static_cast<T>(i % 9) / T(8);
+		}
+		glm::vec_soa<L, T> SoaX(X.data(), Count);
+		glm::vec_soa<L, T> SoaY(Y.data(), Count);
+		glm::vec_soa<L, T> Result(Count);
+
+		glm::mix(SoaX, SoaY, T(0.25), Result);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Result.load(i), glm::mix(X[i], Y[i], T(0.25)), Epsilon)) ? 0 : 1;
+
+		glm::mix(SoaX, SoaY, A.data(), Result);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Result.load(i), glm::mix(X[i], Y[i], A[i]), Epsilon)) ? 0 : 1;
+
+		glm::clamp(SoaX, T(-1), T(0.5), Result);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Result.load(i), glm::clamp(X[i], T(-1), T(0.5)))) ? 0 : 1;
+
+		// Only a slice of the outputs is written
+		if(Count > 2)
+		{
+			glm::vec_soa<L, T> Partial(Count);
+			glm::clamp(SoaX.slice(1, Count - 2), T(-1), T(0.5), Partial.slice(1, Count - 2));
+			Error += glm::all(glm::equal(Partial.load(0), vec_type(T(0)))) ? 0 : 1;
+			Error += glm::all(glm::equal(Partial.load(Count - 1), vec_type(T(0)))) ? 0 : 1;
+			for(std::size_t i = 1; i < Count - 1; ++i)
+				Error += glm::all(glm::equal(Partial.load(i), glm::clamp(X[i], T(-1), T(0.5)))) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_view<2, float>();
+	Error += test_view<3, float>();
+	Error += test_view<4, double>();
+	Error += test_container<2, float>();
+	Error += test_container<3, float>();
+	Error += test_container<4, float>();
+	Error += test_container<3, double>();
+	Error += test_geometric<2, float>();
+	Error += test_geometric<3, float>();
+	Error += test_geometric<4, float>();
+	Error += test_geometric<3, double>();
+	Error += test_cross<float>();
+	Error += test_cross<double>();
+	Error += test_common<2, float>();
+	Error += test_common<3, float>();
+	Error += test_common<4, float>();
+	Error += test_common<4, double>();
+
+	return Error;
+}
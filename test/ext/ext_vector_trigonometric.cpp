@@ -0,0 +1,84 @@
+#include <glm/ext/vector_trigonometric.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_float4.hpp>
+#include <glm/ext/vector_double4.hpp>
+#include <glm/ext/scalar_constants.hpp>
+#if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+#	include <glm/gtc/type_aligned.hpp>
+#endif
+#include <cmath>
+#include <limits>
+
+template<typename vecType>
+static int test_sincos()
+{
+	typedef typename vecType::value_type T;
+	int const MaxULPs = 4;
+
+	int Error = 0;
+
+	for(int i = -4000; i < 4000; ++i)
+	{
+		vecType const Angle(
+			static_cast<T>(i) * static_cast<T>(0.0161),
+			static_cast<T>(i) * static_cast<T>(-0.00327),
+			static_cast<T>(i) * glm::pi<T>() / static_cast<T>(256),
+			static_cast<T>(i) * static_cast<T>(0.25));
+
+		vecType s, c;
+		glm::sincos(Angle, s, c);
+
+		for(glm::length_t k = 0; k < 4; ++k)
+		{
+			Error += glm::all(glm::equal(glm::vec<1, T>(s[k]), glm::vec<1, T>(std::sin(Angle[k])), MaxULPs)) || std::abs(s[k]) < static_cast<T>(1e-6) ? 0 : 1;
+			Error += glm::all(glm::equal(glm::vec<1, T>(c[k]), glm::vec<1, T>(std::cos(Angle[k])), MaxULPs)) || std::abs(c[k]) < static_cast<T>(1e-6) ? 0 : 1;
+		}
+
+		Error += glm::all(glm::equal(s, glm::sin(Angle), 0)) ? 0 : 1;
+		Error += glm::all(glm::equal(c, glm::cos(Angle), 0)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Arguments outside of the range supported by the SIMD kernels must still match std::
+template<typename vecType>
+static int test_sincos_special()
+{
+	typedef typename vecType::value_type T;
+
+	int Error = 0;
+
+	vecType const Angle(static_cast<T>(0), static_cast<T>(-0.5), static_cast<T>(1e7), std::numeric_limits<T>::infinity());
+
+	vecType s, c;
+	glm::sincos(Angle, s, c);
+
+	for(glm::length_t k = 0; k < 3; ++k)
+	{
+		Error += glm::equal(glm::vec<1, T>(s[k]), glm::vec<1, T>(std::sin(Angle[k])), 1)[0] ? 0 : 1;
+		Error += glm::equal(glm::vec<1, T>(c[k]), glm::vec<1, T>(std::cos(Angle[k])), 1)[0] ? 0 : 1;
+	}
+	Error += std::isnan(s.w) && std::isnan(c.w) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_sincos<glm::vec4>();
+	Error += test_sincos<glm::dvec4>();
+	Error += test_sincos_special<glm::vec4>();
+	Error += test_sincos_special<glm::dvec4>();
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_sincos<glm::aligned_vec4>();
+		Error += test_sincos<glm::aligned_dvec4>();
+		Error += test_sincos_special<glm::aligned_vec4>();
+		Error += test_sincos_special<glm::aligned_dvec4>();
+#	endif
+
+	return Error;
+}
@@ -5,6 +5,7 @@
 #include <ctime>
 #include <cstdio>
 #include <vector>
+#include <algorithm>
 
 namespace mask
 {
@@ -999,6 +1000,119 @@ namespace bitfieldInterleave5
 }//namespace bitfieldInterleave5
 #endif//GLM_TEST_PERF
 
+namespace bitfieldInterleaveArray
+{
+	static glm::uint32 random(glm::uint32& Seed)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		return Seed ^ (Seed >> 15);
+	}
+
+	// Bit i of x, y and z goes to bit 3 * i, 3 * i + 1 and 3 * i + 2 when it fits in 64 bits
+	static glm::uint64 refBitfieldInterleave(glm::uint32 x, glm::uint32 y, glm::uint32 z)
+	{
+		glm::uint64 Result = 0;
+		for(glm::uint64 i = 0; i < 32; ++i)
+		{
+			glm::uint64 const Bits = (((x >> i) & 1u) << 0) | (((y >> i) & 1u) << 1) | (((z >> i) & 1u) << 2);
+			if(i * 3 < 64)
+				Result |= Bits << (i * 3);
+		}
+		return Result;
+	}
+
+	static int test_scalar()
+	{
+		int Error = 0;
+
+		glm::uint32 Seed = 1;
+		for(int i = 0; i < 10000; ++i)
+		{
+			glm::uint32 const x = random(Seed);
+			glm::uint32 const y = random(Seed);
+			glm::uint32 const z = random(Seed);
+
+			Error += glm::bitfieldInterleave(x, y, z) == refBitfieldInterleave(x, y, z) ? 0 : 1;
+			Error += glm::bitfieldInterleave(glm::uint16(x), glm::uint16(y), glm::uint16(z)) == refBitfieldInterleave(x & 0xFFFF, y & 0xFFFF, z & 0xFFFF) ? 0 : 1;
+			Error += glm::bitfieldDeinterleave(glm::bitfieldInterleave(x, y)) == glm::u32vec2(x, y) ? 0 : 1;
+			Error += glm::bitfieldDeinterleave(glm::bitfieldInterleave(glm::uint16(x), glm::uint16(y))) == glm::u16vec2(x, y) ? 0 : 1;
+			Error += glm::bitfieldDeinterleave(glm::bitfieldInterleave(glm::uint8(x), glm::uint8(y))) == glm::u8vec2(x, y) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// Every count up to a few SIMD blocks, starting at an odd index to test unaligned pointers
+	static int test_array()
+	{
+		int Error = 0;
+
+		std::size_t const Count = 41;
+
+		glm::uint32 Seed = 7;
+		std::vector<glm::u16vec2> In16x2(Count + 1);
+		std::vector<glm::u32vec2> In32x2(Count + 1);
+		std::vector<glm::u16vec3> In16x3(Count + 1);
+		std::vector<glm::u32vec3> In32x3(Count + 1);
+		std::vector<glm::uint32> In32(Count + 1);
+		std::vector<glm::uint64> In64(Count + 1);
+		for(std::size_t i = 0; i < Count + 1; ++i)
+		{
+			In16x2[i] = glm::u16vec2(random(Seed), random(Seed));
+			In32x2[i] = glm::u32vec2(random(Seed), random(Seed));
+			In16x3[i] = glm::u16vec3(random(Seed), random(Seed), random(Seed));
+			In32x3[i] = glm::u32vec3(random(Seed), random(Seed), random(Seed));
+			In32[i] = random(Seed);
+			In64[i] = (glm::uint64(random(Seed)) << 32) | random(Seed);
+		}
+
+		for(std::size_t n = 0; n <= Count; ++n)
+		{
+			std::vector<glm::uint32> Out32(Count + 1, 0xcdcdcdcd);
+			glm::bitfieldInterleave(&In16x2[1], &Out32[1], n);
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += Out32[i] == (i >= 1 && i <= n ? glm::bitfieldInterleave(In16x2[i]) : 0xcdcdcdcd) ? 0 : 1;
+
+			std::vector<glm::uint64> Out64(Count + 1, 0xcdcdcdcdcdcdcdcdull);
+			glm::bitfieldInterleave(&In32x2[1], &Out64[1], n);
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += Out64[i] == (i >= 1 && i <= n ? glm::bitfieldInterleave(In32x2[i]) : 0xcdcdcdcdcdcdcdcdull) ? 0 : 1;
+
+			std::fill(Out64.begin(), Out64.end(), 0xcdcdcdcdcdcdcdcdull);
+			glm::bitfieldInterleave(&In16x3[1], &Out64[1], n);
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += Out64[i] == (i >= 1 && i <= n ? glm::bitfieldInterleave(In16x3[i].x, In16x3[i].y, In16x3[i].z) : 0xcdcdcdcdcdcdcdcdull) ? 0 : 1;
+
+			std::fill(Out64.begin(), Out64.end(), 0xcdcdcdcdcdcdcdcdull);
+			glm::bitfieldInterleave(&In32x3[1], &Out64[1], n);
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += Out64[i] == (i >= 1 && i <= n ? glm::bitfieldInterleave(In32x3[i].x, In32x3[i].y, In32x3[i].z) : 0xcdcdcdcdcdcdcdcdull) ? 0 : 1;
+
+			std::vector<glm::u16vec2> Out16x2(Count + 1, glm::u16vec2(0xcdcd));
+			glm::bitfieldDeinterleave(&In32[1], &Out16x2[1], n);
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += Out16x2[i] == (i >= 1 && i <= n ? glm::bitfieldDeinterleave(In32[i]) : glm::u16vec2(0xcdcd)) ? 0 : 1;
+
+			std::vector<glm::u32vec2> Out32x2(Count + 1, glm::u32vec2(0xcdcdcdcd));
+			glm::bitfieldDeinterleave(&In64[1], &Out32x2[1], n);
+			for(std::size_t i = 0; i < Count + 1; ++i)
+				Error += Out32x2[i] == (i >= 1 && i <= n ? glm::bitfieldDeinterleave(In64[i]) : glm::u32vec2(0xcdcdcdcd)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_scalar();
+		Error += test_array();
+
+		return Error;
+	}
+}//namespace bitfieldInterleaveArray
+
 static int test_bitfieldRotateRight()
 {
 	std::clock_t const LastTime = std::clock();
@@ -1032,6 +1146,7 @@ int main()
 	int Error = 0;
 
 	Error += ::bitfieldInterleave::test();
+	Error += ::bitfieldInterleaveArray::test();
 
 #ifdef GLM_TEST_PERF
 
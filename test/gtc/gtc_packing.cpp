@@ -3,6 +3,7 @@
 #include <glm/gtc/epsilon.hpp>
 #include <glm/ext/vector_relational.hpp>
 #include <cstdio>
+#include <cstring>
 #include <vector>
 
 /*
@@ -110,6 +111,84 @@ static int test_Half4x16()
 	return Error;
 }
 
+static float float_from_bits(glm::uint32 Bits)
+{
+	float Value = 0.0f;
+	std::memcpy(&Value, &Bits, sizeof(Value));
+	return Value;
+}
+
+static glm::uint32 bits_from_float(float Value)
+{
+	glm::uint32 Bits = 0;
+	std::memcpy(&Bits, &Value, sizeof(Bits));
+	return Bits;
+}
+
+// The array converters must match packHalf1x16 and unpackHalf1x16 bit for bit
+static int test_HalfArray()
+{
+	int Error = 0;
+
+	// Every half float, including denormals, infinities and signaling NaNs
+	std::vector<glm::uint16> Halves(65536);
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+		Halves[i] = static_cast<glm::uint16>(i);
+
+	std::vector<float> Unpacked(Halves.size());
+	glm::unpackHalf(&Halves[0], &Unpacked[0], Halves.size());
+	for(std::size_t i = 0; i < Halves.size(); ++i)
+		Error += bits_from_float(Unpacked[i]) == bits_from_float(glm::unpackHalf1x16(Halves[i])) ? 0 : 1;
+
+	// Exact values, ties and their neighbors between consecutive half floats, out of range values and NaNs
+	std::vector<float> Floats;
+	for(glm::uint32 i = 0; i < 0x7c00; i += 7)
+	{
+		glm::uint32 const Tie = bits_from_float((glm::unpackHalf1x16(static_cast<glm::uint16>(i)) + glm::unpackHalf1x16(static_cast<glm::uint16>(i + 1))) * 0.5f);
+		glm::uint32 const Values[] = {bits_from_float(glm::unpackHalf1x16(static_cast<glm::uint16>(i))), Tie, Tie - 1, Tie + 1};
+		for(glm::uint32 Value : Values)
+		{
+			Floats.push_back(float_from_bits(Value));
+			Floats.push_back(float_from_bits(Value | 0x80000000));
+		}
+	}
+	glm::uint32 const Specials[] = {0x477fefff, 0x477ff000, 0x47800000, 0x7f7fffff, 0x7f800000, 0x7f800001, 0x7fc00000, 0x7f802000, 0x7fffffff, 0x33000000, 0x33000001, 0x32ffffff, 0x00000001};
+	for(glm::uint32 Special : Specials)
+	{
+		Floats.push_back(float_from_bits(Special));
+		Floats.push_back(float_from_bits(Special | 0x80000000));
+	}
+	glm::uint32 Seed = 1;
+	for(std::size_t i = 0; i < 4096; ++i)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		Floats.push_back(float_from_bits(Seed));
+	}
+
+	std::vector<glm::uint16> Packed(Floats.size());
+	glm::packHalf(&Floats[0], &Packed[0], Floats.size());
+	for(std::size_t i = 0; i < Floats.size(); ++i)
+		Error += Packed[i] == glm::packHalf1x16(Floats[i]) ? 0 : 1;
+
+	// Partial blocks leave the values past count untouched
+	for(std::size_t Count = 0; Count < 20; ++Count)
+	{
+		std::vector<glm::uint16> PackedTail(Count + 1, 0xabcd);
+		glm::packHalf(&Floats[3], &PackedTail[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += PackedTail[i] == glm::packHalf1x16(Floats[3 + i]) ? 0 : 1;
+		Error += PackedTail[Count] == 0xabcd ? 0 : 1;
+
+		std::vector<float> UnpackedTail(Count + 1, 7.0f);
+		glm::unpackHalf(&Halves[0x3c00], &UnpackedTail[0], Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += bits_from_float(UnpackedTail[i]) == bits_from_float(glm::unpackHalf1x16(Halves[0x3c00 + i])) ? 0 : 1;
+		Error += glm::equal(UnpackedTail[Count], 7.0f, glm::epsilon<float>()) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 static int test_I3x10_1x2()
 {
 	int Error = 0;
@@ -874,6 +953,7 @@ int main()
 	Error += test_U3x10_1x2();
 	Error += test_Half1x16();
 	Error += test_Half4x16();
+	Error += test_HalfArray();
 
 	return Error;
 }
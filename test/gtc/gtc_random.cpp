@@ -4,6 +4,8 @@
 #include <glm/gtc/random.hpp>
 #include <glm/gtc/epsilon.hpp>
 #include <glm/gtc/type_precision.hpp>
+#include <random>
+#include <vector>
 #if GLM_LANG & GLM_LANG_CXX0X_FLAG
 #	include <array>
 #endif
@@ -324,6 +326,421 @@ static int test_ballRand()
 
 	return Error;
 }
+
+namespace test_engine
+{
+	// Reference xoshiro128++ of one lane, seeded like lane 0 of xoshiro128x8
+	struct xoshiro128pp
+	{
+		glm::uint32 s[4];
+
+		explicit xoshiro128pp(glm::uint64 Seed, glm::uint64 Stream)
+		{
+			glm::uint64 x = Seed ^ splitmix64(Stream);
+			glm::uint64 const a = splitmix64(x);
+			glm::uint64 const b = splitmix64(x);
+			s[0] = static_cast<glm::uint32>(a);
+			s[1] = static_cast<glm::uint32>(a >> 32);
+			s[2] = static_cast<glm::uint32>(b);
+			s[3] = static_cast<glm::uint32>(b >> 32);
+		}
+
+		static glm::uint64 splitmix64(glm::uint64& x)
+		{
+			glm::uint64 z = (x += 0x9E3779B97F4A7C15ull);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			return z ^ (z >> 31);
+		}
+
+		static glm::uint32 rotl(glm::uint32 x, int k)
+		{
+			return (x << k) | (x >> (32 - k));
+		}
+
+		glm::uint32 operator()()
+		{
+			glm::uint32 const Result = rotl(s[0] + s[3], 7) + s[0];
+			glm::uint32 const t = s[1] << 9;
+			s[2] ^= s[0];
+			s[3] ^= s[1];
+			s[1] ^= s[2];
+			s[0] ^= s[3];
+			s[2] ^= t;
+			s[3] = rotl(s[3], 11);
+			return Result;
+		}
+	};
+
+	static int test_pcg32()
+	{
+		int Error = 0;
+
+		// Output of the reference implementation, pcg32_srandom_r(&rng, 42u, 54u)
+		glm::uint32 const Expected[] = {0xa15c02b7u, 0x7b47f409u, 0xba1d3330u, 0x83d2f293u, 0xbfa4784bu, 0xcbed606eu};
+		glm::pcg32 Engine(42u, 54u);
+		for(std::size_t i = 0; i < sizeof(Expected) / sizeof(Expected[0]); ++i)
+			Error += Engine() == Expected[i] ? 0 : 1;
+
+		// discard jumps to the same state as drawing the values
+		glm::pcg32 Jumped(7u, 3u);
+		glm::pcg32 Stepped(7u, 3u);
+		Jumped.discard(1000);
+		for(std::size_t i = 0; i < 1000; ++i)
+			static_cast<void>(Stepped());
+		Error += Jumped == Stepped ? 0 : 1;
+		Error += Jumped() == Stepped() ? 0 : 1;
+
+		// Streams of a same seed differ
+		glm::pcg32 A(7u, 0u);
+		glm::pcg32 B(7u, 1u);
+		Error += A != B ? 0 : 1;
+		int Same = 0;
+		for(std::size_t i = 0; i < 64; ++i)
+			Same += A() == B() ? 1 : 0;
+		Error += Same < 4 ? 0 : 1;
+
+		// Reseeding the engine of the thread restarts its sequence
+		glm::randomSeed(42u, 54u);
+		Error += glm::randomEngine()() == Expected[0] ? 0 : 1;
+		glm::randomSeed(42u, 54u);
+		Error += glm::randomEngine() == glm::pcg32(42u, 54u) ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test_xoshiro128x8()
+	{
+		int Error = 0;
+
+		// Lane 0 produces the values 0, 8, 16...
+		{
+			glm::xoshiro128x8 Engine(5u, 9u);
+			xoshiro128pp Reference(5u, 9u);
+			for(std::size_t i = 0; i < 800; ++i)
+			{
+				glm::uint32 const Value = Engine();
+				if(i % 8 == 0)
+					Error += Value == Reference() ? 0 : 1;
+			}
+		}
+
+		// generate produces the same sequence as operator(), whatever the values already drawn
+		std::size_t const Counts[] = {0, 1, 3, 7, 8, 9, 16, 17, 63, 200};
+		for(std::size_t Count : Counts)
+		for(std::size_t Drawn = 0; Drawn < 9; Drawn += 4)
+		{
+			glm::xoshiro128x8 A(11u, 2u);
+			glm::xoshiro128x8 B(11u, 2u);
+			for(std::size_t i = 0; i < Drawn; ++i)
+				Error += A() == B() ? 0 : 1;
+
+			std::vector<glm::uint32> Values(Count + 1, 7u);
+			A.generate(Values.data(), Count);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += Values[i] == B() ? 0 : 1;
+			Error += Values[Count] == 7u ? 0 : 1;
+			Error += A == B ? 0 : 1;
+			Error += A() == B() ? 0 : 1;
+		}
+
+		Error += glm::xoshiro128x8(1u, 0u) != glm::xoshiro128x8(1u, 1u) ? 0 : 1;
+
+		return Error;
+	}
+
+	template<glm::length_t L, typename T>
+	static int test_linearRand_batch()
+	{
+		int Error = 0;
+
+		glm::vec<L, T> Min;
+		glm::vec<L, T> Max;
+		for(glm::length_t c = 0; c < L; ++c)
+		{
+			Min[c] = static_cast<T>(-1 - c);
+			Max[c] = static_cast<T>(3 + 2 * c);
+		}
+
+		std::size_t const Counts[] = {0, 1, 5, 31, 32, 33, 100, 1000};
+		for(std::size_t Count : Counts)
+		{
+			glm::xoshiro128x8 A(3u, 1u);
+			glm::xoshiro128x8 B(3u, 1u);
+
+			std::vector<glm::vec<L, T> > Values(Count + 1, glm::vec<L, T>(T(7)));
+			glm::linearRand(Min, Max, Values.data(), Count, A);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += glm::all(glm::greaterThanEqual(Values[i], Min)) ? 0 : 1;
+				Error += glm::all(glm::lessThan(Values[i], Max)) ? 0 : 1;
+
+				// Same values as drawing the components one at a time
+				for(glm::length_t c = 0; c < L; ++c)
+				{
+					T Unit = T(0);
+					if(sizeof(T) == sizeof(float))
+						Unit = static_cast<T>(B() >> 8) / static_cast<T>(16777216);
+					else
+					{
+						glm::uint64 const High = B();
+						Unit = static_cast<T>(((High << 32) | B()) >> 11) / static_cast<T>(9007199254740992.0);
+					}
+					Error += glm::epsilonEqual(Values[i][c], Unit * (Max[c] - Min[c]) + Min[c], static_cast<T>(1e-6)) ? 0 : 1;
+				}
+			}
+			Error += glm::all(glm::equal(Values[Count], glm::vec<L, T>(T(7)))) ? 0 : 1;
+			Error += A == B ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static int test_engine_overloads()
+	{
+		int Error = 0;
+
+		std::mt19937 A(17u);
+		std::mt19937 B(17u);
+		for(std::size_t i = 0; i < 100; ++i)
+		{
+			glm::vec3 const V = glm::linearRand(glm::vec3(-1), glm::vec3(1), A);
+			Error += glm::all(glm::equal(V, glm::linearRand(glm::vec3(-1), glm::vec3(1), B))) ? 0 : 1;
+			Error += glm::all(glm::lessThanEqual(glm::abs(V), glm::vec3(1))) ? 0 : 1;
+		}
+
+		for(std::size_t i = 0; i < 100; ++i)
+		{
+			Error += glm::epsilonEqual(glm::length(glm::sphericalRand(2.0f, A)), 2.0f, 0.0001f) ? 0 : 1;
+			Error += glm::epsilonEqual(glm::length(glm::circularRand(2.0f, A)), 2.0f, 0.0001f) ? 0 : 1;
+			Error += glm::length(glm::diskRand(2.0, A)) <= 2.0 ? 0 : 1;
+			Error += glm::length(glm::ballRand(2.0f, A)) <= 2.0f ? 0 : 1;
+		}
+
+		glm::pcg32 C(1u, 2u);
+		glm::pcg32 D(1u, 2u);
+		Error += glm::gaussRand(glm::dvec2(1), glm::dvec2(2), C) == glm::gaussRand(glm::dvec2(1), glm::dvec2(2), D) ? 0 : 1;
+		Error += glm::linearRand(0, 100, C) == glm::linearRand(0, 100, D) ? 0 : 1;
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_pcg32();
+		Error += test_xoshiro128x8();
+		Error += test_linearRand_batch<1, float>();
+		Error += test_linearRand_batch<2, float>();
+		Error += test_linearRand_batch<3, float>();
+		Error += test_linearRand_batch<4, float>();
+		Error += test_linearRand_batch<3, double>();
+		Error += test_engine_overloads();
+
+		return Error;
+	}
+}//namespace test_engine
+
+namespace test_batch
+{
+	static std::size_t const Counts[] = {0, 1, 3, 4, 5, 47, 48, 49, 97, 300};
+
+	// Compares the float mappings, possibly using SIMD, with the double ones
+	static int test_mapping()
+	{
+		int Error = 0;
+
+		for(std::size_t Count : Counts)
+		{
+			std::vector<glm::vec2> Uniform(Count);
+			glm::sobolSequence(3, Uniform.data(), Count);
+			std::vector<glm::dvec2> UniformDouble(Uniform.begin(), Uniform.end());
+			std::vector<float> Angles(Count);
+			std::vector<double> AnglesDouble(Count);
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Angles[i] = Uniform[i].x;
+				AnglesDouble[i] = Uniform[i].x;
+			}
+
+			std::vector<glm::vec3> Sphere(Count + 1, glm::vec3(7));
+			std::vector<glm::dvec3> SphereDouble(Count);
+			glm::sphericalRand(2.0f, Uniform.data(), Sphere.data(), Count);
+			glm::sphericalRand(2.0, UniformDouble.data(), SphereDouble.data(), Count);
+
+			std::vector<glm::vec2> Disk(Count + 1, glm::vec2(7));
+			std::vector<glm::dvec2> DiskDouble(Count);
+			glm::diskRand(2.0f, Uniform.data(), Disk.data(), Count);
+			glm::diskRand(2.0, UniformDouble.data(), DiskDouble.data(), Count);
+
+			std::vector<glm::vec2> Circle(Count + 1, glm::vec2(7));
+			std::vector<glm::dvec2> CircleDouble(Count);
+			glm::circularRand(2.0f, Angles.data(), Circle.data(), Count);
+			glm::circularRand(2.0, AnglesDouble.data(), CircleDouble.data(), Count);
+
+			std::vector<glm::vec2> Gauss(Count + 1, glm::vec2(7));
+			std::vector<glm::dvec2> GaussDouble(Count);
+			glm::gaussRand(1.0f, 2.0f, Uniform.data(), Gauss.data(), Count);
+			glm::gaussRand(1.0, 2.0, UniformDouble.data(), GaussDouble.data(), Count);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Error += glm::all(glm::epsilonEqual(glm::dvec3(Sphere[i]), SphereDouble[i], 1e-5)) ? 0 : 1;
+				Error += glm::all(glm::epsilonEqual(glm::dvec2(Disk[i]), DiskDouble[i], 1e-5)) ? 0 : 1;
+				Error += glm::all(glm::epsilonEqual(glm::dvec2(Circle[i]), CircleDouble[i], 1e-5)) ? 0 : 1;
+				Error += glm::all(glm::epsilonEqual(glm::dvec2(Gauss[i]), GaussDouble[i], 1e-4)) ? 0 : 1;
+			}
+			Error += Sphere[Count] == glm::vec3(7) ? 0 : 1;
+			Error += Disk[Count] == glm::vec2(7) ? 0 : 1;
+			Error += Circle[Count] == glm::vec2(7) ? 0 : 1;
+			Error += Gauss[Count] == glm::vec2(7) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	template<typename T>
+	static int test_engine()
+	{
+		int Error = 0;
+
+		T const Epsilon = static_cast<T>(1e-5);
+
+		for(std::size_t Count : Counts)
+		{
+			glm::xoshiro128x8 Engine(9u);
+
+			std::vector<glm::vec<3, T> > Sphere(Count);
+			glm::sphericalRand(T(3), Sphere.data(), Count, Engine);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::epsilonEqual(glm::length(Sphere[i]), T(3), Epsilon * T(3)) ? 0 : 1;
+
+			std::vector<glm::vec<2, T> > Circle(Count);
+			glm::circularRand(T(3), Circle.data(), Count, Engine);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::epsilonEqual(glm::length(Circle[i]), T(3), Epsilon * T(3)) ? 0 : 1;
+
+			std::vector<glm::vec<2, T> > Disk(Count);
+			glm::diskRand(T(3), Disk.data(), Count, Engine);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::length(Disk[i]) <= T(3) * (T(1) + Epsilon) ? 0 : 1;
+
+			std::vector<T> Gauss(Count + 1, T(7));
+			glm::gaussRand(T(0), T(1), Gauss.data(), Count, Engine);
+			Error += Gauss[Count] == T(7) ? 0 : 1;
+		}
+
+		// Moments of the distributions
+		{
+			std::size_t const Count = 100000;
+			glm::xoshiro128x8 Engine(10u);
+
+			std::vector<T> Gauss(Count);
+			glm::gaussRand(T(1), T(2), Gauss.data(), Count, Engine);
+			double Mean = 0.0;
+			double Square = 0.0;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				Mean += static_cast<double>(Gauss[i]);
+				Square += static_cast<double>(Gauss[i]) * static_cast<double>(Gauss[i]);
+			}
+			Mean /= static_cast<double>(Count);
+			double const Variance = Square / static_cast<double>(Count) - Mean * Mean;
+
+			// Same parameters as gaussRand, the standard deviation is Deviation^2
+			Error += glm::epsilonEqual(Mean, 1.0, 0.05) ? 0 : 1;
+			Error += glm::epsilonEqual(Variance, 16.0, 0.5) ? 0 : 1;
+
+			std::vector<glm::vec<3, T> > Sphere(Count);
+			glm::sphericalRand(T(1), Sphere.data(), Count, Engine);
+			glm::dvec3 Center(0);
+			for(std::size_t i = 0; i < Count; ++i)
+				Center += glm::dvec3(Sphere[i]);
+			Error += glm::all(glm::epsilonEqual(Center / static_cast<double>(Count), glm::dvec3(0), 0.01)) ? 0 : 1;
+
+			std::vector<glm::vec<2, T> > Disk(Count);
+			glm::diskRand(T(1), Disk.data(), Count, Engine);
+			std::size_t Inner = 0;
+			for(std::size_t i = 0; i < Count; ++i)
+				Inner += glm::length(Disk[i]) < T(0.5) ? 1 : 0;
+			Error += glm::epsilonEqual(static_cast<double>(Inner) / static_cast<double>(Count), 0.25, 0.01) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	template<typename T>
+	static int test_sequences()
+	{
+		int Error = 0;
+
+		std::vector<glm::vec<4, T> > Halton(8);
+		glm::haltonSequence(1, Halton.data(), Halton.size());
+		Error += Halton[0].x == T(0.5) ? 0 : 1;
+		Error += Halton[1].x == T(0.25) ? 0 : 1;
+		Error += Halton[2].x == T(0.75) ? 0 : 1;
+		Error += glm::epsilonEqual(Halton[0].y, T(1) / T(3), glm::epsilon<T>()) ? 0 : 1;
+		Error += glm::epsilonEqual(Halton[2].y, T(1) / T(9), glm::epsilon<T>()) ? 0 : 1;
+		Error += glm::epsilonEqual(Halton[4].z, T(1) / T(25), glm::epsilon<T>()) ? 0 : 1;
+		Error += glm::epsilonEqual(Halton[6].w, T(1) / T(49), glm::epsilon<T>()) ? 0 : 1;
+
+		// Each block of 2^k points has one point in each box of size 2^-i x 2^-(k-i)
+		for(std::size_t First = 0; First < 1024; First += 256)
+		{
+			std::vector<glm::vec<4, T> > Sobol(256);
+			glm::sobolSequence(First, Sobol.data(), Sobol.size());
+			for(int i = 0; i <= 8; ++i)
+			{
+				std::vector<int> Boxes(256, 0);
+				for(std::size_t p = 0; p < Sobol.size(); ++p)
+				{
+					int const x = static_cast<int>(Sobol[p].x * static_cast<T>(1 << i));
+					int const y = static_cast<int>(Sobol[p].y * static_cast<T>(1 << (8 - i)));
+					++Boxes[static_cast<std::size_t>(x * (1 << (8 - i)) + y)];
+				}
+				for(std::size_t b = 0; b < Boxes.size(); ++b)
+					Error += Boxes[b] == 1 ? 0 : 1;
+			}
+
+			// Computing from any index gives the same points
+			std::vector<glm::vec<4, T> > Part(100);
+			glm::sobolSequence(First + 37, Part.data(), Part.size());
+			for(std::size_t p = 0; p < Part.size(); ++p)
+				Error += Part[p] == Sobol[p + 37] ? 0 : 1;
+		}
+
+		std::vector<glm::vec<3, T> > R2(1000);
+		glm::r2Sequence(0, R2.data(), R2.size());
+		Error += R2[0] == glm::vec<3, T>(T(0.5)) ? 0 : 1;
+		std::vector<glm::vec<3, T> > Part(10);
+		glm::r2Sequence(990, Part.data(), Part.size());
+		for(std::size_t p = 0; p < Part.size(); ++p)
+			Error += Part[p] == R2[p + 990] ? 0 : 1;
+
+		for(std::size_t p = 0; p < R2.size(); ++p)
+		{
+			Error += glm::all(glm::greaterThanEqual(R2[p], glm::vec<3, T>(0))) ? 0 : 1;
+			Error += glm::all(glm::lessThan(R2[p], glm::vec<3, T>(1))) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	static int test()
+	{
+		int Error = 0;
+
+		Error += test_mapping();
+		Error += test_engine<float>();
+		Error += test_engine<double>();
+		Error += test_sequences<float>();
+		Error += test_sequences<double>();
+
+		return Error;
+	}
+}//namespace test_batch
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 int test_grid()
@@ -374,6 +791,8 @@ int main()
 	Error += test_sphericalRand();
 	Error += test_diskRand();
 	Error += test_ballRand();
+	Error += test_engine::test();
+	Error += test_batch::test();
 /*
 #if(GLM_LANG & GLM_LANG_CXX0X_FLAG)
 	Error += test_grid();
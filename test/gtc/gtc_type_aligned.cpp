@@ -482,6 +482,52 @@ static int test_aligned_mat4()
 	glm::aligned_mat4 const expected = glm::mat4(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
 	Error += glm::all(glm::equal(t, expected, 0.0001f)) ? 0 : 1;
 
+	glm::mat4 const A(
+		2, 1, 0, 3,
+		1, 4, 1, 0,
+		0, 2, 5, 1,
+		3, 0, 1, 6);
+	glm::mat4 const B(
+		1, 0, 2, 0,
+		0, 3, 0, 1,
+		4, 0, 1, 0,
+		0, 2, 0, 5);
+
+	glm::aligned_mat4 const a(A);
+	glm::aligned_mat4 const b(B);
+
+	Error += glm::all(glm::equal(glm::mat4(a * b), A * B, 0.0001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4(glm::transpose(a)), glm::transpose(A), 0.0f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4(glm::inverse(a)), glm::inverse(A), 0.0001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4(a * glm::inverse(a)), glm::mat4(1.0f), 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
+static int test_aligned_dmat4()
+{
+	int Error = 0;
+
+	glm::dmat4 const A(
+		2, 1, 0, 3,
+		1, 4, 1, 0,
+		0, 2, 5, 1,
+		3, 0, 1, 6);
+	glm::dmat4 const B(
+		1, 0, 2, 0,
+		0, 3, 0, 1,
+		4, 0, 1, 0,
+		0, 2, 0, 5);
+
+	glm::aligned_dmat4 const a(A);
+	glm::aligned_dmat4 const b(B);
+
+	Error += glm::all(glm::equal(glm::dmat4(a * b), A * B, 0.0001)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dmat4(glm::transpose(a)), glm::transpose(A), 0.0)) ? 0 : 1;
+	Error += glm::equal(glm::determinant(a), glm::determinant(A), 0.0001) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dmat4(glm::inverse(a)), glm::inverse(A), 0.0001)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::dmat4(a * glm::inverse(a)), glm::dmat4(1.0), 0.0001)) ? 0 : 1;
+
 	return Error;
 }
 
@@ -501,6 +547,7 @@ int main()
 	Error += test_copy_quat();
 	Error += test_aligned_ivec4();
 	Error += test_aligned_mat4();
+	Error += test_aligned_dmat4();
 
 
 	return Error;
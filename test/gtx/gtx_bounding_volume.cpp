@@ -0,0 +1,475 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/bounding_volume.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+template<typename T>
+static glm::mat<3, 3, T, glm::defaultp> rotation(T Degrees, glm::vec<3, T, glm::defaultp> const& Axis)
+{
+	return glm::mat3_cast(glm::angleAxis(glm::radians(Degrees), glm::normalize(Axis)));
+}
+
+template<typename T>
+static bool contains(glm::aabb<T> const& Box, glm::vec<3, T, glm::defaultp> const& p, T Tolerance)
+{
+	return glm::all(glm::lessThanEqual(Box.Min - Tolerance, p)) && glm::all(glm::lessThanEqual(p, Box.Max + Tolerance));
+}
+
+template<typename T>
+static bool contains(glm::obb<T> const& Box, glm::vec<3, T, glm::defaultp> const& p, T Tolerance)
+{
+	glm::vec<3, T, glm::defaultp> const Local = (p - Box.Center) * Box.Axes;
+	return glm::all(glm::lessThanEqual(glm::abs(Local), Box.HalfExtents + Tolerance));
+}
+
+template<typename T>
+static glm::vec<3, T, glm::defaultp> corner(glm::obb<T> const& Box, int k)
+{
+	glm::vec<3, T, glm::defaultp> Local(k & 1 ? 1 : -1, k & 2 ? 1 : -1, k & 4 ? 1 : -1);
+	return Box.Center + Box.Axes * (Local * Box.HalfExtents);
+}
+
+// Points strictly inside the box of corners Low and High, except for the minimum of axis c placed at point
+// (First + c) % Count and its maximum at point (First + c + Count / 2) % Count, so that the bounds are exactly
+// Low and High whichever of the 8 lanes, 4 lanes or scalar loops reads the extremes.
+template<typename T>
+static std::vector<glm::vec<3, T, glm::defaultp> > make_cloud(std::size_t Count, std::size_t First, glm::vec<3, T, glm::defaultp> const& Low, glm::vec<3, T, glm::defaultp> const& High)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	std::vector<vec3Type> Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < 3; ++c)
+	{
+		T const Step = static_cast<T>((i * static_cast<std::size_t>(c + 3)) % 7 + 1) / static_cast<T>(9);
+		Points[i][c] = Low[c] + (High[c] - Low[c]) * Step;
+	}
+	for(glm::length_t c = 0; c < 3; ++c)
+	{
+		Points[(First + static_cast<std::size_t>(c)) % Count][c] = Low[c];
+		Points[(First + static_cast<std::size_t>(c) + Count / 2) % Count][c] = High[c];
+	}
+	return Points;
+}
+
+// Array, structure of arrays and box reductions of clouds with known bounds
+template<typename T>
+static int test_bounds()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	int Error = 0;
+
+	vec3Type const Low(-75, 3, static_cast<T>(-0.5));
+	vec3Type const High(20, 250, static_cast<T>(0.25));
+	vec3Type const Extent(1, static_cast<T>(0.5), 2);
+
+	// Blocks of 8 then 4 points and the scalar tail
+	std::size_t const Counts[] = {2, 3, 4, 7, 8, 12, 13, 15, 16, 23};
+	for(std::size_t Count : Counts)
+	for(std::size_t First = 0; First < Count; ++First)
+	{
+		std::vector<vec3Type> const Points = make_cloud(Count, First, Low, High);
+		glm::vec_soa<3, T> Soa(Points.data(), Count), BoxMin(Count), BoxMax(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			BoxMin.store(i, Points[i] - Extent);
+			BoxMax.store(i, Points[i] + Extent);
+		}
+
+		glm::aabb<T> const Array = glm::computeBounds(Points.data(), Count);
+		Error += Array.Min == Low && Array.Max == High ? 0 : 1;
+
+		glm::aabb<T> const Structure = glm::computeBounds(glm::vec_soa_view<3, T>(Soa));
+		Error += Structure.Min == Low && Structure.Max == High ? 0 : 1;
+
+		glm::aabb<T> const Boxes = glm::computeBounds(glm::vec_soa_view<3, T>(BoxMin), glm::vec_soa_view<3, T>(BoxMax));
+		Error += Boxes.Min == Low - Extent && Boxes.Max == High + Extent ? 0 : 1;
+
+		// Subsets starting at unaligned elements
+		glm::aabb<T> Merged = glm::computeBounds(Points.data() + 1, Count - 1);
+		Merged = glm::mergeBounds(Merged, Points[0]);
+		Error += Merged.Min == Low && Merged.Max == High ? 0 : 1;
+
+		glm::aabb<T> const Head = glm::computeBounds(glm::vec_soa_view<3, T>(Soa).slice(0, 1));
+		glm::aabb<T> const Tail = glm::computeBounds(glm::vec_soa_view<3, T>(Soa).slice(1, Count - 1));
+		glm::aabb<T> const Union = glm::mergeBounds(Head, Tail);
+		Error += Union.Min == Low && Union.Max == High ? 0 : 1;
+	}
+
+	// A single point is a box of null extent
+	vec3Type const Point(1, 2, 3);
+	glm::aabb<T> const Single = glm::computeBounds(&Point, 1);
+	Error += Single.Min == Point && Single.Max == Point ? 0 : 1;
+
+	// No point is an empty box, neutral for mergeBounds
+	glm::aabb<T> const Empty = glm::computeBounds(static_cast<vec3Type const*>(NULL), 0);
+	Error += glm::all(glm::greaterThan(Empty.Min, Empty.Max)) ? 0 : 1;
+	glm::aabb<T> const Merged = glm::mergeBounds(Empty, Point);
+	Error += Merged.Min == Point && Merged.Max == Point ? 0 : 1;
+
+	return Error;
+}
+
+// The bounds of a transformed box have the center m * center and the half extents abs(linear part) * extents,
+// and each of their faces touches a transformed corner
+template<typename T>
+static int test_transform()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::vec<4, T, glm::defaultp> vec4Type;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3Type;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4Type;
+
+	int Error = 0;
+
+	T const Epsilon = std::numeric_limits<T>::epsilon() * static_cast<T>(1024);
+
+	// Quarter turn, eighth turn, the third of a turn around the diagonal permuting the axes, and a rotation of a mirrored scale
+	mat3Type const Tilted = rotation<T>(30, vec3Type(1, 2, 3));
+	mat3Type const Linear[] = {
+		rotation<T>(90, vec3Type(0, 0, 1)),
+		rotation<T>(45, vec3Type(0, 0, 1)),
+		rotation<T>(120, vec3Type(1, 1, 1)),
+		mat3Type(Tilted[0] * static_cast<T>(2), -Tilted[1], Tilted[2] * static_cast<T>(0.5))};
+
+	// Blocks of 8 then 4 boxes and the scalar tail
+	std::size_t const Counts[] = {0, 3, 4, 5, 8, 12, 13};
+	for(std::size_t t = 0; t < sizeof(Linear) / sizeof(Linear[0]); ++t)
+	for(std::size_t Count : Counts)
+	{
+		mat4Type m(Linear[t]);
+		m[3] = vec4Type(5, -3, static_cast<T>(t), 1);
+
+		glm::vec_soa<3, T> BoxMin(Count), BoxMax(Count), OutMin(Count), OutMax(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec3Type const Center = vec3Type(static_cast<T>(i), -static_cast<T>(2 * i), static_cast<T>(3)) * static_cast<T>(0.25);
+			vec3Type const Extent(static_cast<T>(1 + i % 3), static_cast<T>(0.5), static_cast<T>(1 + i % 4) * static_cast<T>(0.25));
+			BoxMin.store(i, Center - Extent);
+			BoxMax.store(i, Center + Extent);
+		}
+
+		glm::transformBounds(m, BoxMin, BoxMax, OutMin, OutMax);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::aabb<T> const Box = {BoxMin.load(i), BoxMax.load(i)};
+			vec3Type const Center = (Box.Min + Box.Max) * static_cast<T>(0.5);
+			vec3Type const Extent = (Box.Max - Box.Min) * static_cast<T>(0.5);
+
+			mat3Type Abs;
+			for(glm::length_t c = 0; c < 3; ++c)
+				Abs[c] = glm::abs(Linear[t][c]);
+			vec3Type const ExpectedCenter(m * vec4Type(Center, 1));
+			vec3Type const ExpectedExtent = Abs * Extent;
+
+			glm::aabb<T> const Single = glm::transformBounds(m, Box);
+			Error += glm::all(glm::epsilonEqual(Single.Min, ExpectedCenter - ExpectedExtent, Epsilon * static_cast<T>(10))) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(Single.Max, ExpectedCenter + ExpectedExtent, Epsilon * static_cast<T>(10))) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(OutMin.load(i), Single.Min, Epsilon)) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(OutMax.load(i), Single.Max, Epsilon)) ? 0 : 1;
+
+			// Tight bounds: the transformed corners are inside and reach each face
+			vec3Type Low(std::numeric_limits<T>::infinity()), High(-std::numeric_limits<T>::infinity());
+			for(int c = 0; c < 8; ++c)
+			{
+				vec3Type const Corner(c & 1 ? Box.Max.x : Box.Min.x, c & 2 ? Box.Max.y : Box.Min.y, c & 4 ? Box.Max.z : Box.Min.z);
+				vec3Type const Transformed(m * vec4Type(Corner, 1));
+				Error += contains(Single, Transformed, Epsilon * static_cast<T>(10)) ? 0 : 1;
+				Low = glm::min(Low, Transformed);
+				High = glm::max(High, Transformed);
+			}
+			Error += glm::all(glm::epsilonEqual(Low, Single.Min, Epsilon * static_cast<T>(10))) ? 0 : 1;
+			Error += glm::all(glm::epsilonEqual(High, Single.Max, Epsilon * static_cast<T>(10))) ? 0 : 1;
+		}
+
+		// In place
+		glm::transformBounds(m, BoxMin, BoxMax, BoxMin, BoxMax);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += BoxMin.load(i) == OutMin.load(i) && BoxMax.load(i) == OutMax.load(i) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Points on a grid filling a rotated box: the fitted box has the center, axes and half extents of the grid
+template<typename T>
+static int test_oriented(T Offset, T Tolerance)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3Type;
+
+	int Error = 0;
+
+	mat3Type const Rotations[] = {
+		mat3Type(1),
+		rotation<T>(30, vec3Type(0, 0, 1)),
+		rotation<T>(60, vec3Type(1, 1, 0)),
+		rotation<T>(100, vec3Type(1, 2, 3)),
+		rotation<T>(200, vec3Type(-1, static_cast<T>(0.5), 2)),
+		rotation<T>(135, vec3Type(0, 1, -1))};
+
+	for(std::size_t k = 0; k < sizeof(Rotations) / sizeof(Rotations[0]); ++k)
+	{
+		mat3Type const& Rotation = Rotations[k];
+		vec3Type const HalfExtents(4, 2, 1);
+		vec3Type const Center = vec3Type(static_cast<T>(k), -static_cast<T>(k), static_cast<T>(2 * k)) + Offset;
+
+		std::vector<vec3Type> Points;
+		for(int z = -4; z <= 4; ++z)
+		for(int y = -4; y <= 4; ++y)
+		for(int x = -4; x <= 4; ++x)
+			Points.push_back(Center + Rotation * (vec3Type(x, y, z) * static_cast<T>(0.25) * HalfExtents));
+
+		glm::obb<T> const Box = glm::computeOrientedBounds(Points.data(), Points.size());
+
+		// Axes sorted by decreasing extent, orthonormal and right-handed
+		for(glm::length_t i = 0; i < 3; ++i)
+			Error += glm::abs(glm::abs(glm::dot(Box.Axes[i], Rotation[i])) - static_cast<T>(1)) < Tolerance ? 0 : 1;
+		Error += glm::abs(glm::determinant(Box.Axes) - static_cast<T>(1)) < Tolerance ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Box.HalfExtents, HalfExtents, Tolerance)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Box.Center, Center, Tolerance)) ? 0 : 1;
+
+		for(std::size_t i = 0; i < Points.size(); ++i)
+			Error += contains(Box, Points[i], Tolerance) ? 0 : 1;
+
+		// The axis aligned bounds contain the corners of the oriented box
+		glm::aabb<T> const Bounds = glm::computeBounds(Box);
+		for(int c = 0; c < 8; ++c)
+			Error += contains(Bounds, corner(Box, c), Tolerance) ? 0 : 1;
+	}
+
+	// A single point, points on a line
+	{
+		vec3Type const Point(1, 2, 3);
+		glm::obb<T> const Box = glm::computeOrientedBounds(&Point, 1);
+		Error += glm::all(glm::epsilonEqual(Box.Center, Point, Tolerance)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(Box.HalfExtents, vec3Type(0), Tolerance)) ? 0 : 1;
+
+		std::vector<vec3Type> Line;
+		for(int i = 0; i < 10; ++i)
+			Line.push_back(vec3Type(1, 1, 0) * static_cast<T>(i));
+		glm::obb<T> const Segment = glm::computeOrientedBounds(Line.data(), Line.size());
+		Error += glm::abs(Segment.HalfExtents.x - glm::sqrt(static_cast<T>(2)) * static_cast<T>(4.5)) < Tolerance * static_cast<T>(10) ? 0 : 1;
+		Error += Segment.HalfExtents.y < Tolerance && Segment.HalfExtents.z < Tolerance ? 0 : 1;
+		Error += glm::abs(glm::determinant(Segment.Axes) - static_cast<T>(1)) < Tolerance ? 0 : 1;
+		for(std::size_t i = 0; i < Line.size(); ++i)
+			Error += contains(Segment, Line[i], Tolerance * static_cast<T>(10)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Separating axis test of two oriented boxes by projecting their corners on the 15 candidate axes.
+// Returns the largest gap between the projections, positive when the boxes are separated.
+template<typename T>
+static T separation(glm::obb<T> const& a, glm::obb<T> const& b, bool& CrossAxis)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	vec3Type Axes[15];
+	for(glm::length_t i = 0; i < 3; ++i)
+	{
+		Axes[i] = a.Axes[i];
+		Axes[3 + i] = b.Axes[i];
+		for(glm::length_t j = 0; j < 3; ++j)
+			Axes[6 + i * 3 + j] = glm::cross(a.Axes[i], b.Axes[j]);
+	}
+
+	T Gap = -std::numeric_limits<T>::infinity();
+	CrossAxis = false;
+	for(int k = 0; k < 15; ++k)
+	{
+		if(glm::length(Axes[k]) < static_cast<T>(0.001))
+			continue;
+		vec3Type const Axis = glm::normalize(Axes[k]);
+
+		T MinA = std::numeric_limits<T>::infinity(), MaxA = -MinA, MinB = MinA, MaxB = -MinA;
+		for(int c = 0; c < 8; ++c)
+		{
+			T const pa = glm::dot(corner(a, c), Axis);
+			T const pb = glm::dot(corner(b, c), Axis);
+			MinA = glm::min(MinA, pa);
+			MaxA = glm::max(MaxA, pa);
+			MinB = glm::min(MinB, pb);
+			MaxB = glm::max(MaxB, pb);
+		}
+		T const AxisGap = glm::max(MinB - MaxA, MinA - MaxB);
+		if(AxisGap > Gap)
+		{
+			Gap = AxisGap;
+			CrossAxis = k >= 6;
+		}
+	}
+	return Gap;
+}
+
+template<typename T>
+static int test_intersect()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3Type;
+
+	int Error = 0;
+
+	T const Root2 = glm::sqrt(static_cast<T>(2));
+
+	// Axis aligned boxes, touching boxes overlap
+	{
+		glm::aabb<T> const a = {vec3Type(0), vec3Type(1)};
+		glm::aabb<T> const b = {vec3Type(1, 0, 0), vec3Type(2, 1, 1)};
+		glm::aabb<T> const c = {vec3Type(static_cast<T>(1.01), 0, 0), vec3Type(2, 1, 1)};
+		glm::aabb<T> const d = {vec3Type(static_cast<T>(0.25)), vec3Type(static_cast<T>(0.5))};
+		Error += glm::intersectBoxes(a, b) ? 0 : 1;
+		Error += !glm::intersectBoxes(a, c) ? 0 : 1;
+		Error += glm::intersectBoxes(a, d) && glm::intersectBoxes(d, a) ? 0 : 1;
+		Error += glm::intersectBoxes(glm::computeOrientedBounds(a), glm::computeOrientedBounds(b)) ? 0 : 1;
+		Error += !glm::intersectBoxes(glm::computeOrientedBounds(a), glm::computeOrientedBounds(c)) ? 0 : 1;
+	}
+
+	// A cube rotated by 45 degrees around z reaches sqrt(2) along x, separated by an axis of the other cube
+	{
+		glm::obb<T> a = {vec3Type(0), mat3Type(1), vec3Type(1)};
+		glm::obb<T> b = {vec3Type(0), rotation<T>(45, vec3Type(0, 0, 1)), vec3Type(1)};
+		b.Center.x = static_cast<T>(1) + Root2 - static_cast<T>(0.01);
+		Error += glm::intersectBoxes(a, b) ? 0 : 1;
+		b.Center.x = static_cast<T>(1) + Root2 + static_cast<T>(0.01);
+		Error += !glm::intersectBoxes(a, b) ? 0 : 1;
+	}
+
+	// Cubes rotated by 45 degrees around y and z present an edge along y and an edge along z to each other.
+	// x = cross(y, z) is an axis of neither box and separates them once their centers are 2 * sqrt(2) apart.
+	{
+		glm::obb<T> const a = {vec3Type(0), rotation<T>(45, vec3Type(0, 1, 0)), vec3Type(1)};
+		glm::obb<T> b = {vec3Type(0), rotation<T>(45, vec3Type(0, 0, 1)), vec3Type(1)};
+		bool CrossAxis = false;
+
+		b.Center.x = static_cast<T>(2) * Root2 + static_cast<T>(0.01);
+		Error += separation(a, b, CrossAxis) > static_cast<T>(0) && CrossAxis ? 0 : 1;
+		Error += !glm::intersectBoxes(a, b) && !glm::intersectBoxes(b, a) ? 0 : 1;
+
+		b.Center.x = static_cast<T>(2) * Root2 - static_cast<T>(0.01);
+		Error += separation(a, b, CrossAxis) < static_cast<T>(0) ? 0 : 1;
+		Error += glm::intersectBoxes(a, b) && glm::intersectBoxes(b, a) ? 0 : 1;
+	}
+
+	// Pairs of boxes with known orientations around the unit cube, against the projection of their corners.
+	// Cases closer than the rounding are skipped.
+	mat3Type const Rotations[] = {
+		mat3Type(1),
+		rotation<T>(45, vec3Type(1, 0, 0)),
+		rotation<T>(45, vec3Type(0, 1, 0)),
+		rotation<T>(30, vec3Type(1, 1, 1)),
+		rotation<T>(70, vec3Type(1, -2, 1))};
+	vec3Type const HalfExtents[] = {vec3Type(1), vec3Type(2, static_cast<T>(0.25), static_cast<T>(0.5)), vec3Type(static_cast<T>(0.1), 1, 3)};
+
+	glm::obb<T> const Unit = {vec3Type(0), mat3Type(1), vec3Type(1)};
+	int CrossSeparated = 0;
+	for(std::size_t r = 0; r < sizeof(Rotations) / sizeof(Rotations[0]); ++r)
+	for(std::size_t e = 0; e < sizeof(HalfExtents) / sizeof(HalfExtents[0]); ++e)
+	for(int z = -1; z <= 1; ++z)
+	for(int y = -1; y <= 1; ++y)
+	for(int x = -1; x <= 1; ++x)
+	for(int d = 1; d <= 8; ++d)
+	{
+		if(x == 0 && y == 0 && z == 0)
+			continue;
+
+		glm::obb<T> a = Unit;
+		a.Axes = Rotations[(r + 2) % 5];
+		glm::obb<T> b = {glm::normalize(vec3Type(x, y, z)) * static_cast<T>(d) * static_cast<T>(0.5), Rotations[r], HalfExtents[e]};
+
+		bool CrossAxis = false;
+		T const Gap = separation(a, b, CrossAxis);
+		if(glm::abs(Gap) < static_cast<T>(0.0001))
+			continue;
+
+		bool const Intersect = glm::intersectBoxes(a, b);
+		Error += Intersect == (Gap < static_cast<T>(0)) ? 0 : 1;
+		Error += glm::intersectBoxes(b, a) == Intersect ? 0 : 1;
+		CrossSeparated += Gap > static_cast<T>(0) && CrossAxis ? 1 : 0;
+
+		// Mixed overloads convert the axis aligned box
+		glm::aabb<T> const Bounds = glm::computeBounds(b);
+		Error += glm::intersectBoxes(a, Bounds) == glm::intersectBoxes(a, glm::computeOrientedBounds(Bounds)) ? 0 : 1;
+		Error += glm::intersectBoxes(Bounds, a) == glm::intersectBoxes(a, Bounds) ? 0 : 1;
+	}
+	Error += CrossSeparated > 0 ? 0 : 1;
+
+	return Error;
+}
+
+// Unit boxes along x against the query box of x in [-1, 2]: box i overlaps when its center is in [-1.5, 2.5],
+// touching at the ends, unless it is moved off the query along y. Boxes moved along z touch the query.
+template<typename T>
+static int test_intersect_batch()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	int Error = 0;
+
+	glm::aabb<T> const Query = {vec3Type(-1), vec3Type(2, 1, 1)};
+
+	// Blocks of 8 then 4 boxes, the scalar tail and the words of the mask
+	std::size_t const Counts[] = {0, 1, 4, 5, 8, 12, 13, 31, 32, 33, 37, 64, 65};
+	for(std::size_t Count : Counts)
+	{
+		glm::vec_soa<3, T> BoxMin(Count), BoxMax(Count);
+		std::vector<bool> Expected(Count);
+		std::size_t ExpectedHits = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			T const x = static_cast<T>(-4) + static_cast<T>(i % 17) * static_cast<T>(0.5);
+			T const y = i % 5 == 4 ? static_cast<T>(2.5) : static_cast<T>(0);
+			T const z = i % 7 == 6 ? static_cast<T>(-1.5) : static_cast<T>(0);
+			vec3Type const Center(x, y, z);
+			BoxMin.store(i, Center - static_cast<T>(0.5));
+			BoxMax.store(i, Center + static_cast<T>(0.5));
+
+			Expected[i] = x >= static_cast<T>(-1.5) && x <= static_cast<T>(2.5) && y == static_cast<T>(0);
+			ExpectedHits += Expected[i] ? 1 : 0;
+		}
+
+		std::vector<std::uint32_t> Mask((Count + 31) / 32 + 1, 0xFFFFFFFFu);
+		std::size_t const Hits = glm::intersectBoxes(Query, BoxMin, BoxMax, Mask.data());
+		Error += Hits == ExpectedHits ? 0 : 1;
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			bool const Bit = ((Mask[i / 32] >> (i % 32)) & 1u) != 0;
+			Error += Bit == Expected[i] ? 0 : 1;
+		}
+
+		// The bits past the boxes are cleared, the words past the mask are untouched
+		if(Count % 32 != 0)
+			Error += (Mask[Count / 32] >> (Count % 32)) == 0 ? 0 : 1;
+		Error += Mask.back() == 0xFFFFFFFFu ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_bounds<float>();
+	Error += test_bounds<double>();
+	Error += test_transform<float>();
+	Error += test_transform<double>();
+	Error += test_oriented<float>(0.0f, 0.0001f);
+	Error += test_oriented<float>(10000.0f, 0.01f);
+	Error += test_oriented<double>(0.0, 0.0000001);
+	Error += test_oriented<double>(10000.0, 0.0000001);
+	Error += test_intersect<float>();
+	Error += test_intersect<double>();
+	Error += test_intersect_batch<float>();
+	Error += test_intersect_batch<double>();
+
+	return Error;
+}
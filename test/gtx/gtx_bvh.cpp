@@ -0,0 +1,498 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/bvh.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+static std::size_t const Counts[] = {0, 1, 2, 3, 5, 17, 64, 333, 512, 1025, 2000, 5000};
+
+// Triangle grid: each layer splits the 16 x 16 cells of size 0.5 covering [0, 8] x [0, 8] along their diagonal,
+// half 0 below it and half 1 above. Layers 0 and 1 are both at z = 0 to create ties, layer l > 1 is at z = l - 1.
+static std::size_t const GridCells = 16;
+static std::size_t const LayerSize = GridCells * GridCells * 2;
+
+static std::size_t grid_index(std::size_t Layer, std::size_t x, std::size_t y, std::size_t Half)
+{
+	return Layer * LayerSize + (y * GridCells + x) * 2 + Half;
+}
+
+template<typename T>
+static T grid_depth(std::size_t Layer)
+{
+	return static_cast<T>(Layer == 0 ? 0 : Layer - 1);
+}
+
+template<typename T>
+static void make_triangles(std::size_t Count, glm::vec_soa<3, T>& V0, glm::vec_soa<3, T>& V1, glm::vec_soa<3, T>& V2)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	V0.resize(Count);
+	V1.resize(Count);
+	V2.resize(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		std::size_t const Cell = (i % LayerSize) / 2;
+		T const x = static_cast<T>(Cell % GridCells) * T(0.5);
+		T const y = static_cast<T>(Cell / GridCells) * T(0.5);
+		T const z = grid_depth<T>(i / LayerSize);
+		V0.store(i, vec3Type(x, y, z));
+		V1.store(i, i % 2 == 0 ? vec3Type(x + T(0.5), y, z) : vec3Type(x + T(0.5), y + T(0.5), z));
+		V2.store(i, i % 2 == 0 ? vec3Type(x + T(0.5), y + T(0.5), z) : vec3Type(x, y + T(0.5), z));
+	}
+}
+
+// Nearest triangle of the grid hit by a ray crossing the layers away from the cell edges and diagonals,
+// the lowest index on ties
+template<typename T>
+static bool grid_hit(std::size_t Count, glm::vec<3, T, glm::defaultp> const& Orig, glm::vec<3, T, glm::defaultp> const& Dir, T& Distance, std::size_t& Index)
+{
+	bool Hit = false;
+	for(std::size_t Layer = 0; Layer * LayerSize < Count && Dir.z != T(0); ++Layer)
+	{
+		T const t = (grid_depth<T>(Layer) - Orig.z) / Dir.z;
+		glm::vec<3, T, glm::defaultp> const Point = (Orig + Dir * t) * T(2);
+		if(t < T(0) || Point.x < T(0) || Point.y < T(0) || Point.x >= T(GridCells) || Point.y >= T(GridCells))
+			continue;
+
+		std::size_t const x = static_cast<std::size_t>(Point.x);
+		std::size_t const y = static_cast<std::size_t>(Point.y);
+		std::size_t const i = grid_index(Layer, x, y, Point.x - T(x) > Point.y - T(y) ? 0 : 1);
+		if(i >= Count || (Hit && !(t < Distance)))
+			continue;
+		Hit = true;
+		Distance = t;
+		Index = i;
+	}
+	return Hit;
+}
+
+// Rays through the point at (0.75, 0.25) or (0.25, 0.75) of a cell, the first inside half 0 and the second inside half 1
+template<typename T>
+static void make_ray(std::size_t Cell, std::size_t Half, std::size_t Kind, glm::vec<3, T, glm::defaultp>& Orig, glm::vec<3, T, glm::defaultp>& Dir)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	T const x = (static_cast<T>(Cell % GridCells) + (Half == 0 ? T(0.75) : T(0.25))) * T(0.5);
+	T const y = (static_cast<T>(Cell / GridCells) + (Half == 0 ? T(0.25) : T(0.75))) * T(0.5);
+	switch(Kind)
+	{
+	default:
+	case 0: // Upward from below the grid
+		Orig = vec3Type(x, y, T(-1));
+		Dir = vec3Type(T(0), T(0), T(1));
+		break;
+	case 1: // Downward from above the grid
+		Orig = vec3Type(x, y, T(50));
+		Dir = vec3Type(T(0), T(0), T(-1));
+		break;
+	case 2: // Upward from between two layers
+		Orig = vec3Type(x, y, T(2.5));
+		Dir = vec3Type(T(0), T(0), T(1));
+		break;
+	case 3: // Slanted, moving by a whole number of cells between layers
+		Orig = vec3Type(x, y, T(-1));
+		Dir = vec3Type(T(0.5), T(-1), T(1));
+		break;
+	case 4: // Parallel to the layers
+		Orig = vec3Type(x, y, T(0.5));
+		Dir = vec3Type(T(1), T(0), T(0));
+		break;
+	case 5: // Away from the grid
+		Orig = vec3Type(x, y, T(-1));
+		Dir = vec3Type(T(0), T(0), T(-1));
+		break;
+	case 6: // Beside the grid
+		Orig = vec3Type(x - T(GridCells), y, T(-1));
+		Dir = vec3Type(T(0), T(0), T(1));
+		break;
+	}
+}
+
+// The nodes cover the primitives of their subtree, each primitive is referenced once
+template<typename T>
+static int test_structure()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	int Error = 0;
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+		glm::vec_soa<3, T> V0, V1, V2;
+		make_triangles(Count, V0, V1, V2);
+		glm::vec_soa<3, T> BoxMin(Count), BoxMax(Count);
+		glm::computeTriangleBounds(V0, V1, V2, BoxMin, BoxMax);
+
+		for(std::size_t LeafSize = 1; LeafSize <= 8; LeafSize *= 2)
+		{
+			glm::bvh<T> Bvh;
+			Bvh.build(BoxMin, BoxMax, LeafSize);
+
+			Error += Bvh.size() == Count ? 0 : 1;
+			Error += Bvh.empty() == (Count == 0) ? 0 : 1;
+			if(Count == 0)
+				continue;
+
+			std::vector<typename glm::bvh<T>::node_type> const& Nodes = Bvh.nodes();
+			std::vector<std::uint32_t> const& Indices = Bvh.indices();
+			Error += Nodes.size() <= 2 * Count - 1 ? 0 : 1;
+
+			std::vector<int> Referenced(Count, 0);
+			for(std::size_t n = 0; n < Nodes.size(); ++n)
+			{
+				vec3Type const Min = Nodes[n].Min;
+				vec3Type const Max = Nodes[n].Max;
+				if(Nodes[n].Count > 0)
+				{
+					Error += Nodes[n].Count <= LeafSize ? 0 : 1;
+					for(std::uint32_t i = Nodes[n].First; i < Nodes[n].First + Nodes[n].Count; ++i)
+					{
+						++Referenced[Indices[i]];
+						Error += glm::all(glm::lessThanEqual(Min, BoxMin.load(Indices[i]))) ? 0 : 1;
+						Error += glm::all(glm::lessThanEqual(BoxMax.load(Indices[i]), Max)) ? 0 : 1;
+					}
+					continue;
+				}
+
+				// Depth-first order, children after their parent
+				Error += Nodes[n].First > n && Nodes[n].First + 1 < Nodes.size() ? 0 : 1;
+				for(std::uint32_t c = Nodes[n].First; c < Nodes[n].First + 2; ++c)
+				{
+					Error += glm::all(glm::lessThanEqual(Min, Nodes[c].Min)) ? 0 : 1;
+					Error += glm::all(glm::lessThanEqual(Nodes[c].Max, Max)) ? 0 : 1;
+				}
+			}
+
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += Referenced[i] == 1 ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// The hierarchy doesn't depend on the number of threads building it
+static int test_threads()
+{
+	int Error = 0;
+
+	// Each thread level doubles the threads building concurrently, never above the requested count
+	std::size_t const Levels[] = {0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 4};
+	for(unsigned t = 0; t < sizeof(Levels) / sizeof(Levels[0]); ++t)
+		Error += glm::detail::bvh_thread_levels(t) == Levels[t] ? 0 : 1;
+
+	glm::vec3_soa V0, V1, V2;
+	make_triangles(20000, V0, V1, V2);
+	glm::vec3_soa BoxMin(V0.size()), BoxMax(V0.size());
+	glm::computeTriangleBounds(V0, V1, V2, BoxMin, BoxMax);
+
+	glm::bvh<float> Serial;
+	Serial.build(BoxMin, BoxMax, 4, 1);
+
+	unsigned const Threads[] = {2, 3, 8, 9};
+	for(std::size_t t = 0; t < sizeof(Threads) / sizeof(Threads[0]); ++t)
+	{
+		glm::bvh<float> Parallel;
+		Parallel.build(BoxMin, BoxMax, 4, Threads[t]);
+
+		Error += Parallel.indices() == Serial.indices() ? 0 : 1;
+		Error += Parallel.nodes().size() == Serial.nodes().size() ? 0 : 1;
+		for(std::size_t n = 0; n < glm::min(Parallel.nodes().size(), Serial.nodes().size()); ++n)
+		{
+			glm::bvh_node<float> const& a = Parallel.nodes()[n];
+			glm::bvh_node<float> const& b = Serial.nodes()[n];
+			Error += a.First == b.First && a.Count == b.Count ? 0 : 1;
+			Error += a.Min == b.Min && a.Max == b.Max ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// Nearest triangle known from the grid layout, same as intersectRayTriangle applied to all the triangles
+template<typename T>
+static int test_ray_triangle()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::vec<2, T, glm::defaultp> vec2Type;
+
+	int Error = 0;
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+		glm::vec_soa<3, T> V0, V1, V2;
+		make_triangles(Count, V0, V1, V2);
+		glm::vec_soa<3, T> BoxMin(Count), BoxMax(Count);
+		glm::computeTriangleBounds(V0, V1, V2, BoxMin, BoxMax);
+
+		glm::bvh<T> Bvh;
+		Bvh.build(BoxMin, BoxMax);
+
+		for(std::size_t Cell = 0; Cell < GridCells * GridCells; Cell += 5)
+		for(std::size_t Half = 0; Half < 2; ++Half)
+		for(std::size_t Kind = 0; Kind < 7; ++Kind)
+		{
+			vec3Type Orig, Dir;
+			make_ray(Cell, Half, Kind, Orig, Dir);
+
+			T ExpectedDistance(0);
+			std::size_t ExpectedIndex = 0;
+			bool const ExpectedHit = grid_hit(Count, Orig, Dir, ExpectedDistance, ExpectedIndex);
+
+			// The first triangle of a cell is always hit from below, tying with the second layer
+			if(Kind == 0)
+			{
+				Error += ExpectedHit == (grid_index(0, Cell % GridCells, Cell / GridCells, Half) < Count) ? 0 : 1;
+				Error += !ExpectedHit || (ExpectedIndex < LayerSize && ExpectedDistance == T(1)) ? 0 : 1;
+			}
+			else if(Kind >= 4)
+				Error += !ExpectedHit ? 0 : 1;
+
+			bool BruteHit = false;
+			vec2Type BruteBary(0);
+			T BruteDistance(0);
+			std::size_t BruteIndex = 0;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				vec2Type Bary;
+				T Distance;
+				if(!glm::intersectRayTriangle(Orig, Dir, V0.load(i), V1.load(i), V2.load(i), Bary, Distance) || Distance < T(0))
+					continue;
+				if(BruteHit && !(Distance < BruteDistance))
+					continue;
+				BruteHit = true;
+				BruteBary = Bary;
+				BruteDistance = Distance;
+				BruteIndex = i;
+			}
+
+			vec2Type Bary(-1);
+			T Distance(-1);
+			std::size_t Index = Count + 1;
+			bool const Hit = glm::intersectRayTriangle(Bvh, Orig, Dir, V0, V1, V2, Bary, Distance, Index);
+
+			Error += Hit == ExpectedHit && BruteHit == ExpectedHit ? 0 : 1;
+			if(Hit)
+			{
+				Error += Index == ExpectedIndex && BruteIndex == ExpectedIndex ? 0 : 1;
+				Error += glm::abs(Distance - ExpectedDistance) <= std::numeric_limits<T>::epsilon() * T(64) * ExpectedDistance ? 0 : 1;
+				Error += Distance == BruteDistance ? 0 : 1;
+				Error += Bary == BruteBary ? 0 : 1;
+			}
+			else
+				Error += Index == Count + 1 && Distance == T(-1) && Bary.x == T(-1) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// Spheres of radius 0.25 on the integer lattice, 8 x 8 columns stacked along z.
+// Layers 0 and 1 are both at z = 0 to create ties, layer l > 1 is at z = l - 1.
+template<typename T>
+static glm::vec<3, T, glm::defaultp> sphere_center(std::size_t i)
+{
+	return glm::vec<3, T, glm::defaultp>(static_cast<T>(i % 8), static_cast<T>((i / 8) % 8), grid_depth<T>(i / 64));
+}
+
+// Nearest sphere known from the lattice layout, same as intersectRaySphere applied to all the spheres
+template<typename T>
+static int test_ray_sphere()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	int Error = 0;
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+		glm::vec_soa<3, T> Center(Count);
+		std::vector<T> Radius(Count + 1, T(0.25));
+		for(std::size_t i = 0; i < Count; ++i)
+			Center.store(i, sphere_center<T>(i));
+		glm::vec_soa<3, T> BoxMin(Count), BoxMax(Count);
+		glm::computeSphereBounds(Center, &Radius[0], BoxMin, BoxMax);
+
+		glm::bvh<T> Bvh;
+		Bvh.build(BoxMin, BoxMax, 2);
+
+		for(std::size_t Column = 0; Column < 64; Column += 3)
+		for(std::size_t Kind = 0; Kind < 4; ++Kind)
+		{
+			// Along a column upward and downward, then between the columns
+			vec3Type Orig = sphere_center<T>(Column);
+			Orig.z = Kind == 1 ? T(100) : T(-1);
+			Orig.x += Kind == 2 ? T(0.5) : T(0);
+			Orig.y += Kind == 3 ? T(0.5) : T(0);
+			vec3Type const Dir(T(0), T(0), Kind == 1 ? T(-1) : T(1));
+
+			bool const ExpectedHit = Kind < 2 && Column < Count;
+			std::size_t const Top = Column < Count ? Column + (Count - 1 - Column) / 64 * 64 : 0;
+			std::size_t const ExpectedIndex = Kind == 1 && Top >= 128 ? Top : Column;
+			T const ExpectedDistance = Kind == 1 ? T(100) - grid_depth<T>(ExpectedIndex / 64) - T(0.25) : T(0.75);
+
+			bool BruteHit = false;
+			T BruteDistance(0);
+			std::size_t BruteIndex = 0;
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T Distance;
+				if(!glm::intersectRaySphere(Orig, Dir, Center.load(i), Radius[i] * Radius[i], Distance))
+					continue;
+				if(BruteHit && !(Distance < BruteDistance))
+					continue;
+				BruteHit = true;
+				BruteDistance = Distance;
+				BruteIndex = i;
+			}
+
+			T Distance(-1);
+			std::size_t Index = Count + 1;
+			bool const Hit = glm::intersectRaySphere(Bvh, Orig, Dir, Center, &Radius[0], Distance, Index);
+
+			Error += Hit == ExpectedHit && BruteHit == ExpectedHit ? 0 : 1;
+			if(Hit)
+			{
+				Error += Index == ExpectedIndex && BruteIndex == ExpectedIndex ? 0 : 1;
+				Error += glm::abs(Distance - ExpectedDistance) <= std::numeric_limits<T>::epsilon() * T(64) * ExpectedDistance ? 0 : 1;
+				Error += Distance == BruteDistance ? 0 : 1;
+			}
+			else
+				Error += Index == Count + 1 && Distance == T(-1) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// Triangles of the grid known to overlap the query, the query bounds falling inside the cells and between the layers
+static int test_query()
+{
+	struct query
+	{
+		std::size_t MinX, MinY, MaxX, MaxY, MinLayer, MaxLayer;
+	};
+
+	int Error = 0;
+
+	// Cell and layer ranges, inclusive
+	query const Queries[] = {
+		{0, 0, 0, 0, 0, 1},
+		{3, 5, 9, 6, 2, 4},
+		{0, 0, 15, 15, 0, 20},
+		{15, 0, 15, 15, 3, 3},
+		{20, 20, 22, 22, 0, 1}};
+
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+		glm::vec3_soa V0, V1, V2;
+		make_triangles(Count, V0, V1, V2);
+		glm::vec3_soa BoxMin(Count), BoxMax(Count);
+		glm::computeTriangleBounds(V0, V1, V2, BoxMin, BoxMax);
+
+		glm::bvh<float> Bvh;
+		Bvh.build(BoxMin, BoxMax, 3);
+
+		for(std::size_t q = 0; q < sizeof(Queries) / sizeof(Queries[0]); ++q)
+		{
+			query const& Query = Queries[q];
+			glm::vec3 const Min(static_cast<float>(Query.MinX) * 0.5f + 0.25f, static_cast<float>(Query.MinY) * 0.5f + 0.25f, grid_depth<float>(Query.MinLayer) - 0.5f);
+			glm::vec3 const Max(static_cast<float>(Query.MaxX) * 0.5f + 0.25f, static_cast<float>(Query.MaxY) * 0.5f + 0.25f, grid_depth<float>(Query.MaxLayer) + 0.5f);
+
+			std::vector<std::size_t> ExpectedBox;
+			for(std::size_t Layer = Query.MinLayer; Layer <= Query.MaxLayer; ++Layer)
+			for(std::size_t y = Query.MinY; y <= Query.MaxY && y < GridCells; ++y)
+			for(std::size_t x = Query.MinX; x <= Query.MaxX && x < GridCells; ++x)
+			for(std::size_t Half = 0; Half < 2; ++Half)
+				if(grid_index(Layer, x, y, Half) < Count)
+					ExpectedBox.push_back(grid_index(Layer, x, y, Half));
+			std::sort(ExpectedBox.begin(), ExpectedBox.end());
+
+			// Results are appended
+			std::vector<std::size_t> Box(1, Count);
+			std::size_t const BoxCount = glm::queryBox(Bvh, BoxMin, BoxMax, Min, Max, Box);
+			Error += BoxCount == ExpectedBox.size() && Box.size() == BoxCount + 1 && Box[0] == Count ? 0 : 1;
+			Box.erase(Box.begin());
+			std::sort(Box.begin(), Box.end());
+			Error += Box == ExpectedBox ? 0 : 1;
+		}
+
+		// A sphere on a cell corner overlaps the cells around it in its layer, one inside a cell only that cell
+		for(std::size_t Layer = 1; Layer < 4; ++Layer)
+		for(std::size_t y = 0; y <= GridCells; y += 4)
+		for(std::size_t x = 0; x <= GridCells; x += 4)
+		for(std::size_t Inside = 0; Inside < 2; ++Inside)
+		{
+			float const Offset = Inside ? 0.25f : 0.0f;
+			glm::vec3 const Center(static_cast<float>(x) * 0.5f + Offset, static_cast<float>(y) * 0.5f + Offset, grid_depth<float>(Layer));
+
+			std::vector<std::size_t> ExpectedSphere;
+			for(std::size_t Half = 0; Half < 2; ++Half)
+			for(std::size_t j = Inside ? y : (y > 0 ? y - 1 : y); j <= y && j < GridCells; ++j)
+			for(std::size_t i = Inside ? x : (x > 0 ? x - 1 : x); i <= x && i < GridCells; ++i)
+			{
+				// Layers 0 and 1 are at the same depth
+				for(std::size_t l = Layer == 1 ? 0 : Layer; l <= Layer; ++l)
+					if(grid_index(l, i, j, Half) < Count)
+						ExpectedSphere.push_back(grid_index(l, i, j, Half));
+			}
+			std::sort(ExpectedSphere.begin(), ExpectedSphere.end());
+
+			std::vector<std::size_t> Sphere;
+			std::size_t const SphereCount = glm::querySphere(Bvh, BoxMin, BoxMax, Center, Inside ? 0.1f : 0.3f, Sphere);
+			Error += SphereCount == Sphere.size() ? 0 : 1;
+			std::sort(Sphere.begin(), Sphere.end());
+			Error += Sphere == ExpectedSphere ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+// Degenerated inputs: all the primitives at the same place
+static int test_degenerated()
+{
+	int Error = 0;
+
+	std::size_t const Count = 1000;
+	glm::vec3_soa BoxMin(Count), BoxMax(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		BoxMin.store(i, glm::vec3(-1));
+		BoxMax.store(i, glm::vec3(1));
+	}
+
+	glm::bvh<float> Bvh;
+	Bvh.build(BoxMin, BoxMax, 4, 4);
+	Error += Bvh.nodes().size() <= 2 * Count - 1 ? 0 : 1;
+
+	std::vector<std::size_t> Out;
+	Error += glm::queryBox(Bvh, BoxMin, BoxMax, glm::vec3(0), glm::vec3(0), Out) == Count ? 0 : 1;
+	Error += glm::queryBox(Bvh, BoxMin, BoxMax, glm::vec3(2), glm::vec3(3), Out) == 0 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_structure<float>();
+	Error += test_structure<double>();
+	Error += test_threads();
+	Error += test_ray_triangle<float>();
+	Error += test_ray_triangle<double>();
+	Error += test_ray_sphere<float>();
+	Error += test_ray_sphere<double>();
+	Error += test_query();
+	Error += test_degenerated();
+
+	return Error;
+}
@@ -4,6 +4,11 @@
 #include <glm/ext/matrix_relational.hpp>
 #include <glm/ext/matrix_transform.hpp>
 #include <glm/ext/scalar_constants.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <vector>
+#include <cstddef>
 
 static int test_identity() {
 	int Error = 0;
@@ -48,12 +53,278 @@ static int test_scale_translate() {
 	return Error;
 }
 
+// Translation * rotation * shear * scale, the shear holding skew.z in [1][0], skew.y in [2][0] and skew.x in [2][1] as recomposeAffine
+template<typename T>
+struct transform
+{
+	glm::vec<3, T, glm::defaultp> Translation;
+	T Degrees;
+	glm::vec<3, T, glm::defaultp> Axis;
+	glm::vec<3, T, glm::defaultp> Skew;
+	glm::vec<3, T, glm::defaultp> Scale;
+
+	glm::mat<3, 3, T, glm::defaultp> rotation() const
+	{
+		return glm::mat<3, 3, T, glm::defaultp>(glm::rotate(glm::mat<4, 4, T, glm::defaultp>(1), glm::radians(Degrees), glm::normalize(Axis)));
+	}
+
+	glm::mat<4, 4, T, glm::defaultp> matrix() const
+	{
+		typedef glm::vec<3, T, glm::defaultp> vec3Type;
+		typedef glm::vec<4, T, glm::defaultp> vec4Type;
+
+		glm::mat<3, 3, T, glm::defaultp> const Rotation = rotation();
+		return glm::mat<4, 4, T, glm::defaultp>(
+			vec4Type(Rotation * vec3Type(Scale.x, 0, 0), 0),
+			vec4Type(Rotation * vec3Type(Skew.z * Scale.y, Scale.y, 0), 0),
+			vec4Type(Rotation * vec3Type(Skew.y * Scale.z, Skew.x * Scale.z, Scale.z), 0),
+			vec4Type(Translation, 1));
+	}
+
+	// Scales at or below epsilon times the largest one make the transform singular
+	bool decomposable() const
+	{
+		glm::vec<3, T, glm::defaultp> const AbsScale = glm::abs(Scale);
+		T const MinScale = glm::epsilon<T>() * glm::max(glm::max(AbsScale.x, AbsScale.y), AbsScale.z);
+		return AbsScale.x > MinScale && AbsScale.y > MinScale && AbsScale.z > MinScale;
+	}
+
+	// The decomposition finds positive scales, then negates all of them with the rotation when the determinant is negative.
+	// Each negative scale flips the sign of the skews between its axis and the others.
+	bool mirrored() const
+	{
+		return Scale.x * Scale.y * Scale.z < static_cast<T>(0);
+	}
+
+	glm::vec<3, T, glm::defaultp> decomposedScale() const
+	{
+		return glm::abs(Scale) * (mirrored() ? static_cast<T>(-1) : static_cast<T>(1));
+	}
+
+	glm::mat<3, 3, T, glm::defaultp> decomposedRotation() const
+	{
+		glm::mat<3, 3, T, glm::defaultp> const Rotation = rotation();
+		glm::vec<3, T, glm::defaultp> const Sign = glm::sign(Scale) * (mirrored() ? static_cast<T>(-1) : static_cast<T>(1));
+		return glm::mat<3, 3, T, glm::defaultp>(Rotation[0] * Sign.x, Rotation[1] * Sign.y, Rotation[2] * Sign.z);
+	}
+
+	glm::vec<3, T, glm::defaultp> decomposedSkew() const
+	{
+		glm::vec<3, T, glm::defaultp> const Sign = glm::sign(Scale);
+		return Skew * glm::vec<3, T, glm::defaultp>(Sign.y * Sign.z, Sign.x * Sign.z, Sign.x * Sign.y);
+	}
+};
+
+template<typename T>
+static std::vector<transform<T> > make_transforms()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	vec3Type const X(1, 0, 0), Y(0, 1, 0), Z(0, 0, 1);
+	vec3Type const NoSkew(0);
+	T const Tiny = static_cast<T>(1e-9);
+
+	transform<T> const Transforms[] = {
+		// Rotations, translations and scales
+		{vec3Type(0), 0, Z, NoSkew, vec3Type(1)},
+		{vec3Type(1, -2, 3), 90, Z, NoSkew, vec3Type(2, 3, 4)},
+		{vec3Type(-50, 25, 100), 30, vec3Type(1, 1, 0), NoSkew, vec3Type(0.5, 1, 2)},
+		{vec3Type(7, 0, 0), 179, vec3Type(1, 2, 3), NoSkew, vec3Type(3)},
+		// Skews
+		{vec3Type(0, 1, 0), 45, X, vec3Type(0.5, -0.25, 0.75), vec3Type(1, 2, 1)},
+		{vec3Type(0), 0, Z, vec3Type(0, 0, 1), vec3Type(1)},
+		// Negative determinants, and two negative scales making a rotation
+		{vec3Type(3, 0, -3), 60, X, NoSkew, vec3Type(2, -3, 4)},
+		{vec3Type(0), 120, vec3Type(1, 1, 1), NoSkew, vec3Type(-1, -2, -3)},
+		{vec3Type(-1), 150, Y, vec3Type(0.25, 0, 0), vec3Type(-2, -2, 1)},
+		{vec3Type(10, 20, 30), 10, vec3Type(1, 2, 3), vec3Type(0.5), vec3Type(1, -1, 2)},
+		// Near singular scales, the last one only decomposable in double precision
+		{vec3Type(2, 2, 2), 75, Z, NoSkew, vec3Type(4, 0.001, 1)},
+		{vec3Type(0, 0, 5), 20, vec3Type(0, 1, 1), vec3Type(0.5, 0, 0), vec3Type(1, 1, Tiny)},
+		// Singular
+		{vec3Type(1, 2, 3), 30, X, NoSkew, vec3Type(0, 1, 1)},
+		{vec3Type(-4, 0, 4), 0, Z, vec3Type(0, 0.5, 0), vec3Type(2, -1, 0)}};
+
+	return std::vector<transform<T> >(Transforms, Transforms + sizeof(Transforms) / sizeof(Transforms[0]));
+}
+
+template<typename T>
+static int test_affine()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::vec<4, T, glm::defaultp> vec4Type;
+	typedef glm::qua<T, glm::defaultp> quatType;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3Type;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4Type;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	std::vector<transform<T> > const Transforms = make_transforms<T>();
+	for(std::size_t i = 0; i < Transforms.size(); ++i)
+	{
+		transform<T> const& Transform = Transforms[i];
+		mat4Type const Matrix = Transform.matrix();
+
+		vec3Type Scale, Translation, Skew;
+		quatType Orientation;
+		bool const Result = glm::decomposeAffine(Matrix, Scale, Orientation, Translation, Skew);
+
+		vec3Type Scale3, Translation3, Skew3;
+		quatType Orientation3;
+		bool const Result3 = glm::decomposeAffine(glm::affineFromMat4(Matrix), Scale3, Orientation3, Translation3, Skew3);
+		Error += Result == Result3 ? 0 : 1;
+		Error += Scale == Scale3 && Orientation == Orientation3 && Translation == Translation3 && Skew == Skew3 ? 0 : 1;
+
+		Error += Translation == Transform.Translation ? 0 : 1;
+
+		if(!Transform.decomposable())
+		{
+			Error += !Result ? 0 : 1;
+			Error += Scale == vec3Type(0) && Skew == vec3Type(0) ? 0 : 1;
+			Error += Orientation == quatType(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)) ? 0 : 1;
+			continue;
+		}
+		Error += Result ? 0 : 1;
+
+		// The components the transform was built from, up to the sign convention of mirrored transforms
+		vec3Type const ExpectedScale = Transform.decomposedScale();
+		Error += glm::all(glm::equal(Scale, ExpectedScale, glm::abs(ExpectedScale) * Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mat3_cast(Orientation), Transform.decomposedRotation(), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Skew, Transform.decomposedSkew(), Epsilon)) ? 0 : 1;
+		Error += (glm::determinant(mat3Type(Matrix)) < static_cast<T>(0)) == Transform.mirrored() ? 0 : 1;
+
+		// Same components as the general decomposition
+		vec3Type ScaleRef(0), TranslationRef(0), SkewRef(0);
+		quatType OrientationRef(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+		vec4Type Perspective(0);
+		Error += glm::decompose(Matrix, ScaleRef, OrientationRef, TranslationRef, SkewRef, Perspective) ? 0 : 1;
+		Error += Scale == ScaleRef && Orientation == OrientationRef && Skew == SkewRef ? 0 : 1;
+		Error += Perspective == vec4Type(0, 0, 0, 1) ? 0 : 1;
+
+		Error += glm::equal(glm::length(Orientation), static_cast<T>(1), Epsilon) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::recomposeAffine(Scale, Orientation, Translation, Skew), Matrix, Epsilon * static_cast<T>(100))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// The general recomposition only computes float matrices
+static int test_recompose()
+{
+	int Error = 0;
+
+	std::vector<transform<float> > const Transforms = make_transforms<float>();
+	for(std::size_t i = 0; i < Transforms.size(); ++i)
+	{
+		glm::mat4 const Matrix = Transforms[i].matrix();
+
+		glm::vec3 Scale, Translation, Skew;
+		glm::quat Orientation;
+		glm::decomposeAffine(Matrix, Scale, Orientation, Translation, Skew);
+
+		Error += glm::all(glm::equal(glm::recomposeAffine(Scale, Orientation, Translation, Skew), glm::recompose(Scale, Orientation, Translation, Skew, glm::vec4(0, 0, 0, 1)), 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static glm::mat<4, 4, T, Q> convert(glm::mat<4, 4, T, Q> const& m, glm::mat<4, 4, T, Q> const&)
+{
+	return m;
+}
+
+template<typename T, glm::qualifier Q>
+static glm::mat<3, 4, T, Q> convert(glm::mat<4, 4, T, Q> const& m, glm::mat<3, 4, T, Q> const&)
+{
+	return glm::affineFromMat4(m);
+}
+
+// Batches against the single matrix functions, only FMA contraction of the latter may change the last bits
+template<typename matType>
+static int test_batch(unsigned Threads)
+{
+	typedef typename matType::value_type T;
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::qua<T, glm::defaultp> quatType;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	// Counts around the blocks of 8 and 4 matrices, the last one split in ranges of odd size across threads
+	std::size_t const Counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 12, 13, 16, 17, 40003};
+
+	std::vector<transform<T> > const Transforms = make_transforms<T>();
+	for(std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); ++k)
+	{
+		std::size_t const Count = Counts[k];
+
+		// Matrix i is transform (i + k) * 5, moving each transform across the lanes of the blocks
+		std::vector<matType> Matrices(Count);
+		std::vector<bool> Decomposable(Count);
+		std::size_t Singular = 0;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			transform<T> const& Transform = Transforms[(i + k) * 5 % Transforms.size()];
+			Matrices[i] = convert(Transform.matrix(), matType());
+			Decomposable[i] = Transform.decomposable();
+			Singular += Decomposable[i] ? 0 : 1;
+		}
+
+		std::vector<vec3Type> Scale(Count), Translation(Count), Skew(Count), Unused(Count, vec3Type(5));
+		std::vector<quatType> Orientation(Count);
+		std::size_t const Decomposed = glm::decomposeAffine(Matrices.data(), Scale.data(), Orientation.data(), Translation.data(), Skew.data(), Count, Threads);
+		Error += Decomposed == Count - Singular ? 0 : 1;
+
+		std::vector<quatType> OrientationNoSkew(Count);
+		Error += glm::decomposeAffine(Matrices.data(), Unused.data(), OrientationNoSkew.data(), Unused.data(), static_cast<vec3Type*>(nullptr), Count, Threads) == Decomposed ? 0 : 1;
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			vec3Type ScaleRef, TranslationRef, SkewRef;
+			quatType OrientationRef;
+			glm::decomposeAffine(Matrices[i], ScaleRef, OrientationRef, TranslationRef, SkewRef);
+
+			Error += glm::all(glm::equal(Scale[i], ScaleRef, Epsilon * static_cast<T>(10))) ? 0 : 1;
+			Error += glm::all(glm::equal(Orientation[i], OrientationRef, Epsilon)) ? 0 : 1;
+			Error += Orientation[i] == OrientationNoSkew[i] ? 0 : 1;
+			Error += Translation[i] == TranslationRef ? 0 : 1;
+			Error += glm::all(glm::equal(Skew[i], SkewRef, Epsilon)) ? 0 : 1;
+		}
+
+		std::vector<matType> Recomposed(Count), RecomposedNoSkew(Count);
+		glm::recomposeAffine(Scale.data(), Orientation.data(), Translation.data(), Skew.data(), Recomposed.data(), Count, Threads);
+		glm::recomposeAffine(Scale.data(), Orientation.data(), Translation.data(), static_cast<vec3Type const*>(nullptr), RecomposedNoSkew.data(), Count, Threads);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Recomposed[i], convert(glm::recomposeAffine(Scale[i], Orientation[i], Translation[i], Skew[i]), matType()), Epsilon * static_cast<T>(100))) ? 0 : 1;
+			Error += glm::all(glm::equal(RecomposedNoSkew[i], convert(glm::recomposeAffine(Scale[i], Orientation[i], Translation[i], vec3Type(0)), matType()), Epsilon * static_cast<T>(100))) ? 0 : 1;
+			if(Decomposable[i])
+				Error += glm::all(glm::equal(Recomposed[i], Matrices[i], static_cast<T>(0.01))) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_identity();
 	Error += test_scale_translate();
+	Error += test_affine<float>();
+	Error += test_affine<double>();
+	Error += test_recompose();
+	Error += test_batch<glm::mat4>(1);
+	Error += test_batch<glm::mat3x4>(1);
+	Error += test_batch<glm::mat4>(4);
+	Error += test_batch<glm::mat3x4>(4);
+	Error += test_batch<glm::dmat4>(1);
+	Error += test_batch<glm::dmat3x4>(3);
 
 	return Error;
 }
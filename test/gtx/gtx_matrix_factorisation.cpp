@@ -2,6 +2,11 @@
 #include <glm/gtx/matrix_factorisation.hpp>
 #include <glm/gtc/constants.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <vector>
+#include <cstddef>
+#include <utility>
 
 template <glm::length_t C, glm::length_t R, typename T, glm::qualifier Q>
 static int test_qr(glm::mat<C, R, T, Q> m)
@@ -79,6 +84,260 @@ static int test_rq(glm::mat<C, R, T, Q> m)
 	return Error;
 }
 
+// u * diagonal3x3(s) * transpose(v) from the rotations u and v of Degrees around Axis
+template <typename T>
+struct svd_case
+{
+	T DegreesU;
+	glm::vec<3, T, glm::defaultp> AxisU;
+	T DegreesV;
+	glm::vec<3, T, glm::defaultp> AxisV;
+	glm::vec<3, T, glm::defaultp> Singular;
+
+	glm::mat<3, 3, T, glm::defaultp> u() const
+	{
+		return glm::mat3_cast(glm::angleAxis(glm::radians(DegreesU), glm::normalize(AxisU)));
+	}
+
+	glm::mat<3, 3, T, glm::defaultp> v() const
+	{
+		return glm::mat3_cast(glm::angleAxis(glm::radians(DegreesV), glm::normalize(AxisV)));
+	}
+
+	glm::mat<3, 3, T, glm::defaultp> matrix() const
+	{
+		glm::mat<3, 3, T, glm::defaultp> const U = u();
+		return glm::mat<3, 3, T, glm::defaultp>(U[0] * Singular.x, U[1] * Singular.y, U[2] * Singular.z) * glm::transpose(v());
+	}
+
+	// The magnitudes in decreasing order, the last one taking the sign of the determinant
+	glm::vec<3, T, glm::defaultp> singular() const
+	{
+		glm::vec<3, T, glm::defaultp> s = glm::abs(Singular);
+		if (s.y < s.z)
+			std::swap(s.y, s.z);
+		if (s.x < s.y)
+			std::swap(s.x, s.y);
+		if (s.y < s.z)
+			std::swap(s.y, s.z);
+		if (glm::sign(Singular.x) * glm::sign(Singular.y) * glm::sign(Singular.z) < static_cast<T>(0))
+			s.z = -s.z;
+		return s;
+	}
+
+	// The symmetric factor of a reflection takes the negative eigenvalue along any direction of a repeated smallest singular value
+	bool uniqueSymmetric() const
+	{
+		glm::vec<3, T, glm::defaultp> const s = singular();
+		return s.z >= static_cast<T>(0) || s.y > -s.z;
+	}
+
+	// Without reflection nor small singular values, the polar decomposition is u * transpose(v) and v * diagonal3x3(s) * transpose(v)
+	bool positiveDefinite() const
+	{
+		return glm::all(glm::greaterThan(Singular, glm::vec<3, T, glm::defaultp>(glm::max(glm::max(Singular.x, Singular.y), Singular.z) * static_cast<T>(0.001))));
+	}
+};
+
+template <typename T>
+static std::vector<svd_case<T> > make_cases()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	vec3Type const X(1, 0, 0), Z(0, 0, 1);
+
+	svd_case<T> const Cases[] = {
+		{30, vec3Type(1, 2, 3), 70, vec3Type(-1, 0, 1), vec3Type(3, 2, 1)},
+		{0, Z, 0, Z, vec3Type(1)},
+		{120, vec3Type(1, 1, 1), 0, Z, vec3Type(1, 1, 1)},
+		{-50, vec3Type(0, 1, 2), 20, X, vec3Type(-1, 3, 2)},
+		// Repeated singular values
+		{45, X, 10, vec3Type(2, -1, 1), vec3Type(5, 5, 1)},
+		{80, vec3Type(1, 1, 0), -35, Z, vec3Type(2, 1, 1)},
+		{15, vec3Type(3, 1, 2), 60, vec3Type(1, -1, -1), vec3Type(4)},
+		// Rank deficient
+		{25, vec3Type(1, 0, 1), 100, vec3Type(0, 1, 1), vec3Type(3, 1, 0)},
+		{-70, Z, 40, vec3Type(1, 2, 0), vec3Type(0, 2, 0)},
+		{0, Z, 0, Z, vec3Type(0)},
+		// Reflections
+		{30, vec3Type(1, 2, 3), 70, vec3Type(-1, 0, 1), vec3Type(3, 2, -1)},
+		{-10, X, 130, vec3Type(2, 1, 1), vec3Type(-4, 2, 1)},
+		{65, vec3Type(1, -2, 1), 0, Z, vec3Type(-1)},
+		{5, vec3Type(1, 1, 1), 95, X, vec3Type(2, -2, 2)},
+		// Badly conditioned and badly scaled
+		{55, vec3Type(2, 3, 1), 25, vec3Type(1, 0, 2), vec3Type(1, 0.0001, 0.00000001)},
+		{35, vec3Type(0, 1, 3), 75, vec3Type(1, 1, 0), vec3Type(3e15, 2e15, 1e15)},
+		{75, vec3Type(3, 2, 1), 45, vec3Type(0, 0, 1), vec3Type(3e-20, 2e-20, -1e-20)}};
+
+	return std::vector<svd_case<T> >(Cases, Cases + sizeof(Cases) / sizeof(Cases[0]));
+}
+
+template <typename T>
+static int test_rotation(glm::mat<3, 3, T, glm::defaultp> const& m, T epsilon)
+{
+	int Error = 0;
+
+	Error += glm::all(glm::equal(glm::transpose(m) * m, glm::mat<3, 3, T, glm::defaultp>(1), epsilon)) ? 0 : 1;
+	Error += glm::abs(glm::determinant(m) - static_cast<T>(1)) < epsilon ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T>
+static int test_svd(glm::mat<3, 3, T, glm::defaultp> const& m, T epsilon)
+{
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3Type;
+
+	int Error = 0;
+
+	T Largest = static_cast<T>(0);
+	for (glm::length_t c = 0; c < 3; c++)
+	for (glm::length_t r = 0; r < 3; r++)
+		Largest = glm::max(Largest, glm::abs(m[c][r]));
+
+	mat3Type u, v;
+	glm::vec<3, T, glm::defaultp> s;
+	glm::svd_decompose(m, u, s, v);
+
+	Error += test_rotation(u, epsilon);
+	Error += test_rotation(v, epsilon);
+
+	//Test if u*diagonal(s)*transpose(v) really equals the input matrix
+	mat3Type const d(s.x, 0, 0, 0, s.y, 0, 0, 0, s.z);
+	Error += glm::all(glm::equal(u * d * glm::transpose(v), m, epsilon * Largest)) ? 0 : 1;
+
+	//Test if the singular values are sorted, the last one taking the sign of the determinant
+	Error += s.x >= static_cast<T>(0) && s.y >= static_cast<T>(0) ? 0 : 1;
+	Error += s.x >= s.y - epsilon * Largest && s.y >= glm::abs(s.z) - epsilon * Largest ? 0 : 1;
+	Error += s.z * glm::determinant(m / (Largest > static_cast<T>(0) ? Largest : static_cast<T>(1))) >= -epsilon ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T>
+static int test_polar(glm::mat<3, 3, T, glm::defaultp> const& m, T epsilon)
+{
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3Type;
+
+	int Error = 0;
+
+	T Largest = static_cast<T>(0);
+	for (glm::length_t c = 0; c < 3; c++)
+	for (glm::length_t r = 0; r < 3; r++)
+		Largest = glm::max(Largest, glm::abs(m[c][r]));
+
+	mat3Type r, p;
+	glm::polar_decompose(m, r, p);
+
+	Error += test_rotation(r, epsilon);
+	Error += glm::all(glm::equal(p, glm::transpose(p), epsilon * Largest)) ? 0 : 1;
+	Error += glm::all(glm::equal(r * p, m, epsilon * Largest)) ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T>
+static int test_factorisation(T epsilon)
+{
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3Type;
+
+	int Error = 0;
+
+	Error += test_svd(mat3Type(12, 6, -4, -51, 167, 24, 4, -68, -41), epsilon);
+	Error += test_svd(mat3Type(1), epsilon);
+	Error += test_svd(mat3Type(0), epsilon);
+
+	//A shear has no repeated singular value but is far from a rotation
+	mat3Type Shear(1);
+	Shear[1][0] = static_cast<T>(100);
+	Error += test_svd(Shear, epsilon);
+	Error += test_polar(Shear, epsilon);
+
+	std::vector<svd_case<T> > const Cases = make_cases<T>();
+	for (std::size_t i = 0; i < Cases.size(); i++)
+	{
+		svd_case<T> const& Case = Cases[i];
+		mat3Type const m = Case.matrix();
+
+		Error += test_svd(m, epsilon);
+		Error += test_polar(m, epsilon);
+
+		glm::vec<3, T, glm::defaultp> const Expected = Case.singular();
+		mat3Type u, v;
+		glm::vec<3, T, glm::defaultp> s;
+		glm::svd_decompose(m, u, s, v);
+		Error += glm::all(glm::equal(s, Expected, epsilon * Expected.x)) ? 0 : 1;
+
+		//The polar decomposition gives back the rotation and the symmetric positive definite matrix
+		if (!Case.positiveDefinite())
+			continue;
+		mat3Type const V = Case.v();
+		mat3Type const Stretch = mat3Type(V[0] * Case.Singular.x, V[1] * Case.Singular.y, V[2] * Case.Singular.z) * glm::transpose(V);
+		mat3Type r, p;
+		glm::polar_decompose(m, r, p);
+		Error += glm::all(glm::equal(r, Case.u() * glm::transpose(V), epsilon * static_cast<T>(10))) ? 0 : 1;
+		Error += glm::all(glm::equal(p, Stretch, epsilon * Expected.x)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Batches against the single matrix functions, only FMA contraction of the latter may change the last bits
+template <typename T>
+static int test_batch(T epsilon)
+{
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3Type;
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+
+	//Counts around the blocks of 8 and 4 matrices
+	static std::size_t const Counts[] = {0, 1, 3, 4, 5, 7, 8, 9, 12, 13, 16, 17};
+
+	int Error = 0;
+
+	std::vector<svd_case<T> > const Cases = make_cases<T>();
+	for (std::size_t k = 0; k < sizeof(Counts) / sizeof(Counts[0]); k++)
+	{
+		std::size_t const Count = Counts[k];
+
+		//Matrix i is case i * 7 + k, moving each case across the lanes of the blocks
+		std::vector<mat3Type> m(Count), u(Count), v(Count), r(Count), p(Count);
+		std::vector<vec3Type> s(Count), Expected(Count);
+		std::vector<bool> UniqueSymmetric(Count);
+		for (std::size_t i = 0; i < Count; i++)
+		{
+			svd_case<T> const& Case = Cases[(i * 7 + k) % Cases.size()];
+			m[i] = Case.matrix();
+			Expected[i] = Case.singular();
+			UniqueSymmetric[i] = Case.uniqueSymmetric();
+		}
+
+		glm::svd_decompose(m.data(), u.data(), s.data(), v.data(), Count);
+		glm::polar_decompose(m.data(), r.data(), p.data(), Count);
+
+		for (std::size_t i = 0; i < Count; i++)
+		{
+			T const Largest = Expected[i].x;
+
+			mat3Type U, V, R, P;
+			vec3Type S;
+			glm::svd_decompose(m[i], U, S, V);
+			glm::polar_decompose(m[i], R, P);
+
+			Error += glm::all(glm::equal(s[i], S, epsilon * Largest)) ? 0 : 1;
+			Error += glm::all(glm::equal(s[i], Expected[i], epsilon * Largest)) ? 0 : 1;
+			if (UniqueSymmetric[i])
+				Error += glm::all(glm::equal(p[i], P, epsilon * Largest)) ? 0 : 1;
+
+			//Singular vectors are only defined up to the sign and to rotations within repeated singular values
+			mat3Type const d(s[i].x, 0, 0, 0, s[i].y, 0, 0, 0, s[i].z);
+			Error += glm::all(glm::equal(u[i] * d * glm::transpose(v[i]), m[i], epsilon * Largest)) ? 0 : 1;
+			Error += glm::all(glm::equal(r[i] * p[i], m[i], epsilon * Largest)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -101,5 +360,10 @@ int main()
 	//Test QR triangular 2
 	Error += test_rq(glm::dmat4x3(12.0, 6.0, -4.0, -51.0, 167.0, 24.0, 4.0, -68.0, -41.0, 7.0, 2.0, 15.0)) ? 1 : 0;
 
+	Error += test_factorisation<float>(0.0001f);
+	Error += test_factorisation<double>(1e-10);
+	Error += test_batch<float>(0.0001f);
+	Error += test_batch<double>(1e-10);
+
 	return Error;
 }
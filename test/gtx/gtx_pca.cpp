@@ -496,6 +496,190 @@ static int testCovar(
 	return 0;
 }
 
+// Test the single pass covariance accumulator against the two pass computation
+template<glm::length_t D, typename T, glm::qualifier Q>
+static int testCovarAccumulator(unsigned int randomEngineSeed)
+{
+	typedef glm::vec<D, T, Q> vec;
+	typedef glm::mat<D, D, T, Q> mat;
+
+	// #1: expected result with fixed data set, one point at a time and by array
+	std::vector<vec> testData;
+	agarose::fillTestData(testData);
+
+	glm::covariance_accumulator<D, T, Q> single;
+	for(std::size_t i = 0; i < testData.size(); ++i)
+		glm::accumulateCovariance(single, testData[i]);
+	if(single.Count != testData.size())
+		return failReport(__LINE__);
+	if(!vectorEpsilonEqual(single.Mean, computeCenter(testData), myEpsilon<T>()))
+		return failReport(__LINE__);
+	if(!matrixEpsilonEqual(glm::computeCovarianceMatrix(single), mat(agarose::expectedCovarData()), myEpsilon<T>()))
+		return failReport(__LINE__);
+
+	glm::covariance_accumulator<D, T, Q> array;
+	glm::accumulateCovariance(array, testData.data(), testData.size());
+	if(!matrixEpsilonEqual(glm::computeCovarianceMatrix(array), mat(agarose::expectedCovarData()), myEpsilon<T>()))
+		return failReport(__LINE__);
+
+	// #2: consistency of merged chunks and threads with random data, around an offset larger than the spread
+	std::default_random_engine rndEng(randomEngineSeed);
+	std::normal_distribution<T> normalDist;
+	testData.resize(300000);
+	for(std::size_t i = 0; i < testData.size(); ++i)
+		for(glm::length_t d = 0; d < D; ++d)
+			testData[i][d] = static_cast<T>(100 * (d + 1)) + normalDist(rndEng) * static_cast<T>(d + 1);
+
+	vec const center = computeCenter(testData);
+	mat const expected = glm::computeCovarianceMatrix(testData.data(), testData.size(), center);
+	T const epsilon = myEpsilon<T>() * static_cast<T>(100);
+
+	glm::covariance_accumulator<D, T, Q> chunks[3];
+	std::size_t const split[] = {0, 1000, 1001, testData.size()};
+	for(std::size_t c = 0; c < 3; ++c)
+		glm::accumulateCovariance(chunks[c], testData.data() + split[c], split[c + 1] - split[c]);
+	glm::covariance_accumulator<D, T, Q> merged;
+	glm::mergeCovariance(merged, glm::covariance_accumulator<D, T, Q>());
+	for(std::size_t c = 0; c < 3; ++c)
+		glm::mergeCovariance(merged, chunks[c]);
+	if(merged.Count != testData.size())
+		return failReport(__LINE__);
+	if(!matrixEpsilonEqual(glm::computeCovarianceMatrix(merged), expected, epsilon))
+		return failReport(__LINE__);
+
+	unsigned int const threads[] = {1, 3, 8};
+	for(std::size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t)
+	{
+		glm::covariance_accumulator<D, T, Q> parallel;
+		glm::accumulateCovariance(parallel, testData.data(), testData.size(), threads[t]);
+		if(parallel.Count != testData.size())
+			return failReport(__LINE__);
+		if(!vectorEpsilonEqual(parallel.Mean, center, epsilon))
+			return failReport(__LINE__);
+		if(!matrixEpsilonEqual(glm::computeCovarianceMatrix(parallel), expected, epsilon))
+			return failReport(__LINE__);
+	}
+
+	// Empty accumulator
+	if(!matrixEpsilonEqual(glm::computeCovarianceMatrix(glm::covariance_accumulator<D, T, Q>()), mat(0), myEpsilon<T>()))
+		return failReport(__LINE__);
+
+	return 0;
+}
+
+// Float points far from the origin: accumulating around the running mean keeps the precision of the spread
+static int testCovarAccumulatorPrecision()
+{
+	std::vector<glm::vec3> ptData;
+	std::vector<glm::dvec3> ptDataDouble;
+	for(int i = 0; i < 100000; ++i)
+	{
+		glm::vec3 const p(
+			10000.0f + static_cast<float>(i % 7) * 0.25f,
+			-20000.0f + static_cast<float>(i % 11) * 0.125f,
+			30000.0f + static_cast<float>(i % 13) * 0.5f);
+		ptData.push_back(p);
+		ptDataDouble.push_back(glm::dvec3(p));
+	}
+
+	glm::dmat3 const expected = glm::computeCovarianceMatrix(ptDataDouble.data(), ptDataDouble.size(), computeCenter(ptDataDouble));
+
+	glm::covariance_accumulator<3, float> acc;
+	glm::accumulateCovariance(acc, ptData.data(), ptData.size());
+	if(!matrixEpsilonEqual(glm::dmat3(glm::computeCovarianceMatrix(acc)), expected, 0.0001))
+		return failReport(__LINE__);
+
+	// float points into a double accumulator
+	glm::covariance_accumulator<3, double> accDouble;
+	glm::accumulateCovariance(accDouble, ptData.data(), ptData.size());
+	if(!matrixEpsilonEqual(glm::computeCovarianceMatrix(accDouble), expected, 0.0000001))
+		return failReport(__LINE__);
+
+	return 0;
+}
+
+// Jacobi eigensolver: A * v = lambda * v with orthonormal eigenvectors
+template<typename T>
+static int checkEigenDecomposition(glm::mat<3, 3, T, glm::defaultp> const& m, T epsilon)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat;
+
+	vec evals;
+	mat evecs;
+	if(glm::findEigenvaluesSymRealJacobi(m, evals, evecs) != 3u)
+		return failReport(__LINE__);
+
+	T scale = static_cast<T>(1);
+	for(glm::length_t i = 0; i < 3; ++i)
+		scale = glm::max(scale, glm::abs(evals[i]));
+
+	for(glm::length_t i = 0; i < 3; ++i)
+	{
+		if(!vectorEpsilonEqual(m * evecs[i], evecs[i] * evals[i], epsilon * scale))
+			return failReport(__LINE__);
+		for(glm::length_t j = 0; j < 3; ++j)
+			if(!glm::epsilonEqual(glm::dot(evecs[i], evecs[j]), i == j ? static_cast<T>(1) : static_cast<T>(0), epsilon))
+				return failReport(__LINE__);
+	}
+
+	return 0;
+}
+
+template<typename T>
+static int testEigenvectorsJacobi(T epsilon, unsigned int randomEngineSeed)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat;
+
+	// #1: same result as findEigenvaluesSymReal on the well-known covariance matrix
+	mat covarMat(agarose::expectedCovarData());
+	vec evals;
+	mat evecs;
+	if(glm::findEigenvaluesSymRealJacobi(covarMat, evals, evecs) != 3u)
+		return failReport(__LINE__);
+	glm::sortEigenvalues(evals, evecs);
+	if(!vectorEpsilonEqual(evals, vec(agarose::expectedEigenvalues<3>()), epsilon))
+		return failReport(__LINE__);
+	for(int i = 0; i < 3; ++i)
+	{
+		vec act = glm::normalize(evecs[i]);
+		vec exp = glm::normalize(agarose::expectedEigenvectors<3>()[i]);
+		if(!sameSign(act[0], exp[0])) exp = -exp;
+		if(!vectorEpsilonEqual(act, exp, epsilon))
+			return failReport(__LINE__);
+	}
+
+	// #2: random symmetric matrices, diagonal, degenerated and zero matrices
+	std::default_random_engine rndEng(randomEngineSeed);
+	std::normal_distribution<T> normalDist;
+	for(int n = 0; n < 1000; ++n)
+	{
+		mat m;
+		for(glm::length_t c = 0; c < 3; ++c)
+			for(glm::length_t r = 0; r <= c; ++r)
+				m[c][r] = m[r][c] = normalDist(rndEng);
+		if(n % 4 == 1)
+			m[0][1] = m[1][0] = m[0][2] = m[2][0] = static_cast<T>(0);
+		if(checkEigenDecomposition(m, epsilon) != 0)
+			return failReport(__LINE__);
+	}
+	if(checkEigenDecomposition(mat(static_cast<T>(2)), epsilon) != 0)
+		return failReport(__LINE__);
+	if(checkEigenDecomposition(mat(static_cast<T>(0)), epsilon) != 0)
+		return failReport(__LINE__);
+	if(checkEigenDecomposition(mat(vec(1), vec(1), vec(1)), epsilon) != 0)
+		return failReport(__LINE__);
+
+	// NaN doesn't converge
+	mat nanMat(static_cast<T>(1));
+	nanMat[1][0] = nanMat[0][1] = std::numeric_limits<T>::quiet_NaN();
+	if(glm::findEigenvaluesSymRealJacobi(nanMat, evals, evecs) != 0u)
+		return failReport(__LINE__);
+
+	return 0;
+}
+
 // Computes eigenvalues and eigenvectors from well-known covariance matrix
 template<glm::length_t D, typename T, glm::qualifier Q>
 static int testEigenvectors(T epsilon)
@@ -687,6 +871,20 @@ int main()
 	if (error != 0)
 		return error;
 
+	// test single pass covariance accumulation
+	if(testCovarAccumulator<2, float, glm::defaultp>(7) != 0)
+		error = failReport(__LINE__);
+	if(testCovarAccumulator<3, float, glm::defaultp>(11) != 0)
+		error = failReport(__LINE__);
+	if(testCovarAccumulator<3, double, glm::defaultp>(13) != 0)
+		error = failReport(__LINE__);
+	if(testCovarAccumulator<4, double, glm::defaultp>(17) != 0)
+		error = failReport(__LINE__);
+	if(testCovarAccumulatorPrecision() != 0)
+		error = failReport(__LINE__);
+	if (error != 0)
+		return error;
+
 	// test PCA eigen vector reconstruction
 	// Expected epsilon precision evaluated separately:
 	// https://github.com/sgrottel/exp-pca-precision
@@ -702,6 +900,10 @@ int main()
 		error = failReport(__LINE__);
 	if(testEigenvectors<4, double, glm::defaultp>(0.0000001) != 0)
 		error = failReport(__LINE__);
+	if(testEigenvectorsJacobi<float>(0.00001f, 19) != 0)
+		error = failReport(__LINE__);
+	if(testEigenvectorsJacobi<double>(0.0000000001, 23) != 0)
+		error = failReport(__LINE__);
 	if(error != 0)
 		return error;
 
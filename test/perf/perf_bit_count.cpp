@@ -0,0 +1,106 @@
+#define GLM_FORCE_INLINE
+#include <glm/integer.hpp>
+#include <glm/ext/vector_int4.hpp>
+#include <glm/ext/vector_uint4.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+// Portable implementations, the only ones before the popcnt, lzcnt, tzcnt and SIMD backends
+namespace portable
+{
+	static glm::ivec4 bitCount(glm::uvec4 x)
+	{
+		x = (x & 0x55555555u) + ((x >> 1u) & 0x55555555u);
+		x = (x & 0x33333333u) + ((x >> 2u) & 0x33333333u);
+		x = (x & 0x0F0F0F0Fu) + ((x >> 4u) & 0x0F0F0F0Fu);
+		x = (x & 0x00FF00FFu) + ((x >> 8u) & 0x00FF00FFu);
+		x = (x & 0x0000FFFFu) + ((x >> 16u) & 0x0000FFFFu);
+		return glm::ivec4(x);
+	}
+
+	static glm::ivec4 findMSB(glm::uvec4 x)
+	{
+		x = x | (x >> 1u);
+		x = x | (x >> 2u);
+		x = x | (x >> 4u);
+		x = x | (x >> 8u);
+		x = x | (x >> 16u);
+		return glm::ivec4(31) - bitCount(~x);
+	}
+
+	static int findLSB(glm::uint x)
+	{
+		if(x == 0)
+			return -1;
+		return bitCount(glm::uvec4(~x & (x - 1u))).x;
+	}
+
+	static glm::ivec4 findLSB(glm::uvec4 const& x)
+	{
+		return glm::ivec4(findLSB(x.x), findLSB(x.y), findLSB(x.z), findLSB(x.w));
+	}
+}//namespace portable
+
+static double nanoseconds(std::size_t Elements, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(Elements);
+}
+
+template<typename funcType>
+static double run(std::vector<glm::uvec4> const& In, std::vector<glm::ivec4>& Out, std::size_t Repeat, funcType Func)
+{
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < In.size(); ++i)
+		Out[i] = Func(In[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	return nanoseconds(In.size() * Repeat, t0, t1);
+}
+
+static void report(char const* Name, std::size_t Count, double PortableTime, double GLMTime)
+{
+	std::printf("%s, %d uvec4:\n", Name, static_cast<int>(Count));
+	std::printf("- Portable: %.2f ns/vector\n", PortableTime);
+	std::printf("- GLM: %.2f ns/vector, %.2fx\n", GLMTime, GLMTime > 0.0 ? PortableTime / GLMTime : 0.0);
+}
+
+int main()
+{
+	// 4096 vectors fit in the caches
+	std::size_t const Count = 4096;
+	std::size_t const Repeat = 10000;
+
+	std::vector<glm::uvec4> In(Count);
+	glm::uint Seed = 1;
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < 4; ++c)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		// Mixes small, large and zero values
+		In[i][c] = Seed >> (Seed >> 27);
+	}
+
+	int Error = 0;
+
+	std::vector<glm::ivec4> Portable(Count);
+	std::vector<glm::ivec4> GLM(Count);
+
+	double const BitCountPortable = run(In, Portable, Repeat, [](glm::uvec4 const& v) { return portable::bitCount(v); });
+	double const BitCountGLM = run(In, GLM, Repeat, [](glm::uvec4 const& v) { return glm::bitCount(v); });
+	report("bitCount", Count, BitCountPortable, BitCountGLM);
+	Error += Portable == GLM ? 0 : 1;
+
+	double const FindMSBPortable = run(In, Portable, Repeat, [](glm::uvec4 const& v) { return portable::findMSB(v); });
+	double const FindMSBGLM = run(In, GLM, Repeat, [](glm::uvec4 const& v) { return glm::findMSB(v); });
+	report("findMSB", Count, FindMSBPortable, FindMSBGLM);
+	Error += Portable == GLM ? 0 : 1;
+
+	double const FindLSBPortable = run(In, Portable, Repeat, [](glm::uvec4 const& v) { return portable::findLSB(v); });
+	double const FindLSBGLM = run(In, GLM, Repeat, [](glm::uvec4 const& v) { return glm::findLSB(v); });
+	report("findLSB", Count, FindLSBPortable, FindLSBGLM);
+	Error += Portable == GLM ? 0 : 1;
+
+	return Error;
+}
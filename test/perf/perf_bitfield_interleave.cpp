@@ -0,0 +1,240 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/bitfield.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+// Shift and mask cascades of the single value functions, the only implementation without BMI2
+namespace cascade
+{
+	static glm::uint32 spread2(glm::uint32 x)
+	{
+		x = ((x << 8) | x) & 0x00FF00FFu;
+		x = ((x << 4) | x) & 0x0F0F0F0Fu;
+		x = ((x << 2) | x) & 0x33333333u;
+		x = ((x << 1) | x) & 0x55555555u;
+		return x;
+	}
+
+	static glm::uint64 spread2(glm::uint64 x)
+	{
+		x = ((x << 16) | x) & 0x0000FFFF0000FFFFull;
+		x = ((x << 8) | x) & 0x00FF00FF00FF00FFull;
+		x = ((x << 4) | x) & 0x0F0F0F0F0F0F0F0Full;
+		x = ((x << 2) | x) & 0x3333333333333333ull;
+		x = ((x << 1) | x) & 0x5555555555555555ull;
+		return x;
+	}
+
+	static glm::uint64 spread3(glm::uint64 x)
+	{
+		x = ((x << 32) | x) & 0xFFFF00000000FFFFull;
+		x = ((x << 16) | x) & 0x00FF0000FF0000FFull;
+		x = ((x << 8) | x) & 0xF00F00F00F00F00Full;
+		x = ((x << 4) | x) & 0x30C30C30C30C30C3ull;
+		x = ((x << 2) | x) & 0x9249249249249249ull;
+		return x;
+	}
+
+	static glm::uint32 compact2(glm::uint32 x)
+	{
+		x = x & 0x55555555u;
+		x = ((x >> 1) | x) & 0x33333333u;
+		x = ((x >> 2) | x) & 0x0F0F0F0Fu;
+		x = ((x >> 4) | x) & 0x00FF00FFu;
+		x = ((x >> 8) | x) & 0x0000FFFFu;
+		return x;
+	}
+
+	static glm::uint64 compact2(glm::uint64 x)
+	{
+		x = x & 0x5555555555555555ull;
+		x = ((x >> 1) | x) & 0x3333333333333333ull;
+		x = ((x >> 2) | x) & 0x0F0F0F0F0F0F0F0Full;
+		x = ((x >> 4) | x) & 0x00FF00FF00FF00FFull;
+		x = ((x >> 8) | x) & 0x0000FFFF0000FFFFull;
+		x = ((x >> 16) | x) & 0x00000000FFFFFFFFull;
+		return x;
+	}
+
+	static glm::uint32 interleave(glm::u16vec2 const& v)
+	{
+		return spread2(glm::uint32(v.x)) | (spread2(glm::uint32(v.y)) << 1);
+	}
+
+	static glm::uint64 interleave(glm::u32vec2 const& v)
+	{
+		return spread2(glm::uint64(v.x)) | (spread2(glm::uint64(v.y)) << 1);
+	}
+
+	static glm::uint64 interleave(glm::u16vec3 const& v)
+	{
+		return spread3(v.x) | (spread3(v.y) << 1) | (spread3(v.z) << 2);
+	}
+
+	static glm::uint64 interleave(glm::u32vec3 const& v)
+	{
+		return spread3(v.x) | (spread3(v.y) << 1) | (spread3(v.z) << 2);
+	}
+
+	static glm::u16vec2 deinterleave(glm::uint32 x)
+	{
+		return glm::u16vec2(compact2(x), compact2(x >> 1));
+	}
+
+	static glm::u32vec2 deinterleave(glm::uint64 x)
+	{
+		return glm::u32vec2(compact2(x), compact2(x >> 1));
+	}
+}//namespace cascade
+
+static glm::uint32 random(glm::uint32& Seed)
+{
+	Seed = Seed * 1664525u + 1013904223u;
+	return Seed ^ (Seed >> 15);
+}
+
+static void init(std::vector<glm::u16vec2>& In, glm::uint32& Seed)
+{
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = glm::u16vec2(random(Seed), random(Seed));
+}
+
+static void init(std::vector<glm::u32vec2>& In, glm::uint32& Seed)
+{
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = glm::u32vec2(random(Seed), random(Seed));
+}
+
+// Points of a 2^16 grid
+static void init(std::vector<glm::u16vec3>& In, glm::uint32& Seed)
+{
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = glm::u16vec3(random(Seed), random(Seed), random(Seed));
+}
+
+// Points of a 2^21 grid, the largest whose Morton codes fit in 64 bits
+static void init(std::vector<glm::u32vec3>& In, glm::uint32& Seed)
+{
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = glm::u32vec3(random(Seed) & 0x1FFFFF, random(Seed) & 0x1FFFFF, random(Seed) & 0x1FFFFF);
+}
+
+static void init(std::vector<glm::uint32>& In, glm::uint32& Seed)
+{
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = random(Seed);
+}
+
+static void init(std::vector<glm::uint64>& In, glm::uint32& Seed)
+{
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = (glm::uint64(random(Seed)) << 32) | random(Seed);
+}
+
+static double nanoseconds(std::size_t Elements, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(Elements);
+}
+
+static void report(char const* Name, std::size_t Count, double CascadeTime, double LoopTime, double ArrayTime)
+{
+	std::printf("%s, %d elements:\n", Name, static_cast<int>(Count));
+	std::printf("- Shift and mask cascade loop: %.2f ns/element\n", CascadeTime);
+	std::printf("- Scalar loop: %.2f ns/element, %.2fx\n", LoopTime, LoopTime > 0.0 ? CascadeTime / LoopTime : 0.0);
+	std::printf("- Array: %.2f ns/element, %.2fx\n", ArrayTime, ArrayTime > 0.0 ? CascadeTime / ArrayTime : 0.0);
+}
+
+// Compares the cascades, a loop of bitfieldInterleave and bitfieldInterleave on arrays
+template<typename vecType, typename codeType>
+static int comp_interleave(char const* Name, std::size_t Count, std::size_t Repeat)
+{
+	int Error = 0;
+
+	glm::uint32 Seed = 1;
+	std::vector<vecType> In(Count);
+	init(In, Seed);
+
+	std::vector<codeType> Cascade(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Cascade[i] = cascade::interleave(In[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	std::vector<codeType> Loop(Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Loop[i] = glm::bitfieldInterleave(In[i]);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	std::vector<codeType> Array(Count);
+	std::chrono::high_resolution_clock::time_point const t4 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::bitfieldInterleave(&In[0], &Array[0], Count);
+	std::chrono::high_resolution_clock::time_point const t5 = std::chrono::high_resolution_clock::now();
+
+	report(Name, Count, nanoseconds(Count * Repeat, t0, t1), nanoseconds(Count * Repeat, t2, t3), nanoseconds(Count * Repeat, t4, t5));
+
+	Error += Cascade == Loop ? 0 : 1;
+	Error += Cascade == Array ? 0 : 1;
+
+	return Error;
+}
+
+// Compares the cascades, a loop of bitfieldDeinterleave and bitfieldDeinterleave on arrays
+template<typename codeType, typename vecType>
+static int comp_deinterleave(char const* Name, std::size_t Count, std::size_t Repeat)
+{
+	int Error = 0;
+
+	glm::uint32 Seed = 1;
+	std::vector<codeType> In(Count);
+	init(In, Seed);
+
+	std::vector<vecType> Cascade(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Cascade[i] = cascade::deinterleave(In[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	std::vector<vecType> Loop(Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Loop[i] = glm::bitfieldDeinterleave(In[i]);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	std::vector<vecType> Array(Count);
+	std::chrono::high_resolution_clock::time_point const t4 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::bitfieldDeinterleave(&In[0], &Array[0], Count);
+	std::chrono::high_resolution_clock::time_point const t5 = std::chrono::high_resolution_clock::now();
+
+	report(Name, Count, nanoseconds(Count * Repeat, t0, t1), nanoseconds(Count * Repeat, t2, t3), nanoseconds(Count * Repeat, t4, t5));
+
+	Error += Cascade == Loop ? 0 : 1;
+	Error += Cascade == Array ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	// 16384 elements fit in the caches
+	std::size_t const Count = 16384;
+	std::size_t const Repeat = 2000;
+
+	int Error = 0;
+
+	Error += comp_interleave<glm::u16vec2, glm::uint32>("bitfieldInterleave u16vec2", Count, Repeat);
+	Error += comp_interleave<glm::u32vec2, glm::uint64>("bitfieldInterleave u32vec2", Count, Repeat);
+	Error += comp_interleave<glm::u16vec3, glm::uint64>("bitfieldInterleave u16vec3", Count, Repeat);
+	Error += comp_interleave<glm::u32vec3, glm::uint64>("bitfieldInterleave u32vec3", Count, Repeat);
+	Error += comp_deinterleave<glm::uint32, glm::u16vec2>("bitfieldDeinterleave uint32", Count, Repeat);
+	Error += comp_deinterleave<glm::uint64, glm::u32vec2>("bitfieldDeinterleave uint64", Count, Repeat);
+
+	return Error;
+}
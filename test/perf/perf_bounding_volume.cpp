@@ -0,0 +1,149 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/bounding_volume.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <limits>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+
+static double milliseconds(std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double>(t2 - t1).count() * 1e3;
+}
+
+// Bounds of an array of points, min and max loop against computeBounds
+static int perf_bounds(std::size_t Count)
+{
+	glm::pcg32 Engine(1u);
+	std::vector<glm::vec3> Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Points[i] = glm::linearRand(glm::vec3(-100), glm::vec3(100), Engine);
+	glm::vec3_soa Soa(Count);
+	glm::deinterleave(Points.data(), glm::vec3_soa_view(Soa));
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	glm::aabb<float> Loop = {glm::vec3(std::numeric_limits<float>::infinity()), glm::vec3(-std::numeric_limits<float>::infinity())};
+	for(std::size_t i = 0; i < Count; ++i)
+		Loop = glm::mergeBounds(Loop, Points[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	glm::aabb<float> const Array = glm::computeBounds(Points.data(), Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	glm::aabb<float> const Structure = glm::computeBounds(glm::vec3_soa_view(Soa));
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	std::printf("Bounds of %d points:\n", static_cast<int>(Count));
+	std::printf("- mergeBounds loop: %.2f ms\n", milliseconds(t0, t1));
+	std::printf("- computeBounds of an array: %.2f ms, %.2fx\n", milliseconds(t1, t2), milliseconds(t0, t1) / milliseconds(t1, t2));
+	std::printf("- computeBounds of a structure of arrays: %.2f ms, %.2fx\n", milliseconds(t2, t3), milliseconds(t0, t1) / milliseconds(t2, t3));
+
+	int Error = 0;
+	Error += Array.Min == Loop.Min && Array.Max == Loop.Max ? 0 : 1;
+	Error += Structure.Min == Loop.Min && Structure.Max == Loop.Max ? 0 : 1;
+	return Error;
+}
+
+// World bounds of boxes, transformBounds loop against the batch, then culling against a query box
+static int perf_transform(std::size_t Count)
+{
+	glm::pcg32 Engine(2u);
+	glm::vec3_soa BoxMin(Count), BoxMax(Count), LoopMin(Count), LoopMax(Count), OutMin(Count), OutMax(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Center = glm::linearRand(glm::vec3(-100), glm::vec3(100), Engine);
+		glm::vec3 const Extent = glm::linearRand(glm::vec3(0.1f), glm::vec3(1.1f), Engine);
+		BoxMin.store(i, Center - Extent);
+		BoxMax.store(i, Center + Extent);
+	}
+	glm::mat4 const m = glm::scale(glm::rotate(glm::translate(glm::mat4(1), glm::vec3(10, 0, -5)), 0.7f, glm::normalize(glm::vec3(1, 2, 3))), glm::vec3(1.5f));
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::aabb<float> const Box = {BoxMin.load(i), BoxMax.load(i)};
+		glm::aabb<float> const World = glm::transformBounds(m, Box);
+		LoopMin.store(i, World.Min);
+		LoopMax.store(i, World.Max);
+	}
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	glm::transformBounds(m, BoxMin, BoxMax, OutMin, OutMax);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	glm::aabb<float> const Query = {glm::vec3(-40, -30, -50), glm::vec3(60, 20, 10)};
+	std::vector<bool> Overlap(Count);
+	std::size_t LoopHits = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::aabb<float> const Box = {OutMin.load(i), OutMax.load(i)};
+		Overlap[i] = glm::intersectBoxes(Query, Box);
+		LoopHits += Overlap[i] ? 1 : 0;
+	}
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+	std::vector<std::uint32_t> Mask((Count + 31) / 32);
+	std::size_t const Hits = glm::intersectBoxes(Query, OutMin, OutMax, Mask.data());
+	std::chrono::high_resolution_clock::time_point const t4 = std::chrono::high_resolution_clock::now();
+
+	std::printf("Transform of %d boxes:\n", static_cast<int>(Count));
+	std::printf("- transformBounds loop: %.2f ms\n", milliseconds(t0, t1));
+	std::printf("- transformBounds batch: %.2f ms, %.2fx\n", milliseconds(t1, t2), milliseconds(t0, t1) / milliseconds(t1, t2));
+	std::printf("Overlap of %d boxes with a query box, %d hits:\n", static_cast<int>(Count), static_cast<int>(Hits));
+	std::printf("- intersectBoxes loop: %.2f ms\n", milliseconds(t2, t3));
+	std::printf("- intersectBoxes batch: %.2f ms, %.2fx\n", milliseconds(t3, t4), milliseconds(t2, t3) / milliseconds(t3, t4));
+
+	int Error = Hits == LoopHits ? 0 : 1;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::lessThanEqual(glm::abs(OutMin.load(i) - LoopMin.load(i)), glm::vec3(0.001f))) ? 0 : 1;
+		Error += glm::all(glm::lessThanEqual(glm::abs(OutMax.load(i) - LoopMax.load(i)), glm::vec3(0.001f))) ? 0 : 1;
+		Error += (((Mask[i / 32] >> (i % 32)) & 1u) != 0) == Overlap[i] ? 0 : 1;
+	}
+	return Error;
+}
+
+// Oriented box fitting of small meshes and overlap tests between them
+static int perf_oriented(std::size_t Count)
+{
+	std::size_t const Vertices = 64;
+	glm::pcg32 Engine(3u);
+	std::vector<glm::vec3> Points(Count * Vertices);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const Angle = glm::linearRand(-3.0f, 3.0f, Engine);
+		glm::vec3 const Axis = glm::normalize(glm::linearRand(glm::vec3(-1, -1, 1), glm::vec3(1, 1, 3), Engine));
+		glm::mat3 const Rotation(glm::rotate(glm::mat4(1), Angle, Axis));
+		glm::vec3 const Center = glm::linearRand(glm::vec3(-20), glm::vec3(20), Engine);
+		for(std::size_t v = 0; v < Vertices; ++v)
+			Points[i * Vertices + v] = Center + Rotation * glm::linearRand(glm::vec3(-3, -1, -0.5f), glm::vec3(3, 1, 0.5f), Engine);
+	}
+
+	std::vector<glm::obb<float> > Boxes(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		Boxes[i] = glm::computeOrientedBounds(&Points[i * Vertices], Vertices);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	std::size_t Pairs = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	for(std::size_t j = i + 1; j < Count; ++j)
+		Pairs += glm::intersectBoxes(Boxes[i], Boxes[j]) ? 1 : 0;
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	double const Tests = static_cast<double>(Count) * static_cast<double>(Count - 1) / 2.0;
+	std::printf("Oriented boxes of %d meshes of %d vertices:\n", static_cast<int>(Count), static_cast<int>(Vertices));
+	std::printf("- computeOrientedBounds: %.2f ms\n", milliseconds(t0, t1));
+	std::printf("- intersectBoxes of all pairs: %.2f ms, %.1f Mtests/s, %d overlapping\n", milliseconds(t1, t2), Tests / milliseconds(t1, t2) / 1e3, static_cast<int>(Pairs));
+
+	return Pairs > 0 ? 0 : 1;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += perf_bounds(4000000);
+	Error += perf_transform(1000000);
+	Error += perf_oriented(2000);
+
+	return Error;
+}
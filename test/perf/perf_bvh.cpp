@@ -0,0 +1,131 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/bvh.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <glm/gtc/constants.hpp>
+#include <limits>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+
+static double seconds(std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double>(t2 - t1).count();
+}
+
+// A wavy terrain of Size x Size quads, two triangles each
+static void make_terrain(std::size_t Size, glm::vec3_soa& V0, glm::vec3_soa& V1, glm::vec3_soa& V2)
+{
+	std::vector<glm::vec3> Vertices((Size + 1) * (Size + 1));
+	for(std::size_t y = 0; y <= Size; ++y)
+	for(std::size_t x = 0; x <= Size; ++x)
+	{
+		float const u = static_cast<float>(x) / static_cast<float>(Size) * 2.0f - 1.0f;
+		float const v = static_cast<float>(y) / static_cast<float>(Size) * 2.0f - 1.0f;
+		float const h = 0.1f * glm::sin(u * 7.0f) * glm::cos(v * 5.0f) + 0.05f * glm::sin((u + v) * 23.0f);
+		Vertices[y * (Size + 1) + x] = glm::vec3(u, h, v);
+	}
+
+	V0.resize(Size * Size * 2);
+	V1.resize(Size * Size * 2);
+	V2.resize(Size * Size * 2);
+	for(std::size_t y = 0; y < Size; ++y)
+	for(std::size_t x = 0; x < Size; ++x)
+	{
+		std::size_t const i = (y * Size + x) * 2;
+		glm::vec3 const A = Vertices[y * (Size + 1) + x];
+		glm::vec3 const B = Vertices[y * (Size + 1) + x + 1];
+		glm::vec3 const C = Vertices[(y + 1) * (Size + 1) + x];
+		glm::vec3 const D = Vertices[(y + 1) * (Size + 1) + x + 1];
+		V0.store(i, A);
+		V1.store(i, B);
+		V2.store(i, C);
+		V0.store(i + 1, B);
+		V1.store(i + 1, D);
+		V2.store(i + 1, C);
+	}
+}
+
+// Rays looking down at the terrain from a camera
+static void make_ray(std::size_t r, std::size_t Rays, glm::vec3& Orig, glm::vec3& Dir)
+{
+	float const a = static_cast<float>(r) / static_cast<float>(Rays) * glm::two_pi<float>() * 13.0f;
+	float const d = static_cast<float>(r) / static_cast<float>(Rays);
+	Orig = glm::vec3(0.0f, 2.0f, -2.0f);
+	Dir = glm::vec3(glm::cos(a) * d, -1.0f, glm::sin(a) * d + 0.9f);
+}
+
+int main()
+{
+	int Error = 0;
+
+	glm::vec3_soa V0, V1, V2;
+	make_terrain(512, V0, V1, V2);
+	std::size_t const Count = V0.size();
+
+	glm::vec3_soa BoxMin(Count), BoxMax(Count);
+	glm::computeTriangleBounds(V0, V1, V2, BoxMin, BoxMax);
+
+	unsigned const Threads = glm::max(std::thread::hardware_concurrency(), 1u);
+
+	glm::bvh<float> Serial;
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	Serial.build(BoxMin, BoxMax, 4, 1);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	glm::bvh<float> Bvh;
+	Bvh.build(BoxMin, BoxMax, 4, Threads);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	std::printf("bvh build of %d triangles, %d nodes:\n", static_cast<int>(Count), static_cast<int>(Bvh.nodes().size()));
+	std::printf("- 1 thread: %.1f ms\n", seconds(t0, t1) * 1e3);
+	std::printf("- %d threads: %.1f ms\n", static_cast<int>(Threads), seconds(t1, t2) * 1e3);
+	Error += Serial.indices() == Bvh.indices() ? 0 : 1;
+
+	// Brute force over a few rays, the bvh over many
+	std::size_t const LoopRays = 32;
+	std::size_t const BvhRays = 100000;
+
+	std::vector<std::size_t> Loop(LoopRays, Count);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < LoopRays; ++r)
+	{
+		glm::vec3 Orig, Dir;
+		make_ray(r * (BvhRays / LoopRays), BvhRays, Orig, Dir);
+		float Nearest = std::numeric_limits<float>::infinity();
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec2 Bary;
+			float Distance;
+			if(glm::intersectRayTriangle(Orig, Dir, V0.load(i), V1.load(i), V2.load(i), Bary, Distance) && Distance >= 0.0f && Distance < Nearest)
+			{
+				Nearest = Distance;
+				Loop[r] = i;
+			}
+		}
+	}
+	std::chrono::high_resolution_clock::time_point const t4 = std::chrono::high_resolution_clock::now();
+
+	std::vector<std::size_t> Traced(BvhRays, Count);
+	for(std::size_t r = 0; r < BvhRays; ++r)
+	{
+		glm::vec3 Orig, Dir;
+		make_ray(r, BvhRays, Orig, Dir);
+		glm::vec2 Bary;
+		float Distance;
+		if(!glm::intersectRayTriangle(Bvh, Orig, Dir, V0, V1, V2, Bary, Distance, Traced[r]))
+			Traced[r] = Count;
+	}
+	std::chrono::high_resolution_clock::time_point const t5 = std::chrono::high_resolution_clock::now();
+
+	double const LoopRate = static_cast<double>(LoopRays) / seconds(t3, t4);
+	double const BvhRate = static_cast<double>(BvhRays) / seconds(t4, t5);
+	std::printf("Nearest ray triangle intersection:\n");
+	std::printf("- intersectRayTriangle loop: %.1f Krays/s\n", LoopRate / 1e3);
+	std::printf("- bvh: %.1f Krays/s, %.0fx\n", BvhRate / 1e3, BvhRate / LoopRate);
+
+	for(std::size_t r = 0; r < LoopRays; ++r)
+		Error += Loop[r] == Traced[r * (BvhRays / LoopRays)] ? 0 : 1;
+
+	return Error;
+}
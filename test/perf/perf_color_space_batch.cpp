@@ -0,0 +1,117 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/ext/color_space_batch.hpp>
+#include <glm/gtx/color_space_YCoCg.hpp>
+#include <glm/gtx/color_encoding.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/vector_uint4_sized.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+static double megapixels(std::size_t Pixels, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	double const Seconds = std::chrono::duration<double>(t2 - t1).count();
+	return Seconds > 0.0 ? static_cast<double>(Pixels) / Seconds / 1e6 : 0.0;
+}
+
+static void print(char const* Name, double Loop, double Batch)
+{
+	std::printf("%s:\n", Name);
+	std::printf("- Single color loop: %.1f MPix/s\n", Loop);
+	std::printf("- Array: %.1f MPix/s, %.2fx\n", Batch, Loop > 0.0 ? Batch / Loop : 0.0);
+}
+
+// Times the single color function over the image then the array function, and checks that they agree
+template<typename vecType, typename single, typename batch>
+static int comp(char const* Name, std::vector<vecType> const& In, std::size_t Repeat, single Single, batch Batch, float Epsilon)
+{
+	std::size_t const Count = In.size();
+	std::vector<vecType> Loop(Count);
+	std::vector<vecType> Array(Count);
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Loop[i] = Single(In[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		Batch(&In[0], &Array[0], Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	print(Name, megapixels(Count * Repeat, t0, t1), megapixels(Count * Repeat, t1, t2));
+
+	int Error = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Loop[i], Array[i], Epsilon)) ? 0 : 1;
+	return Error;
+}
+
+static int comp_uint8(std::vector<glm::vec4> const& In, std::size_t Repeat)
+{
+	std::size_t const Count = In.size();
+	std::vector<glm::u8vec4> Encoded(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Encoded[i] = glm::u8vec4(In[i] * 255.0f);
+
+	std::vector<glm::vec4> Loop(Count);
+	std::vector<glm::vec4> Array(Count);
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Loop[i] = glm::convertSRGBToLinear(glm::vec4(Encoded[i]) / 255.0f);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::convertSRGBToLinear(&Encoded[0], &Array[0], Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	print("convertSRGBToLinear u8vec4 to vec4", megapixels(Count * Repeat, t0, t1), megapixels(Count * Repeat, t1, t2));
+
+	int Error = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Loop[i], Array[i], 0.0f)) ? 0 : 1;
+	return Error;
+}
+
+int main()
+{
+	// A 512x512 image
+	std::size_t const Count = 512 * 512;
+	std::size_t const Repeat = 10;
+
+	std::vector<glm::vec4> Colors4(Count);
+	std::vector<glm::vec3> Colors3(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Colors4[i] = glm::vec4(
+			static_cast<float>(i % 251) / 250.0f,
+			static_cast<float>(i % 241) / 240.0f,
+			static_cast<float>(i % 239) / 238.0f,
+			static_cast<float>(i % 233) / 232.0f);
+		Colors3[i] = glm::vec3(Colors4[i]);
+	}
+
+	int Error = 0;
+
+	Error += comp("convertLinearToSRGB vec3", Colors3, Repeat,
+		static_cast<glm::vec3(*)(glm::vec3 const&)>(glm::convertLinearToSRGB),
+		static_cast<void(*)(glm::vec3 const*, glm::vec3*, std::size_t)>(glm::convertLinearToSRGB), 1e-5f);
+	Error += comp("convertLinearToSRGB vec4", Colors4, Repeat,
+		static_cast<glm::vec4(*)(glm::vec4 const&)>(glm::convertLinearToSRGB),
+		static_cast<void(*)(glm::vec4 const*, glm::vec4*, std::size_t)>(glm::convertLinearToSRGB), 1e-5f);
+	Error += comp("convertSRGBToLinear vec4", Colors4, Repeat,
+		static_cast<glm::vec4(*)(glm::vec4 const&)>(glm::convertSRGBToLinear),
+		static_cast<void(*)(glm::vec4 const*, glm::vec4*, std::size_t)>(glm::convertSRGBToLinear), 1e-5f);
+	Error += comp_uint8(Colors4, Repeat);
+	Error += comp("rgb2YCoCg vec3", Colors3, Repeat,
+		static_cast<glm::vec3(*)(glm::vec3 const&)>(glm::rgb2YCoCg),
+		static_cast<void(*)(glm::vec3 const*, glm::vec3*, std::size_t)>(glm::rgb2YCoCg), 1e-6f);
+	Error += comp("convertLinearSRGBToD65XYZ vec3", Colors3, Repeat,
+		static_cast<glm::vec3(*)(glm::vec3 const&)>(glm::convertLinearSRGBToD65XYZ),
+		static_cast<void(*)(glm::vec3 const*, glm::vec3*, std::size_t)>(glm::convertLinearSRGBToD65XYZ), 1e-5f);
+
+	return Error;
+}
@@ -0,0 +1,109 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/frustum_culling.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+
+static double milliseconds(std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double>(t2 - t1).count() * 1e3;
+}
+
+static void make_planes(glm::vec4 Planes[6])
+{
+	glm::mat4 const Projection = glm::perspectiveRH_ZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 200.0f);
+	glm::mat4 const View = glm::lookAtRH(glm::vec3(10, 5, 20), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0));
+	glm::extractFrustumPlanesZO(Projection * View, Planes);
+}
+
+// Spheres scattered around the camera, intersectFrustumSphere loop against the batch
+static int perf_spheres(std::size_t Count)
+{
+	glm::vec4 Planes[6];
+	make_planes(Planes);
+
+	glm::pcg32 Engine(1u);
+	glm::vec3_soa Center(Count);
+	std::vector<float> Radius(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Center.store(i, glm::linearRand(glm::vec3(-150), glm::vec3(150), Engine));
+		Radius[i] = glm::linearRand(0.1f, 4.1f, Engine);
+	}
+
+	std::vector<bool> Visible(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	std::size_t LoopHits = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Visible[i] = glm::intersectFrustumSphere(Planes, Center.load(i), Radius[i]);
+		LoopHits += Visible[i] ? 1 : 0;
+	}
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	std::vector<std::uint32_t> Mask((Count + 31) / 32);
+	std::size_t const Hits = glm::intersectFrustumSpheres(Planes, glm::vec3_soa_view(Center), Radius.data(), Mask.data());
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	std::printf("Frustum culling of %d spheres, %d visible:\n", static_cast<int>(Count), static_cast<int>(Hits));
+	std::printf("- intersectFrustumSphere loop: %.2f ms\n", milliseconds(t0, t1));
+	std::printf("- intersectFrustumSpheres batch: %.2f ms, %.2fx\n", milliseconds(t1, t2), milliseconds(t0, t1) / milliseconds(t1, t2));
+
+	// Only FMA contraction of the loop may change the results of spheres touching a plane
+	std::size_t Mismatches = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+		Mismatches += (((Mask[i / 32] >> (i % 32)) & 1u) != 0) == Visible[i] ? 0 : 1;
+	return Mismatches <= Count / 10000 && Hits > 0 && Hits < Count ? 0 : 1;
+}
+
+// Boxes scattered around the camera, intersectFrustumBox loop against the batch
+static int perf_boxes(std::size_t Count)
+{
+	glm::vec4 Planes[6];
+	make_planes(Planes);
+
+	glm::pcg32 Engine(2u);
+	glm::vec3_soa BoxMin(Count), BoxMax(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Center = glm::linearRand(glm::vec3(-150), glm::vec3(150), Engine);
+		glm::vec3 const Extent = glm::linearRand(glm::vec3(0.1f), glm::vec3(4.1f), Engine);
+		BoxMin.store(i, Center - Extent);
+		BoxMax.store(i, Center + Extent);
+	}
+
+	std::vector<bool> Visible(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	std::size_t LoopHits = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Visible[i] = glm::intersectFrustumBox(Planes, BoxMin.load(i), BoxMax.load(i));
+		LoopHits += Visible[i] ? 1 : 0;
+	}
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	std::vector<std::uint32_t> Mask((Count + 31) / 32);
+	std::size_t const Hits = glm::intersectFrustumBoxes(Planes, glm::vec3_soa_view(BoxMin), glm::vec3_soa_view(BoxMax), Mask.data());
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	std::printf("Frustum culling of %d boxes, %d visible:\n", static_cast<int>(Count), static_cast<int>(Hits));
+	std::printf("- intersectFrustumBox loop: %.2f ms\n", milliseconds(t0, t1));
+	std::printf("- intersectFrustumBoxes batch: %.2f ms, %.2fx\n", milliseconds(t1, t2), milliseconds(t0, t1) / milliseconds(t1, t2));
+
+	std::size_t Mismatches = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+		Mismatches += (((Mask[i / 32] >> (i % 32)) & 1u) != 0) == Visible[i] ? 0 : 1;
+	return Mismatches <= Count / 10000 && Hits > 0 && Hits < Count ? 0 : 1;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += perf_spheres(2000000);
+	Error += perf_boxes(2000000);
+
+	return Error;
+}
@@ -0,0 +1,158 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/ext/intersect_batch.hpp>
+#include <glm/gtx/intersect.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <limits>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+static double megatests(std::size_t Tests, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	double const Seconds = std::chrono::duration<double>(t2 - t1).count();
+	return Seconds > 0.0 ? static_cast<double>(Tests) / Seconds / 1e6 : 0.0;
+}
+
+static void print(char const* Name, double Loop, double Batch)
+{
+	std::printf("%s:\n", Name);
+	std::printf("- intersectRayTriangle loop: %.1f M tests/s\n", Loop);
+	std::printf("- Batch: %.1f M tests/s, %.2fx\n", Batch, Loop > 0.0 ? Batch / Loop : 0.0);
+}
+
+// A grid of small triangles in the plane z = i % 64 facing the rays
+static void make_triangles(std::size_t Count, glm::vec3_soa& V0, glm::vec3_soa& V1, glm::vec3_soa& V2)
+{
+	V0.resize(Count);
+	V1.resize(Count);
+	V2.resize(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Corner(
+			static_cast<float>(i % 32) * 0.0625f - 1.0f,
+			static_cast<float>((i / 32) % 32) * 0.0625f - 1.0f,
+			static_cast<float>(i % 64));
+		V0.store(i, Corner);
+		V1.store(i, Corner + glm::vec3(0.0625f, 0.0f, 0.0f));
+		V2.store(i, Corner + glm::vec3(0.0f, 0.0625f, 0.0f));
+	}
+}
+
+static glm::vec3 make_origin(std::size_t r)
+{
+	return glm::vec3(
+		static_cast<float>(r % 61) / 30.0f - 1.0f,
+		static_cast<float>(r % 59) / 29.0f - 1.0f,
+		-1.0f);
+}
+
+static glm::vec3 make_direction(std::size_t r)
+{
+	return glm::vec3(static_cast<float>(r % 7) * 0.001f, static_cast<float>(r % 5) * 0.001f, 1.0f);
+}
+
+// One ray against all the triangles, nearest hit
+static int comp_triangles(std::size_t Count, std::size_t Rays)
+{
+	glm::vec3_soa V0, V1, V2;
+	make_triangles(Count, V0, V1, V2);
+
+	std::vector<std::size_t> Loop(Rays, Count);
+	std::vector<std::size_t> Batch(Rays, Count);
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Rays; ++r)
+	{
+		glm::vec3 const Orig = make_origin(r);
+		glm::vec3 const Dir = make_direction(r);
+		float Nearest = std::numeric_limits<float>::infinity();
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			glm::vec2 Bary;
+			float Distance;
+			if(glm::intersectRayTriangle(Orig, Dir, V0.load(i), V1.load(i), V2.load(i), Bary, Distance) && Distance >= 0.0f && Distance < Nearest)
+			{
+				Nearest = Distance;
+				Loop[r] = i;
+			}
+		}
+	}
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Rays; ++r)
+	{
+		glm::vec2 Bary;
+		float Distance;
+		if(!glm::intersectRayTriangles(make_origin(r), make_direction(r), V0, V1, V2, Bary, Distance, Batch[r]))
+			Batch[r] = Count;
+	}
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	print("intersectRayTriangles", megatests(Count * Rays, t0, t1), megatests(Count * Rays, t1, t2));
+
+	int Error = 0;
+	for(std::size_t r = 0; r < Rays; ++r)
+		Error += Loop[r] == Batch[r] ? 0 : 1;
+	return Error;
+}
+
+// A packet of rays against each triangle, nearest hit of each ray
+static int comp_rays(std::size_t Count, std::size_t Rays)
+{
+	glm::vec3_soa V0, V1, V2;
+	make_triangles(Count, V0, V1, V2);
+
+	glm::vec3_soa Orig(Rays), Dir(Rays);
+	for(std::size_t r = 0; r < Rays; ++r)
+	{
+		Orig.store(r, make_origin(r));
+		Dir.store(r, make_direction(r));
+	}
+
+	std::vector<float> LoopDistance(Rays, std::numeric_limits<float>::infinity());
+	std::vector<std::size_t> Loop(Rays, Count);
+	std::vector<float> BatchDistance(Rays, std::numeric_limits<float>::infinity());
+	std::vector<std::size_t> Batch(Rays, Count);
+	glm::vec2_soa Bary(Rays);
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const A = V0.load(i);
+		glm::vec3 const B = V1.load(i);
+		glm::vec3 const C = V2.load(i);
+		for(std::size_t r = 0; r < Rays; ++r)
+		{
+			glm::vec2 b;
+			float Distance;
+			if(glm::intersectRayTriangle(Orig.load(r), Dir.load(r), A, B, C, b, Distance) && Distance >= 0.0f && Distance < LoopDistance[r])
+			{
+				Bary.store(r, b);
+				LoopDistance[r] = Distance;
+				Loop[r] = i;
+			}
+		}
+	}
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		glm::intersectRaysTriangle(Orig, Dir, V0.load(i), V1.load(i), V2.load(i), i, Bary, &BatchDistance[0], &Batch[0]);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	print("intersectRaysTriangle", megatests(Count * Rays, t0, t1), megatests(Count * Rays, t1, t2));
+
+	int Error = 0;
+	for(std::size_t r = 0; r < Rays; ++r)
+		Error += Loop[r] == Batch[r] ? 0 : 1;
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += comp_triangles(4096, 1024);
+	Error += comp_rays(1024, 4096);
+
+	return Error;
+}
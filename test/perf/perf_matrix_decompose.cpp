@@ -0,0 +1,107 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_decompose.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+
+static double milliseconds(std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double>(t2 - t1).count() * 1e3;
+}
+
+// Scene graph like transforms, translation, rotation and non uniform scale
+static glm::mat4 make_transform(glm::pcg32& Engine)
+{
+	glm::vec3 const Axis = glm::normalize(glm::linearRand(glm::vec3(-1, -1, 0.5f), glm::vec3(1, 1, 2.5f), Engine));
+	glm::vec3 const Scale = glm::linearRand(glm::vec3(0.25f), glm::vec3(3.25f), Engine);
+	glm::vec3 const Translation = glm::linearRand(glm::vec3(-100), glm::vec3(100), Engine);
+	float const Angle = glm::linearRand(-3.0f, 3.0f, Engine);
+	return glm::scale(glm::rotate(glm::translate(glm::mat4(1), Translation), Angle, Axis), Scale);
+}
+
+// decompose loop against the affine decomposition, one matrix at a time and batched
+static int perf_decompose(std::size_t Count)
+{
+	glm::pcg32 Engine(1u);
+	std::vector<glm::mat4> Matrices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Matrices[i] = make_transform(Engine);
+
+	std::vector<glm::vec3> Scale(Count), Translation(Count), Skew(Count);
+	std::vector<glm::quat> Orientation(Count);
+	std::vector<glm::vec4> Perspective(Count);
+
+	unsigned const Threads = std::thread::hardware_concurrency() > 0 ? std::thread::hardware_concurrency() : 1;
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	std::size_t LoopCount = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+		LoopCount += glm::decompose(Matrices[i], Scale[i], Orientation[i], Translation[i], Skew[i], Perspective[i]) ? 1 : 0;
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	std::size_t AffineCount = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+		AffineCount += glm::decomposeAffine(Matrices[i], Scale[i], Orientation[i], Translation[i], Skew[i]) ? 1 : 0;
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	std::size_t const BatchCount = glm::decomposeAffine(Matrices.data(), Scale.data(), Orientation.data(), Translation.data(), Skew.data(), Count);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+	std::size_t const ThreadedCount = glm::decomposeAffine(Matrices.data(), Scale.data(), Orientation.data(), Translation.data(), Skew.data(), Count, Threads);
+	std::chrono::high_resolution_clock::time_point const t4 = std::chrono::high_resolution_clock::now();
+
+	std::printf("Decomposition of %d matrices:\n", static_cast<int>(Count));
+	std::printf("- decompose loop: %.2f ms\n", milliseconds(t0, t1));
+	std::printf("- decomposeAffine loop: %.2f ms, %.2fx\n", milliseconds(t1, t2), milliseconds(t0, t1) / milliseconds(t1, t2));
+	std::printf("- decomposeAffine batch: %.2f ms, %.2fx\n", milliseconds(t2, t3), milliseconds(t0, t1) / milliseconds(t2, t3));
+	std::printf("- decomposeAffine batch with %d threads: %.2f ms, %.2fx\n", static_cast<int>(Threads), milliseconds(t3, t4), milliseconds(t0, t1) / milliseconds(t3, t4));
+
+	return LoopCount == Count && AffineCount == Count && BatchCount == Count && ThreadedCount == Count ? 0 : 1;
+}
+
+// recompose loop against the affine recomposition batched to mat4 and to the mat3x4 of GLM_EXT_matrix_affine
+static int perf_recompose(std::size_t Count)
+{
+	std::vector<glm::vec3> Scale(Count), Translation(Count), Skew(Count);
+	std::vector<glm::quat> Orientation(Count);
+	glm::pcg32 Engine(2u);
+	for(std::size_t i = 0; i < Count; ++i)
+		glm::decomposeAffine(make_transform(Engine), Scale[i], Orientation[i], Translation[i], Skew[i]);
+
+	std::vector<glm::mat4> Loop(Count), Batch(Count);
+	std::vector<glm::mat3x4> Batch34(Count);
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		Loop[i] = glm::recompose(Scale[i], Orientation[i], Translation[i], Skew[i], glm::vec4(0, 0, 0, 1));
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	glm::recomposeAffine(Scale.data(), Orientation.data(), Translation.data(), Skew.data(), Batch.data(), Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	glm::recomposeAffine(Scale.data(), Orientation.data(), Translation.data(), Skew.data(), Batch34.data(), Count);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	std::printf("Recomposition of %d matrices:\n", static_cast<int>(Count));
+	std::printf("- recompose loop: %.2f ms\n", milliseconds(t0, t1));
+	std::printf("- recomposeAffine batch to mat4: %.2f ms, %.2fx\n", milliseconds(t1, t2), milliseconds(t0, t1) / milliseconds(t1, t2));
+	std::printf("- recomposeAffine batch to mat3x4: %.2f ms, %.2fx\n", milliseconds(t2, t3), milliseconds(t0, t1) / milliseconds(t2, t3));
+
+	int Error = 0;
+	for(std::size_t i = 0; i < Count; i += 997)
+	{
+		Error += glm::all(glm::equal(Batch[i], Loop[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineFromMat4(Batch[i]), Batch34[i], 0.0f)) ? 0 : 1;
+	}
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += perf_decompose(1000000);
+	Error += perf_recompose(1000000);
+
+	return Error;
+}
@@ -0,0 +1,86 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_factorisation.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+static double milliseconds(std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double>(t2 - t1).count() * 1e3;
+}
+
+// Deformation gradients, identity plus a random perturbation
+static glm::mat3 make_matrix(glm::pcg32& Engine)
+{
+	glm::mat3 m(1);
+	for(glm::length_t c = 0; c < 3; ++c)
+		m[c] += glm::linearRand(glm::vec3(-0.5f), glm::vec3(0.5f), Engine);
+	return m;
+}
+
+// svd_decompose loop against the batch
+static int perf_svd(std::size_t Count)
+{
+	std::vector<glm::mat3> m(Count), u(Count), v(Count), BatchU(Count), BatchV(Count);
+	std::vector<glm::vec3> s(Count), BatchS(Count);
+	glm::pcg32 Engine(1u);
+	for(std::size_t i = 0; i < Count; ++i)
+		m[i] = make_matrix(Engine);
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		glm::svd_decompose(m[i], u[i], s[i], v[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	glm::svd_decompose(m.data(), BatchU.data(), BatchS.data(), BatchV.data(), Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	std::printf("Singular value decomposition of %d matrices:\n", static_cast<int>(Count));
+	std::printf("- svd_decompose loop: %.2f ms\n", milliseconds(t0, t1));
+	std::printf("- svd_decompose batch: %.2f ms, %.2fx\n", milliseconds(t1, t2), milliseconds(t0, t1) / milliseconds(t1, t2));
+
+	int Error = 0;
+	for(std::size_t i = 0; i < Count; i += 997)
+		Error += glm::all(glm::equal(s[i], BatchS[i], 0.001f)) ? 0 : 1;
+	return Error;
+}
+
+// polar_decompose loop against the batch
+static int perf_polar(std::size_t Count)
+{
+	std::vector<glm::mat3> m(Count), r(Count), p(Count), BatchR(Count), BatchP(Count);
+	glm::pcg32 Engine(1u);
+	for(std::size_t i = 0; i < Count; ++i)
+		m[i] = make_matrix(Engine);
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		glm::polar_decompose(m[i], r[i], p[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	glm::polar_decompose(m.data(), BatchR.data(), BatchP.data(), Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	std::printf("Polar decomposition of %d matrices:\n", static_cast<int>(Count));
+	std::printf("- polar_decompose loop: %.2f ms\n", milliseconds(t0, t1));
+	std::printf("- polar_decompose batch: %.2f ms, %.2fx\n", milliseconds(t1, t2), milliseconds(t0, t1) / milliseconds(t1, t2));
+
+	int Error = 0;
+	for(std::size_t i = 0; i < Count; i += 997)
+	{
+		Error += glm::all(glm::equal(r[i], BatchR[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(p[i], BatchP[i], 0.001f)) ? 0 : 1;
+	}
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += perf_svd(1000000);
+	Error += perf_polar(1000000);
+
+	return Error;
+}
@@ -98,10 +98,13 @@ static int comp_mat4_inverse(std::size_t Samples)
 	packedMatType const Scale(0.01, 0.02, 0.05, 0.04, 0.02, 0.08, 0.05, 0.01, 0.08, 0.03, 0.05, 0.06, 0.02, 0.03, 0.07, 0.05);
 
 	std::vector<packedMatType> SISD;
-	std::printf("- SISD: %d us\n", launch_mat_inverse<packedMatType>(SISD, Scale, Samples));
+	int const TimeSISD = launch_mat_inverse<packedMatType>(SISD, Scale, Samples);
+	std::printf("- SISD: %d us\n", TimeSISD);
 
 	std::vector<alignedMatType> SIMD;
-	std::printf("- SIMD: %d us\n", launch_mat_inverse<alignedMatType>(SIMD, Scale, Samples));
+	int const TimeSIMD = launch_mat_inverse<alignedMatType>(SIMD, Scale, Samples);
+	std::printf("- SIMD: %d us\n", TimeSIMD);
+	std::printf("- Speedup: %.2fx\n", static_cast<double>(TimeSISD) / static_cast<double>(TimeSIMD > 0 ? TimeSIMD : 1));
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
@@ -116,7 +119,7 @@ static int comp_mat4_inverse(std::size_t Samples)
 
 int main()
 {
-	std::size_t const Samples = 10;
+	std::size_t const Samples = 1000;
 
 	int Error = 0;
 
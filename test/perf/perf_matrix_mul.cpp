@@ -150,10 +150,13 @@ static int comp_mat4_mul_mat4(std::size_t Samples)
 	packedMatType const Scale(0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05, 0.01, 0.02, 0.03, 0.05);
 
 	std::vector<packedMatType> SISD;
-	std::printf("- SISD: %d us\n", launch_mat_mul_mat<packedMatType>(SISD, Transform, Scale, Samples));
+	int const TimeSISD = launch_mat_mul_mat<packedMatType>(SISD, Transform, Scale, Samples);
+	std::printf("- SISD: %d us\n", TimeSISD);
 
 	std::vector<alignedMatType> SIMD;
-	std::printf("- SIMD: %d us\n", launch_mat_mul_mat<alignedMatType>(SIMD, Transform, Scale, Samples));
+	int const TimeSIMD = launch_mat_mul_mat<alignedMatType>(SIMD, Transform, Scale, Samples);
+	std::printf("- SIMD: %d us\n", TimeSIMD);
+	std::printf("- Speedup: %.2fx\n", static_cast<double>(TimeSISD) / static_cast<double>(TimeSIMD > 0 ? TimeSIMD : 1));
 
 	for(std::size_t i = 0; i < Samples; ++i)
 	{
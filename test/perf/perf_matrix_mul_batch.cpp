@@ -0,0 +1,117 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/matrix_batch.hpp>
+#include <glm/ext/matrix_float3x4.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+// Floating-point operations of one product
+static double flops(glm::mat4 const&)
+{
+	return 64.0 + 48.0;
+}
+
+// Affine product skipping the implicit last rows
+static double flops(glm::mat3x4 const&)
+{
+	return 36.0 + 27.0;
+}
+
+template<typename matType>
+static matType make_transform(std::size_t i)
+{
+	matType Result;
+	for(glm::length_t c = 0; c < matType::length(); ++c)
+	for(glm::length_t r = 0; r < matType::col_type::length(); ++r)
+		Result[c][r] = static_cast<float>(static_cast<int>((i * 5 + static_cast<std::size_t>(c * 4 + r) * 3) % 17) - 8) * 0.0625f;
+	return Result;
+}
+
+static glm::mat4 loop_product(glm::mat4 const& A, glm::mat4 const& B)
+{
+	return A * B;
+}
+
+static glm::mat3x4 loop_product(glm::mat3x4 const& A, glm::mat3x4 const& B)
+{
+	return glm::affineMultiply(A, B);
+}
+
+static double gflops(double Flops, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	double const Seconds = std::chrono::duration<double>(t2 - t1).count();
+	return Seconds > 0.0 ? Flops / Seconds * 1e-9 : 0.0;
+}
+
+// Compares out[i] = a[parent[i]] * b[i] computed by a loop of products and by multiply
+template<typename matType>
+static int comp_mul_batch(char const* Name, std::size_t Count, bool Indexed, std::size_t Repeat)
+{
+	int Error = 0;
+
+	std::vector<matType> A(Count);
+	std::vector<matType> B(Count);
+	std::vector<unsigned int> Parent(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i] = make_transform<matType>(i);
+		B[i] = make_transform<matType>(i + 7);
+		// Scattered parents, as in a scene graph sorted by depth
+		Parent[i] = static_cast<unsigned int>(Indexed ? (i * 2654435761u) % Count : i);
+	}
+
+	std::vector<matType> Loop(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Loop[i] = loop_product(A[Parent[i]], B[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	std::vector<matType> Batch(Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	{
+		if(Indexed)
+			glm::multiply(&A[0], &Parent[0], &B[0], &Batch[0], Count);
+		else
+			glm::multiply(&A[0], &B[0], &Batch[0], Count);
+	}
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	double const Flops = flops(matType()) * static_cast<double>(Count) * static_cast<double>(Repeat);
+	double const LoopGFlops = gflops(Flops, t0, t1);
+	double const BatchGFlops = gflops(Flops, t2, t3);
+	std::printf("%s, %d products%s:\n", Name, static_cast<int>(Count), Indexed ? ", indexed" : "");
+	std::printf("- Loop: %.2f GFLOP/s\n", LoopGFlops);
+	std::printf("- Batch: %.2f GFLOP/s\n", BatchGFlops);
+	std::printf("- Speedup: %.2fx\n", LoopGFlops > 0.0 ? BatchGFlops / LoopGFlops : 0.0);
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Loop[i], Batch[i], 0.001f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	// 1024 products fit in the caches, 262144 products read and write 48 MiB of mat4
+	std::size_t const Small = 1024;
+	std::size_t const Large = 262144;
+
+	int Error = 0;
+
+	Error += comp_mul_batch<glm::mat4>("mat4 * mat4", Small, false, 1000);
+	Error += comp_mul_batch<glm::mat4>("mat4 * mat4", Small, true, 1000);
+	Error += comp_mul_batch<glm::mat4>("mat4 * mat4", Large, false, 4);
+	Error += comp_mul_batch<glm::mat4>("mat4 * mat4", Large, true, 4);
+
+	Error += comp_mul_batch<glm::mat3x4>("affine mat3x4 * mat3x4", Small, false, 1000);
+	Error += comp_mul_batch<glm::mat3x4>("affine mat3x4 * mat3x4", Small, true, 1000);
+	Error += comp_mul_batch<glm::mat3x4>("affine mat3x4 * mat3x4", Large, false, 4);
+	Error += comp_mul_batch<glm::mat3x4>("affine mat3x4 * mat3x4", Large, true, 4);
+
+	return Error;
+}
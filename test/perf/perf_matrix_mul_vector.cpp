@@ -7,6 +7,8 @@
 #include <glm/ext/matrix_double4x4.hpp>
 #include <glm/ext/matrix_transform.hpp>
 #include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_batch.hpp>
+#include <glm/ext/vector_float3.hpp>
 #include <glm/ext/vector_float4.hpp>
 #if GLM_CONFIG_SIMD == GLM_ENABLE
 #include <glm/gtc/type_aligned.hpp>
@@ -122,6 +124,44 @@ static int comp_mat4_mul_vec4(std::size_t Samples)
 	return Error;
 }
 
+template <typename matType, typename vecType>
+static int comp_mat4_transform_batch(std::size_t Samples)
+{
+	typedef typename matType::value_type T;
+	typedef glm::vec<4, T, glm::defaultp> col_type;
+
+	int Error = 0;
+
+	matType const Transform(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+	vecType const Scale(0.01, 0.02, 0.05);
+
+	std::vector<vecType> I(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		I[i] = Scale * static_cast<T>(i);
+
+	std::vector<vecType> Loop(Samples, vecType(0));
+	std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop[i] = vecType(Transform * col_type(I[i], static_cast<T>(1)));
+	std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+	std::vector<vecType> Batch(Samples, vecType(0));
+	glm::transform(Transform, &I[0], &Batch[0], Samples); // Warm up, the loop above already touched I
+	std::chrono::high_resolution_clock::time_point t3 = std::chrono::high_resolution_clock::now();
+	glm::transform(Transform, &I[0], &Batch[0], Samples);
+	std::chrono::high_resolution_clock::time_point t4 = std::chrono::high_resolution_clock::now();
+
+	int const TimeLoop = static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count());
+	int const TimeBatch = static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t4 - t3).count());
+	std::printf("- Loop: %d us\n", TimeLoop);
+	std::printf("- Batch: %d us\n", TimeBatch);
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(Loop[i], Batch[i], static_cast<T>(0.001))) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	std::size_t const Samples = 1000;
@@ -146,6 +186,12 @@ int main()
 	std::printf("dmat4 * dvec4:\n");
 	Error += comp_mat4_mul_vec4<glm::dmat4, glm::dvec4, glm::aligned_dmat4, glm::aligned_dvec4>(Samples);
 
+	std::printf("transform(mat4, vec3[]):\n");
+	Error += comp_mat4_transform_batch<glm::mat4, glm::vec3>(Samples * 100);
+
+	std::printf("transform(dmat4, dvec3[]):\n");
+	Error += comp_mat4_transform_batch<glm::dmat4, glm::dvec3>(Samples * 100);
+
 	return Error;
 }
 
@@ -0,0 +1,98 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/noise_batch.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+static double nanoseconds(std::size_t Elements, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(Elements);
+}
+
+static void report(char const* Name, int Octaves, std::size_t Count, double LoopTime, double BatchTime)
+{
+	std::printf("%s, %d octaves, %d points:\n", Name, Octaves, static_cast<int>(Count));
+	std::printf("- Scalar loop: %.2f ns/point\n", LoopTime);
+	std::printf("- Batch: %.2f ns/point, %.2fx\n", BatchTime, BatchTime > 0.0 ? LoopTime / BatchTime : 0.0);
+}
+
+template<glm::length_t L>
+struct perlin_op
+{
+	static char const* name() {return L == 2 ? "perlinFbm vec2" : L == 3 ? "perlinFbm vec3" : "perlinFbm vec4";}
+	static float noise(glm::vec<L, float> const& p) {return glm::perlin(p);}
+	static void batch(glm::vec_soa<L, float> const& p, int Octaves, float* out) {glm::perlinFbm(p, Octaves, 2.0f, 0.5f, out);}
+};
+
+template<glm::length_t L>
+struct simplex_op
+{
+	static char const* name() {return L == 2 ? "simplexFbm vec2" : L == 3 ? "simplexFbm vec3" : "simplexFbm vec4";}
+	static float noise(glm::vec<L, float> const& p) {return glm::simplex(p);}
+	static void batch(glm::vec_soa<L, float> const& p, int Octaves, float* out) {glm::simplexFbm(p, Octaves, 2.0f, 0.5f, out);}
+};
+
+// Compares a loop of the scalar noise summing the octaves one point at a time with the batch function
+template<glm::length_t L, typename op>
+static int comp(std::size_t Count, std::size_t Repeat, int Octaves)
+{
+	int Error = 0;
+
+	// Points of a grid of step 1/16, as when filling a texture
+	std::vector<glm::vec<L, float> > Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	for(glm::length_t c = 0; c < L; ++c)
+		Points[i][c] = static_cast<float>((i >> (c * 4)) % 64) / 16.0f + static_cast<float>(c) * 3.0f;
+	glm::vec_soa<L, float> const Soa(&Points[0], Count);
+
+	std::vector<float> Loop(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float Sum = op::noise(Points[i]);
+		float Frequency = 1.0f;
+		float Amplitude = 1.0f;
+		for(int o = 1; o < Octaves; ++o)
+		{
+			Frequency *= 2.0f;
+			Amplitude *= 0.5f;
+			Sum += Amplitude * op::noise(Points[i] * Frequency);
+		}
+		Loop[i] = Sum;
+	}
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	std::vector<float> Batch(Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		op::batch(Soa, Octaves, &Batch[0]);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	report(op::name(), Octaves, Count, nanoseconds(Count * Repeat, t0, t1), nanoseconds(Count * Repeat, t2, t3));
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::equal(Loop[i], Batch[i], 0.0001f) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Count = 4096;
+	std::size_t const Repeat = 50;
+
+	int Error = 0;
+
+	Error += comp<2, perlin_op<2> >(Count, Repeat, 1);
+	Error += comp<3, perlin_op<3> >(Count, Repeat, 1);
+	Error += comp<4, perlin_op<4> >(Count, Repeat, 1);
+	Error += comp<2, simplex_op<2> >(Count, Repeat, 1);
+	Error += comp<3, simplex_op<3> >(Count, Repeat, 1);
+	Error += comp<4, simplex_op<4> >(Count, Repeat, 1);
+	Error += comp<3, perlin_op<3> >(Count, Repeat, 4);
+	Error += comp<3, simplex_op<3> >(Count, Repeat, 4);
+
+	return Error;
+}
@@ -0,0 +1,140 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/packing_batch.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+// Interleaved vertex: position, normal, texture coordinates and color
+struct vertex
+{
+	glm::vec3 Position;
+	glm::vec4 Normal;
+	glm::vec2 TexCoord;
+	glm::vec4 Color;
+};
+
+static double nanoseconds(std::size_t Elements, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(Elements);
+}
+
+// Compares a loop of the single element functions with packBatch, packing the attributes of an interleaved vertex buffer
+static int comp_vertices(std::size_t Count, std::size_t Repeat)
+{
+	int Error = 0;
+
+	std::vector<vertex> In(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const f = static_cast<float>(i % 257) / 256.0f;
+		In[i].Position = glm::vec3(f * 10.0f, 1.0f - f, f * f);
+		In[i].Normal = glm::vec4(f - 0.5f, 0.5f - f, 0.25f, 1.0f);
+		In[i].TexCoord = glm::vec2(f, 1.0f - f);
+		In[i].Color = glm::vec4(f, 0.5f, 1.0f - f, 1.0f);
+	}
+
+	// Packed vertex: half4 position, 10-10-10-2 normal, unorm16 texture coordinates and unorm8 color in 20 bytes
+	std::size_t const Stride = 20;
+
+	std::vector<unsigned char> Loop(Count * Stride);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		unsigned char* const d = &Loop[i * Stride];
+		glm::uint64 const Position = glm::packHalf4x16(glm::vec4(In[i].Position, 1.0f));
+		glm::uint32 const Normal = glm::packSnorm3x10_1x2(In[i].Normal);
+		glm::uint const TexCoord = glm::packUnorm2x16(In[i].TexCoord);
+		glm::uint const Color = glm::packUnorm4x8(In[i].Color);
+		std::memcpy(d, &Position, 8);
+		std::memcpy(d + 8, &Normal, 4);
+		std::memcpy(d + 12, &TexCoord, 4);
+		std::memcpy(d + 16, &Color, 4);
+	}
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	// The position only has 3 components, its w is written separately
+	std::vector<unsigned char> Batch(Count * Stride);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	{
+		glm::packBatch(glm::packing_half2x16, &In[0].Position.x, sizeof(vertex), &Batch[0], Stride, Count);
+		glm::packBatch(glm::packing_half2x16, &In[0].Position.z, sizeof(vertex), &Batch[4], Stride, Count);
+		glm::packBatch(glm::packing_snorm3x10_1x2, &In[0].Normal.x, sizeof(vertex), &Batch[8], Stride, Count);
+		glm::packBatch(glm::packing_unorm2x16, &In[0].TexCoord.x, sizeof(vertex), &Batch[12], Stride, Count);
+		glm::packBatch(glm::packing_unorm4x8, &In[0].Color.x, sizeof(vertex), &Batch[16], Stride, Count);
+	}
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	double const LoopTime = nanoseconds(Count * Repeat, t0, t1);
+	double const BatchTime = nanoseconds(Count * Repeat, t2, t3);
+	std::printf("Interleaved vertices, %d elements:\n", static_cast<int>(Count));
+	std::printf("- Single element functions: %.2f ns/vertex\n", LoopTime);
+	std::printf("- packBatch: %.2f ns/vertex\n", BatchTime);
+	std::printf("- Speedup: %.2fx\n", BatchTime > 0.0 ? LoopTime / BatchTime : 0.0);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		// packHalf2x16 of (z, w) writes the w half float of the position
+		Error += std::memcmp(&Loop[i * Stride], &Batch[i * Stride], 6) == 0 ? 0 : 1;
+		Error += std::memcmp(&Loop[i * Stride + 8], &Batch[i * Stride + 8], Stride - 8) == 0 ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// Compares a loop of the single element function with packBatch and unpackBatch on tightly packed arrays
+static int comp_format(glm::packing_format Format, char const* Name, std::size_t Count, std::size_t Repeat)
+{
+	int Error = 0;
+
+	std::size_t const L = static_cast<std::size_t>(glm::packingComponents(Format));
+	std::size_t const Size = glm::packingSize(Format);
+
+	std::vector<float> In(Count * L);
+	for(std::size_t i = 0; i < In.size(); ++i)
+		In[i] = static_cast<float>(static_cast<int>(i % 509) - 254) / 254.0f;
+
+	std::vector<unsigned char> Packed(Count * Size);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::packBatch(Format, &In[0], L * sizeof(float), &Packed[0], Size, Count);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	std::vector<float> Out(Count * L);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::unpackBatch(Format, &Packed[0], Size, &Out[0], L * sizeof(float), Count);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	double const PackTime = nanoseconds(Count * Repeat, t0, t1);
+	double const UnpackTime = nanoseconds(Count * Repeat, t2, t3);
+	double const Bytes = static_cast<double>(L * sizeof(float) + Size);
+	std::printf("%s, %d elements:\n", Name, static_cast<int>(Count));
+	std::printf("- packBatch: %.2f ns/element, %.2f GB/s\n", PackTime, PackTime > 0.0 ? Bytes / PackTime : 0.0);
+	std::printf("- unpackBatch: %.2f ns/element, %.2f GB/s\n", UnpackTime, UnpackTime > 0.0 ? Bytes / UnpackTime : 0.0);
+
+	std::vector<unsigned char> Repacked(Count * Size);
+	glm::packBatch(Format, &Out[0], L * sizeof(float), &Repacked[0], Size, Count);
+	Error += Packed == Repacked ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	// 4096 elements fit in the caches
+	std::size_t const Count = 4096;
+	std::size_t const Repeat = 2000;
+
+	int Error = 0;
+
+	Error += comp_vertices(Count, Repeat);
+	Error += comp_format(glm::packing_unorm4x8, "unorm4x8", Count, Repeat);
+	Error += comp_format(glm::packing_snorm3x10_1x2, "snorm3x10_1x2", Count, Repeat);
+	Error += comp_format(glm::packing_half4x16, "half4x16", Count, Repeat);
+	Error += comp_format(glm::packing_unorm1x5_1x6_1x5, "unorm1x5_1x6_1x5", Count, Repeat);
+
+	return Error;
+}
@@ -0,0 +1,96 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/packing.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+static double nanoseconds(std::size_t Elements, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(Elements);
+}
+
+static void report(char const* Name, std::size_t Count, double LoopTime, double ArrayTime)
+{
+	// Bytes read and written per element
+	double const Bytes = static_cast<double>(sizeof(float) + sizeof(glm::uint16));
+
+	std::printf("%s, %d elements:\n", Name, static_cast<int>(Count));
+	std::printf("- Scalar loop: %.2f ns/element, %.2f GB/s\n", LoopTime, LoopTime > 0.0 ? Bytes / LoopTime : 0.0);
+	std::printf("- Array: %.2f ns/element, %.2f GB/s\n", ArrayTime, ArrayTime > 0.0 ? Bytes / ArrayTime : 0.0);
+	std::printf("- Speedup: %.2fx\n", ArrayTime > 0.0 ? LoopTime / ArrayTime : 0.0);
+}
+
+// Compares a loop of packHalf1x16 with packHalf on arrays
+static int comp_pack(std::size_t Count, std::size_t Repeat)
+{
+	int Error = 0;
+
+	std::vector<float> In(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = (static_cast<float>(i % 1531) - 765.0f) * 0.37f;
+
+	std::vector<glm::uint16> Loop(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Loop[i] = glm::packHalf1x16(In[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	std::vector<glm::uint16> Array(Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::packHalf(&In[0], &Array[0], Count);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	report("packHalf", Count, nanoseconds(Count * Repeat, t0, t1), nanoseconds(Count * Repeat, t2, t3));
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += Loop[i] == Array[i] ? 0 : 1;
+
+	return Error;
+}
+
+// Compares a loop of unpackHalf1x16 with unpackHalf on arrays
+static int comp_unpack(std::size_t Count, std::size_t Repeat)
+{
+	int Error = 0;
+
+	// Finite half floats
+	std::vector<glm::uint16> In(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = static_cast<glm::uint16>((i * 7919) % 0x7c00 | (i & 1) << 15);
+
+	std::vector<float> Loop(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Loop[i] = glm::unpackHalf1x16(In[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	std::vector<float> Array(Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::unpackHalf(&In[0], &Array[0], Count);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	report("unpackHalf", Count, nanoseconds(Count * Repeat, t0, t1), nanoseconds(Count * Repeat, t2, t3));
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::packHalf1x16(Loop[i]) == glm::packHalf1x16(Array[i]) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	// 16384 elements fit in the caches
+	std::size_t const Count = 16384;
+	std::size_t const Repeat = 2000;
+
+	int Error = 0;
+
+	Error += comp_pack(Count, Repeat);
+	Error += comp_unpack(Count, Repeat);
+
+	return Error;
+}
@@ -0,0 +1,127 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/pca.hpp>
+#include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/random.hpp>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+
+static double milliseconds(std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double>(t2 - t1).count() * 1e3;
+}
+
+// Covariance of a point cloud: center then computeCovarianceMatrix, against the single pass accumulator
+static int perf_covariance(std::size_t Count)
+{
+	glm::pcg32 Engine(1u);
+	std::vector<glm::dvec3> Points(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::dvec3 const p = glm::linearRand(glm::dvec3(-1), glm::dvec3(1), Engine);
+		Points[i] = glm::dvec3(100.0, 200.0, 300.0) + glm::dvec3(p.x * 3.0, p.x + p.y, p.z * 0.5 - p.y);
+	}
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	glm::dvec3 Center(0);
+	for(std::size_t i = 0; i < Count; ++i)
+		Center += Points[i];
+	Center /= static_cast<double>(Count);
+	glm::dmat3 const TwoPass = glm::computeCovarianceMatrix(Points.data(), Points.size(), Center);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	glm::covariance_accumulator<3, double> Single;
+	glm::accumulateCovariance(Single, Points.data(), Points.size());
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	unsigned const Threads = glm::max(std::thread::hardware_concurrency(), 1u);
+	glm::covariance_accumulator<3, double> Parallel;
+	glm::accumulateCovariance(Parallel, Points.data(), Points.size(), Threads);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	std::printf("Covariance of %d dvec3:\n", static_cast<int>(Count));
+	std::printf("- Center and computeCovarianceMatrix: %.1f ms\n", milliseconds(t0, t1));
+	std::printf("- accumulateCovariance: %.1f ms, %.2fx\n", milliseconds(t1, t2), milliseconds(t0, t1) / milliseconds(t1, t2));
+	std::printf("- accumulateCovariance, %d threads: %.1f ms, %.2fx\n", static_cast<int>(Threads), milliseconds(t2, t3), milliseconds(t0, t1) / milliseconds(t2, t3));
+
+	int Error = 0;
+	glm::dmat3 const SingleMat = glm::computeCovarianceMatrix(Single);
+	glm::dmat3 const ParallelMat = glm::computeCovarianceMatrix(Parallel);
+	for(glm::length_t c = 0; c < 3; ++c)
+	{
+		Error += glm::all(glm::epsilonEqual(TwoPass[c], SingleMat[c], 1e-9)) ? 0 : 1;
+		Error += glm::all(glm::epsilonEqual(TwoPass[c], ParallelMat[c], 1e-9)) ? 0 : 1;
+	}
+	return Error;
+}
+
+// 3x3 eigen decomposition: generic Householder and QL against Jacobi rotations
+template<typename T>
+static int perf_eigen(std::size_t Count)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3Type;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3Type;
+
+	glm::pcg32 Engine(2u);
+	std::vector<mat3Type> Matrices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		vec3Type const Diagonal = glm::linearRand(vec3Type(1), vec3Type(3), Engine);
+		vec3Type const Lower = glm::linearRand(vec3Type(-1), vec3Type(1), Engine);
+		mat3Type m;
+		m[0][0] = Diagonal.x;
+		m[1][1] = Diagonal.y;
+		m[2][2] = Diagonal.z;
+		m[0][1] = m[1][0] = Lower.x;
+		m[0][2] = m[2][0] = Lower.y;
+		m[1][2] = m[2][1] = Lower.z;
+		Matrices[i] = m;
+	}
+
+	std::vector<vec3Type> ValuesQL(Count), ValuesJacobi(Count);
+	std::vector<mat3Type> VectorsQL(Count), VectorsJacobi(Count);
+	unsigned int Found = 0;
+
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		Found += glm::findEigenvaluesSymReal(Matrices[i], ValuesQL[i], VectorsQL[i]);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		Found += glm::findEigenvaluesSymRealJacobi(Matrices[i], ValuesJacobi[i], VectorsJacobi[i]);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+
+	std::printf("Eigen decomposition of %d %s symmetric 3x3 matrices:\n", static_cast<int>(Count), sizeof(T) == 4 ? "float" : "double");
+	std::printf("- findEigenvaluesSymReal: %.1f ms\n", milliseconds(t0, t1));
+	std::printf("- findEigenvaluesSymRealJacobi: %.1f ms, %.2fx\n", milliseconds(t1, t2), milliseconds(t0, t1) / milliseconds(t1, t2));
+
+	// Same eigenvalues once sorted, largest residual of A * v = lambda * v
+	int Error = Found == Count * 6 ? 0 : 1;
+	T ResidualQL(0), ResidualJacobi(0);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::sortEigenvalues(ValuesQL[i], VectorsQL[i]);
+		glm::sortEigenvalues(ValuesJacobi[i], VectorsJacobi[i]);
+		Error += glm::all(glm::epsilonEqual(ValuesQL[i], ValuesJacobi[i], static_cast<T>(1e-4))) ? 0 : 1;
+		for(glm::length_t c = 0; c < 3; ++c)
+		{
+			ResidualQL = glm::max(ResidualQL, glm::length(Matrices[i] * VectorsQL[i][c] - VectorsQL[i][c] * ValuesQL[i][c]));
+			ResidualJacobi = glm::max(ResidualJacobi, glm::length(Matrices[i] * VectorsJacobi[i][c] - VectorsJacobi[i][c] * ValuesJacobi[i][c]));
+		}
+	}
+	std::printf("- Largest residual: %g with findEigenvaluesSymReal, %g with findEigenvaluesSymRealJacobi\n", static_cast<double>(ResidualQL), static_cast<double>(ResidualJacobi));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += perf_covariance(4000000);
+	Error += perf_eigen<float>(200000);
+	Error += perf_eigen<double>(200000);
+
+	return Error;
+}
@@ -0,0 +1,145 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/quaternion_batch.hpp>
+#include <glm/ext/quaternion_common.hpp>
+#include <glm/ext/quaternion_float.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+static glm::quat make_quat(std::size_t i)
+{
+	float const Angle = static_cast<float>(i % 97) * 0.13f - 6.0f;
+	glm::vec3 const Axis = glm::normalize(glm::vec3(1.0f, static_cast<float>(i % 5) - 2.0f, 0.5f + static_cast<float>(i % 3)));
+	return glm::angleAxis(Angle, Axis);
+}
+
+struct data
+{
+	explicit data(std::size_t Count)
+		: X(Count), Y(Count), A(Count), V(Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = make_quat(i);
+			Y[i] = make_quat(i * 7 + 3);
+			A[i] = static_cast<float>(i % 11) / 10.0f;
+			V[i] = glm::vec3(static_cast<float>(i % 13) - 6.0f, 1.5f, static_cast<float>(i % 7));
+		}
+	}
+
+	std::vector<glm::quat> X;
+	std::vector<glm::quat> Y;
+	std::vector<float> A;
+	std::vector<glm::vec3> V;
+};
+
+static glm::quat nlerp(glm::quat const& x, glm::quat const& y, float a)
+{
+	glm::quat const z = glm::dot(x, y) < 0.0f ? -y : y;
+	return glm::normalize(x * (1.0f - a) + z * a);
+}
+
+struct slerp_op
+{
+	typedef glm::quat value_type;
+	static char const* name() {return "slerp";}
+	static void loop(data const& d, glm::quat* out, std::size_t n) {for(std::size_t i = 0; i < n; ++i) out[i] = glm::slerp(d.X[i], d.Y[i], d.A[i]);}
+	static void batch(data const& d, glm::quat* out, std::size_t n) {glm::slerp(&d.X[0], &d.Y[0], &d.A[0], out, n);}
+	static bool equal(glm::quat const& a, glm::quat const& b) {return glm::all(glm::equal(a, b, 0.0001f));}
+};
+
+struct nlerp_op
+{
+	typedef glm::quat value_type;
+	static char const* name() {return "nlerp";}
+	static void loop(data const& d, glm::quat* out, std::size_t n) {for(std::size_t i = 0; i < n; ++i) out[i] = nlerp(d.X[i], d.Y[i], d.A[i]);}
+	static void batch(data const& d, glm::quat* out, std::size_t n) {glm::nlerp(&d.X[0], &d.Y[0], &d.A[0], out, n);}
+	static bool equal(glm::quat const& a, glm::quat const& b) {return glm::all(glm::equal(a, b, 0.0001f));}
+};
+
+struct rotate_op
+{
+	typedef glm::vec3 value_type;
+	static char const* name() {return "quat * vec3";}
+	static void loop(data const& d, glm::vec3* out, std::size_t n) {for(std::size_t i = 0; i < n; ++i) out[i] = d.X[i] * d.V[i];}
+	static void batch(data const& d, glm::vec3* out, std::size_t n) {glm::transform(&d.X[0], &d.V[0], out, n);}
+	static bool equal(glm::vec3 const& a, glm::vec3 const& b) {return glm::all(glm::equal(a, b, 0.0001f));}
+};
+
+struct mat3_op
+{
+	typedef glm::mat3 value_type;
+	static char const* name() {return "mat3_cast";}
+	static void loop(data const& d, glm::mat3* out, std::size_t n) {for(std::size_t i = 0; i < n; ++i) out[i] = glm::mat3_cast(d.X[i]);}
+	static void batch(data const& d, glm::mat3* out, std::size_t n) {glm::mat3_cast(&d.X[0], out, n);}
+	static bool equal(glm::mat3 const& a, glm::mat3 const& b) {return glm::all(glm::equal(a, b, 0.0001f));}
+};
+
+struct mat4_op
+{
+	typedef glm::mat4 value_type;
+	static char const* name() {return "mat4_cast";}
+	static void loop(data const& d, glm::mat4* out, std::size_t n) {for(std::size_t i = 0; i < n; ++i) out[i] = glm::mat4_cast(d.X[i]);}
+	static void batch(data const& d, glm::mat4* out, std::size_t n) {glm::mat4_cast(&d.X[0], out, n);}
+	static bool equal(glm::mat4 const& a, glm::mat4 const& b) {return glm::all(glm::equal(a, b, 0.0001f));}
+};
+
+static double nanoseconds(std::size_t Elements, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(Elements);
+}
+
+// Compares a loop of the scalar function with the batch function
+template<typename op>
+static int comp_batch(std::size_t Count, std::size_t Repeat)
+{
+	typedef typename op::value_type value_type;
+
+	int Error = 0;
+
+	data const Data(Count);
+
+	std::vector<value_type> Loop(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		op::loop(Data, &Loop[0], Count);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	std::vector<value_type> Batch(Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		op::batch(Data, &Batch[0], Count);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	double const LoopTime = nanoseconds(Count * Repeat, t0, t1);
+	double const BatchTime = nanoseconds(Count * Repeat, t2, t3);
+	std::printf("%s, %d elements:\n", op::name(), static_cast<int>(Count));
+	std::printf("- Loop: %.2f ns/element\n", LoopTime);
+	std::printf("- Batch: %.2f ns/element\n", BatchTime);
+	std::printf("- Speedup: %.2fx\n", BatchTime > 0.0 ? LoopTime / BatchTime : 0.0);
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += op::equal(Loop[i], Batch[i]) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	// 4096 elements fit in the caches
+	std::size_t const Count = 4096;
+	std::size_t const Repeat = 500;
+
+	int Error = 0;
+
+	Error += comp_batch<slerp_op>(Count, Repeat);
+	Error += comp_batch<nlerp_op>(Count, Repeat);
+	Error += comp_batch<rotate_op>(Count, Repeat);
+	Error += comp_batch<mat3_op>(Count, Repeat);
+	Error += comp_batch<mat4_op>(Count, Repeat);
+
+	return Error;
+}
@@ -0,0 +1,128 @@
+#define GLM_FORCE_INLINE
+#include <glm/gtc/random.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <glm/geometric.hpp>
+#include <glm/vector_relational.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+
+static double nanoseconds(std::size_t Elements, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(Elements);
+}
+
+// Generation of the previous versions of linearRand, one std::rand call per byte of the components
+static glm::vec4 rand_vec4(glm::vec4 const& Min, glm::vec4 const& Max)
+{
+	glm::uvec4 Bits(0);
+	for(int Byte = 0; Byte < 4; ++Byte)
+	for(glm::length_t c = 0; c < 4; ++c)
+		Bits[c] = (Bits[c] << 8) | static_cast<glm::uint>(std::rand() % 255);
+	return glm::vec4(Bits) / static_cast<float>(0xFFFFFFFFu) * (Max - Min) + Min;
+}
+
+static int check(std::vector<glm::vec4> const& Values, glm::vec4 const& Min, glm::vec4 const& Max)
+{
+	int Error = 0;
+	for(std::size_t i = 0; i < Values.size(); ++i)
+	{
+		Error += glm::all(glm::greaterThanEqual(Values[i], Min)) ? 0 : 1;
+		Error += glm::all(glm::lessThanEqual(Values[i], Max)) ? 0 : 1;
+	}
+	return Error;
+}
+
+// Compares the scalar sphericalRand and gaussRand, drawing from the same engine, with the array overloads
+static int comp_distributions(std::size_t Count, std::size_t Repeat)
+{
+	int Error = 0;
+
+	glm::xoshiro128x8 Engine(2u);
+
+	std::vector<glm::vec3> Sphere(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Sphere[i] = glm::sphericalRand(1.0f, Engine);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::sphericalRand(1.0f, &Sphere[0], Count, Engine);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::abs(glm::length(Sphere[i]) - 1.0f) < 0.0001f ? 0 : 1;
+
+	std::vector<float> Gauss(Count);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Gauss[i] = glm::gaussRand(0.0f, 1.0f, Engine);
+	std::chrono::high_resolution_clock::time_point const t4 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::gaussRand(0.0f, 1.0f, &Gauss[0], Count, Engine);
+	std::chrono::high_resolution_clock::time_point const t5 = std::chrono::high_resolution_clock::now();
+
+	double const SphereLoop = nanoseconds(Count * Repeat, t0, t1);
+	double const SphereBatch = nanoseconds(Count * Repeat, t1, t2);
+	double const GaussLoop = nanoseconds(Count * Repeat, t3, t4);
+	double const GaussBatch = nanoseconds(Count * Repeat, t4, t5);
+
+	std::printf("sphericalRand vec3, %d samples:\n", static_cast<int>(Count));
+	std::printf("- Scalar loop: %.2f ns/sample\n", SphereLoop);
+	std::printf("- Array: %.2f ns/sample, %.2fx\n", SphereBatch, SphereBatch > 0.0 ? SphereLoop / SphereBatch : 0.0);
+	std::printf("gaussRand float, %d samples:\n", static_cast<int>(Count));
+	std::printf("- Scalar loop: %.2f ns/sample\n", GaussLoop);
+	std::printf("- Array: %.2f ns/sample, %.2fx\n", GaussBatch, GaussBatch > 0.0 ? GaussLoop / GaussBatch : 0.0);
+
+	return Error;
+}
+
+int main()
+{
+	std::size_t const Count = 1 << 16;
+	std::size_t const Repeat = 20;
+
+	int Error = 0;
+
+	glm::vec4 const Min(-1.0f, 0.0f, 2.0f, -8.0f);
+	glm::vec4 const Max(1.0f, 4.0f, 3.0f, 8.0f);
+	std::vector<glm::vec4> Values(Count);
+
+	std::srand(1);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Values[i] = rand_vec4(Min, Max);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+	Error += check(Values, Min, Max);
+
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+	for(std::size_t i = 0; i < Count; ++i)
+		Values[i] = glm::linearRand(Min, Max);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+	Error += check(Values, Min, Max);
+
+	glm::xoshiro128x8 Engine(1u);
+	std::chrono::high_resolution_clock::time_point const t4 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		glm::linearRand(Min, Max, &Values[0], Count, Engine);
+	std::chrono::high_resolution_clock::time_point const t5 = std::chrono::high_resolution_clock::now();
+	Error += check(Values, Min, Max);
+
+	double const RandTime = nanoseconds(Count * Repeat, t0, t1);
+	double const EngineTime = nanoseconds(Count * Repeat, t2, t3);
+	double const BatchTime = nanoseconds(Count * Repeat, t4, t5);
+
+	std::printf("linearRand vec4, %d vectors:\n", static_cast<int>(Count));
+	std::printf("- std::rand bytes: %.2f ns/vector\n", RandTime);
+	std::printf("- pcg32 of the thread: %.2f ns/vector, %.2fx\n", EngineTime, EngineTime > 0.0 ? RandTime / EngineTime : 0.0);
+	std::printf("- xoshiro128x8 array: %.2f ns/vector, %.2fx\n", BatchTime, BatchTime > 0.0 ? RandTime / BatchTime : 0.0);
+
+	Error += comp_distributions(Count, Repeat);
+
+	return Error;
+}
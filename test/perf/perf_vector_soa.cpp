@@ -0,0 +1,143 @@
+#define GLM_FORCE_INLINE
+#include <glm/ext/vector_soa.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+
+struct data
+{
+	explicit data(std::size_t Count)
+		: X(Count), Y(Count), A(Count)
+	{
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			X[i] = glm::vec3(static_cast<float>(i % 13) - 6.0f, 1.5f, static_cast<float>(i % 7) + 0.5f);
+			Y[i] = glm::vec3(0.25f, static_cast<float>(i % 5) - 2.5f, static_cast<float>(i % 11) - 3.0f);
+			A[i] = static_cast<float>(i % 9) / 8.0f;
+		}
+		SoaX = glm::vec3_soa(&X[0], Count);
+		SoaY = glm::vec3_soa(&Y[0], Count);
+	}
+
+	std::vector<glm::vec3> X;
+	std::vector<glm::vec3> Y;
+	std::vector<float> A;
+	glm::vec3_soa SoaX;
+	glm::vec3_soa SoaY;
+};
+
+struct dot_op
+{
+	typedef float value_type;
+	static char const* name() {return "dot";}
+	static void loop(data const& d, std::vector<float>& out) {for(std::size_t i = 0; i < out.size(); ++i) out[i] = glm::dot(d.X[i], d.Y[i]);}
+	static void batch(data const& d, std::vector<float>& out, glm::vec3_soa&) {glm::dot(d.SoaX, d.SoaY, &out[0]);}
+	static bool equal(float a, float b) {return glm::equal(a, b, 0.0001f);}
+};
+
+struct length_op
+{
+	typedef float value_type;
+	static char const* name() {return "length";}
+	static void loop(data const& d, std::vector<float>& out) {for(std::size_t i = 0; i < out.size(); ++i) out[i] = glm::length(d.X[i]);}
+	static void batch(data const& d, std::vector<float>& out, glm::vec3_soa&) {glm::length(d.SoaX, &out[0]);}
+	static bool equal(float a, float b) {return glm::equal(a, b, 0.0001f);}
+};
+
+struct cross_op
+{
+	typedef glm::vec3 value_type;
+	static char const* name() {return "cross";}
+	static void loop(data const& d, std::vector<glm::vec3>& out) {for(std::size_t i = 0; i < out.size(); ++i) out[i] = glm::cross(d.X[i], d.Y[i]);}
+	static void batch(data const& d, std::vector<glm::vec3>&, glm::vec3_soa& out) {glm::cross(d.SoaX, d.SoaY, out);}
+	static bool equal(glm::vec3 const& a, glm::vec3 const& b) {return glm::all(glm::equal(a, b, 0.0001f));}
+};
+
+struct normalize_op
+{
+	typedef glm::vec3 value_type;
+	static char const* name() {return "normalize";}
+	static void loop(data const& d, std::vector<glm::vec3>& out) {for(std::size_t i = 0; i < out.size(); ++i) out[i] = glm::normalize(d.X[i]);}
+	static void batch(data const& d, std::vector<glm::vec3>&, glm::vec3_soa& out) {glm::normalize(d.SoaX, out);}
+	static bool equal(glm::vec3 const& a, glm::vec3 const& b) {return glm::all(glm::equal(a, b, 0.0001f));}
+};
+
+struct mix_op
+{
+	typedef glm::vec3 value_type;
+	static char const* name() {return "mix";}
+	static void loop(data const& d, std::vector<glm::vec3>& out) {for(std::size_t i = 0; i < out.size(); ++i) out[i] = glm::mix(d.X[i], d.Y[i], d.A[i]);}
+	static void batch(data const& d, std::vector<glm::vec3>&, glm::vec3_soa& out) {glm::mix(d.SoaX, d.SoaY, &d.A[0], out);}
+	static bool equal(glm::vec3 const& a, glm::vec3 const& b) {return glm::all(glm::equal(a, b, 0.0001f));}
+};
+
+static double nanoseconds(std::size_t Elements, std::chrono::high_resolution_clock::time_point t1, std::chrono::high_resolution_clock::time_point t2)
+{
+	return std::chrono::duration<double, std::nano>(t2 - t1).count() / static_cast<double>(Elements);
+}
+
+// Vector results are written to the structure of arrays, scalar results to the array
+static glm::vec3 result(std::vector<glm::vec3> const&, glm::vec3_soa const& SoaBatch, std::size_t i)
+{
+	return SoaBatch.load(i);
+}
+
+static float result(std::vector<float> const& Batch, glm::vec3_soa const&, std::size_t i)
+{
+	return Batch[i];
+}
+
+// Compares a loop of the scalar function on packed vec3 with the structure of arrays function
+template<typename op>
+static int comp_soa(std::size_t Count, std::size_t Repeat)
+{
+	typedef typename op::value_type value_type;
+
+	int Error = 0;
+
+	data const Data(Count);
+
+	std::vector<value_type> Loop(Count);
+	std::chrono::high_resolution_clock::time_point const t0 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		op::loop(Data, Loop);
+	std::chrono::high_resolution_clock::time_point const t1 = std::chrono::high_resolution_clock::now();
+
+	std::vector<value_type> Batch(Count);
+	glm::vec3_soa SoaBatch(Count);
+	std::chrono::high_resolution_clock::time_point const t2 = std::chrono::high_resolution_clock::now();
+	for(std::size_t r = 0; r < Repeat; ++r)
+		op::batch(Data, Batch, SoaBatch);
+	std::chrono::high_resolution_clock::time_point const t3 = std::chrono::high_resolution_clock::now();
+
+	double const LoopTime = nanoseconds(Count * Repeat, t0, t1);
+	double const BatchTime = nanoseconds(Count * Repeat, t2, t3);
+	std::printf("%s, %d elements:\n", op::name(), static_cast<int>(Count));
+	std::printf("- Packed loop: %.2f ns/element\n", LoopTime);
+	std::printf("- Structure of arrays: %.2f ns/element\n", BatchTime);
+	std::printf("- Speedup: %.2fx\n", BatchTime > 0.0 ? LoopTime / BatchTime : 0.0);
+
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += op::equal(Loop[i], result(Batch, SoaBatch, i)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	// 4096 elements fit in the caches
+	std::size_t const Count = 4096;
+	std::size_t const Repeat = 2000;
+
+	int Error = 0;
+
+	Error += comp_soa<dot_op>(Count, Repeat);
+	Error += comp_soa<length_op>(Count, Repeat);
+	Error += comp_soa<cross_op>(Count, Repeat);
+	Error += comp_soa<normalize_op>(Count, Repeat);
+	Error += comp_soa<mix_op>(Count, Repeat);
+
+	return Error;
+}